@@ -0,0 +1,295 @@
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <iomanip>
+#include <istream>
+#include <numeric>
+#include <ostream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Raz::Benchmark {
+
+namespace {
+
+struct BenchmarkEntry {
+  std::string name;
+  BenchmarkFunction function;
+};
+
+std::vector<BenchmarkEntry>& getBenchmarks() {
+  static std::vector<BenchmarkEntry> benchmarks;
+  return benchmarks;
+}
+
+std::chrono::nanoseconds runSample(BenchmarkFunction function, std::size_t iterationCount) {
+  State state(iterationCount);
+  function(state);
+  return state.getElapsedTime();
+}
+
+// Doubles the iteration count until a sample lasts at least the given time
+std::size_t computeIterationCount(BenchmarkFunction function, std::chrono::nanoseconds minSampleTime) {
+  constexpr std::size_t maxIterationCount = std::size_t(1) << 30;
+
+  std::size_t iterationCount = 1;
+
+  while (iterationCount < maxIterationCount && runSample(function, iterationCount) < minSampleTime)
+    iterationCount *= 2;
+
+  return iterationCount;
+}
+
+// Nearest-rank percentile of sorted values
+double computePercentile(const std::vector<double>& sortedValues, double percentile) {
+  const auto rank = static_cast<std::size_t>(std::ceil(percentile * static_cast<double>(sortedValues.size())));
+  return sortedValues[std::clamp<std::size_t>(rank, 1, sortedValues.size()) - 1];
+}
+
+std::string escapeJson(const std::string& str) {
+  std::string escapedStr;
+  escapedStr.reserve(str.size());
+
+  for (const char chr : str) {
+    if (chr == '"' || chr == '\\')
+      escapedStr += '\\';
+
+    escapedStr += chr;
+  }
+
+  return escapedStr;
+}
+
+// Reader of the subset of JSON written by writeJson(): objects, arrays, strings & numbers
+class JsonReader {
+public:
+  explicit JsonReader(std::istream& stream) : m_stream{ stream } {}
+
+  void expect(char expectedChar) {
+    if (readChar() != expectedChar)
+      throw std::invalid_argument(std::string("Error: Invalid benchmark results; expected '") + expectedChar + "'");
+  }
+
+  bool tryRead(char expectedChar) {
+    skipSpaces();
+
+    if (m_stream.peek() != expectedChar)
+      return false;
+
+    m_stream.get();
+    return true;
+  }
+
+  std::string readString() {
+    expect('"');
+
+    std::string str;
+
+    for (int chr = m_stream.get(); chr != '"'; chr = m_stream.get()) {
+      if (chr == std::char_traits<char>::eof())
+        throw std::invalid_argument("Error: Invalid benchmark results; unterminated string");
+
+      if (chr == '\\')
+        chr = m_stream.get();
+
+      str += static_cast<char>(chr);
+    }
+
+    return str;
+  }
+
+  double readNumber() {
+    skipSpaces();
+
+    double number {};
+    if (!(m_stream >> number))
+      throw std::invalid_argument("Error: Invalid benchmark results; expected a number");
+
+    return number;
+  }
+
+private:
+  void skipSpaces() {
+    while (std::isspace(m_stream.peek()))
+      m_stream.get();
+  }
+
+  char readChar() {
+    skipSpaces();
+    return static_cast<char>(m_stream.get());
+  }
+
+  std::istream& m_stream;
+};
+
+} // namespace
+
+bool State::Iterator::operator!=(const Iterator& iter) noexcept {
+  if (m_iterIndex != iter.m_iterIndex)
+    return true;
+
+  m_state.m_elapsedTime = std::chrono::steady_clock::now() - m_state.m_startTime;
+  return false;
+}
+
+State::Iterator State::begin() noexcept {
+  m_startTime = std::chrono::steady_clock::now();
+  return Iterator(*this, 0);
+}
+
+bool registerBenchmark(std::string name, BenchmarkFunction function) {
+  getBenchmarks().push_back(BenchmarkEntry{ std::move(name), function });
+  return true;
+}
+
+std::vector<Result> runBenchmarks(const Settings& settings, std::ostream& progressStream) {
+  std::vector<BenchmarkEntry> benchmarks = getBenchmarks();
+  std::sort(benchmarks.begin(), benchmarks.end(), [] (const BenchmarkEntry& entry1, const BenchmarkEntry& entry2) { return entry1.name < entry2.name; });
+
+  std::vector<Result> results;
+
+  for (const BenchmarkEntry& benchmark : benchmarks) {
+    if (!settings.filter.empty() && benchmark.name.find(settings.filter) == std::string::npos)
+      continue;
+
+    const std::size_t iterationCount = computeIterationCount(benchmark.function, settings.minSampleTime);
+
+    for (std::size_t warmupIndex = 0; warmupIndex < settings.warmupCount; ++warmupIndex)
+      runSample(benchmark.function, iterationCount);
+
+    std::vector<double> iterationTimes(std::max<std::size_t>(settings.repetitionCount, 1));
+
+    for (double& iterationTime : iterationTimes) {
+      const std::chrono::duration<double, std::nano> sampleTime = runSample(benchmark.function, iterationCount);
+      iterationTime = sampleTime.count() / static_cast<double>(iterationCount);
+    }
+
+    std::sort(iterationTimes.begin(), iterationTimes.end());
+
+    Result result;
+    result.name            = benchmark.name;
+    result.iterationCount  = iterationCount;
+    result.repetitionCount = iterationTimes.size();
+    result.medianTime      = computePercentile(iterationTimes, 0.5);
+    result.p99Time         = computePercentile(iterationTimes, 0.99);
+    result.minTime         = iterationTimes.front();
+    result.meanTime        = std::accumulate(iterationTimes.cbegin(), iterationTimes.cend(), 0.0) / static_cast<double>(iterationTimes.size());
+
+    progressStream << std::left << std::setw(56) << result.name << std::right << std::fixed << std::setprecision(2)
+                   << " median " << std::setw(12) << result.medianTime << " ns"
+                   << " | p99 " << std::setw(12) << result.p99Time << " ns"
+                   << " | " << iterationCount << " iterations x " << result.repetitionCount << std::endl;
+
+    results.push_back(std::move(result));
+  }
+
+  return results;
+}
+
+void writeJson(const std::vector<Result>& results, std::ostream& stream) {
+  stream << std::setprecision(6) << std::fixed;
+  stream << "{\n  \"benchmarks\": [";
+
+  for (std::size_t resultIndex = 0; resultIndex < results.size(); ++resultIndex) {
+    const Result& result = results[resultIndex];
+
+    stream << (resultIndex == 0 ? "\n" : ",\n")
+           << "    {\n"
+           << "      \"name\": \"" << escapeJson(result.name) << "\",\n"
+           << "      \"iterations\": " << result.iterationCount << ",\n"
+           << "      \"repetitions\": " << result.repetitionCount << ",\n"
+           << "      \"median_ns\": " << result.medianTime << ",\n"
+           << "      \"p99_ns\": " << result.p99Time << ",\n"
+           << "      \"min_ns\": " << result.minTime << ",\n"
+           << "      \"mean_ns\": " << result.meanTime << "\n"
+           << "    }";
+  }
+
+  stream << "\n  ]\n}\n";
+}
+
+std::vector<Result> readJson(std::istream& stream) {
+  JsonReader reader(stream);
+
+  reader.expect('{');
+
+  if (reader.readString() != "benchmarks")
+    throw std::invalid_argument("Error: Invalid benchmark results; expected a 'benchmarks' entry");
+
+  reader.expect(':');
+  reader.expect('[');
+
+  std::vector<Result> results;
+
+  if (reader.tryRead(']'))
+    return results;
+
+  do {
+    reader.expect('{');
+
+    Result result;
+
+    do {
+      const std::string key = reader.readString();
+      reader.expect(':');
+
+      if (key == "name") {
+        result.name = reader.readString();
+        continue;
+      }
+
+      const double value = reader.readNumber();
+
+      if (key == "iterations")
+        result.iterationCount = static_cast<std::size_t>(value);
+      else if (key == "repetitions")
+        result.repetitionCount = static_cast<std::size_t>(value);
+      else if (key == "median_ns")
+        result.medianTime = value;
+      else if (key == "p99_ns")
+        result.p99Time = value;
+      else if (key == "min_ns")
+        result.minTime = value;
+      else if (key == "mean_ns")
+        result.meanTime = value;
+    } while (reader.tryRead(','));
+
+    reader.expect('}');
+    results.push_back(std::move(result));
+  } while (reader.tryRead(','));
+
+  reader.expect(']');
+  reader.expect('}');
+
+  return results;
+}
+
+std::vector<Comparison> compareResults(const std::vector<Result>& baseResults, const std::vector<Result>& newResults, double threshold) {
+  std::unordered_map<std::string, const Result*> newResultsByName;
+  for (const Result& newResult : newResults)
+    newResultsByName.emplace(newResult.name, &newResult);
+
+  std::vector<Comparison> comparisons;
+
+  for (const Result& baseResult : baseResults) {
+    const auto newResultIter = newResultsByName.find(baseResult.name);
+
+    if (newResultIter == newResultsByName.cend())
+      continue;
+
+    Comparison comparison;
+    comparison.name           = baseResult.name;
+    comparison.baseTime       = baseResult.medianTime;
+    comparison.newTime        = newResultIter->second->medianTime;
+    comparison.relativeChange = (comparison.baseTime > 0.0 ? comparison.newTime / comparison.baseTime - 1.0 : 0.0);
+    comparison.isRegression   = (comparison.relativeChange > threshold);
+
+    comparisons.push_back(std::move(comparison));
+  }
+
+  return comparisons;
+}
+
+} // namespace Raz::Benchmark
@@ -0,0 +1,143 @@
+#pragma once
+
+#ifndef RAZ_BENCHMARK_HPP
+#define RAZ_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/// Minimal self-contained microbenchmarking harness.
+/// Each benchmark is first calibrated to find how many iterations a sample must run to last long enough to be measured reliably; a few warmup samples
+///   are then run & discarded, before the actual ones. The time taken by an iteration is given by the median & 99th percentile over all samples.
+namespace Raz::Benchmark {
+
+/// State of a running benchmark. Iterating over it runs the timed loop; the code placed before it is part of the setup & is not timed.
+///
+///   RAZ_BENCHMARK("Category/Name") {
+///     const auto values = createValues(); // Not timed
+///
+///     for (const std::size_t iterIndex : state)
+///       Benchmark::doNotOptimize(compute(values[iterIndex % values.size()]));
+///   }
+class State {
+public:
+  class Iterator {
+  public:
+    Iterator(State& state, std::size_t iterIndex) noexcept : m_state{ state }, m_iterIndex{ iterIndex } {}
+
+    std::size_t operator*() const noexcept { return m_iterIndex; }
+    Iterator& operator++() noexcept { ++m_iterIndex; return *this; }
+    /// Checks if the iterator has not reached the end; the timer is stopped when it has.
+    /// \param iter Iterator to be compared with, which must be the end one.
+    /// \return True if iterations remain, false otherwise.
+    bool operator!=(const Iterator& iter) noexcept;
+
+  private:
+    State& m_state;
+    std::size_t m_iterIndex {};
+  };
+
+  explicit State(std::size_t iterationCount) noexcept : m_iterationCount{ iterationCount } {}
+
+  std::size_t getIterationCount() const noexcept { return m_iterationCount; }
+  std::chrono::nanoseconds getElapsedTime() const noexcept { return m_elapsedTime; }
+
+  /// Starts the timer & gives the iterator to the first iteration.
+  /// \return Iterator to the first iteration.
+  Iterator begin() noexcept;
+  Iterator end() noexcept { return Iterator(*this, m_iterationCount); }
+
+private:
+  std::size_t m_iterationCount {};
+  std::chrono::steady_clock::time_point m_startTime {};
+  std::chrono::nanoseconds m_elapsedTime {};
+};
+
+using BenchmarkFunction = void (*)(State&);
+
+/// Settings used to run the benchmarks.
+struct Settings {
+  std::size_t warmupCount     = 3;  ///< Number of samples run & discarded before measuring.
+  std::size_t repetitionCount = 30; ///< Number of measured samples.
+  std::chrono::nanoseconds minSampleTime = std::chrono::milliseconds(2); ///< Minimal duration of a sample, from which its iteration count is determined.
+  std::string filter {}; ///< If not empty, only the benchmarks whose names contain this string are run.
+};
+
+/// Timings of a benchmark, all given per iteration.
+struct Result {
+  std::string name {};
+  std::size_t iterationCount {};  ///< Number of iterations run by each sample.
+  std::size_t repetitionCount {}; ///< Number of measured samples.
+  double medianTime {};           ///< Median time of an iteration, in nanoseconds.
+  double p99Time {};              ///< 99th percentile of the time of an iteration, in nanoseconds.
+  double minTime {};              ///< Lowest time of an iteration, in nanoseconds.
+  double meanTime {};             ///< Mean time of an iteration, in nanoseconds.
+};
+
+/// Comparison of a benchmark's median time between two runs.
+struct Comparison {
+  std::string name {};
+  double baseTime {};       ///< Median time in the base run, in nanoseconds.
+  double newTime {};        ///< Median time in the new run, in nanoseconds.
+  double relativeChange {}; ///< Relative difference between both times; positive if the new run is slower.
+  bool isRegression {};     ///< Whether the relative change is above the allowed threshold.
+};
+
+/// Registers a benchmark; this is done by the RAZ_BENCHMARK() macro.
+/// \param name Name of the benchmark, usually given as "Category/Name".
+/// \param function Function running the benchmark.
+/// \return Dummy value, allowing registration during static initialization.
+bool registerBenchmark(std::string name, BenchmarkFunction function);
+
+/// Runs all registered benchmarks whose name match the filter, in alphabetical order.
+/// \param settings Settings to run the benchmarks with.
+/// \param progressStream Stream to print each result to as it is computed.
+/// \return Results of the benchmarks.
+std::vector<Result> runBenchmarks(const Settings& settings, std::ostream& progressStream);
+
+/// Writes results in JSON.
+/// \param results Results to be written.
+/// \param stream Stream to write the results into.
+void writeJson(const std::vector<Result>& results, std::ostream& stream);
+/// Reads results from JSON, as written by writeJson().
+/// \param stream Stream to read the results from.
+/// \return Read results.
+std::vector<Result> readJson(std::istream& stream);
+
+/// Compares the median times of benchmarks present in both runs.
+/// \param baseResults Results of the reference run.
+/// \param newResults Results of the run to be checked.
+/// \param threshold Relative slowdown above which a benchmark is considered to have regressed (0.05 meaning 5%).
+/// \return Comparisons of all benchmarks present in both runs, in the base run's order.
+std::vector<Comparison> compareResults(const std::vector<Result>& baseResults, const std::vector<Result>& newResults, double threshold);
+
+/// Prevents the compiler from optimizing away a value, or the computations it results from.
+/// \tparam T Type of the value.
+/// \param value Value to be kept.
+template <typename T>
+void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  const auto* volatile valuePtr = &value;
+  static_cast<void>(valuePtr);
+#endif
+}
+
+} // namespace Raz::Benchmark
+
+#define RAZ_BENCHMARK_CONCAT_IMPL(PREFIX, SUFFIX) PREFIX##SUFFIX
+#define RAZ_BENCHMARK_CONCAT(PREFIX, SUFFIX) RAZ_BENCHMARK_CONCAT_IMPL(PREFIX, SUFFIX)
+#define RAZ_BENCHMARK_IMPL(NAME, FUNCTION)                                                                                                \
+  static void FUNCTION(Raz::Benchmark::State& state);                                                                                     \
+  [[maybe_unused]] static const bool RAZ_BENCHMARK_CONCAT(FUNCTION, Registered) = Raz::Benchmark::registerBenchmark(NAME, &FUNCTION); \
+  static void FUNCTION(Raz::Benchmark::State& state)
+
+/// Defines & registers a benchmark, whose body follows the macro.
+/// \param NAME Name of the benchmark, usually given as "Category/Name".
+#define RAZ_BENCHMARK(NAME) RAZ_BENCHMARK_IMPL(NAME, RAZ_BENCHMARK_CONCAT(benchmark, __LINE__))
+
+#endif // RAZ_BENCHMARK_HPP
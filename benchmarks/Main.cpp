@@ -0,0 +1,116 @@
+#include "Benchmark.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+constexpr const char* usage =
+  "Usage:\n"
+  "  RaZ_Benchmarks [--filter <text>] [--repetitions <count>] [--warmup <count>] [--min-time <milliseconds>] [--output <file.json>]\n"
+  "      Runs the benchmarks whose names contain the filter, optionally saving the results as JSON.\n"
+  "  RaZ_Benchmarks --compare <base.json> <new.json> [--threshold <ratio>]\n"
+  "      Compares the median times of two result files; exits with 1 if any benchmark is slower than the threshold allows (0.05 by default).\n";
+
+std::vector<Raz::Benchmark::Result> loadResults(const std::string& filePath) {
+  std::ifstream file(filePath);
+
+  if (!file)
+    throw std::invalid_argument("Error: Couldn't open the benchmark results file '" + filePath + "'");
+
+  return Raz::Benchmark::readJson(file);
+}
+
+int compare(const std::string& baseFilePath, const std::string& newFilePath, double threshold) {
+  const std::vector<Raz::Benchmark::Comparison> comparisons = Raz::Benchmark::compareResults(loadResults(baseFilePath),
+                                                                                             loadResults(newFilePath),
+                                                                                             threshold);
+
+  std::size_t regressionCount = 0;
+
+  for (const Raz::Benchmark::Comparison& comparison : comparisons) {
+    std::cout << std::left << std::setw(56) << comparison.name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << comparison.baseTime << " ns -> " << std::setw(12) << comparison.newTime << " ns"
+              << std::showpos << std::setw(10) << comparison.relativeChange * 100.0 << '%' << std::noshowpos
+              << (comparison.isRegression ? "  REGRESSION" : "") << '\n';
+
+    regressionCount += comparison.isRegression;
+  }
+
+  std::cout << '\n' << regressionCount << " regression(s) out of " << comparisons.size() << " compared benchmark(s), with a threshold of "
+            << threshold * 100.0 << "%" << std::endl;
+
+  return (regressionCount > 0 ? 1 : 0);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  try {
+    Raz::Benchmark::Settings settings;
+    std::string outputFilePath;
+    std::string baseFilePath;
+    std::string newFilePath;
+    double threshold = 0.05;
+
+    for (int argIndex = 1; argIndex < argc; ++argIndex) {
+      const std::string arg = argv[argIndex];
+
+      if (arg == "--help" || arg == "-h") {
+        std::cout << usage;
+        return 0;
+      }
+
+      if (arg != "--filter" && arg != "--repetitions" && arg != "--warmup" && arg != "--min-time"
+       && arg != "--output" && arg != "--threshold" && arg != "--compare")
+        throw std::invalid_argument("Error: Unknown argument '" + arg + "'");
+
+      if (argIndex + 1 >= argc)
+        throw std::invalid_argument("Error: Missing value for the argument '" + arg + "'");
+
+      const std::string value = argv[++argIndex];
+
+      if (arg == "--filter") {
+        settings.filter = value;
+      } else if (arg == "--repetitions") {
+        settings.repetitionCount = std::stoul(value);
+      } else if (arg == "--warmup") {
+        settings.warmupCount = std::stoul(value);
+      } else if (arg == "--min-time") {
+        settings.minSampleTime = std::chrono::microseconds(static_cast<long long>(std::stod(value) * 1000.0));
+      } else if (arg == "--output") {
+        outputFilePath = value;
+      } else if (arg == "--threshold") {
+        threshold = std::stod(value);
+      } else { // --compare
+        if (argIndex + 1 >= argc)
+          throw std::invalid_argument("Error: The comparison requires two result files");
+
+        baseFilePath = value;
+        newFilePath  = argv[++argIndex];
+      }
+    }
+
+    if (!baseFilePath.empty())
+      return compare(baseFilePath, newFilePath, threshold);
+
+    const std::vector<Raz::Benchmark::Result> results = Raz::Benchmark::runBenchmarks(settings, std::cout);
+
+    if (!outputFilePath.empty()) {
+      std::ofstream outputFile(outputFilePath);
+
+      if (!outputFile)
+        throw std::invalid_argument("Error: Couldn't create the benchmark results file '" + outputFilePath + "'");
+
+      Raz::Benchmark::writeJson(results, outputFile);
+    }
+  } catch (const std::exception& exception) {
+    std::cerr << exception.what() << "\n\n" << usage;
+    return 2;
+  }
+
+  return 0;
+}
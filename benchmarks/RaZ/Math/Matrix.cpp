@@ -0,0 +1,81 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Random.hpp"
+
+#include <array>
+
+namespace {
+
+constexpr std::size_t matrixCount = 256; // Must be a power of 2, the iteration index being masked to recover the matrices
+
+// Generates matrices with random values, whose diagonal is increased to keep them invertible
+template <std::size_t Size>
+std::array<Raz::Matrix<float, Size, Size>, matrixCount> generateMatrices(uint64_t seed) {
+  Raz::Random::Xoshiro256 generator(seed);
+  std::array<Raz::Matrix<float, Size, Size>, matrixCount> matrices {};
+
+  for (Raz::Matrix<float, Size, Size>& mat : matrices) {
+    for (std::size_t i = 0; i < Size * Size; ++i)
+      mat[i] = generator.generateFloat() * 2.f - 1.f;
+
+    for (std::size_t i = 0; i < Size; ++i)
+      mat[i * Size + i] += static_cast<float>(Size);
+  }
+
+  return matrices;
+}
+
+} // namespace
+
+RAZ_BENCHMARK("Matrix/Mat3f multiplication") {
+  const auto matrices1 = generateMatrices<3>(1);
+  const auto matrices2 = generateMatrices<3>(2);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(matrices1[iterIndex & (matrixCount - 1)] * matrices2[iterIndex & (matrixCount - 1)]);
+}
+
+RAZ_BENCHMARK("Matrix/Mat3f inverse") {
+  const auto matrices = generateMatrices<3>(1);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(matrices[iterIndex & (matrixCount - 1)].inverse());
+}
+
+RAZ_BENCHMARK("Matrix/Mat4f multiplication") {
+  const auto matrices1 = generateMatrices<4>(1);
+  const auto matrices2 = generateMatrices<4>(2);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(matrices1[iterIndex & (matrixCount - 1)] * matrices2[iterIndex & (matrixCount - 1)]);
+}
+
+RAZ_BENCHMARK("Matrix/Mat4f vector multiplication") {
+  const auto matrices = generateMatrices<4>(1);
+  const Raz::Vec4f vec(0.25f, -0.5f, 0.75f, 1.f);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(matrices[iterIndex & (matrixCount - 1)] * vec);
+}
+
+RAZ_BENCHMARK("Matrix/Mat4f transpose") {
+  const auto matrices = generateMatrices<4>(1);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(matrices[iterIndex & (matrixCount - 1)].transpose());
+}
+
+RAZ_BENCHMARK("Matrix/Mat4f determinant") {
+  const auto matrices = generateMatrices<4>(1);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(matrices[iterIndex & (matrixCount - 1)].computeDeterminant());
+}
+
+RAZ_BENCHMARK("Matrix/Mat4f inverse") {
+  const auto matrices = generateMatrices<4>(1);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(matrices[iterIndex & (matrixCount - 1)].inverse());
+}
@@ -0,0 +1,83 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Math/PerlinNoise.hpp"
+#include "RaZ/Math/Random.hpp"
+
+#include <vector>
+
+namespace {
+
+constexpr std::size_t coordCount = 1024; // Must be a power of 2, the iteration index being masked to recover the coordinates
+
+std::vector<float> generateCoordinates() {
+  Raz::Random::BulkGenerator generator(1);
+
+  std::vector<float> coords(coordCount * 3);
+  generator.generateFloats(coords.data(), coords.size());
+
+  for (float& coord : coords)
+    coord *= 64.f;
+
+  return coords;
+}
+
+} // namespace
+
+RAZ_BENCHMARK("PerlinNoise/Perlin 2D") {
+  const std::vector<float> coords = generateCoordinates();
+
+  for (const std::size_t iterIndex : state) {
+    const float* pointCoords = coords.data() + (iterIndex & (coordCount - 1)) * 3;
+    Raz::Benchmark::doNotOptimize(Raz::PerlinNoise::get(pointCoords[0], pointCoords[1]));
+  }
+}
+
+RAZ_BENCHMARK("PerlinNoise/Perlin 3D") {
+  const std::vector<float> coords = generateCoordinates();
+
+  for (const std::size_t iterIndex : state) {
+    const float* pointCoords = coords.data() + (iterIndex & (coordCount - 1)) * 3;
+    Raz::Benchmark::doNotOptimize(Raz::PerlinNoise::get(pointCoords[0], pointCoords[1], pointCoords[2]));
+  }
+}
+
+RAZ_BENCHMARK("PerlinNoise/Simplex 2D") {
+  const std::vector<float> coords = generateCoordinates();
+
+  for (const std::size_t iterIndex : state) {
+    const float* pointCoords = coords.data() + (iterIndex & (coordCount - 1)) * 3;
+    Raz::Benchmark::doNotOptimize(Raz::PerlinNoise::getSimplex(pointCoords[0], pointCoords[1]));
+  }
+}
+
+RAZ_BENCHMARK("PerlinNoise/Simplex 3D") {
+  const std::vector<float> coords = generateCoordinates();
+
+  for (const std::size_t iterIndex : state) {
+    const float* pointCoords = coords.data() + (iterIndex & (coordCount - 1)) * 3;
+    Raz::Benchmark::doNotOptimize(Raz::PerlinNoise::getSimplex(pointCoords[0], pointCoords[1], pointCoords[2]));
+  }
+}
+
+RAZ_BENCHMARK("PerlinNoise/Fractional Brownian motion 2D (4 octaves)") {
+  const std::vector<float> coords = generateCoordinates();
+
+  for (const std::size_t iterIndex : state) {
+    const float* pointCoords = coords.data() + (iterIndex & (coordCount - 1)) * 3;
+    Raz::Benchmark::doNotOptimize(Raz::PerlinNoise::computeFbm(pointCoords[0], pointCoords[1]));
+  }
+}
+
+RAZ_BENCHMARK("PerlinNoise/Grid fill 256x256 (4 octaves)") {
+  Raz::PerlinNoise::GridRegion region;
+  region.step   = Raz::Vec2f(0.05f);
+  region.width  = 256;
+  region.height = 256;
+
+  std::vector<float> values(region.width * region.height);
+
+  for ([[maybe_unused]] const std::size_t iterIndex : state) {
+    Raz::PerlinNoise::fillGrid(values.data(), region.width, region, Raz::PerlinNoise::FractalType::FBM);
+    Raz::Benchmark::doNotOptimize(values.front());
+  }
+}
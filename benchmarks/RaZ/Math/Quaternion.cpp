@@ -0,0 +1,90 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Math/Constants.hpp"
+#include "RaZ/Math/Quaternion.hpp"
+#include "RaZ/Math/Random.hpp"
+#include "RaZ/Utils/FloatUtils.hpp"
+
+#include <vector>
+
+namespace {
+
+constexpr std::size_t quaternionCount = 1024; // Must be a power of 2, the iteration index being masked to recover the quaternions
+
+// Generates random unit quaternions; those whose norm is not close enough to 1 due to rounding errors are discarded, as interpolating them would be invalid
+std::vector<Raz::Quaternionf> generateQuaternions(uint64_t seed) {
+  Raz::Random::BulkGenerator generator(seed);
+
+  std::vector<Raz::Vec3f> axes(quaternionCount);
+  std::vector<float> angles(quaternionCount);
+
+  std::vector<Raz::Quaternionf> quaternions;
+  quaternions.reserve(quaternionCount);
+
+  while (quaternions.size() < quaternionCount) {
+    generator.generateUnitVectors(axes.data(), axes.size());
+    generator.generateFloats(angles.data(), angles.size());
+
+    for (std::size_t quatIndex = 0; quatIndex < quaternionCount && quaternions.size() < quaternionCount; ++quatIndex) {
+      const Raz::Quaternionf quaternion(Raz::Radiansf(angles[quatIndex] * 2.f * Raz::Pi<float>), axes[quatIndex]);
+
+      if (Raz::FloatUtils::areNearlyEqual(quaternion.computeSquaredNorm(), 1.f))
+        quaternions.emplace_back(quaternion);
+    }
+  }
+
+  return quaternions;
+}
+
+} // namespace
+
+RAZ_BENCHMARK("Quaternion/Construction from angle & axis") {
+  Raz::Random::BulkGenerator generator(1);
+
+  std::vector<Raz::Vec3f> axes(quaternionCount);
+  generator.generateUnitVectors(axes.data(), axes.size());
+
+  std::vector<float> angles(quaternionCount);
+  generator.generateFloats(angles.data(), angles.size());
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(Raz::Quaternionf(Raz::Radiansf(angles[iterIndex & (quaternionCount - 1)]), axes[iterIndex & (quaternionCount - 1)]));
+}
+
+RAZ_BENCHMARK("Quaternion/Multiplication") {
+  const std::vector<Raz::Quaternionf> quaternions1 = generateQuaternions(1);
+  const std::vector<Raz::Quaternionf> quaternions2 = generateQuaternions(2);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(quaternions1[iterIndex & (quaternionCount - 1)] * quaternions2[iterIndex & (quaternionCount - 1)]);
+}
+
+RAZ_BENCHMARK("Quaternion/Normalize") {
+  const std::vector<Raz::Quaternionf> quaternions = generateQuaternions(1);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(quaternions[iterIndex & (quaternionCount - 1)].normalize());
+}
+
+RAZ_BENCHMARK("Quaternion/Nlerp") {
+  const std::vector<Raz::Quaternionf> quaternions1 = generateQuaternions(1);
+  const std::vector<Raz::Quaternionf> quaternions2 = generateQuaternions(2);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(quaternions1[iterIndex & (quaternionCount - 1)].nlerp(quaternions2[iterIndex & (quaternionCount - 1)], 0.3f));
+}
+
+RAZ_BENCHMARK("Quaternion/Slerp") {
+  const std::vector<Raz::Quaternionf> quaternions1 = generateQuaternions(1);
+  const std::vector<Raz::Quaternionf> quaternions2 = generateQuaternions(2);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(quaternions1[iterIndex & (quaternionCount - 1)].slerp(quaternions2[iterIndex & (quaternionCount - 1)], 0.3f));
+}
+
+RAZ_BENCHMARK("Quaternion/Matrix computation") {
+  const std::vector<Raz::Quaternionf> quaternions = generateQuaternions(1);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(quaternions[iterIndex & (quaternionCount - 1)].computeMatrix());
+}
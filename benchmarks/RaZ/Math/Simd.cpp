@@ -0,0 +1,120 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Quaternion.hpp"
+#include "RaZ/Math/Random.hpp"
+#include "RaZ/Math/Simd.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Raz::Simd::InstructionSet;
+
+constexpr std::size_t valueCount = 256; // Must be a power of 2, the iteration index being masked to recover the values
+
+// Generates vectors or matrices with random values
+template <typename T, std::size_t ComponentCount>
+std::array<T, valueCount> generateValues(uint64_t seed) {
+  Raz::Random::Xoshiro256 generator(seed);
+  std::array<T, valueCount> values {};
+
+  for (T& value : values) {
+    for (std::size_t i = 0; i < ComponentCount; ++i)
+      value[i] = generator.generateFloat() * 2.f - 1.f;
+  }
+
+  return values;
+}
+
+std::vector<Raz::Quaternionf> generateQuaternions(uint64_t seed) {
+  Raz::Random::Xoshiro256 generator(seed);
+
+  std::vector<Raz::Quaternionf> quaternions;
+  quaternions.reserve(valueCount);
+
+  for (std::size_t quatIndex = 0; quatIndex < valueCount; ++quatIndex) {
+    quaternions.emplace_back(generator.generateFloat() * 2.f - 1.f, generator.generateFloat() * 2.f - 1.f,
+                             generator.generateFloat() * 2.f - 1.f, generator.generateFloat() * 2.f - 1.f);
+  }
+
+  return quaternions;
+}
+
+// Each benchmark forces its instruction set during the timed loop, then gives back the default one so that the other benchmarks are unaffected
+
+template <InstructionSet Set>
+void benchmarkMat4MatMultiplication(Raz::Benchmark::State& state) {
+  const auto matrices1 = generateValues<Raz::Mat4f, 16>(1);
+  const auto matrices2 = generateValues<Raz::Mat4f, 16>(2);
+
+  Raz::Simd::setInstructionSet(Set);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(matrices1[iterIndex & (valueCount - 1)] * matrices2[iterIndex & (valueCount - 1)]);
+
+  Raz::Simd::setInstructionSet(Raz::Simd::detectInstructionSet());
+}
+
+template <InstructionSet Set>
+void benchmarkMat4VecMultiplication(Raz::Benchmark::State& state) {
+  const auto matrices = generateValues<Raz::Mat4f, 16>(1);
+  const auto vectors  = generateValues<Raz::Vec4f, 4>(2);
+
+  Raz::Simd::setInstructionSet(Set);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(matrices[iterIndex & (valueCount - 1)] * vectors[iterIndex & (valueCount - 1)]);
+
+  Raz::Simd::setInstructionSet(Raz::Simd::detectInstructionSet());
+}
+
+template <InstructionSet Set>
+void benchmarkVec4MatMultiplication(Raz::Benchmark::State& state) {
+  const auto vectors  = generateValues<Raz::Vec4f, 4>(1);
+  const auto matrices = generateValues<Raz::Mat4f, 16>(2);
+
+  Raz::Simd::setInstructionSet(Set);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(vectors[iterIndex & (valueCount - 1)] * matrices[iterIndex & (valueCount - 1)]);
+
+  Raz::Simd::setInstructionSet(Raz::Simd::detectInstructionSet());
+}
+
+template <InstructionSet Set>
+void benchmarkQuaternionMultiplication(Raz::Benchmark::State& state) {
+  const auto quaternions1 = generateQuaternions(1);
+  const auto quaternions2 = generateQuaternions(2);
+
+  Raz::Simd::setInstructionSet(Set);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(quaternions1[iterIndex & (valueCount - 1)] * quaternions2[iterIndex & (valueCount - 1)]);
+
+  Raz::Simd::setInstructionSet(Raz::Simd::detectInstructionSet());
+}
+
+// Registers the benchmarks of an instruction set, only if it can be used on this machine
+template <InstructionSet Set>
+bool registerBenchmarks(const std::string& setName) {
+  if (!Raz::Simd::isSupported(Set))
+    return false;
+
+  Raz::Benchmark::registerBenchmark("Simd/Mat4f multiplication (" + setName + ')', &benchmarkMat4MatMultiplication<Set>);
+  Raz::Benchmark::registerBenchmark("Simd/Mat4f vector multiplication (" + setName + ')', &benchmarkMat4VecMultiplication<Set>);
+  Raz::Benchmark::registerBenchmark("Simd/Vec4f matrix multiplication (" + setName + ')', &benchmarkVec4MatMultiplication<Set>);
+  Raz::Benchmark::registerBenchmark("Simd/Quaternionf multiplication (" + setName + ')', &benchmarkQuaternionMultiplication<Set>);
+
+  return true;
+}
+
+[[maybe_unused]] const bool scalarRegistered = registerBenchmarks<InstructionSet::SCALAR>("scalar");
+[[maybe_unused]] const bool sse41Registered  = registerBenchmarks<InstructionSet::SSE4_1>("SSE4.1");
+[[maybe_unused]] const bool avx2Registered   = registerBenchmarks<InstructionSet::AVX2>("AVX2");
+[[maybe_unused]] const bool neonRegistered   = registerBenchmarks<InstructionSet::NEON>("NEON");
+
+} // namespace
@@ -0,0 +1,32 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Math/Constants.hpp"
+#include "RaZ/Math/Random.hpp"
+#include "RaZ/Math/Transform.hpp"
+
+#include <vector>
+
+RAZ_BENCHMARK("Transform/Transform matrix computation") {
+  constexpr std::size_t transformCount = 1024; // Must be a power of 2, the iteration index being masked to recover the transforms
+
+  Raz::Random::BulkGenerator generator(1);
+
+  std::vector<Raz::Vec3f> axes(transformCount);
+  generator.generateUnitVectors(axes.data(), axes.size());
+
+  std::vector<float> values(transformCount * 4);
+  generator.generateFloats(values.data(), values.size());
+
+  std::vector<Raz::Transform> transforms;
+  transforms.reserve(transformCount);
+
+  for (std::size_t transIndex = 0; transIndex < transformCount; ++transIndex) {
+    const float* transValues = values.data() + transIndex * 4;
+    transforms.emplace_back(Raz::Vec3f(transValues[0], transValues[1], transValues[2]) * 100.f,
+                            Raz::Quaternionf(Raz::Radiansf(transValues[3] * 2.f * Raz::Pi<float>), axes[transIndex]),
+                            Raz::Vec3f(transValues[3] + 0.5f));
+  }
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(transforms[iterIndex & (transformCount - 1)].computeTransformMatrix());
+}
@@ -0,0 +1,88 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Math/Random.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+#include <array>
+
+namespace {
+
+constexpr std::size_t vectorCount = 1024; // Must be a power of 2, the iteration index being masked to recover the vectors
+
+template <std::size_t Size>
+std::array<Raz::Vector<float, Size>, vectorCount> generateVectors(uint64_t seed) {
+  Raz::Random::Xoshiro256 generator(seed);
+  std::array<Raz::Vector<float, Size>, vectorCount> vectors {};
+
+  for (Raz::Vector<float, Size>& vec : vectors) {
+    for (std::size_t i = 0; i < Size; ++i)
+      vec[i] = generator.generateFloat() * 2.f - 1.f;
+  }
+
+  return vectors;
+}
+
+} // namespace
+
+RAZ_BENCHMARK("Vector/Vec3f addition") {
+  const auto vectors1 = generateVectors<3>(1);
+  const auto vectors2 = generateVectors<3>(2);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(vectors1[iterIndex & (vectorCount - 1)] + vectors2[iterIndex & (vectorCount - 1)]);
+}
+
+RAZ_BENCHMARK("Vector/Vec3f dot") {
+  const auto vectors1 = generateVectors<3>(1);
+  const auto vectors2 = generateVectors<3>(2);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(vectors1[iterIndex & (vectorCount - 1)].dot(vectors2[iterIndex & (vectorCount - 1)]));
+}
+
+RAZ_BENCHMARK("Vector/Vec3f cross") {
+  const auto vectors1 = generateVectors<3>(1);
+  const auto vectors2 = generateVectors<3>(2);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(vectors1[iterIndex & (vectorCount - 1)].cross(vectors2[iterIndex & (vectorCount - 1)]));
+}
+
+RAZ_BENCHMARK("Vector/Vec3f normalize") {
+  const auto vectors = generateVectors<3>(1);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(vectors[iterIndex & (vectorCount - 1)].normalize());
+}
+
+RAZ_BENCHMARK("Vector/Vec3f reflect") {
+  const auto vectors = generateVectors<3>(1);
+  const auto normals = generateVectors<3>(2);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(vectors[iterIndex & (vectorCount - 1)].reflect(normals[iterIndex & (vectorCount - 1)]));
+}
+
+RAZ_BENCHMARK("Vector/Vec4f addition") {
+  const auto vectors1 = generateVectors<4>(1);
+  const auto vectors2 = generateVectors<4>(2);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(vectors1[iterIndex & (vectorCount - 1)] + vectors2[iterIndex & (vectorCount - 1)]);
+}
+
+RAZ_BENCHMARK("Vector/Vec4f dot") {
+  const auto vectors1 = generateVectors<4>(1);
+  const auto vectors2 = generateVectors<4>(2);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(vectors1[iterIndex & (vectorCount - 1)].dot(vectors2[iterIndex & (vectorCount - 1)]));
+}
+
+RAZ_BENCHMARK("Vector/Vec4f lerp") {
+  const auto vectors1 = generateVectors<4>(1);
+  const auto vectors2 = generateVectors<4>(2);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(vectors1[iterIndex & (vectorCount - 1)].lerp(vectors2[iterIndex & (vectorCount - 1)], 0.25f));
+}
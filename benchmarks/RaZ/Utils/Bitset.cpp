@@ -0,0 +1,77 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Math/Random.hpp"
+#include "RaZ/Utils/Bitset.hpp"
+
+namespace {
+
+constexpr std::size_t bitCount = 1024;
+
+Raz::Bitset generateBitset(uint64_t seed) {
+  Raz::Random::Pcg32 generator(seed);
+  Raz::Bitset bitset(bitCount);
+
+  for (std::size_t bitIndex = 0; bitIndex < bitCount; ++bitIndex)
+    bitset.setBit(bitIndex, (generator() & 1u));
+
+  return bitset;
+}
+
+} // namespace
+
+RAZ_BENCHMARK("Bitset/Set bit") {
+  Raz::Bitset bitset(bitCount);
+
+  for (const std::size_t iterIndex : state)
+    bitset.setBit(iterIndex & (bitCount - 1), (iterIndex & bitCount) == 0);
+
+  Raz::Benchmark::doNotOptimize(bitset);
+}
+
+RAZ_BENCHMARK("Bitset/Enabled bit count (1024 bits)") {
+  const Raz::Bitset bitset = generateBitset(1);
+
+  for ([[maybe_unused]] const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(bitset.getEnabledBitCount());
+}
+
+RAZ_BENCHMARK("Bitset/AND (1024 bits)") {
+  const Raz::Bitset bitset1 = generateBitset(1);
+  const Raz::Bitset bitset2 = generateBitset(2);
+
+  for ([[maybe_unused]] const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(bitset1 & bitset2);
+}
+
+RAZ_BENCHMARK("Bitset/OR assignment (1024 bits)") {
+  Raz::Bitset bitset1       = generateBitset(1);
+  const Raz::Bitset bitset2 = generateBitset(2);
+
+  for ([[maybe_unused]] const std::size_t iterIndex : state)
+    bitset1 |= bitset2;
+
+  Raz::Benchmark::doNotOptimize(bitset1);
+}
+
+RAZ_BENCHMARK("Bitset/XOR (1024 bits)") {
+  const Raz::Bitset bitset1 = generateBitset(1);
+  const Raz::Bitset bitset2 = generateBitset(2);
+
+  for ([[maybe_unused]] const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(bitset1 ^ bitset2);
+}
+
+RAZ_BENCHMARK("Bitset/Left shift (1024 bits)") {
+  const Raz::Bitset bitset = generateBitset(1);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(bitset << (iterIndex & 63));
+}
+
+RAZ_BENCHMARK("Bitset/Equality (1024 bits)") {
+  const Raz::Bitset bitset1 = generateBitset(1);
+  const Raz::Bitset bitset2 = generateBitset(1);
+
+  for ([[maybe_unused]] const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(bitset1 == bitset2);
+}
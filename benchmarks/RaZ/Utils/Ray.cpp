@@ -0,0 +1,79 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Math/Quaternion.hpp"
+#include "RaZ/Math/Random.hpp"
+#include "RaZ/Utils/Ray.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <vector>
+
+namespace {
+
+constexpr std::size_t rayCount = 1024; // Must be a power of 2, the iteration index being masked to recover the rays
+
+// Generates rays starting around the origin, pointing in random directions; about half of them hit the shapes placed in front of them
+std::vector<Raz::Ray> generateRays() {
+  Raz::Random::BulkGenerator generator(1);
+
+  std::vector<Raz::Vec3f> directions(rayCount);
+  generator.generateUnitVectors(directions.data(), directions.size());
+
+  std::vector<float> offsets(rayCount);
+  generator.generateFloats(offsets.data(), offsets.size());
+
+  std::vector<Raz::Ray> rays;
+  rays.reserve(rayCount);
+
+  for (std::size_t rayIndex = 0; rayIndex < rayCount; ++rayIndex) {
+    const Raz::Vec3f direction(directions[rayIndex].x() * 0.5f, directions[rayIndex].y() * 0.5f, -std::abs(directions[rayIndex].z()) - 0.5f);
+    rays.emplace_back(Raz::Vec3f(offsets[rayIndex] - 0.5f, 0.f, 0.f), direction.normalize());
+  }
+
+  return rays;
+}
+
+template <typename ShapeT>
+void runRayIntersections(Raz::Benchmark::State& state, const ShapeT& shape, bool computeHit) {
+  const std::vector<Raz::Ray> rays = generateRays();
+  Raz::RayHit hit;
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(rays[iterIndex & (rayCount - 1)].intersects(shape, (computeHit ? &hit : nullptr)));
+
+  Raz::Benchmark::doNotOptimize(hit);
+}
+
+} // namespace
+
+RAZ_BENCHMARK("Ray/Plane intersection") {
+  runRayIntersections(state, Raz::Plane(-5.f, Raz::Axis::Z), false);
+}
+
+RAZ_BENCHMARK("Ray/Sphere intersection") {
+  runRayIntersections(state, Raz::Sphere(Raz::Vec3f(0.f, 0.f, -5.f), 2.f), false);
+}
+
+RAZ_BENCHMARK("Ray/Sphere intersection with hit") {
+  runRayIntersections(state, Raz::Sphere(Raz::Vec3f(0.f, 0.f, -5.f), 2.f), true);
+}
+
+RAZ_BENCHMARK("Ray/Triangle intersection") {
+  runRayIntersections(state, Raz::Triangle(Raz::Vec3f(-3.f, -2.f, -5.f), Raz::Vec3f(3.f, -2.f, -5.f), Raz::Vec3f(0.f, 3.f, -5.f)), false);
+}
+
+RAZ_BENCHMARK("Ray/Triangle intersection with hit") {
+  runRayIntersections(state, Raz::Triangle(Raz::Vec3f(-3.f, -2.f, -5.f), Raz::Vec3f(3.f, -2.f, -5.f), Raz::Vec3f(0.f, 3.f, -5.f)), true);
+}
+
+RAZ_BENCHMARK("Ray/AABB intersection") {
+  runRayIntersections(state, Raz::AABB(Raz::Vec3f(-2.f, -2.f, -7.f), Raz::Vec3f(2.f, 2.f, -4.f)), false);
+}
+
+RAZ_BENCHMARK("Ray/AABB intersection with hit") {
+  runRayIntersections(state, Raz::AABB(Raz::Vec3f(-2.f, -2.f, -7.f), Raz::Vec3f(2.f, 2.f, -4.f)), true);
+}
+
+RAZ_BENCHMARK("Ray/OBB intersection") {
+  const Raz::OBB obb(Raz::Vec3f(-2.f, -2.f, -7.f), Raz::Vec3f(2.f, 2.f, -4.f), Raz::Mat3f(Raz::Quaternionf(Raz::Radiansf(0.5f), Raz::Axis::Y).computeMatrix()));
+  runRayIntersections(state, obb, false);
+}
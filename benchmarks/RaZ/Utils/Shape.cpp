@@ -0,0 +1,110 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Math/Random.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <vector>
+
+namespace {
+
+constexpr std::size_t shapeCount = 1024; // Must be a power of 2, the iteration index being masked to recover the shapes
+
+// Generates points spread in a cube of 20 units, giving a mix of intersecting & non-intersecting shapes
+std::vector<Raz::Vec3f> generatePoints(uint64_t seed) {
+  Raz::Random::Xoshiro256 generator(seed);
+  std::vector<Raz::Vec3f> points(shapeCount);
+
+  for (Raz::Vec3f& point : points)
+    point = Raz::Vec3f(generator.generateFloat(), generator.generateFloat(), generator.generateFloat()) * 20.f - 10.f;
+
+  return points;
+}
+
+std::vector<Raz::Sphere> generateSpheres(uint64_t seed) {
+  std::vector<Raz::Sphere> spheres;
+  spheres.reserve(shapeCount);
+
+  for (const Raz::Vec3f& point : generatePoints(seed))
+    spheres.emplace_back(point, 3.f);
+
+  return spheres;
+}
+
+std::vector<Raz::AABB> generateAABBs(uint64_t seed) {
+  std::vector<Raz::AABB> boxes;
+  boxes.reserve(shapeCount);
+
+  for (const Raz::Vec3f& point : generatePoints(seed))
+    boxes.emplace_back(point - 2.f, point + 2.f);
+
+  return boxes;
+}
+
+std::vector<Raz::Triangle> generateTriangles(uint64_t seed) {
+  std::vector<Raz::Triangle> triangles;
+  triangles.reserve(shapeCount);
+
+  for (const Raz::Vec3f& point : generatePoints(seed))
+    triangles.emplace_back(point + Raz::Vec3f(-3.f, -2.f, 0.f), point + Raz::Vec3f(3.f, -2.f, 1.f), point + Raz::Vec3f(0.f, 3.f, -1.f));
+
+  return triangles;
+}
+
+template <typename ShapeT1, typename ShapeT2>
+void runIntersections(Raz::Benchmark::State& state, const std::vector<ShapeT1>& shapes1, const std::vector<ShapeT2>& shapes2) {
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(shapes1[iterIndex & (shapeCount - 1)].intersects(shapes2[iterIndex & (shapeCount - 1)]));
+}
+
+} // namespace
+
+RAZ_BENCHMARK("Shape/Sphere-sphere intersection") {
+  runIntersections(state, generateSpheres(1), generateSpheres(2));
+}
+
+RAZ_BENCHMARK("Shape/Sphere-AABB intersection") {
+  runIntersections(state, generateSpheres(1), generateAABBs(2));
+}
+
+RAZ_BENCHMARK("Shape/Sphere-triangle intersection") {
+  runIntersections(state, generateSpheres(1), generateTriangles(2));
+}
+
+RAZ_BENCHMARK("Shape/AABB-AABB intersection") {
+  runIntersections(state, generateAABBs(1), generateAABBs(2));
+}
+
+RAZ_BENCHMARK("Shape/Triangle-AABB intersection") {
+  runIntersections(state, generateTriangles(1), generateAABBs(2));
+}
+
+RAZ_BENCHMARK("Shape/Plane-AABB intersection") {
+  std::vector<Raz::Plane> planes;
+  planes.reserve(shapeCount);
+
+  for (const Raz::Vec3f& point : generatePoints(1))
+    planes.emplace_back(point.x(), (point + Raz::Vec3f(0.f, 0.f, 15.f)).normalize());
+
+  runIntersections(state, planes, generateAABBs(2));
+}
+
+RAZ_BENCHMARK("Shape/Line-AABB intersection") {
+  const std::vector<Raz::Vec3f> beginPoints = generatePoints(1);
+  const std::vector<Raz::Vec3f> endPoints   = generatePoints(2);
+
+  std::vector<Raz::Line> lines;
+  lines.reserve(shapeCount);
+
+  for (std::size_t lineIndex = 0; lineIndex < shapeCount; ++lineIndex)
+    lines.emplace_back(beginPoints[lineIndex], endPoints[lineIndex]);
+
+  runIntersections(state, lines, generateAABBs(3));
+}
+
+RAZ_BENCHMARK("Shape/AABB point containment") {
+  const std::vector<Raz::AABB> boxes    = generateAABBs(1);
+  const std::vector<Raz::Vec3f> points = generatePoints(2);
+
+  for (const std::size_t iterIndex : state)
+    Raz::Benchmark::doNotOptimize(boxes[iterIndex & (shapeCount - 1)].contains(points[iterIndex & (shapeCount - 1)]));
+}
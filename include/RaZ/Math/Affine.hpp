@@ -0,0 +1,109 @@
+#pragma once
+
+#ifndef RAZ_AFFINE_HPP
+#define RAZ_AFFINE_HPP
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+namespace Raz {
+
+template <typename T>
+class Affine3;
+
+template <typename T>
+std::ostream& operator<<(std::ostream& stream, const Affine3<T>& affine);
+
+/// Affine 3D transformation, equivalent to a 4x4 matrix whose last column is [ 0; 0; 0; 1 ].
+/// Only the 3x4 part is stored: the 3x3 linear part (rotation, scale & shear) & the translation, which is the matrix's last row.
+/// Composing, transforming & inverting such a transformation is much cheaper than doing so with a generic 4x4 matrix.
+/// \tparam T Type of the values to be held by the transformation.
+template <typename T = float>
+class Affine3 {
+  static_assert(std::is_floating_point_v<T>, "Error: Affine transformation's type must be floating point.");
+
+public:
+  constexpr Affine3() noexcept = default;
+  constexpr Affine3(const Mat3<T>& linear, const Vec3<T>& translation) noexcept : m_linear{ linear }, m_translation{ translation } {}
+  /// Constructs an affine transformation from a 4x4 matrix.
+  /// \note The matrix's last column is assumed to be [ 0; 0; 0; 1 ] & is ignored.
+  /// \param mat Matrix to construct the transformation from.
+  constexpr explicit Affine3(const Mat4<T>& mat) noexcept;
+  constexpr Affine3(const Affine3&) noexcept = default;
+  constexpr Affine3(Affine3&&) noexcept = default;
+
+  constexpr const Mat3<T>& getLinear() const noexcept { return m_linear; }
+  constexpr const Vec3<T>& getTranslation() const noexcept { return m_translation; }
+
+  constexpr void setLinear(const Mat3<T>& linear) noexcept { m_linear = linear; }
+  constexpr void setTranslation(const Vec3<T>& translation) noexcept { m_translation = translation; }
+
+  /// Creates an affine transformation representing an identity transformation.
+  /// \return Identity transformation.
+  static constexpr Affine3 identity() noexcept { return Affine3(Mat3<T>::identity(), Vec3<T>(0)); }
+
+  /// Transforms a point, applying both the linear part & the translation.
+  /// \param point Point to be transformed.
+  /// \return Transformed point.
+  constexpr Vec3<T> transformPoint(const Vec3<T>& point) const noexcept { return point * m_linear + m_translation; }
+  /// Transforms a direction, applying only the linear part.
+  /// \param direction Direction to be transformed.
+  /// \return Transformed direction.
+  constexpr Vec3<T> transformDirection(const Vec3<T>& direction) const noexcept { return direction * m_linear; }
+  /// Computes the inverse of a rigid transformation, which only has a rotation & a translation.
+  /// The inverse rotation being its transpose, this is the fastest way to invert such a transformation.
+  /// \note The linear part must be orthonormal for the result to be valid; if it is not, use inverse() instead.
+  /// \return Inverse rigid transformation.
+  constexpr Affine3 inverseRigid() const noexcept;
+  /// Computes the inverse of the affine transformation. Only the 3x3 linear part needs to be inverted.
+  /// \return Inverse transformation.
+  constexpr Affine3 inverse() const noexcept;
+  /// Computes the 4x4 matrix equivalent to the transformation.
+  /// \return Transformation matrix.
+  constexpr Mat4<T> computeMatrix() const noexcept;
+
+  /// Default copy assignment operator.
+  /// \return Reference to the copied transformation.
+  constexpr Affine3& operator=(const Affine3&) noexcept = default;
+  /// Default move assignment operator.
+  /// \return Reference to the moved transformation.
+  constexpr Affine3& operator=(Affine3&&) noexcept = default;
+  /// Transformations composition operator. Like with matrices, the current transformation is applied first.
+  /// \param affine Transformation to be composed with.
+  /// \return Result of the composed transformations.
+  constexpr Affine3 operator*(const Affine3& affine) const noexcept;
+  /// Transformations composition assignment operator. Like with matrices, the current transformation is applied first.
+  /// \param affine Transformation to be composed with.
+  /// \return Reference to the modified original transformation.
+  constexpr Affine3& operator*=(const Affine3& affine) noexcept { *this = *this * affine; return *this; }
+  /// Transformation equality comparison operator.
+  /// Uses a near-equality check to take floating-point errors into account.
+  /// \param affine Transformation to be compared with.
+  /// \return True if transformations are nearly equal, false otherwise.
+  constexpr bool operator==(const Affine3& affine) const noexcept { return (m_linear == affine.m_linear && m_translation == affine.m_translation); }
+  /// Transformation inequality comparison operator.
+  /// Uses a near-equality check to take floating-point errors into account.
+  /// \param affine Transformation to be compared with.
+  /// \return True if transformations are different, false otherwise.
+  constexpr bool operator!=(const Affine3& affine) const noexcept { return !(*this == affine); }
+  /// Matrix conversion operator; computes the 4x4 matrix equivalent to the transformation.
+  /// \return Transformation matrix.
+  constexpr operator Mat4<T>() const noexcept { return computeMatrix(); }
+  /// Output stream operator.
+  /// \param stream Stream to output into.
+  /// \param affine Transformation to be output.
+  friend std::ostream& operator<< <>(std::ostream& stream, const Affine3& affine);
+
+private:
+  Mat3<T> m_linear = Mat3<T>::identity();
+  Vec3<T> m_translation {};
+};
+
+using Affine3f = Affine3<float>;
+using Affine3d = Affine3<double>;
+
+} // namespace Raz
+
+#include "RaZ/Math/Affine.inl"
+
+#endif // RAZ_AFFINE_HPP
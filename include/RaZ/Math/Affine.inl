@@ -0,0 +1,55 @@
+namespace Raz {
+
+template <typename T>
+constexpr Affine3<T>::Affine3(const Mat4<T>& mat) noexcept
+  : m_linear(mat.getElement(0, 0), mat.getElement(1, 0), mat.getElement(2, 0),
+             mat.getElement(0, 1), mat.getElement(1, 1), mat.getElement(2, 1),
+             mat.getElement(0, 2), mat.getElement(1, 2), mat.getElement(2, 2)),
+    m_translation(mat.getElement(0, 3), mat.getElement(1, 3), mat.getElement(2, 3)) {}
+
+template <typename T>
+constexpr Affine3<T> Affine3<T>::inverseRigid() const noexcept {
+  const Mat3<T> invLinear = m_linear.transpose();
+  return Affine3(invLinear, -(m_translation * invLinear));
+}
+
+template <typename T>
+constexpr Affine3<T> Affine3<T>::inverse() const noexcept {
+  const Vec3<T> firstRow  = m_linear.recoverRow(0);
+  const Vec3<T> secondRow = m_linear.recoverRow(1);
+  const Vec3<T> thirdRow  = m_linear.recoverRow(2);
+
+  // The inverse's columns are the cross products of the rows, divided by the determinant
+  const Vec3<T> firstColumn  = secondRow.cross(thirdRow);
+  const Vec3<T> secondColumn = thirdRow.cross(firstRow);
+  const Vec3<T> thirdColumn  = firstRow.cross(secondRow);
+
+  const T invDeterminant = 1 / firstRow.dot(firstColumn);
+
+  const Mat3<T> invLinear(firstColumn.x() * invDeterminant, secondColumn.x() * invDeterminant, thirdColumn.x() * invDeterminant,
+                          firstColumn.y() * invDeterminant, secondColumn.y() * invDeterminant, thirdColumn.y() * invDeterminant,
+                          firstColumn.z() * invDeterminant, secondColumn.z() * invDeterminant, thirdColumn.z() * invDeterminant);
+
+  return Affine3(invLinear, -(m_translation * invLinear));
+}
+
+template <typename T>
+constexpr Mat4<T> Affine3<T>::computeMatrix() const noexcept {
+  return Mat4<T>(m_linear.getElement(0, 0), m_linear.getElement(1, 0), m_linear.getElement(2, 0), static_cast<T>(0),
+                 m_linear.getElement(0, 1), m_linear.getElement(1, 1), m_linear.getElement(2, 1), static_cast<T>(0),
+                 m_linear.getElement(0, 2), m_linear.getElement(1, 2), m_linear.getElement(2, 2), static_cast<T>(0),
+                 m_translation.x(),         m_translation.y(),         m_translation.z(),         static_cast<T>(1));
+}
+
+template <typename T>
+constexpr Affine3<T> Affine3<T>::operator*(const Affine3& affine) const noexcept {
+  return Affine3(m_linear * affine.m_linear, m_translation * affine.m_linear + affine.m_translation);
+}
+
+template <typename T>
+std::ostream& operator<<(std::ostream& stream, const Affine3<T>& affine) {
+  stream << "[ " << affine.getLinear() << "; " << affine.getTranslation() << " ]";
+  return stream;
+}
+
+} // namespace Raz
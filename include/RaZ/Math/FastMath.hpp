@@ -0,0 +1,151 @@
+#pragma once
+
+#ifndef RAZ_FASTMATH_HPP
+#define RAZ_FASTMATH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/// Fast approximations of common math functions, trading accuracy for speed.
+/// Each function exists in two precision tiers, whose maximum errors are documented & checked by unit tests. The errors are given either relative to
+///   the exact result, or as absolute values; 1e-7 roughly corresponds to a single ULP for values around 1.
+/// The array variants compute several values at once with SIMD instructions (SSE, or AVX with the RAZ_USE_AVX2 CMake option).
+/// Defining RAZ_USE_FAST_MATH (through the CMake option of the same name) makes Vector::normalize() & the Quaternion's constructor from an angle &
+///   an axis use the high precision approximations.
+namespace Raz::FastMath {
+
+enum class Precision : uint8_t {
+  LOW, ///< Fastest approximation, with an error usually around 1e-4.
+  HIGH ///< Approximation close to the float precision, with an error usually around 1e-6 at most.
+};
+
+#if defined(RAZ_USE_FAST_MATH)
+/// Tolerance with which to compare values depending on the approximations used by RAZ_USE_FAST_MATH, such as a dot product of normalized vectors
+///   checked against 1; it covers the high precision errors of two approximated values.
+constexpr float comparisonTolerance = 0.000002f;
+#else
+/// Tolerance with which to compare values depending on the approximations used by RAZ_USE_FAST_MATH; without these, it is the usual float epsilon.
+constexpr float comparisonTolerance = std::numeric_limits<float>::epsilon();
+#endif
+
+/// Computes an approximation of the inverse square root of a value.
+/// The error is relative: below 2e-3 in low precision (4e-4 with SSE), & below 1e-6 in high precision.
+/// \tparam P Precision tier.
+/// \param value Value to compute the inverse square root of.
+/// \return Approximated inverse square root; infinity if the value is 0.
+template <Precision P = Precision::HIGH>
+float rsqrt(float value) noexcept;
+
+/// Computes an approximation of the sine of an angle.
+/// The error is absolute: below 2e-4 in low precision, & below 3e-7 in high precision, for angles up to 1e5 radians.
+/// \tparam P Precision tier.
+/// \param angle Angle in radians.
+/// \return Approximated sine.
+template <Precision P = Precision::HIGH>
+float sin(float angle) noexcept;
+
+/// Computes an approximation of the cosine of an angle.
+/// The error is absolute: below 2e-4 in low precision, & below 3e-7 in high precision, for angles up to 1e5 radians.
+/// \tparam P Precision tier.
+/// \param angle Angle in radians.
+/// \return Approximated cosine.
+template <Precision P = Precision::HIGH>
+float cos(float angle) noexcept;
+
+/// Computes an approximation of the arc cosine of a value.
+/// The error is absolute: below 1e-4 in low precision, & below 5e-7 in high precision.
+/// \tparam P Precision tier.
+/// \param value Value between -1 & 1.
+/// \return Approximated arc cosine, in radians between 0 & pi.
+template <Precision P = Precision::HIGH>
+float acos(float value) noexcept;
+
+/// Computes an approximation of the arc tangent of y/x, using the signs of both values to determine the quadrant.
+/// The error is absolute: below 1e-4 in low precision, & below 5e-7 in high precision.
+/// \note Contrary to std::atan2(), the signs of zeros are not taken into account; the result is 0 if both values are null.
+/// \tparam P Precision tier.
+/// \param y Y value. Must be finite.
+/// \param x X value. Must be finite.
+/// \return Approximated arc tangent, in radians between -pi & pi.
+template <Precision P = Precision::HIGH>
+float atan2(float y, float x) noexcept;
+
+/// Computes an approximation of the exponential of a value.
+/// The error is relative: below 1e-4 in low precision, & below 3e-7 in high precision, for all results in the normal float range.
+/// \tparam P Precision tier.
+/// \param value Value to compute the exponential of.
+/// \return Approximated exponential; infinity if it is too large to be represented.
+template <Precision P = Precision::HIGH>
+float exp(float value) noexcept;
+
+/// Computes an approximation of the natural logarithm of a value.
+/// The error is absolute for results between -1 & 1, & relative otherwise: below 1e-5 in low precision, & below 3e-7 in high precision.
+/// \tparam P Precision tier.
+/// \param value Value to compute the logarithm of.
+/// \return Approximated logarithm; minus infinity if the value is 0, NaN if it is negative.
+template <Precision P = Precision::HIGH>
+float log(float value) noexcept;
+
+/// Computes approximations of the inverse square roots of several values, with the same error bounds as the single-value rsqrt().
+/// \tparam P Precision tier.
+/// \param values Values to compute the inverse square roots of.
+/// \param results Computed inverse square roots. May be the same array as the values.
+/// \param count Number of values.
+template <Precision P = Precision::HIGH>
+void rsqrt(const float* values, float* results, std::size_t count) noexcept;
+
+/// Computes approximations of the sines of several angles, giving the same results as the single-value sin().
+/// \tparam P Precision tier.
+/// \param angles Angles in radians.
+/// \param results Computed sines. May be the same array as the angles.
+/// \param count Number of angles.
+template <Precision P = Precision::HIGH>
+void sin(const float* angles, float* results, std::size_t count) noexcept;
+
+/// Computes approximations of the cosines of several angles, giving the same results as the single-value cos().
+/// \tparam P Precision tier.
+/// \param angles Angles in radians.
+/// \param results Computed cosines. May be the same array as the angles.
+/// \param count Number of angles.
+template <Precision P = Precision::HIGH>
+void cos(const float* angles, float* results, std::size_t count) noexcept;
+
+/// Computes approximations of the arc cosines of several values, giving the same results as the single-value acos().
+/// \tparam P Precision tier.
+/// \param values Values between -1 & 1.
+/// \param results Computed arc cosines. May be the same array as the values.
+/// \param count Number of values.
+template <Precision P = Precision::HIGH>
+void acos(const float* values, float* results, std::size_t count) noexcept;
+
+/// Computes approximations of the arc tangents of several couples of values, giving the same results as the single-value atan2().
+/// \tparam P Precision tier.
+/// \param yValues Y values.
+/// \param xValues X values.
+/// \param results Computed arc tangents. May be the same array as any of the values.
+/// \param count Number of couples of values.
+template <Precision P = Precision::HIGH>
+void atan2(const float* yValues, const float* xValues, float* results, std::size_t count) noexcept;
+
+/// Computes approximations of the exponentials of several values, giving the same results as the single-value exp().
+/// \tparam P Precision tier.
+/// \param values Values to compute the exponentials of.
+/// \param results Computed exponentials. May be the same array as the values.
+/// \param count Number of values.
+template <Precision P = Precision::HIGH>
+void exp(const float* values, float* results, std::size_t count) noexcept;
+
+/// Computes approximations of the natural logarithms of several values, giving the same results as the single-value log().
+/// \tparam P Precision tier.
+/// \param values Values to compute the logarithms of.
+/// \param results Computed logarithms. May be the same array as the values.
+/// \param count Number of values.
+template <Precision P = Precision::HIGH>
+void log(const float* values, float* results, std::size_t count) noexcept;
+
+} // namespace Raz::FastMath
+
+#include "RaZ/Math/FastMath.inl"
+
+#endif // RAZ_FASTMATH_HPP
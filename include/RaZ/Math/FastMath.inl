@@ -0,0 +1,36 @@
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#endif
+
+namespace Raz::FastMath {
+
+template <Precision P>
+float rsqrt(float value) noexcept {
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+  const float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+  constexpr int refinementCount = (P == Precision::LOW ? 0 : 1);
+#else
+  // Initial estimate from the float's bits (see https://en.wikipedia.org/wiki/Fast_inverse_square_root), needing more refinement steps
+  uint32_t valueBits {};
+  std::memcpy(&valueBits, &value, sizeof(float));
+
+  const uint32_t estimateBits = 0x5F375A86u - (valueBits >> 1);
+  float estimate {};
+  std::memcpy(&estimate, &estimateBits, sizeof(float));
+
+  constexpr int refinementCount = (P == Precision::LOW ? 1 : 3);
+#endif
+
+  // Each Newton-Raphson iteration roughly doubles the number of correct bits
+  float refined = estimate;
+  for (int i = 0; i < refinementCount; ++i)
+    refined = refined * (1.5f - 0.5f * value * refined * refined);
+
+  // Refining infinite estimates (for values of 0) gives NaN, in which case the estimate is kept
+  return (std::isnan(refined) ? estimate : refined);
+}
+
+} // namespace Raz::FastMath
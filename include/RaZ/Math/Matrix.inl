@@ -1,3 +1,4 @@
+#include "RaZ/Math/Simd.hpp"
 #include "RaZ/Utils/FloatUtils.hpp"
 
 #include <algorithm>
@@ -366,6 +367,13 @@ constexpr Vector<T, H> Matrix<T, W, H>::operator*(const Vector<T, H>& vec) const
   // This multiplication is made assuming the vector to be vertical
   Vector<T, H> res {};
 
+  if constexpr (std::is_same_v<T, float> && W == 4 && H == 4) {
+    if (!Simd::isConstantEvaluated()) {
+      Simd::multiplyMat4Vec4(getDataPtr(), vec.getDataPtr(), res.getDataPtr());
+      return res;
+    }
+  }
+
   for (std::size_t heightIndex = 0; heightIndex < H; ++heightIndex) {
     for (std::size_t widthIndex = 0; widthIndex < W; ++widthIndex)
       res[heightIndex] += m_data[heightIndex * W + widthIndex] * vec[widthIndex];
@@ -381,6 +389,13 @@ constexpr Matrix<T, H, WI> Matrix<T, W, H>::operator*(const Matrix<T, WI, HI>& m
 
   Matrix<T, H, WI> res {};
 
+  if constexpr (std::is_same_v<T, float> && W == 4 && H == 4 && WI == 4) {
+    if (!Simd::isConstantEvaluated()) {
+      Simd::multiplyMat4(getDataPtr(), mat.getDataPtr(), res.getDataPtr());
+      return res;
+    }
+  }
+
   for (std::size_t heightIndex = 0; heightIndex < H; ++heightIndex) {
     for (std::size_t widthIndex = 0; widthIndex < W; ++widthIndex) {
       T& val = res.getElement(widthIndex, heightIndex);
@@ -0,0 +1,155 @@
+#pragma once
+
+#ifndef RAZ_PACKING_HPP
+#define RAZ_PACKING_HPP
+
+#include "RaZ/Math/Vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+/// Conversions of floating-point values to & from compact representations, to reduce the memory & bandwidth taken by vertex attributes, images & such.
+/// The array variants process several values at once with SIMD instructions (SSE2, and F16C for half-precision floats when available at compile
+///   time), giving the exact same results as their single-value counterparts.
+namespace Raz::Packing {
+
+/// Converts a single-precision float to an IEEE 754 half-precision (binary16) one, rounding to the nearest representable value (ties to even).
+/// Values too large to be represented become infinite; NaNs stay NaNs, keeping the highest bits of their payload.
+/// \param value Value to be converted.
+/// \return Bits of the half-precision float.
+uint16_t convertToHalf(float value) noexcept;
+/// Converts an IEEE 754 half-precision (binary16) float to a single-precision one. The conversion is exact, apart from signaling NaNs becoming quiet.
+/// \param halfBits Bits of the half-precision float.
+/// \return Converted value.
+float convertFromHalf(uint16_t halfBits) noexcept;
+
+/// Packs a value between 0 & 1 into an unsigned normalized integer, rounded to the nearest one.
+/// \tparam T Type of the packed value; must be either uint8_t or uint16_t.
+/// \param value Value to be packed. Clamped between 0 & 1; NaN gives 0.
+/// \return Packed value.
+template <typename T>
+T packUnorm(float value) noexcept;
+/// Unpacks an unsigned normalized integer into a value between 0 & 1.
+/// \tparam T Type of the packed value; must be either uint8_t or uint16_t.
+/// \param value Value to be unpacked.
+/// \return Unpacked value.
+template <typename T>
+float unpackUnorm(T value) noexcept;
+/// Packs a value between -1 & 1 into a signed normalized integer, rounded to the nearest one.
+/// \tparam T Type of the packed value; must be either int8_t or int16_t.
+/// \param value Value to be packed. Clamped between -1 & 1; NaN gives -1.
+/// \return Packed value. The lowest integer is never used, -1 being given by the lowest integer + 1.
+template <typename T>
+T packSnorm(float value) noexcept;
+/// Unpacks a signed normalized integer into a value between -1 & 1.
+/// \tparam T Type of the packed value; must be either int8_t or int16_t.
+/// \param value Value to be unpacked. Both the lowest integer & the lowest integer + 1 give -1.
+/// \return Unpacked value.
+template <typename T>
+float unpackSnorm(T value) noexcept;
+
+/// Encodes a unit vector onto the octahedron mapped to a square, as described by [Cigolle et al.](https://jcgt.org/published/0003/02/01/).
+/// \param normal Unit vector to be encoded.
+/// \return Octahedral coordinates, both between -1 & 1.
+Vec2f encodeOctahedral(const Vec3f& normal) noexcept;
+/// Decodes a unit vector from octahedral coordinates.
+/// \param coords Octahedral coordinates, both between -1 & 1.
+/// \return Decoded unit vector.
+Vec3f decodeOctahedral(const Vec2f& coords) noexcept;
+/// Packs a unit vector into two 16-bit signed normalized octahedral coordinates; the angular error is below 5e-5 radians.
+/// \param normal Unit vector to be packed.
+/// \return Packed vector, its X octahedral coordinate being stored in the lowest 16 bits.
+uint32_t packOctahedral(const Vec3f& normal) noexcept;
+/// Unpacks a unit vector from two 16-bit signed normalized octahedral coordinates.
+/// \param packedNormal Packed vector.
+/// \return Unpacked unit vector.
+Vec3f unpackOctahedral(uint32_t packedNormal) noexcept;
+
+/// Packs a color in the RGB9E5 format, in which all components have a 9-bit mantissa & share a 5-bit exponent.
+/// \param color Color to be packed. Its components are clamped between 0 & 65408; NaN gives 0.
+/// \return Packed color, the red component being stored in the lowest bits & the exponent in the highest ones.
+uint32_t packRgb9e5(const Vec3f& color) noexcept;
+/// Unpacks a color from the RGB9E5 format.
+/// \param packedColor Packed color.
+/// \return Unpacked color.
+Vec3f unpackRgb9e5(uint32_t packedColor) noexcept;
+/// Packs a color in the R11G11B10 format, holding unsigned floats with a 5-bit exponent & respectively a 6, 6 & 5-bit mantissa.
+/// Each component is rounded to the nearest representable value (ties to even). Negative values give 0, & values too large become infinite.
+/// \param color Color to be packed.
+/// \return Packed color, the red component being stored in the lowest bits.
+uint32_t packR11G11B10(const Vec3f& color) noexcept;
+/// Unpacks a color from the R11G11B10 format.
+/// \param packedColor Packed color.
+/// \return Unpacked color.
+Vec3f unpackR11G11B10(uint32_t packedColor) noexcept;
+
+/// Converts several single-precision floats to half-precision ones, giving the same results as the single-value convertToHalf().
+/// \param values Values to be converted.
+/// \param halfBits Bits of the converted half-precision floats.
+/// \param count Number of values.
+void convertToHalf(const float* values, uint16_t* halfBits, std::size_t count) noexcept;
+/// Converts several half-precision floats to single-precision ones, giving the same results as the single-value convertFromHalf().
+/// \param halfBits Bits of the half-precision floats.
+/// \param values Converted values.
+/// \param count Number of values.
+void convertFromHalf(const uint16_t* halfBits, float* values, std::size_t count) noexcept;
+/// Packs several values into unsigned normalized integers, giving the same results as the single-value packUnorm().
+/// \tparam T Type of the packed values; must be either uint8_t or uint16_t.
+/// \param values Values to be packed.
+/// \param packedValues Packed values.
+/// \param count Number of values.
+template <typename T>
+void packUnorm(const float* values, T* packedValues, std::size_t count) noexcept;
+/// Unpacks several unsigned normalized integers, giving the same results as the single-value unpackUnorm().
+/// \tparam T Type of the packed values; must be either uint8_t or uint16_t.
+/// \param packedValues Values to be unpacked.
+/// \param values Unpacked values.
+/// \param count Number of values.
+template <typename T>
+void unpackUnorm(const T* packedValues, float* values, std::size_t count) noexcept;
+/// Packs several values into signed normalized integers, giving the same results as the single-value packSnorm().
+/// \tparam T Type of the packed values; must be either int8_t or int16_t.
+/// \param values Values to be packed.
+/// \param packedValues Packed values.
+/// \param count Number of values.
+template <typename T>
+void packSnorm(const float* values, T* packedValues, std::size_t count) noexcept;
+/// Unpacks several signed normalized integers, giving the same results as the single-value unpackSnorm().
+/// \tparam T Type of the packed values; must be either int8_t or int16_t.
+/// \param packedValues Values to be unpacked.
+/// \param values Unpacked values.
+/// \param count Number of values.
+template <typename T>
+void unpackSnorm(const T* packedValues, float* values, std::size_t count) noexcept;
+
+} // namespace Raz::Packing
+
+namespace Raz {
+
+/// IEEE 754 half-precision (binary16) floating-point value, only meant to be stored; it must be converted to float for any computation.
+/// It can represent values up to 65504, with about 3 significant decimal digits.
+class Half {
+public:
+  constexpr Half() noexcept = default;
+  explicit Half(float value) noexcept : m_bits{ Packing::convertToHalf(value) } {}
+
+  constexpr uint16_t getBits() const noexcept { return m_bits; }
+
+  /// Creates a half-precision float from its bits.
+  /// \param bits Bits of the value.
+  /// \return Created half-precision float.
+  static constexpr Half fromBits(uint16_t bits) noexcept { Half half; half.m_bits = bits; return half; }
+
+  /// Converts the half-precision float to a single-precision one.
+  /// \return Converted value.
+  explicit operator float() const noexcept { return Packing::convertFromHalf(m_bits); }
+
+private:
+  uint16_t m_bits {};
+};
+
+} // namespace Raz
+
+#include "RaZ/Math/Packing.inl"
+
+#endif // RAZ_PACKING_HPP
@@ -0,0 +1,47 @@
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace Raz::Packing {
+
+// The clamping operations are written so that NaN gives the lower bound, as do the SIMD minimum & maximum used by the array variants
+
+template <typename T>
+T packUnorm(float value) noexcept {
+  static_assert(std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t>, "Error: Unsigned normalized values must be either uint8_t or uint16_t.");
+
+  constexpr auto maxValue = static_cast<float>(std::numeric_limits<T>::max());
+
+  const float clampedValue = (value > 0.f ? value : 0.f);
+  return static_cast<T>(std::lrint((clampedValue < 1.f ? clampedValue : 1.f) * maxValue));
+}
+
+template <typename T>
+float unpackUnorm(T value) noexcept {
+  static_assert(std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t>, "Error: Unsigned normalized values must be either uint8_t or uint16_t.");
+
+  constexpr auto maxValue = static_cast<float>(std::numeric_limits<T>::max());
+  return static_cast<float>(value) / maxValue;
+}
+
+template <typename T>
+T packSnorm(float value) noexcept {
+  static_assert(std::is_same_v<T, int8_t> || std::is_same_v<T, int16_t>, "Error: Signed normalized values must be either int8_t or int16_t.");
+
+  constexpr auto maxValue = static_cast<float>(std::numeric_limits<T>::max());
+
+  const float clampedValue = (value > -1.f ? value : -1.f);
+  return static_cast<T>(std::lrint((clampedValue < 1.f ? clampedValue : 1.f) * maxValue));
+}
+
+template <typename T>
+float unpackSnorm(T value) noexcept {
+  static_assert(std::is_same_v<T, int8_t> || std::is_same_v<T, int16_t>, "Error: Signed normalized values must be either int8_t or int16_t.");
+
+  constexpr auto maxValue = static_cast<float>(std::numeric_limits<T>::max());
+
+  const float unpackedValue = static_cast<float>(value) / maxValue;
+  return (unpackedValue > -1.f ? unpackedValue : -1.f);
+}
+
+} // namespace Raz::Packing
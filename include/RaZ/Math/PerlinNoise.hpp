@@ -3,11 +3,136 @@
 #ifndef RAZ_PERLINNOISE_HPP
 #define RAZ_PERLINNOISE_HPP
 
-namespace Raz::PerlinNoise {
+#include "RaZ/Math/Vector.hpp"
 
+#include <cstdint>
+
+namespace Raz {
+
+class Image;
+
+namespace PerlinNoise {
+
+/// Type of the noise function evaluated for each octave of a fractal noise.
+enum class NoiseType : uint8_t {
+  PERLIN, ///< Classic gradient noise, interpolated on a square/cubic lattice.
+  SIMPLEX ///< Simplex noise, cheaper in higher dimensions & with less directional artifacts.
+};
+
+/// Method used to combine the octaves of a fractal noise.
+enum class FractalType : uint8_t {
+  FBM,   ///< Fractional Brownian motion: sum of the octaves' values.
+  RIDGED ///< Sum of the octaves' values folded around their middle, giving sharp ridges.
+};
+
+/// Parameters of a fractal noise, made of several layers (octaves) of noise of increasing frequencies.
+struct FractalParams {
+  NoiseType noiseType      = NoiseType::PERLIN; ///< Noise function evaluated for each octave.
+  unsigned int octaveCount = 4;                 ///< Number of noise layers summed together.
+  float frequency          = 1.f;               ///< Frequency of the first octave.
+  float lacunarity         = 2.f;               ///< Factor applied to the frequency from one octave to the next.
+  float persistence        = 0.5f;              ///< Factor applied to the amplitude from one octave to the next.
+  uint32_t seed            = 0;                 ///< Seed from which each octave's coordinates offset is generated.
+};
+
+/// Region of a regular 2D grid, on which noise values are computed.
+struct GridRegion {
+  Vec2f origin {};         ///< Coordinates of the first point of the grid.
+  Vec2f step = Vec2f(1.f); ///< Distance between two consecutive points of the grid on each axis.
+  std::size_t width {};    ///< Number of points on each row.
+  std::size_t height {};   ///< Number of rows.
+};
+
+/// Computes the 1D Perlin noise value at the given coordinate.
+/// \param x X coordinate.
+/// \return Noise value between 0 & 1.
 float get(float x);
+/// Computes the 2D Perlin noise value at the given coordinates.
+/// \param x X coordinate.
+/// \param y Y coordinate.
+/// \return Noise value between 0 & 1.
 float get(float x, float y);
+/// Computes the 3D Perlin noise value at the given coordinates.
+/// \param x X coordinate.
+/// \param y Y coordinate.
+/// \param z Z coordinate.
+/// \return Noise value between 0 & 1.
+float get(float x, float y, float z);
+/// Computes the 4D Perlin noise value at the given coordinates.
+/// \param x X coordinate.
+/// \param y Y coordinate.
+/// \param z Z coordinate.
+/// \param w W coordinate.
+/// \return Noise value between 0 & 1.
+float get(float x, float y, float z, float w);
+
+/// Computes the 2D simplex noise value at the given coordinates.
+/// \param x X coordinate.
+/// \param y Y coordinate.
+/// \return Noise value between 0 & 1.
+float getSimplex(float x, float y);
+/// Computes the 3D simplex noise value at the given coordinates.
+/// \param x X coordinate.
+/// \param y Y coordinate.
+/// \param z Z coordinate.
+/// \return Noise value between 0 & 1.
+float getSimplex(float x, float y, float z);
+/// Computes the 4D simplex noise value at the given coordinates.
+/// \param x X coordinate.
+/// \param y Y coordinate.
+/// \param z Z coordinate.
+/// \param w W coordinate.
+/// \return Noise value between 0 & 1.
+float getSimplex(float x, float y, float z, float w);
+
+/// Computes the 2D fractional Brownian motion value at the given coordinates.
+/// \param x X coordinate.
+/// \param y Y coordinate.
+/// \param params Fractal noise parameters.
+/// \return Noise value between 0 & 1.
+float computeFbm(float x, float y, const FractalParams& params = {});
+/// Computes the 3D fractional Brownian motion value at the given coordinates.
+/// \param x X coordinate.
+/// \param y Y coordinate.
+/// \param z Z coordinate.
+/// \param params Fractal noise parameters.
+/// \return Noise value between 0 & 1.
+float computeFbm(float x, float y, float z, const FractalParams& params = {});
+/// Computes the 2D ridged fractal noise value at the given coordinates.
+/// \param x X coordinate.
+/// \param y Y coordinate.
+/// \param params Fractal noise parameters.
+/// \return Noise value between 0 & 1.
+float computeRidged(float x, float y, const FractalParams& params = {});
+/// Computes the 3D ridged fractal noise value at the given coordinates.
+/// \param x X coordinate.
+/// \param y Y coordinate.
+/// \param z Z coordinate.
+/// \param params Fractal noise parameters.
+/// \return Noise value between 0 & 1.
+float computeRidged(float x, float y, float z, const FractalParams& params = {});
+
+/// Computes 2D fractal noise values on all points of a grid region.
+/// Several points are computed at once with SIMD instructions (SSE, or AVX with the RAZ_USE_AVX2 CMake option), and large regions are split in tiles
+///   processed in parallel. The value of the point at the given column & row is exactly the one returned by computeFbm() or computeRidged() for the
+///   coordinates (origin.x + column * step.x, origin.y + row * step.y).
+/// \param output Values buffer, which must be able to hold (height - 1) * rowStride + width values.
+/// \param rowStride Number of values between the beginnings of two consecutive rows in the buffer. Must be greater than or equal to the region's width.
+/// \param region Grid region to compute the noise on.
+/// \param fractalType Method used to combine the octaves.
+/// \param params Fractal noise parameters.
+void fillGrid(float* output, std::size_t rowStride, const GridRegion& region, FractalType fractalType, const FractalParams& params = {});
+/// Computes 2D fractal noise values on all pixels of an image, giving the same results as fillGrid().
+/// The value is written into every channel of each pixel; byte images receive values scaled between 0 & 255.
+/// \param image Image to be filled. Must already be allocated.
+/// \param origin Coordinates of the first pixel.
+/// \param step Distance between two consecutive pixels on each axis.
+/// \param fractalType Method used to combine the octaves.
+/// \param params Fractal noise parameters.
+void fillImage(Image& image, const Vec2f& origin, const Vec2f& step, FractalType fractalType, const FractalParams& params = {});
+
+} // namespace PerlinNoise
 
-} // namespace Raz::PerlinNoise
+} // namespace Raz
 
 #endif // RAZ_PERLINNOISE_HPP
@@ -1,10 +1,23 @@
 #include "RaZ/Math/Constants.hpp"
+#include "RaZ/Math/FastMath.hpp"
+#include "RaZ/Math/Simd.hpp"
 
 namespace Raz {
 
 template <typename T>
 constexpr Quaternion<T>::Quaternion(Radians<T> angle, const Vec3<T>& axis) noexcept {
   const T halfAngle = angle.value / 2;
+
+#if defined(RAZ_USE_FAST_MATH)
+  if constexpr (std::is_same_v<T, float>) {
+    if (!Simd::isConstantEvaluated()) {
+      m_real      = FastMath::cos(halfAngle);
+      m_complexes = axis * FastMath::sin(halfAngle);
+      return;
+    }
+  }
+#endif
+
   const T sinAngle  = std::sin(halfAngle);
 
   m_real      = std::cos(halfAngle);
@@ -53,13 +66,15 @@ constexpr Quaternion<T> Quaternion<T>::slerp(const Quaternion& quat, T coeff) co
                                                                               && FloatUtils::areNearlyEqual(quat.computeSquaredNorm(), static_cast<T>(1)));
 
   const T cosAngle = dot(quat);
+  // A rotation may be represented by two opposite quaternions; the interpolation must follow the shortest path, hence the angle's absolute value
+  const T absCosAngle = std::abs(cosAngle);
 
   T currCoeff {};
   T otherCoeff {};
 
   // Checking the angle between the quaternions; if the angle is sufficient, perform an actual spherical interpolation
-  if (std::abs(cosAngle) < static_cast<T>(0.99999)) {
-    const T angle       = std::acos(cosAngle);
+  if (absCosAngle < static_cast<T>(0.99999)) {
+    const T angle       = std::acos(absCosAngle);
     const T invSinAngle = 1 / std::sin(angle);
 
     currCoeff  = std::sin((1 - coeff) * angle) * invSinAngle;
@@ -131,6 +146,19 @@ constexpr Quaternion<T> Quaternion<T>::operator*(const Quaternion& quat) const n
 
 template <typename T>
 constexpr Quaternion<T>& Quaternion<T>::operator*=(const Quaternion& quat) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    if (!Simd::isConstantEvaluated()) {
+      std::array<float, 4> values = { m_real, m_complexes.x(), m_complexes.y(), m_complexes.z() };
+      const std::array<float, 4> quatValues = { quat.m_real, quat.m_complexes.x(), quat.m_complexes.y(), quat.m_complexes.z() };
+
+      Simd::multiplyQuaternions(values.data(), quatValues.data(), values.data());
+
+      m_real      = values[0];
+      m_complexes = Vec3f(values[1], values[2], values[3]);
+      return *this;
+    }
+  }
+
   const Quaternion<T> res = *this;
 
   m_real = res.m_real          * quat.m_real
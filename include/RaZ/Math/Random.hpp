@@ -0,0 +1,147 @@
+#pragma once
+
+#ifndef RAZ_RANDOM_HPP
+#define RAZ_RANDOM_HPP
+
+#include "RaZ/Math/Vector.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/// Pseudo-random number generators & low-discrepancy sequences.
+/// Contrary to the standard engines & distributions, whose results may depend on the standard library, all values are fully specified & thus
+///   identical on every platform for a given seed, whatever the SIMD instructions available.
+namespace Raz::Random {
+
+/// PCG32 generator (XSH-RR variant), as described by [O'Neill](https://www.pcg-random.org/). It is small & fast, and can give several independent
+///   sequences (streams) from the same seed.
+/// It satisfies the standard UniformRandomBitGenerator requirements, & can thus be used with std::shuffle() or the standard distributions; those
+///   are however implementation-defined & may give different results depending on the platform.
+class Pcg32 {
+public:
+  using result_type = uint32_t;
+
+  /// Creates a PCG32 generator.
+  /// \param seed Initial state.
+  /// \param stream Index of the sequence to be generated; generators created with the same seed but different streams give uncorrelated values.
+  explicit Pcg32(uint64_t seed = 0x853C49E6748FEA9Bull, uint64_t stream = 0xDA3E39CB94B95BDBull) noexcept;
+
+  static constexpr result_type min() noexcept { return std::numeric_limits<result_type>::min(); }
+  static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+  /// Generates an integer below the given bound, without any bias.
+  /// \param bound Exclusive upper bound. Must be strictly positive.
+  /// \return Generated integer, in [0; bound[.
+  uint32_t generateBounded(uint32_t bound) noexcept;
+  /// Generates a float uniformly distributed in [0; 1[, with a precision of 2^-24.
+  /// \return Generated float.
+  float generateFloat() noexcept { return static_cast<float>((*this)() >> 8) * 0x1p-24f; }
+  /// Advances the generator as if the given number of values had been generated, in logarithmic time.
+  /// \param delta Number of values to skip.
+  void advance(uint64_t delta) noexcept;
+
+  /// Generates a 32-bit integer.
+  /// \return Generated integer.
+  result_type operator()() noexcept;
+
+private:
+  uint64_t m_state {};
+  uint64_t m_increment {};
+};
+
+/// Xoshiro256** generator, as described by [Blackman & Vigna](https://prng.di.unimi.it/). It has a large period (2^256 - 1), & can jump ahead
+///   in its sequence to give non-overlapping streams, for example one per thread.
+/// It satisfies the standard UniformRandomBitGenerator requirements, & can thus be used with std::shuffle() or the standard distributions; those
+///   are however implementation-defined & may give different results depending on the platform.
+class Xoshiro256 {
+public:
+  using result_type = uint64_t;
+
+  /// Creates a xoshiro256** generator, its state being initialized from the given seed with SplitMix64.
+  /// \param seed Seed to initialize the generator with.
+  explicit Xoshiro256(uint64_t seed = 0) noexcept;
+  /// Creates a xoshiro256** generator from its state.
+  /// \param state State of the generator. Must not be entirely null.
+  explicit Xoshiro256(const std::array<uint64_t, 4>& state) noexcept;
+
+  static constexpr result_type min() noexcept { return std::numeric_limits<result_type>::min(); }
+  static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+  const std::array<uint64_t, 4>& getState() const noexcept { return m_state; }
+
+  /// Generates a float uniformly distributed in [0; 1[, with a precision of 2^-24.
+  /// \return Generated float.
+  float generateFloat() noexcept { return static_cast<float>((*this)() >> 40) * 0x1p-24f; }
+  /// Advances the generator by 2^128 values. Successive jumps give 2^128 non-overlapping sequences of 2^128 values.
+  void jump() noexcept;
+  /// Advances the generator by 2^192 values. Successive long jumps give 2^64 non-overlapping sequences of 2^192 values, each of which can be
+  ///   subdivided with jump().
+  void longJump() noexcept;
+
+  /// Generates a 64-bit integer.
+  /// \return Generated integer.
+  result_type operator()() noexcept;
+
+private:
+  std::array<uint64_t, 4> m_state {};
+};
+
+/// Set of interleaved xoshiro256** generators, producing large amounts of values at once with SIMD instructions (SSE2, or AVX2 with the RAZ_USE_AVX2
+///   CMake option). Each of its generators (lanes) starts 2^128 values after the previous one.
+/// Values are produced by blocks of BlockSize, each lane giving two consecutive values per block. Generating a number of values that is not a
+///   multiple of the block size discards the rest of the last block; for results to be reproducible, the same counts must thus be requested.
+class BulkGenerator {
+public:
+  static constexpr std::size_t LaneCount = 8;
+  static constexpr std::size_t BlockSize = LaneCount * 2;
+
+  /// Creates a bulk generator.
+  /// \param seed Seed to initialize the first lane with; see Xoshiro256's constructor.
+  explicit BulkGenerator(uint64_t seed = 0) noexcept;
+
+  /// Advances all lanes by 2^192 values. Successive long jumps give non-overlapping bulk generators, for example to be used by different threads.
+  void longJump() noexcept;
+  /// Generates floats uniformly distributed in [0; 1[, with a precision of 2^-24.
+  /// \param values Generated values.
+  /// \param count Number of values to be generated.
+  void generateFloats(float* values, std::size_t count) noexcept;
+  /// Generates unit vectors uniformly distributed on the sphere. Each vector takes two values from the generator.
+  /// \param vectors Generated vectors. Their lengths differ from 1 by less than 1e-6.
+  /// \param count Number of vectors to be generated.
+  void generateUnitVectors(Vec3f* vectors, std::size_t count) noexcept;
+
+private:
+  std::array<uint64_t, 4 * LaneCount> m_states {}; ///< States of all lanes, ordered by state word: [ word0 x 8 lanes; word1 x 8 lanes; ... ].
+};
+
+/// Number of dimensions of the Sobol sequence that can be computed.
+constexpr unsigned int SobolDimensionCount = 8;
+
+/// Computes an element of the Halton sequence (the radical inverse of the index) in the given base.
+/// Using successive prime bases for each dimension gives well distributed multidimensional points.
+/// \param index Index of the element.
+/// \param base Base of the sequence. Must be greater than or equal to 2.
+/// \return Element of the sequence, in [0; 1[.
+float computeHalton(uint32_t index, uint32_t base) noexcept;
+/// Computes an element of the Sobol sequence in the given dimension, using [Joe & Kuo](https://web.maths.unsw.edu.au/~fkuo/sobol/)'s direction numbers.
+/// The first 2^m points of any dimension are stratified in each of the 2^m intervals of size 2^-m; those of the first two dimensions are also
+///   stratified in any 2D grid of 2^m cells of size 2^-a by 2^-b, with a + b = m.
+/// \param index Index of the element.
+/// \param dimension Dimension of the element. Must be lower than SobolDimensionCount.
+/// \param scramble Bits XORed with the element, randomizing the sequence while preserving its stratification.
+/// \return Element of the sequence, in [0; 1[.
+float computeSobol(uint32_t index, unsigned int dimension, uint32_t scramble = 0) noexcept;
+
+/// Generates a square tileable blue noise texture, using [Ulichney](https://doi.org/10.1117/12.152707)'s void-and-cluster method.
+/// Each texel receives a distinct rank, so that thresholding the texture at any value gives evenly spaced points; this is meant to be computed
+///   once for a small tile (with a quadratic complexity), then repeated over the screen to offset sampling kernels.
+/// \param values Generated values, in [0; 1[. Must be able to hold tileSize * tileSize values.
+/// \param tileSize Width & height of the texture. Must be greater than or equal to 4.
+/// \param seed Seed of the generator used to place the initial points.
+void generateBlueNoise(float* values, unsigned int tileSize, uint64_t seed = 0);
+
+} // namespace Raz::Random
+
+#endif // RAZ_RANDOM_HPP
@@ -0,0 +1,75 @@
+#pragma once
+
+#ifndef RAZ_SIMD_HPP
+#define RAZ_SIMD_HPP
+
+#include <cstdint>
+
+/// SIMD kernels used by the 4-wide float math types (Vec4f, Mat4f & Quaternionf). The most advanced instruction set supported by both the build & the
+///   CPU is detected at runtime; the math types only call these kernels outside of compile-time evaluation, their constexpr paths being kept as is.
+/// All kernels give the exact same results as the scalar implementations, the operations being made in the same order & without any fused multiply-add.
+namespace Raz::Simd {
+
+enum class InstructionSet : uint8_t {
+  SCALAR, ///< No SIMD instruction, used as a fallback.
+  SSE4_1, ///< 128-bit x86 instructions, up to SSE4.1.
+  AVX2,   ///< 256-bit x86 instructions, up to AVX2.
+  NEON    ///< 128-bit ARM instructions.
+};
+
+/// Checks if the function is being evaluated at compile-time.
+/// \note If the compiler does not allow to check it, this is always considered to be the case, the scalar paths thus always being used.
+/// \return True if the evaluation is made at compile-time, false otherwise.
+constexpr bool isConstantEvaluated() noexcept {
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+  return __builtin_is_constant_evaluated();
+#else
+  return true;
+#endif
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+  return __builtin_is_constant_evaluated();
+#else
+  return true;
+#endif
+}
+
+/// Checks if an instruction set can be used, being supported by both the build & the CPU.
+/// \param instructionSet Instruction set to be checked.
+/// \return True if the instruction set can be used, false otherwise.
+bool isSupported(InstructionSet instructionSet) noexcept;
+/// Detects the most advanced instruction set supported by both the build & the CPU.
+/// \return Most advanced available instruction set.
+InstructionSet detectInstructionSet() noexcept;
+/// Gets the instruction set currently used by the kernels, which is by default the detected one.
+/// \return Instruction set in use.
+InstructionSet getInstructionSet() noexcept;
+/// Sets the instruction set to be used by the kernels; mostly useful for testing & benchmarking purposes.
+/// \note This must not be called while computations are made in other threads.
+/// \param instructionSet Instruction set to be used. Must be supported.
+void setInstructionSet(InstructionSet instructionSet);
+
+/// Multiplies two row-major 4x4 matrices.
+/// \param lhs Left-hand side matrix's 16 values.
+/// \param rhs Right-hand side matrix's 16 values.
+/// \param res Resulting matrix's 16 values. Must not overlap with any of the operands.
+void multiplyMat4(const float* lhs, const float* rhs, float* res) noexcept;
+/// Multiplies a row-major 4x4 matrix by a column vector.
+/// \param mat Matrix's 16 values.
+/// \param vec Vector's 4 values.
+/// \param res Resulting vector's 4 values. Must not overlap with any of the operands.
+void multiplyMat4Vec4(const float* mat, const float* vec, float* res) noexcept;
+/// Multiplies a row vector by a row-major 4x4 matrix.
+/// \param vec Vector's 4 values.
+/// \param mat Matrix's 16 values.
+/// \param res Resulting vector's 4 values. Must not overlap with any of the operands.
+void multiplyVec4Mat4(const float* vec, const float* mat, float* res) noexcept;
+/// Multiplies two quaternions (Hamilton product).
+/// \param lhs Left-hand side quaternion's values, ordered as [ w; x; y; z ].
+/// \param rhs Right-hand side quaternion's values, ordered as [ w; x; y; z ].
+/// \param res Resulting quaternion's values, ordered as [ w; x; y; z ]. May overlap with any of the operands.
+void multiplyQuaternions(const float* lhs, const float* rhs, float* res) noexcept;
+
+} // namespace Raz::Simd
+
+#endif // RAZ_SIMD_HPP
@@ -0,0 +1,413 @@
+#pragma once
+
+#ifndef RAZ_SIMDLANES_HPP
+#define RAZ_SIMDLANES_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RAZ_SIMD_LANES_SSE
+#endif
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define RAZ_SIMD_LANES_AVX
+#endif
+
+#if defined(__AVX2__)
+#define RAZ_SIMD_LANES_AVX2
+#endif
+
+/// Lane types used internally by the batched kernels (transforms, culling, noise, fast math, random streams & ray packets), each lane holding
+///   the value of a different element. Every lane type exposes the same operations, so that a kernel is written once for every instruction set.
+/// Unlike the 4-wide kernels of Simd.hpp, which are selected at runtime, the lane types are chosen at compile time:
+///   - SSE lanes are always available on x86-64, SSE2 being part of its baseline;
+///   - AVX & AVX2 lanes require the engine to be compiled for such CPUs, which the RAZ_USE_AVX2 CMake option does. Without it, the 8-wide
+///     operations are made on two SSE halves.
+/// The minimum & maximum are defined as with SSE/AVX (returning the second operand if any is NaN), so that all lane types give identical results.
+/// \note This header is not meant to be included by the engine's users.
+namespace Raz::SimdLanes {
+
+// Float lanes
+
+struct ScalarLanes {
+  using Mask = bool;
+
+  static constexpr std::size_t Size = 1;
+
+  static ScalarLanes load(const float* values) { return ScalarLanes{ *values }; }
+  static ScalarLanes broadcast(float val) { return ScalarLanes{ val }; }
+  void store(float* output) const { *output = value; }
+
+  friend ScalarLanes operator+(ScalarLanes lanes1, ScalarLanes lanes2) { return ScalarLanes{ lanes1.value + lanes2.value }; }
+  friend ScalarLanes operator-(ScalarLanes lanes1, ScalarLanes lanes2) { return ScalarLanes{ lanes1.value - lanes2.value }; }
+  friend ScalarLanes operator*(ScalarLanes lanes1, ScalarLanes lanes2) { return ScalarLanes{ lanes1.value * lanes2.value }; }
+  friend ScalarLanes operator/(ScalarLanes lanes1, ScalarLanes lanes2) { return ScalarLanes{ lanes1.value / lanes2.value }; }
+
+  static ScalarLanes min(ScalarLanes lanes1, ScalarLanes lanes2) { return ScalarLanes{ (lanes1.value < lanes2.value ? lanes1.value : lanes2.value) }; }
+  static ScalarLanes max(ScalarLanes lanes1, ScalarLanes lanes2) { return ScalarLanes{ (lanes1.value > lanes2.value ? lanes1.value : lanes2.value) }; }
+  static ScalarLanes abs(ScalarLanes lanes) { return ScalarLanes{ std::abs(lanes.value) }; }
+  static ScalarLanes floor(ScalarLanes lanes) { return ScalarLanes{ std::floor(lanes.value) }; }
+  static ScalarLanes sqrt(ScalarLanes lanes) { return ScalarLanes{ std::sqrt(lanes.value) }; }
+
+  /// Computes 2^n, n being an integer between -126 & 127.
+  static ScalarLanes computePow2(ScalarLanes exponent) {
+    const uint32_t bits = static_cast<uint32_t>(static_cast<int32_t>(exponent.value) + 127) << 23;
+
+    float res {};
+    std::memcpy(&res, &bits, sizeof(float));
+    return ScalarLanes{ res };
+  }
+
+  /// Splits a positive normal value into a mantissa in [1; 2[ & an unbiased exponent.
+  static void decompose(ScalarLanes lanes, ScalarLanes& mantissa, ScalarLanes& exponent) {
+    uint32_t bits {};
+    std::memcpy(&bits, &lanes.value, sizeof(float));
+
+    const uint32_t mantissaBits = (bits & 0x007FFFFFu) | 0x3F800000u;
+    std::memcpy(&mantissa.value, &mantissaBits, sizeof(float));
+    exponent.value = static_cast<float>(static_cast<int32_t>(bits >> 23) - 127);
+  }
+
+  static Mask less(ScalarLanes lanes1, ScalarLanes lanes2) { return (lanes1.value < lanes2.value); }
+  static Mask lessEqual(ScalarLanes lanes1, ScalarLanes lanes2) { return (lanes1.value <= lanes2.value); }
+  static Mask greater(ScalarLanes lanes1, ScalarLanes lanes2) { return (lanes1.value > lanes2.value); }
+  static Mask greaterEqual(ScalarLanes lanes1, ScalarLanes lanes2) { return (lanes1.value >= lanes2.value); }
+  static Mask equal(ScalarLanes lanes1, ScalarLanes lanes2) { return (lanes1.value == lanes2.value); }
+  static ScalarLanes select(Mask mask, ScalarLanes lanes1, ScalarLanes lanes2) { return (mask ? lanes1 : lanes2); }
+
+  static Mask noMask() { return false; }
+  static Mask maskAnd(Mask mask1, Mask mask2) { return (mask1 && mask2); }
+  static Mask maskOr(Mask mask1, Mask mask2) { return (mask1 || mask2); }
+  /// Converts a mask into bits, the first lane being represented by the lowest bit.
+  static uint32_t toBits(Mask mask) { return (mask ? 1u : 0u); }
+
+  float value;
+};
+
+#if defined(RAZ_SIMD_LANES_SSE)
+struct SseLanes {
+  using Mask = __m128;
+
+  static constexpr std::size_t Size = 4;
+
+  static SseLanes load(const float* values) { return SseLanes{ _mm_loadu_ps(values) }; }
+  static SseLanes broadcast(float val) { return SseLanes{ _mm_set1_ps(val) }; }
+  void store(float* output) const { _mm_storeu_ps(output, value); }
+
+  friend SseLanes operator+(SseLanes lanes1, SseLanes lanes2) { return SseLanes{ _mm_add_ps(lanes1.value, lanes2.value) }; }
+  friend SseLanes operator-(SseLanes lanes1, SseLanes lanes2) { return SseLanes{ _mm_sub_ps(lanes1.value, lanes2.value) }; }
+  friend SseLanes operator*(SseLanes lanes1, SseLanes lanes2) { return SseLanes{ _mm_mul_ps(lanes1.value, lanes2.value) }; }
+  friend SseLanes operator/(SseLanes lanes1, SseLanes lanes2) { return SseLanes{ _mm_div_ps(lanes1.value, lanes2.value) }; }
+
+  static SseLanes min(SseLanes lanes1, SseLanes lanes2) { return SseLanes{ _mm_min_ps(lanes1.value, lanes2.value) }; }
+  static SseLanes max(SseLanes lanes1, SseLanes lanes2) { return SseLanes{ _mm_max_ps(lanes1.value, lanes2.value) }; }
+  static SseLanes abs(SseLanes lanes) { return SseLanes{ _mm_andnot_ps(_mm_set1_ps(-0.f), lanes.value) }; }
+  static SseLanes floor(SseLanes lanes) {
+    // SSE2 has no floor instruction; the value is truncated, then decremented if the truncation rounded it up (for negative values)
+    // This gives the same results as std::floor() for any value representable as a 32-bit integer
+    const __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(lanes.value));
+    return SseLanes{ _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, lanes.value), _mm_set1_ps(1.f))) };
+  }
+  static SseLanes sqrt(SseLanes lanes) { return SseLanes{ _mm_sqrt_ps(lanes.value) }; }
+  static SseLanes estimateRsqrt(SseLanes lanes) { return SseLanes{ _mm_rsqrt_ps(lanes.value) }; }
+
+  static SseLanes computePow2(SseLanes exponent) {
+    const __m128i biasedExponent = _mm_add_epi32(_mm_cvttps_epi32(exponent.value), _mm_set1_epi32(127));
+    return SseLanes{ _mm_castsi128_ps(_mm_slli_epi32(biasedExponent, 23)) };
+  }
+
+  static void decompose(SseLanes lanes, SseLanes& mantissa, SseLanes& exponent) {
+    const __m128i bits = _mm_castps_si128(lanes.value);
+
+    mantissa.value = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+    exponent.value = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+  }
+
+  static Mask less(SseLanes lanes1, SseLanes lanes2) { return _mm_cmplt_ps(lanes1.value, lanes2.value); }
+  static Mask lessEqual(SseLanes lanes1, SseLanes lanes2) { return _mm_cmple_ps(lanes1.value, lanes2.value); }
+  static Mask greater(SseLanes lanes1, SseLanes lanes2) { return _mm_cmpgt_ps(lanes1.value, lanes2.value); }
+  static Mask greaterEqual(SseLanes lanes1, SseLanes lanes2) { return _mm_cmpge_ps(lanes1.value, lanes2.value); }
+  static Mask equal(SseLanes lanes1, SseLanes lanes2) { return _mm_cmpeq_ps(lanes1.value, lanes2.value); }
+  static SseLanes select(Mask mask, SseLanes lanes1, SseLanes lanes2) { return SseLanes{ _mm_or_ps(_mm_and_ps(mask, lanes1.value), _mm_andnot_ps(mask, lanes2.value)) }; }
+
+  static Mask noMask() { return _mm_setzero_ps(); }
+  static Mask maskAnd(Mask mask1, Mask mask2) { return _mm_and_ps(mask1, mask2); }
+  static Mask maskOr(Mask mask1, Mask mask2) { return _mm_or_ps(mask1, mask2); }
+  static uint32_t toBits(Mask mask) { return static_cast<uint32_t>(_mm_movemask_ps(mask)); }
+
+  __m128 value;
+};
+#endif
+
+#if defined(RAZ_SIMD_LANES_AVX)
+struct AvxLanes {
+  using Mask = __m256;
+
+  static constexpr std::size_t Size = 8;
+
+  static AvxLanes load(const float* values) { return AvxLanes{ _mm256_loadu_ps(values) }; }
+  static AvxLanes broadcast(float val) { return AvxLanes{ _mm256_set1_ps(val) }; }
+  void store(float* output) const { _mm256_storeu_ps(output, value); }
+
+  friend AvxLanes operator+(AvxLanes lanes1, AvxLanes lanes2) { return AvxLanes{ _mm256_add_ps(lanes1.value, lanes2.value) }; }
+  friend AvxLanes operator-(AvxLanes lanes1, AvxLanes lanes2) { return AvxLanes{ _mm256_sub_ps(lanes1.value, lanes2.value) }; }
+  friend AvxLanes operator*(AvxLanes lanes1, AvxLanes lanes2) { return AvxLanes{ _mm256_mul_ps(lanes1.value, lanes2.value) }; }
+  friend AvxLanes operator/(AvxLanes lanes1, AvxLanes lanes2) { return AvxLanes{ _mm256_div_ps(lanes1.value, lanes2.value) }; }
+
+  static AvxLanes min(AvxLanes lanes1, AvxLanes lanes2) { return AvxLanes{ _mm256_min_ps(lanes1.value, lanes2.value) }; }
+  static AvxLanes max(AvxLanes lanes1, AvxLanes lanes2) { return AvxLanes{ _mm256_max_ps(lanes1.value, lanes2.value) }; }
+  static AvxLanes abs(AvxLanes lanes) { return AvxLanes{ _mm256_andnot_ps(_mm256_set1_ps(-0.f), lanes.value) }; }
+  static AvxLanes floor(AvxLanes lanes) { return AvxLanes{ _mm256_floor_ps(lanes.value) }; }
+  static AvxLanes sqrt(AvxLanes lanes) { return AvxLanes{ _mm256_sqrt_ps(lanes.value) }; }
+  static AvxLanes estimateRsqrt(AvxLanes lanes) { return AvxLanes{ _mm256_rsqrt_ps(lanes.value) }; }
+
+  // AVX has no 256-bit integer instructions (which came with AVX2); the integer operations are thus made on both 128-bit halves
+
+  static AvxLanes computePow2(AvxLanes exponent) {
+    return combine(SseLanes::computePow2(SseLanes{ getLowHalf(exponent) }).value, SseLanes::computePow2(SseLanes{ getHighHalf(exponent) }).value);
+  }
+
+  static void decompose(AvxLanes lanes, AvxLanes& mantissa, AvxLanes& exponent) {
+    SseLanes lowMantissa {};
+    SseLanes lowExponent {};
+    SseLanes::decompose(SseLanes{ getLowHalf(lanes) }, lowMantissa, lowExponent);
+
+    SseLanes highMantissa {};
+    SseLanes highExponent {};
+    SseLanes::decompose(SseLanes{ getHighHalf(lanes) }, highMantissa, highExponent);
+
+    mantissa = combine(lowMantissa.value, highMantissa.value);
+    exponent = combine(lowExponent.value, highExponent.value);
+  }
+
+  static Mask less(AvxLanes lanes1, AvxLanes lanes2) { return _mm256_cmp_ps(lanes1.value, lanes2.value, _CMP_LT_OQ); }
+  static Mask lessEqual(AvxLanes lanes1, AvxLanes lanes2) { return _mm256_cmp_ps(lanes1.value, lanes2.value, _CMP_LE_OQ); }
+  static Mask greater(AvxLanes lanes1, AvxLanes lanes2) { return _mm256_cmp_ps(lanes1.value, lanes2.value, _CMP_GT_OQ); }
+  static Mask greaterEqual(AvxLanes lanes1, AvxLanes lanes2) { return _mm256_cmp_ps(lanes1.value, lanes2.value, _CMP_GE_OQ); }
+  static Mask equal(AvxLanes lanes1, AvxLanes lanes2) { return _mm256_cmp_ps(lanes1.value, lanes2.value, _CMP_EQ_OQ); }
+  static AvxLanes select(Mask mask, AvxLanes lanes1, AvxLanes lanes2) { return AvxLanes{ _mm256_or_ps(_mm256_and_ps(mask, lanes1.value), _mm256_andnot_ps(mask, lanes2.value)) }; }
+
+  static Mask noMask() { return _mm256_setzero_ps(); }
+  static Mask maskAnd(Mask mask1, Mask mask2) { return _mm256_and_ps(mask1, mask2); }
+  static Mask maskOr(Mask mask1, Mask mask2) { return _mm256_or_ps(mask1, mask2); }
+  static uint32_t toBits(Mask mask) { return static_cast<uint32_t>(_mm256_movemask_ps(mask)); }
+
+  static __m128 getLowHalf(AvxLanes lanes) { return _mm256_castps256_ps128(lanes.value); }
+  static __m128 getHighHalf(AvxLanes lanes) { return _mm256_extractf128_ps(lanes.value, 1); }
+  static AvxLanes combine(__m128 lowHalf, __m128 highHalf) { return AvxLanes{ _mm256_insertf128_ps(_mm256_castps128_ps256(lowHalf), highHalf, 1) }; }
+
+  __m256 value;
+};
+#endif
+
+/// Lanes twice as wide as the given ones, every operation being made on both halves. This allows processing 8 values at once with SSE, or any
+///   power of two with scalar lanes.
+/// \tparam HalfT Lane type of each half.
+template <typename HalfT>
+struct DoubleLanes {
+  struct Mask {
+    typename HalfT::Mask low;
+    typename HalfT::Mask high;
+  };
+
+  static constexpr std::size_t Size = HalfT::Size * 2;
+
+  static DoubleLanes load(const float* values) { return DoubleLanes{ HalfT::load(values), HalfT::load(values + HalfT::Size) }; }
+  static DoubleLanes broadcast(float val) { return DoubleLanes{ HalfT::broadcast(val), HalfT::broadcast(val) }; }
+  void store(float* output) const {
+    low.store(output);
+    high.store(output + HalfT::Size);
+  }
+
+  friend DoubleLanes operator+(const DoubleLanes& lanes1, const DoubleLanes& lanes2) {
+    return DoubleLanes{ lanes1.low + lanes2.low, lanes1.high + lanes2.high };
+  }
+  friend DoubleLanes operator-(const DoubleLanes& lanes1, const DoubleLanes& lanes2) {
+    return DoubleLanes{ lanes1.low - lanes2.low, lanes1.high - lanes2.high };
+  }
+  friend DoubleLanes operator*(const DoubleLanes& lanes1, const DoubleLanes& lanes2) {
+    return DoubleLanes{ lanes1.low * lanes2.low, lanes1.high * lanes2.high };
+  }
+  friend DoubleLanes operator/(const DoubleLanes& lanes1, const DoubleLanes& lanes2) {
+    return DoubleLanes{ lanes1.low / lanes2.low, lanes1.high / lanes2.high };
+  }
+
+  static DoubleLanes min(const DoubleLanes& lanes1, const DoubleLanes& lanes2) {
+    return DoubleLanes{ HalfT::min(lanes1.low, lanes2.low), HalfT::min(lanes1.high, lanes2.high) };
+  }
+  static DoubleLanes max(const DoubleLanes& lanes1, const DoubleLanes& lanes2) {
+    return DoubleLanes{ HalfT::max(lanes1.low, lanes2.low), HalfT::max(lanes1.high, lanes2.high) };
+  }
+  static DoubleLanes abs(const DoubleLanes& lanes) { return DoubleLanes{ HalfT::abs(lanes.low), HalfT::abs(lanes.high) }; }
+  static DoubleLanes floor(const DoubleLanes& lanes) { return DoubleLanes{ HalfT::floor(lanes.low), HalfT::floor(lanes.high) }; }
+  static DoubleLanes sqrt(const DoubleLanes& lanes) { return DoubleLanes{ HalfT::sqrt(lanes.low), HalfT::sqrt(lanes.high) }; }
+
+  static Mask less(const DoubleLanes& lanes1, const DoubleLanes& lanes2) {
+    return Mask{ HalfT::less(lanes1.low, lanes2.low), HalfT::less(lanes1.high, lanes2.high) };
+  }
+  static Mask lessEqual(const DoubleLanes& lanes1, const DoubleLanes& lanes2) {
+    return Mask{ HalfT::lessEqual(lanes1.low, lanes2.low), HalfT::lessEqual(lanes1.high, lanes2.high) };
+  }
+  static Mask greater(const DoubleLanes& lanes1, const DoubleLanes& lanes2) {
+    return Mask{ HalfT::greater(lanes1.low, lanes2.low), HalfT::greater(lanes1.high, lanes2.high) };
+  }
+  static Mask greaterEqual(const DoubleLanes& lanes1, const DoubleLanes& lanes2) {
+    return Mask{ HalfT::greaterEqual(lanes1.low, lanes2.low), HalfT::greaterEqual(lanes1.high, lanes2.high) };
+  }
+  static Mask equal(const DoubleLanes& lanes1, const DoubleLanes& lanes2) {
+    return Mask{ HalfT::equal(lanes1.low, lanes2.low), HalfT::equal(lanes1.high, lanes2.high) };
+  }
+  static DoubleLanes select(const Mask& mask, const DoubleLanes& lanes1, const DoubleLanes& lanes2) {
+    return DoubleLanes{ HalfT::select(mask.low, lanes1.low, lanes2.low), HalfT::select(mask.high, lanes1.high, lanes2.high) };
+  }
+
+  static Mask noMask() { return Mask{ HalfT::noMask(), HalfT::noMask() }; }
+  static Mask maskAnd(const Mask& mask1, const Mask& mask2) {
+    return Mask{ HalfT::maskAnd(mask1.low, mask2.low), HalfT::maskAnd(mask1.high, mask2.high) };
+  }
+  static Mask maskOr(const Mask& mask1, const Mask& mask2) {
+    return Mask{ HalfT::maskOr(mask1.low, mask2.low), HalfT::maskOr(mask1.high, mask2.high) };
+  }
+  static uint32_t toBits(const Mask& mask) { return HalfT::toBits(mask.low) | (HalfT::toBits(mask.high) << HalfT::Size); }
+
+  HalfT low;
+  HalfT high;
+};
+
+template <std::size_t Size>
+struct FloatLanesSelector {
+  static_assert(Size > 1 && (Size & (Size - 1)) == 0, "Error: The number of float lanes must be a power of two.");
+  using Type = DoubleLanes<typename FloatLanesSelector<Size / 2>::Type>;
+};
+
+template <>
+struct FloatLanesSelector<1> {
+  using Type = ScalarLanes;
+};
+
+#if defined(RAZ_SIMD_LANES_SSE)
+template <>
+struct FloatLanesSelector<4> {
+  using Type = SseLanes;
+};
+#endif
+
+#if defined(RAZ_SIMD_LANES_AVX)
+template <>
+struct FloatLanesSelector<8> {
+  using Type = AvxLanes;
+};
+#endif
+
+/// Most efficient float lanes holding the given number of values.
+/// \tparam Size Number of values; must be a power of two.
+template <std::size_t Size>
+using FloatLanes = typename FloatLanesSelector<Size>::Type;
+
+/// Applies a kernel on a range of elements, processing as many of them as possible with the widest available lanes, the remaining ones being
+///   processed one at a time with scalar lanes.
+/// \tparam KernelT Type of the kernel, called with a default-constructed lane object giving its type & the index of the first element to process.
+/// \param beginIndex Index of the first element to process.
+/// \param endIndex Index past the last element to process.
+/// \param kernel Kernel to be applied.
+template <typename KernelT>
+void processLanes(std::size_t beginIndex, std::size_t endIndex, const KernelT& kernel) {
+  std::size_t index = beginIndex;
+
+#if defined(RAZ_SIMD_LANES_AVX)
+  for (; index + AvxLanes::Size <= endIndex; index += AvxLanes::Size)
+    kernel(AvxLanes{}, index);
+#endif
+
+#if defined(RAZ_SIMD_LANES_SSE)
+  for (; index + SseLanes::Size <= endIndex; index += SseLanes::Size)
+    kernel(SseLanes{}, index);
+#endif
+
+  for (; index < endIndex; ++index)
+    kernel(ScalarLanes{}, index);
+}
+
+// 64-bit integer lanes
+
+struct ScalarLanesU64 {
+  static constexpr std::size_t Size = 1;
+
+  static ScalarLanesU64 load(const uint64_t* values) { return ScalarLanesU64{ *values }; }
+  void store(uint64_t* values) const { *values = value; }
+
+  friend ScalarLanesU64 operator+(ScalarLanesU64 lanes1, ScalarLanesU64 lanes2) { return ScalarLanesU64{ lanes1.value + lanes2.value }; }
+  friend ScalarLanesU64 operator^(ScalarLanesU64 lanes1, ScalarLanesU64 lanes2) { return ScalarLanesU64{ lanes1.value ^ lanes2.value }; }
+
+  template <int Shift>
+  static ScalarLanesU64 shiftLeft(ScalarLanesU64 lanes) { return ScalarLanesU64{ lanes.value << Shift }; }
+  template <int Shift>
+  static ScalarLanesU64 rotateLeft(ScalarLanesU64 lanes) { return ScalarLanesU64{ (lanes.value << Shift) | (lanes.value >> (64 - Shift)) }; }
+
+  /// Converts each 64-bit value into two floats in [0; 1[: the lowest 32 bits give the first float & the highest ones the second, each keeping
+  ///   its 24 highest bits.
+  static void storeFloats(ScalarLanesU64 lanes, float* values) {
+    values[0] = static_cast<float>(static_cast<uint32_t>(lanes.value) >> 8) * 0x1p-24f;
+    values[1] = static_cast<float>(lanes.value >> 40) * 0x1p-24f;
+  }
+
+  uint64_t value;
+};
+
+#if defined(RAZ_SIMD_LANES_SSE)
+struct SseLanesU64 {
+  static constexpr std::size_t Size = 2;
+
+  static SseLanesU64 load(const uint64_t* values) { return SseLanesU64{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(values)) }; }
+  void store(uint64_t* values) const { _mm_storeu_si128(reinterpret_cast<__m128i*>(values), value); }
+
+  friend SseLanesU64 operator+(SseLanesU64 lanes1, SseLanesU64 lanes2) { return SseLanesU64{ _mm_add_epi64(lanes1.value, lanes2.value) }; }
+  friend SseLanesU64 operator^(SseLanesU64 lanes1, SseLanesU64 lanes2) { return SseLanesU64{ _mm_xor_si128(lanes1.value, lanes2.value) }; }
+
+  template <int Shift>
+  static SseLanesU64 shiftLeft(SseLanesU64 lanes) { return SseLanesU64{ _mm_slli_epi64(lanes.value, Shift) }; }
+  template <int Shift>
+  static SseLanesU64 rotateLeft(SseLanesU64 lanes) {
+    return SseLanesU64{ _mm_or_si128(_mm_slli_epi64(lanes.value, Shift), _mm_srli_epi64(lanes.value, 64 - Shift)) };
+  }
+
+  static void storeFloats(SseLanesU64 lanes, float* values) {
+    _mm_storeu_ps(values, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(lanes.value, 8)), _mm_set1_ps(0x1p-24f)));
+  }
+
+  __m128i value;
+};
+#endif
+
+#if defined(RAZ_SIMD_LANES_AVX2)
+struct Avx2LanesU64 {
+  static constexpr std::size_t Size = 4;
+
+  static Avx2LanesU64 load(const uint64_t* values) { return Avx2LanesU64{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)) }; }
+  void store(uint64_t* values) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), value); }
+
+  friend Avx2LanesU64 operator+(Avx2LanesU64 lanes1, Avx2LanesU64 lanes2) { return Avx2LanesU64{ _mm256_add_epi64(lanes1.value, lanes2.value) }; }
+  friend Avx2LanesU64 operator^(Avx2LanesU64 lanes1, Avx2LanesU64 lanes2) { return Avx2LanesU64{ _mm256_xor_si256(lanes1.value, lanes2.value) }; }
+
+  template <int Shift>
+  static Avx2LanesU64 shiftLeft(Avx2LanesU64 lanes) { return Avx2LanesU64{ _mm256_slli_epi64(lanes.value, Shift) }; }
+  template <int Shift>
+  static Avx2LanesU64 rotateLeft(Avx2LanesU64 lanes) {
+    return Avx2LanesU64{ _mm256_or_si256(_mm256_slli_epi64(lanes.value, Shift), _mm256_srli_epi64(lanes.value, 64 - Shift)) };
+  }
+
+  static void storeFloats(Avx2LanesU64 lanes, float* values) {
+    _mm256_storeu_ps(values, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(lanes.value, 8)), _mm256_set1_ps(0x1p-24f)));
+  }
+
+  __m256i value;
+};
+#endif
+
+} // namespace Raz::SimdLanes
+
+#endif // RAZ_SIMDLANES_HPP
@@ -4,6 +4,7 @@
 #define RAZ_TRANSFORM_HPP
 
 #include "RaZ/Component.hpp"
+#include "RaZ/Math/Affine.hpp"
 #include "RaZ/Math/Matrix.hpp"
 #include "RaZ/Math/Quaternion.hpp"
 #include "RaZ/Math/Vector.hpp"
@@ -78,10 +79,14 @@ public:
   /// \param reverseTranslation True if the translation should be reversed (negated), false otherwise.
   /// \return Translation matrix.
   Mat4f computeTranslationMatrix(bool reverseTranslation = false) const;
+  /// Computes the affine transformation, combining all three features: translation, rotation & scale.
+  /// It is cheaper to compose & to invert than the equivalent transformation matrix.
+  /// \return Affine transformation.
+  Affine3f computeAffineTransform() const;
   /// Computes the transformation matrix.
   /// This matrix combines all three features: translation, rotation & scale.
   /// \return Transformation matrix.
-  Mat4f computeTransformMatrix() const;
+  Mat4f computeTransformMatrix() const { return computeAffineTransform().computeMatrix(); }
 
 private:
   Vec3f m_position {};
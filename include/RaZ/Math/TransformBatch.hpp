@@ -0,0 +1,179 @@
+#pragma once
+
+#ifndef RAZ_TRANSFORMBATCH_HPP
+#define RAZ_TRANSFORMBATCH_HPP
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Quaternion.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+#include <vector>
+
+namespace Raz {
+
+class AABB;
+class Sphere;
+class Transform;
+
+/// Batch of axis-aligned bounding boxes stored as a structure of arrays.
+struct BoxBatch {
+  std::size_t getCount() const noexcept { return minX.size(); }
+
+  /// Resizes the batch; new boxes are left empty.
+  /// \param count New number of boxes.
+  void resize(std::size_t count);
+  /// Sets a box in the batch.
+  /// \param index Index of the box in the batch.
+  /// \param aabb Box to be set.
+  void setBox(std::size_t index, const AABB& aabb);
+  /// Recovers a box from the batch.
+  /// \param index Index of the box in the batch.
+  /// \return Box at the given index.
+  AABB recoverBox(std::size_t index) const;
+
+  std::vector<float> minX {};
+  std::vector<float> minY {};
+  std::vector<float> minZ {};
+  std::vector<float> maxX {};
+  std::vector<float> maxY {};
+  std::vector<float> maxZ {};
+};
+
+/// Batch of bounding spheres stored as a structure of arrays.
+struct SphereBatch {
+  std::size_t getCount() const noexcept { return radius.size(); }
+
+  /// Resizes the batch; new spheres are left empty.
+  /// \param count New number of spheres.
+  void resize(std::size_t count);
+  /// Sets a sphere in the batch.
+  /// \param index Index of the sphere in the batch.
+  /// \param sphere Sphere to be set.
+  void setSphere(std::size_t index, const Sphere& sphere);
+  /// Recovers a sphere from the batch.
+  /// \param index Index of the sphere in the batch.
+  /// \return Sphere at the given index.
+  Sphere recoverSphere(std::size_t index) const;
+
+  std::vector<float> centerX {};
+  std::vector<float> centerY {};
+  std::vector<float> centerZ {};
+  std::vector<float> radius {};
+};
+
+/// Method used to perform spherical linear interpolations on batches of quaternions.
+enum class SlerpMode {
+  EXACT, ///< Gives the same results as Quaternion::slerp(), computing trigonometric functions for each quaternion.
+  FAST   ///< Uses a polynomial approximation (by David Eberly) computed with SIMD instructions only; the error is below 4e-5 per component.
+};
+
+/// Batch of quaternions stored as a structure of arrays.
+/// The batch operations process several quaternions at once with SIMD instructions (SSE, or AVX with the RAZ_USE_AVX2 CMake option), & are split
+///   across threads for large batches. Unless stated otherwise, they give the exact same results as the equivalent Quaternion functions.
+/// All operations may be given the current batch as result, to be performed in place.
+struct QuaternionBatch {
+  std::size_t getCount() const noexcept { return w.size(); }
+
+  /// Resizes the batch; new quaternions are initialized to identity.
+  /// \param count New number of quaternions.
+  void resize(std::size_t count);
+  /// Sets a quaternion in the batch.
+  /// \param index Index of the quaternion in the batch.
+  /// \param quat Quaternion to be set.
+  void setQuaternion(std::size_t index, const Quaternionf& quat);
+  /// Recovers a quaternion from the batch.
+  /// \param index Index of the quaternion in the batch.
+  /// \return Quaternion at the given index.
+  Quaternionf recoverQuaternion(std::size_t index) const;
+  /// Normalizes all quaternions.
+  /// \param result Normalized quaternions. Resized to hold as many quaternions as the current batch.
+  void normalize(QuaternionBatch& result) const;
+  /// Multiplies each quaternion by the one at the same index in the given batch.
+  /// \param quats Quaternions to be multiplied by. There must be as many as in the current batch.
+  /// \param result Multiplied quaternions. Resized to hold as many quaternions as the current batch.
+  void multiply(const QuaternionBatch& quats, QuaternionBatch& result) const;
+  /// Computes the normalized linear interpolations between each quaternion & the one at the same index in the given batch.
+  /// \param quats Quaternions to be interpolated with. There must be as many as in the current batch.
+  /// \param coeff Coefficient between 0 (returns the normalized current quaternions) and 1 (returns the normalized given quaternions).
+  /// \param result Interpolated quaternions. Resized to hold as many quaternions as the current batch.
+  void nlerp(const QuaternionBatch& quats, float coeff, QuaternionBatch& result) const;
+  /// Computes the normalized linear interpolations between each quaternion & the one at the same index in the given batch.
+  /// \param quats Quaternions to be interpolated with. There must be as many as in the current batch.
+  /// \param coeffs Coefficients between 0 & 1 for each interpolation. There must be as many as quaternions in the current batch.
+  /// \param result Interpolated quaternions. Resized to hold as many quaternions as the current batch.
+  void nlerp(const QuaternionBatch& quats, const std::vector<float>& coeffs, QuaternionBatch& result) const;
+  /// Computes the spherical linear interpolations between each quaternion & the one at the same index in the given batch.
+  /// \note All quaternions must be normalized.
+  /// \param quats Quaternions to be interpolated with. There must be as many as in the current batch.
+  /// \param coeff Coefficient between 0 (returns the current quaternions) and 1 (returns the given quaternions).
+  /// \param result Interpolated quaternions. Resized to hold as many quaternions as the current batch.
+  /// \param mode Interpolation method; the fast one only gives approximate results.
+  void slerp(const QuaternionBatch& quats, float coeff, QuaternionBatch& result, SlerpMode mode = SlerpMode::EXACT) const;
+  /// Computes the spherical linear interpolations between each quaternion & the one at the same index in the given batch.
+  /// \note All quaternions must be normalized.
+  /// \param quats Quaternions to be interpolated with. There must be as many as in the current batch.
+  /// \param coeffs Coefficients between 0 & 1 for each interpolation. There must be as many as quaternions in the current batch.
+  /// \param result Interpolated quaternions. Resized to hold as many quaternions as the current batch.
+  /// \param mode Interpolation method; the fast one only gives approximate results.
+  void slerp(const QuaternionBatch& quats, const std::vector<float>& coeffs, QuaternionBatch& result, SlerpMode mode = SlerpMode::EXACT) const;
+  /// Computes the rotation matrices of all quaternions, giving the same results as Quaternion::computeMatrix().
+  /// \param matrices Computed matrices. Resized to hold as many matrices as there are quaternions.
+  void computeRotationMatrices(std::vector<Mat4f>& matrices) const;
+
+  std::vector<float> w {};
+  std::vector<float> x {};
+  std::vector<float> y {};
+  std::vector<float> z {};
+};
+
+/// Batch of transforms (position, rotation & scale) stored as a structure of arrays.
+/// The batch operations process several objects at once with SIMD instructions (SSE, or AVX with the RAZ_USE_AVX2 CMake option), each lane holding a
+///   different object, and are split across threads for large batches. Any remaining object is processed by a scalar fallback giving the same results.
+struct TransformBatch {
+  std::size_t getCount() const noexcept { return positionX.size(); }
+
+  /// Resizes the batch; new transforms are initialized to identity.
+  /// \param count New number of transforms.
+  void resize(std::size_t count);
+  /// Sets a transform in the batch.
+  /// \param index Index of the transform in the batch.
+  /// \param position Position to be set.
+  /// \param rotation Rotation to be set.
+  /// \param scale Scale to be set.
+  void setTransform(std::size_t index, const Vec3f& position, const Quaternionf& rotation, const Vec3f& scale);
+  /// Sets a transform in the batch.
+  /// \param index Index of the transform in the batch.
+  /// \param transform Transform to be set.
+  void setTransform(std::size_t index, const Transform& transform);
+  /// Computes the transformation matrices of all transforms, giving the same results as Transform::computeTransformMatrix().
+  /// \param matrices Computed matrices. Must be able to hold as many matrices as there are transforms.
+  void computeTransformMatrices(Mat4f* matrices) const;
+  /// Computes the transformation matrices of all transforms, giving the same results as Transform::computeTransformMatrix().
+  /// \param matrices Computed matrices. Resized to hold as many matrices as there are transforms.
+  void computeTransformMatrices(std::vector<Mat4f>& matrices) const;
+  /// Transforms boxes, each by the transform at the same index, using [Arvo's method](https://www.realtimerendering.com/resources/GraphicsGems/gems/TransBox.c).
+  /// The resulting boxes are the tightest axis-aligned ones enclosing the transformed local boxes.
+  /// \param localBoxes Boxes to be transformed. There must be as many as there are transforms.
+  /// \param worldBoxes Transformed boxes. Resized to hold as many boxes as there are transforms.
+  void transformBoxes(const BoxBatch& localBoxes, BoxBatch& worldBoxes) const;
+  /// Transforms bounding spheres, each by the transform at the same index.
+  /// The radius is scaled by the transform's largest scale factor, so that the resulting spheres still enclose the transformed objects.
+  /// \param localSpheres Spheres to be transformed. There must be as many as there are transforms.
+  /// \param worldSpheres Transformed spheres. Resized to hold as many spheres as there are transforms.
+  void transformSpheres(const SphereBatch& localSpheres, SphereBatch& worldSpheres) const;
+
+  std::vector<float> positionX {};
+  std::vector<float> positionY {};
+  std::vector<float> positionZ {};
+  std::vector<float> rotationW {};
+  std::vector<float> rotationX {};
+  std::vector<float> rotationY {};
+  std::vector<float> rotationZ {};
+  std::vector<float> scaleX {};
+  std::vector<float> scaleY {};
+  std::vector<float> scaleZ {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_TRANSFORMBATCH_HPP
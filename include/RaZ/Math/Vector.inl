@@ -1,3 +1,5 @@
+#include "RaZ/Math/FastMath.hpp"
+#include "RaZ/Math/Simd.hpp"
 #include "RaZ/Utils/FloatUtils.hpp"
 
 #include <algorithm>
@@ -97,6 +99,16 @@ constexpr Vector<T, Size> Vector<T, Size>::cross(const Vector& vec) const noexce
 template <typename T, std::size_t Size>
 constexpr Vector<T, Size> Vector<T, Size>::normalize() const noexcept {
   Vector<T, Size> res = *this;
+
+#if defined(RAZ_USE_FAST_MATH)
+  if constexpr (std::is_same_v<T, float>) {
+    if (!Simd::isConstantEvaluated()) {
+      res *= FastMath::rsqrt(computeSquaredLength());
+      return res;
+    }
+  }
+#endif
+
   res /= computeLength();
   return res;
 }
@@ -185,6 +197,13 @@ constexpr Vector<T, Size> Vector<T, Size>::operator*(const Matrix<T, Size, H>& m
   // This multiplication is made assuming the vector to be horizontal
   Vector<T, Size> res {};
 
+  if constexpr (std::is_same_v<T, float> && Size == 4 && H == 4) {
+    if (!Simd::isConstantEvaluated()) {
+      Simd::multiplyVec4Mat4(getDataPtr(), mat.getDataPtr(), res.getDataPtr());
+      return res;
+    }
+  }
+
   for (std::size_t widthIndex = 0; widthIndex < Size; ++widthIndex) {
     for (std::size_t heightIndex = 0; heightIndex < H; ++heightIndex)
       res[widthIndex] += m_data[heightIndex] * mat[heightIndex * Size + widthIndex];
@@ -0,0 +1,100 @@
+#pragma once
+
+#ifndef RAZ_BOUNDINGVOLUMEHIERARCHY_HPP
+#define RAZ_BOUNDINGVOLUMEHIERARCHY_HPP
+
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace Raz {
+
+/// Node of a bounding volume hierarchy, tightly packed to fit two of them in a cache line.
+struct BvhNode {
+  /// Checks if the node is a leaf, that is if it directly holds primitives.
+  /// \return True if the node is a leaf, false otherwise.
+  constexpr bool isLeaf() const noexcept { return (primitiveCount > 0); }
+
+  Vec3f minPos {}; ///< Left bottom back position of the node's bounding box.
+  uint32_t index {}; ///< Index of the node's first primitive if it is a leaf, of its first child otherwise; the second child directly follows the first.
+  Vec3f maxPos {}; ///< Right top front position of the node's bounding box.
+  uint32_t primitiveCount {}; ///< Number of primitives held by the node; 0 if it is an internal node.
+};
+
+/// Bounding volume hierarchy (BVH), a binary tree of axis-aligned bounding boxes used to accelerate spatial queries over a set of primitives.
+/// The tree is built top-down using a binned surface area heuristic (SAH); its upper levels are built in parallel when threads are available.
+class BoundingVolumeHierarchy {
+public:
+  BoundingVolumeHierarchy() = default;
+  explicit BoundingVolumeHierarchy(const std::vector<AABB>& primitiveBoxes) { build(primitiveBoxes); }
+
+  const std::vector<BvhNode>& getNodes() const noexcept { return m_nodes; }
+  /// Gets the indices of the primitives, in the order they are referenced by the leaves.
+  /// \return Primitive indices.
+  const std::vector<uint32_t>& getPrimitiveIndices() const noexcept { return m_primitiveIndices; }
+  std::size_t getPrimitiveCount() const noexcept { return m_primitiveIndices.size(); }
+  bool isEmpty() const noexcept { return m_nodes.empty(); }
+
+  /// Builds the hierarchy from the bounding boxes of the primitives to be stored.
+  /// \param primitiveBoxes Bounding boxes of the primitives. Their index in this list is the one referenced by the hierarchy.
+  void build(const std::vector<AABB>& primitiveBoxes);
+  /// Computes the bounding box of the whole hierarchy.
+  /// \return Root node's bounding box.
+  AABB computeBoundingBox() const;
+  /// Reorders the given primitives so that those of each leaf are contiguous in memory, following the hierarchy's order.
+  /// The primitive indices are then reset so that they directly refer to the reordered primitives.
+  /// \tparam T Type of the primitives.
+  /// \param primitives Primitives to be reordered. There must be as many as given to build the hierarchy.
+  /// \param primitiveStride Number of consecutive elements representing a single primitive (for example 3 for triangles stored as positions).
+  template <typename T>
+  void reorderPrimitives(std::vector<T>& primitives, std::size_t primitiveStride = 1);
+  /// Traverses the hierarchy depth-first, visiting only the nodes accepted by a given predicate.
+  /// \tparam NodeFunc Type of the node predicate.
+  /// \tparam PrimFunc Type of the function called for each primitive.
+  /// \param nodeCheck Predicate taking the minimum & maximum positions of a node's box, returning true if the node must be visited.
+  /// \param primitiveFunc Function called with each primitive index of the visited leaves, returning true to stop the traversal.
+  /// \return True if the traversal has been stopped by the primitive function, false otherwise.
+  template <typename NodeFunc, typename PrimFunc>
+  bool query(NodeFunc&& nodeCheck, PrimFunc&& primitiveFunc) const;
+  /// Traverses the hierarchy along a ray, visiting the closest nodes first & skipping those further than the current maximum distance.
+  /// \tparam PrimFunc Type of the function called for each primitive.
+  /// \param ray Ray to traverse the hierarchy with.
+  /// \param maxDistance Maximum distance along the ray. Can be lowered by the primitive function as closer hits are found.
+  /// \param primitiveFunc Function called with each primitive index of the visited leaves & the maximum distance, returning true to stop the traversal.
+  /// \return True if the traversal has been stopped by the primitive function, false otherwise.
+  template <typename PrimFunc>
+  bool raycast(const Ray& ray, float& maxDistance, PrimFunc&& primitiveFunc) const;
+  /// Traverses the hierarchy along the path of a sphere moving along a ray, visiting the closest nodes first.
+  /// The nodes are enlarged by the sphere's radius, so that all those the sphere may touch along its path are visited.
+  /// \tparam PrimFunc Type of the function called for each primitive.
+  /// \param ray Ray followed by the sphere's center.
+  /// \param radius Radius of the sphere.
+  /// \param maxDistance Maximum distance travelled by the sphere. Can be lowered by the primitive function as closer hits are found.
+  /// \param primitiveFunc Function called with each primitive index of the visited leaves & the maximum distance, returning true to stop the traversal.
+  /// \return True if the traversal has been stopped by the primitive function, false otherwise.
+  template <typename PrimFunc>
+  bool sphereCast(const Ray& ray, float radius, float& maxDistance, PrimFunc&& primitiveFunc) const;
+  /// Writes the hierarchy in binary form into a stream.
+  /// \param stream Stream to write the hierarchy into.
+  void save(std::ostream& stream) const;
+  /// Reads a hierarchy in binary form from a stream.
+  /// \param stream Stream to read the hierarchy from. It must be seekable, the stored counts being checked against its size before reading.
+  /// \return True if a valid hierarchy has been read, false otherwise.
+  bool load(std::istream& stream);
+
+private:
+  template <typename PrimFunc>
+  bool traverseAlongRay(const Ray& ray, float nodeMargin, float& maxDistance, PrimFunc&& primitiveFunc) const;
+
+  std::vector<BvhNode> m_nodes {};
+  std::vector<uint32_t> m_primitiveIndices {};
+};
+
+} // namespace Raz
+
+#include "RaZ/Physics/BoundingVolumeHierarchy.inl"
+
+#endif // RAZ_BOUNDINGVOLUMEHIERARCHY_HPP
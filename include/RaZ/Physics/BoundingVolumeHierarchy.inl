@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <array>
+
+namespace Raz {
+
+namespace BvhDetails {
+
+/// Maximum depth of a hierarchy, which is also the size of the traversal stacks.
+constexpr std::size_t MaxDepth = 64;
+
+/// Computes the distance at which a ray enters a node's box.
+/// \param node Node to be checked.
+/// \param origin Ray's origin.
+/// \param invDirection Ray's inverse direction.
+/// \param maxDistance Maximum distance along the ray.
+/// \param margin Distance by which the box is enlarged on every side.
+/// \return Entry distance if the ray hits the box before the maximum distance, infinity otherwise.
+inline float computeNodeEntryDistance(const BvhNode& node, const Vec3f& origin, const Vec3f& invDirection, float maxDistance, float margin = 0.f) noexcept {
+  const Vec3f minDist = (node.minPos - margin - origin) * invDirection;
+  const Vec3f maxDist = (node.maxPos + margin - origin) * invDirection;
+
+  const float entryDist = std::max(std::max(std::min(minDist[0], maxDist[0]), std::min(minDist[1], maxDist[1])),
+                                   std::max(std::min(minDist[2], maxDist[2]), 0.f));
+  const float exitDist  = std::min(std::min(std::max(minDist[0], maxDist[0]), std::max(minDist[1], maxDist[1])),
+                                   std::min(std::max(minDist[2], maxDist[2]), maxDistance));
+
+  return (entryDist <= exitDist ? entryDist : std::numeric_limits<float>::infinity());
+}
+
+} // namespace BvhDetails
+
+template <typename T>
+void BoundingVolumeHierarchy::reorderPrimitives(std::vector<T>& primitives, std::size_t primitiveStride) {
+  assert("Error: The number of primitives to be reordered must match the hierarchy's." && primitives.size() == m_primitiveIndices.size() * primitiveStride);
+
+  std::vector<T> reorderedPrimitives;
+  reorderedPrimitives.reserve(primitives.size());
+
+  for (uint32_t& primIndex : m_primitiveIndices) {
+    const auto primBegin = primitives.begin() + static_cast<std::ptrdiff_t>(primIndex * primitiveStride);
+    reorderedPrimitives.insert(reorderedPrimitives.end(), std::make_move_iterator(primBegin),
+                                                          std::make_move_iterator(primBegin + static_cast<std::ptrdiff_t>(primitiveStride)));
+  }
+
+  primitives = std::move(reorderedPrimitives);
+
+  for (std::size_t primIndex = 0; primIndex < m_primitiveIndices.size(); ++primIndex)
+    m_primitiveIndices[primIndex] = static_cast<uint32_t>(primIndex);
+}
+
+template <typename NodeFunc, typename PrimFunc>
+bool BoundingVolumeHierarchy::query(NodeFunc&& nodeCheck, PrimFunc&& primitiveFunc) const {
+  if (m_nodes.empty())
+    return false;
+
+  std::array<uint32_t, BvhDetails::MaxDepth> nodeStack {};
+  std::size_t stackSize = 0;
+  nodeStack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const BvhNode& node = m_nodes[nodeStack[--stackSize]];
+
+    if (!nodeCheck(node.minPos, node.maxPos))
+      continue;
+
+    if (!node.isLeaf()) {
+      nodeStack[stackSize++] = node.index + 1;
+      nodeStack[stackSize++] = node.index;
+      continue;
+    }
+
+    for (uint32_t primIndex = node.index; primIndex < node.index + node.primitiveCount; ++primIndex) {
+      if (primitiveFunc(m_primitiveIndices[primIndex]))
+        return true;
+    }
+  }
+
+  return false;
+}
+
+template <typename PrimFunc>
+bool BoundingVolumeHierarchy::raycast(const Ray& ray, float& maxDistance, PrimFunc&& primitiveFunc) const {
+  return traverseAlongRay(ray, 0.f, maxDistance, std::forward<PrimFunc>(primitiveFunc));
+}
+
+template <typename PrimFunc>
+bool BoundingVolumeHierarchy::sphereCast(const Ray& ray, float radius, float& maxDistance, PrimFunc&& primitiveFunc) const {
+  assert("Error: The radius of a sphere cast can't be negative." && radius >= 0.f);
+  return traverseAlongRay(ray, radius, maxDistance, std::forward<PrimFunc>(primitiveFunc));
+}
+
+template <typename PrimFunc>
+bool BoundingVolumeHierarchy::traverseAlongRay(const Ray& ray, float nodeMargin, float& maxDistance, PrimFunc&& primitiveFunc) const {
+  if (m_nodes.empty())
+    return false;
+
+  const Vec3f& origin       = ray.getOrigin();
+  const Vec3f& invDirection = ray.getInverseDirection();
+
+  struct StackEntry {
+    uint32_t nodeIndex;
+    float entryDistance;
+  };
+
+  std::array<StackEntry, BvhDetails::MaxDepth> nodeStack {};
+  std::size_t stackSize = 0;
+
+  const float rootDist = BvhDetails::computeNodeEntryDistance(m_nodes.front(), origin, invDirection, maxDistance, nodeMargin);
+  if (rootDist == std::numeric_limits<float>::infinity())
+    return false;
+
+  nodeStack[stackSize++] = StackEntry{ 0, rootDist };
+
+  while (stackSize > 0) {
+    const StackEntry entry = nodeStack[--stackSize];
+
+    // A closer hit may have been found since this node has been pushed
+    if (entry.entryDistance > maxDistance)
+      continue;
+
+    const BvhNode& node = m_nodes[entry.nodeIndex];
+
+    if (node.isLeaf()) {
+      for (uint32_t primIndex = node.index; primIndex < node.index + node.primitiveCount; ++primIndex) {
+        if (primitiveFunc(m_primitiveIndices[primIndex], maxDistance))
+          return true;
+      }
+
+      continue;
+    }
+
+    float firstDist  = BvhDetails::computeNodeEntryDistance(m_nodes[node.index], origin, invDirection, maxDistance, nodeMargin);
+    float secondDist = BvhDetails::computeNodeEntryDistance(m_nodes[node.index + 1], origin, invDirection, maxDistance, nodeMargin);
+    uint32_t firstIndex  = node.index;
+    uint32_t secondIndex = node.index + 1;
+
+    // The closest child is pushed last, so that it is visited first
+    if (firstDist > secondDist) {
+      std::swap(firstDist, secondDist);
+      std::swap(firstIndex, secondIndex);
+    }
+
+    if (secondDist != std::numeric_limits<float>::infinity())
+      nodeStack[stackSize++] = StackEntry{ secondIndex, secondDist };
+
+    if (firstDist != std::numeric_limits<float>::infinity())
+      nodeStack[stackSize++] = StackEntry{ firstIndex, firstDist };
+  }
+
+  return false;
+}
+
+} // namespace Raz
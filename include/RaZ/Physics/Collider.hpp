@@ -6,32 +6,64 @@
 #include "RaZ/Component.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
+#include <cstdint>
+#include <variant>
+
 namespace Raz {
 
+/// Shape stored inline by a collider. The alternatives must be declared in the same order as the ShapeType enumeration.
+using ColliderShape = std::variant<Line, Plane, Sphere, Triangle, Quad, AABB, OBB>;
+
 class Collider final : public Component {
 public:
-  explicit Collider(Shape&& shape) { setShape(std::move(shape)); }
+  explicit Collider(Shape&& shape);
   Collider(const Collider&) = delete;
   Collider(Collider&&) noexcept = default;
 
-  ShapeType getShapeType() const noexcept { return m_shapeType; }
-  const Shape& getShape() const noexcept { assert("Error: No collider shape defined." && m_colliderShape); return *m_colliderShape; }
-  Shape& getShape() noexcept { assert("Error: No collider shape defined." && m_colliderShape); return *m_colliderShape; }
+  ShapeType getShapeType() const noexcept { return static_cast<ShapeType>(m_shape.index()); }
+  const Shape& getShape() const noexcept { return std::visit([] (const auto& shape) noexcept -> const Shape& { return shape; }, m_shape); }
+  Shape& getShape() noexcept { return const_cast<Shape&>(static_cast<const Collider*>(this)->getShape()); }
   template <typename ShapeT> const ShapeT& getShape() const noexcept;
   template <typename ShapeT> ShapeT& getShape() noexcept { return const_cast<ShapeT&>(static_cast<const Collider*>(this)->getShape<ShapeT>()); }
+  const ColliderShape& getColliderShape() const noexcept { return m_shape; }
+  uint32_t getLayerMask() const noexcept { return m_layerMask; }
 
   void setShape(Shape&& shape);
+  /// Sets the layers the collider belongs to, each bit representing a layer. Physics queries only consider colliders belonging to any of their requested layers.
+  /// \param layerMask Bitmask of the collider's layers.
+  void setLayerMask(uint32_t layerMask) noexcept { m_layerMask = layerMask; }
 
-  bool intersects(const Collider& collider) const { return intersects(*collider.m_colliderShape); }
+  /// Collider-collider intersection check.
+  /// \note The concrete shapes' intersection function is directly fetched from a precomputed table indexed by both shapes' types, thus avoiding any virtual call.
+  /// \param collider Collider to check if there is an intersection with.
+  /// \return True if both colliders intersect each other, false otherwise.
+  bool intersects(const Collider& collider) const;
   bool intersects(const Shape& shape) const;
   bool intersects(const Ray& ray, RayHit* hit = nullptr) const;
+  /// Computes the axis-aligned bounding box of the collider's shape, directly calling the concrete shape's function.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const;
+  /// Sphere cast against the collider's shape, finding the first point touched by a sphere moving along a ray.
+  /// \param ray Ray followed by the sphere's center.
+  /// \param radius Radius of the sphere.
+  /// \param hit Optional information of the first contact (nullptr if unneeded).
+  /// \param maxDistance Maximum distance the sphere can travel.
+  /// \return True if the sphere touches the shape, false otherwise.
+  bool sphereCast(const Ray& ray, float radius, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Box cast against the collider's shape, finding the first point touched by an axis-aligned box moving along a ray.
+  /// \param ray Ray followed by the box's center.
+  /// \param halfExtents Half extents of the box.
+  /// \param hit Optional information of the first contact (nullptr if unneeded).
+  /// \param maxDistance Maximum distance the box can travel.
+  /// \return True if the box touches the shape, false otherwise.
+  bool boxCast(const Ray& ray, const Vec3f& halfExtents, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max()) const;
 
   Collider& operator=(const Collider&) = delete;
   Collider& operator=(Collider&&) noexcept = default;
 
 private:
-  ShapeType m_shapeType {};
-  std::unique_ptr<Shape> m_colliderShape {};
+  ColliderShape m_shape;
+  uint32_t m_layerMask = 1; ///< Layers the collider belongs to; only the first one by default.
 };
 
 } // namespace Raz
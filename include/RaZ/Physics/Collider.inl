@@ -4,9 +4,9 @@ template <typename ShapeT>
 const ShapeT& Collider::getShape() const noexcept {
   static_assert(std::is_base_of_v<Shape, ShapeT>, "Error: Fetched collider shape type must be derived from Shape.");
   static_assert(!std::is_same_v<Shape, ShapeT>, "Error: Fetched collider shape type must not be of specific type 'Shape'.");
-  assert("Error: Invalid collider shape type." && dynamic_cast<const ShapeT*>(m_colliderShape.get()));
+  assert("Error: Invalid collider shape type." && std::holds_alternative<ShapeT>(m_shape));
 
-  return static_cast<const ShapeT&>(getShape());
+  return *std::get_if<ShapeT>(&m_shape);
 }
 
 } // namespace Raz
@@ -0,0 +1,109 @@
+#pragma once
+
+#ifndef RAZ_MESHCOLLIDER_HPP
+#define RAZ_MESHCOLLIDER_HPP
+
+#include "RaZ/Component.hpp"
+#include "RaZ/Physics/BoundingVolumeHierarchy.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+class FilePath;
+class Mesh;
+class Submesh;
+struct Vertex;
+
+/// Collider made of the triangles of a mesh, meant to represent static geometry.
+/// The triangles are stored in a bounding volume hierarchy, allowing queries to only check those located near the tested shape.
+class MeshCollider final : public Component {
+public:
+  /// Creates a mesh collider from all the triangles of a mesh.
+  /// \param mesh Mesh to recover the triangles from.
+  explicit MeshCollider(const Mesh& mesh);
+  /// Creates a mesh collider from all the triangles of a mesh, using a cache file to avoid rebuilding its hierarchy.
+  /// If the cache exists & has been created from the same triangles, the hierarchy is loaded from it; otherwise, it is built & the cache is (re)written.
+  /// \param mesh Mesh to recover the triangles from.
+  /// \param cacheFilePath Path to the cache file.
+  MeshCollider(const Mesh& mesh, const FilePath& cacheFilePath);
+  /// Creates a mesh collider from the triangles of a submesh.
+  /// \param submesh Submesh to recover the triangles from.
+  explicit MeshCollider(const Submesh& submesh);
+  /// Creates a mesh collider from vertices & triangle indices.
+  /// \param vertices Vertices of the triangles.
+  /// \param triangleIndices Indices of the vertices, 3 of them representing a triangle.
+  MeshCollider(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& triangleIndices);
+  /// Creates a mesh collider from triangles' positions.
+  /// \param trianglePositions Positions of the triangles, 3 consecutive positions forming a triangle.
+  explicit MeshCollider(std::vector<Vec3f> trianglePositions) : m_trianglePositions{ std::move(trianglePositions) } { initialize(); }
+
+  std::size_t getTriangleCount() const noexcept { return m_trianglePositions.size() / 3; }
+  const BoundingVolumeHierarchy& getHierarchy() const noexcept { return m_hierarchy; }
+  uint32_t getLayerMask() const noexcept { return m_layerMask; }
+
+  /// Sets the layers the collider belongs to, each bit representing a layer. Physics queries only consider colliders belonging to any of their requested layers.
+  /// \param layerMask Bitmask of the collider's layers.
+  void setLayerMask(uint32_t layerMask) noexcept { m_layerMask = layerMask; }
+
+  /// Recovers a triangle of the collider.
+  /// \note The triangles are reordered to follow the hierarchy, and are thus not necessarily in the same order as in the source data.
+  /// \param triangleIndex Index of the triangle to be recovered.
+  /// \return Triangle at the given index.
+  Triangle recoverTriangle(std::size_t triangleIndex) const;
+  /// Computes the bounding box of all the collider's triangles.
+  /// \return Collider's bounding box.
+  AABB computeBoundingBox() const { return m_hierarchy.computeBoundingBox(); }
+  /// Ray-mesh intersection check, finding the closest triangle hit by the ray.
+  /// \param ray Ray to check if there is an intersection with.
+  /// \param hit Optional ray intersection's information to recover (nullptr if unneeded).
+  /// \param maxDistance Maximum distance from the ray's origin at which the hit can be found.
+  /// \return True if the ray intersects the mesh, false otherwise.
+  bool intersects(const Ray& ray, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Sphere cast against the mesh, finding the first triangle touched by a sphere moving along a ray.
+  /// \param ray Ray followed by the sphere's center.
+  /// \param radius Radius of the sphere.
+  /// \param hit Optional information of the first contact (nullptr if unneeded).
+  /// \param maxDistance Maximum distance the sphere can travel.
+  /// \return True if the sphere touches the mesh, false otherwise.
+  bool sphereCast(const Ray& ray, float radius, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Box cast against the mesh, finding the first triangle touched by an axis-aligned box moving along a ray.
+  /// \param ray Ray followed by the box's center.
+  /// \param halfExtents Half extents of the box.
+  /// \param hit Optional information of the first contact (nullptr if unneeded).
+  /// \param maxDistance Maximum distance the box can travel.
+  /// \return True if the box touches the mesh, false otherwise.
+  bool boxCast(const Ray& ray, const Vec3f& halfExtents, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Sphere-mesh intersection check.
+  /// \param sphere Sphere to check if there is an intersection with.
+  /// \return True if the sphere intersects any of the mesh's triangles, false otherwise.
+  bool intersects(const Sphere& sphere) const;
+  /// AABB-mesh intersection check.
+  /// \param aabb AABB to check if there is an intersection with.
+  /// \return True if the box intersects any of the mesh's triangles, false otherwise.
+  bool intersects(const AABB& aabb) const;
+  /// OBB-mesh intersection check.
+  /// \param obb OBB to check if there is an intersection with.
+  /// \return True if the box intersects any of the mesh's triangles, false otherwise.
+  bool intersects(const OBB& obb) const;
+  /// Writes the collider's triangles & hierarchy into a cache file.
+  /// \param cacheFilePath Path to the cache file to write.
+  void saveCache(const FilePath& cacheFilePath) const;
+  /// Loads the collider's hierarchy from a cache file.
+  /// \param cacheFilePath Path to the cache file to load.
+  /// \return True if the cache has been created from the same triangles as the collider's & has been loaded, false otherwise.
+  bool loadCache(const FilePath& cacheFilePath);
+
+private:
+  /// Builds the collider's hierarchy, or loads it from a cache file if given & valid.
+  /// \param cacheFilePath Optional path to the cache file (nullptr if unneeded).
+  void initialize(const FilePath* cacheFilePath = nullptr);
+
+  std::vector<Vec3f> m_trianglePositions {};
+  BoundingVolumeHierarchy m_hierarchy {};
+  uint64_t m_sourceHash {}; ///< Hash of the triangles the collider has been created from, before being reordered.
+  uint32_t m_layerMask = 1; ///< Layers the collider belongs to; only the first one by default.
+};
+
+} // namespace Raz
+
+#endif // RAZ_MESHCOLLIDER_HPP
@@ -5,29 +5,119 @@
 
 #include "RaZ/System.hpp"
 #include "RaZ/Math/Vector.hpp"
+#include "RaZ/Physics/BoundingVolumeHierarchy.hpp"
+#include "RaZ/Utils/Ray.hpp"
+
+#include <cstdint>
 
 namespace Raz {
 
+enum class RaycastMode {
+  CLOSEST, ///< The closest hit along the ray is searched for.
+  ANY      ///< The first hit found is returned, which may not be the closest one; cheaper when only the existence of a hit matters.
+};
+
+/// Parameters of a physics query along a ray.
+struct RaycastParams {
+  float maxDistance    = std::numeric_limits<float>::max(); ///< Maximum distance along the ray at which a hit can be found.
+  RaycastMode mode     = RaycastMode::CLOSEST; ///< Hit to be searched for.
+  uint32_t layerMask   = std::numeric_limits<uint32_t>::max(); ///< Layers to be checked; only colliders belonging to any of them are considered.
+};
+
+/// Volume swept along a ray by the physics queries.
+struct SweptVolume {
+  float radius {}; ///< Radius of the swept sphere, a radius of 0 amounting to a raycast.
+  Vec3f halfExtents {}; ///< Half extents of the swept axis-aligned box. If any of them is strictly positive, the volume is a box & the radius is ignored.
+};
+
 class PhysicsSystem final : public System {
 public:
   PhysicsSystem();
 
   constexpr const Vec3f& getGravity() const noexcept { return m_gravity; }
   constexpr float getFriction() const noexcept { return m_friction; }
+  constexpr float getContinuousCollisionThreshold() const noexcept { return m_continuousCollisionThreshold; }
 
   void setGravity(const Vec3f& gravity) { m_gravity = gravity; }
   void setFriction(float friction) {
     assert("Error: Friction coefficient must be between 0 & 1." && (friction >= 0.f && friction <= 1.f));
     m_friction = friction;
   }
+  /// Sets the fraction of a rigid body's smallest extent beyond which its displacement during a step makes it considered fast-moving.
+  /// Each body's collider is swept along its movement to find the time of impact; fast-moving bodies then keep moving for the rest of the step with
+  ///   their new velocity, their movement being sub-stepped at each impact, while the others stop at the first one.
+  /// \param threshold Fraction of the bodies' smallest extent; the lower, the more bodies are considered fast-moving.
+  void setContinuousCollisionThreshold(float threshold) {
+    assert("Error: The continuous collision threshold can't be negative." && threshold >= 0.f);
+    m_continuousCollisionThreshold = threshold;
+  }
 
   bool step(float deltaTime) override;
+  /// Casts a ray against all the colliders of the system.
+  /// \note The colliders are checked in their entity's space, translated by the entity's position. Line colliders are ignored.
+  /// \param ray Ray to be cast, in world space.
+  /// \param hit Optional information of the hit (nullptr if unneeded). Its position is in world space.
+  /// \param params Parameters of the query.
+  /// \param hitEntity Optional entity which has been hit (nullptr if unneeded).
+  /// \return True if a collider has been hit, false otherwise.
+  bool raycast(const Ray& ray, RayHit* hit = nullptr, const RaycastParams& params = {}, Entity** hitEntity = nullptr);
+  /// Casts several rays against all the colliders of the system; the rays are processed in parallel when there are enough of them.
+  /// \param rays Rays to be cast, in world space.
+  /// \param hits Information of the hits, one for each ray. Resized if needed, so that the same buffer can be reused between calls.
+  ///   Rays having hit nothing are given a default hit, with a distance set to the highest float value.
+  /// \param params Parameters of the queries, common to all rays.
+  /// \param hitEntities Optional entities which have been hit, one for each ray (nullptr if unneeded). Set to nullptr for rays having hit nothing.
+  /// \return Number of rays having hit a collider.
+  std::size_t raycastBatch(const std::vector<Ray>& rays, std::vector<RayHit>& hits, const RaycastParams& params = {},
+                           std::vector<Entity*>* hitEntities = nullptr);
+  /// Casts a sphere along a ray against all the colliders of the system, finding the first one the sphere touches.
+  /// \param ray Ray followed by the sphere's center, in world space.
+  /// \param radius Radius of the sphere.
+  /// \param hit Optional information of the first contact (nullptr if unneeded). Its position is the contact point on the collider, in world space.
+  /// \param params Parameters of the query.
+  /// \param hitEntity Optional entity which has been touched (nullptr if unneeded).
+  /// \return True if a collider has been touched, false otherwise.
+  bool sphereCast(const Ray& ray, float radius, RayHit* hit = nullptr, const RaycastParams& params = {}, Entity** hitEntity = nullptr);
+  /// Casts an axis-aligned box along a ray against all the colliders of the system, finding the first one the box touches.
+  /// \param ray Ray followed by the box's center, in world space.
+  /// \param halfExtents Half extents of the box.
+  /// \param hit Optional information of the first contact (nullptr if unneeded). Its position is in world space.
+  /// \param params Parameters of the query.
+  /// \param hitEntity Optional entity which has been touched (nullptr if unneeded).
+  /// \return True if a collider has been touched, false otherwise.
+  bool boxCast(const Ray& ray, const Vec3f& halfExtents, RayHit* hit = nullptr, const RaycastParams& params = {}, Entity** hitEntity = nullptr);
+  /// Rebuilds the hierarchy of the colliders' bounding boxes used to accelerate the queries.
+  /// This is automatically done after each step or when entities are linked or unlinked; it must however be called manually if colliders
+  ///   have been moved or modified in between, before querying the system.
+  void updateBroadphase();
+
+protected:
+  void linkEntity(const EntityPtr& entity) override;
+  void unlinkEntity(const EntityPtr& entity) override;
 
 private:
-  void solveConstraints();
+  /// Solves the collisions of the rigid bodies, sweeping their collider's volume along their last movement.
+  /// \param deltaTime Time elapsed during the step.
+  void solveConstraints(float deltaTime);
+  /// Casts a volume along a ray against the colliders of the broadphase.
+  /// \param ray Ray to be cast, in world space.
+  /// \param volume Volume swept along the ray.
+  /// \param hit Optional information of the hit (nullptr if unneeded).
+  /// \param params Parameters of the query.
+  /// \param hitEntity Optional entity which has been hit (nullptr if unneeded).
+  /// \param movingEntity Optional entity being moved along the ray. It is ignored, as are the contacts it moves away from.
+  /// \return True if a collider has been hit, false otherwise.
+  bool castAlongRay(const Ray& ray, const SweptVolume& volume, RayHit* hit, const RaycastParams& params, Entity** hitEntity,
+                    const Entity* movingEntity = nullptr) const;
 
   Vec3f m_gravity  = Vec3f(0.f, -9.80665f, 0.f); ///< Gravity force.
   float m_friction = 0.95f; ///< Friction coefficient.
+  float m_continuousCollisionThreshold = 0.5f; ///< Fraction of a rigid body's smallest extent beyond which its displacement is sub-stepped.
+
+  BoundingVolumeHierarchy m_broadphase {}; ///< Hierarchy of the bounded colliders' world-space boxes.
+  std::vector<Entity*> m_broadphaseEntities {}; ///< Entities referenced by the broadphase's primitives.
+  std::vector<Entity*> m_unboundedEntities {}; ///< Entities whose collider can't be bounded (planes), always checked.
+  bool m_isBroadphaseDirty = true;
 };
 
 } // namespace Raz
@@ -22,6 +22,11 @@ public:
   constexpr float getBounciness() const noexcept { return m_bounciness; }
   constexpr const Vec3f& getForces() const noexcept { return m_forces; }
   constexpr const Vec3f& getVelocity() const noexcept { return m_velocity; }
+  /// Checks if the rigid body has moved fast enough during the last physics step to have its collisions solved continuously, that is by sub-stepping
+  ///   its movement at each time of impact.
+  /// \see PhysicsSystem::setContinuousCollisionThreshold()
+  /// \return True if the rigid body is considered fast-moving, false otherwise.
+  constexpr bool isFastMoving() const noexcept { return m_isFastMoving; }
 
   constexpr void setMass(float mass) noexcept { m_mass = mass; }
   constexpr void setBounciness(float bounciness) noexcept {
@@ -40,6 +45,7 @@ private:
   Vec3f m_forces {}; ///< Forces applied to the rigid body.
   Vec3f m_velocity {}; ///< Velocity of the rigid body.
   Vec3f m_oldPosition {}; ///< Previous position of the rigid body.
+  bool m_isFastMoving = false; ///< Whether the rigid body's last displacement has exceeded the physics system's continuous collision threshold.
 };
 
 } // namespace Raz
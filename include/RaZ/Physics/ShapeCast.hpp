@@ -0,0 +1,140 @@
+#pragma once
+
+#ifndef RAZ_SHAPECAST_HPP
+#define RAZ_SHAPECAST_HPP
+
+#include "RaZ/Utils/Ray.hpp"
+
+#include <limits>
+
+namespace Raz {
+
+/// Shape casts, sweeping a volume along a ray & finding the first point at which it touches a given shape.
+/// In all of them, the returned hit holds:
+/// - the distance travelled by the swept volume's center until the first contact, which is the time of impact for a volume moving at unit speed;
+/// - the contact point, located on the tested shape for sphere casts, and on the swept box's touching side for box casts;
+/// - the contact normal, oriented from the tested shape towards the swept volume.
+/// If the volume already overlaps the shape at the ray's origin, the hit distance is 0.
+namespace ShapeCast {
+
+/// Sphere-line cast, equivalent to a ray-capsule intersection check.
+/// \param ray Ray followed by the sphere's center.
+/// \param radius Radius of the sphere.
+/// \param line Line to be checked.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \param maxDistance Maximum distance the sphere can travel.
+/// \return True if the sphere touches the line before the maximum distance, false otherwise.
+bool sphereCast(const Ray& ray, float radius, const Line& line, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+/// Sphere-plane cast.
+/// \note As with a ray-plane intersection check, the plane can only be touched from its front side.
+/// \param ray Ray followed by the sphere's center.
+/// \param radius Radius of the sphere.
+/// \param plane Plane to be checked.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \param maxDistance Maximum distance the sphere can travel.
+/// \return True if the sphere touches the plane before the maximum distance, false otherwise.
+bool sphereCast(const Ray& ray, float radius, const Plane& plane, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+/// Sphere-sphere cast.
+/// \param ray Ray followed by the sphere's center.
+/// \param radius Radius of the sphere.
+/// \param sphere Sphere to be checked.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \param maxDistance Maximum distance the sphere can travel.
+/// \return True if the sphere touches the other before the maximum distance, false otherwise.
+bool sphereCast(const Ray& ray, float radius, const Sphere& sphere, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+/// Sphere-triangle cast.
+/// \param ray Ray followed by the sphere's center.
+/// \param radius Radius of the sphere.
+/// \param triangle Triangle to be checked.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \param maxDistance Maximum distance the sphere can travel.
+/// \return True if the sphere touches the triangle before the maximum distance, false otherwise.
+bool sphereCast(const Ray& ray, float radius, const Triangle& triangle, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+/// Sphere-quad cast.
+/// \param ray Ray followed by the sphere's center.
+/// \param radius Radius of the sphere.
+/// \param quad Quad to be checked, as the two triangles it is made of.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \param maxDistance Maximum distance the sphere can travel.
+/// \return True if the sphere touches the quad before the maximum distance, false otherwise.
+bool sphereCast(const Ray& ray, float radius, const Quad& quad, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+/// Sphere-AABB cast.
+/// \param ray Ray followed by the sphere's center.
+/// \param radius Radius of the sphere.
+/// \param aabb AABB to be checked.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \param maxDistance Maximum distance the sphere can travel.
+/// \return True if the sphere touches the box before the maximum distance, false otherwise.
+bool sphereCast(const Ray& ray, float radius, const AABB& aabb, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+/// Sphere-OBB cast.
+/// \param ray Ray followed by the sphere's center.
+/// \param radius Radius of the sphere.
+/// \param obb OBB to be checked.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \param maxDistance Maximum distance the sphere can travel.
+/// \return True if the sphere touches the box before the maximum distance, false otherwise.
+bool sphereCast(const Ray& ray, float radius, const OBB& obb, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+
+/// Box-line cast.
+/// \param ray Ray followed by the box's center.
+/// \param halfExtents Half extents of the axis-aligned box.
+/// \param line Line to be checked.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \param maxDistance Maximum distance the box can travel.
+/// \return True if the box touches the line before the maximum distance, false otherwise.
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const Line& line, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+/// Box-plane cast.
+/// \note As with a ray-plane intersection check, the plane can only be touched from its front side.
+/// \param ray Ray followed by the box's center.
+/// \param halfExtents Half extents of the axis-aligned box.
+/// \param plane Plane to be checked.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \param maxDistance Maximum distance the box can travel.
+/// \return True if the box touches the plane before the maximum distance, false otherwise.
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const Plane& plane, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+/// Box-sphere cast.
+/// \param ray Ray followed by the box's center.
+/// \param halfExtents Half extents of the axis-aligned box.
+/// \param sphere Sphere to be checked.
+/// \param hit Optional information of the first contact (nullptr if unneeded). Its position is located on the sphere.
+/// \param maxDistance Maximum distance the box can travel.
+/// \return True if the box touches the sphere before the maximum distance, false otherwise.
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const Sphere& sphere, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+/// Box-triangle cast.
+/// \param ray Ray followed by the box's center.
+/// \param halfExtents Half extents of the axis-aligned box.
+/// \param triangle Triangle to be checked.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \param maxDistance Maximum distance the box can travel.
+/// \return True if the box touches the triangle before the maximum distance, false otherwise.
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const Triangle& triangle, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+/// Box-quad cast.
+/// \param ray Ray followed by the box's center.
+/// \param halfExtents Half extents of the axis-aligned box.
+/// \param quad Quad to be checked, which must be planar & convex.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \param maxDistance Maximum distance the box can travel.
+/// \return True if the box touches the quad before the maximum distance, false otherwise.
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const Quad& quad, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+/// Box-AABB cast.
+/// \param ray Ray followed by the box's center.
+/// \param halfExtents Half extents of the axis-aligned box.
+/// \param aabb AABB to be checked.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \param maxDistance Maximum distance the box can travel.
+/// \return True if the box touches the other before the maximum distance, false otherwise.
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const AABB& aabb, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+/// Box-OBB cast.
+/// \param ray Ray followed by the box's center.
+/// \param halfExtents Half extents of the axis-aligned box.
+/// \param obb OBB to be checked.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \param maxDistance Maximum distance the box can travel.
+/// \return True if the box touches the oriented one before the maximum distance, false otherwise.
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const OBB& obb, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max());
+
+} // namespace ShapeCast
+
+} // namespace Raz
+
+#endif // RAZ_SHAPECAST_HPP
@@ -14,15 +14,24 @@
 #include "Audio/AudioSystem.hpp"
 #include "Audio/Listener.hpp"
 #include "Audio/Sound.hpp"
+#include "Math/Affine.hpp"
 #include "Math/Angle.hpp"
 #include "Math/Constants.hpp"
+#include "Math/FastMath.hpp"
 #include "Math/Matrix.hpp"
+#include "Math/Packing.hpp"
 #include "Math/Quaternion.hpp"
+#include "Math/Random.hpp"
+#include "Math/Simd.hpp"
 #include "Math/Transform.hpp"
+#include "Math/TransformBatch.hpp"
 #include "Math/Vector.hpp"
+#include "Physics/BoundingVolumeHierarchy.hpp"
 #include "Physics/Collider.hpp"
+#include "Physics/MeshCollider.hpp"
 #include "Physics/PhysicsSystem.hpp"
 #include "Physics/RigidBody.hpp"
+#include "Physics/ShapeCast.hpp"
 #include "Render/Camera.hpp"
 #include "Render/Cubemap.hpp"
 #include "Render/Framebuffer.hpp"
@@ -30,6 +39,10 @@
 #include "Render/Light.hpp"
 #include "Render/Material.hpp"
 #include "Render/Mesh.hpp"
+#include "Render/MeshOptimizer.hpp"
+#include "Render/MeshSimplifier.hpp"
+#include "Render/MeshUtils.hpp"
+#include "Render/MeshletBuilder.hpp"
 #include "Render/Renderer.hpp"
 #include "Render/RenderPass.hpp"
 #include "Render/RenderSystem.hpp"
@@ -38,21 +51,31 @@
 #include "Render/Submesh.hpp"
 #include "Render/Texture.hpp"
 #include "Render/UniformBuffer.hpp"
+#include "Render/VertexLayout.hpp"
+#include "Utils/AssetArchive.hpp"
+#include "Utils/AssetManager.hpp"
 #include "Utils/Bitset.hpp"
 #include "Utils/BvhFormat.hpp"
 #include "Utils/CompilerUtils.hpp"
 #include "Utils/EnumUtils.hpp"
 #include "Utils/FilePath.hpp"
 #include "Utils/FloatUtils.hpp"
+#include "Utils/Frustum.hpp"
 #include "Utils/Graph.hpp"
 #include "Utils/Image.hpp"
+#include "Utils/IndexMap.hpp"
 #include "Utils/Input.hpp"
+#include "Utils/MappedFile.hpp"
 #include "Utils/Overlay.hpp"
 #include "Utils/Ray.hpp"
+#include "Utils/RayPacket.hpp"
+#include "Utils/RazmeshFormat.hpp"
+#include "Utils/RaztexFormat.hpp"
 #include "Utils/Shape.hpp"
 #include "Utils/StrUtils.hpp"
 #include "Utils/Threading.hpp"
 #include "Utils/TypeUtils.hpp"
+#include "Utils/VirtualFileSystem.hpp"
 #include "Utils/Window.hpp"
 
 using namespace Raz::Literals;
@@ -8,6 +8,7 @@
 #include "RaZ/Math/Constants.hpp"
 #include "RaZ/Math/Matrix.hpp"
 #include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Frustum.hpp"
 
 #include <memory>
 
@@ -93,6 +94,9 @@ public:
   /// \param point Point to unproject.
   /// \return Given point in world space.
   Vec3f unproject(const Vec3f& point) const { return Vec3f(unproject(Vec4f(point, 0.f))); }
+  /// Computes the camera's frustum in world space, from its current view & projection matrices.
+  /// \return Camera's frustum.
+  Frustum computeFrustum() const { return Frustum(m_viewMat * m_projMat); }
 
 private:
   float m_frameRatio     = 1.f;
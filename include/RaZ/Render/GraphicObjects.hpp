@@ -4,7 +4,9 @@
 #define RAZ_GRAPHICOBJECTS_HPP
 
 #include "RaZ/Math/Vector.hpp"
+#include "RaZ/Render/VertexLayout.hpp"
 
+#include <limits>
 #include <vector>
 
 namespace Raz {
@@ -24,12 +26,13 @@ struct Vertex {
 
 class VertexArray {
 public:
-  VertexArray();
+  VertexArray() = default;
   VertexArray(const VertexArray&) = delete;
   VertexArray(VertexArray&& vao) noexcept;
 
   unsigned int getIndex() const { return m_index; }
 
+  /// Binds the vertex array, which is only created on the graphics card when first bound.
   void bind() const;
   void unbind() const;
 
@@ -39,19 +42,25 @@ public:
   ~VertexArray();
 
 private:
-  unsigned int m_index {};
+  mutable unsigned int m_index = std::numeric_limits<unsigned int>::max();
 };
 
 class VertexBuffer {
 public:
-  VertexBuffer();
+  VertexBuffer() = default;
   VertexBuffer(const VertexBuffer&) = delete;
   VertexBuffer(VertexBuffer&& vbo) noexcept;
 
   unsigned int getIndex() const { return m_index; }
   const std::vector<Vertex>& getVertices() const { return m_vertices; }
   std::vector<Vertex>& getVertices() { return m_vertices; }
+  const VertexLayout& getLayout() const { return m_layout; }
 
+  /// Sets the format in which the vertices are sent to the graphics card; they must be loaded again for it to be applied.
+  /// \param layout New vertex layout.
+  void setLayout(const VertexLayout& layout) { m_layout = layout; }
+
+  /// Binds the vertex buffer, which is only created on the graphics card when first bound; its data can thus be filled without a graphics context.
   void bind() const;
   void unbind() const;
 
@@ -61,13 +70,14 @@ public:
   ~VertexBuffer();
 
 private:
-  unsigned int m_index {};
+  mutable unsigned int m_index = std::numeric_limits<unsigned int>::max();
   std::vector<Vertex> m_vertices {};
+  VertexLayout m_layout {};
 };
 
 class IndexBuffer {
 public:
-  IndexBuffer();
+  IndexBuffer() = default;
   IndexBuffer(const IndexBuffer&) = delete;
   IndexBuffer(IndexBuffer&& ibo) noexcept;
 
@@ -77,6 +87,7 @@ public:
   const std::vector<unsigned int>& getTriangleIndices() const { return m_triangleIndices; }
   std::vector<unsigned int>& getTriangleIndices() noexcept { return m_triangleIndices; }
 
+  /// Binds the index buffer, which is only created on the graphics card when first bound; its data can thus be filled without a graphics context.
   void bind() const;
   void unbind() const;
 
@@ -86,7 +97,7 @@ public:
   ~IndexBuffer();
 
 private:
-  unsigned int m_index {};
+  mutable unsigned int m_index = std::numeric_limits<unsigned int>::max();
   std::vector<unsigned int> m_lineIndices {};
   std::vector<unsigned int> m_triangleIndices {};
 };
@@ -4,15 +4,24 @@
 #define RAZ_MESH_HPP
 
 #include "RaZ/Component.hpp"
+#include "RaZ/Math/Matrix.hpp"
 #include "RaZ/Render/Material.hpp"
+#include "RaZ/Render/MeshOptimizer.hpp"
+#include "RaZ/Render/MeshSimplifier.hpp"
+#include "RaZ/Render/MeshletBuilder.hpp"
 #include "RaZ/Render/Submesh.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
+#include <functional>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 
 namespace Raz {
 
 class FilePath;
+class Frustum;
 
 enum class SphereMeshType {
   UV = 0, ///< [UV sphere](https://en.wikipedia.org/wiki/UV_mapping).
@@ -22,7 +31,7 @@ enum class SphereMeshType {
 class Mesh final : public Component {
 public:
   Mesh() : m_submeshes(1) { m_materials.emplace_back(MaterialCookTorrance::create()); }
-  explicit Mesh(const FilePath& filePath) { import(filePath); }
+  explicit Mesh(const FilePath& filePath, bool optimizeSubmeshes = false) { import(filePath, optimizeSubmeshes); }
   Mesh(const Plane& plane, float width, float depth, RenderMode renderMode = RenderMode::TRIANGLE);
   /// Creates a mesh from a Sphere.
   /// \param sphere Sphere to create the mesh with.
@@ -47,8 +56,59 @@ public:
   static void drawUnitQuad();
   static void drawUnitCube();
 
-  void import(const FilePath& filePath);
+  /// Imports a mesh from a file, replacing the current submeshes & materials.
+  /// If the path is found in a mounted asset archive (see VirtualFileSystem), the cooked mesh it holds is imported instead of the file.
+  /// \param filePath Path to the mesh to import.
+  /// \param optimizeSubmeshes True to optimize the imported submeshes for rendering (see optimize()), false to keep them as stored in the file.
+  void import(const FilePath& filePath, bool optimizeSubmeshes = false);
+  /// Imports a mesh from a file like import(), but without requiring a graphics context, so that it can be done on any thread.
+  /// The materials are not created, since their textures require one: their images are only decoded, the materials having to be created
+  ///   afterward with createImportedMaterials(), on the thread owning the graphics context.
+  /// \param filePath Path to the mesh to import.
+  /// \param optimizeSubmeshes True to optimize the imported submeshes for rendering (see optimize()), false to keep them as stored in the file.
+  /// \return Imported mesh, without any material until they are created.
+  static Mesh importDeferred(const FilePath& filePath, bool optimizeSubmeshes = false);
+  /// Creates the materials read by importDeferred(), sending their textures to the graphics card. Does nothing if none remains to be created.
+  void createImportedMaterials();
+  /// Optimizes the submeshes for rendering, reordering their triangles for the post-transform vertex cache & to reduce overdraw,
+  ///   & their vertices to be fetched sequentially; see MeshOptimizer::optimize().
+  /// \note The mesh must be loaded again if it already was.
+  /// \param overdrawThreshold Ratio by which the overdraw optimization may degrade the vertex cache efficiency.
+  /// \return Vertex cache efficiency of all the submeshes before & after the optimization.
+  MeshOptimizer::OptimizationStatistics optimize(float overdrawThreshold = MeshOptimizer::defaultOverdrawThreshold);
+  /// Generates levels of detail for all the submeshes in parallel, replacing their existing ones; see MeshSimplifier::generateLods().
+  /// \note The mesh must be loaded again if it already was.
+  /// \param triangleRatios Decreasing ratios of the original triangle count targeted by each level, between 0 & 1.
+  /// \param settings Settings to simplify the submeshes with.
+  void generateLods(const std::vector<float>& triangleRatios = { 0.5f, 0.25f, 0.125f }, const MeshSimplifier::SimplificationSettings& settings = {});
+  /// Selects for each submesh the least detailed level whose error, projected on screen, stays under the given maximum.
+  /// To avoid switching back & forth between two levels when the projected error is around the maximum, a less detailed level is only
+  ///   selected once its error is lower than the maximum by the hysteresis ratio, while a more detailed one is selected as soon as the maximum is exceeded.
+  /// \param modelViewMatrix Matrix transforming the mesh into the view space.
+  /// \param projectionMatrix Matrix of the perspective or orthographic projection.
+  /// \param viewportHeight Height of the viewport in pixels.
+  /// \param maxScreenError Maximum error on screen in pixels.
+  /// \param hysteresis Ratio, between 0 & 1, by which the error must be lower than the maximum to select a less detailed level.
+  void selectLods(const Mat4f& modelViewMatrix, const Mat4f& projectionMatrix, unsigned int viewportHeight,
+                  float maxScreenError = MeshSimplifier::defaultMaxScreenError, float hysteresis = MeshSimplifier::defaultLodHysteresis);
+  /// Builds the meshlets of all the submeshes in parallel, reordering their triangles; see MeshletBuilder::buildMeshlets().
+  /// \note The mesh must be loaded again if it already was.
+  /// \param maxVertexCount Maximum number of distinct vertices referenced by a meshlet.
+  /// \param maxTriangleCount Maximum number of triangles in a meshlet.
+  void buildMeshlets(std::size_t maxVertexCount = MeshletBuilder::defaultMaxVertexCount,
+                     std::size_t maxTriangleCount = MeshletBuilder::defaultMaxTriangleCount);
+  /// Checks if any of the submeshes has meshlets.
+  /// \return True if at least one submesh has been partitioned into meshlets, false otherwise.
+  bool hasMeshlets() const;
+  /// Culls the meshlets of all the submeshes, only the visible ones being drawn afterward; see Submesh::cullMeshlets().
+  /// \param frustum Frustum to cull the meshlets against, in the mesh's space.
+  /// \param viewPosition Optional position of the viewer, in the mesh's space, to cull the backfacing meshlets (nullptr if backfaces are drawn).
+  void cullMeshlets(const Frustum& frustum, const Vec3f* viewPosition = nullptr);
   void setRenderMode(RenderMode renderMode);
+  /// Sets the format in which the vertices of all submeshes are sent to the graphics card; see Submesh::setVertexLayout().
+  /// \note The mesh must be loaded again for the layout to be applied, & be drawn with a shader program decoding it.
+  /// \param layout New vertex layout.
+  void setVertexLayout(const VertexLayout& layout);
   void setMaterial(MaterialPtr material);
   void setMaterial(MaterialPreset materialPreset, float roughnessFactor);
   Submesh& addSubmesh(Submesh submesh = Submesh()) { return m_submeshes.emplace_back(std::move(submesh)); }
@@ -63,6 +123,10 @@ public:
   void save(const FilePath& filePath) const;
 
 private:
+  /// Creates a mesh from the given submeshes, without any material.
+  /// \param submeshes Submeshes of the mesh.
+  explicit Mesh(std::vector<Submesh> submeshes) : m_submeshes{ std::move(submeshes) } {}
+
   /// Creates an UV sphere mesh from a Sphere.
   ///
   ///          /-----------\
@@ -86,16 +150,41 @@ private:
   /// \param subdivCount Amount of subdivisions to apply to the mesh.
   void createIcosphere(const Sphere& sphere, uint32_t subdivCount);
 
-  void importObj(std::ifstream& file, const FilePath& filePath);
+  /// Imports a mesh from a file, replacing the current submeshes & materials; the imported materials are only created by createImportedMaterials().
+  /// \param filePath Path to the mesh to import.
+  /// \param optimizeSubmeshes True to optimize the imported submeshes for rendering, false to keep them as stored in the file.
+  void importData(const FilePath& filePath, bool optimizeSubmeshes);
+  /// Imports a mesh from a file according to its format, the mesh being empty beforehand.
+  /// \param filePath Path to the mesh to import.
+  void importFile(const FilePath& filePath);
+  /// Imports an OBJ file, memory-mapping it & parsing it in parallel parts if large enough.
+  /// \param filePath Path to the OBJ file to import.
+  void importObj(const FilePath& filePath);
   void importOff(std::ifstream& file);
 #if defined(FBX_ENABLED)
   void importFbx(const FilePath& filePath);
 #endif
+  /// Imports the content of a razmesh file, copying its vertices & indices as is.
+  /// \param fileContent Content of the razmesh file, usually memory-mapped.
+  /// \param filePath Path to the razmesh file, from which its material library is found.
+  void importRazmesh(std::string_view fileContent, const FilePath& filePath);
+  /// Imports the materials of an MTL file, decoding their textures' images; they are added to the mesh's ones by createImportedMaterials().
+  /// \param mtlFilePath Path to the MTL file to import.
+  /// \param materialCorrespIndices Correspondences between the imported materials' names & their index, to be filled.
+  void importMtl(const FilePath& mtlFilePath, std::unordered_map<std::string, std::size_t>& materialCorrespIndices);
 
   void saveObj(std::ofstream& file, const FilePath& filePath) const;
+  /// Saves the mesh as a razmesh file, its materials being saved in an MTL file next to it.
+  /// \param file Stream of the razmesh file to save into.
+  /// \param filePath Path to the razmesh file.
+  void saveRazmesh(std::ofstream& file, const FilePath& filePath) const;
+  /// Saves the mesh's materials in an MTL file, each being named after the file followed by its index.
+  /// \param mtlFilePath Path to the MTL file to save.
+  void saveMtl(const FilePath& mtlFilePath) const;
 
   std::vector<Submesh> m_submeshes {};
   std::vector<MaterialPtr> m_materials {};
+  std::vector<std::function<void(Mesh&)>> m_materialCreations {};
   AABB m_boundingBox = AABB(Vec3f(), Vec3f());
 };
 
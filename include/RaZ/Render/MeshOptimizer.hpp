@@ -0,0 +1,84 @@
+#pragma once
+
+#ifndef RAZ_MESHOPTIMIZER_HPP
+#define RAZ_MESHOPTIMIZER_HPP
+
+#include "RaZ/Render/MeshUtils.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Raz {
+
+class Submesh;
+struct Vertex;
+
+namespace MeshOptimizer {
+
+/// Number of entries of the post-transform vertex cache for which the indices are optimized by default.
+constexpr unsigned int defaultCacheSize = 16;
+/// Maximum ratio by which the overdraw optimization may degrade the vertex cache efficiency by default.
+constexpr float defaultOverdrawThreshold = 1.05f;
+
+/// Efficiency of the post-transform vertex cache, simulated as a FIFO.
+struct VertexCacheStatistics {
+  std::size_t transformedVertexCount = 0; ///< Number of vertices transformed, each cache miss requiring a vertex to be processed.
+  std::size_t triangleCount = 0;          ///< Number of triangles drawn.
+  std::size_t vertexCount = 0;            ///< Number of vertices in the vertex buffer.
+  float acmr = 0.f;                       ///< Average cache miss ratio: transformed vertices per triangle, from 3 (no reuse) down to about 0.5.
+  float atvr = 0.f;                       ///< Average transformed vertex ratio: transformed vertices per vertex, 1 being optimal.
+};
+
+/// Vertex cache efficiency before & after an optimization.
+struct OptimizationStatistics {
+  VertexCacheStatistics before {};
+  VertexCacheStatistics after {};
+};
+
+/// Simulates a FIFO post-transform vertex cache to compute the efficiency of the given triangles.
+/// \param indices Triangle indices to be analyzed.
+/// \param vertexCount Number of vertices referenced by the indices.
+/// \param cacheSize Number of entries of the simulated cache.
+/// \return Vertex cache statistics.
+VertexCacheStatistics analyzeVertexCache(const std::vector<unsigned int>& indices, std::size_t vertexCount, unsigned int cacheSize = defaultCacheSize);
+/// Reorders the triangles to reuse the vertices remaining in the post-transform vertex cache as much as possible, following
+///   Tipsify, from Sander et al.'s "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw". Triangles keep their winding order.
+/// \param indices Triangle indices to be reordered.
+/// \param vertexCount Number of vertices referenced by the indices.
+/// \param cacheSize Number of entries of the cache to optimize the indices for; must be at least 3.
+void optimizeVertexCache(std::vector<unsigned int>& indices, std::size_t vertexCount, unsigned int cacheSize = defaultCacheSize);
+/// Reorders clusters of triangles, which must have been optimized for the vertex cache beforehand, so that the ones most likely to occlude
+///   the others are drawn first, whatever the point of view.
+/// The triangles are split into clusters which individually keep a vertex cache efficiency close to the whole mesh's, which are then sorted
+///   according to how much they face outwards the mesh.
+/// \param indices Triangle indices to be reordered.
+/// \param vertices Vertices referenced by the indices.
+/// \param threshold Ratio by which the vertex cache efficiency may be degraded; the higher, the smaller & more numerous the clusters.
+/// \param cacheSize Number of entries of the cache the indices have been optimized for.
+void optimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<Vertex>& vertices,
+                      float threshold = defaultOverdrawThreshold, unsigned int cacheSize = defaultCacheSize);
+/// Reorders the vertices in the order they are first referenced by the indices, so that they are fetched as sequentially as possible.
+/// Vertices which are not referenced are moved at the end, keeping their relative order.
+/// \param vertices Vertices to be reordered.
+/// \param indices Triangle indices to be remapped, all referring to the given vertices.
+/// \return Table remapping each original vertex to its new position, to remap other indices referring to the vertices.
+MeshUtils::VertexRemap optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
+/// Applies all the optimizations to the given vertices & triangle indices: vertex cache, overdraw & vertex fetch.
+/// \param vertices Vertices to be reordered.
+/// \param indices Triangle indices to be optimized, all referring to the given vertices.
+/// \param overdrawThreshold Ratio by which the overdraw optimization may degrade the vertex cache efficiency.
+/// \return Vertex cache efficiency before & after the optimization.
+OptimizationStatistics optimize(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, float overdrawThreshold = defaultOverdrawThreshold);
+/// Applies all the optimizations to the given submesh, its line indices & those of its LODs being remapped along with the vertices.
+/// Its meshlets, if any, are discarded since the triangles are reordered; they must be built after the optimization.
+/// \note The submesh must be loaded again if it already was.
+/// \param submesh Submesh to be optimized.
+/// \param overdrawThreshold Ratio by which the overdraw optimization may degrade the vertex cache efficiency.
+/// \return Vertex cache efficiency before & after the optimization.
+OptimizationStatistics optimize(Submesh& submesh, float overdrawThreshold = defaultOverdrawThreshold);
+
+} // namespace MeshOptimizer
+
+} // namespace Raz
+
+#endif // RAZ_MESHOPTIMIZER_HPP
@@ -0,0 +1,68 @@
+#pragma once
+
+#ifndef RAZ_MESHSIMPLIFIER_HPP
+#define RAZ_MESHSIMPLIFIER_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace Raz {
+
+class Submesh;
+struct SubmeshLod;
+struct Vertex;
+
+namespace MeshSimplifier {
+
+/// Maximum geometric error of a simplification by default, relative to the diagonal of the mesh's bounding box.
+constexpr float defaultMaxError = 0.05f;
+/// Maximum error in pixels of a level of detail on screen for it to be selected by default; see Mesh::selectLods().
+constexpr float defaultMaxScreenError = 1.f;
+/// Ratio by which the error on screen must be lower than the maximum one to switch to a less detailed level by default; see Mesh::selectLods().
+constexpr float defaultLodHysteresis = 0.25f;
+
+struct SimplificationSettings {
+  float maxError        = defaultMaxError; ///< Maximum geometric error, relative to the diagonal of the mesh's bounding box.
+  float attributeWeight = 1.f;             ///< Weight of the differences of normals & texcoords between collapsed vertices in the collapses' cost.
+  bool lockBorders      = true;            ///< Keep the vertices of the open borders in place, so that adjacent meshes stay connected.
+};
+
+struct SimplificationResult {
+  std::vector<unsigned int> indices {}; ///< Simplified triangle indices, referring to the original vertices.
+  float error = 0.f;                    ///< Geometric error of the simplified triangles, as a distance in the vertices' space.
+};
+
+/// Simplifies triangles by collapsing their edges onto one of their vertices, by increasing cost according to Garland & Heckbert's
+///   "Surface Simplification Using Quadric Error Metrics". No vertex is created or moved, the simplified triangles referring to the original ones.
+/// The cost of a collapse is the squared distance of the kept vertex to the planes of the triangles merged into it, to which is added the
+///   difference of the vertices' normals & texcoords. Vertices on UV or normal seams only collapse along them, & those on complex or open
+///   borders are kept in place. Collapses which would flip a triangle are discarded.
+/// \param vertices Vertices referenced by the indices.
+/// \param indices Triangle indices to be simplified.
+/// \param targetTriangleCount Number of triangles to reach; the simplification stops earlier if the maximum error would be exceeded.
+/// \param settings Settings to simplify the triangles with.
+/// \return Simplified triangle indices & their error.
+SimplificationResult simplify(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, std::size_t targetTriangleCount,
+                              const SimplificationSettings& settings = {});
+/// Generates successive levels of detail, each being simplified from the previous one; see simplify().
+/// The generation stops if a level cannot be simplified further within the maximum error, hence possibly returning fewer levels than requested.
+/// \param vertices Vertices referenced by the indices.
+/// \param indices Triangle indices of the full detail.
+/// \param triangleRatios Decreasing ratios of the original triangle count targeted by each level, between 0 & 1.
+/// \param settings Settings to simplify the triangles with.
+/// \return Levels of detail, from the most to the least detailed, their triangles being optimized for the post-transform vertex cache.
+std::vector<SubmeshLod> generateLods(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+                                     const std::vector<float>& triangleRatios, const SimplificationSettings& settings = {});
+/// Generates the levels of detail of the given submesh, replacing its existing ones, & computes its bounding box from which they are selected;
+///   see generateLods().
+/// \note The submesh must be loaded again if it already was.
+/// \param submesh Submesh to generate the levels of detail of. Only submeshes rendered as triangles can be simplified.
+/// \param triangleRatios Decreasing ratios of the original triangle count targeted by each level, between 0 & 1.
+/// \param settings Settings to simplify the triangles with.
+void generateLods(Submesh& submesh, const std::vector<float>& triangleRatios, const SimplificationSettings& settings = {});
+
+} // namespace MeshSimplifier
+
+} // namespace Raz
+
+#endif // RAZ_MESHSIMPLIFIER_HPP
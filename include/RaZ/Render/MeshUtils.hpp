@@ -0,0 +1,61 @@
+#pragma once
+
+#ifndef RAZ_MESHUTILS_HPP
+#define RAZ_MESHUTILS_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace Raz {
+
+struct Vertex;
+
+namespace MeshUtils {
+
+/// Maximum distances under which the attributes of two vertices are considered equal, making them welded together.
+/// With all tolerances left to 0, only strictly identical vertices are merged.
+struct WeldingTolerances {
+  float position  = 0.f;
+  float texcoords = 0.f;
+  float normal    = 0.f;
+  float tangent   = 0.f;
+};
+
+/// Table remapping each vertex to its deduplicated counterpart.
+struct VertexRemap {
+  std::vector<unsigned int> indices {}; ///< Index, for each original vertex, of the unique vertex it is merged into.
+  std::size_t uniqueVertexCount = 0;    ///< Number of unique vertices; all remapped indices are lower than it.
+};
+
+/// Computes the table remapping each vertex to the first one it is equal to, unique vertices keeping their relative order.
+/// Strictly identical vertices are found through a hash table; with non-zero tolerances, close vertices are found through a spatial grid and are
+///   merged into the first vertex they are close enough to, without being averaged.
+/// \param vertices Vertices to compute the remap table of.
+/// \param tolerances Maximum distances under which vertices are merged.
+/// \return Vertex remap table.
+VertexRemap computeVertexRemap(const std::vector<Vertex>& vertices, const WeldingTolerances& tolerances = {});
+/// Creates the list of unique vertices from a remap table.
+/// \param vertices Original vertices.
+/// \param remap Remap table computed from the original vertices.
+/// \return Unique vertices.
+std::vector<Vertex> remapVertices(const std::vector<Vertex>& vertices, const VertexRemap& remap);
+/// Replaces the given indices by their remapped counterpart.
+/// \param indices Indices to be remapped, all referring to the original vertices.
+/// \param remap Remap table computed from the original vertices.
+void remapIndices(std::vector<unsigned int>& indices, const VertexRemap& remap);
+/// Removes the duplicate vertices, updating the indices referring to them.
+/// \param vertices Vertices to be deduplicated.
+/// \param indices Indices to be remapped, all referring to the given vertices.
+/// \param tolerances Maximum distances under which vertices are merged.
+/// \return Vertex remap table.
+VertexRemap deduplicateVertices(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, const WeldingTolerances& tolerances = {});
+/// Removes the triangles referring to a same vertex more than once, which notably appear when welding close vertices.
+/// \param indices Triangle indices to remove the degenerate triangles from.
+/// \return Number of removed triangles.
+std::size_t removeDegenerateTriangles(std::vector<unsigned int>& indices);
+
+} // namespace MeshUtils
+
+} // namespace Raz
+
+#endif // RAZ_MESHUTILS_HPP
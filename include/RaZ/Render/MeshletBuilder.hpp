@@ -0,0 +1,68 @@
+#pragma once
+
+#ifndef RAZ_MESHLETBUILDER_HPP
+#define RAZ_MESHLETBUILDER_HPP
+
+#include "RaZ/Math/Vector.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Raz {
+
+class Frustum;
+class Submesh;
+struct DrawRange;
+struct Meshlet;
+struct Vertex;
+
+namespace MeshletBuilder {
+
+/// Maximum number of vertices referenced by a meshlet by default.
+constexpr std::size_t defaultMaxVertexCount = 64;
+/// Maximum number of triangles in a meshlet by default.
+constexpr std::size_t defaultMaxTriangleCount = 124;
+
+/// Partitions triangles into meshlets, each being grown from a triangle by adding the adjacent ones which reference the fewest new vertices & are
+///   the closest to its center, until either maximum count is reached or no adjacent triangle remains. Triangles sharing a position are adjacent,
+///   even across UV or normal seams.
+/// The triangles are reordered so that those of each meshlet are contiguous, in the order in which the meshlets are built.
+/// Each meshlet is given a bounding sphere & a cone enclosing its triangles' normals, from which it can be culled; see cullMeshlets().
+/// \param vertices Vertices referenced by the indices.
+/// \param indices Triangle indices to be partitioned, reordered in place.
+/// \param maxVertexCount Maximum number of distinct vertices referenced by a meshlet; must be at least 3.
+/// \param maxTriangleCount Maximum number of triangles in a meshlet; must be at least 1.
+/// \return Meshlets covering all the triangles.
+std::vector<Meshlet> buildMeshlets(const std::vector<Vertex>& vertices, std::vector<unsigned int>& indices,
+                                   std::size_t maxVertexCount = defaultMaxVertexCount, std::size_t maxTriangleCount = defaultMaxTriangleCount);
+/// Builds the meshlets of the given submesh, replacing its existing ones & reordering its triangles; see buildMeshlets().
+/// \note The submesh must be loaded again if it already was.
+/// \param submesh Submesh to build the meshlets of. Only submeshes rendered as triangles can be partitioned.
+/// \param maxVertexCount Maximum number of distinct vertices referenced by a meshlet; must be at least 3.
+/// \param maxTriangleCount Maximum number of triangles in a meshlet; must be at least 1.
+void buildMeshlets(Submesh& submesh, std::size_t maxVertexCount = defaultMaxVertexCount, std::size_t maxTriangleCount = defaultMaxTriangleCount);
+/// Checks if a meshlet may be visible, being neither outside of the frustum nor, if a viewer is given, entirely backfacing.
+/// The frustum test is conservative; a meshlet close to the frustum's edges may be considered visible while it actually is not.
+/// \param meshlet Meshlet to be checked.
+/// \param frustum Frustum to check the meshlet against, in the space of the meshlet's vertices.
+/// \param viewPosition Optional position of the viewer, in the space of the meshlet's vertices (nullptr if backfaces are drawn).
+/// \return True if the meshlet may be visible, false if it can be culled.
+bool isVisible(const Meshlet& meshlet, const Frustum& frustum, const Vec3f* viewPosition = nullptr);
+/// Culls the meshlets which cannot be visible (see isVisible()), giving the ranges of indices of the remaining ones.
+/// The triangles of consecutive visible meshlets being contiguous, their ranges are merged to be drawn at once.
+/// \param meshlets Meshlets to be culled, in the order of their triangles.
+/// \param frustum Frustum to cull the meshlets against, in the space of the meshlets' vertices.
+/// \param viewPosition Optional position of the viewer, in the space of the meshlets' vertices (nullptr if backfaces are drawn).
+/// \return Ranges of the visible meshlets' triangle indices.
+std::vector<DrawRange> cullMeshlets(const std::vector<Meshlet>& meshlets, const Frustum& frustum, const Vec3f* viewPosition = nullptr);
+/// Gathers the indices of the given ranges into a single list, to be drawn with a single call.
+/// \param indices Indices referred to by the ranges.
+/// \param ranges Ranges of the indices to be kept.
+/// \return Compacted indices.
+std::vector<unsigned int> compactIndices(const std::vector<unsigned int>& indices, const std::vector<DrawRange>& ranges);
+
+} // namespace MeshletBuilder
+
+} // namespace Raz
+
+#endif // RAZ_MESHLETBUILDER_HPP
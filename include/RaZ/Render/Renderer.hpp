@@ -71,7 +71,9 @@ enum class StateParameter : unsigned int {
   DEPTH_TEST                    = static_cast<unsigned int>(Capability::DEPTH_TEST)     /* GL_DEPTH_TEST                    */, ///< Depth testing.
   DEPTH_WRITEMASK               = 2930                                                  /* GL_DEPTH_WRITEMASK               */, ///< Depth write mask.
   DITHER                        = static_cast<unsigned int>(Capability::DITHER)         /* GL_DITHER                        */, ///< Dithering.
-  POINT_SIZE                    = static_cast<unsigned int>(Capability::POINT_SIZE)     /* GL_POINT_SIZE                    */  ///< Point size.
+  NUM_EXTENSIONS                = 33309                                                 /* GL_NUM_EXTENSIONS                */, ///< Number of supported extensions.
+  POINT_SIZE                    = static_cast<unsigned int>(Capability::POINT_SIZE)     /* GL_POINT_SIZE                    */, ///< Point size.
+  UNPACK_ALIGNMENT              = 3317                                                  /* GL_UNPACK_ALIGNMENT              */  ///< Alignment of the rows of pixels sent.
 };
 
 enum class MaskType : unsigned int {
@@ -222,6 +224,10 @@ enum class TextureInternalFormat : unsigned int {
   RGB16F   = 34843, // GL_RGB16F
   RGBA16F  = 34842, // GL_RGBA16F
   DEPTH32F = 36012, // GL_DEPTH_COMPONENT32F
+
+  // Compressed formats
+  RGB_BC1  = 33776, // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+  RGBA_BC3 = 33779  // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
 };
 
 enum class TextureDataType : unsigned int {
@@ -450,6 +456,10 @@ public:
   static void enable(Capability capability);
   static void disable(Capability capability);
   static bool isEnabled(Capability capability);
+  /// Checks if the given extension is supported by the current context.
+  /// \param extension Name of the extension to be checked (for example "GL_EXT_texture_compression_s3tc").
+  /// \return True if the extension is supported, false otherwise.
+  static bool isExtensionSupported(const std::string& extension);
   static void getParameter(StateParameter parameter, unsigned char* values);
   static void getParameter(StateParameter parameter, int* values);
   static void getParameter(StateParameter parameter, int64_t* values);
@@ -523,6 +533,19 @@ public:
                               unsigned int width, unsigned int height,
                               TextureFormat format,
                               TextureDataType dataType, const void* data);
+  /// Sends the block-compressed image's data corresponding to the currently bound texture.
+  /// \param type Type of the texture.
+  /// \param mipmapLevel Mipmap (level of detail) of the texture. 0 is the most detailed.
+  /// \param internalFormat Compressed image format.
+  /// \param width Image width.
+  /// \param height Image height.
+  /// \param dataSize Size in bytes of the compressed data.
+  /// \param data Compressed data to be sent.
+  static void sendCompressedImageData2D(TextureType type,
+                                        unsigned int mipmapLevel,
+                                        TextureInternalFormat internalFormat,
+                                        unsigned int width, unsigned int height,
+                                        unsigned int dataSize, const void* data);
 #if !defined(USE_OPENGL_ES)
   static void recoverTextureAttribute(TextureType type, unsigned int mipmapLevel, TextureAttribute attribute, int* values);
   static void recoverTextureAttribute(TextureType type, unsigned int mipmapLevel, TextureAttribute attribute, float* values);
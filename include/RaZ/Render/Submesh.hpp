@@ -6,26 +6,58 @@
 #include "RaZ/Render/GraphicObjects.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
+#include <algorithm>
+#include <cassert>
 #include <functional>
 #include <memory>
 
 namespace Raz {
 
+class Frustum;
+class ShaderProgram;
+
 enum class RenderMode : unsigned int {
   POINT    = 0, // GL_POINTS
   //LINE     = 1, // GL_LINES
   TRIANGLE = 4  // GL_TRIANGLES
 };
 
+/// Simplified version of a submesh, drawn in place of it when far enough; see MeshSimplifier.
+struct SubmeshLod {
+  std::vector<unsigned int> triangleIndices {}; ///< Triangle indices, referring to the submesh's vertices.
+  float error = 0.f;                            ///< Geometric error compared to the full detail, as a distance in the submesh's space.
+};
+
+/// Cluster of neighbouring triangles of a submesh, which can be culled as a whole before being drawn; see MeshletBuilder.
+struct Meshlet {
+  std::size_t firstIndex    = 0; ///< Position of the meshlet's first triangle index in the submesh's ones, its triangles being contiguous.
+  std::size_t triangleCount = 0; ///< Number of triangles in the meshlet.
+  std::size_t vertexCount   = 0; ///< Number of distinct vertices referenced by the meshlet's triangles.
+  Sphere boundingSphere = Sphere(Vec3f(0.f), 0.f); ///< Sphere enclosing all of the meshlet's triangles.
+  Vec3f coneApex {};             ///< Apex of the normal cone, from which the view direction is taken for the backface test.
+  Vec3f coneAxis {};             ///< Axis of the normal cone, averaging the triangles' normals.
+  float coneCutoff = 2.f;        ///< Minimum cosine between the view direction & the axis for all the triangles to be backfacing; above 1 if never.
+};
+
+/// Range of contiguous indices to be drawn.
+struct DrawRange {
+  std::size_t firstIndex = 0;
+  std::size_t indexCount = 0;
+};
+
 class Submesh {
 public:
   explicit Submesh(RenderMode renderMode = RenderMode::TRIANGLE) { setRenderMode(renderMode); }
   Submesh(const Submesh&) = delete;
   Submesh(Submesh&&) = default;
 
+  const VertexArray& getVertexArray() const { return m_vao; }
+  const VertexBuffer& getVertexBuffer() const { return m_vbo; }
+  const IndexBuffer& getIndexBuffer() const { return m_ibo; }
   const std::vector<Vertex>& getVertices() const { return m_vbo.getVertices(); }
   std::vector<Vertex>& getVertices() { return m_vbo.getVertices(); }
   std::size_t getVertexCount() const { return getVertices().size(); }
+  const VertexLayout& getVertexLayout() const { return m_vbo.getLayout(); }
   const std::vector<unsigned int>& getLineIndices() const { return m_ibo.getLineIndices(); }
   std::vector<unsigned int>& getLineIndices() { return m_ibo.getLineIndices(); }
   std::size_t getLineIndexCount() const { return getLineIndices().size(); }
@@ -35,15 +67,72 @@ public:
   const AABB& getBoundingBox() const { return m_boundingBox; }
   RenderMode getRenderMode() const { return m_renderMode; }
   std::size_t getMaterialIndex() const { return m_materialIndex; }
-
+  const std::vector<SubmeshLod>& getLods() const { return m_lods; }
+  std::vector<SubmeshLod>& getLods() { return m_lods; }
+  /// Gets the level of detail being drawn.
+  /// \return 0 if the submesh is drawn in full detail, i if it is drawn with its i-th LOD.
+  std::size_t getLodIndex() const { return std::min(m_lodIndex, m_lods.size()); }
+  /// Gets the triangle indices of a level of detail.
+  /// \param lodIndex 0 for the full detail, i for the i-th LOD.
+  /// \return Triangle indices of the level.
+  const std::vector<Meshlet>& getMeshlets() const { return m_meshlets; }
+  /// Gets the ranges of triangle indices drawn after the meshlets have been culled; see cullMeshlets().
+  /// \return Ranges of the visible meshlets' indices.
+  const std::vector<DrawRange>& getVisibleRanges() const { return m_visibleRanges; }
+  /// Checks if only the visible meshlets are drawn, which is the case once they have been culled & as long as the full detail is used.
+  /// \return True if the meshlets are culled, false if all the triangles are drawn.
+  bool isMeshletCulled() const { return (m_isMeshletCulled && getLodIndex() == 0); }
+  const std::vector<unsigned int>& getLodTriangleIndices(std::size_t lodIndex) const {
+    assert("Error: The LOD index is out of bounds." && lodIndex <= m_lods.size());
+    return (lodIndex == 0 ? getTriangleIndices() : m_lods[lodIndex - 1].triangleIndices);
+  }
+  /// Gets the geometric error of a level of detail.
+  /// \param lodIndex 0 for the full detail, i for the i-th LOD.
+  /// \return Error of the level, as a distance in the submesh's space.
+  float getLodError(std::size_t lodIndex) const {
+    assert("Error: The LOD index is out of bounds." && lodIndex <= m_lods.size());
+    return (lodIndex == 0 ? 0.f : m_lods[lodIndex - 1].error);
+  }
+  /// Checks if the indices are sent to the graphics card as 16-bit integers, which is the case if the submesh has few enough vertices.
+  /// \return True if the indices are 16-bit integers, false if they are 32-bit ones.
+  bool hasShortIndices() const { return (getVertexCount() <= VertexPacker::maxShortIndexedVertexCount); }
+
+  /// Sets the primitive type the submesh is drawn with; the render mode being only used when drawing, the submesh does not need to be loaded again.
+  /// \param renderMode New render mode.
   void setRenderMode(RenderMode renderMode);
   void setMaterialIndex(std::size_t materialIndex) { m_materialIndex = materialIndex; }
+  /// Sets the submesh's meshlets, whose triangles must be contiguous in its triangle indices; see MeshletBuilder::buildMeshlets().
+  /// Any previous culling is discarded, all the triangles being drawn until the meshlets are culled again.
+  /// \param meshlets New meshlets.
+  void setMeshlets(std::vector<Meshlet> meshlets);
+  /// Sets the level of detail to be drawn.
+  /// \param lodIndex 0 to draw the submesh in full detail, i to draw its i-th LOD.
+  void setLodIndex(std::size_t lodIndex) {
+    assert("Error: The LOD index is out of bounds." && lodIndex <= m_lods.size());
+    m_lodIndex = lodIndex;
+  }
+  /// Sets the submesh's bounding box, which must enclose all of its vertices; if it is not already known, use computeBoundingBox() instead.
+  /// \param boundingBox New bounding box.
+  void setBoundingBox(const AABB& boundingBox) { m_boundingBox = boundingBox; }
+  /// Sets the format in which the vertices are sent to the graphics card; the submesh must be loaded again for it to be applied.
+  /// If the positions are quantized, they are made relative to the bounding box, which is computed here & must then be kept up to date.
+  /// \param layout New vertex layout.
+  void setVertexLayout(const VertexLayout& layout);
 
   /// Computes & updates the submesh's bounding box.
   /// \return Submesh's bounding box.
   const AABB& computeBoundingBox();
-  /// Loads the submesh's data (vertices & indices) onto the graphics card.
+  /// Culls the meshlets outside of the frustum or entirely backfacing, only the remaining ones being drawn afterward; see MeshletBuilder::isVisible().
+  /// Does nothing if the submesh has no meshlet.
+  /// \param frustum Frustum to cull the meshlets against, in the submesh's space.
+  /// \param viewPosition Optional position of the viewer, in the submesh's space, to cull the backfacing meshlets (nullptr if backfaces are drawn).
+  void cullMeshlets(const Frustum& frustum, const Vec3f* viewPosition = nullptr);
+  /// Loads the submesh's data (vertices & indices, followed by those of its LODs) onto the graphics card.
+  /// \note The submesh's buffers are only created at this point; until then, its data can be filled without a graphics context.
   void load() const;
+  /// Sends to the given shader program the uniforms required to decode the submesh's vertices, as laid out on the graphics card.
+  /// \param program Shader program to send the uniforms to.
+  void sendVertexFormat(const ShaderProgram& program) const;
   /// Draws the submesh in the scene.
   void draw() const;
 
@@ -63,6 +152,13 @@ private:
   std::function<void(const Submesh&)> m_renderFunc {};
 
   std::size_t m_materialIndex = 0;
+
+  std::vector<SubmeshLod> m_lods {};
+  std::size_t m_lodIndex = 0;
+
+  std::vector<Meshlet> m_meshlets {};
+  std::vector<DrawRange> m_visibleRanges {};
+  bool m_isMeshletCulled = false;
 };
 
 } // namespace Raz
@@ -7,6 +7,7 @@
 #include "RaZ/Utils/Image.hpp"
 
 #include <memory>
+#include <string_view>
 
 namespace Raz {
 
@@ -63,6 +64,9 @@ public:
   /// \param createMipmaps True to generate texture mipmaps, false otherwise.
   void load(Image image, bool createMipmaps = true);
   /// Reads the texture in memory & loads it onto the graphics card.
+  /// If the path is found in a mounted asset archive (see VirtualFileSystem), the cooked texture it holds is loaded instead of the file.
+  /// \note Textures in the raztex format, either archived or not, are loaded with their precomputed mipmaps. If these are block-compressed, they are
+  ///   sent as is to the graphics card (being decompressed beforehand if unsupported), & the texture's image is left empty.
   /// \param filePath Path to the texture to load.
   /// \param flipVertically Flip vertically the texture when loading.
   /// \param createMipmaps True to generate texture mipmaps, false otherwise.
@@ -92,6 +96,12 @@ private:
   /// Loads it onto the graphics card.
   /// \param createMipmaps True to generate texture mipmaps, false otherwise.
   void load(bool createMipmaps = true);
+  /// Loads a texture in the raztex format onto the graphics card, along with its mipmaps.
+  /// \param fileContent Content of the raztex file.
+  /// \param filePath Path to the texture, used for error messages.
+  /// \param flipVertically Flip vertically the texture when loading.
+  /// \param createMipmaps True to load the texture's mipmaps, false otherwise.
+  void loadRaztex(std::string_view fileContent, const FilePath& filePath, bool flipVertically, bool createMipmaps);
   /// Fills the texture with a single pixel (creates a single-colored 1x1 texture).
   /// \note This only allocates & fills memory on the graphics card; the image member's data is left untouched.
   /// \param color Color to fill the texture with.
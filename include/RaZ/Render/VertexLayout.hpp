@@ -0,0 +1,95 @@
+#pragma once
+
+#ifndef RAZ_VERTEXLAYOUT_HPP
+#define RAZ_VERTEXLAYOUT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Raz {
+
+class AABB;
+struct Vertex;
+
+enum class PositionFormat : uint8_t {
+  FLOAT,  ///< 3 floats (12 bytes).
+  UNORM16 ///< 3 16-bit unsigned normalized integers relative to the submesh's bounding box, followed by 2 bytes of padding (8 bytes).
+};
+
+enum class TexcoordsFormat : uint8_t {
+  FLOAT,      ///< 2 floats (8 bytes).
+  HALF_FLOAT, ///< 2 half-precision floats (4 bytes).
+  UNORM16     ///< 2 16-bit unsigned normalized integers (4 bytes); only suited to texcoords between 0 & 1, others being clamped.
+};
+
+enum class NormalFormat : uint8_t {
+  FLOAT,     ///< 3 floats for both the normal & the tangent (24 bytes).
+  OCTAHEDRAL ///< Octahedral normal in 2 16-bit signed normalized integers, & octahedral tangent in 2 10-bit ones followed by its sign (8 bytes).
+};
+
+/// Format in which vertices are sent to the graphics card. Whatever the layout, vertices are kept as Vertex on the CPU.
+/// Vertex shaders must decode the compact formats according to the uniVertexFormat uniform, as done by the default ones.
+struct VertexLayout {
+  PositionFormat positionFormat   = PositionFormat::FLOAT;
+  TexcoordsFormat texcoordsFormat = TexcoordsFormat::FLOAT;
+  NormalFormat normalFormat       = NormalFormat::FLOAT;
+
+  /// Creates the most compact layout, with half-precision texcoords & octahedral normals & tangents.
+  /// \param quantizePositions True to quantize the positions relative to the bounding box (20 bytes per vertex), false to keep them as floats
+  ///   (24 bytes per vertex).
+  /// \return Compact vertex layout.
+  static constexpr VertexLayout createCompact(bool quantizePositions = true) noexcept {
+    return VertexLayout{ (quantizePositions ? PositionFormat::UNORM16 : PositionFormat::FLOAT), TexcoordsFormat::HALF_FLOAT, NormalFormat::OCTAHEDRAL };
+  }
+
+  /// Checks if the layout is the default one, in which vertices are sent as is.
+  /// \return True if all attributes are stored as floats, false otherwise.
+  constexpr bool isDefault() const noexcept {
+    return (positionFormat == PositionFormat::FLOAT && texcoordsFormat == TexcoordsFormat::FLOAT && normalFormat == NormalFormat::FLOAT);
+  }
+  constexpr std::size_t computePositionSize() const noexcept { return (positionFormat == PositionFormat::FLOAT ? 12 : 8); }
+  constexpr std::size_t computeTexcoordsSize() const noexcept { return (texcoordsFormat == TexcoordsFormat::FLOAT ? 8 : 4); }
+  constexpr std::size_t computeNormalSize() const noexcept { return (normalFormat == NormalFormat::FLOAT ? 12 : 4); }
+  constexpr std::size_t computeTangentSize() const noexcept { return (normalFormat == NormalFormat::FLOAT ? 12 : 4); }
+  /// Computes the size of a packed vertex, all attributes being contiguous.
+  /// \return Size in bytes of a vertex.
+  constexpr std::size_t computeStride() const noexcept {
+    return computePositionSize() + computeTexcoordsSize() + computeNormalSize() + computeTangentSize();
+  }
+
+  constexpr bool operator==(const VertexLayout& layout) const noexcept {
+    return (positionFormat == layout.positionFormat && texcoordsFormat == layout.texcoordsFormat && normalFormat == layout.normalFormat);
+  }
+  constexpr bool operator!=(const VertexLayout& layout) const noexcept { return !(*this == layout); }
+};
+
+/// Conversions of vertices & indices to the compact formats sent to the graphics card.
+namespace VertexPacker {
+
+/// Maximum number of vertices which can be referenced by 16-bit indices.
+/// The largest 16-bit index (0xFFFF) is never used, being always reserved for primitive restart in WebGL 2.
+constexpr std::size_t maxShortIndexedVertexCount = 65535;
+
+/// Packs vertices in the given layout, each attribute being contiguous to the previous one.
+/// \param vertices Vertices to be packed.
+/// \param layout Layout to pack the vertices in.
+/// \param boundingBox Box enclosing all the vertices, to which the positions are made relative if quantized; positions outside of it are clamped.
+/// \return Packed vertices, the stride being given by the layout.
+std::vector<uint8_t> packVertices(const std::vector<Vertex>& vertices, const VertexLayout& layout, const AABB& boundingBox);
+/// Unpacks vertices from the given layout, which may have lost precision when packed.
+/// \param packedVertices Vertices to be unpacked.
+/// \param layout Layout in which the vertices have been packed.
+/// \param boundingBox Box relative to which the positions have been quantized, if they have.
+/// \return Unpacked vertices.
+std::vector<Vertex> unpackVertices(const std::vector<uint8_t>& packedVertices, const VertexLayout& layout, const AABB& boundingBox);
+/// Converts indices to 16-bit ones.
+/// \param indices Indices to be converted, all lower than maxShortIndexedVertexCount.
+/// \return Converted indices.
+std::vector<uint16_t> packShortIndices(const std::vector<unsigned int>& indices);
+
+} // namespace VertexPacker
+
+} // namespace Raz
+
+#endif // RAZ_VERTEXLAYOUT_HPP
@@ -0,0 +1,128 @@
+#pragma once
+
+#ifndef RAZ_ASSETARCHIVE_HPP
+#define RAZ_ASSETARCHIVE_HPP
+
+#include "RaZ/Utils/MappedFile.hpp"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Raz {
+
+class FilePath;
+
+/// Binary format packing several assets into a single file, whose entries are indexed by path & whose data can be used in place once the file is memory-mapped.
+///
+/// A file is made of a header followed by several sections, the entries' data all starting at an offset multiple of 16 bytes:
+///
+///   Header | Entries | String table | Entries' data
+///
+/// - Paths are relative to the archive's root, with '/' as a separator;
+/// - Entries are sorted by path, allowing to find them with a binary search;
+/// - Values are stored in the endianness of the machine which wrote the file, which is checked when reading it;
+/// - The checksum covers the entries & the string table, each entry's data having their own hash.
+namespace AssetArchiveFormat {
+
+constexpr std::array<char, 8> magic = { 'R', 'A', 'Z', 'P', 'A', 'C', 'K', '\0' };
+constexpr uint32_t version          = 1;
+constexpr uint32_t endiannessTag    = 0x01020304;
+constexpr std::size_t alignment     = 16;
+
+enum class EntryType : uint32_t {
+  RAW      = 0, ///< File copied as is.
+  MESH     = 1, ///< Mesh converted into the razmesh format.
+  TEXTURE  = 2, ///< Image converted into the raztex format.
+  MATERIAL = 3  ///< Material library (MTL file), referenced by a mesh.
+};
+
+/// Reference to a string stored in the string table, which is not null-terminated.
+struct StringRef {
+  uint32_t offset; ///< Offset of the string's first character from the beginning of the string table.
+  uint32_t size;   ///< Number of characters of the string.
+};
+
+struct Header {
+  std::array<char, 8> magic;
+  uint32_t version;
+  uint32_t endiannessTag;
+  uint64_t fileSize;
+  uint64_t checksum;
+  uint32_t entryCount;
+  uint32_t stringTableSize;
+  uint64_t entryTableOffset;
+  uint64_t stringTableOffset;
+  std::array<uint32_t, 2> padding;
+};
+
+struct Entry {
+  StringRef path;
+  EntryType type;
+  uint32_t padding;
+  uint64_t dataOffset;
+  uint64_t dataSize;
+  uint64_t dataHash;               ///< Checksum of the entry's data.
+};
+
+static_assert(sizeof(Header) == 64, "Error: The asset archive header must be 64 bytes long.");
+static_assert(sizeof(Entry) == 40, "Error: An asset archive entry must be 40 bytes long.");
+
+} // namespace AssetArchiveFormat
+
+/// Asset to be packed into an archive.
+struct ArchivedAsset {
+  std::string path;                  ///< Path of the asset in the archive, relative to its root.
+  AssetArchiveFormat::EntryType type = AssetArchiveFormat::EntryType::RAW;
+  std::string_view data {};          ///< Data of the asset, which must remain valid until the archive is saved.
+};
+
+/// Asset found in an archive, whose data point into the archive's memory.
+struct ArchiveEntry {
+  std::string_view path {};
+  AssetArchiveFormat::EntryType type = AssetArchiveFormat::EntryType::RAW;
+  std::string_view data {};
+  uint64_t dataHash {};
+};
+
+/// Read-only archive of assets, memory-mapped & validated when opened.
+class AssetArchive {
+public:
+  /// Opens & validates an archive.
+  /// \param filePath Path to the archive to be opened.
+  explicit AssetArchive(const FilePath& filePath);
+
+  std::size_t getEntryCount() const noexcept { return m_entries.size(); }
+
+  /// Gets an entry from its index, entries being sorted by path.
+  /// \param entryIndex Index of the entry to be recovered.
+  /// \return Entry at the given index.
+  ArchiveEntry getEntry(std::size_t entryIndex) const;
+  /// Finds an entry from its path.
+  /// \param path Path of the entry in the archive, relative to its root & with '/' as a separator.
+  /// \return Entry if found, none otherwise.
+  std::optional<ArchiveEntry> find(std::string_view path) const;
+  /// Checks that the entries' data have not been altered, by recomputing their hashes.
+  /// \note This reads the whole archive; entries are not checked on access.
+  /// \return True if all the entries' data are intact, false otherwise.
+  bool checkIntegrity() const;
+
+  /// Packs the given assets into an archive file.
+  /// \param filePath Path to the archive to be saved.
+  /// \param assets Assets to be packed, whose paths must be unique.
+  static void save(const FilePath& filePath, std::vector<ArchivedAsset> assets);
+
+private:
+  std::string_view recoverPath(const AssetArchiveFormat::Entry& entry) const noexcept { return m_strings.substr(entry.path.offset, entry.path.size); }
+
+  MappedFile m_file;
+  std::vector<AssetArchiveFormat::Entry> m_entries {};
+  std::string_view m_strings {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_ASSETARCHIVE_HPP
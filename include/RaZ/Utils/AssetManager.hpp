@@ -0,0 +1,274 @@
+#pragma once
+
+#ifndef RAZ_ASSETMANAGER_HPP
+#define RAZ_ASSETMANAGER_HPP
+
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(RAZ_THREADS_AVAILABLE)
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace Raz {
+
+class Image;
+class Mesh;
+class Sound;
+class Texture;
+
+enum class AssetState : uint8_t {
+  LOADING, ///< The asset is being decoded or is waiting to be uploaded.
+  LOADED,  ///< The asset is available.
+  FAILED   ///< The asset could not be loaded.
+};
+
+/// Base of the entries held by the AssetManager, each representing a single asset.
+class AssetEntry {
+  friend class AssetManager;
+  template <typename> friend class AssetHandle;
+
+public:
+  explicit AssetEntry(FilePath filePath) : m_filePath{ std::move(filePath) } {}
+  AssetEntry(const AssetEntry&) = delete;
+  AssetEntry(AssetEntry&&) noexcept = delete;
+
+  AssetEntry& operator=(const AssetEntry&) = delete;
+  AssetEntry& operator=(AssetEntry&&) noexcept = delete;
+
+  virtual ~AssetEntry() = default;
+
+protected:
+  /// Decodes the asset; called on a worker thread.
+  virtual void decode() {}
+  /// Finalizes the asset once decoded, typically sending it to the graphics card; called on the thread updating the manager.
+  virtual void upload() {}
+  /// Checks if the asset itself is referenced outside of the manager, for example by a material.
+  /// \return True if the asset is shared, false otherwise.
+  virtual bool isAssetShared() const noexcept = 0;
+
+  FilePath m_filePath {};
+  std::atomic<AssetState> m_state = AssetState::LOADING;
+  std::atomic<std::size_t> m_referenceCount = 0;
+  std::string m_error {};
+
+  std::chrono::steady_clock::time_point m_requestTime {};
+  float m_decodeTime {};
+};
+
+template <typename T>
+class TypedAssetEntry : public AssetEntry {
+  template <typename> friend class AssetHandle;
+
+public:
+  using AssetType = T;
+
+  explicit TypedAssetEntry(FilePath filePath) : AssetEntry(std::move(filePath)) {}
+
+protected:
+  bool isAssetShared() const noexcept override { return (m_asset.use_count() > 1); }
+
+  std::shared_ptr<T> m_asset {};
+};
+
+/// Reference to an asset requested from the AssetManager, which may not be loaded yet.
+/// The asset is kept by the manager as long as a handle references it.
+template <typename T>
+class AssetHandle {
+  friend class AssetManager;
+
+public:
+  AssetHandle() = default;
+  AssetHandle(const AssetHandle& handle) : m_entry{ handle.m_entry } { acquire(); }
+  AssetHandle(AssetHandle&& handle) noexcept = default;
+
+  bool isValid() const noexcept { return (m_entry != nullptr); }
+  AssetState getState() const noexcept { assert("Error: The asset handle is invalid." && isValid()); return m_entry->m_state; }
+  bool isLoaded() const noexcept { return (getState() == AssetState::LOADED); }
+  bool hasFailed() const noexcept { return (getState() == AssetState::FAILED); }
+  const FilePath& getFilePath() const noexcept { assert("Error: The asset handle is invalid." && isValid()); return m_entry->m_filePath; }
+  /// Gets the error message explaining why the asset could not be loaded.
+  /// \return Error message, empty if the asset did not fail to load.
+  const std::string& getError() const noexcept { assert("Error: The asset handle is invalid." && isValid()); return m_entry->m_error; }
+  /// Gets the number of handles referencing the asset.
+  /// \return Asset's reference count.
+  std::size_t getReferenceCount() const noexcept { return (m_entry ? m_entry->m_referenceCount.load() : 0); }
+  /// Gets the asset, which must be loaded.
+  /// \return Asset referenced by the handle.
+  const std::shared_ptr<T>& get() const noexcept {
+    assert("Error: The asset must be loaded to be accessed." && isLoaded());
+    return static_cast<const TypedAssetEntry<T>&>(*m_entry).m_asset;
+  }
+
+  /// Stops referencing the asset; the handle becomes invalid.
+  void reset() noexcept { release(); m_entry.reset(); }
+
+  AssetHandle& operator=(const AssetHandle& handle) noexcept;
+  AssetHandle& operator=(AssetHandle&& handle) noexcept;
+  const T& operator*() const noexcept { return *get(); }
+  const T* operator->() const noexcept { return get().get(); }
+
+  ~AssetHandle() { release(); }
+
+private:
+  explicit AssetHandle(std::shared_ptr<TypedAssetEntry<T>> entry) : m_entry{ std::move(entry) } { acquire(); }
+
+  void acquire() noexcept { if (m_entry) ++m_entry->m_referenceCount; }
+  void release() noexcept { if (m_entry) --m_entry->m_referenceCount; }
+
+  std::shared_ptr<TypedAssetEntry<T>> m_entry {};
+};
+
+struct AssetStatistics {
+  std::size_t requestCount {};      ///< Number of assets requested.
+  std::size_t deduplicatedCount {}; ///< Number of requests for an asset already held by the manager, which have not been loaded again.
+  std::size_t loadingCount {};      ///< Number of assets currently loading.
+  std::size_t loadedCount {};       ///< Number of assets held by the manager & available.
+  std::size_t failedCount {};       ///< Number of assets held by the manager which could not be loaded.
+  std::size_t evictedCount {};      ///< Number of assets removed from the manager since they were not referenced anymore.
+  float progress = 1.f;             ///< Ratio of loaded assets among those requested since the manager was last idle, between 0 & 1.
+  float averageLatency {};          ///< Average time in milliseconds between an asset's request & its availability.
+  float maxLatency {};              ///< Maximal time in milliseconds between an asset's request & its availability.
+  float averageDecodeTime {};       ///< Average time in milliseconds spent decoding an asset on a worker thread.
+  float averageUploadTime {};       ///< Average time in milliseconds spent uploading an asset during an update.
+  float lastUpdateTime {};          ///< Time in milliseconds spent uploading assets during the last update.
+};
+
+/// Asynchronous loader of assets, each loaded only once & shared by reference-counted handles.
+/// Assets are decoded on worker threads, then uploaded during the manager's updates, which must be performed once per frame
+///   on the thread owning the graphics context; uploads are done within a time budget, so as not to stall the frame.
+/// \note Apart from the handles, which may be used from any thread, the manager must only be used from the thread updating it.
+class AssetManager {
+public:
+  /// Creates an asset manager.
+  /// \param workerCount Number of threads decoding the assets; must be strictly positive.
+  explicit AssetManager(std::size_t workerCount = defaultWorkerCount());
+  AssetManager(const AssetManager&) = delete;
+  AssetManager(AssetManager&&) noexcept = delete;
+
+  std::size_t getAssetCount() const noexcept { return m_entries.size(); }
+  float getUploadTimeBudget() const noexcept { return m_uploadTimeBudget; }
+  const AssetStatistics& getStatistics() const noexcept { return m_stats; }
+
+  /// Sets the maximal time that may be spent on each update uploading assets. At least one asset is uploaded on each update
+  ///   if any is ready, regardless of the budget.
+  /// \param budgetMilliseconds Upload time budget in milliseconds.
+  void setUploadTimeBudget(float budgetMilliseconds) noexcept { m_uploadTimeBudget = budgetMilliseconds; }
+
+  /// Requests an image to be loaded. It is made available by the first update following its decoding.
+  /// \param filePath Path to the image to load.
+  /// \param flipVertically Flip vertically the image when loading.
+  /// \return Handle to the image.
+  AssetHandle<Image> loadImage(const FilePath& filePath, bool flipVertically = false);
+  /// Requests a texture to be loaded. Its image is decoded on a worker thread, while the texture is created during an update.
+  /// \note Textures converted by the asset cooker, either archived or in the raztex format, are read during the update, being sent as is.
+  /// \param filePath Path to the texture to load.
+  /// \param bindingIndex Index of the texture's binding point; textures with different binding indices are loaded separately.
+  /// \param flipVertically Flip vertically the texture when loading.
+  /// \param createMipmaps True to generate texture mipmaps, false otherwise.
+  /// \return Handle to the texture.
+  AssetHandle<Texture> loadTexture(const FilePath& filePath, int bindingIndex, bool flipVertically = false, bool createMipmaps = true);
+  /// Requests a mesh to be loaded. It is imported on a worker thread, its buffers & its materials' textures being created during an update.
+  /// The mesh is loaded onto the graphics card before being available.
+  /// \param filePath Path to the mesh to load.
+  /// \return Handle to the mesh.
+  AssetHandle<Mesh> loadMesh(const FilePath& filePath);
+  /// Requests a sound to be loaded. It is made available by the first update following its decoding.
+  /// \param filePath Path to the sound to load.
+  /// \return Handle to the sound.
+  AssetHandle<Sound> loadSound(const FilePath& filePath);
+  /// Uploads the decoded assets, within the time budget.
+  /// \return Number of assets made available or having failed.
+  std::size_t update();
+  /// Waits for an asset to be loaded, uploading all decoded assets in the meantime.
+  /// \param handle Handle to the asset to wait for.
+  template <typename T>
+  void wait(const AssetHandle<T>& handle) { wait(handle.m_entry.get()); }
+  /// Waits for all the requested assets to be loaded, uploading them without any time budget.
+  void waitAll() { wait(nullptr); }
+  /// Removes the assets which are neither referenced by any handle nor shared outside of the manager.
+  /// \return Number of assets removed.
+  std::size_t evictUnused();
+
+  AssetManager& operator=(const AssetManager&) = delete;
+  AssetManager& operator=(AssetManager&&) noexcept = delete;
+
+  ~AssetManager();
+
+private:
+  static std::size_t defaultWorkerCount() noexcept;
+
+  /// Checks if an asset has already been requested, returning it if so, or requests it otherwise.
+  /// \tparam EntryT Type of the entry to create if the asset is not held yet.
+  /// \param filePath Path to the asset.
+  /// \param key Beginning of the key identifying the asset, made of its type & loading settings; the asset's normalized path is appended to it.
+  /// \param args Arguments to be forwarded to the entry's constructor, following the path.
+  /// \return Handle to the asset.
+  template <typename EntryT, typename... Args>
+  auto request(const FilePath& filePath, std::string key, Args&&... args);
+  void enqueue(std::shared_ptr<AssetEntry> entry);
+  void decode(std::shared_ptr<AssetEntry> entry);
+  void finalize(AssetEntry& entry);
+  /// Waits until the given asset, or all of them if null, is available, uploading the decoded assets meanwhile.
+  void wait(const AssetEntry* entry);
+
+  std::unordered_map<std::string, std::shared_ptr<AssetEntry>> m_entries {};
+  std::deque<std::shared_ptr<AssetEntry>> m_uploadQueue {};
+  float m_uploadTimeBudget = 2.f;
+
+  AssetStatistics m_stats {};
+  std::size_t m_batchRequestCount {};
+  std::size_t m_batchFinishedCount {};
+  std::size_t m_finishedCount {};
+  double m_totalLatency {};
+  double m_totalDecodeTime {};
+  double m_totalUploadTime {};
+  std::size_t m_uploadCount {};
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  std::vector<std::thread> m_workers {};
+  std::deque<std::shared_ptr<AssetEntry>> m_decodeQueue {};
+  std::mutex m_decodeMutex {};
+  std::condition_variable m_decodeCondition {};
+  std::mutex m_uploadMutex {};
+  std::condition_variable m_uploadCondition {};
+  bool m_isStopping = false;
+#endif
+};
+
+template <typename T>
+AssetHandle<T>& AssetHandle<T>::operator=(const AssetHandle& handle) noexcept {
+  if (&handle == this)
+    return *this;
+
+  release();
+  m_entry = handle.m_entry;
+  acquire();
+
+  return *this;
+}
+
+template <typename T>
+AssetHandle<T>& AssetHandle<T>::operator=(AssetHandle&& handle) noexcept {
+  if (&handle == this)
+    return *this;
+
+  release();
+  m_entry = std::move(handle.m_entry);
+
+  return *this;
+}
+
+} // namespace Raz
+
+#endif // RAZ_ASSETMANAGER_HPP
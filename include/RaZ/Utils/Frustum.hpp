@@ -0,0 +1,85 @@
+#pragma once
+
+#ifndef RAZ_FRUSTUM_HPP
+#define RAZ_FRUSTUM_HPP
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <array>
+#include <vector>
+
+namespace Raz {
+
+struct BoxBatch;
+struct SphereBatch;
+
+/// Position of a shape relatively to a frustum.
+enum class Visibility : uint8_t {
+  OUTSIDE,      ///< The shape is entirely outside of the frustum.
+  INTERSECTING, ///< The shape may be partly inside the frustum; its children, if any, must be tested individually.
+  INSIDE        ///< The shape is entirely inside the frustum, as are all of its children.
+};
+
+/// Frustum defined by six planes, whose normals all point inward.
+/// The shapes are tested against each plane independently; a shape close to the frustum's edges may thus be considered intersecting while it
+///   actually is outside. Such a test never culls a visible shape, which makes it suited for visibility determination.
+class Frustum {
+public:
+  /// Creates a frustum by extracting the planes from a view-projection matrix, with [Gribb & Hartmann's method](https://www.gamedevs.org/uploads/fast-extraction-viewing-frustum-planes-from-world-view-projection-matrix.pdf).
+  /// The clip space is assumed to be OpenGL's, with all coordinates between -w & w.
+  /// \param viewProjMat View-projection matrix, as computed by the product of the view matrix and the projection matrix.
+  explicit Frustum(const Mat4f& viewProjMat);
+
+  /// Gets the frustum's planes, in the following order: left, right, bottom, top, near & far.
+  /// \return Frustum's planes.
+  const std::array<Plane, 6>& getPlanes() const { return m_planes; }
+
+  /// Point containment check.
+  /// \param point Point to be checked.
+  /// \return True if the point is inside the frustum or on its boundaries, false otherwise.
+  bool contains(const Vec3f& point) const;
+  /// Frustum-sphere intersection check.
+  /// \param sphere Sphere to check if there is an intersection with.
+  /// \return True if the sphere is at least partly inside the frustum, false otherwise.
+  bool intersects(const Sphere& sphere) const { return (computeVisibility(sphere) != Visibility::OUTSIDE); }
+  /// Frustum-AABB intersection check.
+  /// \param aabb AABB to check if there is an intersection with.
+  /// \return True if the AABB is at least partly inside the frustum, false otherwise.
+  bool intersects(const AABB& aabb) const { return (computeVisibility(aabb) != Visibility::OUTSIDE); }
+  /// Frustum-OBB intersection check.
+  /// \param obb OBB to check if there is an intersection with.
+  /// \return True if the OBB is at least partly inside the frustum, false otherwise.
+  bool intersects(const OBB& obb) const { return (computeVisibility(obb) != Visibility::OUTSIDE); }
+  /// Computes the visibility of a sphere.
+  /// \param sphere Sphere to be tested.
+  /// \return Position of the sphere relatively to the frustum.
+  Visibility computeVisibility(const Sphere& sphere) const;
+  /// Computes the visibility of an AABB.
+  /// \param aabb AABB to be tested.
+  /// \return Position of the AABB relatively to the frustum.
+  Visibility computeVisibility(const AABB& aabb) const;
+  /// Computes the visibility of an OBB.
+  /// \param obb OBB to be tested.
+  /// \return Position of the OBB relatively to the frustum.
+  Visibility computeVisibility(const OBB& obb) const;
+  /// Computes the visibility of all spheres of a batch.
+  /// Several spheres are tested at once with SIMD instructions (SSE, or AVX with the RAZ_USE_AVX2 CMake option), and large batches are split across
+  ///   threads. The results are the exact same as those given by the single-sphere computeVisibility().
+  /// \param spheres Spheres to be tested.
+  /// \param visibilities Positions of the spheres relatively to the frustum. Resized to hold as many values as there are spheres.
+  void computeVisibility(const SphereBatch& spheres, std::vector<Visibility>& visibilities) const;
+  /// Computes the visibility of all boxes of a batch.
+  /// Several boxes are tested at once with SIMD instructions (SSE, or AVX with the RAZ_USE_AVX2 CMake option), and large batches are split across
+  ///   threads. The results are the exact same as those given by the single-AABB computeVisibility().
+  /// \param boxes Boxes to be tested.
+  /// \param visibilities Positions of the boxes relatively to the frustum. Resized to hold as many values as there are boxes.
+  void computeVisibility(const BoxBatch& boxes, std::vector<Visibility>& visibilities) const;
+
+private:
+  std::array<Plane, 6> m_planes;
+};
+
+} // namespace Raz
+
+#endif // RAZ_FRUSTUM_HPP
@@ -127,6 +127,7 @@ public:
   unsigned int getWidth() const { return m_width; }
   unsigned int getHeight() const { return m_height; }
   ImageColorspace getColorspace() const { return m_colorspace; }
+  uint8_t getChannelCount() const { return m_channelCount; }
   ImageDataType getDataType() const { return m_data->getDataType(); }
   const void* getDataPtr() const { return m_data->getDataPtr(); }
   void* getDataPtr() { return m_data->getDataPtr(); }
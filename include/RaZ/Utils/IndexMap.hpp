@@ -0,0 +1,68 @@
+#pragma once
+
+#ifndef RAZ_INDEXMAP_HPP
+#define RAZ_INDEXMAP_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Raz {
+
+/// IndexMap class, associating unique keys to consecutive indices in their order of insertion.
+/// This class is implemented as an [open-addressing](https://en.wikipedia.org/wiki/Open_addressing) hash table with linear probing, whose slots only
+///   store indices into a contiguous list of keys; it is mainly intended to deduplicate values, such as vertices, with neither per-element allocation
+///   nor tree traversal.
+/// \tparam KeyT Type of the keys.
+/// \tparam HashT Type of the hasher, returning an integer from a key. The lower bits of the hash being used, they must be well distributed.
+/// \tparam EqualT Type of the equality predicate between two keys.
+template <typename KeyT, typename HashT = std::hash<KeyT>, typename EqualT = std::equal_to<KeyT>>
+class IndexMap {
+public:
+  /// Value returned when looking for a key which does not exist in the map.
+  static constexpr unsigned int invalidIndex = std::numeric_limits<unsigned int>::max();
+
+  /// Creates an index map.
+  /// \param expectedKeyCount Number of keys expected to be inserted, to avoid rehashing the map.
+  /// \param hasher Hasher to be used on keys.
+  /// \param equal Equality predicate to be used on keys.
+  explicit IndexMap(std::size_t expectedKeyCount = 0, HashT hasher = HashT(), EqualT equal = EqualT());
+
+  const std::vector<KeyT>& getKeys() const noexcept { return m_keys; }
+  std::size_t getKeyCount() const noexcept { return m_keys.size(); }
+  bool isEmpty() const noexcept { return m_keys.empty(); }
+
+  /// Reserves enough space to hold the given number of keys without rehashing.
+  /// \param keyCount Number of keys to reserve space for.
+  void reserve(std::size_t keyCount);
+  /// Finds the index associated to the given key, associating it to the next index if not found.
+  /// \param key Key to be found or inserted.
+  /// \return Pair of the key's index & of a boolean indicating whether it has just been inserted.
+  std::pair<unsigned int, bool> emplace(const KeyT& key);
+  /// Finds the index associated to the given key.
+  /// \param key Key to be found.
+  /// \return Index of the key if found, invalidIndex otherwise.
+  unsigned int find(const KeyT& key) const;
+  /// Removes all the keys from the map, keeping its memory allocated.
+  void clear() noexcept;
+  /// Moves the keys out of the map, which is then cleared.
+  /// \return Keys in their order of insertion.
+  std::vector<KeyT> extractKeys() noexcept;
+
+private:
+  void rehash(std::size_t slotCount);
+
+  std::vector<unsigned int> m_slots {};
+  std::vector<KeyT> m_keys {};
+  HashT m_hasher {};
+  EqualT m_equal {};
+};
+
+} // namespace Raz
+
+#include "RaZ/Utils/IndexMap.inl"
+
+#endif // RAZ_INDEXMAP_HPP
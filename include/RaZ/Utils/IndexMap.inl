@@ -0,0 +1,96 @@
+namespace Raz {
+
+template <typename KeyT, typename HashT, typename EqualT>
+IndexMap<KeyT, HashT, EqualT>::IndexMap(std::size_t expectedKeyCount, HashT hasher, EqualT equal)
+  : m_hasher{ std::move(hasher) }, m_equal{ std::move(equal) } {
+  reserve(expectedKeyCount);
+}
+
+template <typename KeyT, typename HashT, typename EqualT>
+void IndexMap<KeyT, HashT, EqualT>::reserve(std::size_t keyCount) {
+  assert("Error: An IndexMap cannot hold more keys than its invalid index." && keyCount < invalidIndex);
+
+  m_keys.reserve(keyCount);
+
+  // The load factor is kept under 0.5, keeping the probe sequences short
+  std::size_t slotCount = 16;
+  while (slotCount < keyCount * 2)
+    slotCount *= 2;
+
+  if (slotCount > m_slots.size())
+    rehash(slotCount);
+}
+
+template <typename KeyT, typename HashT, typename EqualT>
+std::pair<unsigned int, bool> IndexMap<KeyT, HashT, EqualT>::emplace(const KeyT& key) {
+  if ((m_keys.size() + 1) * 2 > m_slots.size())
+    rehash(m_slots.size() * 2);
+
+  const std::size_t slotMask = m_slots.size() - 1;
+  std::size_t slotIndex      = static_cast<std::size_t>(m_hasher(key)) & slotMask;
+
+  while (m_slots[slotIndex] != invalidIndex) {
+    if (m_equal(m_keys[m_slots[slotIndex]], key))
+      return { m_slots[slotIndex], false };
+
+    slotIndex = (slotIndex + 1) & slotMask;
+  }
+
+  assert("Error: An IndexMap cannot hold more keys than its invalid index." && m_keys.size() < invalidIndex);
+
+  const auto keyIndex = static_cast<unsigned int>(m_keys.size());
+  m_slots[slotIndex]  = keyIndex;
+  m_keys.push_back(key);
+
+  return { keyIndex, true };
+}
+
+template <typename KeyT, typename HashT, typename EqualT>
+unsigned int IndexMap<KeyT, HashT, EqualT>::find(const KeyT& key) const {
+  if (m_slots.empty())
+    return invalidIndex;
+
+  const std::size_t slotMask = m_slots.size() - 1;
+  std::size_t slotIndex      = static_cast<std::size_t>(m_hasher(key)) & slotMask;
+
+  while (m_slots[slotIndex] != invalidIndex) {
+    if (m_equal(m_keys[m_slots[slotIndex]], key))
+      return m_slots[slotIndex];
+
+    slotIndex = (slotIndex + 1) & slotMask;
+  }
+
+  return invalidIndex;
+}
+
+template <typename KeyT, typename HashT, typename EqualT>
+void IndexMap<KeyT, HashT, EqualT>::clear() noexcept {
+  std::fill(m_slots.begin(), m_slots.end(), invalidIndex);
+  m_keys.clear();
+}
+
+template <typename KeyT, typename HashT, typename EqualT>
+std::vector<KeyT> IndexMap<KeyT, HashT, EqualT>::extractKeys() noexcept {
+  std::vector<KeyT> keys = std::move(m_keys);
+  clear();
+
+  return keys;
+}
+
+template <typename KeyT, typename HashT, typename EqualT>
+void IndexMap<KeyT, HashT, EqualT>::rehash(std::size_t slotCount) {
+  m_slots.assign(slotCount, invalidIndex);
+
+  const std::size_t slotMask = slotCount - 1;
+
+  for (std::size_t keyIndex = 0; keyIndex < m_keys.size(); ++keyIndex) {
+    std::size_t slotIndex = static_cast<std::size_t>(m_hasher(m_keys[keyIndex])) & slotMask;
+
+    while (m_slots[slotIndex] != invalidIndex)
+      slotIndex = (slotIndex + 1) & slotMask;
+
+    m_slots[slotIndex] = static_cast<unsigned int>(keyIndex);
+  }
+}
+
+} // namespace Raz
@@ -0,0 +1,41 @@
+#pragma once
+
+#ifndef RAZ_MAPPEDFILE_HPP
+#define RAZ_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string_view>
+
+namespace Raz {
+
+class FilePath;
+
+/// Read-only memory mapping of a file, giving access to its whole content without copying it into memory.
+class MappedFile {
+public:
+  /// Maps the given file into memory.
+  /// \param filePath Path to the file to be mapped.
+  explicit MappedFile(const FilePath& filePath);
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&& mappedFile) noexcept;
+
+  const char* getData() const noexcept { return m_data; }
+  std::size_t getSize() const noexcept { return m_size; }
+  std::string_view getContent() const noexcept { return std::string_view(m_data, m_size); }
+  bool isEmpty() const noexcept { return (m_size == 0); }
+
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&& mappedFile) noexcept;
+
+  ~MappedFile() { unmap(); }
+
+private:
+  void unmap() noexcept;
+
+  const char* m_data {};
+  std::size_t m_size {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_MAPPEDFILE_HPP
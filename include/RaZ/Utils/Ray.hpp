@@ -5,6 +5,9 @@
 
 #include "RaZ/Math/Vector.hpp"
 
+#include <array>
+#include <cstdint>
+
 namespace Raz {
 
 class Line;
@@ -15,6 +18,9 @@ class Quad;
 class AABB;
 class OBB;
 
+template <std::size_t Size> struct AABBPacket;
+template <std::size_t Size> struct TrianglePacket;
+
 /// Ray hit used to get informations from a ray intersection.
 struct RayHit {
   Vec3f position {};
@@ -64,26 +70,51 @@ public:
   /// \note The hit normal will always be oriented towards the ray.
   /// \return True if the ray intersects the triangle, false otherwise.
   bool intersects(const Triangle& triangle, RayHit* hit = nullptr) const;
-  /*
+  /// Ray-triangle intersection check from the triangle's raw positions, using the Möller-Trumbore algorithm.
+  /// This avoids constructing a Triangle when only the hit distance is needed, for example when traversing a mesh's triangles.
+  /// \param firstPos First position of the triangle.
+  /// \param secondPos Second position of the triangle.
+  /// \param thirdPos Third position of the triangle.
+  /// \param hitDistance Maximum distance from the ray's origin at which the triangle can be hit; replaced by the hit distance if any.
+  /// \return True if the ray intersects the triangle closer than the given distance, false otherwise.
+  bool intersectsTriangle(const Vec3f& firstPos, const Vec3f& secondPos, const Vec3f& thirdPos, float& hitDistance) const noexcept;
   /// Ray-quad intersection check.
+  /// The quad is checked as the two triangles it is made of.
   /// \param quad Quad to check if there is an intersection with.
   /// \param hit Ray intersection's information to recover.
+  /// \note The hit normal will always be oriented towards the ray.
   /// \return True if the ray intersects the quad, false otherwise.
   bool intersects(const Quad& quad, RayHit* hit = nullptr) const;
-  */
   /// Ray-AABB intersection check.
   /// \param aabb AABB to check if there is an intersection with.
   /// \param hit Ray intersection's information to recover.
   /// \note If returns true with a negative hit distance, the ray is located inside the box & the hit position is the intersection point found behind the ray.
   /// \return True if the ray intersects the AABB, false otherwise.
   bool intersects(const AABB& aabb, RayHit* hit = nullptr) const;
-  /*
   /// Ray-OBB intersection check.
+  /// The ray is transformed into the box's local space, where the check amounts to a ray-AABB one.
   /// \param obb OBB to check if there is an intersection with.
   /// \param hit Ray intersection's information to recover.
+  /// \note If returns true with a negative hit distance, the ray is located inside the box & the hit position is the intersection point found behind the ray.
   /// \return True if the ray intersects the OBB, false otherwise.
   bool intersects(const OBB& obb, RayHit* hit = nullptr) const;
-  */
+  /// Ray-AABBs intersection check, checking the ray against several boxes at once with SIMD instructions when available.
+  /// \tparam Size Number of boxes in the packet; either 4 or 8.
+  /// \param aabbs Packet of boxes to check if there is an intersection with.
+  /// \param hitDistances Distances at which the ray enters each box, or 0 if it starts inside of it. Those of the boxes not hit are set to infinity.
+  /// \param maxDistance Maximum distance from the ray's origin at which a box can be hit.
+  /// \return Bitmask of the active boxes intersected by the ray, the first box being represented by the lowest bit.
+  template <std::size_t Size>
+  uint32_t intersects(const AABBPacket<Size>& aabbs, std::array<float, Size>& hitDistances, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Ray-triangles intersection check, checking the ray against several triangles at once with SIMD instructions when available.
+  /// \tparam Size Number of triangles in the packet; either 4 or 8.
+  /// \param triangles Packet of triangles to check if there is an intersection with.
+  /// \param hitDistances Distances of the hits. Those of the triangles not hit are set to infinity.
+  /// \param maxDistance Maximum distance from the ray's origin at which a triangle can be hit.
+  /// \return Bitmask of the active triangles intersected by the ray, the first triangle being represented by the lowest bit.
+  template <std::size_t Size>
+  uint32_t intersects(const TrianglePacket<Size>& triangles, std::array<float, Size>& hitDistances,
+                      float maxDistance = std::numeric_limits<float>::max()) const;
   /// Computes the projection of a point (closest point) onto the ray.
   /// The projected point is necessarily located between the ray's origin and towards infinity in the ray's direction.
   /// \param point Point to compute the projection from.
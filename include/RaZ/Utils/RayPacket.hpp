@@ -0,0 +1,109 @@
+#pragma once
+
+#ifndef RAZ_RAYPACKET_HPP
+#define RAZ_RAYPACKET_HPP
+
+#include "RaZ/Utils/Ray.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace Raz {
+
+class AABB;
+class Triangle;
+
+/// Packet of rays stored as a structure of arrays, allowing to check several of them at once with SIMD instructions.
+/// A width of 4 uses SSE. A width of 8 uses AVX only if the engine is compiled for it (see the RAZ_USE_AVX2 CMake option), and is otherwise
+///   checked as two halves of 4 rays with SSE. Without SSE, a scalar fallback gives the exact same results.
+/// \tparam Size Number of rays in the packet; either 4 or 8.
+template <std::size_t Size>
+struct alignas(Size * sizeof(float)) RayPacket {
+  static_assert(Size == 4 || Size == 8, "Error: A ray packet can only hold 4 or 8 rays.");
+
+  /// Sets a ray in the packet, marking its lane as active.
+  /// \param index Index of the ray in the packet.
+  /// \param ray Ray to be set.
+  void setRay(std::size_t index, const Ray& ray);
+  /// Recovers a ray from the packet.
+  /// \param index Index of the ray in the packet.
+  /// \return Ray at the given index.
+  Ray recoverRay(std::size_t index) const;
+  /// Checks which rays of the packet intersect an AABB.
+  /// \param aabb AABB to check if there is an intersection with.
+  /// \param hitDistances Distances of the hits. Must contain the maximum allowed distance of each ray; only those of the hitting rays are replaced.
+  ///   The distance is that at which the ray enters the box, or 0 if it starts inside of it.
+  /// \return Bitmask of the active rays intersecting the box, the first ray being represented by the lowest bit.
+  uint32_t intersects(const AABB& aabb, std::array<float, Size>& hitDistances) const;
+  /// Checks which rays of the packet intersect a triangle, using the Möller-Trumbore algorithm.
+  /// \param triangle Triangle to check if there is an intersection with.
+  /// \param hitDistances Distances of the hits. Must contain the maximum allowed distance of each ray; only those of the hitting rays are replaced.
+  /// \return Bitmask of the active rays intersecting the triangle closer than their maximum distance, the first ray being represented by the lowest bit.
+  uint32_t intersects(const Triangle& triangle, std::array<float, Size>& hitDistances) const;
+
+  std::array<float, Size> originX {};
+  std::array<float, Size> originY {};
+  std::array<float, Size> originZ {};
+  std::array<float, Size> directionX {};
+  std::array<float, Size> directionY {};
+  std::array<float, Size> directionZ {};
+  std::array<float, Size> invDirectionX {};
+  std::array<float, Size> invDirectionY {};
+  std::array<float, Size> invDirectionZ {};
+  uint32_t laneMask {}; ///< Bitmask of the packet's active lanes, those which have been given a ray.
+};
+
+/// Packet of axis-aligned bounding boxes stored as a structure of arrays, allowing a ray to be checked against all of them at once.
+/// \tparam Size Number of boxes in the packet; either 4 or 8.
+template <std::size_t Size>
+struct alignas(Size * sizeof(float)) AABBPacket {
+  static_assert(Size == 4 || Size == 8, "Error: An AABB packet can only hold 4 or 8 boxes.");
+
+  /// Sets a box in the packet, marking its lane as active.
+  /// \param index Index of the box in the packet.
+  /// \param aabb Box to be set.
+  void setBox(std::size_t index, const AABB& aabb);
+
+  std::array<float, Size> minX {};
+  std::array<float, Size> minY {};
+  std::array<float, Size> minZ {};
+  std::array<float, Size> maxX {};
+  std::array<float, Size> maxY {};
+  std::array<float, Size> maxZ {};
+  uint32_t laneMask {}; ///< Bitmask of the packet's active lanes, those which have been given a box.
+};
+
+/// Packet of triangles stored as a structure of arrays, allowing a ray to be checked against all of them at once.
+/// Each triangle is stored as its first position & its two edges starting from it, as required by the Möller-Trumbore algorithm.
+/// \tparam Size Number of triangles in the packet; either 4 or 8.
+template <std::size_t Size>
+struct alignas(Size * sizeof(float)) TrianglePacket {
+  static_assert(Size == 4 || Size == 8, "Error: A triangle packet can only hold 4 or 8 triangles.");
+
+  /// Sets a triangle in the packet, marking its lane as active.
+  /// \param index Index of the triangle in the packet.
+  /// \param triangle Triangle to be set.
+  void setTriangle(std::size_t index, const Triangle& triangle);
+
+  std::array<float, Size> firstPosX {};
+  std::array<float, Size> firstPosY {};
+  std::array<float, Size> firstPosZ {};
+  std::array<float, Size> firstEdgeX {};
+  std::array<float, Size> firstEdgeY {};
+  std::array<float, Size> firstEdgeZ {};
+  std::array<float, Size> secondEdgeX {};
+  std::array<float, Size> secondEdgeY {};
+  std::array<float, Size> secondEdgeZ {};
+  uint32_t laneMask {}; ///< Bitmask of the packet's active lanes, those which have been given a triangle.
+};
+
+using RayPacket4      = RayPacket<4>;
+using RayPacket8      = RayPacket<8>;
+using AABBPacket4     = AABBPacket<4>;
+using AABBPacket8     = AABBPacket<8>;
+using TrianglePacket4 = TrianglePacket<4>;
+using TrianglePacket8 = TrianglePacket<8>;
+
+} // namespace Raz
+
+#endif // RAZ_RAYPACKET_HPP
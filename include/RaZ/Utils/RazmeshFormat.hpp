@@ -0,0 +1,95 @@
+#pragma once
+
+#ifndef RAZ_RAZMESHFORMAT_HPP
+#define RAZ_RAZMESHFORMAT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/// Native binary mesh format, whose data are stored as they are laid out in memory & can thus be directly used once the file is memory-mapped.
+///
+/// A file is made of a header followed by several sections, all starting at an offset multiple of 16 bytes:
+///
+///   Header | Submeshes' entries | LODs' entries | Materials' entries | String table | Vertices' blobs | Indices' blobs
+///
+/// The header gives the offsets of the tables, which give in turn those of the blobs.
+///
+/// - Offsets are given in bytes from the beginning of the file, & counts in elements;
+/// - Values are stored in the endianness of the machine which wrote the file, which is checked when reading it;
+/// - Vertices are stored as an array of Vertex, the stride being saved to detect layout mismatches;
+/// - Materials are referenced by their name, defined in a material library (MTL file) located next to the mesh file;
+/// - The checksum covers everything following the header.
+namespace Raz::RazmeshFormat {
+
+constexpr std::array<char, 8> magic = { 'R', 'A', 'Z', 'M', 'E', 'S', 'H', '\0' };
+constexpr uint32_t version          = 1;
+constexpr uint32_t endiannessTag    = 0x01020304;
+constexpr std::size_t alignment     = 16;
+
+/// Reference to a string stored in the string table, which is not null-terminated.
+struct StringRef {
+  uint32_t offset; ///< Offset of the string's first character from the beginning of the string table.
+  uint32_t size;   ///< Number of characters of the string.
+};
+
+struct Header {
+  std::array<char, 8> magic;
+  uint32_t version;
+  uint32_t endiannessTag;
+  uint64_t fileSize;
+  uint64_t checksum;
+  uint32_t vertexStride;
+  uint32_t submeshCount;
+  uint32_t lodCount;
+  uint32_t materialCount;
+  uint64_t submeshTableOffset;
+  uint64_t lodTableOffset;
+  uint64_t materialTableOffset;
+  uint64_t stringTableOffset;
+  uint32_t stringTableSize;
+  StringRef materialLibrary;         ///< Path to the material library, relative to the mesh file. Empty if the mesh has no material.
+  std::array<float, 6> boundingBox;  ///< Mesh's bounding box, given as its minimum & maximum positions.
+  std::array<uint32_t, 3> padding;
+};
+
+struct SubmeshEntry {
+  uint64_t vertexOffset;
+  uint64_t vertexCount;
+  uint64_t indexOffset;
+  uint64_t indexCount;               ///< Number of triangle indices of the most detailed level.
+  uint32_t materialIndex;
+  uint32_t renderMode;
+  uint32_t firstLodIndex;            ///< Index of the first of the submesh's LODs in the LODs' entries.
+  uint32_t lodCount;                 ///< Number of additional levels of detail, ordered from the most to the least detailed.
+  std::array<float, 6> boundingBox;  ///< Submesh's bounding box, given as its minimum & maximum positions.
+  std::array<uint32_t, 2> padding;
+};
+
+/// Additional level of detail of a submesh, whose triangle indices refer to the submesh's vertices.
+struct LodEntry {
+  uint64_t indexOffset;
+  uint64_t indexCount;
+  float error;                       ///< Geometric error of the level compared to the most detailed one.
+  std::array<uint32_t, 3> padding;
+};
+
+struct MaterialEntry {
+  StringRef name;                    ///< Name of the material in the material library.
+};
+
+static_assert(sizeof(Header) == 128, "Error: The razmesh header must be 128 bytes long.");
+static_assert(sizeof(SubmeshEntry) == 80, "Error: A razmesh submesh entry must be 80 bytes long.");
+static_assert(sizeof(LodEntry) == 32, "Error: A razmesh LOD entry must be 32 bytes long.");
+static_assert(sizeof(MaterialEntry) == 8, "Error: A razmesh material entry must be 8 bytes long.");
+
+/// Computes the checksum of the given data, based on [xxHash64](https://github.com/Cyan4973/xxHash).
+/// \param data Data to compute the checksum of.
+/// \param size Size in bytes of the data.
+/// \param seed Value to initialize the checksum with.
+/// \return 64-bit checksum of the data.
+uint64_t computeChecksum(const void* data, std::size_t size, uint64_t seed = 0) noexcept;
+
+} // namespace Raz::RazmeshFormat
+
+#endif // RAZ_RAZMESHFORMAT_HPP
@@ -0,0 +1,129 @@
+#pragma once
+
+#ifndef RAZ_RAZTEXFORMAT_HPP
+#define RAZ_RAZTEXFORMAT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Raz {
+
+class FilePath;
+class Image;
+
+/// Native binary texture format, holding an image along with all its precomputed mipmaps, which can be sent as is to the graphics card.
+///
+/// A file is made of a header followed by the mipmaps' entries & data, all starting at an offset multiple of 16 bytes:
+///
+///   Header | Mipmaps' entries | Mipmaps' data
+///
+/// - Mipmaps are ordered from the most detailed (the original image) down to a 1x1 image, each being half the size of the previous one;
+/// - Pixels are either stored raw, with 8 bits per channel & rows tightly packed, or block-compressed in BC1 (RGB) or BC3 (RGBA);
+/// - Values are stored in the endianness of the machine which wrote the file, which is checked when reading it;
+/// - The checksum covers everything following the header.
+namespace RaztexFormat {
+
+constexpr std::array<char, 8> magic = { 'R', 'A', 'Z', 'T', 'E', 'X', '\0', '\0' };
+constexpr uint32_t version          = 1;
+constexpr uint32_t endiannessTag    = 0x01020304;
+constexpr std::size_t alignment     = 16;
+
+enum class PixelFormat : uint32_t {
+  GRAY       = 0, ///< 1 byte per pixel.
+  GRAY_ALPHA = 1, ///< 2 bytes per pixel.
+  RGB        = 2, ///< 3 bytes per pixel.
+  RGBA       = 3, ///< 4 bytes per pixel.
+  BC1        = 4, ///< RGB, 8 bytes per block of 4x4 pixels.
+  BC3        = 5  ///< RGBA, 16 bytes per block of 4x4 pixels.
+};
+
+enum HeaderFlag : uint32_t {
+  FLIPPED_VERTICALLY = 1 ///< The rows are stored as if the image had been read with a vertical flip.
+};
+
+struct Header {
+  std::array<char, 8> magic;
+  uint32_t version;
+  uint32_t endiannessTag;
+  uint64_t fileSize;
+  uint64_t checksum;
+  uint32_t width;
+  uint32_t height;
+  uint32_t mipmapCount;
+  PixelFormat pixelFormat;
+  uint32_t flags;
+  std::array<uint32_t, 3> padding;
+};
+
+struct MipmapEntry {
+  uint64_t dataOffset;
+  uint64_t dataSize;
+};
+
+static_assert(sizeof(Header) == 64, "Error: The raztex header must be 64 bytes long.");
+static_assert(sizeof(MipmapEntry) == 16, "Error: A raztex mipmap entry must be 16 bytes long.");
+
+/// Mipmap of a texture, whose data point into the memory it has been read from.
+struct Mipmap {
+  unsigned int width;
+  unsigned int height;
+  const uint8_t* data;
+  std::size_t dataSize;
+};
+
+/// Content of a raztex file, referencing the memory it has been read from.
+struct Content {
+  Header header;
+  std::vector<Mipmap> mipmaps;
+};
+
+/// Checks if the given pixel format is block-compressed.
+/// \param pixelFormat Pixel format to be checked.
+/// \return True if the format is block-compressed, false otherwise.
+constexpr bool isCompressed(PixelFormat pixelFormat) noexcept { return (pixelFormat == PixelFormat::BC1 || pixelFormat == PixelFormat::BC3); }
+
+/// Computes the size in bytes of an image's data stored with the given pixel format.
+/// \param width Width of the image.
+/// \param height Height of the image.
+/// \param pixelFormat Format of the pixels.
+/// \return Size in bytes of the image's data.
+std::size_t computeDataSize(unsigned int width, unsigned int height, PixelFormat pixelFormat) noexcept;
+
+/// Compresses an image into blocks of 4x4 pixels; incomplete blocks on the image's borders are filled by repeating the last pixels.
+/// \param pixels Pixels to be compressed, whose rows are tightly packed.
+/// \param width Width of the image.
+/// \param height Height of the image.
+/// \param channelCount Number of channels of the image, either 3 (RGB) or 4 (RGBA). BC1 ignores the alpha channel, which is considered opaque in BC3 if absent.
+/// \param blockFormat Compressed format, either BC1 or BC3.
+/// \return Compressed blocks, ordered from left to right & top to bottom.
+std::vector<uint8_t> compressBlocks(const uint8_t* pixels, unsigned int width, unsigned int height, uint8_t channelCount, PixelFormat blockFormat);
+
+/// Decompresses blocks of 4x4 pixels into an RGBA image.
+/// \param blocks Compressed blocks, ordered from left to right & top to bottom.
+/// \param width Width of the image.
+/// \param height Height of the image.
+/// \param blockFormat Compressed format, either BC1 or BC3.
+/// \return Decompressed pixels, with 4 bytes per pixel & rows tightly packed.
+std::vector<uint8_t> decompressBlocks(const uint8_t* blocks, unsigned int width, unsigned int height, PixelFormat blockFormat);
+
+/// Converts an image into the raztex format, generating its mipmaps with a box filter.
+/// \param image Image to be converted; it must hold bytes, & if compressed must have 3 or 4 channels.
+/// \param compress True to compress the RGB & RGBA images' mipmaps, false to keep them raw.
+/// \param isFlippedVertically True if the image has been read with a vertical flip, false otherwise.
+/// \return Content of the raztex file.
+std::vector<char> cook(const Image& image, bool compress, bool isFlippedVertically);
+
+/// Reads & validates the content of a raztex file, whose mipmaps must all be present.
+/// \param fileContent Content of the file, which must outlive the returned one.
+/// \param filePath Path to the file, used for error messages.
+/// \return Header & mipmaps of the file.
+Content read(std::string_view fileContent, const FilePath& filePath);
+
+} // namespace RaztexFormat
+
+} // namespace Raz
+
+#endif // RAZ_RAZTEXFORMAT_HPP
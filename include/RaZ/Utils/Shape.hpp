@@ -145,6 +145,9 @@ public:
   /// Computes the line's centroid, which is the point lying directly between the two extremities.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_beginPos + m_endPos) * 0.5f; }
+  /// Computes the line's bounding box, containing both its extremities.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const;
   /// Line length computation.
   /// To be used if the actual length is needed; otherwise, prefer computeSquaredLength().
   /// \return Line's length.
@@ -217,6 +220,10 @@ public:
   /// Computes the plane's centroid, which is the point lying onto the plane at its distance from the center in its normal direction.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return m_normal * m_distance; }
+  /// Computes the plane's bounding box.
+  /// \note A plane being infinite, its bounding box spans over the whole space, with its extremities set to the lowest & highest float values.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const;
 
 private:
   float m_distance {};
@@ -277,6 +284,9 @@ public:
   /// Computes the sphere's centroid, which is its center. Strictly equivalent to getCenterPos().
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return m_centerPos; }
+  /// Computes the sphere's bounding box.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const;
 
 private:
   Vec3f m_centerPos {};
@@ -339,6 +349,9 @@ public:
   /// Computes the triangle's centroid, which is the point lying directly between its three points.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_firstPos + m_secondPos + m_thirdPos) / 3.f; }
+  /// Computes the triangle's bounding box.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const;
   /// Computes the triangle's normal from its points.
   /// \return Computed normal.
   Vec3f computeNormal() const;
@@ -404,7 +417,7 @@ public:
   /// \param ray Ray to check if there is an intersection with.
   /// \param hit Optional ray intersection's information to recover (nullptr if unneeded).
   /// \return True if the ray intersects the quad, false otherwise.
-  bool intersects(const Ray&, RayHit*) const override { throw std::runtime_error("Error: Not implemented yet."); }
+  bool intersects(const Ray& ray, RayHit* hit) const override { return ray.intersects(*this, hit); }
   /// Computes the projection of a point (closest point) onto the quad.
   /// The projected point is necessarily located on the quad's surface.
   /// \param point Point to compute the projection from.
@@ -413,6 +426,9 @@ public:
   /// Computes the quad's centroid, which is the point lying directly between its four points.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_leftTopPos + m_rightTopPos + m_rightBottomPos + m_leftBottomPos) * 0.25f; }
+  /// Computes the quad's bounding box.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const;
 
 private:
   Vec3f m_leftTopPos {};
@@ -502,6 +518,9 @@ public:
   /// Computes the AABB's centroid, which is the point lying directly between its two extremities.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_rightTopFrontPos + m_leftBottomBackPos) * 0.5f; }
+  /// Computes the AABB's bounding box, which is itself.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const { return *this; }
   /// Computes the half extents of the box, starting from its centroid.
   ///
   ///          _______________________
@@ -573,13 +592,14 @@ private:
 class OBB final : public Shape {
 public:
   OBB(const Vec3f& leftBottomBackPos, const Vec3f& rightTopFrontPos, const Mat3f& rotation = Mat3f::identity())
-    : m_aabb(leftBottomBackPos, rightTopFrontPos), m_rotation{ rotation } {}
-  explicit OBB(const AABB& aabb, const Mat3f& rotation = Mat3f::identity()) : m_aabb{ aabb }, m_rotation{ rotation } {}
+    : m_aabb(leftBottomBackPos, rightTopFrontPos), m_rotation{ rotation }, m_invRotation{ rotation.inverse() } {}
+  explicit OBB(const AABB& aabb, const Mat3f& rotation = Mat3f::identity()) : m_aabb{ aabb }, m_rotation{ rotation }, m_invRotation{ rotation.inverse() } {}
 
   ShapeType getType() const noexcept override { return ShapeType::OBB; }
   const Vec3f& getLeftBottomBackPos() const { return m_aabb.getLeftBottomBackPos(); }
   const Vec3f& getRightTopFrontPos() const { return m_aabb.getRightTopFrontPos(); }
   const Mat3f& getRotation() const { return m_rotation; }
+  const Mat3f& getInverseRotation() const { return m_invRotation; }
 
   void setRotation(const Mat3f& rotation);
 
@@ -619,7 +639,7 @@ public:
   /// \param ray Ray to check if there is an intersection with.
   /// \param hit Optional ray intersection's information to recover (nullptr if unneeded).
   /// \return True if the ray intersects the OBB, false otherwise.
-  bool intersects(const Ray&, RayHit*) const override { throw std::runtime_error("Error: Not implemented yet."); }
+  bool intersects(const Ray& ray, RayHit* hit) const override { return ray.intersects(*this, hit); }
   /// Computes the projection of a point (closest point) onto the OBB.
   /// The projected point may be inside the AABB itself or on its surface.
   /// \param point Point to compute the projection from.
@@ -628,6 +648,9 @@ public:
   /// Computes the OBB's centroid, which is the point lying directly between its two extremities.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return m_aabb.computeCentroid(); }
+  /// Computes the OBB's axis-aligned bounding box, containing all of its rotated corners.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const;
   /// Computes the half extents of the box, starting from its centroid.
   /// These half extents are oriented according to the box's rotation.
   ///
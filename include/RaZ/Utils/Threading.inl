@@ -12,25 +12,24 @@ template <typename ContainerType, typename Func, typename>
 void parallelize(const ContainerType& collection, Func&& action, std::size_t threadCount) {
   assert("Error: The number of threads can't be 0." && threadCount != 0);
 
+  if (std::size(collection) == 0)
+    return;
+
   std::vector<std::thread> threads(std::min(threadCount, std::size(collection)));
 
-  // This performs a mathematical round: if the result of the division gives a number below X.5, ceil it; otherwise, round it
-  const std::size_t rangeCount = (std::size(collection) + threadCount / 2) / threadCount;
+  // Each thread gets the same number of elements, the first ones receiving one more to share the remainder of the division
+  const std::size_t rangeCount     = std::size(collection) / threads.size();
+  const std::size_t remainderCount = std::size(collection) % threads.size();
 
   std::size_t beginIndex = 0;
-  std::size_t endIndex   = rangeCount;
 
-  // Creating one thread per slice, minus one to avoid getting one more element in the last thread if the size is indivisible
-  for (std::size_t threadIndex = 0; threadIndex < threads.size() - 1; ++threadIndex) {
+  for (std::size_t threadIndex = 0; threadIndex < threads.size(); ++threadIndex) {
+    const std::size_t endIndex = beginIndex + rangeCount + (threadIndex < remainderCount ? 1 : 0);
     threads[threadIndex] = std::thread(action, IndexRange{ beginIndex, endIndex });
 
     beginIndex = endIndex;
-    endIndex  += rangeCount;
   }
 
-  // The last thread is created independently with just the remaining number of elements
-  threads.back() = std::thread(action, IndexRange{ beginIndex, std::min(endIndex, std::size(collection)) });
-
   for (std::thread& thread : threads)
     thread.join();
 }
@@ -0,0 +1,46 @@
+#pragma once
+
+#ifndef RAZ_VIRTUALFILESYSTEM_HPP
+#define RAZ_VIRTUALFILESYSTEM_HPP
+
+#include "RaZ/Utils/AssetArchive.hpp"
+
+#include <optional>
+#include <string>
+
+namespace Raz {
+
+class FilePath;
+
+/// Virtual file system, resolving paths into mounted asset archives; loaders taking a file path look for it there before reading the actual file.
+///
+/// Archives are mounted at a given point, so that an entry 'meshes/ball.obj' of an archive mounted at 'assets/' is found from the path 'assets/meshes/ball.obj'.
+/// \note Mounting or unmounting archives must not be done while assets are being loaded, neither while archived data are still in use.
+namespace VirtualFileSystem {
+
+/// Mounts an archive. If several archives hold an entry with the same path, the latest mounted one prevails.
+/// \param archivePath Path to the archive to be mounted.
+/// \param mountPoint Path at which the archive's root is mounted; if empty, the entries' paths are taken as is.
+void mount(const FilePath& archivePath, const FilePath& mountPoint = {});
+/// Unmounts an archive.
+/// \param archivePath Path of the archive to be unmounted, as given when mounting it.
+void unmount(const FilePath& archivePath);
+/// Unmounts all the archives.
+void unmountAll();
+/// Checks if any archive is mounted.
+/// \return True if at least one archive is mounted, false otherwise.
+bool hasMountedArchives();
+/// Finds an entry in the mounted archives.
+/// \param filePath Path to the entry; it is normalized, removing any '.' or '..' component & using '/' as a separator.
+/// \return Entry if found, none otherwise.
+std::optional<ArchiveEntry> find(const FilePath& filePath);
+/// Normalizes a path, removing any '.' or '..' component (when possible) & using '/' as a separator.
+/// \param path Path to be normalized.
+/// \return Normalized path.
+std::string normalizePath(std::string path);
+
+} // namespace VirtualFileSystem
+
+} // namespace Raz
+
+#endif // RAZ_VIRTUALFILESYSTEM_HPP
@@ -3,8 +3,17 @@
 layout(location = 0) in vec3 vertPosition;
 layout(location = 1) in vec2 vertTexcoords;
 layout(location = 2) in vec3 vertNormal;
-layout(location = 3) in vec3 vertTangent;
+layout(location = 3) in vec4 vertTangent;
 
+// Compact vertex layouts, set per submesh
+struct VertexFormat {
+  bool quantizedPositions; // Positions relative to the bounding box, between 0 & 1
+  vec3 positionOffset;
+  vec3 positionScale;
+  bool octahedralNormals;  // Normals & tangents encoded onto an octahedron, in their 2 first components
+};
+
+uniform VertexFormat uniVertexFormat;
 uniform mat4 uniModelMatrix;
 uniform mat4 uniMvpMatrix;
 
@@ -14,16 +23,31 @@ out MeshInfo {
   mat3 vertTBNMatrix;
 } fragMeshInfo;
 
+vec3 decodeOctahedral(vec2 coords) {
+  vec3 normal = vec3(coords, 1.0 - abs(coords.x) - abs(coords.y));
+
+  // Unfolding the lower hemisphere
+  float foldOffset = max(-normal.z, 0.0);
+  normal.x += (normal.x >= 0.0 ? -foldOffset : foldOffset);
+  normal.y += (normal.y >= 0.0 ? -foldOffset : foldOffset);
+
+  return normal;
+}
+
 void main() {
-  fragMeshInfo.vertPosition  = (uniModelMatrix * vec4(vertPosition, 1.0)).xyz;
+  vec3 position      = (uniVertexFormat.quantizedPositions ? uniVertexFormat.positionOffset + vertPosition * uniVertexFormat.positionScale : vertPosition);
+  vec3 vertexNormal  = (uniVertexFormat.octahedralNormals ? decodeOctahedral(vertNormal.xy) : vertNormal);
+  vec3 vertexTangent = (uniVertexFormat.octahedralNormals ? decodeOctahedral(vertTangent.xy) : vertTangent.xyz);
+
+  fragMeshInfo.vertPosition  = (uniModelMatrix * vec4(position, 1.0)).xyz;
   fragMeshInfo.vertTexcoords = vertTexcoords;
 
   mat3 modelMat = mat3(uniModelMatrix);
 
-  vec3 tangent   = normalize(modelMat * vertTangent);
-  vec3 normal    = normalize(modelMat * vertNormal);
-  vec3 bitangent = cross(normal, tangent);
+  vec3 tangent   = normalize(modelMat * vertexTangent);
+  vec3 normal    = normalize(modelMat * vertexNormal);
+  vec3 bitangent = cross(normal, tangent) * sign(vertTangent.w);
   fragMeshInfo.vertTBNMatrix = mat3(tangent, bitangent, normal);
 
-  gl_Position = uniMvpMatrix * vec4(vertPosition, 1.0);
+  gl_Position = uniMvpMatrix * vec4(position, 1.0);
 }
@@ -1,4 +1,5 @@
 #include "RaZ/Audio/Listener.hpp"
+#include "RaZ/Math/FastMath.hpp"
 
 #include <AL/al.h>
 
@@ -29,8 +30,10 @@ void Listener::setVelocity(const Vec3f& velocity) const noexcept {
 }
 
 void Listener::setOrientation(const Vec3f& forwardDirection, const Vec3f& upDirection) const noexcept {
-  assert("Error: The Listener's forward direction must be normalized." && FloatUtils::areNearlyEqual(forwardDirection.computeLength(), 1.f));
-  assert("Error: The Listener's up direction must be normalized." && FloatUtils::areNearlyEqual(upDirection.computeLength(), 1.f));
+  assert("Error: The Listener's forward direction must be normalized."
+         && FloatUtils::areNearlyEqual(forwardDirection.computeLength(), 1.f, FastMath::comparisonTolerance));
+  assert("Error: The Listener's up direction must be normalized."
+         && FloatUtils::areNearlyEqual(upDirection.computeLength(), 1.f, FastMath::comparisonTolerance));
 
   const Vector<float, 6> orientation(forwardDirection[0], forwardDirection[1], forwardDirection[2],
                                      upDirection[0], upDirection[1], upDirection[2]);
@@ -0,0 +1,288 @@
+#include "RaZ/Math/FastMath.hpp"
+#include "RaZ/Math/SimdLanes.hpp"
+
+#include <array>
+#include <limits>
+#include <type_traits>
+
+namespace Raz::FastMath {
+
+namespace {
+
+constexpr float pi       = 3.14159265f;
+constexpr float halfPi   = 1.57079632f;
+constexpr float invPi    = 0.318309873f;
+constexpr float log2e    = 1.44269502f;
+constexpr float sqrtTwo  = 1.41421354f;
+constexpr float infinity = std::numeric_limits<float>::infinity();
+constexpr float quietNan = std::numeric_limits<float>::quiet_NaN();
+
+// Parts of pi & ln(2) used for Cody-Waite range reductions: the first ones having few significant bits, their products by small integers are exact
+constexpr float piPart1  = 3.140625f;
+constexpr float piPart2  = 0.000965118408203125f;
+constexpr float piPart3  = 2.53518169e-06f;
+constexpr float ln2Part1 = 0.693359375f;
+constexpr float ln2Part2 = -2.12194442e-04f;
+
+// Adding then subtracting this value rounds any float below 2^22 to the nearest integer
+constexpr float roundingMagic = 12582912.f; // 1.5 * 2^23
+
+// Minimax polynomials coefficients, sorted by increasing degree, computed with the Remez algorithm unless stated otherwise
+// sin(x) ~= x * P(x^2) for x in [-pi/2; pi/2]
+constexpr std::array<float, 3> sinLowCoeffs  = { 9.9990089527e-01f, -1.6591104200e-01f, 7.5702116418e-03f };
+constexpr std::array<float, 5> sinHighCoeffs = { 9.9999999916e-01f, -1.6666662484e-01f, 8.3331307782e-03f, -1.9813423871e-04f, 2.6125380356e-06f };
+// atan(x) ~= x * P(x^2) for x in [0; 1]
+constexpr std::array<float, 4> atanLowCoeffs  = { 9.9921381257e-01f, -3.2117496931e-01f, 1.4626446359e-01f, -3.8986514158e-02f };
+constexpr std::array<float, 8> atanHighCoeffs = { 9.9999933558e-01f, -3.3329860785e-01f, 1.9946565657e-01f, -1.3908629580e-01f,
+                                                  9.6421974095e-02f, -5.5912327930e-02f, 2.1862958708e-02f, -4.0545674499e-03f };
+// acos(x) ~= sqrt(1 - x) * P(x) for x in [0; 1], from Abramowitz & Stegun (formulas 4.4.45 & 4.4.46)
+constexpr std::array<float, 4> acosLowCoeffs  = { 1.5707288f, -0.2121144f, 0.0742610f, -0.0187293f };
+constexpr std::array<float, 8> acosHighCoeffs = { 1.5707963050f, -0.2145988016f, 0.0889789874f, -0.0501743046f,
+                                                  0.0308918810f, -0.0170881256f, 0.0066700901f, -0.0012624911f };
+// exp(x) ~= P(x) for x in [-ln(2)/2; ln(2)/2], minimizing the relative error
+constexpr std::array<float, 4> expLowCoeffs  = { 9.9992807354e-01f, 1.0001641858e+00f, 5.0496326418e-01f, 1.6566842348e-01f };
+constexpr std::array<float, 6> expHighCoeffs = { 1.0000000717e+00f, 9.9999969199e-01f, 4.9998894851e-01f,
+                                                 1.6667574729e-01f, 4.1915381992e-02f, 8.2976550804e-03f };
+// log((1 + s) / (1 - s)) = 2 * atanh(s) ~= s * P(s^2) for s in [0; (sqrt(2) - 1) / (sqrt(2) + 1)]
+constexpr std::array<float, 2> logLowCoeffs  = { 1.9998880483e+00f, 6.8173417197e-01f };
+constexpr std::array<float, 3> logHighCoeffs = { 2.0000008370e+00f, 6.6644078042e-01f, 4.1517706009e-01f };
+
+// The scalar lanes are used by the single-value functions: the array functions, performing the exact same operations, thus give identical results
+using SimdLanes::ScalarLanes;
+
+template <typename LanesT, std::size_t CoeffCount>
+LanesT evaluatePolynomial(LanesT value, const std::array<float, CoeffCount>& coeffs) {
+  // Horner's method, from the highest degree to the lowest
+  LanesT res = LanesT::broadcast(coeffs.back());
+  for (std::size_t coeffIndex = CoeffCount - 1; coeffIndex > 0; --coeffIndex)
+    res = res * value + LanesT::broadcast(coeffs[coeffIndex - 1]);
+  return res;
+}
+
+template <Precision P, typename LanesT>
+LanesT computeSinCos(LanesT angle, bool isCosine) {
+  // Reducing the angle to [-pi/2; pi/2]: sin(x) = (-1)^k * sin(x - k * pi), & cos(x) = (-1)^(k + 1) * sin(x - (k + 1/2) * pi)
+  const LanesT offset   = LanesT::broadcast(isCosine ? 0.5f : 0.f);
+  const LanesT quotient = (angle * LanesT::broadcast(invPi) - offset + LanesT::broadcast(roundingMagic)) - LanesT::broadcast(roundingMagic);
+  const LanesT multiple = quotient + offset;
+
+  const LanesT reduced = ((angle - multiple * LanesT::broadcast(piPart1)) - multiple * LanesT::broadcast(piPart2)) - multiple * LanesT::broadcast(piPart3);
+
+  // The sign depends on the parity of the quotient (incremented for the cosine): its half has a fractional part of 0.5 if odd, 0 otherwise
+  const LanesT halfQuotient = quotient * LanesT::broadcast(0.5f) + offset;
+  const LanesT sign         = LanesT::broadcast(1.f) - (halfQuotient - LanesT::floor(halfQuotient)) * LanesT::broadcast(4.f);
+
+  const LanesT sqReduced = reduced * reduced;
+  const LanesT sine      = reduced * (P == Precision::LOW ? evaluatePolynomial(sqReduced, sinLowCoeffs) : evaluatePolynomial(sqReduced, sinHighCoeffs));
+
+  return sine * sign;
+}
+
+template <Precision P, typename LanesT>
+LanesT computeAcos(LanesT value) {
+  // acos(-x) = pi - acos(x)
+  const LanesT absValue = LanesT::abs(value);
+  const LanesT absAcos  = LanesT::sqrt(LanesT::broadcast(1.f) - absValue)
+                        * (P == Precision::LOW ? evaluatePolynomial(absValue, acosLowCoeffs) : evaluatePolynomial(absValue, acosHighCoeffs));
+
+  return LanesT::select(LanesT::greater(LanesT::broadcast(0.f), value), LanesT::broadcast(pi) - absAcos, absAcos);
+}
+
+template <Precision P, typename LanesT>
+LanesT computeAtan2(LanesT y, LanesT x) {
+  const LanesT zero = LanesT::broadcast(0.f);
+  const LanesT absX = LanesT::abs(x);
+  const LanesT absY = LanesT::abs(y);
+
+  // Computing the arc tangent in [0; pi/4] from the ratio of the smallest value over the largest, then deducing the actual angle from symmetries
+  const LanesT maxValue = LanesT::max(absX, absY);
+  const LanesT ratio    = LanesT::select(LanesT::greater(maxValue, zero), LanesT::min(absX, absY) / maxValue, zero);
+  const LanesT sqRatio  = ratio * ratio;
+
+  LanesT angle = ratio * (P == Precision::LOW ? evaluatePolynomial(sqRatio, atanLowCoeffs) : evaluatePolynomial(sqRatio, atanHighCoeffs));
+  angle = LanesT::select(LanesT::greater(absY, absX), LanesT::broadcast(halfPi) - angle, angle);
+  angle = LanesT::select(LanesT::greater(zero, x), LanesT::broadcast(pi) - angle, angle);
+
+  return LanesT::select(LanesT::greater(zero, y), zero - angle, angle);
+}
+
+template <Precision P, typename LanesT>
+LanesT computeExp(LanesT value) {
+  // Values are clamped so that the powers of 2 can be represented; the results then respectively underflow & overflow
+  // The value is given as the second operand of the maximum, so that NaN is propagated
+  const LanesT clamped = LanesT::min(LanesT::broadcast(89.f), LanesT::max(LanesT::broadcast(-104.f), value));
+
+  // exp(x) = 2^k * exp(x - k * ln(2)), with k the integer closest to x / ln(2)
+  const LanesT exponent = (clamped * LanesT::broadcast(log2e) + LanesT::broadcast(roundingMagic)) - LanesT::broadcast(roundingMagic);
+  const LanesT reduced  = (clamped - exponent * LanesT::broadcast(ln2Part1)) - exponent * LanesT::broadcast(ln2Part2);
+
+  const LanesT reducedExp = (P == Precision::LOW ? evaluatePolynomial(reduced, expLowCoeffs) : evaluatePolynomial(reduced, expHighCoeffs));
+
+  // The exponent can lie outside of the range of normal floats' exponents; the power of 2 is thus applied in two halves
+  const LanesT halfExponent = LanesT::floor(exponent * LanesT::broadcast(0.5f));
+  return reducedExp * LanesT::computePow2(halfExponent) * LanesT::computePow2(exponent - halfExponent);
+}
+
+template <Precision P, typename LanesT>
+LanesT computeLog(LanesT value) {
+  const LanesT zero = LanesT::broadcast(0.f);
+  const LanesT one  = LanesT::broadcast(1.f);
+
+  // Subnormal values are scaled up to be normal, so that they can be decomposed
+  const typename LanesT::Mask isSubnormal = LanesT::greater(LanesT::broadcast(std::numeric_limits<float>::min()), value);
+  const LanesT normalValue = LanesT::select(isSubnormal, value * LanesT::broadcast(8388608.f), value); // 2^23
+
+  // log(x) = log(m) + e * ln(2), with the mantissa m in [sqrt(2)/2; sqrt(2)[
+  LanesT mantissa = zero;
+  LanesT exponent = zero;
+  LanesT::decompose(normalValue, mantissa, exponent);
+
+  const typename LanesT::Mask isMantissaHigh = LanesT::greater(mantissa, LanesT::broadcast(sqrtTwo));
+  mantissa = LanesT::select(isMantissaHigh, mantissa * LanesT::broadcast(0.5f), mantissa);
+  exponent = exponent + LanesT::select(isMantissaHigh, one, zero) - LanesT::select(isSubnormal, LanesT::broadcast(23.f), zero);
+
+  // log(m) = 2 * atanh(s), with s = (m - 1) / (m + 1)
+  const LanesT ratio       = (mantissa - one) / (mantissa + one);
+  const LanesT sqRatio     = ratio * ratio;
+  const LanesT mantissaLog = ratio * (P == Precision::LOW ? evaluatePolynomial(sqRatio, logLowCoeffs) : evaluatePolynomial(sqRatio, logHighCoeffs));
+
+  LanesT res = (mantissaLog + exponent * LanesT::broadcast(ln2Part2)) + exponent * LanesT::broadcast(ln2Part1);
+
+  // Handling special values: negative values & NaN give NaN, 0 gives -infinity & infinity is kept as is
+  res = LanesT::select(LanesT::greater(value, zero), res, LanesT::broadcast(quietNan));
+  res = LanesT::select(LanesT::equal(value, zero), LanesT::broadcast(-infinity), res);
+  return LanesT::select(LanesT::equal(value, LanesT::broadcast(infinity)), value, res);
+}
+
+} // namespace
+
+template <Precision P>
+float sin(float angle) noexcept {
+  return computeSinCos<P>(ScalarLanes{ angle }, false).value;
+}
+
+template <Precision P>
+float cos(float angle) noexcept {
+  return computeSinCos<P>(ScalarLanes{ angle }, true).value;
+}
+
+template <Precision P>
+float acos(float value) noexcept {
+  return computeAcos<P>(ScalarLanes{ value }).value;
+}
+
+template <Precision P>
+float atan2(float y, float x) noexcept {
+  return computeAtan2<P>(ScalarLanes{ y }, ScalarLanes{ x }).value;
+}
+
+template <Precision P>
+float exp(float value) noexcept {
+  return computeExp<P>(ScalarLanes{ value }).value;
+}
+
+template <Precision P>
+float log(float value) noexcept {
+  return computeLog<P>(ScalarLanes{ value }).value;
+}
+
+template <Precision P>
+void rsqrt(const float* values, float* results, std::size_t count) noexcept {
+  SimdLanes::processLanes(0, count, [values, results] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+
+    if constexpr (std::is_same_v<LanesT, ScalarLanes>) {
+      results[index] = rsqrt<P>(values[index]);
+    } else {
+      // Same refinement as the single-value function with SSE
+      const LanesT value    = LanesT::load(values + index);
+      const LanesT estimate = LanesT::estimateRsqrt(value);
+
+      if constexpr (P == Precision::LOW) {
+        estimate.store(results + index);
+      } else {
+        const LanesT refined = estimate * (LanesT::broadcast(1.5f) - LanesT::broadcast(0.5f) * value * estimate * estimate);
+        // Refining infinite estimates (for values of 0) gives NaN, in which case the estimate is kept
+        LanesT::select(LanesT::equal(refined, refined), refined, estimate).store(results + index);
+      }
+    }
+  });
+}
+
+template <Precision P>
+void sin(const float* angles, float* results, std::size_t count) noexcept {
+  SimdLanes::processLanes(0, count, [angles, results] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+    computeSinCos<P>(LanesT::load(angles + index), false).store(results + index);
+  });
+}
+
+template <Precision P>
+void cos(const float* angles, float* results, std::size_t count) noexcept {
+  SimdLanes::processLanes(0, count, [angles, results] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+    computeSinCos<P>(LanesT::load(angles + index), true).store(results + index);
+  });
+}
+
+template <Precision P>
+void acos(const float* values, float* results, std::size_t count) noexcept {
+  SimdLanes::processLanes(0, count, [values, results] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+    computeAcos<P>(LanesT::load(values + index)).store(results + index);
+  });
+}
+
+template <Precision P>
+void atan2(const float* yValues, const float* xValues, float* results, std::size_t count) noexcept {
+  SimdLanes::processLanes(0, count, [yValues, xValues, results] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+    computeAtan2<P>(LanesT::load(yValues + index), LanesT::load(xValues + index)).store(results + index);
+  });
+}
+
+template <Precision P>
+void exp(const float* values, float* results, std::size_t count) noexcept {
+  SimdLanes::processLanes(0, count, [values, results] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+    computeExp<P>(LanesT::load(values + index)).store(results + index);
+  });
+}
+
+template <Precision P>
+void log(const float* values, float* results, std::size_t count) noexcept {
+  SimdLanes::processLanes(0, count, [values, results] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+    computeLog<P>(LanesT::load(values + index)).store(results + index);
+  });
+}
+
+template float sin<Precision::LOW>(float) noexcept;
+template float sin<Precision::HIGH>(float) noexcept;
+template float cos<Precision::LOW>(float) noexcept;
+template float cos<Precision::HIGH>(float) noexcept;
+template float acos<Precision::LOW>(float) noexcept;
+template float acos<Precision::HIGH>(float) noexcept;
+template float atan2<Precision::LOW>(float, float) noexcept;
+template float atan2<Precision::HIGH>(float, float) noexcept;
+template float exp<Precision::LOW>(float) noexcept;
+template float exp<Precision::HIGH>(float) noexcept;
+template float log<Precision::LOW>(float) noexcept;
+template float log<Precision::HIGH>(float) noexcept;
+
+template void rsqrt<Precision::LOW>(const float*, float*, std::size_t) noexcept;
+template void rsqrt<Precision::HIGH>(const float*, float*, std::size_t) noexcept;
+template void sin<Precision::LOW>(const float*, float*, std::size_t) noexcept;
+template void sin<Precision::HIGH>(const float*, float*, std::size_t) noexcept;
+template void cos<Precision::LOW>(const float*, float*, std::size_t) noexcept;
+template void cos<Precision::HIGH>(const float*, float*, std::size_t) noexcept;
+template void acos<Precision::LOW>(const float*, float*, std::size_t) noexcept;
+template void acos<Precision::HIGH>(const float*, float*, std::size_t) noexcept;
+template void atan2<Precision::LOW>(const float*, const float*, float*, std::size_t) noexcept;
+template void atan2<Precision::HIGH>(const float*, const float*, float*, std::size_t) noexcept;
+template void exp<Precision::LOW>(const float*, float*, std::size_t) noexcept;
+template void exp<Precision::HIGH>(const float*, float*, std::size_t) noexcept;
+template void log<Precision::LOW>(const float*, float*, std::size_t) noexcept;
+template void log<Precision::HIGH>(const float*, float*, std::size_t) noexcept;
+
+} // namespace Raz::FastMath
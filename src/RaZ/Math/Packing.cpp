@@ -0,0 +1,431 @@
+#include "RaZ/Math/Packing.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#define RAZ_PACKING_F16C
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RAZ_PACKING_SSE
+#endif
+
+namespace Raz::Packing {
+
+namespace {
+
+static_assert(sizeof(Half) == sizeof(uint16_t), "Error: A half-precision float must take exactly 2 bytes.");
+
+constexpr uint32_t floatSignMask     = 0x80000000u;
+constexpr uint32_t floatAbsMask      = 0x7FFFFFFFu;
+constexpr uint32_t floatInfinityBits = 0x7F800000u;
+constexpr uint32_t floatQuietBit     = 0x00400000u;
+constexpr uint32_t minifloatMaxBits  = 143u << 23; // 2^16, the lowest float too large to be represented with a 5-bit exponent of bias 15
+constexpr uint32_t minifloatMinBits  = 113u << 23; // 2^-14, the lowest normal value with a 5-bit exponent of bias 15
+constexpr uint32_t rebiasBits        = 112u << 23; // Difference between the float's exponent bias (127) & the minifloat's (15)
+constexpr uint32_t exponentScaleBits = 239u << 23; // 2^112, multiplying a minifloat's shifted bits to give the float value
+
+uint32_t recoverBits(float value) {
+  uint32_t bits {};
+  std::memcpy(&bits, &value, sizeof(float));
+  return bits;
+}
+
+float recoverFloat(uint32_t bits) {
+  float value {};
+  std::memcpy(&value, &bits, sizeof(float));
+  return value;
+}
+
+// Minifloats (half-precision, 11 & 10-bit floats) all have a 5-bit exponent of bias 15 & differ by their mantissa's bit count
+// The conversions follow Fabian Giesen's method (https://gist.github.com/rygorous/2156668), rounding to the nearest value (ties to even)
+//  and keeping the NaNs' highest payload bits with their quiet bit set, as F16C instructions do
+
+template <uint32_t MantissaBitCount>
+constexpr uint32_t computeMantissaShift() { return 23 - MantissaBitCount; }
+
+// Bits of the float whose addition aligns a subnormal minifloat's mantissa on the lowest bits, rounding it in the process
+template <uint32_t MantissaBitCount>
+constexpr uint32_t computeSubnormalMagicBits() { return (127 - 15 + computeMantissaShift<MantissaBitCount>() + 1) << 23; }
+
+template <uint32_t MantissaBitCount>
+uint32_t convertToMinifloat(uint32_t absBits) {
+  constexpr uint32_t shift        = computeMantissaShift<MantissaBitCount>();
+  constexpr uint32_t infinityBits = 31u << MantissaBitCount;
+  constexpr uint32_t mantissaMask = (1u << MantissaBitCount) - 1;
+
+  if (absBits >= minifloatMaxBits) {
+    if (absBits > floatInfinityBits) // NaN
+      return infinityBits | (1u << (MantissaBitCount - 1)) | ((absBits >> shift) & mantissaMask);
+
+    return infinityBits;
+  }
+
+  if (absBits < minifloatMinBits) {
+    constexpr uint32_t magicBits = computeSubnormalMagicBits<MantissaBitCount>();
+    return recoverBits(recoverFloat(absBits) + recoverFloat(magicBits)) - magicBits;
+  }
+
+  // Rebiasing the exponent & rounding the mantissa; a rounding overflowing the mantissa correctly increments the exponent
+  const uint32_t mantissaOdd = (absBits >> shift) & 1u;
+  return (absBits - rebiasBits + ((1u << (shift - 1)) - 1) + mantissaOdd) >> shift;
+}
+
+template <uint32_t MantissaBitCount>
+uint32_t convertFromMinifloat(uint32_t minifloatBits) {
+  constexpr uint32_t mantissaMask = (1u << MantissaBitCount) - 1;
+
+  uint32_t bits = recoverBits(recoverFloat(minifloatBits << computeMantissaShift<MantissaBitCount>()) * recoverFloat(exponentScaleBits));
+
+  // Infinities & NaNs, whose exponent is the highest, give values of at least 2^16 & must be given the highest float exponent
+  if (bits >= minifloatMaxBits) {
+    bits |= floatInfinityBits;
+
+    if (minifloatBits & mantissaMask)
+      bits |= floatQuietBit;
+  }
+
+  return bits;
+}
+
+// Converts a component to an 11 or 10-bit unsigned float, negative values giving 0
+template <uint32_t MantissaBitCount>
+uint32_t convertToUnsignedMinifloat(float value) {
+  const uint32_t bits = recoverBits(value);
+
+  if ((bits & floatSignMask) && (bits & floatAbsMask) <= floatInfinityBits)
+    return 0;
+
+  return convertToMinifloat<MantissaBitCount>(bits & floatAbsMask);
+}
+
+#if defined(RAZ_PACKING_SSE)
+__m128i selectBits(__m128i mask, __m128i bits1, __m128i bits2) { return _mm_or_si128(_mm_and_si128(mask, bits1), _mm_andnot_si128(mask, bits2)); }
+
+// Converts 4 floats to half-precision ones, following the same steps as convertToMinifloat(); each result is held in a 32-bit lane
+__m128i convertToHalfLanes(__m128 values) {
+  constexpr uint32_t shift     = computeMantissaShift<10>();
+  constexpr uint32_t magicBits = computeSubnormalMagicBits<10>();
+
+  const __m128i bits    = _mm_castps_si128(values);
+  const __m128i absBits = _mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(floatAbsMask)));
+
+  const __m128i nanBits = _mm_or_si128(_mm_set1_epi32(0x7E00), _mm_and_si128(_mm_srli_epi32(absBits, shift), _mm_set1_epi32(0x3FF)));
+  const __m128i specialBits = selectBits(_mm_cmpgt_epi32(absBits, _mm_set1_epi32(static_cast<int>(floatInfinityBits))), nanBits, _mm_set1_epi32(0x7C00));
+
+  const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(magicBits)));
+  const __m128i subnormalBits = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(absBits), magic)), _mm_castps_si128(magic));
+
+  const __m128i mantissaOdd = _mm_and_si128(_mm_srli_epi32(absBits, shift), _mm_set1_epi32(1));
+  const __m128i roundedBits = _mm_add_epi32(_mm_sub_epi32(absBits, _mm_set1_epi32(static_cast<int>(rebiasBits))),
+                                            _mm_add_epi32(_mm_set1_epi32((1 << (shift - 1)) - 1), mantissaOdd));
+  const __m128i normalBits  = _mm_srli_epi32(roundedBits, shift);
+
+  // The absolute values' bits being positive, they can be compared as signed integers
+  __m128i halfBits = selectBits(_mm_cmplt_epi32(absBits, _mm_set1_epi32(static_cast<int>(minifloatMinBits))), subnormalBits, normalBits);
+  halfBits = selectBits(_mm_cmpgt_epi32(absBits, _mm_set1_epi32(static_cast<int>(minifloatMaxBits - 1))), specialBits, halfBits);
+
+  return _mm_or_si128(halfBits, _mm_srli_epi32(_mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(floatSignMask))), 16));
+}
+
+// Converts 4 half-precision floats, each held in a 32-bit lane, following the same steps as convertFromMinifloat()
+__m128 convertFromHalfLanes(__m128i halfBits) {
+  const __m128i absHalfBits = _mm_and_si128(halfBits, _mm_set1_epi32(0x7FFF));
+  __m128i bits = _mm_castps_si128(_mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(absHalfBits, computeMantissaShift<10>())),
+                                             _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(exponentScaleBits)))));
+
+  const __m128i isInfOrNan = _mm_cmpgt_epi32(bits, _mm_set1_epi32(static_cast<int>(minifloatMaxBits - 1)));
+  const __m128i hasPayload = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(halfBits, _mm_set1_epi32(0x3FF)), _mm_setzero_si128()), isInfOrNan);
+
+  bits = _mm_or_si128(bits, _mm_and_si128(isInfOrNan, _mm_set1_epi32(static_cast<int>(floatInfinityBits))));
+  bits = _mm_or_si128(bits, _mm_and_si128(hasPayload, _mm_set1_epi32(static_cast<int>(floatQuietBit))));
+  bits = _mm_or_si128(bits, _mm_slli_epi32(_mm_and_si128(halfBits, _mm_set1_epi32(0x8000)), 16));
+
+  return _mm_castsi128_ps(bits);
+}
+
+// Packs 8 values into 32-bit integers, after clamping them & scaling them by the normalized type's highest value
+// The minimum & maximum give their second operand if the first is NaN, as do the single-value clamping operations
+template <typename T>
+void computePackedIntegers(const float* values, float lowestValue, __m128i& lowIntegers, __m128i& highIntegers) {
+  const __m128 lowest   = _mm_set1_ps(lowestValue);
+  const __m128 one      = _mm_set1_ps(1.f);
+  const __m128 maxValue = _mm_set1_ps(static_cast<float>(std::numeric_limits<T>::max()));
+
+  // The conversion rounds to the nearest integer (ties to even) in the default rounding mode, as does std::lrint()
+  lowIntegers  = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(values), lowest), one), maxValue));
+  highIntegers = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(values + 4), lowest), one), maxValue));
+}
+
+// Converts 4 integers held in 32-bit lanes to normalized values
+template <typename T>
+void storeUnpackedValues(__m128i integers, float lowestValue, float* values) {
+  const __m128 unpackedValues = _mm_div_ps(_mm_cvtepi32_ps(integers), _mm_set1_ps(static_cast<float>(std::numeric_limits<T>::max())));
+  _mm_storeu_ps(values, _mm_max_ps(unpackedValues, _mm_set1_ps(lowestValue)));
+}
+#endif
+
+} // namespace
+
+uint16_t convertToHalf(float value) noexcept {
+  const uint32_t bits = recoverBits(value);
+  return static_cast<uint16_t>(((bits & floatSignMask) >> 16) | convertToMinifloat<10>(bits & floatAbsMask));
+}
+
+float convertFromHalf(uint16_t halfBits) noexcept {
+  const uint32_t bits = convertFromMinifloat<10>(halfBits & 0x7FFFu);
+  return recoverFloat(bits | ((halfBits & 0x8000u) << 16));
+}
+
+Vec2f encodeOctahedral(const Vec3f& normal) noexcept {
+  const float invL1Norm = 1.f / (std::abs(normal.x()) + std::abs(normal.y()) + std::abs(normal.z()));
+  const Vec2f coords(normal.x() * invL1Norm, normal.y() * invL1Norm);
+
+  if (normal.z() >= 0.f)
+    return coords;
+
+  // The lower hemisphere is folded over the diagonals
+  return Vec2f((1.f - std::abs(coords.y())) * (coords.x() >= 0.f ? 1.f : -1.f),
+               (1.f - std::abs(coords.x())) * (coords.y() >= 0.f ? 1.f : -1.f));
+}
+
+Vec3f decodeOctahedral(const Vec2f& coords) noexcept {
+  Vec3f normal(coords.x(), coords.y(), 1.f - std::abs(coords.x()) - std::abs(coords.y()));
+
+  // Unfolding the lower hemisphere
+  const float foldOffset = std::max(-normal.z(), 0.f);
+  normal.x() += (normal.x() >= 0.f ? -foldOffset : foldOffset);
+  normal.y() += (normal.y() >= 0.f ? -foldOffset : foldOffset);
+
+  return normal.normalize();
+}
+
+uint32_t packOctahedral(const Vec3f& normal) noexcept {
+  // Rounding both coordinates to the nearest integers does not necessarily give the closest decoded vector: each of the four neighboring
+  //  couples of integers is decoded, keeping the one closest to the original vector
+  // The vectors being almost identical, their distance is compared rather than their dot product, which is too imprecise near 1
+  constexpr auto maxValue = static_cast<float>(std::numeric_limits<int16_t>::max());
+
+  const Vec2f coords = encodeOctahedral(normal);
+  const float lowX   = std::floor(std::clamp(coords.x(), -1.f, 1.f) * maxValue);
+  const float lowY   = std::floor(std::clamp(coords.y(), -1.f, 1.f) * maxValue);
+
+  const auto packCoord = [] (float coord) { return static_cast<uint32_t>(static_cast<uint16_t>(static_cast<int16_t>(coord))); };
+
+  uint32_t bestPackedNormal = 0;
+  float bestSqDist          = std::numeric_limits<float>::max();
+
+  for (const float offsetX : { 0.f, 1.f }) {
+    for (const float offsetY : { 0.f, 1.f }) {
+      const float packedX = std::min(lowX + offsetX, maxValue);
+      const float packedY = std::min(lowY + offsetY, maxValue);
+      const float sqDist  = (decodeOctahedral(Vec2f(packedX / maxValue, packedY / maxValue)) - normal).computeSquaredLength();
+
+      if (sqDist >= bestSqDist)
+        continue;
+
+      bestSqDist       = sqDist;
+      bestPackedNormal = packCoord(packedX) | (packCoord(packedY) << 16);
+    }
+  }
+
+  return bestPackedNormal;
+}
+
+Vec3f unpackOctahedral(uint32_t packedNormal) noexcept {
+  const auto packedX = static_cast<int16_t>(static_cast<uint16_t>(packedNormal & 0xFFFFu));
+  const auto packedY = static_cast<int16_t>(static_cast<uint16_t>(packedNormal >> 16));
+
+  return decodeOctahedral(Vec2f(unpackSnorm(packedX), unpackSnorm(packedY)));
+}
+
+uint32_t packRgb9e5(const Vec3f& color) noexcept {
+  // Following the EXT_texture_shared_exponent specification (https://registry.khronos.org/OpenGL/extensions/EXT/EXT_texture_shared_exponent.txt)
+  constexpr float maxValue = 65408.f; // (2^9 - 1) / 2^9 * 2^(31 - 15)
+
+  const auto clampComponent = [] (float component) { return (component > 0.f ? (component < maxValue ? component : maxValue) : 0.f); };
+  const float red   = clampComponent(color.x());
+  const float green = clampComponent(color.y());
+  const float blue  = clampComponent(color.z());
+
+  // The shared exponent is deduced from the highest component's, whose floor(log2()) is directly given by its bits
+  const float maxComponent = std::max({ red, green, blue });
+  int exponent = std::max(-16, static_cast<int>(recoverBits(maxComponent) >> 23) - 127) + 1 + 15;
+
+  // The highest component may be rounded to 2^9, in which case the exponent must be incremented to fit the mantissa
+  if (static_cast<uint32_t>(maxComponent / std::ldexp(1.f, exponent - 15 - 9) + 0.5f) == 512)
+    ++exponent;
+
+  const float invScale = 1.f / std::ldexp(1.f, exponent - 15 - 9);
+  const auto computeMantissa = [invScale] (float component) { return static_cast<uint32_t>(component * invScale + 0.5f); };
+
+  return computeMantissa(red) | (computeMantissa(green) << 9) | (computeMantissa(blue) << 18) | (static_cast<uint32_t>(exponent) << 27);
+}
+
+Vec3f unpackRgb9e5(uint32_t packedColor) noexcept {
+  const float scale = std::ldexp(1.f, static_cast<int>(packedColor >> 27) - 15 - 9);
+  return Vec3f(static_cast<float>(packedColor & 0x1FFu), static_cast<float>((packedColor >> 9) & 0x1FFu), static_cast<float>((packedColor >> 18) & 0x1FFu)) * scale;
+}
+
+uint32_t packR11G11B10(const Vec3f& color) noexcept {
+  return convertToUnsignedMinifloat<6>(color.x()) | (convertToUnsignedMinifloat<6>(color.y()) << 11) | (convertToUnsignedMinifloat<5>(color.z()) << 22);
+}
+
+Vec3f unpackR11G11B10(uint32_t packedColor) noexcept {
+  return Vec3f(recoverFloat(convertFromMinifloat<6>(packedColor & 0x7FFu)),
+               recoverFloat(convertFromMinifloat<6>((packedColor >> 11) & 0x7FFu)),
+               recoverFloat(convertFromMinifloat<5>(packedColor >> 22)));
+}
+
+void convertToHalf(const float* values, uint16_t* halfBits, std::size_t count) noexcept {
+  std::size_t index = 0;
+
+#if defined(RAZ_PACKING_F16C)
+  for (; index + 8 <= count; index += 8) {
+    const __m128i convertedBits = _mm256_cvtps_ph(_mm256_loadu_ps(values + index), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(halfBits + index), convertedBits);
+  }
+#endif
+
+#if defined(RAZ_PACKING_SSE)
+  for (; index + 8 <= count; index += 8) {
+    // The 32-bit results are sign-extended from their lowest 16 bits, so that the saturating pack keeps them untouched
+    const __m128i lowBits  = _mm_srai_epi32(_mm_slli_epi32(convertToHalfLanes(_mm_loadu_ps(values + index)), 16), 16);
+    const __m128i highBits = _mm_srai_epi32(_mm_slli_epi32(convertToHalfLanes(_mm_loadu_ps(values + index + 4)), 16), 16);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(halfBits + index), _mm_packs_epi32(lowBits, highBits));
+  }
+#endif
+
+  for (; index < count; ++index)
+    halfBits[index] = convertToHalf(values[index]);
+}
+
+void convertFromHalf(const uint16_t* halfBits, float* values, std::size_t count) noexcept {
+  std::size_t index = 0;
+
+#if defined(RAZ_PACKING_F16C)
+  for (; index + 8 <= count; index += 8)
+    _mm256_storeu_ps(values + index, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(halfBits + index))));
+#endif
+
+#if defined(RAZ_PACKING_SSE)
+  for (; index + 8 <= count; index += 8) {
+    const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(halfBits + index));
+    _mm_storeu_ps(values + index, convertFromHalfLanes(_mm_unpacklo_epi16(bits, _mm_setzero_si128())));
+    _mm_storeu_ps(values + index + 4, convertFromHalfLanes(_mm_unpackhi_epi16(bits, _mm_setzero_si128())));
+  }
+#endif
+
+  for (; index < count; ++index)
+    values[index] = convertFromHalf(halfBits[index]);
+}
+
+template <typename T>
+void packUnorm(const float* values, T* packedValues, std::size_t count) noexcept {
+  std::size_t index = 0;
+
+#if defined(RAZ_PACKING_SSE)
+  for (; index + 8 <= count; index += 8) {
+    __m128i lowIntegers {};
+    __m128i highIntegers {};
+    computePackedIntegers<T>(values + index, 0.f, lowIntegers, highIntegers);
+
+    if constexpr (std::is_same_v<T, uint8_t>) {
+      const __m128i packedIntegers = _mm_packus_epi16(_mm_packs_epi32(lowIntegers, highIntegers), _mm_setzero_si128());
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(packedValues + index), packedIntegers);
+    } else {
+      // SSE2 having no unsigned saturating pack from 32 to 16 bits, the integers are offset to fit in the signed range
+      const __m128i offset = _mm_set1_epi32(32768);
+      const __m128i packedIntegers = _mm_packs_epi32(_mm_sub_epi32(lowIntegers, offset), _mm_sub_epi32(highIntegers, offset));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(packedValues + index), _mm_xor_si128(packedIntegers, _mm_set1_epi16(static_cast<short>(0x8000))));
+    }
+  }
+#endif
+
+  for (; index < count; ++index)
+    packedValues[index] = packUnorm<T>(values[index]);
+}
+
+template <typename T>
+void unpackUnorm(const T* packedValues, float* values, std::size_t count) noexcept {
+  std::size_t index = 0;
+
+#if defined(RAZ_PACKING_SSE)
+  for (; index + 8 <= count; index += 8) {
+    __m128i integers {};
+
+    if constexpr (std::is_same_v<T, uint8_t>)
+      integers = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(packedValues + index)), _mm_setzero_si128());
+    else
+      integers = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packedValues + index));
+
+    storeUnpackedValues<T>(_mm_unpacklo_epi16(integers, _mm_setzero_si128()), 0.f, values + index);
+    storeUnpackedValues<T>(_mm_unpackhi_epi16(integers, _mm_setzero_si128()), 0.f, values + index + 4);
+  }
+#endif
+
+  for (; index < count; ++index)
+    values[index] = unpackUnorm(packedValues[index]);
+}
+
+template <typename T>
+void packSnorm(const float* values, T* packedValues, std::size_t count) noexcept {
+  std::size_t index = 0;
+
+#if defined(RAZ_PACKING_SSE)
+  for (; index + 8 <= count; index += 8) {
+    __m128i lowIntegers {};
+    __m128i highIntegers {};
+    computePackedIntegers<T>(values + index, -1.f, lowIntegers, highIntegers);
+
+    const __m128i packedIntegers = _mm_packs_epi32(lowIntegers, highIntegers);
+
+    if constexpr (std::is_same_v<T, int8_t>)
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(packedValues + index), _mm_packs_epi16(packedIntegers, _mm_setzero_si128()));
+    else
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(packedValues + index), packedIntegers);
+  }
+#endif
+
+  for (; index < count; ++index)
+    packedValues[index] = packSnorm<T>(values[index]);
+}
+
+template <typename T>
+void unpackSnorm(const T* packedValues, float* values, std::size_t count) noexcept {
+  std::size_t index = 0;
+
+#if defined(RAZ_PACKING_SSE)
+  for (; index + 8 <= count; index += 8) {
+    __m128i integers {};
+
+    // The values are sign-extended by placing them in the highest bits before shifting them back arithmetically
+    if constexpr (std::is_same_v<T, int8_t>) {
+      const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(packedValues + index));
+      integers = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+    } else {
+      integers = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packedValues + index));
+    }
+
+    storeUnpackedValues<T>(_mm_srai_epi32(_mm_unpacklo_epi16(integers, integers), 16), -1.f, values + index);
+    storeUnpackedValues<T>(_mm_srai_epi32(_mm_unpackhi_epi16(integers, integers), 16), -1.f, values + index + 4);
+  }
+#endif
+
+  for (; index < count; ++index)
+    values[index] = unpackSnorm(packedValues[index]);
+}
+
+template void packUnorm(const float*, uint8_t*, std::size_t) noexcept;
+template void packUnorm(const float*, uint16_t*, std::size_t) noexcept;
+template void unpackUnorm(const uint8_t*, float*, std::size_t) noexcept;
+template void unpackUnorm(const uint16_t*, float*, std::size_t) noexcept;
+template void packSnorm(const float*, int8_t*, std::size_t) noexcept;
+template void packSnorm(const float*, int16_t*, std::size_t) noexcept;
+template void unpackSnorm(const int8_t*, float*, std::size_t) noexcept;
+template void unpackSnorm(const int16_t*, float*, std::size_t) noexcept;
+
+} // namespace Raz::Packing
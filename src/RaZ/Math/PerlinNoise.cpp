@@ -1,8 +1,16 @@
 #include "RaZ/Math/MathUtils.hpp"
 #include "RaZ/Math/PerlinNoise.hpp"
+#include "RaZ/Math/SimdLanes.hpp"
 #include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Image.hpp"
+#include "RaZ/Utils/Threading.hpp"
 
-namespace Raz::PerlinNoise{
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+namespace Raz::PerlinNoise {
 
 namespace {
 
@@ -40,6 +48,47 @@ constexpr std::array<Vec2f, 8> gradients2D = {
   Vec2f(0.7071067691f, -0.7071067691f), Vec2f(-0.7071067691f, -0.7071067691f)
 };
 
+// Middles of the cube's edges
+constexpr std::array<Vec3f, 12> gradients3D = {
+  Vec3f( 0.7071067691f,  0.7071067691f,           0.f), Vec3f(-0.7071067691f,  0.7071067691f,           0.f),
+  Vec3f( 0.7071067691f, -0.7071067691f,           0.f), Vec3f(-0.7071067691f, -0.7071067691f,           0.f),
+  Vec3f( 0.7071067691f,            0.f,  0.7071067691f), Vec3f(-0.7071067691f,            0.f,  0.7071067691f),
+  Vec3f( 0.7071067691f,            0.f, -0.7071067691f), Vec3f(-0.7071067691f,            0.f, -0.7071067691f),
+  Vec3f(           0.f,  0.7071067691f,  0.7071067691f), Vec3f(           0.f, -0.7071067691f,  0.7071067691f),
+  Vec3f(           0.f,  0.7071067691f, -0.7071067691f), Vec3f(           0.f, -0.7071067691f, -0.7071067691f)
+};
+
+// Middles of the tesseract's edges
+constexpr float gradComp4D = 0.5773502588f; // 1 / sqrt(3), so that all gradients are normalized
+constexpr std::array<Vec4f, 32> gradients4D = {
+  Vec4f(        0.f,  gradComp4D,  gradComp4D,  gradComp4D), Vec4f(        0.f,  gradComp4D,  gradComp4D, -gradComp4D),
+  Vec4f(        0.f,  gradComp4D, -gradComp4D,  gradComp4D), Vec4f(        0.f,  gradComp4D, -gradComp4D, -gradComp4D),
+  Vec4f(        0.f, -gradComp4D,  gradComp4D,  gradComp4D), Vec4f(        0.f, -gradComp4D,  gradComp4D, -gradComp4D),
+  Vec4f(        0.f, -gradComp4D, -gradComp4D,  gradComp4D), Vec4f(        0.f, -gradComp4D, -gradComp4D, -gradComp4D),
+  Vec4f( gradComp4D,         0.f,  gradComp4D,  gradComp4D), Vec4f( gradComp4D,         0.f,  gradComp4D, -gradComp4D),
+  Vec4f( gradComp4D,         0.f, -gradComp4D,  gradComp4D), Vec4f( gradComp4D,         0.f, -gradComp4D, -gradComp4D),
+  Vec4f(-gradComp4D,         0.f,  gradComp4D,  gradComp4D), Vec4f(-gradComp4D,         0.f,  gradComp4D, -gradComp4D),
+  Vec4f(-gradComp4D,         0.f, -gradComp4D,  gradComp4D), Vec4f(-gradComp4D,         0.f, -gradComp4D, -gradComp4D),
+  Vec4f( gradComp4D,  gradComp4D,         0.f,  gradComp4D), Vec4f( gradComp4D,  gradComp4D,         0.f, -gradComp4D),
+  Vec4f( gradComp4D, -gradComp4D,         0.f,  gradComp4D), Vec4f( gradComp4D, -gradComp4D,         0.f, -gradComp4D),
+  Vec4f(-gradComp4D,  gradComp4D,         0.f,  gradComp4D), Vec4f(-gradComp4D,  gradComp4D,         0.f, -gradComp4D),
+  Vec4f(-gradComp4D, -gradComp4D,         0.f,  gradComp4D), Vec4f(-gradComp4D, -gradComp4D,         0.f, -gradComp4D),
+  Vec4f( gradComp4D,  gradComp4D,  gradComp4D,         0.f), Vec4f( gradComp4D,  gradComp4D, -gradComp4D,         0.f),
+  Vec4f( gradComp4D, -gradComp4D,  gradComp4D,         0.f), Vec4f( gradComp4D, -gradComp4D, -gradComp4D,         0.f),
+  Vec4f(-gradComp4D,  gradComp4D,  gradComp4D,         0.f), Vec4f(-gradComp4D,  gradComp4D, -gradComp4D,         0.f),
+  Vec4f(-gradComp4D, -gradComp4D,  gradComp4D,         0.f), Vec4f(-gradComp4D, -gradComp4D, -gradComp4D,         0.f)
+};
+
+// Factors scaling the simplex noise values between [-1; 1], found by numerically searching the highest absolute values with the above gradients
+constexpr float simplexScale2D = 99.f;
+constexpr float simplexScale3D = 46.f;
+constexpr float simplexScale4D = 47.f;
+
+#if defined(RAZ_THREADS_AVAILABLE)
+constexpr std::size_t parallelGridThreshold = 16384; // Number of grid points from which a grid is split in tiles processed in parallel
+constexpr std::size_t tileRowCount          = 16;    // Number of rows in each tile
+#endif
+
 constexpr float getGradient1D(unsigned int x) {
   return (permutations[x] % 2 == 0 ? 1.f : -1.f);
 }
@@ -48,6 +97,398 @@ constexpr const Vec2f& getGradient2D(unsigned int x, unsigned int y) {
   return gradients2D[permutations[permutations[x] + y] % gradients2D.size()];
 }
 
+constexpr const Vec3f& getGradient3D(unsigned int x, unsigned int y, unsigned int z) {
+  return gradients3D[permutations[permutations[permutations[x] + y] + z] % gradients3D.size()];
+}
+
+constexpr const Vec4f& getGradient4D(unsigned int x, unsigned int y, unsigned int z, unsigned int w) {
+  return gradients4D[permutations[permutations[permutations[permutations[x] + y] + z] + w] % gradients4D.size()];
+}
+
+template <std::size_t Size>
+constexpr const Vector<float, Size>& getGradient(const std::array<unsigned int, Size>& coords) {
+  static_assert(Size == 3 || Size == 4, "Error: Only 3D & 4D gradients can be recovered from a coordinates array.");
+
+  if constexpr (Size == 3)
+    return getGradient3D(coords[0], coords[1], coords[2]);
+  else
+    return getGradient4D(coords[0], coords[1], coords[2], coords[3]);
+}
+
+// Recovers the coordinate in the permutation table of an already floored value; negative values wrap around
+constexpr unsigned int computeLatticeCoord(float flooredValue) {
+  return static_cast<unsigned int>(static_cast<int>(flooredValue)) & 255u;
+}
+
+// The scalar lanes are used by the single-point functions: the batch functions, performing the exact same operations, thus give identical results
+using SimdLanes::ScalarLanes;
+
+template <typename LanesT>
+using LaneValues = std::array<float, LanesT::Size>;
+
+template <typename LanesT>
+LaneValues<LanesT> storeLanes(LanesT lanes) {
+  LaneValues<LanesT> values {};
+  lanes.store(values.data());
+  return values;
+}
+
+// Gradients of several points, gathered from the permutation table one lane at a time
+template <typename LanesT>
+struct GradientLanes2D {
+  void setGradient(std::size_t laneIndex, const Vec2f& gradient) {
+    xValues[laneIndex] = gradient.x();
+    yValues[laneIndex] = gradient.y();
+  }
+
+  LanesT dot(LanesT xDist, LanesT yDist) const { return xDist * LanesT::load(xValues.data()) + yDist * LanesT::load(yValues.data()); }
+
+  LaneValues<LanesT> xValues {};
+  LaneValues<LanesT> yValues {};
+};
+
+template <typename LanesT>
+LanesT smootherstep(LanesT value) {
+  // Same operations as MathUtils::smootherstep()
+  return value * value * value * (value * (value * LanesT::broadcast(6.f) - LanesT::broadcast(15.f)) + LanesT::broadcast(10.f));
+}
+
+template <typename LanesT>
+LanesT lerp(LanesT min, LanesT max, LanesT coeff) {
+  // Same operations as MathUtils::lerp()
+  return min * (LanesT::broadcast(1.f) - coeff) + max * coeff;
+}
+
+template <typename LanesT>
+LanesT computePerlin2D(LanesT x, LanesT y) {
+  // Recovering integer coordinates on the quad
+  //
+  //  y0+1______x0+1/y0+1
+  //     |      |
+  //     |      |
+  // x0/y0______x0+1
+
+  const LanesT xFloor = LanesT::floor(x);
+  const LanesT yFloor = LanesT::floor(y);
+
+  // Recovering pseudo-random gradients at each corner of the quad
+  const LaneValues<LanesT> xFloorValues = storeLanes(xFloor);
+  const LaneValues<LanesT> yFloorValues = storeLanes(yFloor);
+
+  GradientLanes2D<LanesT> botLeftGrad;
+  GradientLanes2D<LanesT> botRightGrad;
+  GradientLanes2D<LanesT> topLeftGrad;
+  GradientLanes2D<LanesT> topRightGrad;
+
+  for (std::size_t laneIndex = 0; laneIndex < LanesT::Size; ++laneIndex) {
+    const unsigned int x0 = computeLatticeCoord(xFloorValues[laneIndex]);
+    const unsigned int y0 = computeLatticeCoord(yFloorValues[laneIndex]);
+
+    botLeftGrad.setGradient(laneIndex, getGradient2D(x0, y0));
+    botRightGrad.setGradient(laneIndex, getGradient2D(x0 + 1, y0));
+    topLeftGrad.setGradient(laneIndex, getGradient2D(x0, y0 + 1));
+    topRightGrad.setGradient(laneIndex, getGradient2D(x0 + 1, y0 + 1));
+  }
+
+  // Computing the distance to the coordinates
+  //  _____________
+  //  |           |
+  //  | xWeight   |
+  //  |---------X |
+  //  |         | yWeight
+  //  |_________|_|
+
+  const LanesT one = LanesT::broadcast(1.f);
+
+  const LanesT xWeight = x - xFloor;
+  const LanesT yWeight = y - yFloor;
+
+  const LanesT botLeftDot  = botLeftGrad.dot(xWeight, yWeight);
+  const LanesT botRightDot = botRightGrad.dot(xWeight - one, yWeight);
+  const LanesT topLeftDot  = topLeftGrad.dot(xWeight, yWeight - one);
+  const LanesT topRightDot = topRightGrad.dot(xWeight - one, yWeight - one);
+
+  const LanesT smoothX = smootherstep(xWeight);
+  const LanesT smoothY = smootherstep(yWeight);
+
+  const LanesT botCoeff = lerp(botLeftDot, botRightDot, smoothX);
+  const LanesT topCoeff = lerp(topLeftDot, topRightDot, smoothX);
+
+  return (lerp(botCoeff, topCoeff, smoothY) + one) / LanesT::broadcast(2.f); // Scaling between [0; 1]
+}
+
+// Computes the contribution of a simplex's corner, which is null if the point is farther than the given radius from it
+template <typename LanesT>
+LanesT computeSimplexContribution(LanesT xDist, LanesT yDist, const GradientLanes2D<LanesT>& gradient) {
+  const LanesT attenuation = LanesT::broadcast(0.5f) - xDist * xDist - yDist * yDist;
+  const typename LanesT::Mask isOutside = LanesT::greater(LanesT::broadcast(0.f), attenuation);
+
+  const LanesT sqAttenuation = attenuation * attenuation;
+  return LanesT::select(isOutside, LanesT::broadcast(0.f), sqAttenuation * sqAttenuation * gradient.dot(xDist, yDist));
+}
+
+template <typename LanesT>
+LanesT computeSimplex2D(LanesT x, LanesT y) {
+  constexpr float skewFactor   = 0.3660254038f; // (sqrt(3) - 1) / 2
+  constexpr float unskewFactor = 0.2113248654f; // (3 - sqrt(3)) / 6
+
+  // Skewing the space to find the simplex (triangle) containing the point
+  const LanesT skew   = (x + y) * LanesT::broadcast(skewFactor);
+  const LanesT xFloor = LanesT::floor(x + skew);
+  const LanesT yFloor = LanesT::floor(y + skew);
+  const LanesT unskew = (xFloor + yFloor) * LanesT::broadcast(unskewFactor);
+
+  // Distances from the first corner; the second corner depends on which triangle of the skewed quad the point is in
+  const LanesT firstXDist = x - (xFloor - unskew);
+  const LanesT firstYDist = y - (yFloor - unskew);
+  const typename LanesT::Mask isLowerTriangle = LanesT::greater(firstXDist, firstYDist);
+
+  const LanesT zero = LanesT::broadcast(0.f);
+  const LanesT one  = LanesT::broadcast(1.f);
+
+  const LanesT secondXDist = firstXDist - LanesT::select(isLowerTriangle, one, zero) + LanesT::broadcast(unskewFactor);
+  const LanesT secondYDist = firstYDist - LanesT::select(isLowerTriangle, zero, one) + LanesT::broadcast(unskewFactor);
+  const LanesT thirdXDist  = firstXDist - one + LanesT::broadcast(2.f * unskewFactor);
+  const LanesT thirdYDist  = firstYDist - one + LanesT::broadcast(2.f * unskewFactor);
+
+  // Recovering pseudo-random gradients at each corner of the simplex
+  const LaneValues<LanesT> xFloorValues     = storeLanes(xFloor);
+  const LaneValues<LanesT> yFloorValues     = storeLanes(yFloor);
+  const LaneValues<LanesT> firstXDistValues = storeLanes(firstXDist);
+  const LaneValues<LanesT> firstYDistValues = storeLanes(firstYDist);
+
+  GradientLanes2D<LanesT> firstGrad;
+  GradientLanes2D<LanesT> secondGrad;
+  GradientLanes2D<LanesT> thirdGrad;
+
+  for (std::size_t laneIndex = 0; laneIndex < LanesT::Size; ++laneIndex) {
+    const unsigned int x0 = computeLatticeCoord(xFloorValues[laneIndex]);
+    const unsigned int y0 = computeLatticeCoord(yFloorValues[laneIndex]);
+    const bool isLower    = (firstXDistValues[laneIndex] > firstYDistValues[laneIndex]);
+
+    firstGrad.setGradient(laneIndex, getGradient2D(x0, y0));
+    secondGrad.setGradient(laneIndex, getGradient2D(x0 + (isLower ? 1 : 0), y0 + (isLower ? 0 : 1)));
+    thirdGrad.setGradient(laneIndex, getGradient2D(x0 + 1, y0 + 1));
+  }
+
+  const LanesT noise = computeSimplexContribution(firstXDist, firstYDist, firstGrad)
+                     + computeSimplexContribution(secondXDist, secondYDist, secondGrad)
+                     + computeSimplexContribution(thirdXDist, thirdYDist, thirdGrad);
+
+  return (noise * LanesT::broadcast(simplexScale2D) + one) / LanesT::broadcast(2.f); // Scaling between [0; 1]
+}
+
+template <std::size_t Size>
+float computePerlin(const Vector<float, Size>& coords) {
+  constexpr std::size_t cornerCount = 1 << Size;
+
+  std::array<unsigned int, Size> latticeCoords {};
+  Vector<float, Size> weights;
+  Vector<float, Size> smoothWeights;
+
+  for (std::size_t i = 0; i < Size; ++i) {
+    const float floored = std::floor(coords[i]);
+
+    latticeCoords[i] = computeLatticeCoord(floored);
+    weights[i]       = coords[i] - floored;
+    smoothWeights[i] = MathUtils::smootherstep(weights[i]);
+  }
+
+  // Computing the dot products between the pseudo-random gradients at each corner of the hypercube & the distances to the point
+  // The bits of each corner's index tell on which side of the hypercube it is along each axis, the first axis being on the lowest bit
+  std::array<float, cornerCount> values {};
+
+  for (std::size_t cornerIndex = 0; cornerIndex < cornerCount; ++cornerIndex) {
+    std::array<unsigned int, Size> cornerCoords {};
+    Vector<float, Size> cornerDist;
+
+    for (std::size_t i = 0; i < Size; ++i) {
+      const unsigned int offset = (cornerIndex >> i) & 1u;
+
+      cornerCoords[i] = latticeCoords[i] + offset;
+      cornerDist[i]   = weights[i] - static_cast<float>(offset);
+    }
+
+    values[cornerIndex] = cornerDist.dot(getGradient(cornerCoords));
+  }
+
+  // Interpolating the values along each axis in turn, each pass halving their number
+  for (std::size_t i = 0, valueCount = cornerCount / 2; i < Size; ++i, valueCount /= 2) {
+    for (std::size_t valueIndex = 0; valueIndex < valueCount; ++valueIndex)
+      values[valueIndex] = MathUtils::lerp(values[valueIndex * 2], values[valueIndex * 2 + 1], smoothWeights[i]);
+  }
+
+  return (values.front() + 1) / 2; // Scaling between [0; 1]
+}
+
+template <std::size_t Size>
+float computeSimplex(const Vector<float, Size>& coords, float skewFactor, float unskewFactor, float scale) {
+  // Skewing the space to find the simplex containing the point
+  float coordsSum = 0.f;
+  for (std::size_t i = 0; i < Size; ++i)
+    coordsSum += coords[i];
+
+  const float skew = coordsSum * skewFactor;
+
+  std::array<unsigned int, Size> latticeCoords {};
+  float flooredSum = 0.f;
+  Vector<float, Size> floored;
+
+  for (std::size_t i = 0; i < Size; ++i) {
+    floored[i]       = std::floor(coords[i] + skew);
+    latticeCoords[i] = computeLatticeCoord(floored[i]);
+    flooredSum      += floored[i];
+  }
+
+  const float unskew = flooredSum * unskewFactor;
+  Vector<float, Size> firstDist;
+
+  for (std::size_t i = 0; i < Size; ++i)
+    firstDist[i] = coords[i] - (floored[i] - unskew);
+
+  // Ranking the distances' components: the simplex's corners are reached by successively stepping along the axes from the largest component to the smallest
+  std::array<unsigned int, Size> ranks {};
+
+  for (std::size_t i = 0; i < Size; ++i) {
+    for (std::size_t j = i + 1; j < Size; ++j)
+      ++ranks[(firstDist[i] > firstDist[j] ? i : j)];
+  }
+
+  float noise = 0.f;
+
+  for (unsigned int cornerIndex = 0; cornerIndex <= Size; ++cornerIndex) {
+    std::array<unsigned int, Size> cornerCoords {};
+    Vector<float, Size> cornerDist;
+
+    for (std::size_t i = 0; i < Size; ++i) {
+      const unsigned int offset = (ranks[i] + cornerIndex >= Size ? 1 : 0);
+
+      cornerCoords[i] = latticeCoords[i] + offset;
+      cornerDist[i]   = firstDist[i] - static_cast<float>(offset) + static_cast<float>(cornerIndex) * unskewFactor;
+    }
+
+    // The corner contributes only if the point is close enough to it
+    const float attenuation = 0.6f - cornerDist.computeSquaredLength();
+
+    if (attenuation > 0.f) {
+      const float sqAttenuation = attenuation * attenuation;
+      noise += sqAttenuation * sqAttenuation * cornerDist.dot(getGradient(cornerCoords));
+    }
+  }
+
+  return (noise * scale + 1) / 2; // Scaling between [0; 1]
+}
+
+// Generates a pseudo-random offset applied to an octave's coordinate, so that octaves are not correlated & different seeds give different noises
+float computeOctaveOffset(uint32_t seed, unsigned int octaveIndex, unsigned int axisIndex) {
+  // Integer hash by Chris Wellons (https://nullprogram.com/blog/2018/07/31/)
+  uint32_t hash = seed ^ (octaveIndex * 0x9E3779B9u) ^ (axisIndex * 0x85EBCA6Bu);
+  hash ^= hash >> 16;
+  hash *= 0x7FEB352Du;
+  hash ^= hash >> 15;
+  hash *= 0x846CA68Bu;
+  hash ^= hash >> 16;
+
+  // As the noise repeats every 256 units, the offset is taken in [0; 256[, with a precision of 1/256
+  return static_cast<float>(hash & 65535u) / 256.f;
+}
+
+template <typename LanesT>
+LanesT computeFractal2D(LanesT x, LanesT y, FractalType fractalType, const FractalParams& params) {
+  assert("Error: A fractal noise must have at least one octave." && params.octaveCount > 0);
+
+  LanesT total = LanesT::broadcast(0.f);
+  float frequency    = params.frequency;
+  float amplitude    = 1.f;
+  float amplitudeSum = 0.f;
+
+  for (unsigned int octaveIndex = 0; octaveIndex < params.octaveCount; ++octaveIndex) {
+    const LanesT octaveX = x * LanesT::broadcast(frequency) + LanesT::broadcast(computeOctaveOffset(params.seed, octaveIndex, 0));
+    const LanesT octaveY = y * LanesT::broadcast(frequency) + LanesT::broadcast(computeOctaveOffset(params.seed, octaveIndex, 1));
+
+    LanesT noise = (params.noiseType == NoiseType::PERLIN ? computePerlin2D(octaveX, octaveY) : computeSimplex2D(octaveX, octaveY));
+
+    if (fractalType == FractalType::RIDGED) {
+      // Folding the value around its middle, then squaring it to sharpen the ridges
+      noise = LanesT::broadcast(1.f) - LanesT::abs(noise * LanesT::broadcast(2.f) - LanesT::broadcast(1.f));
+      noise = noise * noise;
+    }
+
+    total         = total + noise * LanesT::broadcast(amplitude);
+    amplitudeSum += amplitude;
+
+    frequency *= params.lacunarity;
+    amplitude *= params.persistence;
+  }
+
+  return total / LanesT::broadcast(amplitudeSum);
+}
+
+float computeFractal3D(const Vec3f& coords, FractalType fractalType, const FractalParams& params) {
+  assert("Error: A fractal noise must have at least one octave." && params.octaveCount > 0);
+
+  float total        = 0.f;
+  float frequency    = params.frequency;
+  float amplitude    = 1.f;
+  float amplitudeSum = 0.f;
+
+  for (unsigned int octaveIndex = 0; octaveIndex < params.octaveCount; ++octaveIndex) {
+    const Vec3f octaveCoords(coords.x() * frequency + computeOctaveOffset(params.seed, octaveIndex, 0),
+                             coords.y() * frequency + computeOctaveOffset(params.seed, octaveIndex, 1),
+                             coords.z() * frequency + computeOctaveOffset(params.seed, octaveIndex, 2));
+
+    float noise = (params.noiseType == NoiseType::PERLIN ? get(octaveCoords.x(), octaveCoords.y(), octaveCoords.z())
+                                                         : getSimplex(octaveCoords.x(), octaveCoords.y(), octaveCoords.z()));
+
+    if (fractalType == FractalType::RIDGED) {
+      noise = 1.f - std::abs(noise * 2.f - 1.f);
+      noise = noise * noise;
+    }
+
+    total        += noise * amplitude;
+    amplitudeSum += amplitude;
+
+    frequency *= params.lacunarity;
+    amplitude *= params.persistence;
+  }
+
+  return total / amplitudeSum;
+}
+
+template <typename LanesT>
+void fillRow(float* output, std::size_t width, const GridRegion& region, float y, FractalType fractalType, const FractalParams& params,
+             std::size_t& columnIndex) {
+  LaneValues<LanesT> columns {};
+
+  for (; columnIndex + LanesT::Size <= width; columnIndex += LanesT::Size) {
+    for (std::size_t laneIndex = 0; laneIndex < LanesT::Size; ++laneIndex)
+      columns[laneIndex] = static_cast<float>(columnIndex + laneIndex);
+
+    const LanesT x = LanesT::broadcast(region.origin.x()) + LanesT::load(columns.data()) * LanesT::broadcast(region.step.x());
+    computeFractal2D(x, LanesT::broadcast(y), fractalType, params).store(output + columnIndex);
+  }
+}
+
+void fillRows(float* output, std::size_t rowStride, const GridRegion& region, FractalType fractalType, const FractalParams& params,
+              std::size_t beginRow, std::size_t endRow) {
+  for (std::size_t rowIndex = beginRow; rowIndex < endRow; ++rowIndex) {
+    float* rowOutput = output + rowIndex * rowStride;
+    const float y    = region.origin.y() + static_cast<float>(rowIndex) * region.step.y();
+
+    std::size_t columnIndex = 0;
+
+#if defined(RAZ_SIMD_LANES_AVX)
+    fillRow<SimdLanes::AvxLanes>(rowOutput, region.width, region, y, fractalType, params, columnIndex);
+#endif
+
+#if defined(RAZ_SIMD_LANES_SSE)
+    fillRow<SimdLanes::SseLanes>(rowOutput, region.width, region, y, fractalType, params, columnIndex);
+#endif
+
+    fillRow<ScalarLanes>(rowOutput, region.width, region, y, fractalType, params, columnIndex);
+  }
+}
+
 } // namespace
 
 float get(float x) {
@@ -55,7 +496,8 @@ float get(float x) {
   //
   //  x0---------x0+1
 
-  const auto x0 = static_cast<unsigned int>(x) & 255u;
+  const float xFloor = std::floor(x);
+  const unsigned int x0 = computeLatticeCoord(xFloor);
 
   const float leftGrad  = getGradient1D(x0);
   const float rightGrad = getGradient1D(x0 + 1);
@@ -65,7 +507,7 @@ float get(float x) {
   //  |------X--|
   //      xWeight
 
-  const float xWeight = x - static_cast<float>(x0);
+  const float xWeight = x - xFloor;
 
   const float leftDot  = xWeight * leftGrad;
   const float rightDot = (xWeight - 1) * rightGrad;
@@ -76,45 +518,104 @@ float get(float x) {
 }
 
 float get(float x, float y) {
-  // Recovering integer coordinates on the quad
-  //
-  //  y0+1______x0+1/y0+1
-  //     |      |
-  //     |      |
-  // x0/y0______x0+1
+  return computePerlin2D(ScalarLanes{ x }, ScalarLanes{ y }).value;
+}
 
-  const auto x0 = static_cast<unsigned int>(std::floor(x)) & 255u;
-  const auto y0 = static_cast<unsigned int>(std::floor(y)) & 255u;
+float get(float x, float y, float z) {
+  return computePerlin(Vec3f(x, y, z));
+}
 
-  // Recovering pseudo-random gradients at each corner of the quad
-  const Vec2f& botLeftGrad  = getGradient2D(x0, y0);
-  const Vec2f& botRightGrad = getGradient2D(x0 + 1, y0);
-  const Vec2f& topLeftGrad  = getGradient2D(x0, y0 + 1);
-  const Vec2f& topRightGrad = getGradient2D(x0 + 1, y0 + 1);
+float get(float x, float y, float z, float w) {
+  return computePerlin(Vec4f(x, y, z, w));
+}
 
-  // Computing the distance to the coordinates
-  //  _____________
-  //  |           |
-  //  | xWeight   |
-  //  |---------X |
-  //  |         | yWeight
-  //  |_________|_|
+float getSimplex(float x, float y) {
+  return computeSimplex2D(ScalarLanes{ x }, ScalarLanes{ y }).value;
+}
 
-  const float xWeight = x - static_cast<float>(x0);
-  const float yWeight = y - static_cast<float>(y0);
+float getSimplex(float x, float y, float z) {
+  return computeSimplex(Vec3f(x, y, z), 1.f / 3.f, 1.f / 6.f, simplexScale3D);
+}
 
-  const float botLeftDot  = Vec2f(xWeight    , yWeight    ).dot(botLeftGrad);
-  const float botRightDot = Vec2f(xWeight - 1, yWeight    ).dot(botRightGrad);
-  const float topLeftDot  = Vec2f(xWeight    , yWeight - 1).dot(topLeftGrad);
-  const float topRightDot = Vec2f(xWeight - 1, yWeight - 1).dot(topRightGrad);
+float getSimplex(float x, float y, float z, float w) {
+  return computeSimplex(Vec4f(x, y, z, w), 0.3090169944f, 0.1381966011f, simplexScale4D); // (sqrt(5) - 1) / 4 & (5 - sqrt(5)) / 20
+}
 
-  const float smoothX = MathUtils::smootherstep(xWeight);
-  const float smoothY = MathUtils::smootherstep(yWeight);
+float computeFbm(float x, float y, const FractalParams& params) {
+  return computeFractal2D(ScalarLanes{ x }, ScalarLanes{ y }, FractalType::FBM, params).value;
+}
+
+float computeFbm(float x, float y, float z, const FractalParams& params) {
+  return computeFractal3D(Vec3f(x, y, z), FractalType::FBM, params);
+}
+
+float computeRidged(float x, float y, const FractalParams& params) {
+  return computeFractal2D(ScalarLanes{ x }, ScalarLanes{ y }, FractalType::RIDGED, params).value;
+}
+
+float computeRidged(float x, float y, float z, const FractalParams& params) {
+  return computeFractal3D(Vec3f(x, y, z), FractalType::RIDGED, params);
+}
+
+void fillGrid(float* output, std::size_t rowStride, const GridRegion& region, FractalType fractalType, const FractalParams& params) {
+  assert("Error: The grid's row stride must be greater than or equal to its width." && rowStride >= region.width);
+
+  if (region.width == 0 || region.height == 0)
+    return;
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (region.width * region.height >= parallelGridThreshold) {
+    // Splitting the grid in tiles of several full rows, so that each thread writes to contiguous memory
+    std::vector<Threading::IndexRange> tiles;
+    tiles.reserve((region.height + tileRowCount - 1) / tileRowCount);
+
+    for (std::size_t beginRow = 0; beginRow < region.height; beginRow += tileRowCount)
+      tiles.push_back(Threading::IndexRange{ beginRow, std::min(beginRow + tileRowCount, region.height) });
+
+    Threading::parallelize(tiles, [&] (Threading::IndexRange tileRange) {
+      for (std::size_t tileIndex = tileRange.beginIndex; tileIndex < tileRange.endIndex; ++tileIndex)
+        fillRows(output, rowStride, region, fractalType, params, tiles[tileIndex].beginIndex, tiles[tileIndex].endIndex);
+    });
+
+    return;
+  }
+#endif
+
+  fillRows(output, rowStride, region, fractalType, params, 0, region.height);
+}
+
+void fillImage(Image& image, const Vec2f& origin, const Vec2f& step, FractalType fractalType, const FractalParams& params) {
+  if (image.isEmpty())
+    throw std::invalid_argument("Error: The image to be filled with noise must be allocated");
+
+  const GridRegion region { origin, step, image.getWidth(), image.getHeight() };
+  const std::size_t channelCount = image.getChannelCount();
+
+  if (image.getDataType() == ImageDataType::FLOAT && channelCount == 1) {
+    fillGrid(static_cast<float*>(image.getDataPtr()), region.width, region, fractalType, params);
+    return;
+  }
+
+  std::vector<float> values(region.width * region.height);
+  fillGrid(values.data(), region.width, region, fractalType, params);
+
+  if (image.getDataType() == ImageDataType::FLOAT) {
+    auto* imgData = static_cast<float*>(image.getDataPtr());
+
+    for (std::size_t valueIndex = 0; valueIndex < values.size(); ++valueIndex) {
+      for (std::size_t channelIndex = 0; channelIndex < channelCount; ++channelIndex)
+        imgData[valueIndex * channelCount + channelIndex] = values[valueIndex];
+    }
+  } else {
+    auto* imgData = static_cast<uint8_t*>(image.getDataPtr());
 
-  const float botCoeff = MathUtils::lerp(botLeftDot, botRightDot, smoothX);
-  const float topCoeff = MathUtils::lerp(topLeftDot, topRightDot, smoothX);
+    for (std::size_t valueIndex = 0; valueIndex < values.size(); ++valueIndex) {
+      const auto byteValue = static_cast<uint8_t>(std::round(values[valueIndex] * 255.f));
 
-  return (MathUtils::lerp(botCoeff, topCoeff, smoothY) + 1) / 2; // Scaling between [0; 1]
+      for (std::size_t channelIndex = 0; channelIndex < channelCount; ++channelIndex)
+        imgData[valueIndex * channelCount + channelIndex] = byteValue;
+    }
+  }
 }
 
 } // namespace Raz::PerlinNoise
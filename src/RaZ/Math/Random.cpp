@@ -0,0 +1,430 @@
+#include "RaZ/Math/Constants.hpp"
+#include "RaZ/Math/FastMath.hpp"
+#include "RaZ/Math/Random.hpp"
+#include "RaZ/Math/SimdLanes.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+namespace Raz::Random {
+
+namespace {
+
+constexpr std::array<uint64_t, 4> jumpPolynomial     = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+constexpr std::array<uint64_t, 4> longJumpPolynomial = { 0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull };
+
+constexpr uint64_t rotateLeft(uint64_t value, int shift) { return (value << shift) | (value >> (64 - shift)); }
+
+uint64_t computeSplitMix64(uint64_t& state) {
+  uint64_t result = (state += 0x9E3779B97F4A7C15ull);
+  result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9ull;
+  result = (result ^ (result >> 27)) * 0x94D049BB133111EBull;
+  return result ^ (result >> 31);
+}
+
+// Applies a jump polynomial to a xoshiro256** state, as done by the reference implementation
+void applyJump(std::array<uint64_t, 4>& state, const std::array<uint64_t, 4>& polynomial) {
+  Xoshiro256 generator(state);
+  std::array<uint64_t, 4> jumpedState {};
+
+  for (const uint64_t polynomialBits : polynomial) {
+    for (int bitIndex = 0; bitIndex < 64; ++bitIndex) {
+      if (polynomialBits & (1ull << bitIndex)) {
+        for (std::size_t wordIndex = 0; wordIndex < 4; ++wordIndex)
+          jumpedState[wordIndex] ^= generator.getState()[wordIndex];
+      }
+
+      generator();
+    }
+  }
+
+  state = jumpedState;
+}
+
+// Lanes hold 64-bit generator state words, and are converted to two floats each
+#if defined(RAZ_SIMD_LANES_AVX2)
+using BlockLanes = SimdLanes::Avx2LanesU64;
+#elif defined(RAZ_SIMD_LANES_SSE)
+using BlockLanes = SimdLanes::SseLanesU64;
+#else
+using BlockLanes = SimdLanes::ScalarLanesU64;
+#endif
+
+// Advances all lanes of a bulk generator once, giving a block of floats
+// Multiplications by 5 & 9, which SSE2 & AVX2 cannot make on 64-bit integers, are replaced by shifts & additions
+template <typename LanesT>
+void generateBlock(uint64_t* states, float* values) {
+  constexpr std::size_t laneCount = BulkGenerator::LaneCount;
+
+  for (std::size_t laneIndex = 0; laneIndex < laneCount; laneIndex += LanesT::Size) {
+    LanesT state0 = LanesT::load(states + laneIndex);
+    LanesT state1 = LanesT::load(states + laneCount + laneIndex);
+    LanesT state2 = LanesT::load(states + laneCount * 2 + laneIndex);
+    LanesT state3 = LanesT::load(states + laneCount * 3 + laneIndex);
+
+    const LanesT scaledState = LanesT::template shiftLeft<2>(state1) + state1;
+    const LanesT rotatedState = LanesT::template rotateLeft<7>(scaledState);
+    const LanesT result = LanesT::template shiftLeft<3>(rotatedState) + rotatedState;
+
+    const LanesT shiftedState = LanesT::template shiftLeft<17>(state1);
+    state2 = state2 ^ state0;
+    state3 = state3 ^ state1;
+    state1 = state1 ^ state2;
+    state0 = state0 ^ state3;
+    state2 = state2 ^ shiftedState;
+    state3 = LanesT::template rotateLeft<45>(state3);
+
+    state0.store(states + laneIndex);
+    state1.store(states + laneCount + laneIndex);
+    state2.store(states + laneCount * 2 + laneIndex);
+    state3.store(states + laneCount * 3 + laneIndex);
+
+    LanesT::storeFloats(result, values + laneIndex * 2);
+  }
+}
+
+struct SobolParams {
+  unsigned int degree;                          ///< Degree of the primitive polynomial.
+  uint32_t coeffs;                              ///< Inner coefficients of the primitive polynomial.
+  std::array<uint32_t, 5> initialDirections {}; ///< Initial direction numbers, one per degree.
+};
+
+// First lines of Joe & Kuo's new-joe-kuo-6.21201 file, the first dimension being handled separately
+constexpr std::array<SobolParams, SobolDimensionCount - 1> sobolParams = {{
+  { 1, 0, { 1 } },
+  { 2, 1, { 1, 3 } },
+  { 3, 1, { 1, 3, 1 } },
+  { 3, 2, { 1, 1, 1 } },
+  { 4, 1, { 1, 1, 3, 3 } },
+  { 4, 4, { 1, 3, 5, 13 } },
+  { 5, 2, { 1, 1, 5, 5, 17 } }
+}};
+
+constexpr std::array<std::array<uint32_t, 32>, SobolDimensionCount> computeSobolDirections() {
+  std::array<std::array<uint32_t, 32>, SobolDimensionCount> directions {};
+
+  // The first dimension is the van der Corput sequence, reversing the index's bits
+  for (unsigned int bitIndex = 0; bitIndex < 32; ++bitIndex)
+    directions[0][bitIndex] = 1u << (31 - bitIndex);
+
+  for (std::size_t dimIndex = 1; dimIndex < SobolDimensionCount; ++dimIndex) {
+    const SobolParams& params = sobolParams[dimIndex - 1];
+    std::array<uint32_t, 32>& dimDirections = directions[dimIndex];
+
+    for (unsigned int bitIndex = 0; bitIndex < params.degree; ++bitIndex)
+      dimDirections[bitIndex] = params.initialDirections[bitIndex] << (31 - bitIndex);
+
+    for (unsigned int bitIndex = params.degree; bitIndex < 32; ++bitIndex) {
+      dimDirections[bitIndex] = dimDirections[bitIndex - params.degree] ^ (dimDirections[bitIndex - params.degree] >> params.degree);
+
+      for (unsigned int coeffIndex = 1; coeffIndex < params.degree; ++coeffIndex) {
+        if ((params.coeffs >> (params.degree - 1 - coeffIndex)) & 1u)
+          dimDirections[bitIndex] ^= dimDirections[bitIndex - coeffIndex];
+      }
+    }
+  }
+
+  return directions;
+}
+
+constexpr std::array<std::array<uint32_t, 32>, SobolDimensionCount> sobolDirections = computeSobolDirections();
+
+} // namespace
+
+Pcg32::Pcg32(uint64_t seed, uint64_t stream) noexcept : m_increment{ (stream << 1u) | 1u } {
+  (*this)();
+  m_state += seed;
+  (*this)();
+}
+
+uint32_t Pcg32::generateBounded(uint32_t bound) noexcept {
+  assert("Error: The bound of a generated integer must be strictly positive." && bound > 0);
+
+  // Lemire's method (https://arxiv.org/abs/1805.10941), rejecting the few values that would introduce a bias
+  uint64_t scaledValue = static_cast<uint64_t>((*this)()) * bound;
+  auto lowBits         = static_cast<uint32_t>(scaledValue);
+
+  if (lowBits < bound) {
+    const uint32_t threshold = (0u - bound) % bound;
+
+    while (lowBits < threshold) {
+      scaledValue = static_cast<uint64_t>((*this)()) * bound;
+      lowBits     = static_cast<uint32_t>(scaledValue);
+    }
+  }
+
+  return static_cast<uint32_t>(scaledValue >> 32);
+}
+
+void Pcg32::advance(uint64_t delta) noexcept {
+  // Brown's algorithm, composing the linear congruential steps by squaring
+  uint64_t stepMultiplier = 6364136223846793005ull;
+  uint64_t stepIncrement  = m_increment;
+  uint64_t totalMultiplier = 1;
+  uint64_t totalIncrement  = 0;
+
+  while (delta > 0) {
+    if (delta & 1u) {
+      totalMultiplier *= stepMultiplier;
+      totalIncrement   = totalIncrement * stepMultiplier + stepIncrement;
+    }
+
+    stepIncrement   = (stepMultiplier + 1) * stepIncrement;
+    stepMultiplier *= stepMultiplier;
+    delta >>= 1u;
+  }
+
+  m_state = totalMultiplier * m_state + totalIncrement;
+}
+
+Pcg32::result_type Pcg32::operator()() noexcept {
+  const uint64_t prevState = m_state;
+  m_state = prevState * 6364136223846793005ull + m_increment;
+
+  const auto shiftedState = static_cast<uint32_t>(((prevState >> 18u) ^ prevState) >> 27u);
+  const auto rotation     = static_cast<uint32_t>(prevState >> 59u);
+  return (shiftedState >> rotation) | (shiftedState << ((32u - rotation) & 31u));
+}
+
+Xoshiro256::Xoshiro256(uint64_t seed) noexcept {
+  for (uint64_t& stateWord : m_state)
+    stateWord = computeSplitMix64(seed);
+}
+
+Xoshiro256::Xoshiro256(const std::array<uint64_t, 4>& state) noexcept : m_state{ state } {
+  assert("Error: A xoshiro256** generator's state must not be entirely null." && (state[0] | state[1] | state[2] | state[3]) != 0);
+}
+
+void Xoshiro256::jump() noexcept {
+  applyJump(m_state, jumpPolynomial);
+}
+
+void Xoshiro256::longJump() noexcept {
+  applyJump(m_state, longJumpPolynomial);
+}
+
+Xoshiro256::result_type Xoshiro256::operator()() noexcept {
+  const uint64_t result       = rotateLeft(m_state[1] * 5, 7) * 9;
+  const uint64_t shiftedState = m_state[1] << 17u;
+
+  m_state[2] ^= m_state[0];
+  m_state[3] ^= m_state[1];
+  m_state[1] ^= m_state[2];
+  m_state[0] ^= m_state[3];
+  m_state[2] ^= shiftedState;
+  m_state[3]  = rotateLeft(m_state[3], 45);
+
+  return result;
+}
+
+BulkGenerator::BulkGenerator(uint64_t seed) noexcept {
+  Xoshiro256 generator(seed);
+
+  for (std::size_t laneIndex = 0; laneIndex < LaneCount; ++laneIndex) {
+    for (std::size_t wordIndex = 0; wordIndex < 4; ++wordIndex)
+      m_states[wordIndex * LaneCount + laneIndex] = generator.getState()[wordIndex];
+
+    generator.jump();
+  }
+}
+
+void BulkGenerator::longJump() noexcept {
+  for (std::size_t laneIndex = 0; laneIndex < LaneCount; ++laneIndex) {
+    std::array<uint64_t, 4> laneState {};
+
+    for (std::size_t wordIndex = 0; wordIndex < 4; ++wordIndex)
+      laneState[wordIndex] = m_states[wordIndex * LaneCount + laneIndex];
+
+    applyJump(laneState, longJumpPolynomial);
+
+    for (std::size_t wordIndex = 0; wordIndex < 4; ++wordIndex)
+      m_states[wordIndex * LaneCount + laneIndex] = laneState[wordIndex];
+  }
+}
+
+void BulkGenerator::generateFloats(float* values, std::size_t count) noexcept {
+  while (count >= BlockSize) {
+    generateBlock<BlockLanes>(m_states.data(), values);
+
+    values += BlockSize;
+    count  -= BlockSize;
+  }
+
+  if (count == 0)
+    return;
+
+  std::array<float, BlockSize> block {};
+  generateBlock<BlockLanes>(m_states.data(), block.data());
+  std::copy_n(block.begin(), count, values);
+}
+
+void BulkGenerator::generateUnitVectors(Vec3f* vectors, std::size_t count) noexcept {
+  // Vectors are generated by chunks, their Z coordinate & angle around the Z axis being drawn uniformly (Archimedes' hat-box theorem)
+  constexpr std::size_t chunkSize = 128;
+
+  std::array<float, chunkSize * 2> randomValues {};
+  std::array<float, chunkSize> heights {};
+  std::array<float, chunkSize> angles {};
+  std::array<float, chunkSize> cosines {};
+  std::array<float, chunkSize> sines {};
+
+  for (std::size_t chunkStart = 0; chunkStart < count; chunkStart += chunkSize) {
+    const std::size_t chunkCount = std::min(chunkSize, count - chunkStart);
+    generateFloats(randomValues.data(), chunkCount * 2);
+
+    for (std::size_t vecIndex = 0; vecIndex < chunkCount; ++vecIndex) {
+      heights[vecIndex] = 1.f - 2.f * randomValues[vecIndex * 2];
+      angles[vecIndex]  = randomValues[vecIndex * 2 + 1] * 2.f * Pi<float>;
+    }
+
+    FastMath::cos(angles.data(), cosines.data(), chunkCount);
+    FastMath::sin(angles.data(), sines.data(), chunkCount);
+
+    for (std::size_t vecIndex = 0; vecIndex < chunkCount; ++vecIndex) {
+      const float height = heights[vecIndex];
+      const float radius = std::sqrt(std::max(1.f - height * height, 0.f));
+      vectors[chunkStart + vecIndex] = Vec3f(radius * cosines[vecIndex], radius * sines[vecIndex], height);
+    }
+  }
+}
+
+float computeHalton(uint32_t index, uint32_t base) noexcept {
+  assert("Error: The base of the Halton sequence must be greater than or equal to 2." && base >= 2);
+
+  // The digits are reversed as an integer, so that the only rounding happens with the final division
+  uint64_t reversedDigits = 0;
+  uint64_t denominator    = 1;
+
+  while (index > 0) {
+    reversedDigits = reversedDigits * base + index % base;
+    denominator   *= base;
+    index         /= base;
+  }
+
+  return std::min(static_cast<float>(static_cast<double>(reversedDigits) / static_cast<double>(denominator)), 0x1.fffffep-1f);
+}
+
+float computeSobol(uint32_t index, unsigned int dimension, uint32_t scramble) noexcept {
+  assert("Error: The Sobol sequence's dimension is out of bounds." && dimension < SobolDimensionCount);
+
+  uint32_t result = scramble;
+
+  for (const uint32_t direction : sobolDirections[dimension]) {
+    if (index == 0)
+      break;
+
+    if (index & 1u)
+      result ^= direction;
+
+    index >>= 1u;
+  }
+
+  return static_cast<float>(result >> 8) * 0x1p-24f;
+}
+
+void generateBlueNoise(float* values, unsigned int tileSize, uint64_t seed) {
+  assert("Error: A blue noise tile must be at least 4 texels wide." && tileSize >= 4);
+
+  const std::size_t texelCount = static_cast<std::size_t>(tileSize) * tileSize;
+
+  // Gaussian weights (of standard deviation 1.5) depending on the offset between two texels, wrapping around the tile's borders
+  std::vector<float> weights(texelCount);
+
+  for (unsigned int offsetY = 0; offsetY < tileSize; ++offsetY) {
+    const auto distY = static_cast<float>(std::min(offsetY, tileSize - offsetY));
+
+    for (unsigned int offsetX = 0; offsetX < tileSize; ++offsetX) {
+      const auto distX = static_cast<float>(std::min(offsetX, tileSize - offsetX));
+      weights[offsetY * tileSize + offsetX] = FastMath::exp(-(distX * distX + distY * distY) / 4.5f);
+    }
+  }
+
+  std::vector<uint8_t> pattern(texelCount);
+  std::vector<float> energies(texelCount);
+
+  // The weights' rows are read from the texel's column, wrapping around, which avoids computing a modulo for each texel
+  const auto togglePoint = [&weights, tileSize] (std::vector<uint8_t>& points, std::vector<float>& pointEnergies, std::size_t texelIndex) {
+    const std::size_t texelX = texelIndex % tileSize;
+    const std::size_t texelY = texelIndex / tileSize;
+    const float sign         = (points[texelIndex] ? -1.f : 1.f);
+    points[texelIndex]       = !points[texelIndex];
+
+    for (std::size_t y = 0; y < tileSize; ++y) {
+      const float* weightRow = weights.data() + ((y + tileSize - texelY) % tileSize) * tileSize;
+      float* energyRow       = pointEnergies.data() + y * tileSize;
+
+      for (std::size_t x = texelX; x < tileSize; ++x)
+        energyRow[x] += sign * weightRow[x - texelX];
+
+      for (std::size_t x = 0; x < texelX; ++x)
+        energyRow[x] += sign * weightRow[x + tileSize - texelX];
+    }
+  };
+
+  // The tightest cluster is the point with the highest energy, & the largest void the empty texel with the lowest one
+  const auto findTightestCluster = [texelCount] (const std::vector<uint8_t>& points, const std::vector<float>& pointEnergies) {
+    std::size_t clusterIndex = texelCount;
+
+    for (std::size_t texelIndex = 0; texelIndex < texelCount; ++texelIndex) {
+      if (points[texelIndex] && (clusterIndex == texelCount || pointEnergies[texelIndex] > pointEnergies[clusterIndex]))
+        clusterIndex = texelIndex;
+    }
+
+    return clusterIndex;
+  };
+  const auto findLargestVoid = [texelCount] (const std::vector<uint8_t>& points, const std::vector<float>& pointEnergies) {
+    std::size_t voidIndex = texelCount;
+
+    for (std::size_t texelIndex = 0; texelIndex < texelCount; ++texelIndex) {
+      if (!points[texelIndex] && (voidIndex == texelCount || pointEnergies[texelIndex] < pointEnergies[voidIndex]))
+        voidIndex = texelIndex;
+    }
+
+    return voidIndex;
+  };
+
+  // Placing about a tenth of the points randomly, then moving the tightest cluster into the largest void until both are the same
+  const std::size_t initialPointCount = std::max<std::size_t>(texelCount / 10, 1);
+  Xoshiro256 generator(seed);
+
+  for (std::size_t pointCount = 0; pointCount < initialPointCount;) {
+    const std::size_t texelIndex = generator() % texelCount;
+
+    if (pattern[texelIndex])
+      continue;
+
+    togglePoint(pattern, energies, texelIndex);
+    ++pointCount;
+  }
+
+  for (std::size_t iterIndex = 0; iterIndex < texelCount; ++iterIndex) {
+    const std::size_t clusterIndex = findTightestCluster(pattern, energies);
+    togglePoint(pattern, energies, clusterIndex);
+
+    const std::size_t voidIndex = findLargestVoid(pattern, energies);
+    togglePoint(pattern, energies, voidIndex);
+
+    if (voidIndex == clusterIndex)
+      break;
+  }
+
+  // The initial points are ranked by removing the tightest clusters one by one, the remaining texels by filling the largest voids
+  std::vector<uint8_t> rankedPattern = pattern;
+  std::vector<float> rankedEnergies  = energies;
+
+  for (std::size_t rank = initialPointCount; rank > 0; --rank) {
+    const std::size_t clusterIndex = findTightestCluster(rankedPattern, rankedEnergies);
+    togglePoint(rankedPattern, rankedEnergies, clusterIndex);
+    values[clusterIndex] = static_cast<float>(rank - 1) / static_cast<float>(texelCount);
+  }
+
+  for (std::size_t rank = initialPointCount; rank < texelCount; ++rank) {
+    const std::size_t voidIndex = findLargestVoid(pattern, energies);
+    togglePoint(pattern, energies, voidIndex);
+    values[voidIndex] = static_cast<float>(rank) / static_cast<float>(texelCount);
+  }
+}
+
+} // namespace Raz::Random
@@ -0,0 +1,389 @@
+#include "RaZ/Math/Simd.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define RAZ_SIMD_X86
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define RAZ_SIMD_TARGET(Target)
+#else
+#include <cpuid.h>
+#define RAZ_SIMD_TARGET(Target) __attribute__((target(Target)))
+#endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define RAZ_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Raz::Simd {
+
+namespace {
+
+using KernelFunc = void (*)(const float*, const float*, float*) noexcept;
+
+struct Kernels {
+  InstructionSet instructionSet;
+  KernelFunc multiplyMat4;
+  KernelFunc multiplyMat4Vec4;
+  KernelFunc multiplyVec4Mat4;
+  KernelFunc multiplyQuaternions;
+};
+
+// Scalar kernels, following the exact same operations as the generic math types, so that all kernels can be checked against them
+
+void multiplyMat4Scalar(const float* lhs, const float* rhs, float* res) noexcept {
+  for (std::size_t rowIndex = 0; rowIndex < 4; ++rowIndex) {
+    for (std::size_t colIndex = 0; colIndex < 4; ++colIndex) {
+      float val = 0.f;
+
+      for (std::size_t stride = 0; stride < 4; ++stride)
+        val += lhs[rowIndex * 4 + stride] * rhs[stride * 4 + colIndex];
+
+      res[rowIndex * 4 + colIndex] = val;
+    }
+  }
+}
+
+void multiplyMat4Vec4Scalar(const float* mat, const float* vec, float* res) noexcept {
+  for (std::size_t rowIndex = 0; rowIndex < 4; ++rowIndex) {
+    float val = 0.f;
+
+    for (std::size_t colIndex = 0; colIndex < 4; ++colIndex)
+      val += mat[rowIndex * 4 + colIndex] * vec[colIndex];
+
+    res[rowIndex] = val;
+  }
+}
+
+void multiplyVec4Mat4Scalar(const float* vec, const float* mat, float* res) noexcept {
+  for (std::size_t colIndex = 0; colIndex < 4; ++colIndex) {
+    float val = 0.f;
+
+    for (std::size_t rowIndex = 0; rowIndex < 4; ++rowIndex)
+      val += vec[rowIndex] * mat[rowIndex * 4 + colIndex];
+
+    res[colIndex] = val;
+  }
+}
+
+void multiplyQuaternionsScalar(const float* lhs, const float* rhs, float* res) noexcept {
+  const float lhsW = lhs[0], lhsX = lhs[1], lhsY = lhs[2], lhsZ = lhs[3];
+  const float rhsW = rhs[0], rhsX = rhs[1], rhsY = rhs[2], rhsZ = rhs[3];
+
+  res[0] = lhsW * rhsW - lhsX * rhsX - lhsY * rhsY - lhsZ * rhsZ;
+  res[1] = lhsW * rhsX + lhsX * rhsW + lhsY * rhsZ - lhsZ * rhsY;
+  res[2] = lhsW * rhsY - lhsX * rhsZ + lhsY * rhsW + lhsZ * rhsX;
+  res[3] = lhsW * rhsZ + lhsX * rhsY - lhsY * rhsX + lhsZ * rhsW;
+}
+
+#if defined(RAZ_SIMD_X86)
+
+// SSE4.1 kernels
+
+RAZ_SIMD_TARGET("sse4.1")
+void multiplyMat4Sse(const float* lhs, const float* rhs, float* res) noexcept {
+  const __m128 rhsRow0 = _mm_loadu_ps(rhs);
+  const __m128 rhsRow1 = _mm_loadu_ps(rhs + 4);
+  const __m128 rhsRow2 = _mm_loadu_ps(rhs + 8);
+  const __m128 rhsRow3 = _mm_loadu_ps(rhs + 12);
+
+  // Each resulting row is the sum of the right-hand side's rows, weighted by the left-hand side's row values
+  for (std::size_t rowIndex = 0; rowIndex < 4; ++rowIndex) {
+    const float* lhsRow = lhs + rowIndex * 4;
+
+    __m128 row = _mm_setzero_ps();
+    row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(lhsRow[0]), rhsRow0));
+    row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(lhsRow[1]), rhsRow1));
+    row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(lhsRow[2]), rhsRow2));
+    row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(lhsRow[3]), rhsRow3));
+
+    _mm_storeu_ps(res + rowIndex * 4, row);
+  }
+}
+
+RAZ_SIMD_TARGET("sse4.1")
+void multiplyMat4Vec4Sse(const float* mat, const float* vec, float* res) noexcept {
+  // The matrix is transposed so that the result is the sum of its columns, weighted by the vector's values
+  __m128 col0 = _mm_loadu_ps(mat);
+  __m128 col1 = _mm_loadu_ps(mat + 4);
+  __m128 col2 = _mm_loadu_ps(mat + 8);
+  __m128 col3 = _mm_loadu_ps(mat + 12);
+  _MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+
+  __m128 resVec = _mm_setzero_ps();
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(col0, _mm_set1_ps(vec[0])));
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(col1, _mm_set1_ps(vec[1])));
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(col2, _mm_set1_ps(vec[2])));
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(col3, _mm_set1_ps(vec[3])));
+
+  _mm_storeu_ps(res, resVec);
+}
+
+RAZ_SIMD_TARGET("sse4.1")
+void multiplyVec4Mat4Sse(const float* vec, const float* mat, float* res) noexcept {
+  __m128 resVec = _mm_setzero_ps();
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(_mm_set1_ps(vec[0]), _mm_loadu_ps(mat)));
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(_mm_set1_ps(vec[1]), _mm_loadu_ps(mat + 4)));
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(_mm_set1_ps(vec[2]), _mm_loadu_ps(mat + 8)));
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(_mm_set1_ps(vec[3]), _mm_loadu_ps(mat + 12)));
+
+  _mm_storeu_ps(res, resVec);
+}
+
+RAZ_SIMD_TARGET("sse4.1")
+void multiplyQuaternionsSse(const float* lhs, const float* rhs, float* res) noexcept {
+  // Each lane computes one of the [ w; x; y; z ] components; the right-hand side is shuffled & its signs flipped for each of the left-hand side's
+  const __m128 lhsVec = _mm_loadu_ps(lhs);
+  const __m128 rhsVec = _mm_loadu_ps(rhs);
+
+  const __m128 rhsXwzy = _mm_shuffle_ps(rhsVec, rhsVec, _MM_SHUFFLE(2, 3, 0, 1));
+  const __m128 rhsYzwx = _mm_shuffle_ps(rhsVec, rhsVec, _MM_SHUFFLE(1, 0, 3, 2));
+  const __m128 rhsZyxw = _mm_shuffle_ps(rhsVec, rhsVec, _MM_SHUFFLE(0, 1, 2, 3));
+
+  const __m128 signsX = _mm_setr_ps(-0.f, 0.f, -0.f, 0.f);
+  const __m128 signsY = _mm_setr_ps(-0.f, 0.f, 0.f, -0.f);
+  const __m128 signsZ = _mm_setr_ps(-0.f, -0.f, 0.f, 0.f);
+
+  __m128 resVec = _mm_mul_ps(_mm_shuffle_ps(lhsVec, lhsVec, _MM_SHUFFLE(0, 0, 0, 0)), rhsVec);
+  resVec = _mm_add_ps(resVec, _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(lhsVec, lhsVec, _MM_SHUFFLE(1, 1, 1, 1)), rhsXwzy), signsX));
+  resVec = _mm_add_ps(resVec, _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(lhsVec, lhsVec, _MM_SHUFFLE(2, 2, 2, 2)), rhsYzwx), signsY));
+  resVec = _mm_add_ps(resVec, _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(lhsVec, lhsVec, _MM_SHUFFLE(3, 3, 3, 3)), rhsZyxw), signsZ));
+
+  _mm_storeu_ps(res, resVec);
+}
+
+// AVX2 kernels
+
+RAZ_SIMD_TARGET("avx2")
+void multiplyMat4Avx(const float* lhs, const float* rhs, float* res) noexcept {
+  // Two resulting rows are computed at once, each 128-bit lane holding one of them
+  const __m256 rhsRow0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs));
+  const __m256 rhsRow1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 4));
+  const __m256 rhsRow2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 8));
+  const __m256 rhsRow3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 12));
+
+  for (std::size_t rowIndex = 0; rowIndex < 4; rowIndex += 2) {
+    const __m256 lhsRows = _mm256_loadu_ps(lhs + rowIndex * 4);
+
+    __m256 rows = _mm256_setzero_ps();
+    rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(0, 0, 0, 0)), rhsRow0));
+    rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(1, 1, 1, 1)), rhsRow1));
+    rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(2, 2, 2, 2)), rhsRow2));
+    rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(3, 3, 3, 3)), rhsRow3));
+
+    _mm256_storeu_ps(res + rowIndex * 4, rows);
+  }
+}
+
+/// Checks if the CPU supports SSE4.1.
+/// \return True if SSE4.1 is supported, false otherwise.
+bool checkSse41Support() noexcept {
+#if defined(_MSC_VER)
+  int registers[4] {};
+  __cpuid(registers, 1);
+  return (registers[2] & (1 << 19));
+#else
+  unsigned int eax {}, ebx {}, ecx {}, edx {};
+  return (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (1u << 19u)));
+#endif
+}
+
+/// Checks if the CPU supports AVX2, which also requires the OS to save the 256-bit registers' state.
+/// \return True if AVX2 is supported & enabled, false otherwise.
+bool checkAvx2Support() noexcept {
+#if defined(_MSC_VER)
+  int registers[4] {};
+  __cpuid(registers, 1);
+
+  const bool hasOsSaveSupport = (registers[2] & (1 << 27));
+  const bool hasAvxSupport    = (registers[2] & (1 << 28));
+
+  if (!hasOsSaveSupport || !hasAvxSupport || (_xgetbv(0) & 6) != 6)
+    return false;
+
+  __cpuidex(registers, 7, 0);
+  return (registers[1] & (1 << 5));
+#else
+  unsigned int eax {}, ebx {}, ecx {}, edx {};
+
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    return false;
+
+  const bool hasOsSaveSupport = (ecx & (1u << 27u));
+  const bool hasAvxSupport    = (ecx & (1u << 28u));
+
+  if (!hasOsSaveSupport || !hasAvxSupport)
+    return false;
+
+  // Checking that the OS has enabled both the XMM & YMM registers' state saving
+  unsigned int xcrLow {}, xcrHigh {};
+  __asm__ volatile("xgetbv" : "=a"(xcrLow), "=d"(xcrHigh) : "c"(0));
+  static_cast<void>(xcrHigh);
+
+  if ((xcrLow & 6u) != 6u)
+    return false;
+
+  return (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & (1u << 5u)));
+#endif
+}
+
+#elif defined(RAZ_SIMD_NEON)
+
+// NEON kernels
+
+void multiplyMat4Neon(const float* lhs, const float* rhs, float* res) noexcept {
+  const float32x4_t rhsRow0 = vld1q_f32(rhs);
+  const float32x4_t rhsRow1 = vld1q_f32(rhs + 4);
+  const float32x4_t rhsRow2 = vld1q_f32(rhs + 8);
+  const float32x4_t rhsRow3 = vld1q_f32(rhs + 12);
+
+  for (std::size_t rowIndex = 0; rowIndex < 4; ++rowIndex) {
+    const float* lhsRow = lhs + rowIndex * 4;
+
+    // Multiplications & additions are voluntarily kept separate, a fused multiply-add giving different results from the scalar path
+    float32x4_t row = vdupq_n_f32(0.f);
+    row = vaddq_f32(row, vmulq_f32(vdupq_n_f32(lhsRow[0]), rhsRow0));
+    row = vaddq_f32(row, vmulq_f32(vdupq_n_f32(lhsRow[1]), rhsRow1));
+    row = vaddq_f32(row, vmulq_f32(vdupq_n_f32(lhsRow[2]), rhsRow2));
+    row = vaddq_f32(row, vmulq_f32(vdupq_n_f32(lhsRow[3]), rhsRow3));
+
+    vst1q_f32(res + rowIndex * 4, row);
+  }
+}
+
+void multiplyMat4Vec4Neon(const float* mat, const float* vec, float* res) noexcept {
+  const float32x4x4_t cols = vld4q_f32(mat); // Loads the values deinterleaved, thus transposing the matrix
+
+  float32x4_t resVec = vdupq_n_f32(0.f);
+  resVec = vaddq_f32(resVec, vmulq_f32(cols.val[0], vdupq_n_f32(vec[0])));
+  resVec = vaddq_f32(resVec, vmulq_f32(cols.val[1], vdupq_n_f32(vec[1])));
+  resVec = vaddq_f32(resVec, vmulq_f32(cols.val[2], vdupq_n_f32(vec[2])));
+  resVec = vaddq_f32(resVec, vmulq_f32(cols.val[3], vdupq_n_f32(vec[3])));
+
+  vst1q_f32(res, resVec);
+}
+
+void multiplyVec4Mat4Neon(const float* vec, const float* mat, float* res) noexcept {
+  float32x4_t resVec = vdupq_n_f32(0.f);
+  resVec = vaddq_f32(resVec, vmulq_f32(vdupq_n_f32(vec[0]), vld1q_f32(mat)));
+  resVec = vaddq_f32(resVec, vmulq_f32(vdupq_n_f32(vec[1]), vld1q_f32(mat + 4)));
+  resVec = vaddq_f32(resVec, vmulq_f32(vdupq_n_f32(vec[2]), vld1q_f32(mat + 8)));
+  resVec = vaddq_f32(resVec, vmulq_f32(vdupq_n_f32(vec[3]), vld1q_f32(mat + 12)));
+
+  vst1q_f32(res, resVec);
+}
+
+void multiplyQuaternionsNeon(const float* lhs, const float* rhs, float* res) noexcept {
+  const float rhsXwzy[4] = { rhs[1], rhs[0], rhs[3], rhs[2] };
+  const float rhsYzwx[4] = { rhs[2], rhs[3], rhs[0], rhs[1] };
+  const float rhsZyxw[4] = { rhs[3], rhs[2], rhs[1], rhs[0] };
+
+  const float signsX[4] = { -1.f, 1.f, -1.f, 1.f };
+  const float signsY[4] = { -1.f, 1.f, 1.f, -1.f };
+  const float signsZ[4] = { -1.f, -1.f, 1.f, 1.f };
+
+  float32x4_t resVec = vmulq_f32(vdupq_n_f32(lhs[0]), vld1q_f32(rhs));
+  resVec = vaddq_f32(resVec, vmulq_f32(vmulq_f32(vdupq_n_f32(lhs[1]), vld1q_f32(rhsXwzy)), vld1q_f32(signsX)));
+  resVec = vaddq_f32(resVec, vmulq_f32(vmulq_f32(vdupq_n_f32(lhs[2]), vld1q_f32(rhsYzwx)), vld1q_f32(signsY)));
+  resVec = vaddq_f32(resVec, vmulq_f32(vmulq_f32(vdupq_n_f32(lhs[3]), vld1q_f32(rhsZyxw)), vld1q_f32(signsZ)));
+
+  vst1q_f32(res, resVec);
+}
+
+#endif
+
+Kernels selectKernels(InstructionSet instructionSet) noexcept {
+  switch (instructionSet) {
+#if defined(RAZ_SIMD_X86)
+    case InstructionSet::AVX2:
+      // Only the matrix-matrix product benefits from the wider registers; the other kernels are the same as with SSE4.1
+      return Kernels{ instructionSet, &multiplyMat4Avx, &multiplyMat4Vec4Sse, &multiplyVec4Mat4Sse, &multiplyQuaternionsSse };
+
+    case InstructionSet::SSE4_1:
+      return Kernels{ instructionSet, &multiplyMat4Sse, &multiplyMat4Vec4Sse, &multiplyVec4Mat4Sse, &multiplyQuaternionsSse };
+#elif defined(RAZ_SIMD_NEON)
+    case InstructionSet::NEON:
+      return Kernels{ instructionSet, &multiplyMat4Neon, &multiplyMat4Vec4Neon, &multiplyVec4Mat4Neon, &multiplyQuaternionsNeon };
+#endif
+
+    default:
+      return Kernels{ InstructionSet::SCALAR, &multiplyMat4Scalar, &multiplyMat4Vec4Scalar, &multiplyVec4Mat4Scalar, &multiplyQuaternionsScalar };
+  }
+}
+
+Kernels& getKernels() noexcept {
+  // The kernels are selected on first use, so that they can safely be used during static initialization
+  static Kernels kernels = selectKernels(detectInstructionSet());
+  return kernels;
+}
+
+} // namespace
+
+bool isSupported(InstructionSet instructionSet) noexcept {
+  switch (instructionSet) {
+    case InstructionSet::SCALAR:
+      return true;
+
+#if defined(RAZ_SIMD_X86)
+    case InstructionSet::SSE4_1:
+    {
+      static const bool isSse41Supported = checkSse41Support();
+      return isSse41Supported;
+    }
+
+    case InstructionSet::AVX2:
+    {
+      static const bool isAvx2Supported = checkAvx2Support();
+      return isAvx2Supported;
+    }
+#elif defined(RAZ_SIMD_NEON)
+    case InstructionSet::NEON:
+      return true; // NEON is always available on the ARM platforms it is enabled for
+#endif
+
+    default:
+      return false;
+  }
+}
+
+InstructionSet detectInstructionSet() noexcept {
+  for (InstructionSet instructionSet : { InstructionSet::AVX2, InstructionSet::SSE4_1, InstructionSet::NEON }) {
+    if (isSupported(instructionSet))
+      return instructionSet;
+  }
+
+  return InstructionSet::SCALAR;
+}
+
+InstructionSet getInstructionSet() noexcept {
+  return getKernels().instructionSet;
+}
+
+void setInstructionSet(InstructionSet instructionSet) {
+  if (!isSupported(instructionSet))
+    throw std::invalid_argument("Error: The given instruction set is not supported by either the build or the CPU.");
+
+  getKernels() = selectKernels(instructionSet);
+}
+
+void multiplyMat4(const float* lhs, const float* rhs, float* res) noexcept {
+  getKernels().multiplyMat4(lhs, rhs, res);
+}
+
+void multiplyMat4Vec4(const float* mat, const float* vec, float* res) noexcept {
+  getKernels().multiplyMat4Vec4(mat, vec, res);
+}
+
+void multiplyVec4Mat4(const float* vec, const float* mat, float* res) noexcept {
+  getKernels().multiplyVec4Mat4(vec, mat, res);
+}
+
+void multiplyQuaternions(const float* lhs, const float* rhs, float* res) noexcept {
+  getKernels().multiplyQuaternions(lhs, rhs, res);
+}
+
+} // namespace Raz::Simd
@@ -1,3 +1,4 @@
+#include "RaZ/Math/FastMath.hpp"
 #include "RaZ/Math/Transform.hpp"
 
 namespace Raz {
@@ -26,7 +27,7 @@ void Transform::translate(float x, float y, float z) {
 }
 
 void Transform::rotate(Radiansf angle, const Vec3f& axis) {
-  assert("Error: Rotation axis must be normalized." && FloatUtils::areNearlyEqual(axis.computeLength(), 1.f));
+  assert("Error: Rotation axis must be normalized." && FloatUtils::areNearlyEqual(axis.computeLength(), 1.f, FastMath::comparisonTolerance));
 
   const Quaternionf quaternion(angle, axis);
   m_rotation = quaternion * m_rotation;
@@ -69,13 +70,14 @@ Mat4f Transform::computeTranslationMatrix(bool reverseTranslation) const {
   return translationMat;
 }
 
-Mat4f Transform::computeTransformMatrix() const {
-  const Mat4f scale(m_scale[0], 0.f,        0.f,        0.f,
-                    0.f,        m_scale[1], 0.f,        0.f,
-                    0.f,        0.f,        m_scale[2], 0.f,
-                    0.f,        0.f,        0.f,        1.f);
+Affine3f Transform::computeAffineTransform() const {
+  // Scaling then rotating amounts to scaling each row of the rotation matrix
+  const Mat3f rotation(m_rotation.computeMatrix());
+  const Mat3f linear(rotation.recoverRow(0) * m_scale[0],
+                     rotation.recoverRow(1) * m_scale[1],
+                     rotation.recoverRow(2) * m_scale[2]);
 
-  return scale * m_rotation.computeMatrix() * computeTranslationMatrix();
+  return Affine3f(linear, m_position);
 }
 
 } // namespace Raz
@@ -0,0 +1,507 @@
+#include "RaZ/Math/SimdLanes.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Math/TransformBatch.hpp"
+#include "RaZ/Utils/Shape.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <array>
+#include <cassert>
+#include <cmath>
+
+namespace Raz {
+
+namespace {
+
+#if defined(RAZ_THREADS_AVAILABLE)
+constexpr std::size_t parallelBatchThreshold = 16384; // Number of objects from which a batch operation is split across threads
+#endif
+
+// Groups the 4 components of several quaternions
+template <typename LanesT>
+struct QuaternionLanes {
+  static QuaternionLanes load(const QuaternionBatch& batch, std::size_t index) {
+    return QuaternionLanes{ LanesT::load(batch.w.data() + index), LanesT::load(batch.x.data() + index),
+                            LanesT::load(batch.y.data() + index), LanesT::load(batch.z.data() + index) };
+  }
+
+  void store(QuaternionBatch& batch, std::size_t index) const {
+    w.store(batch.w.data() + index);
+    x.store(batch.x.data() + index);
+    y.store(batch.y.data() + index);
+    z.store(batch.z.data() + index);
+  }
+
+  LanesT dot(const QuaternionLanes& quat) const { return w * quat.w + ((x * quat.x + y * quat.y) + z * quat.z); }
+
+  QuaternionLanes lerp(const QuaternionLanes& quat, LanesT currCoeff, LanesT otherCoeff) const {
+    return QuaternionLanes{ w * currCoeff + quat.w * otherCoeff, x * currCoeff + quat.x * otherCoeff,
+                            y * currCoeff + quat.y * otherCoeff, z * currCoeff + quat.z * otherCoeff };
+  }
+
+  QuaternionLanes normalize() const {
+    const LanesT sqNorm    = dot(*this);
+    const LanesT invSqNorm = LanesT::broadcast(1.f) / LanesT::sqrt(sqNorm);
+
+    // Null quaternions are left untouched
+    const typename LanesT::Mask isNotNull = LanesT::greater(sqNorm, LanesT::broadcast(0.f));
+    return QuaternionLanes{ LanesT::select(isNotNull, w * invSqNorm, w), LanesT::select(isNotNull, x * invSqNorm, x),
+                            LanesT::select(isNotNull, y * invSqNorm, y), LanesT::select(isNotNull, z * invSqNorm, z) };
+  }
+
+  LanesT w;
+  LanesT x;
+  LanesT y;
+  LanesT z;
+};
+
+// Computes the 3x3 rotation matrices represented by several quaternions at once, as row-major values
+// The operations are made in the same order as Quaternion::computeMatrix(), thus giving the exact same results
+template <typename LanesT>
+std::array<LanesT, 9> computeRotationLanes(LanesT w, LanesT x, LanesT y, LanesT z) {
+  const LanesT one = LanesT::broadcast(1.f);
+  const LanesT two = LanesT::broadcast(2.f);
+
+  const LanesT invSqNorm = one / (w * w + ((x * x + y * y) + z * z));
+
+  const LanesT xx = (two * x * x) * invSqNorm;
+  const LanesT yy = (two * y * y) * invSqNorm;
+  const LanesT zz = (two * z * z) * invSqNorm;
+
+  const LanesT xy = (two * x * y) * invSqNorm;
+  const LanesT xz = (two * x * z) * invSqNorm;
+  const LanesT yz = (two * y * z) * invSqNorm;
+
+  const LanesT xw = (two * x * w) * invSqNorm;
+  const LanesT yw = (two * y * w) * invSqNorm;
+  const LanesT zw = (two * z * w) * invSqNorm;
+
+  return {
+    one - yy - zz, xy - zw,       xz + yw,
+    xy + zw,       one - xx - zz, yz - xw,
+    xz - yw,       yz + xw,       one - xx - yy
+  };
+}
+
+// Computes the 3x3 linear parts (scale & rotation) of several transforms at once, as row-major values
+// The operations are made in the same order as Transform::computeAffineTransform(), thus giving the exact same results
+template <typename LanesT>
+std::array<LanesT, 9> computeLinearLanes(const TransformBatch& batch, std::size_t index) {
+  std::array<LanesT, 9> linear = computeRotationLanes(LanesT::load(batch.rotationW.data() + index), LanesT::load(batch.rotationX.data() + index),
+                                                      LanesT::load(batch.rotationY.data() + index), LanesT::load(batch.rotationZ.data() + index));
+
+  const std::array<LanesT, 3> scale = { LanesT::load(batch.scaleX.data() + index),
+                                        LanesT::load(batch.scaleY.data() + index),
+                                        LanesT::load(batch.scaleZ.data() + index) };
+
+  for (std::size_t elementIndex = 0; elementIndex < 9; ++elementIndex)
+    linear[elementIndex] = linear[elementIndex] * scale[elementIndex / 3];
+
+  return linear;
+}
+
+// Gives the interpolation coefficients, either one for all elements or one for each of them
+struct InterpolationCoeffs {
+  template <typename LanesT>
+  LanesT load(std::size_t index) const { return (values ? LanesT::load(values + index) : LanesT::broadcast(constant)); }
+
+  const float* values;
+  float constant;
+};
+
+// Computes the coefficients of a spherical linear interpolation, as done by Quaternion::slerp()
+void computeSlerpCoeffs(float cosAngle, float coeff, float& currCoeff, float& otherCoeff) {
+  const float absCosAngle = std::abs(cosAngle);
+
+  if (absCosAngle < 0.99999f) {
+    const float angle       = std::acos(absCosAngle);
+    const float invSinAngle = 1.f / std::sin(angle);
+
+    currCoeff  = std::sin((1.f - coeff) * angle) * invSinAngle;
+    otherCoeff = std::sin(coeff * angle) * invSinAngle;
+  } else {
+    currCoeff  = 1.f - coeff;
+    otherCoeff = coeff;
+  }
+
+  otherCoeff = (cosAngle > 0.f ? otherCoeff : -otherCoeff);
+}
+
+// Approximates sin(coeff * angle) / sin(angle) from cos(angle) with a polynomial, without any trigonometric function
+// See "A Fast and Accurate Algorithm for Computing SLERP", by David Eberly: https://www.geometrictools.com/Documentation/FastAndAccurateSlerp.pdf
+template <typename LanesT>
+LanesT computeFastSlerpCoeff(LanesT cosAngleMinusOne, LanesT coeff) {
+  constexpr std::size_t termCount = 8;
+  constexpr float lastTermCorrection = 1.85298109240830f; // Correction applied to the last term, reducing the error caused by the series' truncation
+
+  const LanesT one       = LanesT::broadcast(1.f);
+  const LanesT sqCoeff   = coeff * coeff;
+  LanesT res             = one;
+
+  for (std::size_t termIndex = termCount; termIndex > 0; --termIndex) {
+    const auto index     = static_cast<float>(termIndex);
+    const float termCorr = (termIndex == termCount ? lastTermCorrection : 1.f);
+    const LanesT u       = LanesT::broadcast(termCorr / (index * (2.f * index + 1.f)));
+    const LanesT v       = LanesT::broadcast(termCorr * index / (2.f * index + 1.f));
+
+    res = one + (u * sqCoeff - v) * cosAngleMinusOne * res;
+  }
+
+  return coeff * res;
+}
+
+// Applies a kernel on all objects of a batch, splitting them across threads if there are enough
+// Any of the batch's value arrays can be given, all of them having as many elements as there are objects
+template <typename KernelT>
+void processBatch(const std::vector<float>& batchValues, const KernelT& kernel) {
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (batchValues.size() >= parallelBatchThreshold) {
+    Threading::parallelize(batchValues, [&kernel] (Threading::IndexRange range) {
+      SimdLanes::processLanes(range.beginIndex, range.endIndex, kernel);
+    });
+    return;
+  }
+#endif
+
+  SimdLanes::processLanes(0, batchValues.size(), kernel);
+}
+
+// Stores the 4x4 matrices of several objects from their linear parts & translations
+// The values are computed for several objects at once, but the matrices are stored one after the other; they thus need to be rearranged
+template <typename LanesT>
+void storeMatrices(const std::array<LanesT, 9>& linearLanes, std::size_t index, Mat4f* matrices,
+                   const float* translationX = nullptr, const float* translationY = nullptr, const float* translationZ = nullptr) {
+  std::array<std::array<float, LanesT::Size>, 9> linear {};
+  for (std::size_t elementIndex = 0; elementIndex < 9; ++elementIndex)
+    linearLanes[elementIndex].store(linear[elementIndex].data());
+
+  for (std::size_t laneIndex = 0; laneIndex < LanesT::Size; ++laneIndex) {
+    const std::size_t objectIndex = index + laneIndex;
+    const Vec3f translation = (translationX ? Vec3f(translationX[objectIndex], translationY[objectIndex], translationZ[objectIndex]) : Vec3f(0.f));
+
+    matrices[objectIndex] = Mat4f(linear[0][laneIndex], linear[1][laneIndex], linear[2][laneIndex], 0.f,
+                                  linear[3][laneIndex], linear[4][laneIndex], linear[5][laneIndex], 0.f,
+                                  linear[6][laneIndex], linear[7][laneIndex], linear[8][laneIndex], 0.f,
+                                  translation.x(),      translation.y(),      translation.z(),      1.f);
+  }
+}
+
+void nlerpQuaternions(const QuaternionBatch& currQuats, const QuaternionBatch& otherQuats, const InterpolationCoeffs& coeffs, QuaternionBatch& result) {
+  assert("Error: There must be as many quaternions in both batches." && otherQuats.getCount() == currQuats.getCount());
+
+  result.resize(currQuats.getCount());
+
+  processBatch(currQuats.w, [&currQuats, &otherQuats, &coeffs, &result] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+
+    const QuaternionLanes<LanesT> currQuat  = QuaternionLanes<LanesT>::load(currQuats, index);
+    const QuaternionLanes<LanesT> otherQuat = QuaternionLanes<LanesT>::load(otherQuats, index);
+
+    const LanesT otherCoeff = coeffs.load<LanesT>(index);
+    const LanesT currCoeff  = LanesT::broadcast(1.f) - otherCoeff;
+
+    // As with Quaternion::nlerp(), the coefficient is negated if the dot product is negative so that the shortest path is taken
+    const typename LanesT::Mask isDotPositive = LanesT::greater(currQuat.dot(otherQuat), LanesT::broadcast(0.f));
+    const LanesT signedOtherCoeff = LanesT::select(isDotPositive, otherCoeff, otherCoeff * LanesT::broadcast(-1.f));
+
+    currQuat.lerp(otherQuat, currCoeff, signedOtherCoeff).normalize().store(result, index);
+  });
+}
+
+void slerpQuaternions(const QuaternionBatch& currQuats, const QuaternionBatch& otherQuats, const InterpolationCoeffs& coeffs,
+                      QuaternionBatch& result, SlerpMode mode) {
+  assert("Error: There must be as many quaternions in both batches." && otherQuats.getCount() == currQuats.getCount());
+
+  result.resize(currQuats.getCount());
+
+  processBatch(currQuats.w, [&currQuats, &otherQuats, &coeffs, &result, mode] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+
+    const QuaternionLanes<LanesT> currQuat  = QuaternionLanes<LanesT>::load(currQuats, index);
+    const QuaternionLanes<LanesT> otherQuat = QuaternionLanes<LanesT>::load(otherQuats, index);
+
+    const LanesT cosAngle = currQuat.dot(otherQuat);
+    const LanesT coeff    = coeffs.load<LanesT>(index);
+
+    LanesT currCoeff {};
+    LanesT otherCoeff {};
+
+    if (mode == SlerpMode::FAST) {
+      const LanesT zero = LanesT::broadcast(0.f);
+      const LanesT one  = LanesT::broadcast(1.f);
+
+      const typename LanesT::Mask isCosPositive = LanesT::greater(cosAngle, zero);
+      const LanesT absCosAngleMinusOne          = LanesT::select(isCosPositive, cosAngle, zero - cosAngle) - one;
+
+      currCoeff  = computeFastSlerpCoeff(absCosAngleMinusOne, one - coeff);
+      otherCoeff = computeFastSlerpCoeff(absCosAngleMinusOne, coeff);
+      otherCoeff = LanesT::select(isCosPositive, otherCoeff, otherCoeff * LanesT::broadcast(-1.f));
+    } else {
+      // There is no SIMD trigonometric function; the coefficients are computed for each quaternion, the interpolation itself being vectorized
+      std::array<float, LanesT::Size> cosAngles {};
+      std::array<float, LanesT::Size> interpCoeffs {};
+      cosAngle.store(cosAngles.data());
+      coeff.store(interpCoeffs.data());
+
+      std::array<float, LanesT::Size> currCoeffs {};
+      std::array<float, LanesT::Size> otherCoeffs {};
+
+      for (std::size_t laneIndex = 0; laneIndex < LanesT::Size; ++laneIndex)
+        computeSlerpCoeffs(cosAngles[laneIndex], interpCoeffs[laneIndex], currCoeffs[laneIndex], otherCoeffs[laneIndex]);
+
+      currCoeff  = LanesT::load(currCoeffs.data());
+      otherCoeff = LanesT::load(otherCoeffs.data());
+    }
+
+    currQuat.lerp(otherQuat, currCoeff, otherCoeff).store(result, index);
+  });
+}
+
+} // namespace
+
+void BoxBatch::resize(std::size_t count) {
+  minX.resize(count);
+  minY.resize(count);
+  minZ.resize(count);
+  maxX.resize(count);
+  maxY.resize(count);
+  maxZ.resize(count);
+}
+
+void BoxBatch::setBox(std::size_t index, const AABB& aabb) {
+  assert("Error: The box index is out of bounds." && index < getCount());
+
+  minX[index] = aabb.getLeftBottomBackPos().x();
+  minY[index] = aabb.getLeftBottomBackPos().y();
+  minZ[index] = aabb.getLeftBottomBackPos().z();
+  maxX[index] = aabb.getRightTopFrontPos().x();
+  maxY[index] = aabb.getRightTopFrontPos().y();
+  maxZ[index] = aabb.getRightTopFrontPos().z();
+}
+
+AABB BoxBatch::recoverBox(std::size_t index) const {
+  assert("Error: The box index is out of bounds." && index < getCount());
+  return AABB(Vec3f(minX[index], minY[index], minZ[index]), Vec3f(maxX[index], maxY[index], maxZ[index]));
+}
+
+void SphereBatch::resize(std::size_t count) {
+  centerX.resize(count);
+  centerY.resize(count);
+  centerZ.resize(count);
+  radius.resize(count);
+}
+
+void SphereBatch::setSphere(std::size_t index, const Sphere& sphere) {
+  assert("Error: The sphere index is out of bounds." && index < getCount());
+
+  centerX[index] = sphere.getCenter().x();
+  centerY[index] = sphere.getCenter().y();
+  centerZ[index] = sphere.getCenter().z();
+  radius[index]  = sphere.getRadius();
+}
+
+Sphere SphereBatch::recoverSphere(std::size_t index) const {
+  assert("Error: The sphere index is out of bounds." && index < getCount());
+  return Sphere(Vec3f(centerX[index], centerY[index], centerZ[index]), radius[index]);
+}
+
+void QuaternionBatch::resize(std::size_t count) {
+  w.resize(count, 1.f);
+  x.resize(count, 0.f);
+  y.resize(count, 0.f);
+  z.resize(count, 0.f);
+}
+
+void QuaternionBatch::setQuaternion(std::size_t index, const Quaternionf& quat) {
+  assert("Error: The quaternion index is out of bounds." && index < getCount());
+
+  w[index] = quat.w();
+  x[index] = quat.x();
+  y[index] = quat.y();
+  z[index] = quat.z();
+}
+
+Quaternionf QuaternionBatch::recoverQuaternion(std::size_t index) const {
+  assert("Error: The quaternion index is out of bounds." && index < getCount());
+  return Quaternionf(w[index], x[index], y[index], z[index]);
+}
+
+void QuaternionBatch::normalize(QuaternionBatch& result) const {
+  result.resize(getCount());
+
+  processBatch(w, [this, &result] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+    QuaternionLanes<LanesT>::load(*this, index).normalize().store(result, index);
+  });
+}
+
+void QuaternionBatch::multiply(const QuaternionBatch& quats, QuaternionBatch& result) const {
+  assert("Error: There must be as many quaternions in both batches." && quats.getCount() == getCount());
+
+  result.resize(getCount());
+
+  processBatch(w, [this, &quats, &result] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+
+    const QuaternionLanes<LanesT> lhs = QuaternionLanes<LanesT>::load(*this, index);
+    const QuaternionLanes<LanesT> rhs = QuaternionLanes<LanesT>::load(quats, index);
+
+    // The operations are made in the same order as Quaternion::operator*=(), thus giving the exact same results
+    const QuaternionLanes<LanesT> res {
+      lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z,
+      lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y,
+      lhs.w * rhs.y - lhs.x * rhs.z + lhs.y * rhs.w + lhs.z * rhs.x,
+      lhs.w * rhs.z + lhs.x * rhs.y - lhs.y * rhs.x + lhs.z * rhs.w
+    };
+    res.store(result, index);
+  });
+}
+
+void QuaternionBatch::nlerp(const QuaternionBatch& quats, float coeff, QuaternionBatch& result) const {
+  assert("Error: The interpolation coefficient must be between 0 & 1." && (coeff >= 0.f && coeff <= 1.f));
+  nlerpQuaternions(*this, quats, InterpolationCoeffs{ nullptr, coeff }, result);
+}
+
+void QuaternionBatch::nlerp(const QuaternionBatch& quats, const std::vector<float>& coeffs, QuaternionBatch& result) const {
+  assert("Error: There must be as many interpolation coefficients as quaternions." && coeffs.size() == getCount());
+  nlerpQuaternions(*this, quats, InterpolationCoeffs{ coeffs.data(), 0.f }, result);
+}
+
+void QuaternionBatch::slerp(const QuaternionBatch& quats, float coeff, QuaternionBatch& result, SlerpMode mode) const {
+  assert("Error: The interpolation coefficient must be between 0 & 1." && (coeff >= 0.f && coeff <= 1.f));
+  slerpQuaternions(*this, quats, InterpolationCoeffs{ nullptr, coeff }, result, mode);
+}
+
+void QuaternionBatch::slerp(const QuaternionBatch& quats, const std::vector<float>& coeffs, QuaternionBatch& result, SlerpMode mode) const {
+  assert("Error: There must be as many interpolation coefficients as quaternions." && coeffs.size() == getCount());
+  slerpQuaternions(*this, quats, InterpolationCoeffs{ coeffs.data(), 0.f }, result, mode);
+}
+
+void QuaternionBatch::computeRotationMatrices(std::vector<Mat4f>& matrices) const {
+  matrices.resize(getCount());
+
+  processBatch(w, [this, &matrices] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+
+    const std::array<LanesT, 9> rotationLanes = computeRotationLanes(LanesT::load(w.data() + index), LanesT::load(x.data() + index),
+                                                                     LanesT::load(y.data() + index), LanesT::load(z.data() + index));
+    storeMatrices(rotationLanes, index, matrices.data());
+  });
+}
+
+void TransformBatch::resize(std::size_t count) {
+  positionX.resize(count, 0.f);
+  positionY.resize(count, 0.f);
+  positionZ.resize(count, 0.f);
+  rotationW.resize(count, 1.f);
+  rotationX.resize(count, 0.f);
+  rotationY.resize(count, 0.f);
+  rotationZ.resize(count, 0.f);
+  scaleX.resize(count, 1.f);
+  scaleY.resize(count, 1.f);
+  scaleZ.resize(count, 1.f);
+}
+
+void TransformBatch::setTransform(std::size_t index, const Vec3f& position, const Quaternionf& rotation, const Vec3f& scale) {
+  assert("Error: The transform index is out of bounds." && index < getCount());
+
+  positionX[index] = position.x();
+  positionY[index] = position.y();
+  positionZ[index] = position.z();
+  rotationW[index] = rotation.w();
+  rotationX[index] = rotation.x();
+  rotationY[index] = rotation.y();
+  rotationZ[index] = rotation.z();
+  scaleX[index]    = scale.x();
+  scaleY[index]    = scale.y();
+  scaleZ[index]    = scale.z();
+}
+
+void TransformBatch::setTransform(std::size_t index, const Transform& transform) {
+  setTransform(index, transform.getPosition(), transform.getRotation(), transform.getScale());
+}
+
+void TransformBatch::computeTransformMatrices(Mat4f* matrices) const {
+  processBatch(positionX, [this, matrices] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+
+    const std::array<LanesT, 9> linearLanes = computeLinearLanes<LanesT>(*this, index);
+    storeMatrices(linearLanes, index, matrices, positionX.data(), positionY.data(), positionZ.data());
+  });
+}
+
+void TransformBatch::computeTransformMatrices(std::vector<Mat4f>& matrices) const {
+  matrices.resize(getCount());
+  computeTransformMatrices(matrices.data());
+}
+
+void TransformBatch::transformBoxes(const BoxBatch& localBoxes, BoxBatch& worldBoxes) const {
+  assert("Error: There must be as many boxes as transforms." && localBoxes.getCount() == getCount());
+
+  worldBoxes.resize(getCount());
+
+  processBatch(positionX, [this, &localBoxes, &worldBoxes] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+
+    const std::array<LanesT, 9> linear = computeLinearLanes<LanesT>(*this, index);
+
+    const std::array<LanesT, 3> localMin = { LanesT::load(localBoxes.minX.data() + index),
+                                             LanesT::load(localBoxes.minY.data() + index),
+                                             LanesT::load(localBoxes.minZ.data() + index) };
+    const std::array<LanesT, 3> localMax = { LanesT::load(localBoxes.maxX.data() + index),
+                                             LanesT::load(localBoxes.maxY.data() + index),
+                                             LanesT::load(localBoxes.maxZ.data() + index) };
+
+    // Starting from the translation, each world axis gets the smallest & largest contributions of every local axis
+    std::array<LanesT, 3> worldMin = { LanesT::load(positionX.data() + index),
+                                       LanesT::load(positionY.data() + index),
+                                       LanesT::load(positionZ.data() + index) };
+    std::array<LanesT, 3> worldMax = worldMin;
+
+    for (std::size_t worldAxis = 0; worldAxis < 3; ++worldAxis) {
+      for (std::size_t localAxis = 0; localAxis < 3; ++localAxis) {
+        const LanesT minContribution = linear[localAxis * 3 + worldAxis] * localMin[localAxis];
+        const LanesT maxContribution = linear[localAxis * 3 + worldAxis] * localMax[localAxis];
+
+        worldMin[worldAxis] = worldMin[worldAxis] + LanesT::min(minContribution, maxContribution);
+        worldMax[worldAxis] = worldMax[worldAxis] + LanesT::max(minContribution, maxContribution);
+      }
+    }
+
+    worldMin[0].store(worldBoxes.minX.data() + index);
+    worldMin[1].store(worldBoxes.minY.data() + index);
+    worldMin[2].store(worldBoxes.minZ.data() + index);
+    worldMax[0].store(worldBoxes.maxX.data() + index);
+    worldMax[1].store(worldBoxes.maxY.data() + index);
+    worldMax[2].store(worldBoxes.maxZ.data() + index);
+  });
+}
+
+void TransformBatch::transformSpheres(const SphereBatch& localSpheres, SphereBatch& worldSpheres) const {
+  assert("Error: There must be as many spheres as transforms." && localSpheres.getCount() == getCount());
+
+  worldSpheres.resize(getCount());
+
+  processBatch(positionX, [this, &localSpheres, &worldSpheres] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+
+    const std::array<LanesT, 9> linear = computeLinearLanes<LanesT>(*this, index);
+
+    const LanesT centerX = LanesT::load(localSpheres.centerX.data() + index);
+    const LanesT centerY = LanesT::load(localSpheres.centerY.data() + index);
+    const LanesT centerZ = LanesT::load(localSpheres.centerZ.data() + index);
+
+    (centerX * linear[0] + centerY * linear[3] + centerZ * linear[6] + LanesT::load(positionX.data() + index)).store(worldSpheres.centerX.data() + index);
+    (centerX * linear[1] + centerY * linear[4] + centerZ * linear[7] + LanesT::load(positionY.data() + index)).store(worldSpheres.centerY.data() + index);
+    (centerX * linear[2] + centerY * linear[5] + centerZ * linear[8] + LanesT::load(positionZ.data() + index)).store(worldSpheres.centerZ.data() + index);
+
+    // Each row of the linear part holds a scaled rotation axis; the largest stretch is given by the longest row
+    const LanesT firstRowSqLength  = linear[0] * linear[0] + linear[1] * linear[1] + linear[2] * linear[2];
+    const LanesT secondRowSqLength = linear[3] * linear[3] + linear[4] * linear[4] + linear[5] * linear[5];
+    const LanesT thirdRowSqLength  = linear[6] * linear[6] + linear[7] * linear[7] + linear[8] * linear[8];
+    const LanesT maxSqLength       = LanesT::max(LanesT::max(firstRowSqLength, secondRowSqLength), thirdRowSqLength);
+
+    (LanesT::load(localSpheres.radius.data() + index) * LanesT::sqrt(maxSqLength)).store(worldSpheres.radius.data() + index);
+  });
+}
+
+} // namespace Raz
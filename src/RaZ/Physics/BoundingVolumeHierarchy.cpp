@@ -0,0 +1,348 @@
+#include "RaZ/Physics/BoundingVolumeHierarchy.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <istream>
+#include <numeric>
+#include <ostream>
+
+namespace Raz {
+
+namespace {
+
+constexpr std::array<char, 4> bvhMagic = { 'R', 'B', 'V', 'H' };
+constexpr uint32_t bvhVersion = 1;
+
+constexpr std::size_t binCount            = 16; ///< Number of bins in which the primitives' centroids are distributed on each axis.
+constexpr uint32_t maxLeafPrimitiveCount  = 8; ///< Number of primitives from which a leaf is always split.
+constexpr uint32_t parallelBuildThreshold = 8192; ///< Minimal number of primitives in a node to build its children in parallel.
+
+struct BuildPrimitive {
+  Vec3f minPos {};
+  Vec3f maxPos {};
+  Vec3f centroid {};
+};
+
+struct Bounds {
+  void extend(const Vec3f& point) noexcept {
+    for (std::size_t i = 0; i < 3; ++i) {
+      minPos[i] = std::min(minPos[i], point[i]);
+      maxPos[i] = std::max(maxPos[i], point[i]);
+    }
+  }
+
+  void extend(const Vec3f& otherMinPos, const Vec3f& otherMaxPos) noexcept {
+    extend(otherMinPos);
+    extend(otherMaxPos);
+  }
+
+  float computeHalfArea() const noexcept {
+    const Vec3f extent = maxPos - minPos;
+    return (extent[0] < 0.f ? 0.f : extent[0] * extent[1] + extent[1] * extent[2] + extent[2] * extent[0]);
+  }
+
+  Vec3f minPos = Vec3f(std::numeric_limits<float>::max());
+  Vec3f maxPos = Vec3f(std::numeric_limits<float>::lowest());
+};
+
+struct Bin {
+  Bounds bounds {};
+  uint32_t primitiveCount = 0;
+};
+
+class BvhBuilder {
+public:
+  BvhBuilder(std::vector<BvhNode>& nodes, std::vector<uint32_t>& primitiveIndices, std::vector<BuildPrimitive> primitives)
+    : m_nodes{ nodes }, m_primitiveIndices{ primitiveIndices }, m_primitives{ std::move(primitives) } {}
+
+  void build() {
+    m_nodes.resize(m_primitives.size() * 2 - 1);
+
+#if defined(RAZ_THREADS_AVAILABLE)
+    // Only the first levels are built in parallel; a few more tasks than available threads are launched to balance uneven splits
+    const unsigned int threadCount = Threading::getSystemThreadCount();
+    while ((1u << m_maxParallelDepth) < threadCount * 2)
+      ++m_maxParallelDepth;
+#endif
+
+    buildNode(0, 0, static_cast<uint32_t>(m_primitives.size()), 0);
+
+    m_nodes.resize(m_nodeCount);
+    m_nodes.shrink_to_fit();
+  }
+
+private:
+  void makeLeaf(BvhNode& node, uint32_t beginIndex, uint32_t endIndex) {
+    node.index          = beginIndex;
+    node.primitiveCount = endIndex - beginIndex;
+  }
+
+  void buildNode(uint32_t nodeIndex, uint32_t beginIndex, uint32_t endIndex, std::size_t depth) {
+    BvhNode& node = m_nodes[nodeIndex];
+
+    Bounds nodeBounds;
+    Bounds centroidBounds;
+
+    for (uint32_t i = beginIndex; i < endIndex; ++i) {
+      const BuildPrimitive& primitive = m_primitives[m_primitiveIndices[i]];
+      nodeBounds.extend(primitive.minPos, primitive.maxPos);
+      centroidBounds.extend(primitive.centroid);
+    }
+
+    node.minPos = nodeBounds.minPos;
+    node.maxPos = nodeBounds.maxPos;
+
+    const uint32_t primCount = endIndex - beginIndex;
+
+    if (primCount == 1 || depth >= BvhDetails::MaxDepth - 2) {
+      makeLeaf(node, beginIndex, endIndex);
+      return;
+    }
+
+    // Finding the best split among all bin boundaries on each axis, according to the surface area heuristic
+
+    std::size_t bestAxis     = 0;
+    std::size_t bestBinIndex = 0;
+    float bestCost           = std::numeric_limits<float>::max();
+
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      const float axisMin    = centroidBounds.minPos[axis];
+      const float axisExtent = centroidBounds.maxPos[axis] - axisMin;
+
+      if (axisExtent <= 0.f)
+        continue;
+
+      const float binFactor = static_cast<float>(binCount) / axisExtent;
+      std::array<Bin, binCount> bins {};
+
+      for (uint32_t i = beginIndex; i < endIndex; ++i) {
+        const BuildPrimitive& primitive = m_primitives[m_primitiveIndices[i]];
+        const std::size_t binIndex      = computeBinIndex(primitive.centroid[axis], axisMin, binFactor);
+
+        bins[binIndex].bounds.extend(primitive.minPos, primitive.maxPos);
+        ++bins[binIndex].primitiveCount;
+      }
+
+      // The costs on the right side of each boundary are accumulated from the right-most bin
+      std::array<float, binCount - 1> rightCosts {};
+      Bounds rightBounds;
+      uint32_t rightCount = 0;
+
+      for (std::size_t binIndex = binCount - 1; binIndex > 0; --binIndex) {
+        rightBounds.extend(bins[binIndex].bounds.minPos, bins[binIndex].bounds.maxPos);
+        rightCount += bins[binIndex].primitiveCount;
+        rightCosts[binIndex - 1] = rightBounds.computeHalfArea() * static_cast<float>(rightCount);
+      }
+
+      Bounds leftBounds;
+      uint32_t leftCount = 0;
+
+      for (std::size_t binIndex = 0; binIndex < binCount - 1; ++binIndex) {
+        leftBounds.extend(bins[binIndex].bounds.minPos, bins[binIndex].bounds.maxPos);
+        leftCount += bins[binIndex].primitiveCount;
+
+        if (leftCount == 0 || leftCount == primCount)
+          continue;
+
+        const float cost = leftBounds.computeHalfArea() * static_cast<float>(leftCount) + rightCosts[binIndex];
+
+        if (cost < bestCost) {
+          bestCost     = cost;
+          bestAxis     = axis;
+          bestBinIndex = binIndex;
+        }
+      }
+    }
+
+    uint32_t middleIndex = beginIndex;
+
+    if (bestCost == std::numeric_limits<float>::max()) {
+      // All centroids are at the same position; the primitives can't be spatially separated
+      if (primCount <= maxLeafPrimitiveCount) {
+        makeLeaf(node, beginIndex, endIndex);
+        return;
+      }
+
+      middleIndex = beginIndex + primCount / 2;
+    } else {
+      // A leaf is kept if splitting isn't worth it, which is when the cost of traversing the children exceeds that of testing all primitives
+      // The traversal of a node is arbitrarily considered as costly as a primitive test
+      const float leafCost = nodeBounds.computeHalfArea() * static_cast<float>(primCount);
+
+      if (primCount <= maxLeafPrimitiveCount && bestCost + nodeBounds.computeHalfArea() >= leafCost) {
+        makeLeaf(node, beginIndex, endIndex);
+        return;
+      }
+
+      const float axisMin   = centroidBounds.minPos[bestAxis];
+      const float binFactor = static_cast<float>(binCount) / (centroidBounds.maxPos[bestAxis] - axisMin);
+
+      const auto middleIter = std::partition(m_primitiveIndices.begin() + beginIndex, m_primitiveIndices.begin() + endIndex, [&] (uint32_t primIndex) {
+        return (computeBinIndex(m_primitives[primIndex].centroid[bestAxis], axisMin, binFactor) <= bestBinIndex);
+      });
+      middleIndex = static_cast<uint32_t>(middleIter - m_primitiveIndices.begin());
+    }
+
+    const uint32_t childIndex = m_nodeCount.fetch_add(2);
+
+    node.index          = childIndex;
+    node.primitiveCount = 0;
+
+#if defined(RAZ_THREADS_AVAILABLE)
+    if (depth < m_maxParallelDepth && primCount >= parallelBuildThreshold) {
+      std::future<void> leftBuild = Threading::launchAsync([this, childIndex, beginIndex, middleIndex, depth] () {
+        buildNode(childIndex, beginIndex, middleIndex, depth + 1);
+      });
+      buildNode(childIndex + 1, middleIndex, endIndex, depth + 1);
+      leftBuild.get();
+
+      return;
+    }
+#endif
+
+    buildNode(childIndex, beginIndex, middleIndex, depth + 1);
+    buildNode(childIndex + 1, middleIndex, endIndex, depth + 1);
+  }
+
+  static std::size_t computeBinIndex(float centroidCoord, float axisMin, float binFactor) noexcept {
+    return std::min(static_cast<std::size_t>((centroidCoord - axisMin) * binFactor), binCount - 1);
+  }
+
+  std::vector<BvhNode>& m_nodes;
+  std::vector<uint32_t>& m_primitiveIndices;
+  std::vector<BuildPrimitive> m_primitives {};
+  std::atomic<uint32_t> m_nodeCount = 1;
+  std::size_t m_maxParallelDepth = 0;
+};
+
+/// Checks that nodes & primitive indices read from a stream form a proper tree, so that traversing it never reads out of bounds.
+/// \param nodes Nodes to be checked.
+/// \param primitiveIndices Primitive indices referenced by the leaves.
+/// \return True if the hierarchy is valid, false otherwise.
+bool isValid(const std::vector<BvhNode>& nodes, const std::vector<uint32_t>& primitiveIndices) {
+  const std::size_t primCount = primitiveIndices.size();
+
+  if (std::any_of(primitiveIndices.cbegin(), primitiveIndices.cend(), [primCount] (uint32_t primIndex) { return (primIndex >= primCount); }))
+    return false;
+
+  if (nodes.empty())
+    return true;
+
+  // Every node must be reached exactly once from the root, within the depth allowed by the traversal stacks
+  std::vector<bool> visitedNodes(nodes.size(), false);
+  std::vector<std::pair<uint32_t, std::size_t>> nodeStack;
+  nodeStack.emplace_back(0, 0);
+  std::size_t visitedCount = 0;
+
+  while (!nodeStack.empty()) {
+    const auto [nodeIndex, depth] = nodeStack.back();
+    nodeStack.pop_back();
+
+    if (visitedNodes[nodeIndex] || depth >= BvhDetails::MaxDepth - 1)
+      return false;
+
+    visitedNodes[nodeIndex] = true;
+    ++visitedCount;
+
+    const BvhNode& node = nodes[nodeIndex];
+
+    if (node.isLeaf()) {
+      if (static_cast<std::size_t>(node.index) + node.primitiveCount > primCount)
+        return false;
+
+      continue;
+    }
+
+    if (static_cast<std::size_t>(node.index) + 1 >= nodes.size())
+      return false;
+
+    nodeStack.emplace_back(node.index, depth + 1);
+    nodeStack.emplace_back(node.index + 1, depth + 1);
+  }
+
+  return (visitedCount == nodes.size());
+}
+
+} // namespace
+
+void BoundingVolumeHierarchy::build(const std::vector<AABB>& primitiveBoxes) {
+  m_nodes.clear();
+  m_primitiveIndices.resize(primitiveBoxes.size());
+  std::iota(m_primitiveIndices.begin(), m_primitiveIndices.end(), 0);
+
+  if (primitiveBoxes.empty())
+    return;
+
+  std::vector<BuildPrimitive> primitives(primitiveBoxes.size());
+
+  for (std::size_t primIndex = 0; primIndex < primitiveBoxes.size(); ++primIndex) {
+    const AABB& box = primitiveBoxes[primIndex];
+    primitives[primIndex] = BuildPrimitive{ box.getLeftBottomBackPos(), box.getRightTopFrontPos(), box.computeCentroid() };
+  }
+
+  BvhBuilder(m_nodes, m_primitiveIndices, std::move(primitives)).build();
+}
+
+AABB BoundingVolumeHierarchy::computeBoundingBox() const {
+  if (m_nodes.empty())
+    return AABB(Vec3f(0.f), Vec3f(0.f));
+
+  return AABB(m_nodes.front().minPos, m_nodes.front().maxPos);
+}
+
+void BoundingVolumeHierarchy::save(std::ostream& stream) const {
+  const auto nodeCount = static_cast<uint32_t>(m_nodes.size());
+  const auto primCount = static_cast<uint32_t>(m_primitiveIndices.size());
+
+  stream.write(bvhMagic.data(), bvhMagic.size());
+  stream.write(reinterpret_cast<const char*>(&bvhVersion), sizeof(bvhVersion));
+  stream.write(reinterpret_cast<const char*>(&nodeCount), sizeof(nodeCount));
+  stream.write(reinterpret_cast<const char*>(&primCount), sizeof(primCount));
+  stream.write(reinterpret_cast<const char*>(m_nodes.data()), static_cast<std::streamsize>(sizeof(BvhNode) * nodeCount));
+  stream.write(reinterpret_cast<const char*>(m_primitiveIndices.data()), static_cast<std::streamsize>(sizeof(uint32_t) * primCount));
+}
+
+bool BoundingVolumeHierarchy::load(std::istream& stream) {
+  std::array<char, 4> magic {};
+  uint32_t version   = 0;
+  uint32_t nodeCount = 0;
+  uint32_t primCount = 0;
+
+  stream.read(magic.data(), magic.size());
+  stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+  stream.read(reinterpret_cast<char*>(&nodeCount), sizeof(nodeCount));
+  stream.read(reinterpret_cast<char*>(&primCount), sizeof(primCount));
+
+  // A hierarchy holding N primitives has between 1 & 2N - 1 nodes, & none if it is empty
+  if (!stream || magic != bvhMagic || version != bvhVersion
+      || (primCount == 0 && nodeCount != 0) || (primCount > 0 && (nodeCount == 0 || nodeCount >= static_cast<uint64_t>(primCount) * 2)))
+    return false;
+
+  // The counts are checked against the data actually left in the stream before allocating anything, so that a corrupted file can't
+  //  request a huge allocation
+  const std::istream::pos_type dataPos = stream.tellg();
+  stream.seekg(0, std::ios_base::end);
+  const std::istream::pos_type endPos = stream.tellg();
+  stream.seekg(dataPos);
+
+  if (!stream || dataPos == std::istream::pos_type(-1) || endPos == std::istream::pos_type(-1)
+      || static_cast<uint64_t>(endPos - dataPos) < sizeof(BvhNode) * static_cast<uint64_t>(nodeCount) + sizeof(uint32_t) * static_cast<uint64_t>(primCount))
+    return false;
+
+  std::vector<BvhNode> nodes(nodeCount);
+  std::vector<uint32_t> primIndices(primCount);
+
+  stream.read(reinterpret_cast<char*>(nodes.data()), static_cast<std::streamsize>(sizeof(BvhNode) * nodeCount));
+  stream.read(reinterpret_cast<char*>(primIndices.data()), static_cast<std::streamsize>(sizeof(uint32_t) * primCount));
+
+  if (!stream || !isValid(nodes, primIndices))
+    return false;
+
+  m_nodes            = std::move(nodes);
+  m_primitiveIndices = std::move(primIndices);
+
+  return true;
+}
+
+} // namespace Raz
@@ -1,105 +1,114 @@
 #include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/ShapeCast.hpp"
 
-namespace Raz {
-
-void Collider::setShape(Shape&& shape) {
-  m_shapeType = shape.getType();
+#include <array>
 
-  switch (m_shapeType) {
-    case ShapeType::LINE:
-      m_colliderShape = std::make_unique<Line>(static_cast<Line&&>(shape));
-      break;
+namespace Raz {
 
-    case ShapeType::PLANE:
-      m_colliderShape = std::make_unique<Plane>(static_cast<Plane&&>(shape));
-      break;
+namespace {
 
-    case ShapeType::SPHERE:
-      m_colliderShape = std::make_unique<Sphere>(static_cast<Sphere&&>(shape));
-      break;
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(ShapeType::LINE), ColliderShape>, Line>);
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(ShapeType::PLANE), ColliderShape>, Plane>);
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(ShapeType::SPHERE), ColliderShape>, Sphere>);
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(ShapeType::TRIANGLE), ColliderShape>, Triangle>);
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(ShapeType::QUAD), ColliderShape>, Quad>);
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(ShapeType::AABB), ColliderShape>, AABB>);
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(ShapeType::OBB), ColliderShape>, OBB>);
 
-    case ShapeType::TRIANGLE:
-      m_colliderShape = std::make_unique<Triangle>(static_cast<Triangle&&>(shape));
-      break;
+constexpr std::size_t ColliderShapeCount = std::variant_size_v<ColliderShape>;
 
-    case ShapeType::QUAD:
-      m_colliderShape = std::make_unique<Quad>(static_cast<Quad&&>(shape));
-      break;
+using ShapeIntersectionFunc = bool (*)(const ColliderShape&, const ColliderShape&);
+using ShapeIntersectionTable = std::array<std::array<ShapeIntersectionFunc, ColliderShapeCount>, ColliderShapeCount>;
 
-    case ShapeType::AABB:
-      m_colliderShape = std::make_unique<AABB>(static_cast<AABB&&>(shape));
-      break;
+template <std::size_t FirstIndex, std::size_t SecondIndex>
+bool intersectShapes(const ColliderShape& firstShape, const ColliderShape& secondShape) {
+  // Both types being final, the intersects() call is resolved statically
+  return std::get_if<FirstIndex>(&firstShape)->intersects(*std::get_if<SecondIndex>(&secondShape));
+}
 
-    case ShapeType::OBB:
-      m_colliderShape = std::make_unique<OBB>(static_cast<OBB&&>(shape));
-      break;
+template <std::size_t FirstIndex, std::size_t... SecondIndices>
+constexpr std::array<ShapeIntersectionFunc, ColliderShapeCount> makeIntersectionRow(std::index_sequence<SecondIndices...>) {
+  return { &intersectShapes<FirstIndex, SecondIndices>... };
+}
 
-    default:
-      throw std::invalid_argument("Error: Unhandled shape type in the collider shape setter");
-  }
+template <std::size_t... FirstIndices>
+constexpr ShapeIntersectionTable makeIntersectionTable(std::index_sequence<FirstIndices...>) {
+  return { makeIntersectionRow<FirstIndices>(std::make_index_sequence<ColliderShapeCount>())... };
 }
 
-bool Collider::intersects(const Shape& shape) const {
-  switch (m_shapeType) {
+constexpr ShapeIntersectionTable shapeIntersectionTable = makeIntersectionTable(std::make_index_sequence<ColliderShapeCount>());
+
+ColliderShape createColliderShape(Shape&& shape) {
+  switch (shape.getType()) {
     case ShapeType::LINE:
-      return shape.intersects(static_cast<const Line&>(*m_colliderShape));
+      return static_cast<Line&&>(shape);
 
     case ShapeType::PLANE:
-      return shape.intersects(static_cast<const Plane&>(*m_colliderShape));
+      return static_cast<Plane&&>(shape);
 
     case ShapeType::SPHERE:
-      return shape.intersects(static_cast<const Sphere&>(*m_colliderShape));
+      return static_cast<Sphere&&>(shape);
 
     case ShapeType::TRIANGLE:
-      return shape.intersects(static_cast<const Triangle&>(*m_colliderShape));
+      return static_cast<Triangle&&>(shape);
 
     case ShapeType::QUAD:
-      return shape.intersects(static_cast<const Quad&>(*m_colliderShape));
+      return static_cast<Quad&&>(shape);
 
     case ShapeType::AABB:
-      return shape.intersects(static_cast<const AABB&>(*m_colliderShape));
+      return static_cast<AABB&&>(shape);
 
     case ShapeType::OBB:
-      return shape.intersects(static_cast<const OBB&>(*m_colliderShape));
+      return static_cast<OBB&&>(shape);
 
     default:
       break;
   }
 
-  throw std::invalid_argument("Error: Unhandled shape type in the collider/shape intersection check");
+  throw std::invalid_argument("Error: Unhandled shape type in the collider shape setter");
 }
 
-bool Collider::intersects(const Ray& ray, RayHit* hit) const {
-  switch (m_shapeType) {
-    case ShapeType::LINE:
-      //return ray.intersects(static_cast<const Line&>(*m_colliderShape), hit);
-      break;
+} // namespace
 
-    case ShapeType::PLANE:
-      return ray.intersects(static_cast<const Plane&>(*m_colliderShape), hit);
+Collider::Collider(Shape&& shape) : m_shape{ createColliderShape(std::move(shape)) } {}
 
-    case ShapeType::SPHERE:
-      return ray.intersects(static_cast<const Sphere&>(*m_colliderShape), hit);
+void Collider::setShape(Shape&& shape) {
+  m_shape = createColliderShape(std::move(shape));
+}
 
-    case ShapeType::TRIANGLE:
-      return ray.intersects(static_cast<const Triangle&>(*m_colliderShape), hit);
+bool Collider::intersects(const Collider& collider) const {
+  return shapeIntersectionTable[collider.m_shape.index()][m_shape.index()](collider.m_shape, m_shape);
+}
 
-    case ShapeType::QUAD:
-      //return ray.intersects(static_cast<const Quad&>(*m_colliderShape), hit);
-      break;
+bool Collider::intersects(const Shape& shape) const {
+  return std::visit([&shape] (const auto& colliderShape) { return shape.intersects(colliderShape); }, m_shape);
+}
 
-    case ShapeType::AABB:
-      return ray.intersects(static_cast<const AABB&>(*m_colliderShape), hit);
+bool Collider::intersects(const Ray& ray, RayHit* hit) const {
+  return std::visit([&ray, hit] (const auto& colliderShape) -> bool {
+    using ShapeT = std::decay_t<decltype(colliderShape)>;
+
+    if constexpr (std::is_same_v<ShapeT, Line>)
+      throw std::invalid_argument("Error: Unhandled shape type in the collider/ray intersection check");
+    else
+      return ray.intersects(colliderShape, hit);
+  }, m_shape);
+}
 
-    case ShapeType::OBB:
-      //return ray.intersects(static_cast<const OBB&>(*m_colliderShape), hit);
-      break;
+AABB Collider::computeBoundingBox() const {
+  return std::visit([] (const auto& colliderShape) noexcept { return colliderShape.computeBoundingBox(); }, m_shape);
+}
 
-    default:
-      break;
-  }
+bool Collider::sphereCast(const Ray& ray, float radius, RayHit* hit, float maxDistance) const {
+  return std::visit([&ray, radius, hit, maxDistance] (const auto& colliderShape) {
+    return ShapeCast::sphereCast(ray, radius, colliderShape, hit, maxDistance);
+  }, m_shape);
+}
 
-  throw std::invalid_argument("Error: Unhandled shape type in the collider/ray intersection check");
+bool Collider::boxCast(const Ray& ray, const Vec3f& halfExtents, RayHit* hit, float maxDistance) const {
+  return std::visit([&ray, &halfExtents, hit, maxDistance] (const auto& colliderShape) {
+    return ShapeCast::boxCast(ray, halfExtents, colliderShape, hit, maxDistance);
+  }, m_shape);
 }
 
 } // namespace Raz
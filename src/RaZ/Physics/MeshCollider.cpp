@@ -0,0 +1,272 @@
+#include "RaZ/Physics/MeshCollider.hpp"
+#include "RaZ/Physics/ShapeCast.hpp"
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+
+#include <fstream>
+#include <iostream>
+
+namespace Raz {
+
+namespace {
+
+constexpr std::array<char, 4> cacheMagic = { 'R', 'M', 'C', 'C' };
+
+std::vector<Vec3f> recoverTrianglePositions(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& triangleIndices) {
+  assert("Error: The number of triangle indices must be a multiple of 3." && triangleIndices.size() % 3 == 0);
+
+  std::vector<Vec3f> positions(triangleIndices.size());
+
+  for (std::size_t i = 0; i < triangleIndices.size(); ++i)
+    positions[i] = vertices[triangleIndices[i]].position;
+
+  return positions;
+}
+
+/// Computes a 64-bit FNV-1a hash of the given positions' binary representation.
+uint64_t computeHash(const std::vector<Vec3f>& positions) {
+  constexpr uint64_t fnvPrime = 1099511628211ull;
+  uint64_t hash = 14695981039346656037ull;
+
+  const auto* bytes = reinterpret_cast<const unsigned char*>(positions.data());
+
+  for (std::size_t byteIndex = 0; byteIndex < positions.size() * sizeof(Vec3f); ++byteIndex) {
+    hash ^= bytes[byteIndex];
+    hash *= fnvPrime;
+  }
+
+  return hash;
+}
+
+bool overlapsBox(const Vec3f& minPos1, const Vec3f& maxPos1, const Vec3f& minPos2, const Vec3f& maxPos2) noexcept {
+  return (minPos1[0] <= maxPos2[0] && maxPos1[0] >= minPos2[0]
+       && minPos1[1] <= maxPos2[1] && maxPos1[1] >= minPos2[1]
+       && minPos1[2] <= maxPos2[2] && maxPos1[2] >= minPos2[2]);
+}
+
+} // namespace
+
+MeshCollider::MeshCollider(const Mesh& mesh) {
+  for (const Submesh& submesh : mesh.getSubmeshes()) {
+    std::vector<Vec3f> positions = recoverTrianglePositions(submesh.getVertices(), submesh.getTriangleIndices());
+    m_trianglePositions.insert(m_trianglePositions.end(), positions.cbegin(), positions.cend());
+  }
+
+  initialize();
+}
+
+MeshCollider::MeshCollider(const Mesh& mesh, const FilePath& cacheFilePath) {
+  for (const Submesh& submesh : mesh.getSubmeshes()) {
+    std::vector<Vec3f> positions = recoverTrianglePositions(submesh.getVertices(), submesh.getTriangleIndices());
+    m_trianglePositions.insert(m_trianglePositions.end(), positions.cbegin(), positions.cend());
+  }
+
+  initialize(&cacheFilePath);
+}
+
+MeshCollider::MeshCollider(const Submesh& submesh) : MeshCollider(submesh.getVertices(), submesh.getTriangleIndices()) {}
+
+MeshCollider::MeshCollider(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& triangleIndices)
+  : m_trianglePositions{ recoverTrianglePositions(vertices, triangleIndices) } { initialize(); }
+
+Triangle MeshCollider::recoverTriangle(std::size_t triangleIndex) const {
+  assert("Error: The triangle index is out of bounds." && triangleIndex < getTriangleCount());
+
+  const std::size_t firstIndex = triangleIndex * 3;
+  return Triangle(m_trianglePositions[firstIndex], m_trianglePositions[firstIndex + 1], m_trianglePositions[firstIndex + 2]);
+}
+
+bool MeshCollider::intersects(const Ray& ray, RayHit* hit, float maxDistance) const {
+  std::size_t hitTriangleIndex = std::numeric_limits<std::size_t>::max();
+
+  m_hierarchy.raycast(ray, maxDistance, [this, &ray, &hitTriangleIndex, hit] (uint32_t triangleIndex, float& hitDistance) {
+    const std::size_t firstIndex = triangleIndex * 3;
+
+    if (!ray.intersectsTriangle(m_trianglePositions[firstIndex], m_trianglePositions[firstIndex + 1], m_trianglePositions[firstIndex + 2], hitDistance))
+      return false;
+
+    hitTriangleIndex = triangleIndex;
+
+    // If the hit's information is not needed, any hit is enough
+    return (hit == nullptr);
+  });
+
+  if (hitTriangleIndex == std::numeric_limits<std::size_t>::max())
+    return false;
+
+  if (hit) {
+    const std::size_t firstIndex = hitTriangleIndex * 3;
+    const Vec3f normal = (m_trianglePositions[firstIndex + 1] - m_trianglePositions[firstIndex])
+                         .cross(m_trianglePositions[firstIndex + 2] - m_trianglePositions[firstIndex]).normalize();
+
+    hit->position = ray.getOrigin() + ray.getDirection() * maxDistance;
+    hit->normal   = (normal.dot(ray.getDirection()) > 0.f ? -normal : normal); // The normal is always facing the ray, as with single triangles
+    hit->distance = maxDistance;
+  }
+
+  return true;
+}
+
+bool MeshCollider::sphereCast(const Ray& ray, float radius, RayHit* hit, float maxDistance) const {
+  RayHit closestHit;
+  bool isHit = false;
+
+  m_hierarchy.sphereCast(ray, radius, maxDistance, [this, &ray, radius, &closestHit, &isHit, hit] (uint32_t triangleIndex, float& hitDistance) {
+    RayHit triangleHit;
+
+    if (!ShapeCast::sphereCast(ray, radius, recoverTriangle(triangleIndex), &triangleHit, hitDistance))
+      return false;
+
+    hitDistance = triangleHit.distance;
+    closestHit  = triangleHit;
+    isHit       = true;
+
+    // If the hit's information is not needed, any hit is enough
+    return (hit == nullptr);
+  });
+
+  if (isHit && hit)
+    *hit = closestHit;
+
+  return isHit;
+}
+
+bool MeshCollider::boxCast(const Ray& ray, const Vec3f& halfExtents, RayHit* hit, float maxDistance) const {
+  RayHit closestHit;
+  bool isHit = false;
+
+  // The hierarchy's nodes are culled using the sphere enclosing the box; the triangles are then checked against the box itself
+  m_hierarchy.sphereCast(ray, halfExtents.computeLength(), maxDistance, [this, &ray, &halfExtents, &closestHit, &isHit, hit] (uint32_t triangleIndex,
+                                                                                                                             float& hitDistance) {
+    RayHit triangleHit;
+
+    if (!ShapeCast::boxCast(ray, halfExtents, recoverTriangle(triangleIndex), &triangleHit, hitDistance))
+      return false;
+
+    hitDistance = triangleHit.distance;
+    closestHit  = triangleHit;
+    isHit       = true;
+
+    return (hit == nullptr);
+  });
+
+  if (isHit && hit)
+    *hit = closestHit;
+
+  return isHit;
+}
+
+bool MeshCollider::intersects(const Sphere& sphere) const {
+  const Vec3f& center     = sphere.getCenter();
+  const float sqRadius    = sphere.getRadius() * sphere.getRadius();
+
+  return m_hierarchy.query([&center, sqRadius] (const Vec3f& minPos, const Vec3f& maxPos) {
+    return ((AABB(minPos, maxPos).computeProjection(center) - center).computeSquaredLength() <= sqRadius);
+  }, [this, &center, sqRadius] (uint32_t triangleIndex) {
+    return ((recoverTriangle(triangleIndex).computeProjection(center) - center).computeSquaredLength() <= sqRadius);
+  });
+}
+
+bool MeshCollider::intersects(const AABB& aabb) const {
+  const Vec3f& boxMinPos = aabb.getLeftBottomBackPos();
+  const Vec3f& boxMaxPos = aabb.getRightTopFrontPos();
+
+  return m_hierarchy.query([&boxMinPos, &boxMaxPos] (const Vec3f& minPos, const Vec3f& maxPos) {
+    return overlapsBox(minPos, maxPos, boxMinPos, boxMaxPos);
+  }, [this, &aabb] (uint32_t triangleIndex) {
+    return recoverTriangle(triangleIndex).intersects(aabb);
+  });
+}
+
+bool MeshCollider::intersects(const OBB& obb) const {
+  // The nodes are checked against the box's own axis-aligned bounding box
+  const AABB boundingBox = obb.computeBoundingBox();
+  const Vec3f& boxMinPos = boundingBox.getLeftBottomBackPos();
+  const Vec3f& boxMaxPos = boundingBox.getRightTopFrontPos();
+
+  return m_hierarchy.query([&boxMinPos, &boxMaxPos] (const Vec3f& minPos, const Vec3f& maxPos) {
+    return overlapsBox(minPos, maxPos, boxMinPos, boxMaxPos);
+  }, [this, &obb] (uint32_t triangleIndex) {
+    return recoverTriangle(triangleIndex).intersects(obb);
+  });
+}
+
+void MeshCollider::saveCache(const FilePath& cacheFilePath) const {
+  std::ofstream file(cacheFilePath, std::ios_base::out | std::ios_base::binary);
+
+  if (!file) {
+    std::cerr << "Error: Unable to create the mesh collider cache file '" + cacheFilePath + "'." << std::endl;
+    return;
+  }
+
+  const uint64_t positionCount = m_trianglePositions.size();
+
+  file.write(cacheMagic.data(), cacheMagic.size());
+  file.write(reinterpret_cast<const char*>(&m_sourceHash), sizeof(m_sourceHash));
+  file.write(reinterpret_cast<const char*>(&positionCount), sizeof(positionCount));
+  file.write(reinterpret_cast<const char*>(m_trianglePositions.data()), static_cast<std::streamsize>(sizeof(Vec3f) * m_trianglePositions.size()));
+
+  m_hierarchy.save(file);
+}
+
+bool MeshCollider::loadCache(const FilePath& cacheFilePath) {
+  std::ifstream file(cacheFilePath, std::ios_base::in | std::ios_base::binary);
+
+  if (!file)
+    return false;
+
+  std::array<char, 4> magic {};
+  uint64_t sourceHash    = 0;
+  uint64_t positionCount = 0;
+
+  file.read(magic.data(), magic.size());
+  file.read(reinterpret_cast<char*>(&sourceHash), sizeof(sourceHash));
+  file.read(reinterpret_cast<char*>(&positionCount), sizeof(positionCount));
+
+  if (!file || magic != cacheMagic || sourceHash != m_sourceHash || positionCount != m_trianglePositions.size())
+    return false;
+
+  std::vector<Vec3f> positions(positionCount);
+  file.read(reinterpret_cast<char*>(positions.data()), static_cast<std::streamsize>(sizeof(Vec3f) * positionCount));
+
+  BoundingVolumeHierarchy hierarchy;
+
+  if (!file || !hierarchy.load(file) || hierarchy.getPrimitiveCount() != positionCount / 3)
+    return false;
+
+  m_trianglePositions = std::move(positions);
+  m_hierarchy         = std::move(hierarchy);
+
+  return true;
+}
+
+void MeshCollider::initialize(const FilePath* cacheFilePath) {
+  m_sourceHash = computeHash(m_trianglePositions);
+
+  if (cacheFilePath && loadCache(*cacheFilePath))
+    return;
+
+  std::vector<AABB> triangleBoxes;
+  triangleBoxes.reserve(getTriangleCount());
+
+  for (std::size_t posIndex = 0; posIndex < m_trianglePositions.size(); posIndex += 3) {
+    const Vec3f& firstPos  = m_trianglePositions[posIndex];
+    const Vec3f& secondPos = m_trianglePositions[posIndex + 1];
+    const Vec3f& thirdPos  = m_trianglePositions[posIndex + 2];
+
+    triangleBoxes.emplace_back(Vec3f(std::min(firstPos[0], std::min(secondPos[0], thirdPos[0])),
+                                     std::min(firstPos[1], std::min(secondPos[1], thirdPos[1])),
+                                     std::min(firstPos[2], std::min(secondPos[2], thirdPos[2]))),
+                               Vec3f(std::max(firstPos[0], std::max(secondPos[0], thirdPos[0])),
+                                     std::max(firstPos[1], std::max(secondPos[1], thirdPos[1])),
+                                     std::max(firstPos[2], std::max(secondPos[2], thirdPos[2]))));
+  }
+
+  m_hierarchy.build(triangleBoxes);
+  m_hierarchy.reorderPrimitives(m_trianglePositions, 3);
+
+  if (cacheFilePath)
+    saveCache(*cacheFilePath);
+}
+
+} // namespace Raz
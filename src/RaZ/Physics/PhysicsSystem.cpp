@@ -1,12 +1,116 @@
 #include "RaZ/Math/Transform.hpp"
 #include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/MeshCollider.hpp"
 #include "RaZ/Physics/RigidBody.hpp"
 #include "RaZ/Physics/PhysicsSystem.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
 
 namespace Raz {
 
+namespace {
+
+constexpr std::size_t parallelBatchThreshold = 256; ///< Minimal number of rays in a batch for it to be processed in parallel.
+constexpr std::size_t maxSubstepCount        = 4; ///< Maximal number of impacts a fast-moving rigid body can go through in a single step.
+constexpr float contactOffset                = 0.002f; ///< Distance at which a rigid body is placed above the surface it has collided with.
+
+bool isBox(const SweptVolume& volume) noexcept {
+  return (volume.halfExtents[0] > 0.f || volume.halfExtents[1] > 0.f || volume.halfExtents[2] > 0.f);
+}
+
+/// Casts a volume along a ray against an entity's collider.
+/// \param entity Entity to be checked. Must have either a Collider or a MeshCollider component.
+/// \param ray Ray to be cast, in world space.
+/// \param volume Volume swept along the ray.
+/// \param layerMask Layers to be checked.
+/// \param maxDistance Maximum distance along the ray.
+/// \param hit Information of the hit, in world space.
+/// \return True if the entity's collider has been hit before the maximum distance, false otherwise.
+bool castAgainstEntity(const Entity& entity, const Ray& ray, const SweptVolume& volume, uint32_t layerMask, float maxDistance, RayHit& hit) {
+  if (!entity.isEnabled())
+    return false;
+
+  assert("Error: A collidable entity must have a Transform component." && entity.hasComponent<Transform>());
+
+  // The collision detection is made in the collider's local space; the ray must thus be translated into that space
+  const Vec3f& colliderPos = entity.getComponent<Transform>().getPosition();
+  const Ray localRay(ray.getOrigin() - colliderPos, ray.getDirection());
+
+  bool isHit = false;
+
+  if (entity.hasComponent<Collider>()) {
+    const auto& collider = entity.getComponent<Collider>();
+
+    if ((collider.getLayerMask() & layerMask) == 0)
+      return false;
+
+    if (isBox(volume)) {
+      isHit = collider.boxCast(localRay, volume.halfExtents, &hit, maxDistance);
+    } else if (volume.radius > 0.f) {
+      isHit = collider.sphereCast(localRay, volume.radius, &hit, maxDistance);
+    } else {
+      // A ray can't hit a line; a ray starting inside a box gives a negative distance, in which case the box is not considered hit
+      isHit = (collider.getShapeType() != ShapeType::LINE && collider.intersects(localRay, &hit) && hit.distance >= 0.f && hit.distance <= maxDistance);
+    }
+  } else {
+    const auto& meshCollider = entity.getComponent<MeshCollider>();
+
+    if ((meshCollider.getLayerMask() & layerMask) == 0)
+      return false;
+
+    if (isBox(volume))
+      isHit = meshCollider.boxCast(localRay, volume.halfExtents, &hit, maxDistance);
+    else if (volume.radius > 0.f)
+      isHit = meshCollider.sphereCast(localRay, volume.radius, &hit, maxDistance);
+    else
+      isHit = meshCollider.intersects(localRay, &hit, maxDistance);
+  }
+
+  if (isHit)
+    hit.position += colliderPos;
+
+  return isHit;
+}
+
+/// Recovers the volume swept by a rigid body's entity when moving, from its collider.
+/// Spheres are swept as such; any other bounded collider is swept as its bounding box. An entity without any, or with a plane, is swept as a point.
+/// \param entity Entity to recover the volume of.
+/// \param volumeOffset Offset of the volume's center from the entity's position.
+/// \return Volume swept by the entity.
+SweptVolume computeSweptVolume(const Entity& entity, Vec3f& volumeOffset) {
+  volumeOffset = Vec3f(0.f);
+
+  AABB boundingBox(Vec3f(0.f), Vec3f(0.f));
+
+  if (entity.hasComponent<Collider>()) {
+    const auto& collider = entity.getComponent<Collider>();
+
+    if (collider.getShapeType() == ShapeType::PLANE)
+      return SweptVolume{};
+
+    if (collider.getShapeType() == ShapeType::SPHERE) {
+      const auto& sphere = collider.getShape<Sphere>();
+      volumeOffset = sphere.getCenter();
+      return SweptVolume{ sphere.getRadius(), Vec3f(0.f) };
+    }
+
+    boundingBox = collider.computeBoundingBox();
+  } else if (entity.hasComponent<MeshCollider>()) {
+    boundingBox = entity.getComponent<MeshCollider>().computeBoundingBox();
+  } else {
+    return SweptVolume{};
+  }
+
+  volumeOffset = boundingBox.computeCentroid();
+  return SweptVolume{ 0.f, boundingBox.computeHalfExtents() };
+}
+
+} // namespace
+
 PhysicsSystem::PhysicsSystem() {
   m_acceptedComponents.setBit(Component::getId<Collider>());
+  m_acceptedComponents.setBit(Component::getId<MeshCollider>());
   m_acceptedComponents.setBit(Component::getId<RigidBody>());
 }
 
@@ -30,12 +134,118 @@ bool PhysicsSystem::step(float deltaTime) {
     transform.translate((oldVelocity + velocity) * 0.5f * deltaTime);
   }
 
-  solveConstraints();
+  solveConstraints(deltaTime);
+  m_isBroadphaseDirty = true;
 
   return true;
 }
 
-void PhysicsSystem::solveConstraints() {
+bool PhysicsSystem::raycast(const Ray& ray, RayHit* hit, const RaycastParams& params, Entity** hitEntity) {
+  if (m_isBroadphaseDirty)
+    updateBroadphase();
+
+  return castAlongRay(ray, SweptVolume{}, hit, params, hitEntity);
+}
+
+std::size_t PhysicsSystem::raycastBatch(const std::vector<Ray>& rays, std::vector<RayHit>& hits, const RaycastParams& params,
+                                        std::vector<Entity*>* hitEntities) {
+  if (m_isBroadphaseDirty)
+    updateBroadphase();
+
+  hits.resize(rays.size());
+
+  if (hitEntities)
+    hitEntities->resize(rays.size());
+
+  const auto castRays = [this, &rays, &hits, &params, hitEntities] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t rayIndex = beginIndex; rayIndex < endIndex; ++rayIndex) {
+      hits[rayIndex] = RayHit();
+      castAlongRay(rays[rayIndex], SweptVolume{}, &hits[rayIndex], params, (hitEntities ? &(*hitEntities)[rayIndex] : nullptr));
+    }
+  };
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (rays.size() >= parallelBatchThreshold) {
+    Threading::parallelize(rays, [&castRays] (Threading::IndexRange range) { castRays(range.beginIndex, range.endIndex); });
+  } else
+#endif
+  {
+    castRays(0, rays.size());
+  }
+
+  return static_cast<std::size_t>(std::count_if(hits.cbegin(), hits.cend(), [] (const RayHit& hit) {
+    return (hit.distance != std::numeric_limits<float>::max());
+  }));
+}
+
+bool PhysicsSystem::sphereCast(const Ray& ray, float radius, RayHit* hit, const RaycastParams& params, Entity** hitEntity) {
+  assert("Error: The radius of a sphere cast can't be negative." && radius >= 0.f);
+
+  if (m_isBroadphaseDirty)
+    updateBroadphase();
+
+  return castAlongRay(ray, SweptVolume{ radius, Vec3f(0.f) }, hit, params, hitEntity);
+}
+
+bool PhysicsSystem::boxCast(const Ray& ray, const Vec3f& halfExtents, RayHit* hit, const RaycastParams& params, Entity** hitEntity) {
+  assert("Error: The half extents of a box cast can't be negative." && (halfExtents[0] >= 0.f && halfExtents[1] >= 0.f && halfExtents[2] >= 0.f));
+
+  if (m_isBroadphaseDirty)
+    updateBroadphase();
+
+  return castAlongRay(ray, SweptVolume{ 0.f, halfExtents }, hit, params, hitEntity);
+}
+
+void PhysicsSystem::updateBroadphase() {
+  m_broadphaseEntities.clear();
+  m_unboundedEntities.clear();
+
+  std::vector<AABB> entityBoxes;
+
+  for (Entity* entity : m_entities) {
+    if (!entity->hasComponent<Transform>())
+      continue;
+
+    const Vec3f& entityPos = entity->getComponent<Transform>().getPosition();
+
+    if (entity->hasComponent<Collider>()) {
+      const auto& collider = entity->getComponent<Collider>();
+
+      if (collider.getShapeType() == ShapeType::PLANE) {
+        m_unboundedEntities.emplace_back(entity);
+        continue;
+      }
+
+      const AABB box = collider.computeBoundingBox();
+      entityBoxes.emplace_back(box.getLeftBottomBackPos() + entityPos, box.getRightTopFrontPos() + entityPos);
+    } else if (entity->hasComponent<MeshCollider>()) {
+      const AABB box = entity->getComponent<MeshCollider>().computeBoundingBox();
+      entityBoxes.emplace_back(box.getLeftBottomBackPos() + entityPos, box.getRightTopFrontPos() + entityPos);
+    } else {
+      continue;
+    }
+
+    m_broadphaseEntities.emplace_back(entity);
+  }
+
+  m_broadphase.build(entityBoxes);
+  m_isBroadphaseDirty = false;
+}
+
+void PhysicsSystem::linkEntity(const EntityPtr& entity) {
+  System::linkEntity(entity);
+  m_isBroadphaseDirty = true;
+}
+
+void PhysicsSystem::unlinkEntity(const EntityPtr& entity) {
+  System::unlinkEntity(entity);
+  m_isBroadphaseDirty = true;
+}
+
+void PhysicsSystem::solveConstraints(float deltaTime) {
+  // The bodies have been moved; their colliders must be found at their new position
+  updateBroadphase();
+
   for (Entity* entity : m_entities) {
     if (!entity->isEnabled() || !entity->hasComponent<RigidBody>())
       continue;
@@ -43,40 +253,39 @@ void PhysicsSystem::solveConstraints() {
     auto& rigidBody = entity->getComponent<RigidBody>();
     auto& transform = entity->getComponent<Transform>();
 
-    const Vec3f velocity    = rigidBody.getVelocity();
-    const Vec3f velocityDir = velocity.normalize();
-
-    for (Entity* collidableEntity : m_entities) {
-      if (collidableEntity == entity || !collidableEntity->isEnabled() || !collidableEntity->hasComponent<Collider>())
-        continue;
+    Vec3f movement             = transform.getPosition() - rigidBody.m_oldPosition;
+    const float movementLength = movement.computeLength();
 
-      assert("Error: A collidable entity must have a Transform component." && collidableEntity->hasComponent<Transform>());
+    Vec3f volumeOffset;
+    const SweptVolume volume = computeSweptVolume(*entity, volumeOffset);
+    const float minExtent    = (isBox(volume) ? std::min({ volume.halfExtents[0], volume.halfExtents[1], volume.halfExtents[2] }) : volume.radius);
 
-      auto& collider = collidableEntity->getComponent<Collider>();
+    // A body moving by more than a fraction of its extent may go through thin colliders or bounce off several of them within the same step
+    // It is then sub-stepped, keeping on moving after each impact; the others stop at the first one
+    rigidBody.m_isFastMoving = (movementLength > minExtent * m_continuousCollisionThreshold);
+    const std::size_t substepCount = (rigidBody.m_isFastMoving ? maxSubstepCount : 1);
 
-      // The collision detection is made in the collider's local space
-      // The test shapes/rays must thus be translated into that space
-      const Vec3f colliderPos   = collidableEntity->getComponent<Transform>().getPosition();
-      const Vec3f localStartPos = rigidBody.m_oldPosition - colliderPos;
+    Vec3f volumePos     = rigidBody.m_oldPosition + volumeOffset;
+    float remainingTime = deltaTime; // Time left in the step for the current movement to be travelled
+    bool isHit          = false;
 
-      // We first try to determine if the last movement gave an intersection
-      // This is necessary in case our object has travelled too fast right through the collider,
-      //  ending behind it
-      const Line movementLine(localStartPos, transform.getPosition() - colliderPos);
-      if (!collider.intersects(movementLine))
-        continue;
+    for (std::size_t substepIndex = 0; substepIndex < substepCount; ++substepIndex) {
+      const float substepLength = movement.computeLength();
 
-      const Ray ray(localStartPos, velocityDir);
+      if (substepLength <= 0.f)
+        break;
 
+      const Ray ray(volumePos, movement / substepLength);
       RayHit hit;
-      if (!collider.intersects(ray, &hit))
-        continue;
 
-      // Setting the entity's new position a little above the collision point
-      const Vec3f newPos = hit.position + hit.normal * 0.002f + colliderPos;
+      if (!castAlongRay(ray, volume, &hit, RaycastParams{ substepLength }, nullptr, entity)) {
+        volumePos += movement;
+        break;
+      }
 
-      rigidBody.m_oldPosition = newPos;
-      transform.setPosition(newPos);
+      // Setting the volume a little above the collision point
+      volumePos = ray.getOrigin() + ray.getDirection() * hit.distance + hit.normal * contactOffset;
+      isHit     = true;
 
       //                                     Vt/paraVec
       //  Vel  N  Refl                  \---->
@@ -84,14 +293,81 @@ void PhysicsSystem::solveConstraints() {
       //     \ | /        ->            |   \        Vt is the velocity's parallel component to the surface
       // _____v|/______      Vn/perpVec v    v Vel
 
-      const Vec3f paraVec = hit.normal * velocity.dot(hit.normal);
-      const Vec3f perpVec = velocity - paraVec;
+      const Vec3f velocity = rigidBody.getVelocity();
+      const Vec3f paraVec  = hit.normal * velocity.dot(hit.normal);
+      const Vec3f perpVec  = velocity - paraVec;
 
       rigidBody.setVelocity(perpVec - paraVec * rigidBody.getBounciness());
 
+      // The body keeps on moving with its new velocity for the rest of the step
+      remainingTime *= 1.f - hit.distance / substepLength;
+      movement       = rigidBody.getVelocity() * remainingTime;
+    }
+
+    if (!isHit)
+      continue;
+
+    const Vec3f newPos = volumePos - volumeOffset;
+
+    rigidBody.m_oldPosition = newPos;
+    transform.setPosition(newPos);
+  }
+}
+
+bool PhysicsSystem::castAlongRay(const Ray& ray, const SweptVolume& volume, RayHit* hit, const RaycastParams& params, Entity** hitEntity,
+                                 const Entity* movingEntity) const {
+  RayHit closestHit;
+  Entity* closestEntity = nullptr;
+  float maxDistance     = params.maxDistance;
+
+  const auto checkEntity = [&ray, &volume, &params, movingEntity, &closestHit, &closestEntity] (Entity* entity, float& maxDist) {
+    if (entity == movingEntity)
+      return false;
+
+    RayHit entityHit;
+
+    if (!castAgainstEntity(*entity, ray, volume, params.layerMask, maxDist, entityHit))
+      return false;
+
+    // A moving entity separating from a collider it already touches must not be stopped by it
+    if (movingEntity && entityHit.normal.dot(ray.getDirection()) >= 0.f)
+      return false;
+
+    maxDist       = entityHit.distance;
+    closestHit    = entityHit;
+    closestEntity = entity;
+
+    return (params.mode == RaycastMode::ANY);
+  };
+
+  bool isStopped = false;
+
+  for (Entity* entity : m_unboundedEntities) {
+    if (checkEntity(entity, maxDistance)) {
+      isStopped = true;
       break;
     }
   }
+
+  if (!isStopped) {
+    // The broadphase's nodes are culled using the sphere enclosing the swept volume
+    const float volumeRadius = (isBox(volume) ? volume.halfExtents.computeLength() : volume.radius);
+
+    m_broadphase.sphereCast(ray, volumeRadius, maxDistance, [this, &checkEntity] (uint32_t entityIndex, float& maxDist) {
+      return checkEntity(m_broadphaseEntities[entityIndex], maxDist);
+    });
+  }
+
+  if (hitEntity)
+    *hitEntity = closestEntity;
+
+  if (closestEntity == nullptr)
+    return false;
+
+  if (hit)
+    *hit = closestHit;
+
+  return true;
 }
 
 } // namespace Raz
@@ -0,0 +1,535 @@
+#include "RaZ/Physics/ShapeCast.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace Raz::ShapeCast {
+
+namespace {
+
+/// Finds the distance at which a point moving along a ray first gets within a given radius of a center, which amounts to a ray-sphere intersection check.
+/// \param ray Ray followed by the point.
+/// \param center Center to be reached.
+/// \param radius Distance from the center at which the point is considered touching it.
+/// \param maxDistance Maximum distance the point can travel.
+/// \param hitDistance Distance of the first contact, if any.
+/// \return True if the point gets within the radius before the maximum distance, false otherwise.
+bool castPointToSphere(const Ray& ray, const Vec3f& center, float radius, float maxDistance, float& hitDistance) noexcept {
+  const Vec3f centerDir  = ray.getOrigin() - center;
+  const float centerDiff = centerDir.computeSquaredLength() - radius * radius;
+
+  if (centerDiff <= 0.f) { // The point is already within reach
+    hitDistance = 0.f;
+    return true;
+  }
+
+  const float dirProj = centerDir.dot(ray.getDirection());
+
+  if (dirProj >= 0.f) // The point is moving away from the center
+    return false;
+
+  const float discriminant = dirProj * dirProj - centerDiff;
+
+  if (discriminant < 0.f)
+    return false;
+
+  const float dist = -dirProj - std::sqrt(discriminant);
+
+  if (dist > maxDistance)
+    return false;
+
+  hitDistance = dist;
+  return true;
+}
+
+/// Finds the distance at which a point moving along a ray first gets within a given radius of a segment, which amounts to a ray-capsule intersection check.
+/// \param ray Ray followed by the point.
+/// \param beginPos Segment's first extremity.
+/// \param endPos Segment's second extremity.
+/// \param radius Distance from the segment at which the point is considered touching it.
+/// \param maxDistance Maximum distance the point can travel.
+/// \param hitDistance Distance of the first contact, if any.
+/// \return True if the point gets within the radius before the maximum distance, false otherwise.
+bool castPointToCapsule(const Ray& ray, const Vec3f& beginPos, const Vec3f& endPos, float radius, float maxDistance, float& hitDistance) noexcept {
+  // See Real-Time Collision Detection (Christer Ericson), 5.3.7 - Intersecting Ray or Segment Against Cylinder
+
+  const Vec3f segment   = endPos - beginPos;
+  const Vec3f originDir = ray.getOrigin() - beginPos;
+
+  const float segSqLength = segment.computeSquaredLength();
+  const float segDirProj  = segment.dot(ray.getDirection());
+  const float segOrigProj = segment.dot(originDir);
+
+  bool isHit = false;
+
+  // Checking the cylinder's side; the extremities are handled by the spheres below
+  const float quadA = segSqLength - segDirProj * segDirProj;
+
+  if (quadA > std::numeric_limits<float>::epsilon() * segSqLength) {
+    const float quadB = segSqLength * originDir.dot(ray.getDirection()) - segDirProj * segOrigProj;
+    const float quadC = segSqLength * (originDir.computeSquaredLength() - radius * radius) - segOrigProj * segOrigProj;
+
+    const float discriminant = quadB * quadB - quadA * quadC;
+
+    if (discriminant >= 0.f) {
+      // If the origin is already inside the infinite cylinder, the contact is at a distance of 0, which is only valid if also within the segment's range
+      const float dist       = (quadC <= 0.f ? 0.f : (-quadB - std::sqrt(discriminant)) / quadA);
+      const float segmentPos = segOrigProj + dist * segDirProj; // Position of the contact along the segment, scaled by its squared length
+
+      if (dist >= 0.f && dist <= maxDistance && segmentPos >= 0.f && segmentPos <= segSqLength) {
+        hitDistance = dist;
+        maxDistance = dist;
+        isHit       = true;
+      }
+    }
+  }
+
+  float sphereDist {};
+
+  if (castPointToSphere(ray, beginPos, radius, maxDistance, sphereDist)) {
+    hitDistance = sphereDist;
+    maxDistance = sphereDist;
+    isHit       = true;
+  }
+
+  if (castPointToSphere(ray, endPos, radius, maxDistance, sphereDist)) {
+    hitDistance = sphereDist;
+    isHit       = true;
+  }
+
+  return isHit;
+}
+
+/// Fills the hit's information from the position at which the cast sphere's center stands & the closest point of the shape it touches.
+/// \param ray Ray followed by the sphere's center.
+/// \param hitDistance Distance of the contact along the ray.
+/// \param contactPos Point of the shape touched by the sphere.
+/// \param hit Hit to be filled.
+void fillHit(const Ray& ray, float hitDistance, const Vec3f& contactPos, RayHit& hit) {
+  const Vec3f centerPos     = ray.getOrigin() + ray.getDirection() * hitDistance;
+  const Vec3f contactDir    = centerPos - contactPos;
+  const float contactSqDist = contactDir.computeSquaredLength();
+
+  hit.position = contactPos;
+  // If the sphere's center is on the shape, there is no preferred direction; the normal is then taken as facing the ray
+  hit.normal   = (contactSqDist > 0.f ? contactDir / std::sqrt(contactSqDist) : -ray.getDirection());
+  hit.distance = hitDistance;
+}
+
+bool castSphereToAABB(const Ray& ray, float radius, const Vec3f& minPos, const Vec3f& maxPos, float maxDistance, float& hitDistance) {
+  const AABB box(minPos, maxPos);
+
+  if ((box.computeProjection(ray.getOrigin()) - ray.getOrigin()).computeSquaredLength() <= radius * radius) {
+    hitDistance = 0.f;
+    return true;
+  }
+
+  // The volume swept by the sphere touches the box when its center reaches the box enlarged by the radius, with rounded edges & corners
+  // A first check is made against the enlarged box; if the entry point is in front of a face, this is the actual contact
+  RayHit enlargedHit;
+
+  if (!ray.intersects(AABB(minPos - radius, maxPos + radius), &enlargedHit) || enlargedHit.distance > maxDistance)
+    return false;
+
+  if (enlargedHit.distance >= 0.f) {
+    std::size_t outsideAxisCount = 0;
+
+    for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+      if (enlargedHit.position[axisIndex] < minPos[axisIndex] || enlargedHit.position[axisIndex] > maxPos[axisIndex])
+        ++outsideAxisCount;
+    }
+
+    if (outsideAxisCount <= 1) {
+      hitDistance = enlargedHit.distance;
+      return true;
+    }
+  }
+
+  // Otherwise, the entry point is in front of an edge or a corner, which are rounded by the sphere; these form capsules around each of the box's edges
+  std::array<Vec3f, 8> corners {};
+
+  for (std::size_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex) {
+    corners[cornerIndex] = Vec3f((cornerIndex & 1u) ? maxPos[0] : minPos[0],
+                                 (cornerIndex & 2u) ? maxPos[1] : minPos[1],
+                                 (cornerIndex & 4u) ? maxPos[2] : minPos[2]);
+  }
+
+  bool isHit = false;
+
+  for (std::size_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex) {
+    for (std::size_t axisBit = 1; axisBit < 8; axisBit <<= 1) {
+      if (cornerIndex & axisBit)
+        continue;
+
+      float edgeDist {};
+
+      if (castPointToCapsule(ray, corners[cornerIndex], corners[cornerIndex | axisBit], radius, maxDistance, edgeDist)) {
+        hitDistance = edgeDist;
+        maxDistance = edgeDist;
+        isHit       = true;
+      }
+    }
+  }
+
+  return isHit;
+}
+
+/// Computes the radius of a box's projection onto an axis, that is half the length of the range it covers along it.
+/// \param halfExtents Half extents of the axis-aligned box.
+/// \param axis Normalized axis to project the box onto.
+/// \return Radius of the box's projection.
+float computeBoxProjectionRadius(const Vec3f& halfExtents, const Vec3f& axis) noexcept {
+  return halfExtents[0] * std::abs(axis[0]) + halfExtents[1] * std::abs(axis[1]) + halfExtents[2] * std::abs(axis[2]);
+}
+
+/// Finds the distance at which an axis-aligned box moving along a ray first touches a convex shape, using the separating axis theorem.
+/// On each candidate axis, the box's projection overlaps the shape's during a range of distances; both shapes touch on the range common to all axes,
+///   the latest axis to be entered giving the contact normal.
+/// \tparam PointCount Number of points defining the shape.
+/// \tparam NormalCount Number of the shape's face normals.
+/// \tparam EdgeCount Number of the shape's edges.
+/// \param ray Ray followed by the box's center.
+/// \param halfExtents Half extents of the box.
+/// \param points Points defining the shape, which the shape is the convex hull of.
+/// \param faceNormals Normals of the shape's faces, which don't need to be normalized.
+/// \param edges Shape's edges, whose cross product with each of the box's axes is checked.
+/// \param maxDistance Maximum distance the box can travel.
+/// \param hit Optional information of the first contact (nullptr if unneeded).
+/// \return True if the box touches the shape before the maximum distance, false otherwise.
+template <std::size_t PointCount, std::size_t NormalCount, std::size_t EdgeCount>
+bool castBoxToConvex(const Ray& ray, const Vec3f& halfExtents, const std::array<Vec3f, PointCount>& points,
+                     const std::array<Vec3f, NormalCount>& faceNormals, const std::array<Vec3f, EdgeCount>& edges, float maxDistance, RayHit* hit) {
+  float entryDist   = std::numeric_limits<float>::lowest();
+  float exitDist    = maxDistance;
+  Vec3f entryNormal = -ray.getDirection();
+
+  const auto checkAxis = [&ray, &halfExtents, &points, &entryDist, &exitDist, &entryNormal] (const Vec3f& axis, float minSqLength) {
+    const float axisSqLength = axis.computeSquaredLength();
+
+    if (axisSqLength <= minSqLength) // Degenerate axis, resulting from parallel directions
+      return true;
+
+    const Vec3f normedAxis = axis / std::sqrt(axisSqLength);
+
+    float minProj = std::numeric_limits<float>::max();
+    float maxProj = std::numeric_limits<float>::lowest();
+
+    for (const Vec3f& point : points) {
+      const float pointProj = point.dot(normedAxis);
+      minProj = std::min(minProj, pointProj);
+      maxProj = std::max(maxProj, pointProj);
+    }
+
+    // Along this axis, the box overlaps the shape while its center's projection stays within the shape's range enlarged by the box's own
+    const float boxRadius = computeBoxProjectionRadius(halfExtents, normedAxis);
+    const float lowerGap  = minProj - boxRadius - ray.getOrigin().dot(normedAxis);
+    const float upperGap  = maxProj + boxRadius - ray.getOrigin().dot(normedAxis);
+    const float dirProj   = ray.getDirection().dot(normedAxis);
+
+    if (std::abs(dirProj) <= std::numeric_limits<float>::epsilon()) // Moving parallel to the axis; the overlap never changes
+      return (lowerGap <= 0.f && upperGap >= 0.f);
+
+    const float axisEntryDist = std::min(lowerGap / dirProj, upperGap / dirProj);
+    const float axisExitDist  = std::max(lowerGap / dirProj, upperGap / dirProj);
+
+    if (axisEntryDist > entryDist) {
+      entryDist   = axisEntryDist;
+      entryNormal = (dirProj > 0.f ? -normedAxis : normedAxis);
+    }
+
+    exitDist = std::min(exitDist, axisExitDist);
+
+    return (entryDist <= exitDist);
+  };
+
+  constexpr float minSqLength = std::numeric_limits<float>::epsilon();
+
+  for (const Vec3f& boxAxis : { Axis::X, Axis::Y, Axis::Z }) {
+    if (!checkAxis(boxAxis, minSqLength))
+      return false;
+  }
+
+  for (const Vec3f& faceNormal : faceNormals) {
+    if (!checkAxis(faceNormal, minSqLength * faceNormal.computeSquaredLength()))
+      return false;
+  }
+
+  for (const Vec3f& edge : edges) {
+    for (const Vec3f& boxAxis : { Axis::X, Axis::Y, Axis::Z }) {
+      if (!checkAxis(boxAxis.cross(edge), minSqLength * edge.computeSquaredLength()))
+        return false;
+    }
+  }
+
+  if (exitDist < 0.f) // The box only overlaps the shape behind the ray's origin
+    return false;
+
+  if (hit) {
+    const float hitDistance = std::max(entryDist, 0.f);
+    const Vec3f centerPos   = ray.getOrigin() + ray.getDirection() * hitDistance;
+
+    hit->position = centerPos - entryNormal * computeBoxProjectionRadius(halfExtents, entryNormal);
+    hit->normal   = entryNormal;
+    hit->distance = hitDistance;
+  }
+
+  return true;
+}
+
+} // namespace
+
+bool sphereCast(const Ray& ray, float radius, const Line& line, RayHit* hit, float maxDistance) {
+  float hitDistance {};
+
+  if (!castPointToCapsule(ray, line.getBeginPos(), line.getEndPos(), radius, maxDistance, hitDistance))
+    return false;
+
+  if (hit)
+    fillHit(ray, hitDistance, line.computeProjection(ray.getOrigin() + ray.getDirection() * hitDistance), *hit);
+
+  return true;
+}
+
+bool sphereCast(const Ray& ray, float radius, const Plane& plane, RayHit* hit, float maxDistance) {
+  const float originDist = ray.getOrigin().dot(plane.getNormal()) - plane.getDistance();
+
+  if (originDist < -radius) // The sphere is fully behind the plane
+    return false;
+
+  float hitDistance = 0.f;
+
+  if (originDist > radius) {
+    const float dirAngle = ray.getDirection().dot(plane.getNormal());
+
+    if (dirAngle >= 0.f) // The sphere is moving away from the plane or parallel to it
+      return false;
+
+    hitDistance = (originDist - radius) / -dirAngle;
+
+    if (hitDistance > maxDistance)
+      return false;
+  }
+
+  if (hit) {
+    const Vec3f centerPos = ray.getOrigin() + ray.getDirection() * hitDistance;
+
+    hit->position = centerPos - plane.getNormal() * (centerPos.dot(plane.getNormal()) - plane.getDistance());
+    hit->normal   = plane.getNormal();
+    hit->distance = hitDistance;
+  }
+
+  return true;
+}
+
+bool sphereCast(const Ray& ray, float radius, const Sphere& sphere, RayHit* hit, float maxDistance) {
+  float hitDistance {};
+
+  if (!castPointToSphere(ray, sphere.getCenter(), sphere.getRadius() + radius, maxDistance, hitDistance))
+    return false;
+
+  if (hit) {
+    const Vec3f centerPos    = ray.getOrigin() + ray.getDirection() * hitDistance;
+    const Vec3f centerDir    = centerPos - sphere.getCenter();
+    const float centerSqDist = centerDir.computeSquaredLength();
+
+    hit->normal   = (centerSqDist > 0.f ? centerDir / std::sqrt(centerSqDist) : -ray.getDirection());
+    hit->position = sphere.getCenter() + hit->normal * std::min(sphere.getRadius(), std::sqrt(centerSqDist));
+    hit->distance = hitDistance;
+  }
+
+  return true;
+}
+
+bool sphereCast(const Ray& ray, float radius, const Triangle& triangle, RayHit* hit, float maxDistance) {
+  if ((triangle.computeProjection(ray.getOrigin()) - ray.getOrigin()).computeSquaredLength() <= radius * radius) {
+    if (hit)
+      fillHit(ray, 0.f, triangle.computeProjection(ray.getOrigin()), *hit);
+
+    return true;
+  }
+
+  const Vec3f& firstPos  = triangle.getFirstPos();
+  const Vec3f& secondPos = triangle.getSecondPos();
+  const Vec3f& thirdPos  = triangle.getThirdPos();
+
+  // The sphere first touches either the triangle's face, or one of its edges or points
+  // The face is checked first, by finding where the sphere touches the triangle's plane from the side it comes from
+  Vec3f normal           = triangle.computeNormal();
+  const Vec3f windingDir = normal;
+  float originDist       = (ray.getOrigin() - firstPos).dot(normal);
+
+  if (originDist < 0.f) {
+    normal     = -normal;
+    originDist = -originDist;
+  }
+
+  const float dirAngle = ray.getDirection().dot(normal);
+
+  if (originDist > radius && dirAngle < 0.f) {
+    const float planeHitDist = (originDist - radius) / -dirAngle;
+
+    if (planeHitDist > maxDistance)
+      return false;
+
+    const Vec3f contactPos = ray.getOrigin() + ray.getDirection() * planeHitDist - normal * radius;
+
+    if ((secondPos - firstPos).cross(contactPos - firstPos).dot(windingDir) >= 0.f
+     && (thirdPos - secondPos).cross(contactPos - secondPos).dot(windingDir) >= 0.f
+     && (firstPos - thirdPos).cross(contactPos - thirdPos).dot(windingDir) >= 0.f) {
+      if (hit) {
+        hit->position = contactPos;
+        hit->normal   = normal;
+        hit->distance = planeHitDist;
+      }
+
+      return true;
+    }
+  }
+
+  // If the face hasn't been touched, the edges are checked as capsules, which also include the triangle's points
+  bool isHit        = false;
+  float hitDistance = maxDistance;
+
+  const std::array<Vec3f, 4> positions = { firstPos, secondPos, thirdPos, firstPos };
+
+  for (std::size_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+    float edgeDist {};
+
+    if (castPointToCapsule(ray, positions[edgeIndex], positions[edgeIndex + 1], radius, hitDistance, edgeDist)) {
+      hitDistance = edgeDist;
+      isHit       = true;
+    }
+  }
+
+  if (isHit && hit)
+    fillHit(ray, hitDistance, triangle.computeProjection(ray.getOrigin() + ray.getDirection() * hitDistance), *hit);
+
+  return isHit;
+}
+
+bool sphereCast(const Ray& ray, float radius, const Quad& quad, RayHit* hit, float maxDistance) {
+  RayHit firstHit;
+  RayHit secondHit;
+
+  const bool hitsFirstTriangle  = sphereCast(ray, radius, Triangle(quad.getLeftTopPos(), quad.getRightTopPos(), quad.getRightBottomPos()), &firstHit, maxDistance);
+  const bool hitsSecondTriangle = sphereCast(ray, radius, Triangle(quad.getLeftTopPos(), quad.getRightBottomPos(), quad.getLeftBottomPos()), &secondHit, maxDistance);
+
+  if (!hitsFirstTriangle && !hitsSecondTriangle)
+    return false;
+
+  if (hit)
+    *hit = (firstHit.distance <= secondHit.distance ? firstHit : secondHit);
+
+  return true;
+}
+
+bool sphereCast(const Ray& ray, float radius, const AABB& aabb, RayHit* hit, float maxDistance) {
+  float hitDistance {};
+
+  if (!castSphereToAABB(ray, radius, aabb.getLeftBottomBackPos(), aabb.getRightTopFrontPos(), maxDistance, hitDistance))
+    return false;
+
+  if (hit)
+    fillHit(ray, hitDistance, aabb.computeProjection(ray.getOrigin() + ray.getDirection() * hitDistance), *hit);
+
+  return true;
+}
+
+bool sphereCast(const Ray& ray, float radius, const OBB& obb, RayHit* hit, float maxDistance) {
+  // The check is made in the box's local space, where it amounts to a sphere-AABB cast; the rotation preserving distances, so is the radius
+  const Vec3f boxCentroid    = obb.computeCentroid();
+  const Vec3f boxHalfExtents = (obb.getRightTopFrontPos() - obb.getLeftBottomBackPos()) * 0.5f;
+
+  const Ray localRay((ray.getOrigin() - boxCentroid) * obb.getInverseRotation(), ray.getDirection() * obb.getInverseRotation());
+
+  if (!sphereCast(localRay, radius, AABB(-boxHalfExtents, boxHalfExtents), hit, maxDistance))
+    return false;
+
+  if (hit) {
+    hit->position = hit->position * obb.getRotation() + boxCentroid;
+    hit->normal   = hit->normal * obb.getRotation();
+  }
+
+  return true;
+}
+
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const Line& line, RayHit* hit, float maxDistance) {
+  return castBoxToConvex(ray, halfExtents, std::array<Vec3f, 2>{ line.getBeginPos(), line.getEndPos() }, std::array<Vec3f, 0>{},
+                         std::array<Vec3f, 1>{ line.getEndPos() - line.getBeginPos() }, maxDistance, hit);
+}
+
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const Plane& plane, RayHit* hit, float maxDistance) {
+  // Against a plane, the box behaves exactly like a sphere whose radius is that of its projection onto the plane's normal
+  return sphereCast(ray, computeBoxProjectionRadius(halfExtents, plane.getNormal()), plane, hit, maxDistance);
+}
+
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const Sphere& sphere, RayHit* hit, float maxDistance) {
+  // The box moving towards the sphere amounts to the sphere moving towards the box in the opposite direction
+  const Ray invRay(sphere.getCenter(), -ray.getDirection());
+  float hitDistance {};
+
+  if (!castSphereToAABB(invRay, sphere.getRadius(), ray.getOrigin() - halfExtents, ray.getOrigin() + halfExtents, maxDistance, hitDistance))
+    return false;
+
+  if (hit) {
+    const Vec3f centerPos   = ray.getOrigin() + ray.getDirection() * hitDistance;
+    const Vec3f contactDir  = AABB(centerPos - halfExtents, centerPos + halfExtents).computeProjection(sphere.getCenter()) - sphere.getCenter();
+    const float contactDist = contactDir.computeLength();
+
+    hit->normal   = (contactDist > 0.f ? contactDir / contactDist : -ray.getDirection());
+    hit->position = sphere.getCenter() + hit->normal * std::min(sphere.getRadius(), contactDist);
+    hit->distance = hitDistance;
+  }
+
+  return true;
+}
+
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const Triangle& triangle, RayHit* hit, float maxDistance) {
+  const Vec3f& firstPos  = triangle.getFirstPos();
+  const Vec3f& secondPos = triangle.getSecondPos();
+  const Vec3f& thirdPos  = triangle.getThirdPos();
+
+  return castBoxToConvex(ray, halfExtents, std::array<Vec3f, 3>{ firstPos, secondPos, thirdPos },
+                         std::array<Vec3f, 1>{ (secondPos - firstPos).cross(thirdPos - firstPos) },
+                         std::array<Vec3f, 3>{ secondPos - firstPos, thirdPos - secondPos, firstPos - thirdPos }, maxDistance, hit);
+}
+
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const Quad& quad, RayHit* hit, float maxDistance) {
+  const Vec3f& leftTopPos     = quad.getLeftTopPos();
+  const Vec3f& rightTopPos    = quad.getRightTopPos();
+  const Vec3f& rightBottomPos = quad.getRightBottomPos();
+  const Vec3f& leftBottomPos  = quad.getLeftBottomPos();
+
+  return castBoxToConvex(ray, halfExtents, std::array<Vec3f, 4>{ leftTopPos, rightTopPos, rightBottomPos, leftBottomPos },
+                         std::array<Vec3f, 1>{ (rightTopPos - leftTopPos).cross(leftBottomPos - leftTopPos) },
+                         std::array<Vec3f, 4>{ rightTopPos - leftTopPos, rightBottomPos - rightTopPos, leftBottomPos - rightBottomPos, leftTopPos - leftBottomPos },
+                         maxDistance, hit);
+}
+
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const AABB& aabb, RayHit* hit, float maxDistance) {
+  // Both boxes being axis-aligned, their own axes are the only ones to be checked; the two extreme points are enough to give the projections onto them
+  return castBoxToConvex(ray, halfExtents, std::array<Vec3f, 2>{ aabb.getLeftBottomBackPos(), aabb.getRightTopFrontPos() }, std::array<Vec3f, 0>{},
+                         std::array<Vec3f, 0>{}, maxDistance, hit);
+}
+
+bool boxCast(const Ray& ray, const Vec3f& halfExtents, const OBB& obb, RayHit* hit, float maxDistance) {
+  const Vec3f boxCentroid    = obb.computeCentroid();
+  const Vec3f boxHalfExtents = (obb.getRightTopFrontPos() - obb.getLeftBottomBackPos()) * 0.5f;
+
+  std::array<Vec3f, 8> corners {};
+
+  for (std::size_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex) {
+    const Vec3f localCorner((cornerIndex & 1u) ? boxHalfExtents[0] : -boxHalfExtents[0],
+                            (cornerIndex & 2u) ? boxHalfExtents[1] : -boxHalfExtents[1],
+                            (cornerIndex & 4u) ? boxHalfExtents[2] : -boxHalfExtents[2]);
+    corners[cornerIndex] = localCorner * obb.getRotation() + boxCentroid;
+  }
+
+  // The oriented box's axes are both its faces' normals & its edges' directions
+  const std::array<Vec3f, 3> boxAxes = { Axis::X * obb.getRotation(), Axis::Y * obb.getRotation(), Axis::Z * obb.getRotation() };
+
+  return castBoxToConvex(ray, halfExtents, corners, boxAxes, boxAxes, maxDistance, hit);
+}
+
+} // namespace Raz::ShapeCast
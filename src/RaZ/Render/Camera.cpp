@@ -1,3 +1,4 @@
+#include "RaZ/Math/Affine.hpp"
 #include "RaZ/Render/Camera.hpp"
 
 namespace Raz {
@@ -46,7 +47,7 @@ void Camera::setProjectionType(ProjectionType projType) {
 }
 
 const Mat4f& Camera::computeViewMatrix(const Mat4f& translationMatrix, const Mat4f& inverseRotation) {
-  m_viewMat = translationMatrix * inverseRotation;
+  m_viewMat = (Affine3f(translationMatrix) * Affine3f(inverseRotation)).computeMatrix();
   return m_viewMat;
 }
 
@@ -64,7 +65,8 @@ const Mat4f& Camera::computeLookAt(const Vec3f& position) {
 }
 
 const Mat4f& Camera::computeInverseViewMatrix() {
-  m_invViewMat = m_viewMat.inverse();
+  // The view matrix being an affine transformation, only its 3x3 linear part needs to be inverted
+  m_invViewMat = Affine3f(m_viewMat).inverse().computeMatrix();
   return m_invViewMat;
 }
 
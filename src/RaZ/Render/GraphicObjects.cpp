@@ -4,14 +4,13 @@
 
 namespace Raz {
 
-VertexArray::VertexArray() {
-  glGenVertexArrays(1, &m_index);
-}
-
 VertexArray::VertexArray(VertexArray&& vao) noexcept
   : m_index{ std::exchange(vao.m_index, std::numeric_limits<unsigned int>::max()) } {}
 
 void VertexArray::bind() const {
+  if (m_index == std::numeric_limits<unsigned int>::max())
+    glGenVertexArrays(1, &m_index);
+
   glBindVertexArray(m_index);
 }
 
@@ -26,17 +25,21 @@ VertexArray& VertexArray::operator=(VertexArray&& vao) noexcept {
 }
 
 VertexArray::~VertexArray() {
-  glDeleteVertexArrays(1, &m_index);
-}
+  if (m_index == std::numeric_limits<unsigned int>::max())
+    return;
 
-VertexBuffer::VertexBuffer() {
-  Renderer::generateBuffer(m_index);
+  glDeleteVertexArrays(1, &m_index);
 }
 
 VertexBuffer::VertexBuffer(VertexBuffer&& vbo) noexcept
-  : m_index{ std::exchange(vbo.m_index, std::numeric_limits<unsigned int>::max()) }, m_vertices{ std::move(vbo.m_vertices) } {}
+  : m_index{ std::exchange(vbo.m_index, std::numeric_limits<unsigned int>::max()) },
+    m_vertices{ std::move(vbo.m_vertices) },
+    m_layout{ vbo.m_layout } {}
 
 void VertexBuffer::bind() const {
+  if (m_index == std::numeric_limits<unsigned int>::max())
+    Renderer::generateBuffer(m_index);
+
   Renderer::bindBuffer(BufferType::ARRAY_BUFFER, m_index);
 }
 
@@ -47,6 +50,7 @@ void VertexBuffer::unbind() const {
 VertexBuffer& VertexBuffer::operator=(VertexBuffer&& vbo) noexcept {
   std::swap(m_index, vbo.m_index);
   m_vertices = std::move(vbo.m_vertices);
+  m_layout   = vbo.m_layout;
 
   return *this;
 }
@@ -58,16 +62,15 @@ VertexBuffer::~VertexBuffer() {
   Renderer::deleteBuffer(m_index);
 }
 
-IndexBuffer::IndexBuffer() {
-  Renderer::generateBuffer(m_index);
-}
-
 IndexBuffer::IndexBuffer(IndexBuffer&& ibo) noexcept
   : m_index{ std::exchange(ibo.m_index, std::numeric_limits<unsigned int>::max()) },
     m_lineIndices{ std::move(ibo.m_lineIndices) },
     m_triangleIndices{ std::move(ibo.m_triangleIndices) } {}
 
 void IndexBuffer::bind() const {
+  if (m_index == std::numeric_limits<unsigned int>::max())
+    Renderer::generateBuffer(m_index);
+
   Renderer::bindBuffer(BufferType::ELEMENT_BUFFER, m_index);
 }
 
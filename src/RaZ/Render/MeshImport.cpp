@@ -1,27 +1,74 @@
 #include "RaZ/Render/Mesh.hpp"
 #include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/MappedFile.hpp"
 #include "RaZ/Utils/StrUtils.hpp"
+#include "RaZ/Utils/VirtualFileSystem.hpp"
 
 #include <fstream>
 
 namespace Raz {
 
-void Mesh::import(const FilePath& filePath) {
+void Mesh::import(const FilePath& filePath, bool optimizeSubmeshes) {
+  importData(filePath, optimizeSubmeshes);
+  createImportedMaterials();
+}
+
+Mesh Mesh::importDeferred(const FilePath& filePath, bool optimizeSubmeshes) {
+  Mesh mesh(std::vector<Submesh>{});
+  mesh.importData(filePath, optimizeSubmeshes);
+
+  return mesh;
+}
+
+void Mesh::createImportedMaterials() {
+  for (const std::function<void(Mesh&)>& createMaterials : m_materialCreations)
+    createMaterials(*this);
+
+  m_materialCreations.clear();
+}
+
+void Mesh::importData(const FilePath& filePath, bool optimizeSubmeshes) {
   // Resetting the mesh to an empty state before importing
   m_submeshes.clear();
   m_submeshes.resize(1);
   m_materials.clear();
+  m_materialCreations.clear();
+
+  importFile(filePath);
+
+  if (optimizeSubmeshes)
+    optimize();
+}
+
+void Mesh::importFile(const FilePath& filePath) {
+  // Meshes converted by the asset cooker are archived under the path of their source file
+  if (const std::optional<ArchiveEntry> archivedMesh = VirtualFileSystem::find(filePath)) {
+    if (archivedMesh->type != AssetArchiveFormat::EntryType::MESH)
+      throw std::invalid_argument("Error: The archived asset '" + filePath + "' is not a mesh");
+
+    importRazmesh(archivedMesh->data, filePath);
+    return;
+  }
+
+  const std::string format = StrUtils::toLowercaseCopy(filePath.recoverExtension().toUtf8());
+
+  if (format == "obj") { // OBJ files are memory-mapped instead of being read through a stream
+    importObj(filePath);
+    return;
+  }
+
+  if (format == "razmesh") { // Razmesh files are memory-mapped as well, their content being directly copied
+    const MappedFile file(filePath);
+    importRazmesh(file.getContent(), filePath);
+    return;
+  }
 
   std::ifstream file(filePath, std::ios_base::in | std::ios_base::binary);
 
   if (!file)
     throw std::invalid_argument("Error: Couldn't open the mesh file '" + filePath + "'");
 
-  const std::string format = StrUtils::toLowercaseCopy(filePath.recoverExtension().toUtf8());
-
-  if (format == "obj")
-    importObj(file, filePath);
-  else if (format == "off")
+  if (format == "off")
     importOff(file);
   else if (format == "fbx")
 #if defined(FBX_ENABLED)
@@ -42,6 +89,8 @@ void Mesh::save(const FilePath& filePath) const {
 
   if (format == "obj")
     saveObj(file, filePath);
+  else if (format == "razmesh")
+    saveRazmesh(file, filePath);
   else
     throw std::invalid_argument("Error: '" + format + "' mesh format is not supported");
 }
@@ -0,0 +1,404 @@
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/MeshOptimizer.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <numeric>
+
+namespace Raz::MeshOptimizer {
+
+namespace {
+
+constexpr unsigned int invalidIndex = std::numeric_limits<unsigned int>::max();
+
+// Emulates a FIFO cache through timestamps: a vertex is in the cache if less than its size have been inserted since its own insertion
+class VertexCache {
+public:
+  VertexCache(std::size_t vertexCount, unsigned int cacheSize) : m_timestamps(vertexCount, 0), m_cacheSize{ cacheSize }, m_timestamp{ cacheSize + 1 } {}
+
+  /// Accesses a vertex, inserting it in the cache if not already present.
+  /// \return 1 if the vertex had to be transformed, 0 if it was found in the cache.
+  unsigned int access(unsigned int vertIndex) {
+    if (m_timestamp - m_timestamps[vertIndex] <= m_cacheSize)
+      return 0;
+
+    m_timestamps[vertIndex] = m_timestamp++;
+    return 1;
+  }
+
+  unsigned int accessTriangle(const unsigned int* triangleIndices) {
+    return access(triangleIndices[0]) + access(triangleIndices[1]) + access(triangleIndices[2]);
+  }
+
+  /// Empties the cache; any vertex accessed afterward is transformed.
+  void flush() { m_timestamp += m_cacheSize + 1; }
+
+private:
+  std::vector<unsigned int> m_timestamps {};
+  unsigned int m_cacheSize {};
+  unsigned int m_timestamp {};
+};
+
+inline void computeRatios(VertexCacheStatistics& stats) {
+  stats.acmr = (stats.triangleCount == 0 ? 0.f : static_cast<float>(stats.transformedVertexCount) / static_cast<float>(stats.triangleCount));
+  stats.atvr = (stats.vertexCount == 0 ? 0.f : static_cast<float>(stats.transformedVertexCount) / static_cast<float>(stats.vertexCount));
+}
+
+/// Reorders the triangles for the vertex cache & overdraw, keeping the original order if it was already more efficient.
+OptimizationStatistics reorderTriangles(std::vector<unsigned int>& indices, const std::vector<Vertex>& vertices, float overdrawThreshold) {
+  OptimizationStatistics stats;
+  stats.before = analyzeVertexCache(indices, vertices.size());
+
+  std::vector<unsigned int> optimizedIndices = indices;
+  optimizeVertexCache(optimizedIndices, vertices.size());
+  optimizeOverdraw(optimizedIndices, vertices, overdrawThreshold);
+
+  stats.after = analyzeVertexCache(optimizedIndices, vertices.size());
+
+  if (stats.after.acmr > stats.before.acmr)
+    stats.after = stats.before;
+  else
+    indices = std::move(optimizedIndices);
+
+  return stats;
+}
+
+} // namespace
+
+VertexCacheStatistics analyzeVertexCache(const std::vector<unsigned int>& indices, std::size_t vertexCount, unsigned int cacheSize) {
+  assert("Error: Triangle indices must come by groups of 3." && indices.size() % 3 == 0);
+
+  VertexCacheStatistics stats;
+  stats.triangleCount = indices.size() / 3;
+  stats.vertexCount   = vertexCount;
+
+  VertexCache cache(vertexCount, cacheSize);
+
+  for (const unsigned int index : indices) {
+    assert("Error: The index is out of bounds." && index < vertexCount);
+    stats.transformedVertexCount += cache.access(index);
+  }
+
+  computeRatios(stats);
+  return stats;
+}
+
+void optimizeVertexCache(std::vector<unsigned int>& indices, std::size_t vertexCount, unsigned int cacheSize) {
+  assert("Error: Triangle indices must come by groups of 3." && indices.size() % 3 == 0);
+  assert("Error: The vertex cache must be able to hold at least a triangle." && cacheSize >= 3);
+  assert("Error: The number of vertices exceeds the maximum index." && vertexCount < invalidIndex);
+
+  const std::size_t triangleCount = indices.size() / 3;
+
+  if (triangleCount == 0)
+    return;
+
+  // Number of triangles remaining to be emitted for each vertex
+  std::vector<unsigned int> liveTriangleCounts(vertexCount, 0);
+
+  for (const unsigned int index : indices) {
+    assert("Error: The index is out of bounds." && index < vertexCount);
+    ++liveTriangleCounts[index];
+  }
+
+  // Triangles adjacent to each vertex, stored contiguously
+  std::vector<unsigned int> adjacencyOffsets(vertexCount + 1, 0);
+  std::partial_sum(liveTriangleCounts.cbegin(), liveTriangleCounts.cend(), adjacencyOffsets.begin() + 1);
+
+  std::vector<unsigned int> adjacentTriangles(indices.size());
+
+  {
+    std::vector<unsigned int> fillOffsets(adjacencyOffsets.cbegin(), adjacencyOffsets.cend() - 1);
+
+    for (std::size_t index = 0; index < indices.size(); ++index)
+      adjacentTriangles[fillOffsets[indices[index]]++] = static_cast<unsigned int>(index / 3);
+  }
+
+  std::vector<unsigned int> cacheTimestamps(vertexCount, 0);
+  unsigned int timestamp = cacheSize + 1;
+
+  std::vector<bool> emittedTriangles(triangleCount, false);
+  std::vector<unsigned int> deadEndStack;
+  std::vector<unsigned int> candidates;
+  std::size_t cursor = 0;
+
+  std::vector<unsigned int> optimizedIndices;
+  optimizedIndices.reserve(indices.size());
+
+  // When no candidate is left, the fan restarts from the latest emitted vertex still having triangles, or else from the next one in the buffer
+  const auto skipDeadEnd = [&] () {
+    while (!deadEndStack.empty()) {
+      const unsigned int vertIndex = deadEndStack.back();
+      deadEndStack.pop_back();
+
+      if (liveTriangleCounts[vertIndex] > 0)
+        return vertIndex;
+    }
+
+    while (cursor < vertexCount) {
+      if (liveTriangleCounts[cursor] > 0)
+        return static_cast<unsigned int>(cursor);
+
+      ++cursor;
+    }
+
+    return invalidIndex;
+  };
+
+  unsigned int fanningVertex = skipDeadEnd();
+
+  while (fanningVertex != invalidIndex) {
+    candidates.clear();
+
+    // Emitting all the remaining triangles around the fanning vertex
+    for (unsigned int adjacencyIndex = adjacencyOffsets[fanningVertex]; adjacencyIndex < adjacencyOffsets[fanningVertex + 1]; ++adjacencyIndex) {
+      const unsigned int triangleIndex = adjacentTriangles[adjacencyIndex];
+
+      if (emittedTriangles[triangleIndex])
+        continue;
+
+      for (std::size_t i = 0; i < 3; ++i) {
+        const unsigned int vertIndex = indices[triangleIndex * 3 + i];
+
+        optimizedIndices.emplace_back(vertIndex);
+        deadEndStack.emplace_back(vertIndex);
+        candidates.emplace_back(vertIndex);
+        --liveTriangleCounts[vertIndex];
+
+        if (timestamp - cacheTimestamps[vertIndex] > cacheSize)
+          cacheTimestamps[vertIndex] = timestamp++;
+      }
+
+      emittedTriangles[triangleIndex] = true;
+    }
+
+    // The next fanning vertex is the oldest candidate which would still be in the cache after emitting all of its triangles; if there is none,
+    //   any candidate having triangles left is taken
+    unsigned int nextVertex = invalidIndex;
+    int bestPriority        = -1;
+
+    for (const unsigned int vertIndex : candidates) {
+      if (liveTriangleCounts[vertIndex] == 0)
+        continue;
+
+      const unsigned int cacheAge = timestamp - cacheTimestamps[vertIndex];
+      const int priority          = (cacheAge + 2 * liveTriangleCounts[vertIndex] <= cacheSize ? static_cast<int>(cacheAge) : 0);
+
+      if (priority > bestPriority) {
+        bestPriority = priority;
+        nextVertex   = vertIndex;
+      }
+    }
+
+    fanningVertex = (nextVertex != invalidIndex ? nextVertex : skipDeadEnd());
+  }
+
+  assert("Error: All triangles must have been emitted." && optimizedIndices.size() == indices.size());
+  indices = std::move(optimizedIndices);
+}
+
+void optimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<Vertex>& vertices, float threshold, unsigned int cacheSize) {
+  assert("Error: Triangle indices must come by groups of 3." && indices.size() % 3 == 0);
+  assert("Error: The overdraw threshold must be positive." && threshold > 0.f);
+
+  const std::size_t triangleCount = indices.size() / 3;
+
+  if (triangleCount == 0)
+    return;
+
+  VertexCache cache(vertices.size(), cacheSize);
+
+  // A triangle whose vertices are all missing from the cache usually starts a new patch, disjoint from the previous ones; the triangles
+  //   can be freely reordered between such boundaries without affecting the cache efficiency
+  std::vector<std::size_t> hardBoundaries;
+
+  for (std::size_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex) {
+    if (cache.accessTriangle(&indices[triangleIndex * 3]) == 3 || triangleIndex == 0)
+      hardBoundaries.emplace_back(triangleIndex);
+  }
+
+  hardBoundaries.emplace_back(triangleCount);
+
+  // Each patch is split further into clusters, as soon as these reach the patch's cache efficiency within the threshold. Each cluster
+  //   starting with an empty cache, the smaller they are, the more the efficiency is degraded
+  std::vector<std::size_t> clusterBoundaries;
+
+  for (std::size_t patchIndex = 0; patchIndex + 1 < hardBoundaries.size(); ++patchIndex) {
+    const std::size_t patchBegin = hardBoundaries[patchIndex];
+    const std::size_t patchEnd   = hardBoundaries[patchIndex + 1];
+
+    cache.flush();
+    std::size_t patchMissCount = 0;
+
+    for (std::size_t triangleIndex = patchBegin; triangleIndex < patchEnd; ++triangleIndex)
+      patchMissCount += cache.accessTriangle(&indices[triangleIndex * 3]);
+
+    const float clusterThreshold = threshold * static_cast<float>(patchMissCount) / static_cast<float>(patchEnd - patchBegin);
+
+    clusterBoundaries.emplace_back(patchBegin);
+    cache.flush();
+
+    std::size_t clusterMissCount     = 0;
+    std::size_t clusterTriangleCount = 0;
+
+    for (std::size_t triangleIndex = patchBegin; triangleIndex + 1 < patchEnd; ++triangleIndex) {
+      clusterMissCount += cache.accessTriangle(&indices[triangleIndex * 3]);
+      ++clusterTriangleCount;
+
+      if (static_cast<float>(clusterMissCount) > clusterThreshold * static_cast<float>(clusterTriangleCount))
+        continue;
+
+      clusterBoundaries.emplace_back(triangleIndex + 1);
+      cache.flush();
+
+      clusterMissCount     = 0;
+      clusterTriangleCount = 0;
+    }
+  }
+
+  clusterBoundaries.emplace_back(triangleCount);
+
+  // Clusters facing outwards the mesh are the most likely to occlude the others, & are thus drawn first
+  Vec3f meshCentroid;
+
+  for (const unsigned int index : indices)
+    meshCentroid += vertices[index].position;
+
+  meshCentroid /= static_cast<float>(indices.size());
+
+  const std::size_t clusterCount = clusterBoundaries.size() - 1;
+  std::vector<float> clusterScores(clusterCount);
+
+  for (std::size_t clusterIndex = 0; clusterIndex < clusterCount; ++clusterIndex) {
+    Vec3f clusterCentroid;
+    Vec3f clusterNormal; // Sum of the triangles' non-normalized normals, thus weighted by their area
+
+    for (std::size_t triangleIndex = clusterBoundaries[clusterIndex]; triangleIndex < clusterBoundaries[clusterIndex + 1]; ++triangleIndex) {
+      const Vec3f& firstPos  = vertices[indices[triangleIndex * 3]].position;
+      const Vec3f& secondPos = vertices[indices[triangleIndex * 3 + 1]].position;
+      const Vec3f& thirdPos  = vertices[indices[triangleIndex * 3 + 2]].position;
+
+      clusterCentroid += firstPos + secondPos + thirdPos;
+      clusterNormal   += (secondPos - firstPos).cross(thirdPos - firstPos);
+    }
+
+    const std::size_t clusterTriangleCount = clusterBoundaries[clusterIndex + 1] - clusterBoundaries[clusterIndex];
+    clusterCentroid /= static_cast<float>(clusterTriangleCount * 3);
+
+    const float normalLength = clusterNormal.computeLength();
+    clusterScores[clusterIndex] = (normalLength > 0.f ? (clusterCentroid - meshCentroid).dot(clusterNormal) / normalLength : 0.f);
+  }
+
+  std::vector<std::size_t> clusterOrder(clusterCount);
+  std::iota(clusterOrder.begin(), clusterOrder.end(), 0);
+  std::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&clusterScores] (std::size_t firstIndex, std::size_t secondIndex) {
+    return (clusterScores[firstIndex] > clusterScores[secondIndex]);
+  });
+
+  std::vector<unsigned int> sortedIndices;
+  sortedIndices.reserve(indices.size());
+
+  for (const std::size_t clusterIndex : clusterOrder)
+    sortedIndices.insert(sortedIndices.end(), indices.cbegin() + static_cast<std::ptrdiff_t>(clusterBoundaries[clusterIndex] * 3),
+                                              indices.cbegin() + static_cast<std::ptrdiff_t>(clusterBoundaries[clusterIndex + 1] * 3));
+
+  indices = std::move(sortedIndices);
+}
+
+MeshUtils::VertexRemap optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices) {
+  assert("Error: The number of vertices exceeds the maximum index." && vertices.size() < invalidIndex);
+
+  MeshUtils::VertexRemap remap;
+  remap.indices.resize(vertices.size(), invalidIndex);
+  remap.uniqueVertexCount = vertices.size();
+
+  unsigned int nextIndex = 0;
+
+  for (const unsigned int index : indices) {
+    assert("Error: The index is out of bounds." && index < vertices.size());
+
+    if (remap.indices[index] == invalidIndex)
+      remap.indices[index] = nextIndex++;
+  }
+
+  if (nextIndex == vertices.size() && std::is_sorted(remap.indices.cbegin(), remap.indices.cend()))
+    return remap; // The vertices are already in order
+
+  for (unsigned int& remappedIndex : remap.indices) {
+    if (remappedIndex == invalidIndex)
+      remappedIndex = nextIndex++;
+  }
+
+  std::vector<Vertex> reorderedVertices(vertices.size());
+
+  for (std::size_t vertIndex = 0; vertIndex < vertices.size(); ++vertIndex)
+    reorderedVertices[remap.indices[vertIndex]] = vertices[vertIndex];
+
+  vertices = std::move(reorderedVertices);
+  MeshUtils::remapIndices(indices, remap);
+
+  return remap;
+}
+
+OptimizationStatistics optimize(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, float overdrawThreshold) {
+  const OptimizationStatistics stats = reorderTriangles(indices, vertices, overdrawThreshold);
+  optimizeVertexFetch(vertices, indices);
+
+  return stats;
+}
+
+OptimizationStatistics optimize(Submesh& submesh, float overdrawThreshold) {
+  const OptimizationStatistics stats = reorderTriangles(submesh.getTriangleIndices(), submesh.getVertices(), overdrawThreshold);
+  const MeshUtils::VertexRemap remap = optimizeVertexFetch(submesh.getVertices(), submesh.getTriangleIndices());
+  MeshUtils::remapIndices(submesh.getLineIndices(), remap);
+
+  for (SubmeshLod& lod : submesh.getLods())
+    MeshUtils::remapIndices(lod.triangleIndices, remap);
+
+  submesh.setMeshlets({});
+
+  return stats;
+}
+
+} // namespace Raz::MeshOptimizer
+
+namespace Raz {
+
+MeshOptimizer::OptimizationStatistics Mesh::optimize(float overdrawThreshold) {
+  std::vector<MeshOptimizer::OptimizationStatistics> submeshStats(m_submeshes.size());
+
+  const auto optimizeSubmeshes = [this, &submeshStats, overdrawThreshold] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t submeshIndex = beginIndex; submeshIndex < endIndex; ++submeshIndex)
+      submeshStats[submeshIndex] = MeshOptimizer::optimize(m_submeshes[submeshIndex], overdrawThreshold);
+  };
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (m_submeshes.size() > 1)
+    Threading::parallelize(m_submeshes, [&optimizeSubmeshes] (Threading::IndexRange range) { optimizeSubmeshes(range.beginIndex, range.endIndex); });
+  else
+#endif
+    optimizeSubmeshes(0, m_submeshes.size());
+
+  // The whole mesh's statistics are those of all its submeshes' triangles & vertices
+  const auto accumulateStatistics = [] (MeshOptimizer::VertexCacheStatistics& meshStats, const MeshOptimizer::VertexCacheStatistics& stats) {
+    meshStats.transformedVertexCount += stats.transformedVertexCount;
+    meshStats.triangleCount          += stats.triangleCount;
+    meshStats.vertexCount            += stats.vertexCount;
+  };
+
+  MeshOptimizer::OptimizationStatistics meshStats;
+
+  for (const MeshOptimizer::OptimizationStatistics& stats : submeshStats) {
+    accumulateStatistics(meshStats.before, stats.before);
+    accumulateStatistics(meshStats.after, stats.after);
+  }
+
+  MeshOptimizer::computeRatios(meshStats.before);
+  MeshOptimizer::computeRatios(meshStats.after);
+
+  return meshStats;
+}
+
+} // namespace Raz
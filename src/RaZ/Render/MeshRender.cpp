@@ -53,6 +53,11 @@ void Mesh::setRenderMode(RenderMode renderMode) {
     submesh.setRenderMode(renderMode);
 }
 
+void Mesh::setVertexLayout(const VertexLayout& layout) {
+  for (Submesh& submesh : m_submeshes)
+    submesh.setVertexLayout(layout);
+}
+
 void Mesh::setMaterial(MaterialPtr material) {
   m_materials.clear();
   m_materials.emplace_back(std::move(material));
@@ -83,6 +88,60 @@ void Mesh::setMaterial(MaterialPreset materialPreset, float roughnessFactor) {
   }
 }
 
+void Mesh::selectLods(const Mat4f& modelViewMatrix, const Mat4f& projectionMatrix, unsigned int viewportHeight, float maxScreenError, float hysteresis) {
+  assert("Error: The LOD hysteresis must be between 0 & 1." && hysteresis >= 0.f && hysteresis <= 1.f);
+
+  // A perspective projection divides by the depth, its last column being (0, 0, 1, 0), while an orthographic one keeps it to (0, 0, 0, 1)
+  const bool isPerspective = (projectionMatrix.getElement(3, 3) == 0.f);
+  // Number of pixels covered by a unit length, at a unit distance if the projection is a perspective one
+  const float pixelsPerUnit = projectionMatrix.getElement(1, 1) * static_cast<float>(viewportHeight) * 0.5f;
+
+  // Distances are scaled by the largest scale of the transformation
+  float squaredScale = 0.f;
+
+  for (std::size_t rowIndex = 0; rowIndex < 3; ++rowIndex) {
+    const Vec3f axis(modelViewMatrix.getElement(0, rowIndex), modelViewMatrix.getElement(1, rowIndex), modelViewMatrix.getElement(2, rowIndex));
+    squaredScale = std::max(squaredScale, axis.computeSquaredLength());
+  }
+
+  const float scale = std::sqrt(squaredScale);
+
+  for (Submesh& submesh : m_submeshes) {
+    if (submesh.getLods().empty())
+      continue;
+
+    float errorScale = scale * pixelsPerUnit;
+
+    if (isPerspective) {
+      // The error is projected at the distance of the closest point of the submesh's bounding sphere
+      const AABB& boundingBox = submesh.getBoundingBox();
+      const Vec4f center      = Vec4f((boundingBox.getLeftBottomBackPos() + boundingBox.getRightTopFrontPos()) * 0.5f, 1.f) * modelViewMatrix;
+      const float radius      = (boundingBox.getRightTopFrontPos() - boundingBox.getLeftBottomBackPos()).computeLength() * 0.5f * scale;
+      const float distance    = Vec3f(center.x(), center.y(), center.z()).computeLength() - radius;
+
+      if (distance <= 0.f) {
+        submesh.setLodIndex(0);
+        continue;
+      }
+
+      errorScale /= distance;
+    }
+
+    const auto computeScreenError = [&submesh, errorScale] (std::size_t lodIndex) { return submesh.getLodError(lodIndex) * errorScale; };
+    std::size_t lodIndex = submesh.getLodIndex();
+
+    if (computeScreenError(lodIndex) > maxScreenError) {
+      while (lodIndex > 0 && computeScreenError(lodIndex) > maxScreenError)
+        --lodIndex;
+    } else {
+      while (lodIndex < submesh.getLods().size() && computeScreenError(lodIndex + 1) <= maxScreenError * (1.f - hysteresis))
+        ++lodIndex;
+    }
+
+    submesh.setLodIndex(lodIndex);
+  }
+}
+
 void Mesh::load() const {
   for (const Submesh& submesh : m_submeshes)
     submesh.load();
@@ -111,6 +170,7 @@ void Mesh::draw(const ShaderProgram& program) const {
         material->bindAttributes(program);
     }
 
+    submesh.sendVertexFormat(program);
     submesh.draw();
   }
 }
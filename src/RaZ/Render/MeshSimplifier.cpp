@@ -0,0 +1,697 @@
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/MeshOptimizer.hpp"
+#include "RaZ/Render/MeshSimplifier.hpp"
+#include "RaZ/Utils/IndexMap.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+namespace Raz::MeshSimplifier {
+
+namespace {
+
+constexpr unsigned int invalidIndex = std::numeric_limits<unsigned int>::max();
+
+enum class VertexKind : uint8_t {
+  MANIFOLD, // Inside a continuous surface, collapsible onto any of its neighbours
+  BORDER,   // On an open border, only collapsible along it
+  SEAM,     // Duplicated along a UV or normal seam, only collapsible along it together with its counterpart
+  LOCKED    // Never collapsed
+};
+
+enum VertexFlag : uint8_t {
+  BORDER_FLAG  = 1, // Has an edge with no opposite one
+  SEAM_FLAG    = 2, // Has an edge whose opposite one is made of other vertices at the same positions
+  COMPLEX_FLAG = 4  // Has an edge shared by more than 2 triangles
+};
+
+// Both zeros being equal, they must give the same bits to be hashed identically
+inline uint32_t recoverBits(float value) noexcept {
+  if (value == 0.f)
+    value = 0.f;
+
+  uint32_t bits {};
+  std::memcpy(&bits, &value, sizeof(float));
+  return bits;
+}
+
+constexpr uint64_t mixHash(uint64_t value) noexcept {
+  // The map using the lowest bits of the hash, the highest ones are folded onto them
+  const uint64_t hash = value * 0x9E3779B97F4A7C15ull;
+  return hash ^ (hash >> 32);
+}
+
+// Hashes & compares vertices through their index according to their position only
+struct PositionHasher {
+  const Vertex* vertices {};
+
+  uint64_t operator()(unsigned int vertexIndex) const noexcept {
+    const Vec3f& position = vertices[vertexIndex].position;
+    return mixHash(mixHash(mixHash(recoverBits(position.x())) ^ recoverBits(position.y())) ^ recoverBits(position.z()));
+  }
+};
+
+struct PositionEqual {
+  const Vertex* vertices {};
+
+  bool operator()(unsigned int firstIndex, unsigned int secondIndex) const noexcept {
+    return vertices[firstIndex].position.strictlyEquals(vertices[secondIndex].position);
+  }
+};
+
+struct EdgeHasher {
+  uint64_t operator()(uint64_t edgeKey) const noexcept { return mixHash(edgeKey); }
+};
+
+constexpr uint64_t computeEdgeKey(unsigned int firstIndex, unsigned int secondIndex) noexcept {
+  return ((static_cast<uint64_t>(firstIndex) << 32) | secondIndex);
+}
+
+// Quadric error metric, giving the sum of the squared distances of a point to a set of planes, each weighted by the area it comes from
+struct Quadric {
+  double a00 = 0.0, a11 = 0.0, a22 = 0.0, a01 = 0.0, a02 = 0.0, a12 = 0.0;
+  double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+  double c = 0.0;
+  double weight = 0.0;
+
+  static Quadric fromPlane(const Vec3f& normal, float distance, double weight) noexcept {
+    const auto normalX = static_cast<double>(normal.x());
+    const auto normalY = static_cast<double>(normal.y());
+    const auto normalZ = static_cast<double>(normal.z());
+    const auto dist    = static_cast<double>(distance);
+
+    Quadric quadric;
+    quadric.a00    = weight * normalX * normalX;
+    quadric.a11    = weight * normalY * normalY;
+    quadric.a22    = weight * normalZ * normalZ;
+    quadric.a01    = weight * normalX * normalY;
+    quadric.a02    = weight * normalX * normalZ;
+    quadric.a12    = weight * normalY * normalZ;
+    quadric.b0     = weight * normalX * dist;
+    quadric.b1     = weight * normalY * dist;
+    quadric.b2     = weight * normalZ * dist;
+    quadric.c      = weight * dist * dist;
+    quadric.weight = weight;
+
+    return quadric;
+  }
+
+  Quadric& operator+=(const Quadric& quadric) noexcept {
+    a00 += quadric.a00; a11 += quadric.a11; a22 += quadric.a22;
+    a01 += quadric.a01; a02 += quadric.a02; a12 += quadric.a12;
+    b0  += quadric.b0;  b1  += quadric.b1;  b2  += quadric.b2;
+    c   += quadric.c;
+    weight += quadric.weight;
+
+    return *this;
+  }
+
+  /// Computes the mean squared distance of the given point to the planes, weighted by their area.
+  double computeError(const Vec3f& point) const noexcept {
+    if (weight <= 0.0)
+      return 0.0;
+
+    const auto x = static_cast<double>(point.x());
+    const auto y = static_cast<double>(point.y());
+    const auto z = static_cast<double>(point.z());
+
+    const double error = x * (a00 * x + a01 * y + a02 * z)
+                       + y * (a01 * x + a11 * y + a12 * z)
+                       + z * (a02 * x + a12 * y + a22 * z)
+                       + 2.0 * (b0 * x + b1 * y + b2 * z)
+                       + c;
+
+    return std::abs(error) / weight;
+  }
+};
+
+struct Collapse {
+  unsigned int fromIndex {};
+  unsigned int toIndex {};
+  unsigned int seamFromIndex = invalidIndex; // Counterparts of the vertices on the other side of a seam, if collapsing along one
+  unsigned int seamToIndex   = invalidIndex;
+  double cost {};                            // Geometric error, to which the attributes' differences are added
+  double error {};                           // Mean squared distance of the kept vertex to the planes merged into it
+};
+
+// Collapses edges by passes: the candidate collapses are sorted by cost, then as many as possible are applied, skipping those touching
+//  the triangles already modified during the pass
+class Simplifier {
+public:
+  Simplifier(const std::vector<Vertex>& vertices, std::vector<unsigned int> indices, const SimplificationSettings& settings);
+
+  std::vector<unsigned int>& getIndices() noexcept { return m_indices; }
+  std::size_t getTriangleCount() const noexcept { return m_indices.size() / 3; }
+
+  /// Recovers the highest geometric error of the collapses applied so far.
+  /// \return Error, as a distance.
+  float recoverError() const noexcept { return static_cast<float>(std::sqrt(m_error)); }
+  /// Collapses edges until the number of triangles is reached, or until no edge can be collapsed within the maximum error.
+  /// \param targetTriangleCount Number of triangles to be reached.
+  void simplify(std::size_t targetTriangleCount) {
+    while (getTriangleCount() > targetTriangleCount && collapseEdges(targetTriangleCount));
+  }
+
+private:
+  bool hasIndexEdge(unsigned int firstIndex, unsigned int secondIndex) const {
+    return (m_indexEdges.find(computeEdgeKey(firstIndex, secondIndex)) != invalidIndex);
+  }
+  bool hasPositionEdge(unsigned int firstPosIndex, unsigned int secondPosIndex) const {
+    return (m_positionEdges.find(computeEdgeKey(firstPosIndex, secondPosIndex)) != invalidIndex);
+  }
+  // An open edge in the index buffer is either on a border or on a seam
+  bool isOpenIndexEdge(unsigned int firstIndex, unsigned int secondIndex) const {
+    return (hasIndexEdge(firstIndex, secondIndex) != hasIndexEdge(secondIndex, firstIndex));
+  }
+
+  void removeDegenerateTriangles();
+  void addBorderQuadrics();
+  void analyzeTopology();
+  bool findCollapse(unsigned int fromIndex, unsigned int toIndex, Collapse& collapse) const;
+  bool checkTriangles(const Collapse& collapse, std::size_t& collapsedTriangleCount) const;
+  bool collapseEdges(std::size_t targetTriangleCount);
+
+  const std::vector<Vertex>& m_vertices;
+  std::vector<unsigned int> m_indices {};
+  SimplificationSettings m_settings {};
+  double m_maxError {};                      // Maximum mean squared distance allowed
+  double m_error {};
+
+  std::vector<unsigned int> m_positionIndices {}; // Index of each vertex's unique position
+  std::vector<Quadric> m_quadrics {};             // Quadric of each unique position
+
+  // Topology of the current triangles, analyzed on each pass
+  IndexMap<uint64_t, EdgeHasher> m_indexEdges {};
+  IndexMap<uint64_t, EdgeHasher> m_positionEdges {};
+  std::vector<unsigned int> m_positionEdgeCounts {};
+  std::vector<unsigned int> m_nextWedges {};      // Next vertex at the same position, forming circular lists; invalidIndex if not referenced
+  std::vector<VertexKind> m_vertexKinds {};
+  std::vector<unsigned int> m_adjacencyOffsets {};  // Offset of each unique position's triangles in the adjacent triangles
+  std::vector<unsigned int> m_adjacentTriangles {}; // Triangles adjacent to each unique position
+};
+
+Simplifier::Simplifier(const std::vector<Vertex>& vertices, std::vector<unsigned int> indices, const SimplificationSettings& settings)
+  : m_vertices{ vertices }, m_indices{ std::move(indices) }, m_settings{ settings } {
+  assert("Error: The number of indices must be a multiple of 3." && m_indices.size() % 3 == 0);
+
+  // Vertices sharing the same position are simplified together
+  IndexMap<unsigned int, PositionHasher, PositionEqual> positionMap(m_vertices.size(), PositionHasher{ m_vertices.data() }, PositionEqual{ m_vertices.data() });
+
+  m_positionIndices.resize(m_vertices.size());
+  for (std::size_t vertIndex = 0; vertIndex < m_vertices.size(); ++vertIndex)
+    m_positionIndices[vertIndex] = positionMap.emplace(static_cast<unsigned int>(vertIndex)).first;
+
+  removeDegenerateTriangles();
+
+  // The maximum error is relative to the size of the referenced vertices
+  Vec3f minPos(std::numeric_limits<float>::max());
+  Vec3f maxPos(std::numeric_limits<float>::lowest());
+
+  for (const unsigned int index : m_indices) {
+    for (std::size_t i = 0; i < 3; ++i) {
+      minPos[i] = std::min(minPos[i], m_vertices[index].position[i]);
+      maxPos[i] = std::max(maxPos[i], m_vertices[index].position[i]);
+    }
+  }
+
+  const double maxError = (m_indices.empty() ? 0.0 : static_cast<double>(m_settings.maxError * (maxPos - minPos).computeLength()));
+  m_maxError = maxError * maxError;
+
+  // Each position's quadric is made of the planes of all its adjacent triangles
+  m_quadrics.resize(positionMap.getKeyCount());
+
+  for (std::size_t firstIndex = 0; firstIndex < m_indices.size(); firstIndex += 3) {
+    const Vec3f& firstPos = m_vertices[m_indices[firstIndex]].position;
+    const Vec3f normal    = (m_vertices[m_indices[firstIndex + 1]].position - firstPos).cross(m_vertices[m_indices[firstIndex + 2]].position - firstPos);
+    const float normalLength = normal.computeLength();
+
+    if (normalLength <= 0.f)
+      continue;
+
+    const Vec3f planeNormal = normal / normalLength;
+    const Quadric quadric   = Quadric::fromPlane(planeNormal, -planeNormal.dot(firstPos), static_cast<double>(normalLength * 0.5f));
+
+    for (std::size_t i = 0; i < 3; ++i)
+      m_quadrics[m_positionIndices[m_indices[firstIndex + i]]] += quadric;
+  }
+
+  if (!m_settings.lockBorders)
+    addBorderQuadrics();
+}
+
+void Simplifier::removeDegenerateTriangles() {
+  std::size_t keptIndexCount = 0;
+
+  for (std::size_t firstIndex = 0; firstIndex < m_indices.size(); firstIndex += 3) {
+    const unsigned int firstPosIndex  = m_positionIndices[m_indices[firstIndex]];
+    const unsigned int secondPosIndex = m_positionIndices[m_indices[firstIndex + 1]];
+    const unsigned int thirdPosIndex  = m_positionIndices[m_indices[firstIndex + 2]];
+
+    if (firstPosIndex == secondPosIndex || firstPosIndex == thirdPosIndex || secondPosIndex == thirdPosIndex)
+      continue;
+
+    for (std::size_t i = 0; i < 3; ++i)
+      m_indices[keptIndexCount + i] = m_indices[firstIndex + i];
+
+    keptIndexCount += 3;
+  }
+
+  m_indices.resize(keptIndexCount);
+}
+
+void Simplifier::addBorderQuadrics() {
+  analyzeTopology();
+
+  // Border edges are kept in place by planes perpendicular to their triangle
+  for (std::size_t firstIndex = 0; firstIndex < m_indices.size(); firstIndex += 3) {
+    const Vec3f& firstPos = m_vertices[m_indices[firstIndex]].position;
+    const Vec3f normal    = (m_vertices[m_indices[firstIndex + 1]].position - firstPos).cross(m_vertices[m_indices[firstIndex + 2]].position - firstPos);
+
+    for (std::size_t i = 0; i < 3; ++i) {
+      const unsigned int startPosIndex = m_positionIndices[m_indices[firstIndex + i]];
+      const unsigned int endPosIndex   = m_positionIndices[m_indices[firstIndex + (i + 1) % 3]];
+
+      if (hasPositionEdge(endPosIndex, startPosIndex))
+        continue;
+
+      const Vec3f& startPos  = m_vertices[m_indices[firstIndex + i]].position;
+      const Vec3f edge       = m_vertices[m_indices[firstIndex + (i + 1) % 3]].position - startPos;
+      const Vec3f edgeNormal = edge.cross(normal);
+      const float edgeNormalLength = edgeNormal.computeLength();
+
+      if (edgeNormalLength <= 0.f)
+        continue;
+
+      const Vec3f planeNormal = edgeNormal / edgeNormalLength;
+      const Quadric quadric   = Quadric::fromPlane(planeNormal, -planeNormal.dot(startPos), static_cast<double>(edge.computeSquaredLength()));
+
+      m_quadrics[startPosIndex] += quadric;
+      m_quadrics[endPosIndex]   += quadric;
+    }
+  }
+}
+
+void Simplifier::analyzeTopology() {
+  m_indexEdges.clear();
+  m_positionEdges.clear();
+  m_positionEdgeCounts.clear();
+
+  for (std::size_t firstIndex = 0; firstIndex < m_indices.size(); firstIndex += 3) {
+    for (std::size_t i = 0; i < 3; ++i) {
+      const unsigned int startIndex = m_indices[firstIndex + i];
+      const unsigned int endIndex   = m_indices[firstIndex + (i + 1) % 3];
+
+      m_indexEdges.emplace(computeEdgeKey(startIndex, endIndex));
+
+      const auto [edgeIndex, inserted] = m_positionEdges.emplace(computeEdgeKey(m_positionIndices[startIndex], m_positionIndices[endIndex]));
+
+      if (inserted)
+        m_positionEdgeCounts.push_back(0);
+
+      ++m_positionEdgeCounts[edgeIndex];
+    }
+  }
+
+  // Linking the referenced vertices sharing a same position
+
+  const std::size_t positionCount = m_quadrics.size();
+
+  std::vector<unsigned int> firstWedges(positionCount, invalidIndex);
+  std::vector<unsigned int> wedgeCounts(positionCount, 0);
+  m_nextWedges.assign(m_vertices.size(), invalidIndex);
+
+  for (const unsigned int index : m_indices) {
+    if (m_nextWedges[index] != invalidIndex)
+      continue;
+
+    const unsigned int posIndex = m_positionIndices[index];
+
+    if (firstWedges[posIndex] == invalidIndex) {
+      firstWedges[posIndex] = index;
+      m_nextWedges[index]   = index;
+    } else {
+      m_nextWedges[index] = m_nextWedges[firstWedges[posIndex]];
+      m_nextWedges[firstWedges[posIndex]] = index;
+    }
+
+    ++wedgeCounts[posIndex];
+  }
+
+  // Classifying the vertices from the edges they belong to
+
+  std::vector<uint8_t> vertexFlags(m_vertices.size(), 0);
+
+  for (std::size_t firstIndex = 0; firstIndex < m_indices.size(); firstIndex += 3) {
+    for (std::size_t i = 0; i < 3; ++i) {
+      const unsigned int startIndex    = m_indices[firstIndex + i];
+      const unsigned int endIndex      = m_indices[firstIndex + (i + 1) % 3];
+      const unsigned int startPosIndex = m_positionIndices[startIndex];
+      const unsigned int endPosIndex   = m_positionIndices[endIndex];
+
+      uint8_t edgeFlags = 0;
+
+      if (m_positionEdgeCounts[m_positionEdges.find(computeEdgeKey(startPosIndex, endPosIndex))] > 1)
+        edgeFlags |= COMPLEX_FLAG;
+
+      if (!hasPositionEdge(endPosIndex, startPosIndex))
+        edgeFlags |= BORDER_FLAG;
+      else if (!hasIndexEdge(endIndex, startIndex))
+        edgeFlags |= SEAM_FLAG;
+
+      vertexFlags[startIndex] |= edgeFlags;
+      vertexFlags[endIndex]   |= edgeFlags;
+    }
+  }
+
+  m_vertexKinds.assign(m_vertices.size(), VertexKind::LOCKED);
+
+  for (std::size_t vertIndex = 0; vertIndex < m_vertices.size(); ++vertIndex) {
+    if (m_nextWedges[vertIndex] == invalidIndex)
+      continue;
+
+    const uint8_t flags          = vertexFlags[vertIndex];
+    const unsigned int wedgeCount = wedgeCounts[m_positionIndices[vertIndex]];
+
+    // Only seams between 2 vertices can be followed; borders are either locked or made of unique vertices
+    if (flags & COMPLEX_FLAG)
+      m_vertexKinds[vertIndex] = VertexKind::LOCKED;
+    else if (flags & BORDER_FLAG)
+      m_vertexKinds[vertIndex] = (m_settings.lockBorders || wedgeCount > 1 ? VertexKind::LOCKED : VertexKind::BORDER);
+    else if (flags & SEAM_FLAG)
+      m_vertexKinds[vertIndex] = (wedgeCount == 2 ? VertexKind::SEAM : VertexKind::LOCKED);
+    else
+      m_vertexKinds[vertIndex] = (wedgeCount == 1 ? VertexKind::MANIFOLD : VertexKind::LOCKED);
+  }
+
+  // Listing the triangles adjacent to each position
+
+  m_adjacencyOffsets.assign(positionCount + 1, 0);
+
+  for (const unsigned int index : m_indices)
+    ++m_adjacencyOffsets[m_positionIndices[index] + 1];
+
+  std::partial_sum(m_adjacencyOffsets.cbegin(), m_adjacencyOffsets.cend(), m_adjacencyOffsets.begin());
+
+  std::vector<unsigned int> adjacencyCounts(positionCount, 0);
+  m_adjacentTriangles.resize(m_indices.size());
+
+  for (std::size_t index = 0; index < m_indices.size(); ++index) {
+    const unsigned int posIndex = m_positionIndices[m_indices[index]];
+    m_adjacentTriangles[m_adjacencyOffsets[posIndex] + adjacencyCounts[posIndex]++] = static_cast<unsigned int>(index / 3);
+  }
+}
+
+bool Simplifier::findCollapse(unsigned int fromIndex, unsigned int toIndex, Collapse& collapse) const {
+  const VertexKind fromKind = m_vertexKinds[fromIndex];
+  const VertexKind toKind   = m_vertexKinds[toIndex];
+
+  const unsigned int fromPosIndex = m_positionIndices[fromIndex];
+  const unsigned int toPosIndex   = m_positionIndices[toIndex];
+
+  unsigned int seamFromIndex = invalidIndex;
+  unsigned int seamToIndex   = invalidIndex;
+
+  switch (fromKind) {
+    case VertexKind::MANIFOLD:
+      break;
+
+    case VertexKind::BORDER:
+      // Border vertices can only move along their border
+      if ((toKind != VertexKind::BORDER && toKind != VertexKind::LOCKED) || hasPositionEdge(fromPosIndex, toPosIndex) == hasPositionEdge(toPosIndex, fromPosIndex))
+        return false;
+      break;
+
+    case VertexKind::SEAM:
+    {
+      // Seam vertices can only move along their seam, along with their counterpart on the other side
+      if ((toKind != VertexKind::SEAM && toKind != VertexKind::LOCKED) || !isOpenIndexEdge(fromIndex, toIndex))
+        return false;
+
+      seamFromIndex = m_nextWedges[fromIndex];
+
+      if (m_vertexKinds[seamFromIndex] != VertexKind::SEAM)
+        return false;
+
+      unsigned int wedgeIndex = toIndex;
+
+      do {
+        if (isOpenIndexEdge(seamFromIndex, wedgeIndex)) {
+          seamToIndex = wedgeIndex;
+          break;
+        }
+
+        wedgeIndex = m_nextWedges[wedgeIndex];
+      } while (wedgeIndex != toIndex);
+
+      if (seamToIndex == invalidIndex)
+        return false;
+
+      break;
+    }
+
+    case VertexKind::LOCKED:
+    default:
+      return false;
+  }
+
+  Quadric quadric = m_quadrics[fromPosIndex];
+  quadric += m_quadrics[toPosIndex];
+
+  const Vertex& fromVertex = m_vertices[fromIndex];
+  const Vertex& toVertex   = m_vertices[toIndex];
+
+  const auto computeAttributeDifference = [this] (unsigned int firstIndex, unsigned int secondIndex) {
+    const Vertex& firstVert  = m_vertices[firstIndex];
+    const Vertex& secondVert = m_vertices[secondIndex];
+
+    return (firstVert.normal - secondVert.normal).computeSquaredLength() * 0.25f + (firstVert.texcoords - secondVert.texcoords).computeSquaredLength();
+  };
+
+  float attributeDifference = computeAttributeDifference(fromIndex, toIndex);
+
+  if (seamFromIndex != invalidIndex)
+    attributeDifference = std::max(attributeDifference, computeAttributeDifference(seamFromIndex, seamToIndex));
+
+  // Attributes' differences are scaled by the edge's length, moving a vertex farther altering them over a larger area
+  const float edgeSquaredLength = (toVertex.position - fromVertex.position).computeSquaredLength();
+
+  collapse.fromIndex     = fromIndex;
+  collapse.toIndex       = toIndex;
+  collapse.seamFromIndex = seamFromIndex;
+  collapse.seamToIndex   = seamToIndex;
+  collapse.error         = quadric.computeError(toVertex.position);
+  collapse.cost          = collapse.error + static_cast<double>(m_settings.attributeWeight * edgeSquaredLength * attributeDifference);
+
+  return true;
+}
+
+bool Simplifier::checkTriangles(const Collapse& collapse, std::size_t& collapsedTriangleCount) const {
+  const unsigned int fromPosIndex = m_positionIndices[collapse.fromIndex];
+  const unsigned int toPosIndex   = m_positionIndices[collapse.toIndex];
+  const Vec3f& newPos             = m_vertices[collapse.toIndex].position;
+
+  collapsedTriangleCount = 0;
+
+  for (unsigned int adjacencyIndex = m_adjacencyOffsets[fromPosIndex]; adjacencyIndex < m_adjacencyOffsets[fromPosIndex + 1]; ++adjacencyIndex) {
+    const std::size_t firstIndex = m_adjacentTriangles[adjacencyIndex] * 3;
+
+    std::array<Vec3f, 3> positions {};
+    std::array<Vec3f, 3> newPositions {};
+    bool isCollapsed = false;
+
+    for (std::size_t i = 0; i < 3; ++i) {
+      const unsigned int index    = m_indices[firstIndex + i];
+      const unsigned int posIndex = m_positionIndices[index];
+
+      isCollapsed     = isCollapsed || (posIndex == toPosIndex);
+      positions[i]    = m_vertices[index].position;
+      newPositions[i] = (posIndex == fromPosIndex ? newPos : positions[i]);
+    }
+
+    // Triangles sharing the collapsed edge disappear
+    if (isCollapsed) {
+      ++collapsedTriangleCount;
+      continue;
+    }
+
+    const Vec3f normal    = (positions[1] - positions[0]).cross(positions[2] - positions[0]);
+    const Vec3f newNormal = (newPositions[1] - newPositions[0]).cross(newPositions[2] - newPositions[0]);
+
+    if (normal.dot(newNormal) <= 0.f && normal.computeSquaredLength() > 0.f)
+      return false;
+  }
+
+  return true;
+}
+
+bool Simplifier::collapseEdges(std::size_t targetTriangleCount) {
+  analyzeTopology();
+
+  std::vector<Collapse> collapses;
+  collapses.reserve(m_indices.size());
+
+  for (std::size_t firstIndex = 0; firstIndex < m_indices.size(); firstIndex += 3) {
+    for (std::size_t i = 0; i < 3; ++i) {
+      const unsigned int startIndex = m_indices[firstIndex + i];
+      const unsigned int endIndex   = m_indices[firstIndex + (i + 1) % 3];
+
+      // Edges shared by 2 triangles are only considered once
+      if (startIndex > endIndex && hasIndexEdge(endIndex, startIndex))
+        continue;
+
+      // Keeping the cheapest direction
+      Collapse collapse {};
+      Collapse reverseCollapse {};
+      const bool isCollapsible        = findCollapse(startIndex, endIndex, collapse);
+      const bool isReverseCollapsible = findCollapse(endIndex, startIndex, reverseCollapse);
+
+      if (isReverseCollapsible && (!isCollapsible || reverseCollapse.cost < collapse.cost))
+        collapses.push_back(reverseCollapse);
+      else if (isCollapsible)
+        collapses.push_back(collapse);
+    }
+  }
+
+  std::sort(collapses.begin(), collapses.end(), [] (const Collapse& firstCollapse, const Collapse& secondCollapse) {
+    return (firstCollapse.cost < secondCollapse.cost);
+  });
+
+  const std::size_t triangleCountToRemove = getTriangleCount() - targetTriangleCount;
+  std::size_t removedTriangleCount        = 0;
+  std::size_t appliedCollapseCount        = 0;
+
+  std::vector<unsigned int> collapseRemap(m_vertices.size());
+  std::iota(collapseRemap.begin(), collapseRemap.end(), 0);
+
+  std::vector<bool> lockedPositions(m_quadrics.size(), false);
+
+  for (const Collapse& collapse : collapses) {
+    if (removedTriangleCount >= triangleCountToRemove)
+      break;
+
+    if (collapse.error > m_maxError)
+      continue;
+
+    const unsigned int fromPosIndex = m_positionIndices[collapse.fromIndex];
+    const unsigned int toPosIndex   = m_positionIndices[collapse.toIndex];
+
+    if (lockedPositions[fromPosIndex] || lockedPositions[toPosIndex])
+      continue;
+
+    std::size_t collapsedTriangleCount {};
+    if (!checkTriangles(collapse, collapsedTriangleCount))
+      continue;
+
+    // The triangles around the collapsed vertex are modified; none of their vertices can be collapsed again during this pass
+    for (unsigned int adjacencyIndex = m_adjacencyOffsets[fromPosIndex]; adjacencyIndex < m_adjacencyOffsets[fromPosIndex + 1]; ++adjacencyIndex) {
+      const std::size_t firstIndex = m_adjacentTriangles[adjacencyIndex] * 3;
+
+      for (std::size_t i = 0; i < 3; ++i)
+        lockedPositions[m_positionIndices[m_indices[firstIndex + i]]] = true;
+    }
+
+    collapseRemap[collapse.fromIndex] = collapse.toIndex;
+
+    if (collapse.seamFromIndex != invalidIndex)
+      collapseRemap[collapse.seamFromIndex] = collapse.seamToIndex;
+
+    m_quadrics[toPosIndex] += m_quadrics[fromPosIndex];
+    m_error = std::max(m_error, collapse.error);
+
+    removedTriangleCount += collapsedTriangleCount;
+    ++appliedCollapseCount;
+  }
+
+  if (appliedCollapseCount == 0)
+    return false;
+
+  for (unsigned int& index : m_indices)
+    index = collapseRemap[index];
+
+  removeDegenerateTriangles();
+
+  return true;
+}
+
+} // namespace
+
+SimplificationResult simplify(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, std::size_t targetTriangleCount,
+                              const SimplificationSettings& settings) {
+  Simplifier simplifier(vertices, indices, settings);
+  simplifier.simplify(targetTriangleCount);
+
+  SimplificationResult result;
+  result.indices = std::move(simplifier.getIndices());
+  result.error   = simplifier.recoverError();
+
+  return result;
+}
+
+std::vector<SubmeshLod> generateLods(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+                                     const std::vector<float>& triangleRatios, const SimplificationSettings& settings) {
+  const std::size_t triangleCount = indices.size() / 3;
+
+  std::vector<SubmeshLod> lods;
+  lods.reserve(triangleRatios.size());
+
+  // Each level continues the simplification of the previous one, their errors accumulating
+  Simplifier simplifier(vertices, indices, settings);
+
+  for (const float triangleRatio : triangleRatios) {
+    assert("Error: The triangle ratios must be between 0 & 1." && triangleRatio >= 0.f && triangleRatio <= 1.f);
+
+    const std::size_t prevTriangleCount = (lods.empty() ? triangleCount : lods.back().triangleIndices.size() / 3);
+    simplifier.simplify(static_cast<std::size_t>(std::ceil(static_cast<float>(triangleCount) * triangleRatio)));
+
+    // If the level cannot be simplified further, no less detailed one can be generated
+    if (simplifier.getTriangleCount() >= prevTriangleCount)
+      break;
+
+    SubmeshLod& lod     = lods.emplace_back();
+    lod.triangleIndices = simplifier.getIndices();
+    lod.error           = simplifier.recoverError();
+
+    MeshOptimizer::optimizeVertexCache(lod.triangleIndices, vertices.size());
+  }
+
+  return lods;
+}
+
+void generateLods(Submesh& submesh, const std::vector<float>& triangleRatios, const SimplificationSettings& settings) {
+  submesh.getLods().clear();
+  submesh.setLodIndex(0);
+
+  if (submesh.getRenderMode() != RenderMode::TRIANGLE)
+    return;
+
+  submesh.getLods() = generateLods(submesh.getVertices(), submesh.getTriangleIndices(), triangleRatios, settings);
+
+  // The levels are selected according to the size of the bounding box on screen
+  submesh.computeBoundingBox();
+}
+
+} // namespace Raz::MeshSimplifier
+
+namespace Raz {
+
+void Mesh::generateLods(const std::vector<float>& triangleRatios, const MeshSimplifier::SimplificationSettings& settings) {
+  const auto generateSubmeshesLods = [this, &triangleRatios, &settings] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t submeshIndex = beginIndex; submeshIndex < endIndex; ++submeshIndex)
+      MeshSimplifier::generateLods(m_submeshes[submeshIndex], triangleRatios, settings);
+  };
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (m_submeshes.size() > 1)
+    Threading::parallelize(m_submeshes, [&generateSubmeshesLods] (Threading::IndexRange range) { generateSubmeshesLods(range.beginIndex, range.endIndex); });
+  else
+#endif
+    generateSubmeshesLods(0, m_submeshes.size());
+}
+
+} // namespace Raz
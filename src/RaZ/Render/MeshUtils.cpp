@@ -0,0 +1,264 @@
+#include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Render/MeshUtils.hpp"
+#include "RaZ/Utils/IndexMap.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace Raz::MeshUtils {
+
+namespace {
+
+constexpr unsigned int invalidIndex = std::numeric_limits<unsigned int>::max();
+
+// Both zeros being equal, they must give the same bits to be hashed identically
+inline uint32_t recoverBits(float value) noexcept {
+  if (value == 0.f)
+    value = 0.f;
+
+  uint32_t bits {};
+  std::memcpy(&bits, &value, sizeof(float));
+  return bits;
+}
+
+constexpr uint64_t combineHash(uint64_t hash, uint64_t value) noexcept {
+  return (hash ^ value) * 0x9E3779B97F4A7C15ull;
+}
+
+constexpr uint64_t finalizeHash(uint64_t hash) noexcept {
+  // The map using the lowest bits of the hash, the highest ones are folded onto them
+  return hash ^ (hash >> 32);
+}
+
+template <std::size_t Size>
+inline uint64_t hashVector(uint64_t hash, const Vector<float, Size>& vec) noexcept {
+  for (std::size_t i = 0; i < Size; ++i)
+    hash = combineHash(hash, recoverBits(vec[i]));
+
+  return hash;
+}
+
+// Hashes & compares vertices through their index, avoiding copying them into the map
+struct VertexHasher {
+  const Vertex* vertices {};
+
+  uint64_t operator()(unsigned int vertexIndex) const noexcept {
+    const Vertex& vertex = vertices[vertexIndex];
+
+    uint64_t hash = hashVector(0, vertex.position);
+    hash = hashVector(hash, vertex.texcoords);
+    hash = hashVector(hash, vertex.normal);
+    hash = hashVector(hash, vertex.tangent);
+
+    return finalizeHash(hash);
+  }
+};
+
+struct VertexEqual {
+  const Vertex* vertices {};
+
+  bool operator()(unsigned int firstIndex, unsigned int secondIndex) const noexcept {
+    const Vertex& firstVert  = vertices[firstIndex];
+    const Vertex& secondVert = vertices[secondIndex];
+
+    return firstVert.position.strictlyEquals(secondVert.position)
+        && firstVert.texcoords.strictlyEquals(secondVert.texcoords)
+        && firstVert.normal.strictlyEquals(secondVert.normal)
+        && firstVert.tangent.strictlyEquals(secondVert.tangent);
+  }
+};
+
+using GridCell = std::array<int64_t, 3>;
+
+struct GridCellHasher {
+  uint64_t operator()(const GridCell& cell) const noexcept {
+    uint64_t hash = combineHash(0, static_cast<uint64_t>(cell[0]));
+    hash = combineHash(hash, static_cast<uint64_t>(cell[1]));
+    hash = combineHash(hash, static_cast<uint64_t>(cell[2]));
+
+    return finalizeHash(hash);
+  }
+};
+
+template <std::size_t Size>
+inline bool areWithinTolerance(const Vector<float, Size>& firstVec, const Vector<float, Size>& secondVec, float tolerance) noexcept {
+  if (tolerance == 0.f)
+    return firstVec.strictlyEquals(secondVec);
+
+  return ((firstVec - secondVec).computeSquaredLength() <= tolerance * tolerance);
+}
+
+inline bool areWithinTolerances(const Vertex& firstVert, const Vertex& secondVert, const WeldingTolerances& tolerances) noexcept {
+  return areWithinTolerance(firstVert.position, secondVert.position, tolerances.position)
+      && areWithinTolerance(firstVert.texcoords, secondVert.texcoords, tolerances.texcoords)
+      && areWithinTolerance(firstVert.normal, secondVert.normal, tolerances.normal)
+      && areWithinTolerance(firstVert.tangent, secondVert.tangent, tolerances.tangent);
+}
+
+VertexRemap computeExactRemap(const std::vector<Vertex>& vertices) {
+  VertexRemap remap;
+  remap.indices.resize(vertices.size());
+
+  IndexMap<unsigned int, VertexHasher, VertexEqual> vertexMap(vertices.size(), VertexHasher{ vertices.data() }, VertexEqual{ vertices.data() });
+
+  for (std::size_t vertIndex = 0; vertIndex < vertices.size(); ++vertIndex)
+    remap.indices[vertIndex] = vertexMap.emplace(static_cast<unsigned int>(vertIndex)).first;
+
+  remap.uniqueVertexCount = vertexMap.getKeyCount();
+  return remap;
+}
+
+VertexRemap computeWeldingRemap(const std::vector<Vertex>& vertices, const WeldingTolerances& tolerances) {
+  // Vertices are sorted into a sparse grid whose cells have the size of the position tolerance: a vertex can then only be merged with those
+  //   from its own & neighbouring cells. If positions must be strictly equal, cells directly correspond to them & have no neighbour to be checked
+  const bool hasPositionTolerance = (tolerances.position > 0.f);
+  const double invCellSize        = (hasPositionTolerance ? 1.0 / static_cast<double>(tolerances.position) : 0.0);
+  const int64_t neighbourRange    = (hasPositionTolerance ? 1 : 0);
+
+  const auto computeCell = [hasPositionTolerance, invCellSize] (const Vec3f& position) {
+    if (!hasPositionTolerance)
+      return GridCell{ recoverBits(position[0]), recoverBits(position[1]), recoverBits(position[2]) };
+
+    // Coordinates are clamped to keep the conversion defined for extremely small tolerances
+    constexpr double maxCoord = static_cast<double>(1ll << 62);
+    return GridCell{ static_cast<int64_t>(std::clamp(std::floor(static_cast<double>(position[0]) * invCellSize), -maxCoord, maxCoord)),
+                     static_cast<int64_t>(std::clamp(std::floor(static_cast<double>(position[1]) * invCellSize), -maxCoord, maxCoord)),
+                     static_cast<int64_t>(std::clamp(std::floor(static_cast<double>(position[2]) * invCellSize), -maxCoord, maxCoord)) };
+  };
+
+  VertexRemap remap;
+  remap.indices.resize(vertices.size());
+
+  IndexMap<GridCell, GridCellHasher> cellMap(vertices.size());
+  std::vector<unsigned int> cellFirstVertices; // Index of the last unique vertex added in each cell
+  std::vector<unsigned int> nextCellVertices;  // Index of the unique vertex added before each one in the same cell
+  std::vector<unsigned int> uniqueVertices;    // Index of the original vertex corresponding to each unique one
+
+  for (std::size_t vertIndex = 0; vertIndex < vertices.size(); ++vertIndex) {
+    const Vertex& vertex = vertices[vertIndex];
+
+    if (!std::isfinite(vertex.position[0]) || !std::isfinite(vertex.position[1]) || !std::isfinite(vertex.position[2])) {
+      // Such vertices can't be placed in the grid, & aren't equal to any other anyway
+      remap.indices[vertIndex] = static_cast<unsigned int>(uniqueVertices.size());
+      uniqueVertices.emplace_back(static_cast<unsigned int>(vertIndex));
+      nextCellVertices.emplace_back(invalidIndex);
+      continue;
+    }
+
+    const GridCell cell = computeCell(vertex.position);
+    unsigned int matchingIndex = invalidIndex;
+
+    for (int64_t zOffset = -neighbourRange; zOffset <= neighbourRange; ++zOffset) {
+      for (int64_t yOffset = -neighbourRange; yOffset <= neighbourRange; ++yOffset) {
+        for (int64_t xOffset = -neighbourRange; xOffset <= neighbourRange; ++xOffset) {
+          const unsigned int cellIndex = cellMap.find(GridCell{ cell[0] + xOffset, cell[1] + yOffset, cell[2] + zOffset });
+
+          if (cellIndex == invalidIndex)
+            continue;
+
+          // The first matching unique vertex is kept, so that the result doesn't depend on the cells' traversal order
+          for (unsigned int uniqueIndex = cellFirstVertices[cellIndex]; uniqueIndex != invalidIndex; uniqueIndex = nextCellVertices[uniqueIndex]) {
+            if (uniqueIndex < matchingIndex && areWithinTolerances(vertices[uniqueVertices[uniqueIndex]], vertex, tolerances))
+              matchingIndex = uniqueIndex;
+          }
+        }
+      }
+    }
+
+    if (matchingIndex == invalidIndex) {
+      matchingIndex = static_cast<unsigned int>(uniqueVertices.size());
+      uniqueVertices.emplace_back(static_cast<unsigned int>(vertIndex));
+
+      const auto [cellIndex, isNewCell] = cellMap.emplace(cell);
+
+      if (isNewCell)
+        cellFirstVertices.emplace_back(invalidIndex);
+
+      nextCellVertices.emplace_back(cellFirstVertices[cellIndex]);
+      cellFirstVertices[cellIndex] = matchingIndex;
+    }
+
+    remap.indices[vertIndex] = matchingIndex;
+  }
+
+  remap.uniqueVertexCount = uniqueVertices.size();
+  return remap;
+}
+
+} // namespace
+
+VertexRemap computeVertexRemap(const std::vector<Vertex>& vertices, const WeldingTolerances& tolerances) {
+  assert("Error: Welding tolerances must be positive." && tolerances.position >= 0.f && tolerances.texcoords >= 0.f
+                                                       && tolerances.normal >= 0.f && tolerances.tangent >= 0.f);
+  assert("Error: The number of vertices to be remapped exceeds the maximum index." && vertices.size() < invalidIndex);
+
+  if (tolerances.position == 0.f && tolerances.texcoords == 0.f && tolerances.normal == 0.f && tolerances.tangent == 0.f)
+    return computeExactRemap(vertices);
+
+  return computeWeldingRemap(vertices, tolerances);
+}
+
+std::vector<Vertex> remapVertices(const std::vector<Vertex>& vertices, const VertexRemap& remap) {
+  assert("Error: The remap table must have been computed from the given vertices." && remap.indices.size() == vertices.size());
+
+  std::vector<Vertex> uniqueVertices;
+  uniqueVertices.reserve(remap.uniqueVertexCount);
+
+  // Unique vertices being numbered in their order of appearance, each is the first one whose remapped index is the next expected
+  for (std::size_t vertIndex = 0; vertIndex < vertices.size(); ++vertIndex) {
+    if (remap.indices[vertIndex] == uniqueVertices.size())
+      uniqueVertices.emplace_back(vertices[vertIndex]);
+  }
+
+  return uniqueVertices;
+}
+
+void remapIndices(std::vector<unsigned int>& indices, const VertexRemap& remap) {
+  for (unsigned int& index : indices) {
+    assert("Error: The index to be remapped is out of bounds." && index < remap.indices.size());
+    index = remap.indices[index];
+  }
+}
+
+VertexRemap deduplicateVertices(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, const WeldingTolerances& tolerances) {
+  VertexRemap remap = computeVertexRemap(vertices, tolerances);
+
+  if (remap.uniqueVertexCount == vertices.size())
+    return remap;
+
+  vertices = remapVertices(vertices, remap);
+  remapIndices(indices, remap);
+
+  return remap;
+}
+
+std::size_t removeDegenerateTriangles(std::vector<unsigned int>& indices) {
+  assert("Error: Triangle indices must come by groups of 3." && indices.size() % 3 == 0);
+
+  std::size_t keptIndexCount = 0;
+
+  for (std::size_t triangleIndex = 0; triangleIndex < indices.size(); triangleIndex += 3) {
+    const unsigned int firstIndex  = indices[triangleIndex];
+    const unsigned int secondIndex = indices[triangleIndex + 1];
+    const unsigned int thirdIndex  = indices[triangleIndex + 2];
+
+    if (firstIndex == secondIndex || secondIndex == thirdIndex || thirdIndex == firstIndex)
+      continue;
+
+    indices[keptIndexCount]     = firstIndex;
+    indices[keptIndexCount + 1] = secondIndex;
+    indices[keptIndexCount + 2] = thirdIndex;
+    keptIndexCount += 3;
+  }
+
+  const std::size_t removedTriangleCount = (indices.size() - keptIndexCount) / 3;
+  indices.resize(keptIndexCount);
+
+  return removedTriangleCount;
+}
+
+} // namespace Raz::MeshUtils
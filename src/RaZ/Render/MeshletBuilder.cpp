@@ -0,0 +1,329 @@
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/MeshletBuilder.hpp"
+#include "RaZ/Render/MeshUtils.hpp"
+#include "RaZ/Utils/Frustum.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace Raz::MeshletBuilder {
+
+namespace {
+
+constexpr unsigned int invalidIndex = std::numeric_limits<unsigned int>::max();
+
+struct TrianglePlane {
+  Vec3f normal {};
+  Vec3f point {};
+};
+
+/// Computes the bounding sphere & the normal cone of a meshlet, whose triangles are given by the indices.
+void computeBounds(Meshlet& meshlet, const std::vector<Vertex>& vertices, const unsigned int* indices) {
+  const std::size_t indexCount = meshlet.triangleCount * 3;
+
+  // The sphere is centered on the box enclosing the triangles, reaching their farthest vertex
+  Vec3f minPos(std::numeric_limits<float>::max());
+  Vec3f maxPos(std::numeric_limits<float>::lowest());
+
+  for (std::size_t i = 0; i < indexCount; ++i) {
+    const Vec3f& position = vertices[indices[i]].position;
+
+    for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+      minPos[axisIndex] = std::min(minPos[axisIndex], position[axisIndex]);
+      maxPos[axisIndex] = std::max(maxPos[axisIndex], position[axisIndex]);
+    }
+  }
+
+  const Vec3f center  = (minPos + maxPos) * 0.5f;
+  float squaredRadius = 0.f;
+
+  for (std::size_t i = 0; i < indexCount; ++i)
+    squaredRadius = std::max(squaredRadius, (vertices[indices[i]].position - center).computeSquaredLength());
+
+  meshlet.boundingSphere = Sphere(center, std::sqrt(squaredRadius));
+
+  // The cone's axis is the average of the triangles' normals, its angle reaching the farthest one
+  std::vector<TrianglePlane> planes;
+  planes.reserve(meshlet.triangleCount);
+
+  Vec3f normalSum(0.f);
+
+  for (std::size_t firstIndex = 0; firstIndex < indexCount; firstIndex += 3) {
+    // Front faces being counter-clockwise in the left-handed view space, triangles face the opposite of (p2 - p1) x (p3 - p1), as do their normals
+    const Vec3f& firstPos = vertices[indices[firstIndex]].position;
+    const Vec3f normal    = (vertices[indices[firstIndex + 2]].position - firstPos).cross(vertices[indices[firstIndex + 1]].position - firstPos);
+    const float normalLength = normal.computeLength();
+
+    if (normalLength <= 0.f)
+      continue;
+
+    const TrianglePlane& plane = planes.emplace_back(TrianglePlane{ normal / normalLength, firstPos });
+    normalSum += plane.normal;
+  }
+
+  meshlet.coneApex   = center;
+  meshlet.coneAxis   = Vec3f(0.f);
+  meshlet.coneCutoff = 2.f;
+
+  const float normalSumLength = normalSum.computeLength();
+
+  if (normalSumLength <= 0.f)
+    return;
+
+  meshlet.coneAxis = normalSum / normalSumLength;
+
+  float minDot = 1.f;
+  for (const TrianglePlane& plane : planes)
+    minDot = std::min(minDot, plane.normal.dot(meshlet.coneAxis));
+
+  // If the normals spread over a hemisphere or more, some triangles are front facing from any point of view
+  if (minDot <= 0.f)
+    return;
+
+  // The apex is placed behind all the triangles' planes along the axis, so that a viewer seeing it in a direction close enough to the axis is
+  //  behind all the triangles. Each plane is crossed by the axis at a distance from the center of dot(center - point, normal) / dot(axis, normal)
+  float apexDistance = std::numeric_limits<float>::lowest();
+
+  for (const TrianglePlane& plane : planes)
+    apexDistance = std::max(apexDistance, (center - plane.point).dot(plane.normal) / plane.normal.dot(meshlet.coneAxis));
+
+  meshlet.coneApex = center - meshlet.coneAxis * apexDistance;
+  // A view direction making an angle lower than 90° minus the cone's half-angle with the axis is backfacing for all normals in the cone
+  meshlet.coneCutoff = std::sqrt(1.f - minDot * minDot);
+}
+
+} // namespace
+
+std::vector<Meshlet> buildMeshlets(const std::vector<Vertex>& vertices, std::vector<unsigned int>& indices,
+                                   std::size_t maxVertexCount, std::size_t maxTriangleCount) {
+  assert("Error: The number of indices must be a multiple of 3." && indices.size() % 3 == 0);
+  assert("Error: A meshlet must be able to reference at least 3 vertices." && maxVertexCount >= 3);
+  assert("Error: A meshlet must be able to hold at least 1 triangle." && maxTriangleCount >= 1);
+
+  const std::size_t triangleCount = indices.size() / 3;
+
+  // Triangles adjacent to each position, from which the meshlets are grown; vertices are compared by position only, so that triangles on both
+  //  sides of a UV or normal seam are adjacent
+  std::vector<Vertex> positions(vertices.size());
+  for (std::size_t vertIndex = 0; vertIndex < vertices.size(); ++vertIndex)
+    positions[vertIndex].position = vertices[vertIndex].position;
+
+  const MeshUtils::VertexRemap positionRemap = MeshUtils::computeVertexRemap(positions);
+  const std::vector<unsigned int>& positionIndices = positionRemap.indices;
+
+  std::vector<unsigned int> adjacencyOffsets(positionRemap.uniqueVertexCount + 1, 0);
+
+  for (const unsigned int index : indices) {
+    assert("Error: The index is out of bounds." && index < vertices.size());
+    ++adjacencyOffsets[positionIndices[index] + 1];
+  }
+
+  std::partial_sum(adjacencyOffsets.begin(), adjacencyOffsets.end(), adjacencyOffsets.begin());
+
+  std::vector<unsigned int> adjacentTriangles(indices.size());
+
+  {
+    std::vector<unsigned int> adjacencyCounts(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+
+    for (std::size_t index = 0; index < indices.size(); ++index)
+      adjacentTriangles[adjacencyCounts[positionIndices[indices[index]]]++] = static_cast<unsigned int>(index / 3);
+  }
+
+  std::vector<bool> emittedTriangles(triangleCount, false);
+  std::vector<unsigned int> vertexMeshlets(vertices.size(), invalidIndex); // Last meshlet having referenced each vertex
+  std::vector<unsigned int> meshletVertices;
+  meshletVertices.reserve(maxVertexCount);
+
+  std::vector<unsigned int> orderedIndices;
+  orderedIndices.reserve(indices.size());
+
+  std::vector<Meshlet> meshlets;
+
+  Vec3f meshletPosSum(0.f); // Sum of the current meshlet's vertices' positions, from which its center is recovered
+
+  // Finds the non-emitted triangle adjacent to the current meshlet which references the fewest new vertices, the closest to the meshlet's center
+  //  being preferred to keep the meshlet compact
+  const auto findAdjacentTriangle = [&] (unsigned int meshletIndex, bool checkLimit) {
+    const Vec3f meshletCenter = meshletPosSum / static_cast<float>(std::max(meshletVertices.size(), std::size_t(1)));
+
+    unsigned int bestTriangle = invalidIndex;
+    unsigned int bestNewVertexCount = 4;
+    float bestSquaredDist = std::numeric_limits<float>::max();
+
+    for (const unsigned int vertIndex : meshletVertices) {
+      const unsigned int posIndex = positionIndices[vertIndex];
+
+      for (unsigned int adjacencyIndex = adjacencyOffsets[posIndex]; adjacencyIndex < adjacencyOffsets[posIndex + 1]; ++adjacencyIndex) {
+        const unsigned int triangleIndex = adjacentTriangles[adjacencyIndex];
+
+        if (emittedTriangles[triangleIndex])
+          continue;
+
+        if (!checkLimit)
+          return triangleIndex;
+
+        const unsigned int* triangleIndices = &indices[triangleIndex * 3];
+
+        unsigned int newVertexCount = 0;
+        for (std::size_t i = 0; i < 3; ++i)
+          newVertexCount += (vertexMeshlets[triangleIndices[i]] != meshletIndex);
+
+        if (newVertexCount > bestNewVertexCount || meshletVertices.size() + newVertexCount > maxVertexCount)
+          continue;
+
+        const Vec3f triangleCenter = (vertices[triangleIndices[0]].position + vertices[triangleIndices[1]].position
+                                    + vertices[triangleIndices[2]].position) / 3.f;
+        const float squaredDist    = (triangleCenter - meshletCenter).computeSquaredLength();
+
+        if (newVertexCount == bestNewVertexCount && squaredDist >= bestSquaredDist)
+          continue;
+
+        bestTriangle       = triangleIndex;
+        bestNewVertexCount = newVertexCount;
+        bestSquaredDist    = squaredDist;
+      }
+    }
+
+    return bestTriangle;
+  };
+
+  std::size_t emittedTriangleCount = 0;
+  std::size_t firstRemainingTriangle = 0;
+  unsigned int triangleIndex = invalidIndex;
+
+  while (emittedTriangleCount < triangleCount) {
+    // A meshlet is started from a triangle adjacent to the previous one if any, keeping consecutive meshlets close to each other
+    if (triangleIndex == invalidIndex) {
+      while (emittedTriangles[firstRemainingTriangle])
+        ++firstRemainingTriangle;
+
+      triangleIndex = static_cast<unsigned int>(firstRemainingTriangle);
+    }
+
+    const auto meshletIndex = static_cast<unsigned int>(meshlets.size());
+    Meshlet& meshlet = meshlets.emplace_back();
+    meshlet.firstIndex = orderedIndices.size();
+
+    meshletVertices.clear();
+    meshletPosSum = Vec3f(0.f);
+
+    while (triangleIndex != invalidIndex) {
+      for (std::size_t i = 0; i < 3; ++i) {
+        const unsigned int vertIndex = indices[triangleIndex * 3 + i];
+
+        if (vertexMeshlets[vertIndex] != meshletIndex) {
+          vertexMeshlets[vertIndex] = meshletIndex;
+          meshletVertices.push_back(vertIndex);
+          meshletPosSum += vertices[vertIndex].position;
+        }
+
+        orderedIndices.push_back(vertIndex);
+      }
+
+      emittedTriangles[triangleIndex] = true;
+      ++emittedTriangleCount;
+      ++meshlet.triangleCount;
+
+      triangleIndex = (meshlet.triangleCount < maxTriangleCount ? findAdjacentTriangle(meshletIndex, true) : invalidIndex);
+    }
+
+    meshlet.vertexCount = meshletVertices.size();
+    computeBounds(meshlet, vertices, orderedIndices.data() + meshlet.firstIndex);
+
+    triangleIndex = findAdjacentTriangle(meshletIndex, false);
+  }
+
+  indices = std::move(orderedIndices);
+
+  return meshlets;
+}
+
+void buildMeshlets(Submesh& submesh, std::size_t maxVertexCount, std::size_t maxTriangleCount) {
+  if (submesh.getRenderMode() != RenderMode::TRIANGLE) {
+    submesh.setMeshlets({});
+    return;
+  }
+
+  submesh.setMeshlets(buildMeshlets(submesh.getVertices(), submesh.getTriangleIndices(), maxVertexCount, maxTriangleCount));
+}
+
+bool isVisible(const Meshlet& meshlet, const Frustum& frustum, const Vec3f* viewPosition) {
+  if (!frustum.intersects(meshlet.boundingSphere))
+    return false;
+
+  if (viewPosition == nullptr || meshlet.coneCutoff > 1.f)
+    return true;
+
+  // The meshlet is backfacing if the direction from the viewer to the cone's apex is close enough to the cone's axis
+  const Vec3f viewDir  = meshlet.coneApex - *viewPosition;
+  const float viewDist = viewDir.computeLength();
+
+  return (viewDir.dot(meshlet.coneAxis) < meshlet.coneCutoff * viewDist || viewDist <= 0.f);
+}
+
+std::vector<DrawRange> cullMeshlets(const std::vector<Meshlet>& meshlets, const Frustum& frustum, const Vec3f* viewPosition) {
+  std::vector<DrawRange> ranges;
+
+  for (const Meshlet& meshlet : meshlets) {
+    if (!isVisible(meshlet, frustum, viewPosition))
+      continue;
+
+    if (!ranges.empty() && ranges.back().firstIndex + ranges.back().indexCount == meshlet.firstIndex)
+      ranges.back().indexCount += meshlet.triangleCount * 3;
+    else
+      ranges.push_back(DrawRange{ meshlet.firstIndex, meshlet.triangleCount * 3 });
+  }
+
+  return ranges;
+}
+
+std::vector<unsigned int> compactIndices(const std::vector<unsigned int>& indices, const std::vector<DrawRange>& ranges) {
+  std::size_t indexCount = 0;
+  for (const DrawRange& range : ranges)
+    indexCount += range.indexCount;
+
+  std::vector<unsigned int> compactedIndices;
+  compactedIndices.reserve(indexCount);
+
+  for (const DrawRange& range : ranges) {
+    assert("Error: The range is out of the indices' bounds." && range.firstIndex + range.indexCount <= indices.size());
+
+    const auto firstIndexIter = indices.cbegin() + static_cast<std::ptrdiff_t>(range.firstIndex);
+    compactedIndices.insert(compactedIndices.end(), firstIndexIter, firstIndexIter + static_cast<std::ptrdiff_t>(range.indexCount));
+  }
+
+  return compactedIndices;
+}
+
+} // namespace Raz::MeshletBuilder
+
+namespace Raz {
+
+bool Mesh::hasMeshlets() const {
+  return std::any_of(m_submeshes.cbegin(), m_submeshes.cend(), [] (const Submesh& submesh) { return !submesh.getMeshlets().empty(); });
+}
+
+void Mesh::buildMeshlets(std::size_t maxVertexCount, std::size_t maxTriangleCount) {
+  const auto buildSubmeshesMeshlets = [this, maxVertexCount, maxTriangleCount] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t submeshIndex = beginIndex; submeshIndex < endIndex; ++submeshIndex)
+      MeshletBuilder::buildMeshlets(m_submeshes[submeshIndex], maxVertexCount, maxTriangleCount);
+  };
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (m_submeshes.size() > 1)
+    Threading::parallelize(m_submeshes, [&buildSubmeshesMeshlets] (Threading::IndexRange range) { buildSubmeshesMeshlets(range.beginIndex, range.endIndex); });
+  else
+#endif
+    buildSubmeshesMeshlets(0, m_submeshes.size());
+}
+
+void Mesh::cullMeshlets(const Frustum& frustum, const Vec3f* viewPosition) {
+  for (Submesh& submesh : m_submeshes)
+    submesh.cullMeshlets(frustum, viewPosition);
+}
+
+} // namespace Raz
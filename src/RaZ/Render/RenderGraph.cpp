@@ -1,5 +1,6 @@
 #include "RaZ/Math/Transform.hpp"
 #include "RaZ/Render/Camera.hpp"
+#include "RaZ/Render/Renderer.hpp"
 #include "RaZ/Render/RenderGraph.hpp"
 #include "RaZ/Render/RenderSystem.hpp"
 
@@ -66,7 +67,9 @@ void RenderGraph::execute(RenderSystem& renderSystem) const {
     viewProjMat = camera.getViewMatrix() * camera.getProjectionMatrix();
   }
 
-  for (const Entity* entity : renderSystem.m_entities) {
+  const bool cullBackfaces = Renderer::isEnabled(Capability::CULL);
+
+  for (Entity* entity : renderSystem.m_entities) {
     if (entity->isEnabled()) {
       if (entity->hasComponent<Mesh>() && entity->hasComponent<Transform>()) {
         const Mat4f modelMat = entity->getComponent<Transform>().computeTransformMatrix();
@@ -76,7 +79,19 @@ void RenderGraph::execute(RenderSystem& renderSystem) const {
         geometryProgram.sendUniform("uniModelMatrix", modelMat);
         geometryProgram.sendUniform("uniMvpMatrix", modelMat * viewProjMat);
 
-        entity->getComponent<Mesh>().draw(geometryProgram);
+        auto& mesh = entity->getComponent<Mesh>();
+        mesh.selectLods(modelMat * camera.getViewMatrix(), camera.getProjectionMatrix(), renderSystem.m_sceneHeight);
+
+        if (mesh.hasMeshlets()) {
+          // The meshlets are culled in the mesh's space, in which the frustum is extracted from the model-view-projection matrix
+          const Vec4f viewPos = Vec4f(camTransform.getPosition(), 1.f) * modelMat.inverse();
+          const Vec3f localViewPos(viewPos.x(), viewPos.y(), viewPos.z());
+
+          // Backfacing meshlets can only be culled if backfaces are not drawn
+          mesh.cullMeshlets(Frustum(modelMat * viewProjMat), (cullBackfaces ? &localViewPos : nullptr));
+        }
+
+        mesh.draw(geometryProgram);
       }
     }
   }
@@ -113,6 +113,24 @@ bool Renderer::isEnabled(Capability capability) {
   return isEnabled;
 }
 
+bool Renderer::isExtensionSupported(const std::string& extension) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  int extensionCount {};
+  getParameter(StateParameter::NUM_EXTENSIONS, &extensionCount);
+
+  bool isSupported = false;
+
+  for (int extensionIndex = 0; extensionIndex < extensionCount && !isSupported; ++extensionIndex) {
+    const auto* extensionName = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<unsigned int>(extensionIndex)));
+    isSupported = (extensionName != nullptr && extension == extensionName);
+  }
+
+  printConditionalErrors();
+
+  return isSupported;
+}
+
 void Renderer::getParameter(StateParameter parameter, unsigned char* values) {
   assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
 
@@ -433,6 +451,25 @@ void Renderer::sendImageData2D(TextureType type,
   printConditionalErrors();
 }
 
+void Renderer::sendCompressedImageData2D(TextureType type,
+                                         unsigned int mipmapLevel,
+                                         TextureInternalFormat internalFormat,
+                                         unsigned int width, unsigned int height,
+                                         unsigned int dataSize, const void* data) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  glCompressedTexImage2D(static_cast<unsigned int>(type),
+                         static_cast<int>(mipmapLevel),
+                         static_cast<unsigned int>(internalFormat),
+                         static_cast<int>(width),
+                         static_cast<int>(height),
+                         0,
+                         static_cast<int>(dataSize),
+                         data);
+
+  printConditionalErrors();
+}
+
 #if !defined(USE_OPENGL_ES)
 void Renderer::recoverTextureAttribute(TextureType type, unsigned int mipmapLevel, TextureAttribute attribute, int* values) {
   assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
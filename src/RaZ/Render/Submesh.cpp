@@ -1,5 +1,7 @@
 #include "GL/glew.h"
+#include "RaZ/Render/MeshletBuilder.hpp"
 #include "RaZ/Render/Renderer.hpp"
+#include "RaZ/Render/ShaderProgram.hpp"
 #include "RaZ/Render/Submesh.hpp"
 
 namespace Raz {
@@ -27,14 +29,45 @@ void Submesh::setRenderMode(RenderMode renderMode) {
     default:
     {
       m_renderFunc = [] (const Submesh& submesh) {
-        glDrawElements(GL_TRIANGLES, static_cast<int>(submesh.getTriangleIndexCount()), GL_UNSIGNED_INT, nullptr);
+        const std::size_t lodIndex  = submesh.getLodIndex();
+        const std::size_t indexSize = (submesh.hasShortIndices() ? sizeof(uint16_t) : sizeof(unsigned int));
+        const GLenum indexType      = (submesh.hasShortIndices() ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT);
+
+        if (submesh.isMeshletCulled()) {
+          const std::vector<DrawRange>& visibleRanges = submesh.getVisibleRanges();
+
+#if !defined(RAZ_PLATFORM_EMSCRIPTEN)
+          std::vector<int> indexCounts(visibleRanges.size());
+          std::vector<const void*> indexOffsets(visibleRanges.size());
+
+          for (std::size_t rangeIndex = 0; rangeIndex < visibleRanges.size(); ++rangeIndex) {
+            indexCounts[rangeIndex]  = static_cast<int>(visibleRanges[rangeIndex].indexCount);
+            indexOffsets[rangeIndex] = reinterpret_cast<const void*>(visibleRanges[rangeIndex].firstIndex * indexSize);
+          }
+
+          glMultiDrawElements(GL_TRIANGLES, indexCounts.data(), indexType, indexOffsets.data(), static_cast<int>(visibleRanges.size()));
+#else // Multi-draw calls are not available in WebGL without an extension
+          for (const DrawRange& range : visibleRanges)
+            glDrawElements(GL_TRIANGLES, static_cast<int>(range.indexCount), indexType, reinterpret_cast<void*>(range.firstIndex * indexSize));
+#endif
+
+          return;
+        }
+
+        // The LODs' indices follow the full detail ones in the index buffer
+        std::size_t firstIndex = 0;
+        for (std::size_t prevLodIndex = 0; prevLodIndex < lodIndex; ++prevLodIndex)
+          firstIndex += submesh.getLodTriangleIndices(prevLodIndex).size();
+
+        glDrawElements(GL_TRIANGLES,
+                       static_cast<int>(submesh.getLodTriangleIndices(lodIndex).size()),
+                       indexType,
+                       reinterpret_cast<void*>(firstIndex * indexSize));
       };
 
       break;
     }
   }
-
-  loadIndices();
 }
 
 const AABB& Submesh::computeBoundingBox() {
@@ -55,11 +88,53 @@ const AABB& Submesh::computeBoundingBox() {
   return m_boundingBox;
 }
 
+void Submesh::setMeshlets(std::vector<Meshlet> meshlets) {
+  m_meshlets = std::move(meshlets);
+  m_visibleRanges.clear();
+  m_isMeshletCulled = false;
+}
+
+void Submesh::cullMeshlets(const Frustum& frustum, const Vec3f* viewPosition) {
+  if (m_meshlets.empty())
+    return;
+
+  m_visibleRanges   = MeshletBuilder::cullMeshlets(m_meshlets, frustum, viewPosition);
+  m_isMeshletCulled = true;
+}
+
+void Submesh::setVertexLayout(const VertexLayout& layout) {
+  m_vbo.setLayout(layout);
+
+  if (layout.positionFormat == PositionFormat::UNORM16)
+    computeBoundingBox();
+}
+
 void Submesh::load() const {
   loadVertices();
   loadIndices();
 }
 
+void Submesh::sendVertexFormat(const ShaderProgram& program) const {
+  static const std::string locationBase = "uniVertexFormat.";
+
+  static const std::string quantizedPositionsLocation = locationBase + "quantizedPositions";
+  static const std::string positionOffsetLocation     = locationBase + "positionOffset";
+  static const std::string positionScaleLocation      = locationBase + "positionScale";
+  static const std::string octahedralNormalsLocation  = locationBase + "octahedralNormals";
+
+  const VertexLayout& layout   = getVertexLayout();
+  const bool quantizedPositions = (layout.positionFormat == PositionFormat::UNORM16);
+
+  program.use();
+  program.sendUniform(quantizedPositionsLocation, static_cast<int>(quantizedPositions));
+  program.sendUniform(octahedralNormalsLocation, static_cast<int>(layout.normalFormat == NormalFormat::OCTAHEDRAL));
+
+  if (quantizedPositions) {
+    program.sendUniform(positionOffsetLocation, m_boundingBox.getLeftBottomBackPos());
+    program.sendUniform(positionScaleLocation, m_boundingBox.getRightTopFrontPos() - m_boundingBox.getLeftBottomBackPos());
+  }
+}
+
 void Submesh::draw() const {
   m_vao.bind();
   m_ibo.bind();
@@ -72,39 +147,60 @@ void Submesh::loadVertices() const {
   m_vbo.bind();
 
   const std::vector<Vertex>& vertices = getVertices();
+  const VertexLayout& layout          = getVertexLayout();
+
+  if (layout.isDefault()) {
+    Renderer::sendBufferData(BufferType::ARRAY_BUFFER,
+                             static_cast<std::ptrdiff_t>(sizeof(vertices.front()) * vertices.size()),
+                             vertices.data(),
+                             BufferDataUsage::STATIC_DRAW);
+  } else {
+    const std::vector<uint8_t> packedVertices = VertexPacker::packVertices(vertices, layout, m_boundingBox);
+
+    Renderer::sendBufferData(BufferType::ARRAY_BUFFER,
+                             static_cast<std::ptrdiff_t>(packedVertices.size()),
+                             packedVertices.data(),
+                             BufferDataUsage::STATIC_DRAW);
+  }
 
-  Renderer::sendBufferData(BufferType::ARRAY_BUFFER,
-                           static_cast<std::ptrdiff_t>(sizeof(vertices.front()) * vertices.size()),
-                           vertices.data(),
-                           BufferDataUsage::STATIC_DRAW);
-
-  constexpr uint8_t stride = sizeof(vertices.front());
+  const auto stride = static_cast<int>(layout.computeStride());
 
-  glVertexAttribPointer(0, 3,
-                        GL_FLOAT, GL_FALSE,
-                        stride,
-                        nullptr);
+  // Quantized positions are decoded relative to the bounding box by the vertex shader
+  if (layout.positionFormat == PositionFormat::FLOAT)
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, nullptr);
+  else
+    glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, stride, nullptr);
   glEnableVertexAttribArray(0);
 
-  constexpr std::size_t positionSize = sizeof(vertices.front().position);
-  glVertexAttribPointer(1, 2,
-                        GL_FLOAT, GL_FALSE,
-                        stride,
-                        reinterpret_cast<void*>(positionSize));
+  const std::size_t positionSize = layout.computePositionSize();
+
+  switch (layout.texcoordsFormat) {
+    case TexcoordsFormat::FLOAT:
+      glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(positionSize));
+      break;
+
+    case TexcoordsFormat::HALF_FLOAT:
+      glVertexAttribPointer(1, 2, GL_HALF_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(positionSize));
+      break;
+
+    case TexcoordsFormat::UNORM16:
+      glVertexAttribPointer(1, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, reinterpret_cast<void*>(positionSize));
+      break;
+  }
   glEnableVertexAttribArray(1);
 
-  constexpr std::size_t texcoordsSize = sizeof(vertices.front().texcoords);
-  glVertexAttribPointer(2, 3,
-                        GL_FLOAT, GL_FALSE,
-                        stride,
-                        reinterpret_cast<void*>(positionSize + texcoordsSize));
-  glEnableVertexAttribArray(2);
+  const std::size_t texcoordsSize = layout.computeTexcoordsSize();
+  const std::size_t normalSize    = layout.computeNormalSize();
 
-  constexpr std::size_t normalSize = sizeof(vertices.front().normal);
-  glVertexAttribPointer(3, 3,
-                        GL_FLOAT, GL_FALSE,
-                        stride,
-                        reinterpret_cast<void*>(positionSize + texcoordsSize + normalSize));
+  // Octahedral normals & tangents are decoded by the vertex shader; tangents' handedness is given by their 4th component, defaulting to 1 if absent
+  if (layout.normalFormat == NormalFormat::FLOAT) {
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(positionSize + texcoordsSize));
+    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(positionSize + texcoordsSize + normalSize));
+  } else {
+    glVertexAttribPointer(2, 2, GL_SHORT, GL_TRUE, stride, reinterpret_cast<void*>(positionSize + texcoordsSize));
+    glVertexAttribPointer(3, 4, GL_INT_2_10_10_10_REV, GL_TRUE, stride, reinterpret_cast<void*>(positionSize + texcoordsSize + normalSize));
+  }
+  glEnableVertexAttribArray(2);
   glEnableVertexAttribArray(3);
 
   m_vbo.unbind();
@@ -115,13 +211,42 @@ void Submesh::loadIndices() const {
   m_vao.bind();
   m_ibo.bind();
 
-  // Mapping the indices to lines' if asked, and triangles' otherwise
-  const std::vector<unsigned int>& indices = (/*m_renderMode == RenderMode::LINE ? getLineIndices() : */getTriangleIndices());
+  // Sending the triangle indices, followed by those of each LOD
+  const std::size_t levelCount = m_lods.size() + 1;
+
+  // Indices are sent as 16-bit integers whenever possible, halving their size
+  const std::size_t indexSize = (hasShortIndices() ? sizeof(uint16_t) : sizeof(unsigned int));
 
-  Renderer::sendBufferData(BufferType::ELEMENT_BUFFER,
-                           static_cast<std::ptrdiff_t>(sizeof(indices.front()) * indices.size()),
-                           indices.data(),
-                           BufferDataUsage::STATIC_DRAW);
+  std::size_t indexCount = 0;
+  for (std::size_t levelIndex = 0; levelIndex < levelCount; ++levelIndex)
+    indexCount += getLodTriangleIndices(levelIndex).size();
+
+  Renderer::sendBufferData(BufferType::ELEMENT_BUFFER, static_cast<std::ptrdiff_t>(indexCount * indexSize), nullptr, BufferDataUsage::STATIC_DRAW);
+
+  std::size_t firstIndex = 0;
+
+  for (std::size_t levelIndex = 0; levelIndex < levelCount; ++levelIndex) {
+    const std::vector<unsigned int>& indices = getLodTriangleIndices(levelIndex);
+
+    if (indices.empty())
+      continue;
+
+    if (hasShortIndices()) {
+      const std::vector<uint16_t> shortIndices = VertexPacker::packShortIndices(indices);
+
+      Renderer::sendBufferSubData(BufferType::ELEMENT_BUFFER,
+                                  static_cast<std::ptrdiff_t>(firstIndex * indexSize),
+                                  static_cast<std::ptrdiff_t>(shortIndices.size() * indexSize),
+                                  shortIndices.data());
+    } else {
+      Renderer::sendBufferSubData(BufferType::ELEMENT_BUFFER,
+                                  static_cast<std::ptrdiff_t>(firstIndex * indexSize),
+                                  static_cast<std::ptrdiff_t>(indices.size() * indexSize),
+                                  indices.data());
+    }
+
+    firstIndex += indices.size();
+  }
 
   m_ibo.unbind();
   m_vao.unbind();
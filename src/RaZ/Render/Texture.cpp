@@ -1,9 +1,48 @@
 #include "GL/glew.h"
 #include "RaZ/Render/Renderer.hpp"
 #include "RaZ/Render/Texture.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/MappedFile.hpp"
+#include "RaZ/Utils/RaztexFormat.hpp"
+#include "RaZ/Utils/StrUtils.hpp"
+#include "RaZ/Utils/VirtualFileSystem.hpp"
+
+#include <cstring>
 
 namespace Raz {
 
+namespace {
+
+constexpr ImageColorspace recoverColorspace(uint8_t channelCount) noexcept {
+  switch (channelCount) {
+    case 1:  return ImageColorspace::GRAY;
+    case 2:  return ImageColorspace::GRAY_ALPHA;
+    case 3:  return ImageColorspace::RGB;
+    case 4:
+    default: return ImageColorspace::RGBA;
+  }
+}
+
+inline bool isBlockCompressionSupported() {
+  // WebGL exposes the S3TC formats under a different extension name
+  static const bool isSupported = Renderer::isExtensionSupported("GL_EXT_texture_compression_s3tc")
+                               || Renderer::isExtensionSupported("GL_WEBGL_compressed_texture_s3tc");
+  return isSupported;
+}
+
+void setSwizzle(ImageColorspace colorspace) {
+  if (colorspace != ImageColorspace::GRAY && colorspace != ImageColorspace::GRAY_ALPHA)
+    return;
+
+  const std::array<int, 4> swizzle = { GL_RED,
+                                       GL_RED,
+                                       GL_RED,
+                                       (colorspace == ImageColorspace::GRAY_ALPHA ? GL_GREEN : GL_ONE) };
+  Renderer::setTextureParameter(TextureType::TEXTURE_2D, TextureParam::SWIZZLE_RGBA, swizzle.data());
+}
+
+} // namespace
+
 Texture::Texture() {
   Renderer::generateTexture(m_index);
 }
@@ -48,6 +87,21 @@ void Texture::load(Image image, bool createMipmaps) {
 }
 
 void Texture::load(const FilePath& filePath, bool flipVertically, bool createMipmaps) {
+  // Textures converted by the asset cooker are archived under the path of their source image
+  if (const std::optional<ArchiveEntry> archivedTexture = VirtualFileSystem::find(filePath)) {
+    if (archivedTexture->type != AssetArchiveFormat::EntryType::TEXTURE)
+      throw std::invalid_argument("Error: The archived asset '" + filePath + "' is not a texture");
+
+    loadRaztex(archivedTexture->data, filePath, flipVertically, createMipmaps);
+    return;
+  }
+
+  if (StrUtils::toLowercaseCopy(filePath.recoverExtension().toUtf8()) == "raztex") {
+    const MappedFile file(filePath);
+    loadRaztex(file.getContent(), filePath, flipVertically, createMipmaps);
+    return;
+  }
+
   m_image.read(filePath, flipVertically);
   load(createMipmaps);
 }
@@ -117,13 +171,7 @@ void Texture::load(bool createMipmaps) {
   Renderer::setTextureParameter(TextureType::TEXTURE_2D, TextureParam::MINIFY_FILTER, TextureParamValue::LINEAR_MIPMAP_LINEAR);
   Renderer::setTextureParameter(TextureType::TEXTURE_2D, TextureParam::MAGNIFY_FILTER, TextureParamValue::LINEAR);
 
-  if (m_image.getColorspace() == ImageColorspace::GRAY || m_image.getColorspace() == ImageColorspace::GRAY_ALPHA) {
-    const std::array<int, 4> swizzle = { GL_RED,
-                                         GL_RED,
-                                         GL_RED,
-                                         (m_image.getColorspace() == ImageColorspace::GRAY_ALPHA ? GL_GREEN : GL_ONE) };
-    Renderer::setTextureParameter(TextureType::TEXTURE_2D, TextureParam::SWIZZLE_RGBA, swizzle.data());
-  }
+  setSwizzle(m_image.getColorspace());
 
   // Default internal format is the image's own colorspace; modified if the image is a floating point one
   auto colorFormat = static_cast<TextureInternalFormat>(m_image.getColorspace());
@@ -168,6 +216,87 @@ void Texture::load(bool createMipmaps) {
   unbind();
 }
 
+void Texture::loadRaztex(std::string_view fileContent, const FilePath& filePath, bool flipVertically, bool createMipmaps) {
+  const RaztexFormat::Content content = RaztexFormat::read(fileContent, filePath);
+  const RaztexFormat::PixelFormat pixelFormat = content.header.pixelFormat;
+
+  const bool isCompressed = RaztexFormat::isCompressed(pixelFormat);
+  const bool isFlipped    = ((content.header.flags & RaztexFormat::HeaderFlag::FLIPPED_VERTICALLY) != 0);
+  const bool mustFlip     = (isFlipped != flipVertically);
+
+  // Compressed mipmaps are sent as is whenever possible; they are otherwise decompressed, which is also required to flip them
+  const bool sendCompressed = (isCompressed && !mustFlip && isBlockCompressionSupported());
+
+  const uint8_t channelCount = (isCompressed ? 4 : static_cast<uint8_t>(static_cast<uint32_t>(pixelFormat) + 1));
+  const ImageColorspace colorspace = recoverColorspace(channelCount);
+
+  m_image = Image();
+  m_image.m_colorspace = colorspace;
+
+  bind();
+  Renderer::setTextureParameter(TextureType::TEXTURE_2D, TextureParam::WRAP_S, TextureParamValue::REPEAT);
+  Renderer::setTextureParameter(TextureType::TEXTURE_2D, TextureParam::WRAP_T, TextureParamValue::REPEAT);
+
+  Renderer::setTextureParameter(TextureType::TEXTURE_2D, TextureParam::MINIFY_FILTER, (createMipmaps ? TextureParamValue::LINEAR_MIPMAP_LINEAR
+                                                                                                      : TextureParamValue::LINEAR));
+  Renderer::setTextureParameter(TextureType::TEXTURE_2D, TextureParam::MAGNIFY_FILTER, TextureParamValue::LINEAR);
+
+  setSwizzle(colorspace);
+
+  // Raw mipmaps' rows are tightly packed, thus not necessarily aligned
+  int unpackAlignment {};
+  Renderer::getParameter(StateParameter::UNPACK_ALIGNMENT, &unpackAlignment);
+  Renderer::setPixelStorage(PixelStorage::UNPACK_ALIGNMENT, 1);
+
+  const std::size_t mipmapCount = (createMipmaps ? content.mipmaps.size() : 1);
+
+  for (std::size_t mipmapIndex = 0; mipmapIndex < mipmapCount; ++mipmapIndex) {
+    const RaztexFormat::Mipmap& mipmap = content.mipmaps[mipmapIndex];
+
+    if (sendCompressed) {
+      Renderer::sendCompressedImageData2D(TextureType::TEXTURE_2D,
+                                          static_cast<unsigned int>(mipmapIndex),
+                                          (pixelFormat == RaztexFormat::PixelFormat::BC1 ? TextureInternalFormat::RGB_BC1 : TextureInternalFormat::RGBA_BC3),
+                                          mipmap.width,
+                                          mipmap.height,
+                                          static_cast<unsigned int>(mipmap.dataSize),
+                                          mipmap.data);
+      continue;
+    }
+
+    std::vector<uint8_t> pixels = (isCompressed ? RaztexFormat::decompressBlocks(mipmap.data, mipmap.width, mipmap.height, pixelFormat)
+                                                : std::vector<uint8_t>(mipmap.data, mipmap.data + mipmap.dataSize));
+
+    if (mustFlip) {
+      const std::size_t rowSize = static_cast<std::size_t>(mipmap.width) * channelCount;
+
+      for (std::size_t rowIndex = 0; rowIndex < mipmap.height / 2; ++rowIndex)
+        std::swap_ranges(pixels.begin() + static_cast<std::ptrdiff_t>(rowIndex * rowSize),
+                         pixels.begin() + static_cast<std::ptrdiff_t>((rowIndex + 1) * rowSize),
+                         pixels.end() - static_cast<std::ptrdiff_t>((rowIndex + 1) * rowSize));
+    }
+
+    Renderer::sendImageData2D(TextureType::TEXTURE_2D,
+                              static_cast<unsigned int>(mipmapIndex),
+                              static_cast<TextureInternalFormat>(colorspace),
+                              mipmap.width,
+                              mipmap.height,
+                              static_cast<TextureFormat>(colorspace),
+                              TextureDataType::UBYTE,
+                              pixels.data());
+
+    // Raw textures keep their image in memory, as any texture loaded from an image file
+    if (mipmapIndex == 0 && !isCompressed) {
+      m_image = Image(mipmap.width, mipmap.height, colorspace);
+      std::memcpy(m_image.getDataPtr(), pixels.data(), pixels.size());
+    }
+  }
+
+  Renderer::setPixelStorage(PixelStorage::UNPACK_ALIGNMENT, static_cast<unsigned int>(unpackAlignment));
+
+  unbind();
+}
+
 void Texture::makePlainColored(const Vec3b& color) const {
   bind();
   Renderer::sendImageData2D(TextureType::TEXTURE_2D, 0, TextureInternalFormat::RGB, 1, 1, TextureFormat::RGB, TextureDataType::UBYTE, color.getDataPtr());
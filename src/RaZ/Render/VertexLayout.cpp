@@ -0,0 +1,175 @@
+#include "RaZ/Math/Packing.hpp"
+#include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Render/VertexLayout.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace Raz::VertexPacker {
+
+namespace {
+
+// The tangents' handedness is always positive, bitangents being computed as cross(normal, tangent)
+constexpr uint32_t tangentSign = 1;
+
+// Null vectors, notably found in meshes without tangents, have no octahedral representation
+inline Vec3f recoverEncodableVector(const Vec3f& vec) noexcept {
+  return (vec.computeSquaredLength() > 0.f ? vec : Axis::Z);
+}
+
+// Packs a tangent in the INT_2_10_10_10_REV format: octahedral coordinates in the lowest 2 10-bit signed normalized integers, then the
+//  handedness in the highest 2 bits
+inline uint32_t packTangent(const Vec3f& tangent) noexcept {
+  const Vec2f coords = Packing::encodeOctahedral(recoverEncodableVector(tangent));
+
+  const auto packCoord = [] (float coord) {
+    const auto packedCoord = static_cast<int32_t>(std::round(std::clamp(coord, -1.f, 1.f) * 511.f));
+    return (static_cast<uint32_t>(packedCoord) & 0x3FFu);
+  };
+
+  return (packCoord(coords.x()) | (packCoord(coords.y()) << 10) | (tangentSign << 30));
+}
+
+inline Vec3f unpackTangent(uint32_t packedTangent) noexcept {
+  const auto unpackCoord = [] (uint32_t packedCoord) {
+    const auto coord = static_cast<float>(packedCoord >= 512 ? static_cast<int32_t>(packedCoord) - 1024 : static_cast<int32_t>(packedCoord));
+    return std::max(coord / 511.f, -1.f);
+  };
+
+  return Packing::decodeOctahedral(Vec2f(unpackCoord(packedTangent & 0x3FFu), unpackCoord((packedTangent >> 10) & 0x3FFu)));
+}
+
+template <typename T>
+inline void writeValue(uint8_t*& data, T value) noexcept {
+  std::memcpy(data, &value, sizeof(T));
+  data += sizeof(T);
+}
+
+template <typename T>
+inline T readValue(const uint8_t*& data) noexcept {
+  T value {};
+  std::memcpy(&value, data, sizeof(T));
+  data += sizeof(T);
+  return value;
+}
+
+} // namespace
+
+std::vector<uint8_t> packVertices(const std::vector<Vertex>& vertices, const VertexLayout& layout, const AABB& boundingBox) {
+  std::vector<uint8_t> packedVertices(vertices.size() * layout.computeStride());
+  uint8_t* data = packedVertices.data();
+
+  const Vec3f& minPos = boundingBox.getLeftBottomBackPos();
+  const Vec3f extent  = boundingBox.getRightTopFrontPos() - minPos;
+  const Vec3f invExtent(extent.x() > 0.f ? 1.f / extent.x() : 0.f, extent.y() > 0.f ? 1.f / extent.y() : 0.f, extent.z() > 0.f ? 1.f / extent.z() : 0.f);
+
+  for (const Vertex& vertex : vertices) {
+    if (layout.positionFormat == PositionFormat::FLOAT) {
+      for (std::size_t i = 0; i < 3; ++i)
+        writeValue(data, vertex.position[i]);
+    } else {
+      for (std::size_t i = 0; i < 3; ++i)
+        writeValue(data, Packing::packUnorm<uint16_t>((vertex.position[i] - minPos[i]) * invExtent[i]));
+
+      writeValue(data, uint16_t(0));
+    }
+
+    for (std::size_t i = 0; i < 2; ++i) {
+      switch (layout.texcoordsFormat) {
+        case TexcoordsFormat::FLOAT:
+          writeValue(data, vertex.texcoords[i]);
+          break;
+
+        case TexcoordsFormat::HALF_FLOAT:
+          writeValue(data, Packing::convertToHalf(vertex.texcoords[i]));
+          break;
+
+        case TexcoordsFormat::UNORM16:
+          writeValue(data, Packing::packUnorm<uint16_t>(vertex.texcoords[i]));
+          break;
+      }
+    }
+
+    if (layout.normalFormat == NormalFormat::FLOAT) {
+      for (std::size_t i = 0; i < 3; ++i)
+        writeValue(data, vertex.normal[i]);
+
+      for (std::size_t i = 0; i < 3; ++i)
+        writeValue(data, vertex.tangent[i]);
+    } else {
+      writeValue(data, Packing::packOctahedral(recoverEncodableVector(vertex.normal)));
+      writeValue(data, packTangent(vertex.tangent));
+    }
+  }
+
+  assert("Error: The packed vertices' size is invalid." && data == packedVertices.data() + packedVertices.size());
+
+  return packedVertices;
+}
+
+std::vector<Vertex> unpackVertices(const std::vector<uint8_t>& packedVertices, const VertexLayout& layout, const AABB& boundingBox) {
+  assert("Error: The packed vertices' size must be a multiple of the layout's stride." && packedVertices.size() % layout.computeStride() == 0);
+
+  std::vector<Vertex> vertices(packedVertices.size() / layout.computeStride());
+  const uint8_t* data = packedVertices.data();
+
+  const Vec3f& minPos = boundingBox.getLeftBottomBackPos();
+  const Vec3f extent  = boundingBox.getRightTopFrontPos() - minPos;
+
+  for (Vertex& vertex : vertices) {
+    if (layout.positionFormat == PositionFormat::FLOAT) {
+      for (std::size_t i = 0; i < 3; ++i)
+        vertex.position[i] = readValue<float>(data);
+    } else {
+      for (std::size_t i = 0; i < 3; ++i)
+        vertex.position[i] = minPos[i] + Packing::unpackUnorm(readValue<uint16_t>(data)) * extent[i];
+
+      data += sizeof(uint16_t);
+    }
+
+    for (std::size_t i = 0; i < 2; ++i) {
+      switch (layout.texcoordsFormat) {
+        case TexcoordsFormat::FLOAT:
+          vertex.texcoords[i] = readValue<float>(data);
+          break;
+
+        case TexcoordsFormat::HALF_FLOAT:
+          vertex.texcoords[i] = Packing::convertFromHalf(readValue<uint16_t>(data));
+          break;
+
+        case TexcoordsFormat::UNORM16:
+          vertex.texcoords[i] = Packing::unpackUnorm(readValue<uint16_t>(data));
+          break;
+      }
+    }
+
+    if (layout.normalFormat == NormalFormat::FLOAT) {
+      for (std::size_t i = 0; i < 3; ++i)
+        vertex.normal[i] = readValue<float>(data);
+
+      for (std::size_t i = 0; i < 3; ++i)
+        vertex.tangent[i] = readValue<float>(data);
+    } else {
+      vertex.normal  = Packing::unpackOctahedral(readValue<uint32_t>(data));
+      vertex.tangent = unpackTangent(readValue<uint32_t>(data));
+    }
+  }
+
+  return vertices;
+}
+
+std::vector<uint16_t> packShortIndices(const std::vector<unsigned int>& indices) {
+  std::vector<uint16_t> shortIndices(indices.size());
+
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    assert("Error: The index is too large to be converted to a 16-bit one." && indices[i] < maxShortIndexedVertexCount);
+    shortIndices[i] = static_cast<uint16_t>(indices[i]);
+  }
+
+  return shortIndices;
+}
+
+} // namespace Raz::VertexPacker
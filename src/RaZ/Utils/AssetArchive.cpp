@@ -0,0 +1,174 @@
+#include "RaZ/Utils/AssetArchive.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/RazmeshFormat.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace Raz {
+
+namespace {
+
+constexpr std::size_t alignOffset(std::size_t offset) noexcept {
+  return (offset + AssetArchiveFormat::alignment - 1) & ~(AssetArchiveFormat::alignment - 1);
+}
+
+// Checks that the given number of elements starting at the given offset fit in the file, without overflowing
+constexpr bool isRangeValid(uint64_t offset, uint64_t count, std::size_t elementSize, uint64_t fileSize) noexcept {
+  return (offset <= fileSize && count <= (fileSize - offset) / elementSize);
+}
+
+} // namespace
+
+AssetArchive::AssetArchive(const FilePath& filePath) : m_file(filePath) {
+  if (m_file.getSize() < sizeof(AssetArchiveFormat::Header))
+    throw std::invalid_argument("Error: The file '" + filePath + "' is too small to be an asset archive");
+
+  AssetArchiveFormat::Header header {};
+  std::memcpy(&header, m_file.getData(), sizeof(AssetArchiveFormat::Header));
+
+  if (header.magic != AssetArchiveFormat::magic)
+    throw std::invalid_argument("Error: The file '" + filePath + "' is not an asset archive");
+
+  if (header.version != AssetArchiveFormat::version)
+    throw std::invalid_argument("Error: The asset archive '" + filePath + "' has an unsupported version (" + std::to_string(header.version) + ")");
+
+  if (header.endiannessTag != AssetArchiveFormat::endiannessTag)
+    throw std::invalid_argument("Error: The asset archive '" + filePath + "' has been written with a different endianness");
+
+  if (header.fileSize != m_file.getSize())
+    throw std::invalid_argument("Error: The asset archive '" + filePath + "' is truncated");
+
+  if (!isRangeValid(header.entryTableOffset, header.entryCount, sizeof(AssetArchiveFormat::Entry), header.fileSize)
+   || !isRangeValid(header.stringTableOffset, header.stringTableSize, sizeof(char), header.fileSize)
+   || header.stringTableOffset != header.entryTableOffset + header.entryCount * sizeof(AssetArchiveFormat::Entry))
+    throw std::invalid_argument("Error: The asset archive '" + filePath + "' has tables out of its bounds");
+
+  // Only the index is checked when opening the archive, the entries' data being possibly large & not all used
+  const std::size_t indexSize = header.entryCount * sizeof(AssetArchiveFormat::Entry) + header.stringTableSize;
+
+  if (RazmeshFormat::computeChecksum(m_file.getData() + header.entryTableOffset, indexSize) != header.checksum)
+    throw std::invalid_argument("Error: The asset archive '" + filePath + "' is corrupted; its checksum doesn't match its index");
+
+  m_entries.resize(header.entryCount);
+  std::memcpy(m_entries.data(), m_file.getData() + header.entryTableOffset, m_entries.size() * sizeof(AssetArchiveFormat::Entry));
+
+  m_strings = std::string_view(m_file.getData() + header.stringTableOffset, header.stringTableSize);
+
+  for (std::size_t entryIndex = 0; entryIndex < m_entries.size(); ++entryIndex) {
+    const AssetArchiveFormat::Entry& entry = m_entries[entryIndex];
+
+    if (entry.path.offset > m_strings.size() || entry.path.size > m_strings.size() - entry.path.offset
+     || !isRangeValid(entry.dataOffset, entry.dataSize, sizeof(char), header.fileSize))
+      throw std::invalid_argument("Error: The asset archive '" + filePath + "' has an entry out of its bounds");
+
+    // Entries must be strictly ordered for them to be found by a binary search, which also guarantees their uniqueness
+    if (entryIndex > 0 && recoverPath(m_entries[entryIndex - 1]) >= recoverPath(entry))
+      throw std::invalid_argument("Error: The asset archive '" + filePath + "' has unsorted or duplicate entries");
+  }
+}
+
+ArchiveEntry AssetArchive::getEntry(std::size_t entryIndex) const {
+  assert("Error: The archive entry index is out of bounds." && entryIndex < m_entries.size());
+
+  const AssetArchiveFormat::Entry& entry = m_entries[entryIndex];
+  return ArchiveEntry{ recoverPath(entry), entry.type, std::string_view(m_file.getData() + entry.dataOffset, entry.dataSize), entry.dataHash };
+}
+
+std::optional<ArchiveEntry> AssetArchive::find(std::string_view path) const {
+  const auto entryIter = std::lower_bound(m_entries.cbegin(), m_entries.cend(), path, [this] (const AssetArchiveFormat::Entry& entry, std::string_view entryPath) {
+    return (recoverPath(entry) < entryPath);
+  });
+
+  if (entryIter == m_entries.cend() || recoverPath(*entryIter) != path)
+    return std::nullopt;
+
+  return getEntry(static_cast<std::size_t>(entryIter - m_entries.cbegin()));
+}
+
+bool AssetArchive::checkIntegrity() const {
+  return std::all_of(m_entries.cbegin(), m_entries.cend(), [this] (const AssetArchiveFormat::Entry& entry) {
+    return (RazmeshFormat::computeChecksum(m_file.getData() + entry.dataOffset, entry.dataSize) == entry.dataHash);
+  });
+}
+
+void AssetArchive::save(const FilePath& filePath, std::vector<ArchivedAsset> assets) {
+  std::sort(assets.begin(), assets.end(), [] (const ArchivedAsset& firstAsset, const ArchivedAsset& secondAsset) {
+    return (firstAsset.path < secondAsset.path);
+  });
+
+  const auto duplicateIter = std::adjacent_find(assets.cbegin(), assets.cend(), [] (const ArchivedAsset& firstAsset, const ArchivedAsset& secondAsset) {
+    return (firstAsset.path == secondAsset.path);
+  });
+
+  if (duplicateIter != assets.cend())
+    throw std::invalid_argument("Error: The asset '" + duplicateIter->path + "' cannot be packed several times into the same archive");
+
+  AssetArchiveFormat::Header header {};
+  header.magic            = AssetArchiveFormat::magic;
+  header.version          = AssetArchiveFormat::version;
+  header.endiannessTag    = AssetArchiveFormat::endiannessTag;
+  header.entryCount       = static_cast<uint32_t>(assets.size());
+  header.entryTableOffset = sizeof(AssetArchiveFormat::Header);
+
+  // Building the index, the data following it in the same order as the entries
+
+  std::string strings;
+  std::vector<AssetArchiveFormat::Entry> entries(assets.size());
+
+  for (std::size_t assetIndex = 0; assetIndex < assets.size(); ++assetIndex) {
+    entries[assetIndex].path = AssetArchiveFormat::StringRef{ static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(assets[assetIndex].path.size()) };
+    entries[assetIndex].type = assets[assetIndex].type;
+    strings += assets[assetIndex].path;
+  }
+
+  header.stringTableOffset = header.entryTableOffset + entries.size() * sizeof(AssetArchiveFormat::Entry);
+  header.stringTableSize   = static_cast<uint32_t>(strings.size());
+
+  std::size_t offset = alignOffset(header.stringTableOffset + strings.size());
+
+  for (std::size_t assetIndex = 0; assetIndex < assets.size(); ++assetIndex) {
+    const std::string_view data = assets[assetIndex].data;
+
+    entries[assetIndex].dataOffset = offset;
+    entries[assetIndex].dataSize   = data.size();
+    entries[assetIndex].dataHash   = RazmeshFormat::computeChecksum(data.data(), data.size());
+
+    offset = alignOffset(offset + data.size());
+  }
+
+  header.fileSize = offset;
+
+  std::string index(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(AssetArchiveFormat::Entry));
+  index += strings;
+  header.checksum = RazmeshFormat::computeChecksum(index.data(), index.size());
+
+  std::ofstream file(filePath, std::ios_base::out | std::ios_base::binary);
+
+  if (!file)
+    throw std::invalid_argument("Error: Unable to create an asset archive as '" + filePath + "'; path to file must exist");
+
+  // The data are written one after the other, without gathering them in memory
+  constexpr std::array<char, AssetArchiveFormat::alignment> padding {};
+  std::size_t writtenSize = 0;
+
+  const auto write = [&file, &padding, &writtenSize] (const char* data, std::size_t size, std::size_t nextOffset) {
+    file.write(data, static_cast<std::streamsize>(size));
+    file.write(padding.data(), static_cast<std::streamsize>(nextOffset - writtenSize - size));
+    writtenSize = nextOffset;
+  };
+
+  write(reinterpret_cast<const char*>(&header), sizeof(AssetArchiveFormat::Header), header.entryTableOffset);
+  write(index.data(), index.size(), alignOffset(header.stringTableOffset + strings.size()));
+
+  for (std::size_t assetIndex = 0; assetIndex < assets.size(); ++assetIndex)
+    write(assets[assetIndex].data.data(), assets[assetIndex].data.size(), alignOffset(entries[assetIndex].dataOffset + entries[assetIndex].dataSize));
+
+  if (!file)
+    throw std::runtime_error("Error: Failed to write the asset archive '" + filePath + "'");
+}
+
+} // namespace Raz
@@ -0,0 +1,340 @@
+#include "RaZ/Audio/Sound.hpp"
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/Texture.hpp"
+#include "RaZ/Utils/AssetManager.hpp"
+#include "RaZ/Utils/Image.hpp"
+#include "RaZ/Utils/StrUtils.hpp"
+#include "RaZ/Utils/VirtualFileSystem.hpp"
+
+namespace Raz {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+inline float computeMilliseconds(Clock::time_point startTime, Clock::time_point endTime) noexcept {
+  return std::chrono::duration<float, std::milli>(endTime - startTime).count();
+}
+
+class ImageEntry final : public TypedAssetEntry<Image> {
+public:
+  ImageEntry(FilePath filePath, bool flipVertically)
+    : TypedAssetEntry(std::move(filePath)), m_flipVertically{ flipVertically } {}
+
+private:
+  void decode() override { m_asset = std::make_shared<Image>(m_filePath, m_flipVertically); }
+
+  bool m_flipVertically {};
+};
+
+class TextureEntry final : public TypedAssetEntry<Texture> {
+public:
+  TextureEntry(FilePath filePath, int bindingIndex, bool flipVertically, bool createMipmaps)
+    : TypedAssetEntry(std::move(filePath)), m_bindingIndex{ bindingIndex }, m_flipVertically{ flipVertically }, m_createMipmaps{ createMipmaps } {}
+
+private:
+  void decode() override {
+    // Cooked textures hold all their mipmaps & are sent as is to the graphics card; they are read directly when uploading
+    m_isCooked = (VirtualFileSystem::find(m_filePath).has_value() || StrUtils::toLowercaseCopy(m_filePath.recoverExtension().toUtf8()) == "raztex");
+
+    if (!m_isCooked)
+      m_image.read(m_filePath, m_flipVertically);
+  }
+
+  void upload() override {
+    if (m_isCooked)
+      m_asset = Texture::create(m_filePath, m_bindingIndex, m_flipVertically, m_createMipmaps);
+    else
+      m_asset = Texture::create(std::move(m_image), m_bindingIndex, m_createMipmaps);
+  }
+
+  int m_bindingIndex {};
+  bool m_flipVertically {};
+  bool m_createMipmaps {};
+  bool m_isCooked = false;
+  Image m_image {};
+};
+
+class MeshEntry final : public TypedAssetEntry<Mesh> {
+public:
+  using TypedAssetEntry::TypedAssetEntry;
+
+private:
+  // The file is parsed & the materials' images decoded on a worker thread; only the submeshes' buffers & the materials' textures, which require
+  //  a graphics context, are created when uploading
+  void decode() override { m_asset = std::make_shared<Mesh>(Mesh::importDeferred(m_filePath)); }
+
+  void upload() override {
+    m_asset->createImportedMaterials();
+    m_asset->load();
+  }
+};
+
+class SoundEntry final : public TypedAssetEntry<Sound> {
+public:
+  using TypedAssetEntry::TypedAssetEntry;
+
+private:
+  // The audio context being shared by all threads, a sound can be entirely loaded on a worker one
+  void decode() override { m_asset = std::make_shared<Sound>(m_filePath); }
+};
+
+} // namespace
+
+AssetManager::AssetManager([[maybe_unused]] std::size_t workerCount) {
+#if defined(RAZ_THREADS_AVAILABLE)
+  assert("Error: The asset manager requires at least one worker thread." && workerCount > 0);
+
+  m_workers.reserve(workerCount);
+
+  for (std::size_t workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+    m_workers.emplace_back([this] () {
+      while (true) {
+        std::shared_ptr<AssetEntry> entry;
+
+        {
+          std::unique_lock<std::mutex> lock(m_decodeMutex);
+          m_decodeCondition.wait(lock, [this] () { return (m_isStopping || !m_decodeQueue.empty()); });
+
+          if (m_isStopping)
+            return;
+
+          entry = std::move(m_decodeQueue.front());
+          m_decodeQueue.pop_front();
+        }
+
+        decode(std::move(entry));
+      }
+    });
+  }
+#endif
+}
+
+template <typename EntryT, typename... Args>
+auto AssetManager::request(const FilePath& filePath, std::string key, Args&&... args) {
+  using AssetT = typename EntryT::AssetType;
+
+  ++m_stats.requestCount;
+
+  // Assets are identified by their normalized path, so that the same file referenced differently is loaded only once
+  key += VirtualFileSystem::normalizePath(filePath.toUtf8());
+
+  if (const auto entryIter = m_entries.find(key); entryIter != m_entries.end()) {
+    ++m_stats.deduplicatedCount;
+    return AssetHandle<AssetT>(std::static_pointer_cast<TypedAssetEntry<AssetT>>(entryIter->second));
+  }
+
+  auto entry = std::make_shared<EntryT>(filePath, std::forward<Args>(args)...);
+  entry->m_requestTime = Clock::now();
+  m_entries.emplace(std::move(key), entry);
+
+  // The progress is computed from the assets requested since the manager was last idle
+  if (m_stats.loadingCount == 0) {
+    m_batchRequestCount  = 0;
+    m_batchFinishedCount = 0;
+  }
+
+  ++m_stats.loadingCount;
+  ++m_batchRequestCount;
+  m_stats.progress = static_cast<float>(m_batchFinishedCount) / static_cast<float>(m_batchRequestCount);
+
+  AssetHandle<AssetT> handle(entry);
+  enqueue(std::move(entry));
+
+  return handle;
+}
+
+AssetHandle<Image> AssetManager::loadImage(const FilePath& filePath, bool flipVertically) {
+  return request<ImageEntry>(filePath, std::string("image;") + (flipVertically ? "flip;" : ";"), flipVertically);
+}
+
+AssetHandle<Texture> AssetManager::loadTexture(const FilePath& filePath, int bindingIndex, bool flipVertically, bool createMipmaps) {
+  std::string key = "texture;" + std::to_string(bindingIndex) + (flipVertically ? ";flip" : ";") + (createMipmaps ? ";mipmaps;" : ";;");
+  return request<TextureEntry>(filePath, std::move(key), bindingIndex, flipVertically, createMipmaps);
+}
+
+AssetHandle<Mesh> AssetManager::loadMesh(const FilePath& filePath) {
+  return request<MeshEntry>(filePath, "mesh;");
+}
+
+AssetHandle<Sound> AssetManager::loadSound(const FilePath& filePath) {
+  return request<SoundEntry>(filePath, "sound;");
+}
+
+std::size_t AssetManager::update() {
+  const Clock::time_point startTime = Clock::now();
+  std::size_t finishedCount = 0;
+
+  while (true) {
+    std::shared_ptr<AssetEntry> entry;
+
+    {
+#if defined(RAZ_THREADS_AVAILABLE)
+      const std::lock_guard<std::mutex> lock(m_uploadMutex);
+#endif
+
+      if (m_uploadQueue.empty())
+        break;
+
+      entry = std::move(m_uploadQueue.front());
+      m_uploadQueue.pop_front();
+    }
+
+    finalize(*entry);
+    ++finishedCount;
+
+    if (computeMilliseconds(startTime, Clock::now()) >= m_uploadTimeBudget)
+      break;
+  }
+
+  m_stats.lastUpdateTime = computeMilliseconds(startTime, Clock::now());
+
+  return finishedCount;
+}
+
+std::size_t AssetManager::evictUnused() {
+  std::size_t evictedCount = 0;
+
+  for (auto entryIter = m_entries.begin(); entryIter != m_entries.end();) {
+    const AssetEntry& entry = *entryIter->second;
+
+    // Assets still loading are kept, the manager being the only one to finalize them
+    if (entry.m_state == AssetState::LOADING || entry.m_referenceCount > 0 || entry.isAssetShared()) {
+      ++entryIter;
+      continue;
+    }
+
+    if (entry.m_state == AssetState::LOADED)
+      --m_stats.loadedCount;
+    else
+      --m_stats.failedCount;
+
+    entryIter = m_entries.erase(entryIter);
+    ++evictedCount;
+  }
+
+  m_stats.evictedCount += evictedCount;
+
+  return evictedCount;
+}
+
+AssetManager::~AssetManager() {
+#if defined(RAZ_THREADS_AVAILABLE)
+  {
+    const std::lock_guard<std::mutex> lock(m_decodeMutex);
+    m_isStopping = true;
+  }
+
+  m_decodeCondition.notify_all();
+
+  for (std::thread& worker : m_workers)
+    worker.join();
+#endif
+}
+
+std::size_t AssetManager::defaultWorkerCount() noexcept {
+#if defined(RAZ_THREADS_AVAILABLE)
+  // One thread is kept for the one updating the manager
+  return std::max(Threading::getSystemThreadCount(), 2u) - 1;
+#else
+  return 0;
+#endif
+}
+
+void AssetManager::enqueue(std::shared_ptr<AssetEntry> entry) {
+#if defined(RAZ_THREADS_AVAILABLE)
+  {
+    const std::lock_guard<std::mutex> lock(m_decodeMutex);
+    m_decodeQueue.push_back(std::move(entry));
+  }
+
+  m_decodeCondition.notify_one();
+#else
+  decode(std::move(entry));
+#endif
+}
+
+void AssetManager::decode(std::shared_ptr<AssetEntry> entry) {
+  const Clock::time_point startTime = Clock::now();
+
+  try {
+    entry->decode();
+  } catch (const std::exception& exception) {
+    entry->m_error = exception.what();
+  }
+
+  entry->m_decodeTime = computeMilliseconds(startTime, Clock::now());
+
+  // Even if the asset is already available or has failed, its state is only changed by the manager, which keeps the statistics
+  {
+#if defined(RAZ_THREADS_AVAILABLE)
+    const std::lock_guard<std::mutex> lock(m_uploadMutex);
+#endif
+    m_uploadQueue.push_back(std::move(entry));
+  }
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  m_uploadCondition.notify_all();
+#endif
+}
+
+void AssetManager::finalize(AssetEntry& entry) {
+  if (entry.m_error.empty()) {
+    const Clock::time_point startTime = Clock::now();
+
+    try {
+      entry.upload();
+    } catch (const std::exception& exception) {
+      entry.m_error = exception.what();
+    }
+
+    m_totalUploadTime += static_cast<double>(computeMilliseconds(startTime, Clock::now()));
+    ++m_uploadCount;
+    m_stats.averageUploadTime = static_cast<float>(m_totalUploadTime / static_cast<double>(m_uploadCount));
+  }
+
+  const float latency = computeMilliseconds(entry.m_requestTime, Clock::now());
+
+  ++m_finishedCount;
+  m_totalLatency    += static_cast<double>(latency);
+  m_totalDecodeTime += static_cast<double>(entry.m_decodeTime);
+
+  m_stats.averageLatency    = static_cast<float>(m_totalLatency / static_cast<double>(m_finishedCount));
+  m_stats.maxLatency        = std::max(m_stats.maxLatency, latency);
+  m_stats.averageDecodeTime = static_cast<float>(m_totalDecodeTime / static_cast<double>(m_finishedCount));
+
+  --m_stats.loadingCount;
+  ++m_batchFinishedCount;
+  m_stats.progress = static_cast<float>(m_batchFinishedCount) / static_cast<float>(m_batchRequestCount);
+
+  if (entry.m_error.empty()) {
+    ++m_stats.loadedCount;
+    entry.m_state = AssetState::LOADED;
+  } else {
+    ++m_stats.failedCount;
+    entry.m_state = AssetState::FAILED;
+  }
+}
+
+void AssetManager::wait(const AssetEntry* entry) {
+  while (entry ? entry->m_state == AssetState::LOADING : m_stats.loadingCount > 0) {
+    std::shared_ptr<AssetEntry> readyEntry;
+
+    {
+#if defined(RAZ_THREADS_AVAILABLE)
+      std::unique_lock<std::mutex> lock(m_uploadMutex);
+      m_uploadCondition.wait(lock, [this] () { return !m_uploadQueue.empty(); });
+#else
+      // Without threads, assets are decoded as soon as requested; any asset still loading is thus waiting to be uploaded
+      assert("Error: No asset is ready to be uploaded." && !m_uploadQueue.empty());
+#endif
+
+      readyEntry = std::move(m_uploadQueue.front());
+      m_uploadQueue.pop_front();
+    }
+
+    finalize(*readyEntry);
+  }
+}
+
+} // namespace Raz
@@ -4,6 +4,7 @@
 #include <fbxsdk.h>
 #include <fstream>
 #include <iostream>
+#include <optional>
 
 namespace Raz {
 
@@ -116,57 +117,33 @@ void Mesh::importFbx(const FilePath& filePath) {
     addSubmesh(std::move(submesh));
   }
 
-  // Recovering materials
+  // Recovering materials; these can only be created once a graphics context is available, their properties being thus extracted beforehand
+  const FilePath texturePath = filePath.recoverPathToFile();
+
   for (int matIndex = 0; matIndex < scene->GetMaterialCount(); ++matIndex) {
     const FbxSurfaceMaterial* fbxMaterial = scene->GetMaterial(matIndex);
-    auto material = MaterialBlinnPhong::create();
-
-    const FbxPropertyT<FbxDouble3>& ambient = fbxMaterial->FindProperty(FbxSurfaceMaterial::sAmbient);
-    if (ambient.IsValid())
-      material->setAmbient(static_cast<float>(ambient.Get()[0]),
-                           static_cast<float>(ambient.Get()[1]),
-                           static_cast<float>(ambient.Get()[2]));
-
-    const FbxPropertyT<FbxDouble3>& diffuse = fbxMaterial->FindProperty(FbxSurfaceMaterial::sDiffuse);
-    if (diffuse.IsValid())
-      material->setDiffuse(static_cast<float>(diffuse.Get()[0]),
-                           static_cast<float>(diffuse.Get()[1]),
-                           static_cast<float>(diffuse.Get()[2]));
-
-    const FbxPropertyT<FbxDouble3>& specular = fbxMaterial->FindProperty(FbxSurfaceMaterial::sSpecular);
-    if (specular.IsValid())
-      material->setSpecular(static_cast<float>(specular.Get()[0]),
-                            static_cast<float>(specular.Get()[1]),
-                            static_cast<float>(specular.Get()[2]));
 
-    const FbxPropertyT<FbxDouble3>& emissive = fbxMaterial->FindProperty(FbxSurfaceMaterial::sEmissive);
-    if (emissive.IsValid())
-      material->setEmissive(static_cast<float>(emissive.Get()[0]),
-                            static_cast<float>(emissive.Get()[1]),
-                            static_cast<float>(emissive.Get()[2]));
+    const auto recoverColor = [] (const FbxPropertyT<FbxDouble3>& property) -> std::optional<Vec3f> {
+      if (!property.IsValid())
+        return std::nullopt;
 
-    const FbxPropertyT<FbxDouble>& transparency = fbxMaterial->FindProperty(FbxSurfaceMaterial::sTransparencyFactor);
-    if (transparency.IsValid())
-      material->setTransparency(static_cast<float>(transparency.Get()));
+      return Vec3f(static_cast<float>(property.Get()[0]), static_cast<float>(property.Get()[1]), static_cast<float>(property.Get()[2]));
+    };
 
     // Recovering textures
-    const FilePath texturePath = filePath.recoverPathToFile();
-
-    const auto* diffuseTexture = static_cast<FbxFileTexture*>(diffuse.GetSrcObject(FbxCriteria::ObjectType(FbxFileTexture::ClassId)));
-    if (diffuseTexture)
-      material->loadDiffuseMap(texturePath + diffuseTexture->GetRelativeFileName(), 0);
-
-    const auto* ambientTexture = static_cast<FbxFileTexture*>(ambient.GetSrcObject(FbxCriteria::ObjectType(FbxFileTexture::ClassId)));
-    if (ambientTexture)
-      material->loadAmbientMap(texturePath + ambientTexture->GetRelativeFileName(), 1);
+    const auto recoverTexturePath = [&texturePath] (const FbxPropertyT<FbxDouble3>& property) {
+      const auto* texture = static_cast<FbxFileTexture*>(property.GetSrcObject(FbxCriteria::ObjectType(FbxFileTexture::ClassId)));
+      return (texture ? texturePath + texture->GetRelativeFileName() : std::string());
+    };
 
-    const auto* specularTexture = static_cast<FbxFileTexture*>(specular.GetSrcObject(FbxCriteria::ObjectType(FbxFileTexture::ClassId)));
-    if (specularTexture)
-      material->loadSpecularMap(texturePath + specularTexture->GetRelativeFileName(), 2);
+    const FbxPropertyT<FbxDouble3>& ambient  = fbxMaterial->FindProperty(FbxSurfaceMaterial::sAmbient);
+    const FbxPropertyT<FbxDouble3>& diffuse  = fbxMaterial->FindProperty(FbxSurfaceMaterial::sDiffuse);
+    const FbxPropertyT<FbxDouble3>& specular = fbxMaterial->FindProperty(FbxSurfaceMaterial::sSpecular);
+    const FbxPropertyT<FbxDouble3>& emissive = fbxMaterial->FindProperty(FbxSurfaceMaterial::sEmissive);
 
-    const auto* emissiveTexture = static_cast<FbxFileTexture*>(emissive.GetSrcObject(FbxCriteria::ObjectType(FbxFileTexture::ClassId)));
-    if (emissiveTexture)
-      material->loadEmissiveMap(texturePath + emissiveTexture->GetRelativeFileName(), 3);
+    const FbxPropertyT<FbxDouble>& transparencyProp = fbxMaterial->FindProperty(FbxSurfaceMaterial::sTransparencyFactor);
+    const std::optional<float> transparency = (transparencyProp.IsValid() ? std::optional<float>(static_cast<float>(transparencyProp.Get()))
+                                                                           : std::nullopt);
 
     // Normal map not yet handled for standard materials
     /*const auto normMapProp = fbxMaterial->FindProperty(FbxSurfaceMaterial::sNormalMap);
@@ -176,7 +153,34 @@ void Mesh::importFbx(const FilePath& filePath) {
         material->loadNormalMap(texturePath + normalMap->GetRelativeFileName());
     }*/
 
-    addMaterial(std::move(material));
+    m_materialCreations.emplace_back([ambientColor = recoverColor(ambient), diffuseColor = recoverColor(diffuse),
+                                      specularColor = recoverColor(specular), emissiveColor = recoverColor(emissive), transparency,
+                                      diffuseMapPath = recoverTexturePath(diffuse), ambientMapPath = recoverTexturePath(ambient),
+                                      specularMapPath = recoverTexturePath(specular), emissiveMapPath = recoverTexturePath(emissive)] (Mesh& mesh) {
+      auto material = MaterialBlinnPhong::create();
+
+      if (ambientColor)
+        material->setAmbient(*ambientColor);
+      if (diffuseColor)
+        material->setDiffuse(*diffuseColor);
+      if (specularColor)
+        material->setSpecular(*specularColor);
+      if (emissiveColor)
+        material->setEmissive(*emissiveColor);
+      if (transparency)
+        material->setTransparency(*transparency);
+
+      if (!diffuseMapPath.empty())
+        material->loadDiffuseMap(diffuseMapPath, 0);
+      if (!ambientMapPath.empty())
+        material->loadAmbientMap(ambientMapPath, 1);
+      if (!specularMapPath.empty())
+        material->loadSpecularMap(specularMapPath, 2);
+      if (!emissiveMapPath.empty())
+        material->loadEmissiveMap(emissiveMapPath, 3);
+
+      mesh.addMaterial(std::move(material));
+    });
   }
 }
 
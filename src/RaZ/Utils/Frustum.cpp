@@ -0,0 +1,267 @@
+#include "RaZ/Math/SimdLanes.hpp"
+#include "RaZ/Math/TransformBatch.hpp"
+#include "RaZ/Utils/Frustum.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <cmath>
+
+namespace Raz {
+
+namespace {
+
+#if defined(RAZ_THREADS_AVAILABLE)
+constexpr std::size_t parallelCullingThreshold = 16384; // Number of objects from which a batch visibility computation is split across threads
+#endif
+
+using SimdLanes::ScalarLanes;
+
+// Coefficients of the frustum's planes, along with the absolute values of their normals' components used to project the boxes' extents
+struct PlaneCoeffs {
+  std::array<float, 6> normalX;
+  std::array<float, 6> normalY;
+  std::array<float, 6> normalZ;
+  std::array<float, 6> absNormalX;
+  std::array<float, 6> absNormalY;
+  std::array<float, 6> absNormalZ;
+  std::array<float, 6> distance;
+};
+
+PlaneCoeffs computePlaneCoeffs(const std::array<Plane, 6>& planes) {
+  PlaneCoeffs coeffs {};
+
+  for (std::size_t planeIndex = 0; planeIndex < planes.size(); ++planeIndex) {
+    const Vec3f& normal = planes[planeIndex].getNormal();
+
+    coeffs.normalX[planeIndex]    = normal.x();
+    coeffs.normalY[planeIndex]    = normal.y();
+    coeffs.normalZ[planeIndex]    = normal.z();
+    coeffs.absNormalX[planeIndex] = std::abs(normal.x());
+    coeffs.absNormalY[planeIndex] = std::abs(normal.y());
+    coeffs.absNormalZ[planeIndex] = std::abs(normal.z());
+    coeffs.distance[planeIndex]   = planes[planeIndex].getDistance();
+  }
+
+  return coeffs;
+}
+
+// Masks of the objects found outside of at least one plane, & of those crossing at least one plane
+template <typename LanesT>
+struct CullingMasks {
+  typename LanesT::Mask outside;
+  typename LanesT::Mask intersecting;
+};
+
+// Tests several objects at once against all planes, each object being represented by its center & its radius projected onto each plane's normal
+// A sphere's projected radius is its radius, while a box's is the sum of its extents weighted by the absolute values of the normal's components
+template <typename LanesT, typename RadiusFuncT>
+CullingMasks<LanesT> computeCullingMasks(const PlaneCoeffs& coeffs, LanesT centerX, LanesT centerY, LanesT centerZ, const RadiusFuncT& computeRadius) {
+  CullingMasks<LanesT> masks { LanesT::noMask(), LanesT::noMask() };
+
+  for (std::size_t planeIndex = 0; planeIndex < 6; ++planeIndex) {
+    const LanesT signedDist = LanesT::broadcast(coeffs.normalX[planeIndex]) * centerX
+                            + LanesT::broadcast(coeffs.normalY[planeIndex]) * centerY
+                            + LanesT::broadcast(coeffs.normalZ[planeIndex]) * centerZ
+                            - LanesT::broadcast(coeffs.distance[planeIndex]);
+    const LanesT radius     = computeRadius(planeIndex);
+
+    masks.outside      = LanesT::maskOr(masks.outside, LanesT::less(signedDist + radius, LanesT::broadcast(0.f)));
+    masks.intersecting = LanesT::maskOr(masks.intersecting, LanesT::less(signedDist - radius, LanesT::broadcast(0.f)));
+  }
+
+  return masks;
+}
+
+template <typename LanesT>
+CullingMasks<LanesT> computeSphereMasks(const PlaneCoeffs& coeffs, LanesT centerX, LanesT centerY, LanesT centerZ, LanesT radius) {
+  return computeCullingMasks(coeffs, centerX, centerY, centerZ, [radius] (std::size_t) { return radius; });
+}
+
+template <typename LanesT>
+CullingMasks<LanesT> computeBoxMasks(const PlaneCoeffs& coeffs, LanesT minX, LanesT minY, LanesT minZ, LanesT maxX, LanesT maxY, LanesT maxZ) {
+  // The center & half extents are computed the same way as by AABB::computeCentroid() & AABB::computeHalfExtents()
+  const LanesT half    = LanesT::broadcast(0.5f);
+  const LanesT extentX = (maxX - minX) * half;
+  const LanesT extentY = (maxY - minY) * half;
+  const LanesT extentZ = (maxZ - minZ) * half;
+
+  return computeCullingMasks(coeffs, (maxX + minX) * half, (maxY + minY) * half, (maxZ + minZ) * half,
+                             [&coeffs, extentX, extentY, extentZ] (std::size_t planeIndex) {
+    return LanesT::broadcast(coeffs.absNormalX[planeIndex]) * extentX
+         + LanesT::broadcast(coeffs.absNormalY[planeIndex]) * extentY
+         + LanesT::broadcast(coeffs.absNormalZ[planeIndex]) * extentZ;
+  });
+}
+
+// Converts the masks of several objects into their visibilities
+template <typename LanesT>
+void storeVisibilities(const CullingMasks<LanesT>& masks, Visibility* visibilities) {
+  const uint32_t outsideBits      = LanesT::toBits(masks.outside);
+  const uint32_t intersectingBits = LanesT::toBits(masks.intersecting);
+
+  for (std::size_t laneIndex = 0; laneIndex < LanesT::Size; ++laneIndex) {
+    const uint32_t laneBit = (1u << laneIndex);
+    visibilities[laneIndex] = ((outsideBits & laneBit) ? Visibility::OUTSIDE
+                            : ((intersectingBits & laneBit) ? Visibility::INTERSECTING : Visibility::INSIDE));
+  }
+}
+
+// Applies a culling kernel on all objects of a batch, splitting them across threads if there are enough
+template <typename KernelT>
+void processBatch(const std::vector<float>& batchValues, const KernelT& kernel) {
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (batchValues.size() >= parallelCullingThreshold) {
+    Threading::parallelize(batchValues, [&kernel] (Threading::IndexRange range) {
+      SimdLanes::processLanes(range.beginIndex, range.endIndex, kernel);
+    });
+    return;
+  }
+#endif
+
+  SimdLanes::processLanes(0, batchValues.size(), kernel);
+}
+
+// Extracts the planes from the columns of the view-projection matrix: a point is inside the frustum if its clip coordinates are all between -w & w
+// The matrix being applied to row vectors, each clip coordinate is the dot product between the homogeneous point & a column
+std::array<Plane, 6> extractPlanes(const Mat4f& viewProjMat) {
+  std::array<Vec4f, 6> planeCoeffs {};
+
+#if defined(RAZ_SIMD_LANES_SSE)
+  const float* matValues = viewProjMat.getDataPtr();
+
+  // Transposing the matrix to get its columns in registers
+  const __m128 row0 = _mm_loadu_ps(matValues);
+  const __m128 row1 = _mm_loadu_ps(matValues + 4);
+  const __m128 row2 = _mm_loadu_ps(matValues + 8);
+  const __m128 row3 = _mm_loadu_ps(matValues + 12);
+
+  const __m128 low01  = _mm_unpacklo_ps(row0, row1);
+  const __m128 high01 = _mm_unpackhi_ps(row0, row1);
+  const __m128 low23  = _mm_unpacklo_ps(row2, row3);
+  const __m128 high23 = _mm_unpackhi_ps(row2, row3);
+
+  const __m128 column0 = _mm_movelh_ps(low01, low23);
+  const __m128 column1 = _mm_movehl_ps(low23, low01);
+  const __m128 column2 = _mm_movelh_ps(high01, high23);
+  const __m128 column3 = _mm_movehl_ps(high23, high01);
+
+  _mm_storeu_ps(planeCoeffs[0].getDataPtr(), _mm_add_ps(column3, column0));
+  _mm_storeu_ps(planeCoeffs[1].getDataPtr(), _mm_sub_ps(column3, column0));
+  _mm_storeu_ps(planeCoeffs[2].getDataPtr(), _mm_add_ps(column3, column1));
+  _mm_storeu_ps(planeCoeffs[3].getDataPtr(), _mm_sub_ps(column3, column1));
+  _mm_storeu_ps(planeCoeffs[4].getDataPtr(), _mm_add_ps(column3, column2));
+  _mm_storeu_ps(planeCoeffs[5].getDataPtr(), _mm_sub_ps(column3, column2));
+#else
+  const Vec4f lastColumn = viewProjMat.recoverColumn(3);
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    const Vec4f column = viewProjMat.recoverColumn(axisIndex);
+
+    planeCoeffs[axisIndex * 2]     = lastColumn + column;
+    planeCoeffs[axisIndex * 2 + 1] = lastColumn - column;
+  }
+#endif
+
+  // The planes' equations being ax + by + cz + d = 0, the normals must be normalized & the distances negated to match the Plane's definition
+  const auto createPlane = [] (const Vec4f& coeffs) {
+    const Vec3f normal  = Vec3f(coeffs.x(), coeffs.y(), coeffs.z());
+    const float invNorm = 1.f / normal.computeLength();
+
+    return Plane(-coeffs.w() * invNorm, normal * invNorm);
+  };
+
+  return { createPlane(planeCoeffs[0]), createPlane(planeCoeffs[1]), createPlane(planeCoeffs[2]),
+           createPlane(planeCoeffs[3]), createPlane(planeCoeffs[4]), createPlane(planeCoeffs[5]) };
+}
+
+Visibility recoverVisibility(const CullingMasks<ScalarLanes>& masks) {
+  Visibility visibility {};
+  storeVisibilities(masks, &visibility);
+  return visibility;
+}
+
+} // namespace
+
+Frustum::Frustum(const Mat4f& viewProjMat) : m_planes{ extractPlanes(viewProjMat) } {}
+
+bool Frustum::contains(const Vec3f& point) const {
+  for (const Plane& plane : m_planes) {
+    if (plane.getNormal().dot(point) - plane.getDistance() < 0.f)
+      return false;
+  }
+
+  return true;
+}
+
+Visibility Frustum::computeVisibility(const Sphere& sphere) const {
+  const Vec3f& center = sphere.getCenter();
+  return recoverVisibility(computeSphereMasks(computePlaneCoeffs(m_planes), ScalarLanes{ center.x() }, ScalarLanes{ center.y() },
+                                                   ScalarLanes{ center.z() }, ScalarLanes{ sphere.getRadius() }));
+}
+
+Visibility Frustum::computeVisibility(const AABB& aabb) const {
+  const Vec3f& minPos = aabb.getLeftBottomBackPos();
+  const Vec3f& maxPos = aabb.getRightTopFrontPos();
+
+  return recoverVisibility(computeBoxMasks(computePlaneCoeffs(m_planes),
+                                                ScalarLanes{ minPos.x() }, ScalarLanes{ minPos.y() }, ScalarLanes{ minPos.z() },
+                                                ScalarLanes{ maxPos.x() }, ScalarLanes{ maxPos.y() }, ScalarLanes{ maxPos.z() }));
+}
+
+Visibility Frustum::computeVisibility(const OBB& obb) const {
+  const Vec3f center      = obb.computeCentroid();
+  const Vec3f halfExtents = (obb.getRightTopFrontPos() - obb.getLeftBottomBackPos()) * 0.5f;
+  const Mat3f& rotation   = obb.getRotation();
+
+  Visibility visibility = Visibility::INSIDE;
+
+  for (const Plane& plane : m_planes) {
+    const Vec3f& normal = plane.getNormal();
+
+    // Each local axis of the box is given by a row of its rotation; the box's radius along the normal is the sum of its projected half extents
+    float radius = 0.f;
+    for (std::size_t localAxisIndex = 0; localAxisIndex < 3; ++localAxisIndex)
+      radius += halfExtents[localAxisIndex] * std::abs(normal.dot(rotation.recoverRow(localAxisIndex)));
+
+    const float signedDist = normal.dot(center) - plane.getDistance();
+
+    if (signedDist + radius < 0.f)
+      return Visibility::OUTSIDE;
+
+    if (signedDist - radius < 0.f)
+      visibility = Visibility::INTERSECTING;
+  }
+
+  return visibility;
+}
+
+void Frustum::computeVisibility(const SphereBatch& spheres, std::vector<Visibility>& visibilities) const {
+  visibilities.resize(spheres.getCount());
+
+  const PlaneCoeffs coeffs = computePlaneCoeffs(m_planes);
+
+  processBatch(spheres.radius, [&spheres, &visibilities, &coeffs] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+
+    storeVisibilities(computeSphereMasks(coeffs, LanesT::load(spheres.centerX.data() + index), LanesT::load(spheres.centerY.data() + index),
+                                         LanesT::load(spheres.centerZ.data() + index), LanesT::load(spheres.radius.data() + index)),
+                      visibilities.data() + index);
+  });
+}
+
+void Frustum::computeVisibility(const BoxBatch& boxes, std::vector<Visibility>& visibilities) const {
+  visibilities.resize(boxes.getCount());
+
+  const PlaneCoeffs coeffs = computePlaneCoeffs(m_planes);
+
+  processBatch(boxes.minX, [&boxes, &visibilities, &coeffs] (auto lanesTag, std::size_t index) {
+    using LanesT = decltype(lanesTag);
+
+    storeVisibilities(computeBoxMasks(coeffs,
+                                      LanesT::load(boxes.minX.data() + index), LanesT::load(boxes.minY.data() + index),
+                                      LanesT::load(boxes.minZ.data() + index), LanesT::load(boxes.maxX.data() + index),
+                                      LanesT::load(boxes.maxY.data() + index), LanesT::load(boxes.maxZ.data() + index)),
+                      visibilities.data() + index);
+  });
+}
+
+} // namespace Raz
@@ -0,0 +1,108 @@
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/MappedFile.hpp"
+
+#if defined(RAZ_PLATFORM_WINDOWS) && !defined(RAZ_PLATFORM_CYGWIN)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <stdexcept>
+#include <utility>
+
+namespace Raz {
+
+MappedFile::MappedFile(const FilePath& filePath) {
+#if defined(RAZ_PLATFORM_WINDOWS) && !defined(RAZ_PLATFORM_CYGWIN)
+  const HANDLE fileHandle = CreateFileW(filePath.toWide().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+  if (fileHandle == INVALID_HANDLE_VALUE)
+    throw std::invalid_argument("Error: Couldn't open the file '" + filePath + "'");
+
+  LARGE_INTEGER fileSize {};
+  if (!GetFileSizeEx(fileHandle, &fileSize)) {
+    CloseHandle(fileHandle);
+    throw std::invalid_argument("Error: Couldn't recover the size of the file '" + filePath + "'");
+  }
+
+  m_size = static_cast<std::size_t>(fileSize.QuadPart);
+
+  if (m_size == 0) { // Empty files can't be mapped
+    CloseHandle(fileHandle);
+    return;
+  }
+
+  const HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  void* data = (mappingHandle ? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr);
+
+  // The view keeps references to the mapping & to the file, which can thus be closed right away
+  if (mappingHandle)
+    CloseHandle(mappingHandle);
+  CloseHandle(fileHandle);
+
+  if (data == nullptr)
+    throw std::invalid_argument("Error: Couldn't map the file '" + filePath + "'");
+#else
+  const int fileDescriptor = open(filePath.toUtf8().c_str(), O_RDONLY);
+
+  if (fileDescriptor == -1)
+    throw std::invalid_argument("Error: Couldn't open the file '" + filePath + "'");
+
+  struct stat fileStats {};
+  if (fstat(fileDescriptor, &fileStats) == -1) {
+    close(fileDescriptor);
+    throw std::invalid_argument("Error: Couldn't recover the size of the file '" + filePath + "'");
+  }
+
+  m_size = static_cast<std::size_t>(fileStats.st_size);
+
+  if (m_size == 0) { // Empty files can't be mapped
+    close(fileDescriptor);
+    return;
+  }
+
+  void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+  // The mapping keeps a reference to the file, which can thus be closed right away
+  close(fileDescriptor);
+
+  if (data == MAP_FAILED)
+    throw std::invalid_argument("Error: Couldn't map the file '" + filePath + "'");
+#endif
+
+  m_data = static_cast<const char*>(data);
+}
+
+MappedFile::MappedFile(MappedFile&& mappedFile) noexcept
+  : m_data{ std::exchange(mappedFile.m_data, nullptr) }, m_size{ std::exchange(mappedFile.m_size, 0) } {}
+
+MappedFile& MappedFile::operator=(MappedFile&& mappedFile) noexcept {
+  if (this == &mappedFile)
+    return *this;
+
+  unmap();
+
+  m_data = std::exchange(mappedFile.m_data, nullptr);
+  m_size = std::exchange(mappedFile.m_size, 0);
+
+  return *this;
+}
+
+void MappedFile::unmap() noexcept {
+  if (m_data == nullptr)
+    return;
+
+#if defined(RAZ_PLATFORM_WINDOWS) && !defined(RAZ_PLATFORM_CYGWIN)
+  UnmapViewOfFile(m_data);
+#else
+  munmap(const_cast<char*>(m_data), m_size);
+#endif
+
+  m_data = nullptr;
+  m_size = 0;
+}
+
+} // namespace Raz
@@ -6,18 +6,17 @@
 
 namespace Raz {
 
-namespace {
-
-void saveMtl(const FilePath& mtlFilePath, const std::vector<MaterialPtr>& materials) {
+void Mesh::saveMtl(const FilePath& mtlFilePath) const {
   std::ofstream mtlFile(mtlFilePath, std::ios_base::out | std::ios_base::binary);
 
   mtlFile << "# MTL file created with RaZ - https://github.com/Razakhel/RaZ\n";
 
-  const std::string mtlFileName   = mtlFilePath.recoverFileName(false).toUtf8();
-  const TexturePtr defaultTexture = Texture::create(ColorPreset::WHITE);
+  const std::string mtlFileName = mtlFilePath.recoverFileName(false).toUtf8();
+  // Textures are referenced relatively to the MTL file, thus saved next to it
+  const FilePath mtlFolderPath = mtlFilePath.recoverPathToFile();
 
-  for (std::size_t matIndex = 0; matIndex < materials.size(); ++matIndex) {
-    const MaterialPtr& material    = materials[matIndex];
+  for (std::size_t matIndex = 0; matIndex < m_materials.size(); ++matIndex) {
+    const MaterialPtr& material    = m_materials[matIndex];
     const std::string materialName = mtlFileName + '_' + std::to_string(matIndex);
 
     mtlFile << "\nnewmtl " << materialName << '\n';
@@ -29,39 +28,39 @@ void saveMtl(const FilePath& mtlFilePath, const std::vector<MaterialPtr>& materi
       mtlFile << "\tPm " << matCT->getMetallicFactor() << '\n';
       mtlFile << "\tPr " << matCT->getRoughnessFactor() << '\n';
 
-      if (matCT->getAlbedoMap() && matCT->getAlbedoMap() != defaultTexture) {
+      if (matCT->getAlbedoMap() && !matCT->getAlbedoMap()->getImage().isEmpty()) {
         const auto albedoMapPath = materialName + "_albedo.png";
 
         mtlFile << "\tmap_Kd " << albedoMapPath << '\n';
-        matCT->getAlbedoMap()->save(albedoMapPath, true);
+        matCT->getAlbedoMap()->save(mtlFolderPath + albedoMapPath, true);
       }
 
-      if (matCT->getNormalMap() && matCT->getNormalMap() != defaultTexture) {
+      if (matCT->getNormalMap() && !matCT->getNormalMap()->getImage().isEmpty()) {
         const auto normalMapPath = materialName + "_normal.png";
 
         mtlFile << "\tnorm " << normalMapPath << '\n';
-        matCT->getNormalMap()->save(normalMapPath, true);
+        matCT->getNormalMap()->save(mtlFolderPath + normalMapPath, true);
       }
 
-      if (matCT->getMetallicMap() && matCT->getMetallicMap() != defaultTexture) {
+      if (matCT->getMetallicMap() && !matCT->getMetallicMap()->getImage().isEmpty()) {
         const auto metallicMapPath = materialName + "_metallic.png";
 
         mtlFile << "\tmap_Pm " << metallicMapPath << '\n';
-        matCT->getMetallicMap()->save(metallicMapPath, true);
+        matCT->getMetallicMap()->save(mtlFolderPath + metallicMapPath, true);
       }
 
-      if (matCT->getRoughnessMap() && matCT->getRoughnessMap() != defaultTexture) {
+      if (matCT->getRoughnessMap() && !matCT->getRoughnessMap()->getImage().isEmpty()) {
         const auto roughnessMapPath = materialName + "_roughness.png";
 
         mtlFile << "\tmap_Pr " << roughnessMapPath << '\n';
-        matCT->getRoughnessMap()->save(roughnessMapPath, true);
+        matCT->getRoughnessMap()->save(mtlFolderPath + roughnessMapPath, true);
       }
 
-      if (matCT->getAmbientOcclusionMap() && matCT->getAmbientOcclusionMap() != defaultTexture) {
+      if (matCT->getAmbientOcclusionMap() && !matCT->getAmbientOcclusionMap()->getImage().isEmpty()) {
         const auto ambOccMapPath = materialName + "_ambient_occlusion.png";
 
         mtlFile << "\tmap_Ka " << ambOccMapPath << '\n';
-        matCT->getAmbientOcclusionMap()->save(ambOccMapPath, true);
+        matCT->getAmbientOcclusionMap()->save(mtlFolderPath + ambOccMapPath, true);
       }
     } else {
       const auto* matBP = static_cast<MaterialBlinnPhong*>(material.get());
@@ -71,53 +70,51 @@ void saveMtl(const FilePath& mtlFilePath, const std::vector<MaterialPtr>& materi
       mtlFile << "\tKe " << matBP->getEmissive()[0] << ' ' << matBP->getEmissive()[1] << ' ' << matBP->getEmissive()[2] << '\n';
       mtlFile << "\td  " << matBP->getTransparency() << '\n';
 
-      if (matBP->getDiffuseMap() && matBP->getDiffuseMap() != defaultTexture) {
+      if (matBP->getDiffuseMap() && !matBP->getDiffuseMap()->getImage().isEmpty()) {
         const auto diffuseMapPath = materialName + "_diffuse.png";
 
         mtlFile << "\tmap_Kd " << diffuseMapPath << '\n';
-        matBP->getDiffuseMap()->save(diffuseMapPath, true);
+        matBP->getDiffuseMap()->save(mtlFolderPath + diffuseMapPath, true);
       }
 
-      if (matBP->getAmbientMap() && matBP->getAmbientMap() != defaultTexture) {
+      if (matBP->getAmbientMap() && !matBP->getAmbientMap()->getImage().isEmpty()) {
         const auto ambientMapPath = materialName + "_ambient.png";
 
         mtlFile << "\tmap_Ka " << ambientMapPath << '\n';
-        matBP->getAmbientMap()->save(ambientMapPath, true);
+        matBP->getAmbientMap()->save(mtlFolderPath + ambientMapPath, true);
       }
 
-      if (matBP->getSpecularMap() && matBP->getSpecularMap() != defaultTexture) {
+      if (matBP->getSpecularMap() && !matBP->getSpecularMap()->getImage().isEmpty()) {
         const auto specularMapPath = materialName + "_specular.png";
 
         mtlFile << "\tmap_Ks " << specularMapPath << '\n';
-        matBP->getSpecularMap()->save(specularMapPath, true);
+        matBP->getSpecularMap()->save(mtlFolderPath + specularMapPath, true);
       }
 
-      if (matBP->getEmissiveMap() && matBP->getEmissiveMap() != defaultTexture) {
+      if (matBP->getEmissiveMap() && !matBP->getEmissiveMap()->getImage().isEmpty()) {
         const auto emissiveMapPath = materialName + "_emissive.png";
 
         mtlFile << "\tmap_Ke " << emissiveMapPath << '\n';
-        matBP->getEmissiveMap()->save(emissiveMapPath, true);
+        matBP->getEmissiveMap()->save(mtlFolderPath + emissiveMapPath, true);
       }
 
-      if (matBP->getTransparencyMap() && matBP->getTransparencyMap() != defaultTexture) {
+      if (matBP->getTransparencyMap() && !matBP->getTransparencyMap()->getImage().isEmpty()) {
         const auto transparencyMapPath = materialName + "_transparency.png";
 
         mtlFile << "\tmap_d " << transparencyMapPath << '\n';
-        matBP->getTransparencyMap()->save(transparencyMapPath, true);
+        matBP->getTransparencyMap()->save(mtlFolderPath + transparencyMapPath, true);
       }
 
-      if (matBP->getBumpMap() && matBP->getBumpMap() != defaultTexture) {
+      if (matBP->getBumpMap() && !matBP->getBumpMap()->getImage().isEmpty()) {
         const auto ambOccMapPath = materialName + "_bump.png";
 
         mtlFile << "\tmap_bump " << ambOccMapPath << '\n';
-        matBP->getBumpMap()->save(ambOccMapPath, true);
+        matBP->getBumpMap()->save(mtlFolderPath + ambOccMapPath, true);
       }
     }
   }
 }
 
-} // namespace
-
 void Mesh::saveObj(std::ofstream& file, const FilePath& filePath) const {
   file << "# OBJ file created with RaZ - https://github.com/Razakhel/RaZ\n\n";
 
@@ -129,7 +126,7 @@ void Mesh::saveObj(std::ofstream& file, const FilePath& filePath) const {
 
     std::ofstream mtlFile(mtlFilePath, std::ios_base::out | std::ios_base::binary);
 
-    saveMtl(mtlFilePath, m_materials);
+    saveMtl(mtlFilePath);
   }
 
   std::map<std::array<float, 3>, std::size_t> posCorrespIndices;
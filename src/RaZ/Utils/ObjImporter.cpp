@@ -1,9 +1,23 @@
 #include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/MeshUtils.hpp"
 #include "RaZ/Utils/FilePath.hpp"
-
+#include "RaZ/Utils/IndexMap.hpp"
+#include "RaZ/Utils/MappedFile.hpp"
+#include "RaZ/Utils/StrUtils.hpp"
+#include "RaZ/Utils/Threading.hpp"
+#include "RaZ/Utils/VirtualFileSystem.hpp"
+
+#include <cassert>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <fstream>
+#include <limits>
 #include <map>
+#include <optional>
 #include <sstream>
+#include <string_view>
 
 namespace Raz {
 
@@ -24,49 +38,537 @@ constexpr Vec3f computeTangent(const Vec3f& firstPos, const Vec3f& secondPos, co
   return tangent;
 }
 
-inline TexturePtr loadTexture(const FilePath& mtlFilePath, const FilePath& textureFilePath, int bindingIndex = 0) {
-  // Always apply a vertical flip to imported textures, since OpenGL maps them upside down
-  return Texture::create(mtlFilePath.recoverPathToFile() + textureFilePath, bindingIndex, true);
+// Maps of a material to which a texture can be assigned; some are shared by both kinds of materials (e.g. the diffuse & albedo maps)
+enum class MtlMap : std::size_t {
+  BASE_COLOR,
+  AMBIENT,
+  SPECULAR,
+  EMISSIVE,
+  METALLIC,
+  ROUGHNESS,
+  TRANSPARENCY,
+  BUMP,
+  NORMAL,
+
+  COUNT
+};
+
+// Material read from a library, created once a graphics context is available since its textures require one
+struct MtlMaterial {
+  bool isCookTorrance = false;
+  std::optional<Vec3f> ambient {};
+  std::optional<Vec3f> diffuse {};
+  std::optional<Vec3f> specular {};
+  std::optional<Vec3f> emissive {};
+  std::optional<float> transparency {};
+  std::optional<float> metallicFactor {};
+  std::optional<float> roughnessFactor {};
+  std::array<std::optional<std::size_t>, static_cast<std::size_t>(MtlMap::COUNT)> maps {}; // Indices of the images assigned to each map
+};
+
+// Image referenced by a material library, decoded along with all the others once the whole library has been parsed
+struct MtlTextureLoad {
+  FilePath filePath;
+  bool isCooked = false; // Textures converted by the asset cooker are loaded directly, with their precomputed mipmaps
+  Image image {};
+  std::exception_ptr error {};
+};
+
+struct MtlLibrary {
+  std::vector<MtlMaterial> materials;
+  std::unordered_map<std::string, std::size_t> loadIndices;
+  std::vector<MtlTextureLoad> loads;
+};
+
+inline std::size_t requestImage(const FilePath& mtlFilePath, const std::string& textureFilePath, MtlLibrary& library) {
+  // An image referenced several times is decoded only once; its textures are created later, once the kinds of the materials are known
+  const auto [loadIter, isNewImage] = library.loadIndices.emplace(textureFilePath, library.loads.size());
+
+  if (isNewImage)
+    library.loads.push_back(MtlTextureLoad{ mtlFilePath.recoverPathToFile() + textureFilePath });
+
+  return loadIter->second;
 }
 
-inline void importMtl(const FilePath& mtlFilePath,
-                      std::vector<MaterialPtr>& materials,
-                      std::unordered_map<std::string, std::size_t>& materialCorrespIndices) {
-  std::ifstream file(mtlFilePath, std::ios_base::in | std::ios_base::binary);
+// Recovers the binding index of the texture assigned to a map, which depends on the kind of the material; -1 if the map is not used by it
+constexpr int recoverBindingIndex(MtlMap map, bool isCookTorrance) noexcept {
+  if (isCookTorrance) {
+    switch (map) {
+      case MtlMap::BASE_COLOR: return 0;
+      case MtlMap::NORMAL:     return 1;
+      case MtlMap::METALLIC:   return 2;
+      case MtlMap::ROUGHNESS:  return 3;
+      case MtlMap::AMBIENT:    return 4;
+      default:                 return -1;
+    }
+  }
 
-  auto blinnPhongMaterial   = MaterialBlinnPhong::create();
-  auto cookTorranceMaterial = MaterialCookTorrance::create();
+  switch (map) {
+    case MtlMap::BASE_COLOR:   return 0;
+    case MtlMap::AMBIENT:      return 1;
+    case MtlMap::SPECULAR:     return 2;
+    case MtlMap::EMISSIVE:     return 3;
+    case MtlMap::TRANSPARENCY: return 4;
+    case MtlMap::BUMP:         return 5;
+    default:                   return -1;
+  }
+}
 
-  auto addLocalMaterial = [&blinnPhongMaterial, &cookTorranceMaterial, &materials] (bool isCookTorrance) {
-    if (isCookTorrance) {
-      cookTorranceMaterial->getAlbedoMap()->setBindingIndex(0);
-      cookTorranceMaterial->getNormalMap()->setBindingIndex(1);
-      cookTorranceMaterial->getMetallicMap()->setBindingIndex(2);
-      cookTorranceMaterial->getRoughnessMap()->setBindingIndex(3);
-      cookTorranceMaterial->getAmbientOcclusionMap()->setBindingIndex(4);
+inline Image copyImage(const Image& image) {
+  assert("Error: Only images holding bytes can be copied." && image.getDataType() == ImageDataType::BYTE);
 
-      materials.emplace_back(std::move(cookTorranceMaterial));
-    } else {
-      blinnPhongMaterial->getDiffuseMap()->setBindingIndex(0);
-      blinnPhongMaterial->getAmbientMap()->setBindingIndex(1);
-      blinnPhongMaterial->getSpecularMap()->setBindingIndex(2);
-      blinnPhongMaterial->getEmissiveMap()->setBindingIndex(3);
-      blinnPhongMaterial->getTransparencyMap()->setBindingIndex(4);
-      blinnPhongMaterial->getBumpMap()->setBindingIndex(5);
-
-      materials.emplace_back(std::move(blinnPhongMaterial));
+  Image copy(image.getWidth(), image.getHeight(), image.getColorspace());
+  std::memcpy(copy.getDataPtr(), image.getDataPtr(), static_cast<std::size_t>(image.getWidth()) * image.getHeight() * image.getChannelCount());
+
+  return copy;
+}
+
+void decodeImages(std::vector<MtlTextureLoad>& loads) {
+  const auto decodeRange = [&loads] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t loadIndex = beginIndex; loadIndex < endIndex; ++loadIndex) {
+      MtlTextureLoad& load = loads[loadIndex];
+      load.isCooked = (VirtualFileSystem::find(load.filePath).has_value() || StrUtils::toLowercaseCopy(load.filePath.recoverExtension().toUtf8()) == "raztex");
+
+      if (load.isCooked)
+        continue;
+
+      try {
+        // Always apply a vertical flip to imported textures, since OpenGL maps them upside down
+        load.image.read(load.filePath, true);
+      } catch (...) {
+        load.error = std::current_exception();
+      }
     }
   };
 
+  // Decoding all the images concurrently, the textures being only filled with them once a graphics context is available
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (loads.size() > 1)
+    Threading::parallelize(loads, [&decodeRange] (Threading::IndexRange range) { decodeRange(range.beginIndex, range.endIndex); });
+  else
+#endif
+    decodeRange(0, loads.size());
+
+  for (const MtlTextureLoad& load : loads) {
+    if (load.error)
+      std::rethrow_exception(load.error);
+  }
+}
+
+// Textures created from an image, referenced by the index of the latter & their binding index
+using MtlTextures = std::map<std::pair<std::size_t, int>, TexturePtr>;
+
+MtlTextures createTextures(MtlLibrary& library) {
+  // A texture is shared by all the maps referencing the same image with the same binding index, whatever the kind of their materials
+  MtlTextures textures;
+  std::vector<std::size_t> remainingTextureCounts(library.loads.size());
+
+  for (const MtlMaterial& mtlMaterial : library.materials) {
+    for (std::size_t mapIndex = 0; mapIndex < mtlMaterial.maps.size(); ++mapIndex) {
+      const std::optional<std::size_t>& loadIndex = mtlMaterial.maps[mapIndex];
+      const int bindingIndex = recoverBindingIndex(static_cast<MtlMap>(mapIndex), mtlMaterial.isCookTorrance);
+
+      if (loadIndex && bindingIndex >= 0 && textures.emplace(std::make_pair(*loadIndex, bindingIndex), nullptr).second)
+        ++remainingTextureCounts[*loadIndex];
+    }
+  }
+
+  for (auto& [textureKey, texture] : textures) {
+    const auto [loadIndex, bindingIndex] = textureKey;
+    MtlTextureLoad& load = library.loads[loadIndex];
+
+    if (load.isCooked) {
+      texture = Texture::create(load.filePath, bindingIndex, true);
+      continue;
+    }
+
+    // Each texture but the last of an image is given a copy of it; only images holding bytes can be copied, those holding floating-point
+    //  values being assigned to a single map, the others keeping their default texture
+    if (--remainingTextureCounts[loadIndex] == 0)
+      texture = Texture::create(std::move(load.image), bindingIndex);
+    else if (load.image.getDataType() == ImageDataType::BYTE)
+      texture = Texture::create(copyImage(load.image), bindingIndex);
+    else
+      std::cerr << "Error: The floating-point image '" << load.filePath << "' cannot be shared by several maps; only one of them is assigned\n";
+  }
+
+  return textures;
+}
+
+void createMaterials(MtlLibrary& library, Mesh& mesh) {
+  const MtlTextures textures = createTextures(library);
+
+  for (const MtlMaterial& mtlMaterial : library.materials) {
+    const auto recoverMap = [&textures, &mtlMaterial] (MtlMap map) {
+      const std::optional<std::size_t>& loadIndex = mtlMaterial.maps[static_cast<std::size_t>(map)];
+      return (loadIndex ? textures.at(std::make_pair(*loadIndex, recoverBindingIndex(map, mtlMaterial.isCookTorrance))) : nullptr);
+    };
+
+    if (mtlMaterial.isCookTorrance) {
+      auto material = MaterialCookTorrance::create();
+
+      if (mtlMaterial.metallicFactor)
+        material->setMetallicFactor(*mtlMaterial.metallicFactor);
+      if (mtlMaterial.roughnessFactor)
+        material->setRoughnessFactor(*mtlMaterial.roughnessFactor);
+
+      if (TexturePtr map = recoverMap(MtlMap::BASE_COLOR))
+        material->setAlbedoMap(std::move(map));
+      if (TexturePtr map = recoverMap(MtlMap::NORMAL))
+        material->setNormalMap(std::move(map));
+      if (TexturePtr map = recoverMap(MtlMap::METALLIC))
+        material->setMetallicMap(std::move(map));
+      if (TexturePtr map = recoverMap(MtlMap::ROUGHNESS))
+        material->setRoughnessMap(std::move(map));
+      if (TexturePtr map = recoverMap(MtlMap::AMBIENT))
+        material->setAmbientOcclusionMap(std::move(map));
+
+      material->getAlbedoMap()->setBindingIndex(0);
+      material->getNormalMap()->setBindingIndex(1);
+      material->getMetallicMap()->setBindingIndex(2);
+      material->getRoughnessMap()->setBindingIndex(3);
+      material->getAmbientOcclusionMap()->setBindingIndex(4);
+
+      mesh.addMaterial(std::move(material));
+    } else {
+      auto material = MaterialBlinnPhong::create();
+
+      if (mtlMaterial.ambient)
+        material->setAmbient(*mtlMaterial.ambient);
+      if (mtlMaterial.diffuse)
+        material->setDiffuse(*mtlMaterial.diffuse);
+      if (mtlMaterial.specular)
+        material->setSpecular(*mtlMaterial.specular);
+      if (mtlMaterial.emissive)
+        material->setEmissive(*mtlMaterial.emissive);
+      if (mtlMaterial.transparency)
+        material->setTransparency(*mtlMaterial.transparency);
+
+      if (TexturePtr map = recoverMap(MtlMap::BASE_COLOR))
+        material->setDiffuseMap(std::move(map));
+      if (TexturePtr map = recoverMap(MtlMap::AMBIENT))
+        material->setAmbientMap(std::move(map));
+      if (TexturePtr map = recoverMap(MtlMap::SPECULAR))
+        material->setSpecularMap(std::move(map));
+      if (TexturePtr map = recoverMap(MtlMap::EMISSIVE))
+        material->setEmissiveMap(std::move(map));
+      if (TexturePtr map = recoverMap(MtlMap::TRANSPARENCY))
+        material->setTransparencyMap(std::move(map));
+      if (TexturePtr map = recoverMap(MtlMap::BUMP))
+        material->setBumpMap(std::move(map));
+
+      material->getDiffuseMap()->setBindingIndex(0);
+      material->getAmbientMap()->setBindingIndex(1);
+      material->getSpecularMap()->setBindingIndex(2);
+      material->getEmissiveMap()->setBindingIndex(3);
+      material->getTransparencyMap()->setBindingIndex(4);
+      material->getBumpMap()->setBindingIndex(5);
+
+      mesh.addMaterial(std::move(material));
+    }
+  }
+}
+
+#if defined(RAZ_THREADS_AVAILABLE)
+constexpr std::size_t minChunkSize = 1 << 20; // Minimal size in bytes of the file's parts parsed in parallel
+#endif
+
+// Position, texcoords & normal indices of a face's vertex, as written in the file: starting from 1, or negative if relative to the end
+// 32-bit indices are enough for any practical file, while halving the memory taken by the faces
+using ObjIndices = std::array<int32_t, 3>;
+
+// Statement whose effect depends on the ones preceding it; those are applied in order once all the file's parts have been parsed
+struct ObjStatement {
+  enum class Type { OBJECT, MATERIAL_LIBRARY, MATERIAL_USAGE };
+
+  Type type {};
+  std::string_view name {};
+  std::size_t faceVertexIndex {}; // Index of the first face vertex following the statement in its chunk
+};
+
+// Content parsed from a part of the file
+struct ObjChunk {
+  std::vector<Vec3f> positions;
+  std::vector<Vec2f> texcoords;
+  std::vector<Vec3f> normals;
+  std::vector<ObjIndices> faceVertices; // Triangles' vertices, already triangulated
+  std::vector<ObjStatement> statements;
+};
+
+// Range of contiguous triangles' vertices in a chunk
+struct ObjFaceRange {
+  const ObjIndices* begin;
+  const ObjIndices* end;
+};
+
+// Control characters are considered as whitespaces as well; the line feed never appears, lines being split beforehand
+constexpr bool isSpace(char chr) noexcept { return (static_cast<unsigned char>(chr) <= ' '); }
+
+void skipSpaces(const char*& text, const char* textEnd) noexcept {
+  while (text != textEnd && isSpace(*text))
+    ++text;
+}
+
+void skipToken(const char*& text, const char* textEnd) noexcept {
+  while (text != textEnd && !isSpace(*text))
+    ++text;
+}
+
+std::string_view extractToken(const char*& text, const char* textEnd) noexcept {
+  skipSpaces(text, textEnd);
+
+  const char* tokenBegin = text;
+  skipToken(text, textEnd);
+
+  return std::string_view(tokenBegin, static_cast<std::size_t>(text - tokenBegin));
+}
+
+float parseFloat(const char*& text, const char* textEnd) {
+  skipSpaces(text, textEnd);
+
+  if (text != textEnd && *text == '+') // Explicit plus signs are not accepted by std::from_chars()
+    ++text;
+
+  // Values written in plain decimal notation with few enough digits are exactly representable as a mantissa & a power of 10, both fitting
+  //  in a float; their division is then correctly rounded, giving the same result as a full parsing (see Clinger's fast path)
+  {
+    constexpr std::array<float, 11> powersOf10 = { 1.f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+    constexpr uint32_t maxExactMantissa = 1u << 24;
+
+    const char* valueText = text;
+    const bool isNegative = (valueText != textEnd && *valueText == '-');
+    valueText += isNegative;
+
+    uint32_t mantissa        = 0;
+    std::size_t digitCount   = 0;
+    std::size_t decimalCount = 0;
+    bool hasDecimalPoint     = false;
+
+    for (; valueText != textEnd && mantissa <= maxExactMantissa; ++valueText) {
+      if (*valueText >= '0' && *valueText <= '9') {
+        mantissa = mantissa * 10 + static_cast<uint32_t>(*valueText - '0');
+        ++digitCount;
+        decimalCount += hasDecimalPoint;
+      } else if (*valueText == '.' && !hasDecimalPoint) {
+        hasDecimalPoint = true;
+      } else {
+        break;
+      }
+    }
+
+    if (digitCount > 0 && mantissa <= maxExactMantissa && decimalCount < powersOf10.size()
+     && (valueText == textEnd || isSpace(*valueText))) {
+      text = valueText;
+
+      const float value = static_cast<float>(mantissa) / powersOf10[decimalCount];
+      return (isNegative ? -value : value);
+    }
+  }
+
+  float value {};
+
+#if defined(__cpp_lib_to_chars)
+  text = std::from_chars(text, textEnd, value).ptr;
+#else
+  // Floating-point overloads of std::from_chars() are not available with every standard library; parsing a null-terminated copy instead
+  value = std::strtof(std::string(extractToken(text, textEnd)).c_str(), nullptr);
+#endif
+
+  skipToken(text, textEnd); // Ignoring anything that could not be parsed
+
+  return value;
+}
+
+// Parses an index at the beginning of the text, stopping at the first character not being a digit
+// An index too large to be represented is invalid, 0 being returned in its place; its remaining digits are skipped
+int32_t parseIndex(const char*& text, const char* textEnd) noexcept {
+  bool isNegative = false;
+
+  if (text != textEnd && (*text == '-' || *text == '+')) {
+    isNegative = (*text == '-');
+    ++text;
+  }
+
+  int32_t index = 0;
+
+  for (; text != textEnd && *text >= '0' && *text <= '9'; ++text) {
+    const int32_t digit = *text - '0';
+
+    if (index > (std::numeric_limits<int32_t>::max() - digit) / 10) {
+      while (text != textEnd && *text >= '0' && *text <= '9')
+        ++text;
+
+      return 0;
+    }
+
+    index = index * 10 + digit;
+  }
+
+  return (isNegative ? -index : index);
+}
+
+template <std::size_t Size>
+Vector<float, Size> parseVector(const char* text, const char* textEnd) {
+  Vector<float, Size> vec;
+
+  for (std::size_t valueIndex = 0; valueIndex < Size; ++valueIndex)
+    vec[valueIndex] = parseFloat(text, textEnd);
+
+  return vec;
+}
+
+void parseFace(const char* text, const char* textEnd, std::vector<ObjIndices>& faceIndices, std::vector<ObjIndices>& faceVertices) {
+  faceIndices.clear();
+
+  for (skipSpaces(text, textEnd); text != textEnd && *text != '#'; skipSpaces(text, textEnd)) {
+    // Each vertex is given as position[/[texcoords][/normal]]; missing indices are left to 0
+    ObjIndices indices {};
+    indices[0] = parseIndex(text, textEnd);
+
+    for (std::size_t partIndex = 1; partIndex < indices.size() && text != textEnd && *text == '/'; ++partIndex)
+      indices[partIndex] = parseIndex(++text, textEnd);
+
+    skipToken(text, textEnd); // Ignoring anything that could not be parsed
+    faceIndices.push_back(indices);
+  }
+
+  if (faceIndices.size() < 3)
+    return;
+
+  // Triangulating the face as a fan around its first vertex; for quads, this gives the triangles (2, 0, 3) & (1, 0, 2), in this order
+  for (std::size_t vertIndex = faceIndices.size() - 2; vertIndex > 0; --vertIndex) {
+    faceVertices.push_back(faceIndices[vertIndex]);
+    faceVertices.push_back(faceIndices.front());
+    faceVertices.push_back(faceIndices[vertIndex + 1]);
+  }
+}
+
+ObjChunk parseChunk(std::string_view content) {
+  ObjChunk chunk;
+  std::vector<ObjIndices> faceIndices;
+
+  const char* text          = content.data();
+  const char* const textEnd = content.data() + content.size();
+
+  while (text != textEnd) {
+    const auto* lineEnd = static_cast<const char*>(std::memchr(text, '\n', static_cast<std::size_t>(textEnd - text)));
+    if (lineEnd == nullptr)
+      lineEnd = textEnd;
+
+    const std::string_view tag = extractToken(text, lineEnd);
+
+    if (!tag.empty()) {
+      if (tag[0] == 'v') {
+        if (tag.size() > 1 && tag[1] == 'n')      // Normals
+          chunk.normals.push_back(parseVector<3>(text, lineEnd));
+        else if (tag.size() > 1 && tag[1] == 't') // Texcoords
+          chunk.texcoords.push_back(parseVector<2>(text, lineEnd));
+        else                                      // Vertices
+          chunk.positions.push_back(parseVector<3>(text, lineEnd));
+      } else if (tag[0] == 'f') { // Faces
+        parseFace(text, lineEnd, faceIndices, chunk.faceVertices);
+      } else if (tag[0] == 'm') { // Material import (mtllib)
+        chunk.statements.push_back(ObjStatement{ ObjStatement::Type::MATERIAL_LIBRARY, extractToken(text, lineEnd), chunk.faceVertices.size() });
+      } else if (tag[0] == 'u') { // Material usage (usemtl)
+        chunk.statements.push_back(ObjStatement{ ObjStatement::Type::MATERIAL_USAGE, extractToken(text, lineEnd), chunk.faceVertices.size() });
+      } else if (tag[0] == 'o' || tag[0] == 'g') {
+        chunk.statements.push_back(ObjStatement{ ObjStatement::Type::OBJECT, {}, chunk.faceVertices.size() });
+      }
+    }
+
+    text = (lineEnd == textEnd ? textEnd : lineEnd + 1);
+  }
+
+  return chunk;
+}
+
+std::vector<ObjChunk> parseChunks(std::string_view content) {
+#if defined(RAZ_THREADS_AVAILABLE)
+  const std::size_t chunkCount = std::clamp<std::size_t>(content.size() / minChunkSize, 1, Threading::getSystemThreadCount());
+#else
+  constexpr std::size_t chunkCount = 1;
+#endif
+
+  // Splitting the content in parts of roughly equal sizes, each ending on a line break so that no line is cut
+  std::vector<std::string_view> chunkContents;
+  chunkContents.reserve(chunkCount);
+
+  for (std::size_t beginPos = 0, chunkIndex = 1; beginPos < content.size(); ++chunkIndex) {
+    std::size_t endPos = content.size();
+
+    if (chunkIndex < chunkCount) {
+      endPos = content.find('\n', std::max(beginPos, content.size() * chunkIndex / chunkCount));
+      endPos = (endPos == std::string_view::npos ? content.size() : endPos + 1);
+    }
+
+    chunkContents.push_back(content.substr(beginPos, endPos - beginPos));
+    beginPos = endPos;
+  }
+
+  std::vector<ObjChunk> chunks(chunkContents.size());
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (chunks.size() > 1) {
+    Threading::parallelize(chunks, [&chunks, &chunkContents] (Threading::IndexRange range) {
+      for (std::size_t chunkIndex = range.beginIndex; chunkIndex < range.endIndex; ++chunkIndex)
+        chunks[chunkIndex] = parseChunk(chunkContents[chunkIndex]);
+    });
+
+    return chunks;
+  }
+#endif
+
+  for (std::size_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex)
+    chunks[chunkIndex] = parseChunk(chunkContents[chunkIndex]);
+
+  return chunks;
+}
+
+// Hasher of a face vertex's resolved indices, to associate them to the index of the submesh vertex created from them
+struct ObjIndicesHasher {
+  uint64_t operator()(const std::array<std::size_t, 3>& indices) const noexcept {
+    uint64_t hash = static_cast<uint64_t>(indices[0]) * 0x9E3779B97F4A7C15ull
+                  ^ static_cast<uint64_t>(indices[1]) * 0xC2B2AE3D27D4EB4Full
+                  ^ static_cast<uint64_t>(indices[2]) * 0x165667B19E3779F9ull;
+    hash ^= hash >> 32;
+
+    return hash;
+  }
+};
+
+} // namespace
+
+void Mesh::importMtl(const FilePath& mtlFilePath, std::unordered_map<std::string, std::size_t>& materialCorrespIndices) {
+  std::ifstream fileStream;
+  std::istringstream archivedStream;
+
+  // Material libraries of cooked meshes are archived along with them
+  const std::optional<ArchiveEntry> archivedMtl = VirtualFileSystem::find(mtlFilePath);
+
+  if (archivedMtl)
+    archivedStream.str(std::string(archivedMtl->data));
+  else
+    fileStream.open(mtlFilePath, std::ios_base::in | std::ios_base::binary);
+
+  std::istream& file = (archivedMtl ? static_cast<std::istream&>(archivedStream) : fileStream);
+
+  // The materials & their textures are only created once a graphics context is available; their images can however already be decoded
+  auto library = std::make_shared<MtlLibrary>();
+  m_materialCreations.emplace_back([library] (Mesh& mesh) { createMaterials(*library, mesh); });
+
   if (!file) {
     std::cerr << "Error: Couldn't open the material file '" << mtlFilePath << "'\n";
-    addLocalMaterial(true);
+    library->materials.push_back(MtlMaterial{ true });
     return;
   }
 
+  MtlMaterial material {};
   bool isBlinnPhongMaterial   = false;
   bool isCookTorranceMaterial = false;
 
+  const auto setMap = [&material] (MtlMap map, std::size_t imageIndex) { material.maps[static_cast<std::size_t>(map)] = imageIndex; };
+
   while (!file.eof()) {
     std::string tag;
     std::string nextValue;
@@ -77,79 +579,82 @@ inline void importMtl(const FilePath& mtlFilePath,
       std::string thirdValue;
       file >> secondValue >> thirdValue;
 
-      const float red   = std::stof(nextValue);
-      const float green = std::stof(secondValue);
-      const float blue  = std::stof(thirdValue);
+      const Vec3f color(std::stof(nextValue), std::stof(secondValue), std::stof(thirdValue));
 
       if (tag[1] == 'a') {                           // Ambient/ambient occlusion factor [Ka]
-        blinnPhongMaterial->setAmbient(red, green, blue);
+        material.ambient = color;
       } else if (tag[1] == 'd') {                    // Diffuse/albedo factor [Kd]
-        blinnPhongMaterial->setDiffuse(red, green, blue);
+        material.diffuse = color;
       } else if (tag[1] == 's') {                    // Specular factor [Ks]
-        blinnPhongMaterial->setSpecular(red, green, blue);
+        material.specular = color;
       } else if (tag[1] == 'e') {                    // Emissive factor [Ke]
-        blinnPhongMaterial->setEmissive(red, green, blue);
+        material.emissive = color;
       }
 
       isBlinnPhongMaterial = true;
+    } else if (tag[0] == 'P') {                      // PBR factors
+      if (tag[1] == 'm')                             // Metallic factor [Pm]
+        material.metallicFactor = std::stof(nextValue);
+      else if (tag[1] == 'r')                        // Roughness factor [Pr]
+        material.roughnessFactor = std::stof(nextValue);
+
+      isCookTorranceMaterial = true;
     } else if (tag[0] == 'm') {                      // Import texture
-      const TexturePtr map = loadTexture(mtlFilePath, nextValue);
+      const std::size_t imageIndex = requestImage(mtlFilePath, nextValue, *library);
 
       if (tag[4] == 'K') {                           // Standard maps
         if (tag[5] == 'd') {                         // Diffuse/albedo map [map_Kd]
-          blinnPhongMaterial->setDiffuseMap(map);
-          cookTorranceMaterial->setAlbedoMap(map);
+          setMap(MtlMap::BASE_COLOR, imageIndex);
         } else if (tag[5] == 'a') {                  // Ambient/ambient occlusion map [map_Ka]
-          blinnPhongMaterial->setAmbientMap(map);
-          cookTorranceMaterial->setAmbientOcclusionMap(map);
+          setMap(MtlMap::AMBIENT, imageIndex);
         } else if (tag[5] == 's') {                   // Specular map [map_Ks]
-          blinnPhongMaterial->setSpecularMap(map);
+          setMap(MtlMap::SPECULAR, imageIndex);
           isBlinnPhongMaterial = true;
         } else if (tag[5] == 'e') {                  // Emissive map [map_Ke]
-          blinnPhongMaterial->setEmissiveMap(map);
+          setMap(MtlMap::EMISSIVE, imageIndex);
         }
       }  else if (tag[4] == 'P') {                   // PBR maps
         if (tag[5] == 'm') {                         // Metallic map [map_Pm]
-          cookTorranceMaterial->setMetallicMap(map);
+          setMap(MtlMap::METALLIC, imageIndex);
         } else if (tag[5] == 'r') {                  // Roughness map [map_Pr]
-          cookTorranceMaterial->setRoughnessMap(map);
+          setMap(MtlMap::ROUGHNESS, imageIndex);
         }
 
         isCookTorranceMaterial = true;
       } else if (tag[4] == 'd') {                    // Transparency map [map_d]
-        blinnPhongMaterial->setTransparencyMap(map);
+        setMap(MtlMap::TRANSPARENCY, imageIndex);
         isBlinnPhongMaterial = true;
       } else if (tag[4] == 'b') {                    // Bump map [map_bump]
-        blinnPhongMaterial->setBumpMap(map);
+        setMap(MtlMap::BUMP, imageIndex);
         isBlinnPhongMaterial = true;
       }
     } else if (tag[0] == 'd') {                      // Transparency factor
-      blinnPhongMaterial->setTransparency(std::stof(nextValue));
+      material.transparency = std::stof(nextValue);
       isBlinnPhongMaterial = true;
     } else if (tag[0] == 'T') {
       if (tag[1] == 'r') {                           // Transparency factor (alias, 1 - d) [Tr]
-        blinnPhongMaterial->setTransparency(1.f - std::stof(nextValue));
+        material.transparency = 1.f - std::stof(nextValue);
         isBlinnPhongMaterial = true;
       }/* else if (line[1] == 'f') {                 // Transmission filter [Tf]
 
         isBlinnPhongMaterial = true;
       }*/
     }  else if (tag[0] == 'b') {                     // Bump map (alias) [bump]
-      blinnPhongMaterial->setBumpMap(loadTexture(mtlFilePath, nextValue, 5));
+      setMap(MtlMap::BUMP, requestImage(mtlFilePath, nextValue, *library));
       isBlinnPhongMaterial = true;
     } else if (tag[0] == 'n') {
       if (tag[1] == 'o') {                           // Normal map [norm]
-        cookTorranceMaterial->setNormalMap(loadTexture(mtlFilePath, nextValue, 1));
+        setMap(MtlMap::NORMAL, requestImage(mtlFilePath, nextValue, *library));
       } else if (tag[1] == 'e') {                    // New material [newmtl]
         materialCorrespIndices.emplace(nextValue, materialCorrespIndices.size());
 
         if (!isBlinnPhongMaterial && !isCookTorranceMaterial)
           continue;
 
-        addLocalMaterial(isCookTorranceMaterial);
+        material.isCookTorrance = isCookTorranceMaterial;
+        library->materials.push_back(std::move(material));
 
-        blinnPhongMaterial   = MaterialBlinnPhong::create();
-        cookTorranceMaterial = MaterialCookTorrance::create();
+        material = MtlMaterial();
 
         isBlinnPhongMaterial   = false;
         isCookTorranceMaterial = false;
@@ -159,228 +664,176 @@ inline void importMtl(const FilePath& mtlFilePath,
     }
   }
 
-  addLocalMaterial(isCookTorranceMaterial);
-}
+  material.isCookTorrance = isCookTorranceMaterial;
+  library->materials.push_back(std::move(material));
 
-} // namespace
+  decodeImages(library->loads);
+}
 
-void Mesh::importObj(std::ifstream& file, const FilePath& filePath) {
-  std::unordered_map<std::string, std::size_t> materialCorrespIndices;
+void Mesh::importObj(const FilePath& filePath) {
+  const MappedFile file(filePath);
+  const std::vector<ObjChunk> chunks = parseChunks(file.getContent());
 
   std::vector<Vec3f> positions;
   std::vector<Vec2f> texcoords;
   std::vector<Vec3f> normals;
 
-  std::vector<std::vector<int64_t>> posIndices(1);
-  std::vector<std::vector<int64_t>> texcoordsIndices(1);
-  std::vector<std::vector<int64_t>> normalsIndices(1);
-
-  while (!file.eof()) {
-    std::string line;
-    file >> line;
-
-    if (line[0] == 'v') {
-      if (line[1] == 'n') { // Normals
-        Vec3f normalsTriplet {};
-
-        file >> normalsTriplet[0]
-             >> normalsTriplet[1]
-             >> normalsTriplet[2];
-
-        normals.push_back(normalsTriplet);
-      } else if (line[1] == 't') { // Texcoords
-        Vec2f texcoordsTriplet {};
+  {
+    std::size_t posCount  = 0;
+    std::size_t texCount  = 0;
+    std::size_t normCount = 0;
 
-        file >> texcoordsTriplet[0]
-             >> texcoordsTriplet[1];
-
-        texcoords.push_back(texcoordsTriplet);
-      } else { // Vertices
-        Vec3f positionTriplet {};
-
-        file >> positionTriplet[0]
-             >> positionTriplet[1]
-             >> positionTriplet[2];
-
-        positions.push_back(positionTriplet);
-      }
-    } else if (line[0] == 'f') { // Faces
-      std::getline(file, line);
-
-      constexpr char delim  = '/';
-      const auto nbVertices = static_cast<uint16_t>(std::count(line.cbegin(), line.cend(), ' '));
-      const auto nbParts    = static_cast<uint8_t>(std::count(line.cbegin(), line.cend(), delim) / nbVertices + 1);
-      const bool quadFaces  = (nbVertices == 4);
-
-      std::stringstream indicesStream(line);
-      std::vector<int64_t> partIndices(nbParts * nbVertices);
-      std::string vertex;
+    for (const ObjChunk& chunk : chunks) {
+      posCount  += chunk.positions.size();
+      texCount  += chunk.texcoords.size();
+      normCount += chunk.normals.size();
+    }
 
-      for (std::size_t vertIndex = 0; vertIndex < nbVertices; ++vertIndex) {
-        indicesStream >> vertex;
+    positions.reserve(posCount);
+    texcoords.reserve(texCount);
+    normals.reserve(normCount);
 
-        std::stringstream vertParts(vertex);
-        std::string part;
-        uint8_t partIndex = 0;
+    for (const ObjChunk& chunk : chunks) {
+      positions.insert(positions.end(), chunk.positions.cbegin(), chunk.positions.cend());
+      texcoords.insert(texcoords.end(), chunk.texcoords.cbegin(), chunk.texcoords.cend());
+      normals.insert(normals.end(), chunk.normals.cbegin(), chunk.normals.cend());
+    }
+  }
 
-        while (std::getline(vertParts, part, delim)) {
-          if (!part.empty())
-            partIndices[partIndex * nbParts + vertIndex + (partIndex * quadFaces)] = std::stol(part);
+  // Applying the statements in the order they appear in the file, distributing the faces parsed around them to the corresponding submeshes
 
-          ++partIndex;
+  std::unordered_map<std::string, std::size_t> materialCorrespIndices;
+  std::vector<std::vector<ObjFaceRange>> faceRanges(1);
+  bool hasFirstSubmeshFaces = false;
+
+  for (const ObjChunk& chunk : chunks) {
+    std::size_t faceVertexIndex = 0;
+
+    const auto addFaces = [&chunk, &faceVertexIndex, &faceRanges, &hasFirstSubmeshFaces] (std::size_t endFaceVertexIndex) {
+      if (endFaceVertexIndex == faceVertexIndex)
+        return;
+
+      faceRanges.back().push_back(ObjFaceRange{ chunk.faceVertices.data() + faceVertexIndex, chunk.faceVertices.data() + endFaceVertexIndex });
+      hasFirstSubmeshFaces |= (faceRanges.size() == 1);
+      faceVertexIndex = endFaceVertexIndex;
+    };
+
+    for (const ObjStatement& statement : chunk.statements) {
+      addFaces(statement.faceVertexIndex);
+
+      switch (statement.type) {
+        case ObjStatement::Type::OBJECT:
+          if (hasFirstSubmeshFaces) {
+            faceRanges.emplace_back();
+            addSubmesh();
+          }
+          break;
+
+        case ObjStatement::Type::MATERIAL_LIBRARY:
+        {
+          const std::string mtlFilePath = filePath.recoverPathToFile() + std::string(statement.name);
+          importMtl(mtlFilePath, materialCorrespIndices);
+          break;
         }
-      }
 
-      if (quadFaces) {
-        posIndices.back().emplace_back(partIndices[2]);
-        posIndices.back().emplace_back(partIndices[0]);
-        posIndices.back().emplace_back(partIndices[3]);
+        case ObjStatement::Type::MATERIAL_USAGE:
+        {
+          if (materialCorrespIndices.empty())
+            break;
 
-        texcoordsIndices.back().emplace_back(partIndices[6]);
-        texcoordsIndices.back().emplace_back(partIndices[4]);
-        texcoordsIndices.back().emplace_back(partIndices[7]);
+          const std::string materialName(statement.name);
+          const auto correspMaterial = materialCorrespIndices.find(materialName);
 
-        normalsIndices.back().emplace_back(partIndices[10]);
-        normalsIndices.back().emplace_back(partIndices[8]);
-        normalsIndices.back().emplace_back(partIndices[11]);
-      }
-
-      posIndices.back().emplace_back(partIndices[1]);
-      posIndices.back().emplace_back(partIndices[0]);
-      posIndices.back().emplace_back(partIndices[2]);
-
-      texcoordsIndices.back().emplace_back(partIndices[4 + quadFaces]);
-      texcoordsIndices.back().emplace_back(partIndices[3 + quadFaces]);
-      texcoordsIndices.back().emplace_back(partIndices[5 + quadFaces]);
+          if (correspMaterial == materialCorrespIndices.cend())
+            std::cerr << "Error: No corresponding material found with the name '" << materialName << "'\n";
+          else
+            m_submeshes.back().setMaterialIndex(correspMaterial->second);
 
-      const auto quadStride = static_cast<uint8_t>(quadFaces * 2);
-
-      normalsIndices.back().emplace_back(partIndices[7 + quadStride]);
-      normalsIndices.back().emplace_back(partIndices[6 + quadStride]);
-      normalsIndices.back().emplace_back(partIndices[8 + quadStride]);
-    } else if (line[0] == 'm') { // Material import (mtllib)
-      std::string mtlFileName;
-      file >> mtlFileName;
-
-      const std::string mtlFilePath = filePath.recoverPathToFile() + mtlFileName;
-      importMtl(mtlFilePath, m_materials, materialCorrespIndices);
-    } else if (line[0] == 'u') { // Material usage (usemtl)
-      if (materialCorrespIndices.empty())
-        continue;
-
-      std::string materialName;
-      file >> materialName;
-
-      const auto correspMaterial = materialCorrespIndices.find(materialName);
-
-      if (correspMaterial == materialCorrespIndices.cend())
-        std::cerr << "Error: No corresponding material found with the name '" << materialName << "'\n";
-      else
-        m_submeshes.back().setMaterialIndex(correspMaterial->second);
-    } else if (line[0] == 'o' || line[0] == 'g') {
-      if (!posIndices.front().empty()) {
-        const std::size_t newSize = posIndices.size() + 1;
-        posIndices.resize(newSize);
-        texcoordsIndices.resize(newSize);
-        normalsIndices.resize(newSize);
-
-        addSubmesh();
+          break;
+        }
       }
-
-      std::getline(file, line);
-    } else {
-      std::getline(file, line); // Skip the rest of the line
     }
+
+    addFaces(chunk.faceVertices.size());
   }
 
   const auto posCount  = static_cast<int64_t>(positions.size());
   const auto texCount  = static_cast<int64_t>(texcoords.size());
   const auto normCount = static_cast<int64_t>(normals.size());
 
-  std::map<std::array<std::size_t, 3>, unsigned int> indicesMap;
+  const auto recoverIndices = [posCount, texCount, normCount] (const ObjIndices& indices) {
+    // Indices start from 1 in the file, or are relative to the end of the attributes' lists if negative
+    return std::array<std::size_t, 3>{
+      (indices[0] < 0 ? static_cast<std::size_t>(indices[0] + posCount) : static_cast<std::size_t>(indices[0] - 1)),
+      (indices[1] < 0 ? static_cast<std::size_t>(indices[1] + texCount) : static_cast<std::size_t>(indices[1] - 1)),
+      (indices[2] < 0 ? static_cast<std::size_t>(indices[2] + normCount) : static_cast<std::size_t>(indices[2] - 1))
+    };
+  };
 
-  for (std::size_t submeshIndex = 0; submeshIndex < m_submeshes.size(); ++submeshIndex) {
+  const auto createSubmeshVertices = [this, &faceRanges, &positions, &texcoords, &normals, &recoverIndices] (std::size_t submeshIndex) {
     Submesh& submesh = m_submeshes[submeshIndex];
-    indicesMap.clear();
-
-    for (std::size_t partIndex = 0; partIndex < posIndices[submeshIndex].size(); ++partIndex) {
-      // Face (vertices indices triplets), containing position/texcoords/normals
-      // vertIndices[i][j] -> vertex i, feature j (j = 0 -> position, j = 1 -> texcoords, j = 2 -> normal)
-      std::array<std::array<std::size_t, 3>, 3> vertIndices {};
-
-      // First vertex informations
-      int64_t tempIndex = posIndices[submeshIndex][partIndex];
-      vertIndices[0][0] = (tempIndex < 0 ? static_cast<std::size_t>(tempIndex + posCount) : static_cast<std::size_t>(tempIndex - 1));
 
-      tempIndex = texcoordsIndices[submeshIndex][partIndex];
-      vertIndices[0][1] = (tempIndex < 0 ? static_cast<std::size_t>(tempIndex + texCount) : static_cast<std::size_t>(tempIndex - 1));
+    std::size_t faceVertexCount = 0;
+    for (const ObjFaceRange& faceRange : faceRanges[submeshIndex])
+      faceVertexCount += static_cast<std::size_t>(faceRange.end - faceRange.begin);
 
-      tempIndex = normalsIndices[submeshIndex][partIndex];
-      vertIndices[0][2] = (tempIndex < 0 ? static_cast<std::size_t>(tempIndex + normCount) : static_cast<std::size_t>(tempIndex - 1));
+    IndexMap<std::array<std::size_t, 3>, ObjIndicesHasher> indicesMap(faceVertexCount);
+    submesh.getTriangleIndices().reserve(faceVertexCount);
 
-      ++partIndex;
+    for (const ObjFaceRange& faceRange : faceRanges[submeshIndex]) {
+      for (const ObjIndices* faceVertex = faceRange.begin; faceVertex != faceRange.end; faceVertex += 3) {
+        // Face (vertices indices triplets), containing position/texcoords/normals
+        // vertIndices[i][j] -> vertex i, feature j (j = 0 -> position, j = 1 -> texcoords, j = 2 -> normal)
+        const std::array<std::array<std::size_t, 3>, 3> vertIndices = { recoverIndices(faceVertex[0]),
+                                                                        recoverIndices(faceVertex[1]),
+                                                                        recoverIndices(faceVertex[2]) };
 
-      // Second vertex informations
-      tempIndex = posIndices[submeshIndex][partIndex];
-      vertIndices[1][0] = (tempIndex < 0 ? static_cast<std::size_t>(tempIndex + posCount) : static_cast<std::size_t>(tempIndex - 1));
-
-      tempIndex = texcoordsIndices[submeshIndex][partIndex];
-      vertIndices[1][1] = (tempIndex < 0 ? static_cast<std::size_t>(tempIndex + texCount) : static_cast<std::size_t>(tempIndex - 1));
-
-      tempIndex = normalsIndices[submeshIndex][partIndex];
-      vertIndices[1][2] = (tempIndex < 0 ? static_cast<std::size_t>(tempIndex + normCount) : static_cast<std::size_t>(tempIndex - 1));
-
-      ++partIndex;
-
-      // Third vertex informations
-      tempIndex = posIndices[submeshIndex][partIndex];
-      vertIndices[2][0] = (tempIndex < 0 ? static_cast<std::size_t>(tempIndex + posCount) : static_cast<std::size_t>(tempIndex - 1));
+        // Invalid or out of bounds indices are ignored: the face is skipped if it has no position, & missing texcoords or normals are left to 0
+        if (vertIndices[0][0] >= positions.size() || vertIndices[1][0] >= positions.size() || vertIndices[2][0] >= positions.size())
+          continue;
 
-      tempIndex = texcoordsIndices[submeshIndex][partIndex];
-      vertIndices[2][1] = (tempIndex < 0 ? static_cast<std::size_t>(tempIndex + texCount) : static_cast<std::size_t>(tempIndex - 1));
+        const std::array<Vec3f, 3> facePositions = { positions[vertIndices[0][0]],
+                                                     positions[vertIndices[1][0]],
+                                                     positions[vertIndices[2][0]] };
 
-      tempIndex = normalsIndices[submeshIndex][partIndex];
-      vertIndices[2][2] = (tempIndex < 0 ? static_cast<std::size_t>(tempIndex + normCount) : static_cast<std::size_t>(tempIndex - 1));
+        const auto recoverTexcoords = [&texcoords] (std::size_t index) { return (index < texcoords.size() ? texcoords[index] : Vec2f()); };
+        const auto recoverNormal    = [&normals] (std::size_t index) { return (index < normals.size() ? normals[index] : Vec3f()); };
 
-      const std::array<Vec3f, 3> facePositions = { positions[vertIndices[0][0]],
-                                                   positions[vertIndices[1][0]],
-                                                   positions[vertIndices[2][0]] };
+        Vec3f faceTangent {};
+        std::array<Vec2f, 3> faceTexcoords {};
+        if (!texcoords.empty()) {
+          faceTexcoords[0] = recoverTexcoords(vertIndices[0][1]);
+          faceTexcoords[1] = recoverTexcoords(vertIndices[1][1]);
+          faceTexcoords[2] = recoverTexcoords(vertIndices[2][1]);
 
-      Vec3f faceTangent {};
-      std::array<Vec2f, 3> faceTexcoords {};
-      if (!texcoords.empty()) {
-        faceTexcoords[0] = texcoords[vertIndices[0][1]];
-        faceTexcoords[1] = texcoords[vertIndices[1][1]];
-        faceTexcoords[2] = texcoords[vertIndices[2][1]];
+          faceTangent = computeTangent(facePositions[0], facePositions[1], facePositions[2],
+                                       faceTexcoords[0], faceTexcoords[1], faceTexcoords[2]);
+        }
 
-        faceTangent = computeTangent(facePositions[0], facePositions[1], facePositions[2],
-                                     faceTexcoords[0], faceTexcoords[1], faceTexcoords[2]);
-      }
+        std::array<Vec3f, 3> faceNormals {};
+        if (!normals.empty()) {
+          faceNormals[0] = recoverNormal(vertIndices[0][2]);
+          faceNormals[1] = recoverNormal(vertIndices[1][2]);
+          faceNormals[2] = recoverNormal(vertIndices[2][2]);
+        }
 
-      std::array<Vec3f, 3> faceNormals {};
-      if (!normals.empty()) {
-        faceNormals[0] = normals[vertIndices[0][2]];
-        faceNormals[1] = normals[vertIndices[1][2]];
-        faceNormals[2] = normals[vertIndices[2][2]];
-      }
+        for (uint8_t vertPartIndex = 0; vertPartIndex < 3; ++vertPartIndex) {
+          const auto [vertIndex, isNewVertex] = indicesMap.emplace(vertIndices[vertPartIndex]);
 
-      for (uint8_t vertPartIndex = 0; vertPartIndex < 3; ++vertPartIndex) {
-        const auto indexIter = indicesMap.find(vertIndices[vertPartIndex]);
+          if (isNewVertex) {
+            Vertex vert {};
 
-        if (indexIter != indicesMap.cend()) {
-          submesh.getVertices()[indexIter->second].tangent += faceTangent; // Adding current tangent to be averaged later
-          submesh.getTriangleIndices().emplace_back(indexIter->second);
-        } else {
-          Vertex vert {};
+            vert.position  = facePositions[vertPartIndex];
+            vert.texcoords = faceTexcoords[vertPartIndex];
+            vert.normal    = faceNormals[vertPartIndex];
+            vert.tangent   = faceTangent;
 
-          vert.position  = facePositions[vertPartIndex];
-          vert.texcoords = faceTexcoords[vertPartIndex];
-          vert.normal    = faceNormals[vertPartIndex];
-          vert.tangent   = faceTangent;
+            submesh.getVertices().push_back(vert);
+          } else {
+            submesh.getVertices()[vertIndex].tangent += faceTangent; // Adding current tangent to be averaged later
+          }
 
-          submesh.getTriangleIndices().emplace_back(static_cast<unsigned int>(indicesMap.size()));
-          indicesMap.emplace(vertIndices[vertPartIndex], static_cast<unsigned int>(indicesMap.size()));
-          submesh.getVertices().push_back(vert);
+          submesh.getTriangleIndices().emplace_back(vertIndex);
         }
       }
     }
@@ -388,7 +841,24 @@ void Mesh::importObj(std::ifstream& file, const FilePath& filePath) {
     // Normalizing tangents to become unit vectors & to be averaged after being accumulated
     for (Vertex& vertex : submesh.getVertices())
       vertex.tangent = (vertex.tangent - vertex.normal * vertex.tangent.dot(vertex.normal)).normalize();
+
+    // Distinct indices may still lead to identical vertices, for example if the file declares the same attributes several times
+    MeshUtils::deduplicateVertices(submesh.getVertices(), submesh.getTriangleIndices());
+  };
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (m_submeshes.size() > 1) {
+    Threading::parallelize(m_submeshes, [&createSubmeshVertices] (Threading::IndexRange range) {
+      for (std::size_t submeshIndex = range.beginIndex; submeshIndex < range.endIndex; ++submeshIndex)
+        createSubmeshVertices(submeshIndex);
+    });
+
+    return;
   }
+#endif
+
+  for (std::size_t submeshIndex = 0; submeshIndex < m_submeshes.size(); ++submeshIndex)
+    createSubmeshVertices(submeshIndex);
 }
 
 } // namespace Raz
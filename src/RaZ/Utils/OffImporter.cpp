@@ -1,4 +1,5 @@
 #include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/MeshUtils.hpp"
 
 #include <fstream>
 
@@ -15,7 +16,7 @@ void Mesh::importOff(std::ifstream& file) {
   file.ignore(100, '\n');
 
   std::vector<Vertex>& vertices = submesh.getVertices();
-  vertices.resize(vertexCount * 3);
+  vertices.resize(vertexCount);
 
   std::vector<unsigned int>& indices = submesh.getTriangleIndices();
   indices.reserve(faceCount * 3);
@@ -29,22 +30,26 @@ void Mesh::importOff(std::ifstream& file) {
     uint16_t partCount {};
     file >> partCount;
 
-    std::vector<std::size_t> partsIndices(partCount);
-    file >> partsIndices[0] >> partsIndices[1] >> partsIndices[2];
+    // Faces are triangulated as a fan around their first vertex
+    std::size_t firstPartIndex {};
+    std::size_t prevPartIndex {};
+    std::size_t partIndex {};
+    file >> firstPartIndex >> prevPartIndex;
 
-    indices.emplace_back(static_cast<unsigned int>(partsIndices[0]));
-    indices.emplace_back(static_cast<unsigned int>(partsIndices[1]));
-    indices.emplace_back(static_cast<unsigned int>(partsIndices[2]));
+    for (uint16_t facePartIndex = 2; facePartIndex < partCount; ++facePartIndex) {
+      file >> partIndex;
 
-    for (uint16_t partIndex = 3; partIndex < partCount; ++partIndex) {
-      file >> partsIndices[partIndex];
+      indices.emplace_back(static_cast<unsigned int>(firstPartIndex));
+      indices.emplace_back(static_cast<unsigned int>(prevPartIndex));
+      indices.emplace_back(static_cast<unsigned int>(partIndex));
 
-      indices.emplace_back(static_cast<unsigned int>(partsIndices[0]));
-      indices.emplace_back(static_cast<unsigned int>(partsIndices[partIndex - 1]));
-      indices.emplace_back(static_cast<unsigned int>(partsIndices[partIndex]));
+      prevPartIndex = partIndex;
     }
   }
 
+  // OFF files only declaring positions, several of them may be identical
+  MeshUtils::deduplicateVertices(vertices, indices);
+
   indices.shrink_to_fit();
 }
 
@@ -1,3 +1,4 @@
+#include "RaZ/Math/FastMath.hpp"
 #include "RaZ/Utils/FloatUtils.hpp"
 #include "RaZ/Utils/Ray.hpp"
 #include "RaZ/Utils/Shape.hpp"
@@ -44,7 +45,7 @@ bool Ray::intersects(const Vec3f& point, RayHit* hit) const {
   const Vec3f pointDir       = point - m_origin;
   const Vec3f normedPointDir = pointDir.normalize();
 
-  if (!FloatUtils::areNearlyEqual(normedPointDir.dot(m_direction), 1.f))
+  if (!FloatUtils::areNearlyEqual(normedPointDir.dot(m_direction), 1.f, FastMath::comparisonTolerance))
     return false;
 
   if (hit) {
@@ -110,8 +111,31 @@ bool Ray::intersects(const Sphere& sphere, RayHit* hit) const {
 }
 
 bool Ray::intersects(const Triangle& triangle, RayHit* hit) const {
-  const Vec3f firstEdge   = triangle.getSecondPos() - triangle.getFirstPos();
-  const Vec3f secondEdge  = triangle.getThirdPos() - triangle.getFirstPos();
+  float hitDist = std::numeric_limits<float>::max();
+
+  if (!intersectsTriangle(triangle.getFirstPos(), triangle.getSecondPos(), triangle.getThirdPos(), hitDist))
+    return false;
+
+  if (hit) {
+    hit->position = m_origin + m_direction * hitDist;
+
+    const Vec3f firstEdge  = triangle.getSecondPos() - triangle.getFirstPos();
+    const Vec3f secondEdge = triangle.getThirdPos() - triangle.getFirstPos();
+    const Vec3f normal     = firstEdge.cross(secondEdge).normalize();
+
+    // We want the normal facing the ray, not the opposite direction (no culling)
+    // This may not be the ideal behavior; this may change when a real use case will be available
+    hit->normal = (normal.dot(m_direction) > 0.f ? -normal : normal);
+
+    hit->distance = hitDist;
+  }
+
+  return true;
+}
+
+bool Ray::intersectsTriangle(const Vec3f& firstPos, const Vec3f& secondPos, const Vec3f& thirdPos, float& hitDistance) const noexcept {
+  const Vec3f firstEdge   = secondPos - firstPos;
+  const Vec3f secondEdge  = thirdPos - firstPos;
   const Vec3f pVec        = m_direction.cross(secondEdge);
   const float determinant = firstEdge.dot(pVec);
 
@@ -120,7 +144,7 @@ bool Ray::intersects(const Triangle& triangle, RayHit* hit) const {
 
   const float invDeterm = 1.f / determinant;
 
-  const Vec3f invPlaneDir    = m_origin - triangle.getFirstPos();
+  const Vec3f invPlaneDir    = m_origin - firstPos;
   const float firstBaryCoord = invPlaneDir.dot(pVec) * invDeterm;
 
   if (firstBaryCoord < 0.f || firstBaryCoord > 1.f)
@@ -134,21 +158,10 @@ bool Ray::intersects(const Triangle& triangle, RayHit* hit) const {
 
   const float hitDist = secondEdge.dot(qVec) * invDeterm;
 
-  if (hitDist <= 0.f)
+  if (hitDist <= 0.f || hitDist >= hitDistance)
     return false;
 
-  if (hit) {
-    hit->position = m_origin + m_direction * hitDist;
-
-    const Vec3f normal = firstEdge.cross(secondEdge).normalize();
-
-    // We want the normal facing the ray, not the opposite direction (no culling)
-    // This may not be the ideal behavior; this may change when a real use case will be available
-    hit->normal = (normal.dot(m_direction) > 0.f ? -normal : normal);
-
-    hit->distance = hitDist;
-  }
-
+  hitDistance = hitDist;
   return true;
 }
 
@@ -182,7 +195,9 @@ bool Ray::intersects(const AABB& aabb, RayHit* hit) const {
     hit->position = m_origin + m_direction * minHitDist;
 
     // Normal computing method based on John Novak's: http://blog.johnnovak.net/2016/10/22/the-nim-raytracer-project-part-4-calculating-box-normals/
-    const Vec3f hitDir = (hit->position - aabb.computeCentroid()) / aabb.computeHalfExtents();
+    // The direction is slightly biased outward, so that a hit computed marginally inside the box, e.g. from an approximated ray direction, still
+    //  gives the normal of its face
+    const Vec3f hitDir = (hit->position - aabb.computeCentroid()) / aabb.computeHalfExtents() * (1.f + FastMath::comparisonTolerance);
     hit->normal = Vec3f(std::trunc(hitDir[0]), std::trunc(hitDir[1]), std::trunc(hitDir[2])).normalize();
 
     hit->distance = minHitDist;
@@ -191,6 +206,39 @@ bool Ray::intersects(const AABB& aabb, RayHit* hit) const {
   return true;
 }
 
+bool Ray::intersects(const Quad& quad, RayHit* hit) const {
+  RayHit firstHit;
+  RayHit secondHit;
+
+  const bool hitsFirstTriangle  = intersects(Triangle(quad.getLeftTopPos(), quad.getRightTopPos(), quad.getRightBottomPos()), &firstHit);
+  const bool hitsSecondTriangle = intersects(Triangle(quad.getLeftTopPos(), quad.getRightBottomPos(), quad.getLeftBottomPos()), &secondHit);
+
+  if (!hitsFirstTriangle && !hitsSecondTriangle)
+    return false;
+
+  if (hit)
+    *hit = (firstHit.distance <= secondHit.distance ? firstHit : secondHit);
+
+  return true;
+}
+
+bool Ray::intersects(const OBB& obb, RayHit* hit) const {
+  const Vec3f boxCentroid    = obb.computeCentroid();
+  const Vec3f boxHalfExtents = (obb.getRightTopFrontPos() - obb.getLeftBottomBackPos()) * 0.5f;
+
+  const Ray localRay((m_origin - boxCentroid) * obb.getInverseRotation(), m_direction * obb.getInverseRotation());
+
+  if (!localRay.intersects(AABB(-boxHalfExtents, boxHalfExtents), hit))
+    return false;
+
+  if (hit) {
+    hit->position = hit->position * obb.getRotation() + boxCentroid;
+    hit->normal   = hit->normal * obb.getRotation();
+  }
+
+  return true;
+}
+
 Vec3f Ray::computeProjection(const Vec3f& point) const {
   const float pointDist = m_direction.dot(point - m_origin);
   return (m_origin + m_direction * std::max(pointDist, 0.f));
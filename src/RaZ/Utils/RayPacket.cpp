@@ -0,0 +1,275 @@
+#include "RaZ/Math/SimdLanes.hpp"
+#include "RaZ/Utils/RayPacket.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace Raz {
+
+namespace {
+
+// Packets of 8 rays are checked with AVX if the engine is compiled for it, or otherwise on two halves of 4 rays with SSE
+template <std::size_t Size>
+using Lanes = SimdLanes::FloatLanes<Size>;
+
+template <typename L>
+struct LaneVec3 {
+  L x;
+  L y;
+  L z;
+};
+
+template <typename L>
+L dot(const LaneVec3<L>& vec1, const LaneVec3<L>& vec2) { return vec1.x * vec2.x + vec1.y * vec2.y + vec1.z * vec2.z; }
+
+template <typename L>
+LaneVec3<L> cross(const LaneVec3<L>& vec1, const LaneVec3<L>& vec2) {
+  return LaneVec3<L>{ vec1.y * vec2.z - vec1.z * vec2.y,
+                      vec1.z * vec2.x - vec1.x * vec2.z,
+                      vec1.x * vec2.y - vec1.y * vec2.x };
+}
+
+/// Computes the distances at which rays enter boxes, using the slab method; see Ray::intersects(const AABB&) for the scalar version.
+/// \param origin Rays' origins.
+/// \param invDirection Rays' inverse directions.
+/// \param minPos Boxes' minimum positions.
+/// \param maxPos Boxes' maximum positions.
+/// \param maxDistance Maximum distances along the rays.
+/// \param entryDistance Distances at which the rays enter the boxes, clamped to 0 if starting inside.
+/// \return Mask of the lanes in which the ray intersects the box.
+template <typename L>
+typename L::Mask computeSlabs(const LaneVec3<L>& origin, const LaneVec3<L>& invDirection,
+                              const LaneVec3<L>& minPos, const LaneVec3<L>& maxPos,
+                              const L& maxDistance, L& entryDistance) {
+  const L minDistX = (minPos.x - origin.x) * invDirection.x;
+  const L minDistY = (minPos.y - origin.y) * invDirection.y;
+  const L minDistZ = (minPos.z - origin.z) * invDirection.z;
+
+  const L maxDistX = (maxPos.x - origin.x) * invDirection.x;
+  const L maxDistY = (maxPos.y - origin.y) * invDirection.y;
+  const L maxDistZ = (maxPos.z - origin.z) * invDirection.z;
+
+  entryDistance = L::max(L::max(L::min(minDistX, maxDistX), L::min(minDistY, maxDistY)),
+                         L::max(L::min(minDistZ, maxDistZ), L::broadcast(0.f)));
+  const L exitDistance = L::min(L::min(L::max(minDistX, maxDistX), L::max(minDistY, maxDistY)),
+                                L::min(L::max(minDistZ, maxDistZ), maxDistance));
+
+  return L::lessEqual(entryDistance, exitDistance);
+}
+
+/// Computes the intersections between rays & triangles, using the Möller-Trumbore algorithm; see Ray::intersects(const Triangle&) for the scalar version.
+/// \param origin Rays' origins.
+/// \param direction Rays' directions.
+/// \param firstPos Triangles' first positions.
+/// \param firstEdge Triangles' edges going from their first to their second position.
+/// \param secondEdge Triangles' edges going from their first to their third position.
+/// \param maxDistance Maximum distances along the rays, excluded.
+/// \param hitDistance Distances of the hits.
+/// \return Mask of the lanes in which the ray intersects the triangle.
+template <typename L>
+typename L::Mask computeMollerTrumbore(const LaneVec3<L>& origin, const LaneVec3<L>& direction,
+                                       const LaneVec3<L>& firstPos, const LaneVec3<L>& firstEdge, const LaneVec3<L>& secondEdge,
+                                       const L& maxDistance, L& hitDistance) {
+  const L zero = L::broadcast(0.f);
+  const L one  = L::broadcast(1.f);
+
+  const LaneVec3<L> pVec = cross(direction, secondEdge);
+  const L determinant    = dot(firstEdge, pVec);
+
+  const L epsilon   = L::broadcast(std::numeric_limits<float>::epsilon());
+  typename L::Mask mask = L::maskOr(L::greater(determinant, epsilon), L::less(determinant, zero - epsilon));
+
+  const L invDeterm = one / determinant;
+
+  const LaneVec3<L> invPlaneDir{ origin.x - firstPos.x, origin.y - firstPos.y, origin.z - firstPos.z };
+  const L firstBaryCoord = dot(invPlaneDir, pVec) * invDeterm;
+  mask = L::maskAnd(mask, L::maskAnd(L::greaterEqual(firstBaryCoord, zero), L::lessEqual(firstBaryCoord, one)));
+
+  const LaneVec3<L> qVec  = cross(invPlaneDir, firstEdge);
+  const L secondBaryCoord = dot(direction, qVec) * invDeterm;
+  mask = L::maskAnd(mask, L::maskAnd(L::greaterEqual(secondBaryCoord, zero), L::lessEqual(firstBaryCoord + secondBaryCoord, one)));
+
+  hitDistance = dot(secondEdge, qVec) * invDeterm;
+
+  return L::maskAnd(mask, L::maskAnd(L::greater(hitDistance, zero), L::less(hitDistance, maxDistance)));
+}
+
+template <typename L>
+LaneVec3<L> loadVec3(const float* x, const float* y, const float* z) {
+  return LaneVec3<L>{ L::load(x), L::load(y), L::load(z) };
+}
+
+template <typename L>
+LaneVec3<L> broadcastVec3(const Vec3f& vec) {
+  return LaneVec3<L>{ L::broadcast(vec[0]), L::broadcast(vec[1]), L::broadcast(vec[2]) };
+}
+
+/// Replaces the distances of the lanes whose bit is set.
+template <std::size_t Size>
+void replaceDistances(uint32_t hitBits, const std::array<float, Size>& distances, std::array<float, Size>& hitDistances) noexcept {
+  for (std::size_t i = 0; i < Size; ++i) {
+    if (hitBits & (1u << i))
+      hitDistances[i] = distances[i];
+  }
+}
+
+/// Sets the distances of the lanes whose bit is set, the others being set to infinity.
+template <std::size_t Size>
+void assignDistances(uint32_t hitBits, const std::array<float, Size>& distances, std::array<float, Size>& hitDistances) noexcept {
+  for (std::size_t i = 0; i < Size; ++i)
+    hitDistances[i] = ((hitBits & (1u << i)) ? distances[i] : std::numeric_limits<float>::infinity());
+}
+
+} // namespace
+
+template <std::size_t Size>
+void RayPacket<Size>::setRay(std::size_t index, const Ray& ray) {
+  assert("Error: The ray index is out of the packet's bounds." && index < Size);
+
+  originX[index]       = ray.getOrigin()[0];
+  originY[index]       = ray.getOrigin()[1];
+  originZ[index]       = ray.getOrigin()[2];
+  directionX[index]    = ray.getDirection()[0];
+  directionY[index]    = ray.getDirection()[1];
+  directionZ[index]    = ray.getDirection()[2];
+  invDirectionX[index] = ray.getInverseDirection()[0];
+  invDirectionY[index] = ray.getInverseDirection()[1];
+  invDirectionZ[index] = ray.getInverseDirection()[2];
+
+  laneMask |= (1u << index);
+}
+
+template <std::size_t Size>
+Ray RayPacket<Size>::recoverRay(std::size_t index) const {
+  assert("Error: The ray index is out of the packet's bounds." && index < Size);
+  return Ray(Vec3f(originX[index], originY[index], originZ[index]), Vec3f(directionX[index], directionY[index], directionZ[index]));
+}
+
+template <std::size_t Size>
+uint32_t RayPacket<Size>::intersects(const AABB& aabb, std::array<float, Size>& hitDistances) const {
+  using L = Lanes<Size>;
+
+  L entryDistance;
+  const typename L::Mask mask = computeSlabs(loadVec3<L>(originX.data(), originY.data(), originZ.data()),
+                                             loadVec3<L>(invDirectionX.data(), invDirectionY.data(), invDirectionZ.data()),
+                                             broadcastVec3<L>(aabb.getLeftBottomBackPos()), broadcastVec3<L>(aabb.getRightTopFrontPos()),
+                                             L::load(hitDistances.data()), entryDistance);
+
+  const uint32_t hitBits = L::toBits(mask) & laneMask;
+
+  std::array<float, Size> distances {};
+  entryDistance.store(distances.data());
+  replaceDistances(hitBits, distances, hitDistances);
+
+  return hitBits;
+}
+
+template <std::size_t Size>
+uint32_t RayPacket<Size>::intersects(const Triangle& triangle, std::array<float, Size>& hitDistances) const {
+  using L = Lanes<Size>;
+
+  L hitDistance;
+  const typename L::Mask mask = computeMollerTrumbore(loadVec3<L>(originX.data(), originY.data(), originZ.data()),
+                                                      loadVec3<L>(directionX.data(), directionY.data(), directionZ.data()),
+                                                      broadcastVec3<L>(triangle.getFirstPos()),
+                                                      broadcastVec3<L>(triangle.getSecondPos() - triangle.getFirstPos()),
+                                                      broadcastVec3<L>(triangle.getThirdPos() - triangle.getFirstPos()),
+                                                      L::load(hitDistances.data()), hitDistance);
+
+  const uint32_t hitBits = L::toBits(mask) & laneMask;
+
+  std::array<float, Size> distances {};
+  hitDistance.store(distances.data());
+  replaceDistances(hitBits, distances, hitDistances);
+
+  return hitBits;
+}
+
+template <std::size_t Size>
+void AABBPacket<Size>::setBox(std::size_t index, const AABB& aabb) {
+  assert("Error: The box index is out of the packet's bounds." && index < Size);
+
+  minX[index] = aabb.getLeftBottomBackPos()[0];
+  minY[index] = aabb.getLeftBottomBackPos()[1];
+  minZ[index] = aabb.getLeftBottomBackPos()[2];
+  maxX[index] = aabb.getRightTopFrontPos()[0];
+  maxY[index] = aabb.getRightTopFrontPos()[1];
+  maxZ[index] = aabb.getRightTopFrontPos()[2];
+
+  laneMask |= (1u << index);
+}
+
+template <std::size_t Size>
+void TrianglePacket<Size>::setTriangle(std::size_t index, const Triangle& triangle) {
+  assert("Error: The triangle index is out of the packet's bounds." && index < Size);
+
+  const Vec3f firstEdge  = triangle.getSecondPos() - triangle.getFirstPos();
+  const Vec3f secondEdge = triangle.getThirdPos() - triangle.getFirstPos();
+
+  firstPosX[index]   = triangle.getFirstPos()[0];
+  firstPosY[index]   = triangle.getFirstPos()[1];
+  firstPosZ[index]   = triangle.getFirstPos()[2];
+  firstEdgeX[index]  = firstEdge[0];
+  firstEdgeY[index]  = firstEdge[1];
+  firstEdgeZ[index]  = firstEdge[2];
+  secondEdgeX[index] = secondEdge[0];
+  secondEdgeY[index] = secondEdge[1];
+  secondEdgeZ[index] = secondEdge[2];
+
+  laneMask |= (1u << index);
+}
+
+template <std::size_t Size>
+uint32_t Ray::intersects(const AABBPacket<Size>& aabbs, std::array<float, Size>& hitDistances, float maxDistance) const {
+  using L = Lanes<Size>;
+
+  L entryDistance;
+  const typename L::Mask mask = computeSlabs(broadcastVec3<L>(m_origin), broadcastVec3<L>(m_invDirection),
+                                             loadVec3<L>(aabbs.minX.data(), aabbs.minY.data(), aabbs.minZ.data()),
+                                             loadVec3<L>(aabbs.maxX.data(), aabbs.maxY.data(), aabbs.maxZ.data()),
+                                             L::broadcast(maxDistance), entryDistance);
+
+  const uint32_t hitBits = L::toBits(mask) & aabbs.laneMask;
+
+  std::array<float, Size> distances {};
+  entryDistance.store(distances.data());
+  assignDistances(hitBits, distances, hitDistances);
+
+  return hitBits;
+}
+
+template <std::size_t Size>
+uint32_t Ray::intersects(const TrianglePacket<Size>& triangles, std::array<float, Size>& hitDistances, float maxDistance) const {
+  using L = Lanes<Size>;
+
+  L hitDistance;
+  const typename L::Mask mask = computeMollerTrumbore(broadcastVec3<L>(m_origin), broadcastVec3<L>(m_direction),
+                                                      loadVec3<L>(triangles.firstPosX.data(), triangles.firstPosY.data(), triangles.firstPosZ.data()),
+                                                      loadVec3<L>(triangles.firstEdgeX.data(), triangles.firstEdgeY.data(), triangles.firstEdgeZ.data()),
+                                                      loadVec3<L>(triangles.secondEdgeX.data(), triangles.secondEdgeY.data(), triangles.secondEdgeZ.data()),
+                                                      L::broadcast(maxDistance), hitDistance);
+
+  const uint32_t hitBits = L::toBits(mask) & triangles.laneMask;
+
+  std::array<float, Size> distances {};
+  hitDistance.store(distances.data());
+  assignDistances(hitBits, distances, hitDistances);
+
+  return hitBits;
+}
+
+template struct RayPacket<4>;
+template struct RayPacket<8>;
+template struct AABBPacket<4>;
+template struct AABBPacket<8>;
+template struct TrianglePacket<4>;
+template struct TrianglePacket<8>;
+
+template uint32_t Ray::intersects(const AABBPacket<4>&, std::array<float, 4>&, float) const;
+template uint32_t Ray::intersects(const AABBPacket<8>&, std::array<float, 8>&, float) const;
+template uint32_t Ray::intersects(const TrianglePacket<4>&, std::array<float, 4>&, float) const;
+template uint32_t Ray::intersects(const TrianglePacket<8>&, std::array<float, 8>&, float) const;
+
+} // namespace Raz
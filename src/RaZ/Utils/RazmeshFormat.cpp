@@ -0,0 +1,395 @@
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/RazmeshFormat.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+namespace Raz {
+
+namespace RazmeshFormat {
+
+namespace {
+
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t prime3 = 0x165667B19E3779F9ull;
+constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+constexpr uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+constexpr uint64_t rotateLeft(uint64_t value, int shift) noexcept {
+  return (value << shift) | (value >> (64 - shift));
+}
+
+inline uint64_t read64(const unsigned char* data) noexcept {
+  uint64_t value {};
+  std::memcpy(&value, data, sizeof(uint64_t));
+  return value;
+}
+
+inline uint32_t read32(const unsigned char* data) noexcept {
+  uint32_t value {};
+  std::memcpy(&value, data, sizeof(uint32_t));
+  return value;
+}
+
+constexpr uint64_t processLane(uint64_t accumulator, uint64_t input) noexcept {
+  return rotateLeft(accumulator + input * prime2, 31) * prime1;
+}
+
+constexpr uint64_t mergeAccumulator(uint64_t hash, uint64_t accumulator) noexcept {
+  return (hash ^ processLane(0, accumulator)) * prime1 + prime4;
+}
+
+} // namespace
+
+uint64_t computeChecksum(const void* data, std::size_t size, uint64_t seed) noexcept {
+  const auto* bytes        = static_cast<const unsigned char*>(data);
+  const unsigned char* end = bytes + size;
+  uint64_t hash {};
+
+  if (size >= 32) {
+    // Data are processed by stripes of 32 bytes, split into 4 independent lanes
+    uint64_t firstAcc  = seed + prime1 + prime2;
+    uint64_t secondAcc = seed + prime2;
+    uint64_t thirdAcc  = seed;
+    uint64_t fourthAcc = seed - prime1;
+
+    for (const unsigned char* stripesEnd = end - 31; bytes < stripesEnd; bytes += 32) {
+      firstAcc  = processLane(firstAcc, read64(bytes));
+      secondAcc = processLane(secondAcc, read64(bytes + 8));
+      thirdAcc  = processLane(thirdAcc, read64(bytes + 16));
+      fourthAcc = processLane(fourthAcc, read64(bytes + 24));
+    }
+
+    hash = rotateLeft(firstAcc, 1) + rotateLeft(secondAcc, 7) + rotateLeft(thirdAcc, 12) + rotateLeft(fourthAcc, 18);
+    hash = mergeAccumulator(hash, firstAcc);
+    hash = mergeAccumulator(hash, secondAcc);
+    hash = mergeAccumulator(hash, thirdAcc);
+    hash = mergeAccumulator(hash, fourthAcc);
+  } else {
+    hash = seed + prime5;
+  }
+
+  hash += size;
+
+  for (; end - bytes >= 8; bytes += 8)
+    hash = rotateLeft(hash ^ processLane(0, read64(bytes)), 27) * prime1 + prime4;
+
+  if (end - bytes >= 4) {
+    hash = rotateLeft(hash ^ (static_cast<uint64_t>(read32(bytes)) * prime1), 23) * prime2 + prime3;
+    bytes += 4;
+  }
+
+  for (; bytes < end; ++bytes)
+    hash = rotateLeft(hash ^ (static_cast<uint64_t>(*bytes) * prime5), 11) * prime1;
+
+  // Final mix, making all the bits of the data affect all the bits of the checksum
+  hash ^= hash >> 33;
+  hash *= prime2;
+  hash ^= hash >> 29;
+  hash *= prime3;
+  hash ^= hash >> 32;
+
+  return hash;
+}
+
+} // namespace RazmeshFormat
+
+namespace {
+
+constexpr std::size_t alignOffset(std::size_t offset) noexcept {
+  return (offset + RazmeshFormat::alignment - 1) & ~(RazmeshFormat::alignment - 1);
+}
+
+// Checks that the given number of elements starting at the given offset fit in the file, without overflowing
+constexpr bool isRangeValid(uint64_t offset, uint64_t count, std::size_t elementSize, uint64_t fileSize) noexcept {
+  return (offset <= fileSize && count <= (fileSize - offset) / elementSize);
+}
+
+std::array<float, 6> computeBounds(const std::vector<Vertex>& vertices) noexcept {
+  Vec3f maxPos(std::numeric_limits<float>::lowest());
+  Vec3f minPos(std::numeric_limits<float>::max());
+
+  for (const Vertex& vert : vertices) {
+    for (std::size_t i = 0; i < 3; ++i) {
+      maxPos[i] = std::max(maxPos[i], vert.position[i]);
+      minPos[i] = std::min(minPos[i], vert.position[i]);
+    }
+  }
+
+  return { minPos[0], minPos[1], minPos[2], maxPos[0], maxPos[1], maxPos[2] };
+}
+
+inline AABB toBoundingBox(const std::array<float, 6>& bounds) noexcept {
+  return AABB(Vec3f(bounds[0], bounds[1], bounds[2]), Vec3f(bounds[3], bounds[4], bounds[5]));
+}
+
+} // namespace
+
+void Mesh::importRazmesh(std::string_view fileContent, const FilePath& filePath) {
+  if (fileContent.size() < sizeof(RazmeshFormat::Header))
+    throw std::invalid_argument("Error: The file '" + filePath + "' is too small to be a razmesh file");
+
+  RazmeshFormat::Header header {};
+  std::memcpy(&header, fileContent.data(), sizeof(RazmeshFormat::Header));
+
+  if (header.magic != RazmeshFormat::magic)
+    throw std::invalid_argument("Error: The file '" + filePath + "' is not a razmesh file");
+
+  if (header.version != RazmeshFormat::version)
+    throw std::invalid_argument("Error: The razmesh file '" + filePath + "' has an unsupported version (" + std::to_string(header.version) + ")");
+
+  if (header.endiannessTag != RazmeshFormat::endiannessTag)
+    throw std::invalid_argument("Error: The razmesh file '" + filePath + "' has been written with a different endianness");
+
+  if (header.vertexStride != sizeof(Vertex))
+    throw std::invalid_argument("Error: The razmesh file '" + filePath + "' has a vertex layout different from the current one");
+
+  if (header.fileSize != fileContent.size())
+    throw std::invalid_argument("Error: The razmesh file '" + filePath + "' is truncated");
+
+  const char* data = fileContent.data();
+
+  if (RazmeshFormat::computeChecksum(data + sizeof(RazmeshFormat::Header), fileContent.size() - sizeof(RazmeshFormat::Header)) != header.checksum)
+    throw std::invalid_argument("Error: The razmesh file '" + filePath + "' is corrupted; its checksum doesn't match its content");
+
+  if (!isRangeValid(header.submeshTableOffset, header.submeshCount, sizeof(RazmeshFormat::SubmeshEntry), header.fileSize)
+   || !isRangeValid(header.lodTableOffset, header.lodCount, sizeof(RazmeshFormat::LodEntry), header.fileSize)
+   || !isRangeValid(header.materialTableOffset, header.materialCount, sizeof(RazmeshFormat::MaterialEntry), header.fileSize)
+   || !isRangeValid(header.stringTableOffset, header.stringTableSize, sizeof(char), header.fileSize))
+    throw std::invalid_argument("Error: The razmesh file '" + filePath + "' has tables out of its bounds");
+
+  const auto recoverString = [&header, data, &filePath] (const RazmeshFormat::StringRef& stringRef) {
+    if (stringRef.offset > header.stringTableSize || stringRef.size > header.stringTableSize - stringRef.offset)
+      throw std::invalid_argument("Error: The razmesh file '" + filePath + "' has a string out of its bounds");
+
+    return std::string(data + header.stringTableOffset + stringRef.offset, stringRef.size);
+  };
+
+  // Importing the materials, which are referenced by name in their library
+
+  std::vector<std::size_t> materialIndices(header.materialCount, 0);
+
+  if (header.materialLibrary.size > 0) {
+    std::unordered_map<std::string, std::size_t> materialCorrespIndices;
+    importMtl(filePath.recoverPathToFile() + recoverString(header.materialLibrary), materialCorrespIndices);
+
+    for (uint32_t materialIndex = 0; materialIndex < header.materialCount; ++materialIndex) {
+      RazmeshFormat::MaterialEntry materialEntry {};
+      std::memcpy(&materialEntry, data + header.materialTableOffset + materialIndex * sizeof(RazmeshFormat::MaterialEntry), sizeof(materialEntry));
+
+      const std::string materialName = recoverString(materialEntry.name);
+      const auto correspMaterial     = materialCorrespIndices.find(materialName);
+
+      if (correspMaterial == materialCorrespIndices.cend())
+        std::cerr << "Error: No corresponding material found with the name '" << materialName << "'\n";
+      else
+        materialIndices[materialIndex] = correspMaterial->second;
+    }
+  }
+
+  // Copying the submeshes' blobs, which are already laid out as expected
+
+  m_submeshes.resize(header.submeshCount);
+
+  for (uint32_t submeshIndex = 0; submeshIndex < header.submeshCount; ++submeshIndex) {
+    RazmeshFormat::SubmeshEntry submeshEntry {};
+    std::memcpy(&submeshEntry, data + header.submeshTableOffset + submeshIndex * sizeof(RazmeshFormat::SubmeshEntry), sizeof(submeshEntry));
+
+    if (!isRangeValid(submeshEntry.vertexOffset, submeshEntry.vertexCount, sizeof(Vertex), header.fileSize)
+     || !isRangeValid(submeshEntry.indexOffset, submeshEntry.indexCount, sizeof(unsigned int), header.fileSize))
+      throw std::invalid_argument("Error: The razmesh file '" + filePath + "' has a submesh out of its bounds");
+
+    if (submeshEntry.renderMode != static_cast<uint32_t>(RenderMode::POINT) && submeshEntry.renderMode != static_cast<uint32_t>(RenderMode::TRIANGLE))
+      throw std::invalid_argument("Error: The razmesh file '" + filePath + "' has a submesh with an invalid render mode");
+
+    Submesh& submesh = m_submeshes[submeshIndex];
+
+    std::vector<Vertex>& vertices = submesh.getVertices();
+    vertices.resize(submeshEntry.vertexCount);
+    std::memcpy(vertices.data(), data + submeshEntry.vertexOffset, vertices.size() * sizeof(Vertex));
+
+    const auto copyIndices = [data, &vertices, &filePath] (std::vector<unsigned int>& indices, uint64_t indexOffset, uint64_t indexCount) {
+      indices.resize(indexCount);
+      std::memcpy(indices.data(), data + indexOffset, indices.size() * sizeof(unsigned int));
+
+      unsigned int maxIndex = 0;
+      for (const unsigned int index : indices)
+        maxIndex = std::max(maxIndex, index);
+
+      if (!indices.empty() && maxIndex >= vertices.size())
+        throw std::invalid_argument("Error: The razmesh file '" + filePath + "' has a submesh with indices out of its vertices' bounds");
+    };
+
+    copyIndices(submesh.getTriangleIndices(), submeshEntry.indexOffset, submeshEntry.indexCount);
+
+    if (submeshEntry.firstLodIndex > header.lodCount || submeshEntry.lodCount > header.lodCount - submeshEntry.firstLodIndex)
+      throw std::invalid_argument("Error: The razmesh file '" + filePath + "' has a submesh with LODs out of its bounds");
+
+    std::vector<SubmeshLod>& lods = submesh.getLods();
+    lods.resize(submeshEntry.lodCount);
+
+    for (uint32_t lodIndex = 0; lodIndex < submeshEntry.lodCount; ++lodIndex) {
+      RazmeshFormat::LodEntry lodEntry {};
+      std::memcpy(&lodEntry, data + header.lodTableOffset + (submeshEntry.firstLodIndex + lodIndex) * sizeof(RazmeshFormat::LodEntry), sizeof(lodEntry));
+
+      if (!isRangeValid(lodEntry.indexOffset, lodEntry.indexCount, sizeof(unsigned int), header.fileSize))
+        throw std::invalid_argument("Error: The razmesh file '" + filePath + "' has a LOD out of its bounds");
+
+      copyIndices(lods[lodIndex].triangleIndices, lodEntry.indexOffset, lodEntry.indexCount);
+      lods[lodIndex].error = lodEntry.error;
+    }
+
+    if (submeshEntry.materialIndex < materialIndices.size())
+      submesh.setMaterialIndex(materialIndices[submeshEntry.materialIndex]);
+
+    if (submeshEntry.renderMode != static_cast<uint32_t>(RenderMode::TRIANGLE))
+      submesh.setRenderMode(static_cast<RenderMode>(submeshEntry.renderMode));
+
+    submesh.setBoundingBox(toBoundingBox(submeshEntry.boundingBox));
+  }
+
+  m_boundingBox = toBoundingBox(header.boundingBox);
+}
+
+void Mesh::saveRazmesh(std::ofstream& file, const FilePath& filePath) const {
+  const std::string fileName = filePath.recoverFileName(false).toUtf8();
+
+  std::string strings;
+  const auto addString = [&strings] (const std::string& str) {
+    const RazmeshFormat::StringRef stringRef { static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(str.size()) };
+    strings += str;
+    return stringRef;
+  };
+
+  RazmeshFormat::Header header {};
+  header.magic         = RazmeshFormat::magic;
+  header.version       = RazmeshFormat::version;
+  header.endiannessTag = RazmeshFormat::endiannessTag;
+  header.vertexStride  = static_cast<uint32_t>(sizeof(Vertex));
+  header.submeshCount  = static_cast<uint32_t>(m_submeshes.size());
+  header.materialCount = static_cast<uint32_t>(m_materials.size());
+
+  // Materials are saved in an MTL file next to the mesh one, named after it
+  std::vector<RazmeshFormat::MaterialEntry> materialEntries;
+
+  if (!m_materials.empty()) {
+    const std::string mtlFileName = fileName + ".mtl";
+    saveMtl(filePath.recoverPathToFile() + mtlFileName);
+
+    header.materialLibrary = addString(mtlFileName);
+
+    materialEntries.reserve(m_materials.size());
+    for (std::size_t materialIndex = 0; materialIndex < m_materials.size(); ++materialIndex)
+      materialEntries.push_back(RazmeshFormat::MaterialEntry{ addString(fileName + '_' + std::to_string(materialIndex)) });
+  }
+
+  // Computing the layout of the file, each section being aligned
+
+  std::size_t offset = sizeof(RazmeshFormat::Header);
+
+  header.submeshTableOffset = offset;
+  offset = alignOffset(offset + m_submeshes.size() * sizeof(RazmeshFormat::SubmeshEntry));
+
+  std::vector<RazmeshFormat::LodEntry> lodEntries;
+  for (const Submesh& submesh : m_submeshes)
+    lodEntries.resize(lodEntries.size() + submesh.getLods().size());
+
+  header.lodCount       = static_cast<uint32_t>(lodEntries.size());
+  header.lodTableOffset = offset;
+  offset = alignOffset(offset + lodEntries.size() * sizeof(RazmeshFormat::LodEntry));
+
+  header.materialTableOffset = offset;
+  offset = alignOffset(offset + materialEntries.size() * sizeof(RazmeshFormat::MaterialEntry));
+
+  header.stringTableOffset = offset;
+  header.stringTableSize   = static_cast<uint32_t>(strings.size());
+  offset = alignOffset(offset + strings.size());
+
+  std::vector<RazmeshFormat::SubmeshEntry> submeshEntries(m_submeshes.size());
+  std::array<float, 6> meshBounds = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                                      std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+
+  for (std::size_t submeshIndex = 0; submeshIndex < m_submeshes.size(); ++submeshIndex) {
+    const Submesh& submesh                    = m_submeshes[submeshIndex];
+    RazmeshFormat::SubmeshEntry& submeshEntry = submeshEntries[submeshIndex];
+
+    submeshEntry.vertexOffset  = offset;
+    submeshEntry.vertexCount   = submesh.getVertexCount();
+    submeshEntry.materialIndex = static_cast<uint32_t>(submesh.getMaterialIndex());
+    submeshEntry.renderMode    = static_cast<uint32_t>(submesh.getRenderMode());
+    submeshEntry.boundingBox   = computeBounds(submesh.getVertices());
+
+    for (std::size_t i = 0; i < 3; ++i) {
+      meshBounds[i]     = std::min(meshBounds[i], submeshEntry.boundingBox[i]);
+      meshBounds[i + 3] = std::max(meshBounds[i + 3], submeshEntry.boundingBox[i + 3]);
+    }
+
+    offset = alignOffset(offset + submesh.getVertexCount() * sizeof(Vertex));
+  }
+
+  for (std::size_t submeshIndex = 0; submeshIndex < m_submeshes.size(); ++submeshIndex) {
+    submeshEntries[submeshIndex].indexOffset = offset;
+    submeshEntries[submeshIndex].indexCount  = m_submeshes[submeshIndex].getTriangleIndexCount();
+
+    offset = alignOffset(offset + m_submeshes[submeshIndex].getTriangleIndexCount() * sizeof(unsigned int));
+  }
+
+  // The LODs' indices follow those of all the submeshes, each submesh referencing its consecutive LODs' entries
+  std::size_t lodIndex = 0;
+
+  for (std::size_t submeshIndex = 0; submeshIndex < m_submeshes.size(); ++submeshIndex) {
+    const std::vector<SubmeshLod>& lods = m_submeshes[submeshIndex].getLods();
+
+    submeshEntries[submeshIndex].firstLodIndex = static_cast<uint32_t>(lodIndex);
+    submeshEntries[submeshIndex].lodCount      = static_cast<uint32_t>(lods.size());
+
+    for (const SubmeshLod& lod : lods) {
+      RazmeshFormat::LodEntry& lodEntry = lodEntries[lodIndex++];
+      lodEntry.indexOffset = offset;
+      lodEntry.indexCount  = lod.triangleIndices.size();
+      lodEntry.error       = lod.error;
+
+      offset = alignOffset(offset + lod.triangleIndices.size() * sizeof(unsigned int));
+    }
+  }
+
+  header.fileSize    = offset;
+  header.boundingBox = meshBounds;
+
+  // Filling the content following the header, from which the checksum is computed
+
+  std::vector<char> content(offset - sizeof(RazmeshFormat::Header));
+  const auto writeContent = [&content] (std::size_t fileOffset, const void* data, std::size_t size) {
+    if (size > 0)
+      std::memcpy(content.data() + fileOffset - sizeof(RazmeshFormat::Header), data, size);
+  };
+
+  writeContent(header.submeshTableOffset, submeshEntries.data(), submeshEntries.size() * sizeof(RazmeshFormat::SubmeshEntry));
+  writeContent(header.lodTableOffset, lodEntries.data(), lodEntries.size() * sizeof(RazmeshFormat::LodEntry));
+  writeContent(header.materialTableOffset, materialEntries.data(), materialEntries.size() * sizeof(RazmeshFormat::MaterialEntry));
+  writeContent(header.stringTableOffset, strings.data(), strings.size());
+
+  for (std::size_t submeshIndex = 0; submeshIndex < m_submeshes.size(); ++submeshIndex) {
+    const Submesh& submesh = m_submeshes[submeshIndex];
+
+    writeContent(submeshEntries[submeshIndex].vertexOffset, submesh.getVertices().data(), submesh.getVertexCount() * sizeof(Vertex));
+    writeContent(submeshEntries[submeshIndex].indexOffset, submesh.getTriangleIndices().data(), submesh.getTriangleIndexCount() * sizeof(unsigned int));
+
+    for (std::size_t submeshLodIndex = 0; submeshLodIndex < submesh.getLods().size(); ++submeshLodIndex) {
+      const std::vector<unsigned int>& lodIndices = submesh.getLods()[submeshLodIndex].triangleIndices;
+      writeContent(lodEntries[submeshEntries[submeshIndex].firstLodIndex + submeshLodIndex].indexOffset, lodIndices.data(), lodIndices.size() * sizeof(unsigned int));
+    }
+  }
+
+  header.checksum = RazmeshFormat::computeChecksum(content.data(), content.size());
+
+  file.write(reinterpret_cast<const char*>(&header), sizeof(RazmeshFormat::Header));
+  file.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+} // namespace Raz
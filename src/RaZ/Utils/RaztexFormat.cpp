@@ -0,0 +1,504 @@
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/Image.hpp"
+#include "RaZ/Utils/RaztexFormat.hpp"
+#include "RaZ/Utils/RazmeshFormat.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace Raz::RaztexFormat {
+
+namespace {
+
+// RGBA pixels of a 4x4 block, ordered from left to right & top to bottom
+using BlockPixels = std::array<std::array<uint8_t, 4>, 16>;
+
+constexpr std::size_t alignOffset(std::size_t offset) noexcept {
+  return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+constexpr std::size_t computeBlockSize(PixelFormat blockFormat) noexcept {
+  return (blockFormat == PixelFormat::BC1 ? 8 : 16);
+}
+
+constexpr uint8_t computeChannelCount(PixelFormat pixelFormat) noexcept {
+  switch (pixelFormat) {
+    case PixelFormat::GRAY:       return 1;
+    case PixelFormat::GRAY_ALPHA: return 2;
+    case PixelFormat::RGB:
+    case PixelFormat::BC1:        return 3;
+    case PixelFormat::RGBA:
+    case PixelFormat::BC3:
+    default:                      return 4;
+  }
+}
+
+// Packs a color into 16 bits, with 5 bits for red & blue and 6 for green
+inline uint16_t packColor(const std::array<uint8_t, 4>& color) noexcept {
+  const auto red   = static_cast<unsigned int>(color[0] * 31 + 127) / 255;
+  const auto green = static_cast<unsigned int>(color[1] * 63 + 127) / 255;
+  const auto blue  = static_cast<unsigned int>(color[2] * 31 + 127) / 255;
+
+  return static_cast<uint16_t>((red << 11u) | (green << 5u) | blue);
+}
+
+// Unpacks a 16 bits color into 8 bits channels, replicating the highest bits into the lowest ones
+constexpr std::array<int, 3> unpackColor(uint16_t color) noexcept {
+  const int red   = (color >> 11) & 31;
+  const int green = (color >> 5) & 63;
+  const int blue  = color & 31;
+
+  return { (red << 3) | (red >> 2), (green << 2) | (green >> 4), (blue << 3) | (blue >> 2) };
+}
+
+constexpr std::array<std::array<int, 3>, 4> computeColorPalette(uint16_t firstColor, uint16_t secondColor, bool hasFourColors) noexcept {
+  const std::array<int, 3> first  = unpackColor(firstColor);
+  const std::array<int, 3> second = unpackColor(secondColor);
+
+  std::array<std::array<int, 3>, 4> palette { first, second, std::array<int, 3>{}, std::array<int, 3>{} };
+
+  for (std::size_t i = 0; i < 3; ++i) {
+    if (hasFourColors) {
+      palette[2][i] = (2 * first[i] + second[i]) / 3;
+      palette[3][i] = (first[i] + 2 * second[i]) / 3;
+    } else {
+      palette[2][i] = (first[i] + second[i]) / 2;
+      palette[3][i] = 0;
+    }
+  }
+
+  return palette;
+}
+
+constexpr std::array<int, 8> computeAlphaPalette(int firstAlpha, int secondAlpha) noexcept {
+  std::array<int, 8> palette { firstAlpha, secondAlpha, 0, 0, 0, 0, 0, 0 };
+
+  if (firstAlpha > secondAlpha) {
+    for (int i = 1; i < 7; ++i)
+      palette[static_cast<std::size_t>(i) + 1] = ((7 - i) * firstAlpha + i * secondAlpha) / 7;
+  } else {
+    for (int i = 1; i < 5; ++i)
+      palette[static_cast<std::size_t>(i) + 1] = ((5 - i) * firstAlpha + i * secondAlpha) / 5;
+
+    palette[6] = 0;
+    palette[7] = 255;
+  }
+
+  return palette;
+}
+
+inline void write16(uint8_t* output, uint16_t value) noexcept {
+  // Blocks are always little-endian, regardless of the machine's endianness
+  output[0] = static_cast<uint8_t>(value & 255u);
+  output[1] = static_cast<uint8_t>(value >> 8u);
+}
+
+constexpr uint16_t read16(const uint8_t* input) noexcept {
+  return static_cast<uint16_t>(input[0] | (input[1] << 8));
+}
+
+void compressColorBlock(const BlockPixels& pixels, uint8_t* output) noexcept {
+  // The endpoints are chosen as the extreme colors along the colors' principal axis, found by a few power iterations on their covariance matrix
+
+  std::array<float, 3> mean {};
+  for (const std::array<uint8_t, 4>& pixel : pixels) {
+    for (std::size_t i = 0; i < 3; ++i)
+      mean[i] += static_cast<float>(pixel[i]) / 16.f;
+  }
+
+  std::array<float, 6> covariance {}; // Upper triangle: xx, xy, xz, yy, yz, zz
+  for (const std::array<uint8_t, 4>& pixel : pixels) {
+    const float red   = static_cast<float>(pixel[0]) - mean[0];
+    const float green = static_cast<float>(pixel[1]) - mean[1];
+    const float blue  = static_cast<float>(pixel[2]) - mean[2];
+
+    covariance[0] += red * red;
+    covariance[1] += red * green;
+    covariance[2] += red * blue;
+    covariance[3] += green * green;
+    covariance[4] += green * blue;
+    covariance[5] += blue * blue;
+  }
+
+  std::array<float, 3> axis = { 1.f, 1.f, 1.f };
+  for (int iteration = 0; iteration < 4; ++iteration) {
+    const std::array<float, 3> nextAxis = { covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2],
+                                            covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2],
+                                            covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2] };
+    const float maxComponent = std::max({ std::abs(nextAxis[0]), std::abs(nextAxis[1]), std::abs(nextAxis[2]) });
+
+    if (maxComponent <= std::numeric_limits<float>::epsilon())
+      break; // All colors are identical; any axis will do
+
+    axis = { nextAxis[0] / maxComponent, nextAxis[1] / maxComponent, nextAxis[2] / maxComponent };
+  }
+
+  std::size_t minIndex = 0;
+  std::size_t maxIndex = 0;
+  float minProjection  = std::numeric_limits<float>::max();
+  float maxProjection  = std::numeric_limits<float>::lowest();
+
+  for (std::size_t pixelIndex = 0; pixelIndex < pixels.size(); ++pixelIndex) {
+    const std::array<uint8_t, 4>& pixel = pixels[pixelIndex];
+    const float projection = static_cast<float>(pixel[0]) * axis[0] + static_cast<float>(pixel[1]) * axis[1] + static_cast<float>(pixel[2]) * axis[2];
+
+    if (projection < minProjection) {
+      minProjection = projection;
+      minIndex      = pixelIndex;
+    }
+
+    if (projection > maxProjection) {
+      maxProjection = projection;
+      maxIndex      = pixelIndex;
+    }
+  }
+
+  uint16_t firstColor  = packColor(pixels[maxIndex]);
+  uint16_t secondColor = packColor(pixels[minIndex]);
+
+  // The first color must be greater than the second one for the block to be decoded with 4 colors
+  if (firstColor < secondColor)
+    std::swap(firstColor, secondColor);
+
+  write16(output, firstColor);
+  write16(output + 2, secondColor);
+
+  uint32_t indices = 0;
+
+  if (firstColor != secondColor) {
+    const std::array<std::array<int, 3>, 4> palette = computeColorPalette(firstColor, secondColor, true);
+
+    for (std::size_t pixelIndex = 0; pixelIndex < pixels.size(); ++pixelIndex) {
+      uint32_t bestIndex = 0;
+      int bestDistance   = std::numeric_limits<int>::max();
+
+      for (uint32_t paletteIndex = 0; paletteIndex < 4; ++paletteIndex) {
+        int distance = 0;
+
+        for (std::size_t i = 0; i < 3; ++i) {
+          const int diff = pixels[pixelIndex][i] - palette[paletteIndex][i];
+          distance += diff * diff;
+        }
+
+        if (distance < bestDistance) {
+          bestDistance = distance;
+          bestIndex    = paletteIndex;
+        }
+      }
+
+      indices |= bestIndex << (pixelIndex * 2);
+    }
+  }
+
+  for (std::size_t byteIndex = 0; byteIndex < 4; ++byteIndex)
+    output[4 + byteIndex] = static_cast<uint8_t>((indices >> (byteIndex * 8)) & 255u);
+}
+
+void compressAlphaBlock(const BlockPixels& pixels, uint8_t* output) noexcept {
+  uint8_t maxAlpha = 0;
+  uint8_t minAlpha = 255;
+
+  for (const std::array<uint8_t, 4>& pixel : pixels) {
+    maxAlpha = std::max(maxAlpha, pixel[3]);
+    minAlpha = std::min(minAlpha, pixel[3]);
+  }
+
+  // The first alpha being greater than the second one, the block is decoded with 8 interpolated values
+  output[0] = maxAlpha;
+  output[1] = minAlpha;
+
+  uint64_t indices = 0;
+
+  if (maxAlpha != minAlpha) {
+    const std::array<int, 8> palette = computeAlphaPalette(maxAlpha, minAlpha);
+
+    for (std::size_t pixelIndex = 0; pixelIndex < pixels.size(); ++pixelIndex) {
+      uint64_t bestIndex = 0;
+      int bestDistance   = std::numeric_limits<int>::max();
+
+      for (uint64_t paletteIndex = 0; paletteIndex < 8; ++paletteIndex) {
+        const int distance = std::abs(pixels[pixelIndex][3] - palette[paletteIndex]);
+
+        if (distance < bestDistance) {
+          bestDistance = distance;
+          bestIndex    = paletteIndex;
+        }
+      }
+
+      indices |= bestIndex << (pixelIndex * 3);
+    }
+  }
+
+  for (std::size_t byteIndex = 0; byteIndex < 6; ++byteIndex)
+    output[2 + byteIndex] = static_cast<uint8_t>((indices >> (byteIndex * 8)) & 255u);
+}
+
+void decompressColorBlock(const uint8_t* input, bool isBc1, BlockPixels& pixels) noexcept {
+  const uint16_t firstColor  = read16(input);
+  const uint16_t secondColor = read16(input + 2);
+
+  // BC1 blocks whose first color is lower or equal to the second one are decoded with 3 colors & a transparent black; BC3 ones always have 4 colors
+  const bool hasFourColors = (!isBc1 || firstColor > secondColor);
+  const std::array<std::array<int, 3>, 4> palette = computeColorPalette(firstColor, secondColor, hasFourColors);
+
+  for (std::size_t pixelIndex = 0; pixelIndex < pixels.size(); ++pixelIndex) {
+    const std::size_t paletteIndex = (input[4 + pixelIndex / 4] >> ((pixelIndex % 4) * 2)) & 3u;
+
+    for (std::size_t i = 0; i < 3; ++i)
+      pixels[pixelIndex][i] = static_cast<uint8_t>(palette[paletteIndex][i]);
+
+    pixels[pixelIndex][3] = (hasFourColors || paletteIndex != 3 ? 255 : 0);
+  }
+}
+
+void decompressAlphaBlock(const uint8_t* input, BlockPixels& pixels) noexcept {
+  const std::array<int, 8> palette = computeAlphaPalette(input[0], input[1]);
+
+  uint64_t indices = 0;
+  for (std::size_t byteIndex = 0; byteIndex < 6; ++byteIndex)
+    indices |= static_cast<uint64_t>(input[2 + byteIndex]) << (byteIndex * 8);
+
+  for (std::size_t pixelIndex = 0; pixelIndex < pixels.size(); ++pixelIndex)
+    pixels[pixelIndex][3] = static_cast<uint8_t>(palette[(indices >> (pixelIndex * 3)) & 7u]);
+}
+
+// Computes the next mipmap by averaging each square of 2x2 pixels; on odd dimensions, the last row or column is repeated
+std::vector<uint8_t> downsample(const std::vector<uint8_t>& pixels, unsigned int width, unsigned int height, uint8_t channelCount) {
+  const unsigned int nextWidth  = std::max(width / 2, 1u);
+  const unsigned int nextHeight = std::max(height / 2, 1u);
+
+  std::vector<uint8_t> nextPixels(static_cast<std::size_t>(nextWidth) * nextHeight * channelCount);
+
+  for (unsigned int nextY = 0; nextY < nextHeight; ++nextY) {
+    const std::size_t firstRow  = std::min(nextY * 2, height - 1);
+    const std::size_t secondRow = std::min(nextY * 2 + 1, height - 1);
+
+    for (unsigned int nextX = 0; nextX < nextWidth; ++nextX) {
+      const std::size_t firstColumn  = std::min(nextX * 2, width - 1);
+      const std::size_t secondColumn = std::min(nextX * 2 + 1, width - 1);
+
+      for (std::size_t channel = 0; channel < channelCount; ++channel) {
+        const unsigned int sum = pixels[(firstRow * width + firstColumn) * channelCount + channel]
+                               + pixels[(firstRow * width + secondColumn) * channelCount + channel]
+                               + pixels[(secondRow * width + firstColumn) * channelCount + channel]
+                               + pixels[(secondRow * width + secondColumn) * channelCount + channel];
+
+        nextPixels[(static_cast<std::size_t>(nextY) * nextWidth + nextX) * channelCount + channel] = static_cast<uint8_t>((sum + 2) / 4);
+      }
+    }
+  }
+
+  return nextPixels;
+}
+
+// Checks that the given number of elements starting at the given offset fit in the file, without overflowing
+constexpr bool isRangeValid(uint64_t offset, uint64_t count, std::size_t elementSize, uint64_t fileSize) noexcept {
+  return (offset <= fileSize && count <= (fileSize - offset) / elementSize);
+}
+
+} // namespace
+
+std::size_t computeDataSize(unsigned int width, unsigned int height, PixelFormat pixelFormat) noexcept {
+  if (isCompressed(pixelFormat))
+    return static_cast<std::size_t>((width + 3) / 4) * ((height + 3) / 4) * computeBlockSize(pixelFormat);
+
+  return static_cast<std::size_t>(width) * height * computeChannelCount(pixelFormat);
+}
+
+std::vector<uint8_t> compressBlocks(const uint8_t* pixels, unsigned int width, unsigned int height, uint8_t channelCount, PixelFormat blockFormat) {
+  assert("Error: The format to compress blocks into must be either BC1 or BC3." && isCompressed(blockFormat));
+  assert("Error: Only RGB & RGBA images can be compressed." && (channelCount == 3 || channelCount == 4));
+
+  const std::size_t blockSize    = computeBlockSize(blockFormat);
+  const unsigned int blockWidth  = (width + 3) / 4;
+  const unsigned int blockHeight = (height + 3) / 4;
+
+  std::vector<uint8_t> blocks(static_cast<std::size_t>(blockWidth) * blockHeight * blockSize);
+  uint8_t* output = blocks.data();
+
+  BlockPixels blockPixels {};
+
+  for (unsigned int blockY = 0; blockY < blockHeight; ++blockY) {
+    for (unsigned int blockX = 0; blockX < blockWidth; ++blockX) {
+      for (std::size_t pixelIndex = 0; pixelIndex < blockPixels.size(); ++pixelIndex) {
+        const std::size_t x = std::min(blockX * 4 + static_cast<unsigned int>(pixelIndex % 4), width - 1);
+        const std::size_t y = std::min(blockY * 4 + static_cast<unsigned int>(pixelIndex / 4), height - 1);
+        const uint8_t* pixel = pixels + (y * width + x) * channelCount;
+
+        blockPixels[pixelIndex] = { pixel[0], pixel[1], pixel[2], (channelCount == 4 ? pixel[3] : static_cast<uint8_t>(255)) };
+      }
+
+      if (blockFormat == PixelFormat::BC3) {
+        compressAlphaBlock(blockPixels, output);
+        output += 8;
+      }
+
+      compressColorBlock(blockPixels, output);
+      output += 8;
+    }
+  }
+
+  return blocks;
+}
+
+std::vector<uint8_t> decompressBlocks(const uint8_t* blocks, unsigned int width, unsigned int height, PixelFormat blockFormat) {
+  assert("Error: The format to decompress blocks from must be either BC1 or BC3." && isCompressed(blockFormat));
+
+  const unsigned int blockWidth  = (width + 3) / 4;
+  const unsigned int blockHeight = (height + 3) / 4;
+
+  std::vector<uint8_t> pixels(static_cast<std::size_t>(width) * height * 4);
+  const uint8_t* input = blocks;
+
+  BlockPixels blockPixels {};
+
+  for (unsigned int blockY = 0; blockY < blockHeight; ++blockY) {
+    for (unsigned int blockX = 0; blockX < blockWidth; ++blockX) {
+      if (blockFormat == PixelFormat::BC3) {
+        decompressColorBlock(input + 8, false, blockPixels);
+        decompressAlphaBlock(input, blockPixels);
+        input += 16;
+      } else {
+        decompressColorBlock(input, true, blockPixels);
+        input += 8;
+      }
+
+      for (std::size_t pixelIndex = 0; pixelIndex < blockPixels.size(); ++pixelIndex) {
+        const std::size_t x = blockX * 4 + pixelIndex % 4;
+        const std::size_t y = blockY * 4 + pixelIndex / 4;
+
+        if (x < width && y < height)
+          std::memcpy(pixels.data() + (y * width + x) * 4, blockPixels[pixelIndex].data(), 4);
+      }
+    }
+  }
+
+  return pixels;
+}
+
+std::vector<char> cook(const Image& image, bool compress, bool isFlippedVertically) {
+  if (image.isEmpty())
+    throw std::invalid_argument("Error: An empty image cannot be converted into a raztex");
+
+  if (image.getDataType() != ImageDataType::BYTE)
+    throw std::invalid_argument("Error: Only images holding bytes can be converted into a raztex");
+
+  const uint8_t channelCount = image.getChannelCount();
+
+  if (channelCount < 1 || channelCount > 4)
+    throw std::invalid_argument("Error: An image with " + std::to_string(channelCount) + " channels cannot be converted into a raztex");
+
+  PixelFormat pixelFormat = static_cast<PixelFormat>(channelCount - 1);
+
+  // Only colored images are compressed, grayscale ones being already small enough
+  if (compress && channelCount >= 3)
+    pixelFormat = (channelCount == 3 ? PixelFormat::BC1 : PixelFormat::BC3);
+
+  // Computing all the mipmaps down to 1x1, each from the previous one
+
+  unsigned int mipmapCount = 1;
+  while ((std::max(image.getWidth(), image.getHeight()) >> mipmapCount) > 0)
+    ++mipmapCount;
+
+  std::vector<std::vector<uint8_t>> mipmapsData(mipmapCount);
+  std::vector<MipmapEntry> mipmapEntries(mipmapCount);
+
+  const auto* imageData = static_cast<const uint8_t*>(image.getDataPtr());
+  std::vector<uint8_t> mipmapPixels(imageData, imageData + static_cast<std::size_t>(image.getWidth()) * image.getHeight() * channelCount);
+
+  std::size_t offset = alignOffset(sizeof(Header) + mipmapCount * sizeof(MipmapEntry));
+
+  for (unsigned int mipmapIndex = 0; mipmapIndex < mipmapCount; ++mipmapIndex) {
+    const unsigned int width  = std::max(image.getWidth() >> mipmapIndex, 1u);
+    const unsigned int height = std::max(image.getHeight() >> mipmapIndex, 1u);
+
+    if (mipmapIndex > 0)
+      mipmapPixels = downsample(mipmapPixels, std::max(image.getWidth() >> (mipmapIndex - 1), 1u), std::max(image.getHeight() >> (mipmapIndex - 1), 1u), channelCount);
+
+    mipmapsData[mipmapIndex] = (isCompressed(pixelFormat) ? compressBlocks(mipmapPixels.data(), width, height, channelCount, pixelFormat) : mipmapPixels);
+
+    mipmapEntries[mipmapIndex].dataOffset = offset;
+    mipmapEntries[mipmapIndex].dataSize   = mipmapsData[mipmapIndex].size();
+    offset = alignOffset(offset + mipmapsData[mipmapIndex].size());
+  }
+
+  Header header {};
+  header.magic         = magic;
+  header.version       = version;
+  header.endiannessTag = endiannessTag;
+  header.fileSize      = offset;
+  header.width         = image.getWidth();
+  header.height        = image.getHeight();
+  header.mipmapCount   = mipmapCount;
+  header.pixelFormat   = pixelFormat;
+  header.flags         = (isFlippedVertically ? static_cast<uint32_t>(HeaderFlag::FLIPPED_VERTICALLY) : 0u);
+
+  std::vector<char> content(offset);
+  std::memcpy(content.data() + sizeof(Header), mipmapEntries.data(), mipmapEntries.size() * sizeof(MipmapEntry));
+
+  for (std::size_t mipmapIndex = 0; mipmapIndex < mipmapCount; ++mipmapIndex)
+    std::memcpy(content.data() + mipmapEntries[mipmapIndex].dataOffset, mipmapsData[mipmapIndex].data(), mipmapsData[mipmapIndex].size());
+
+  header.checksum = RazmeshFormat::computeChecksum(content.data() + sizeof(Header), content.size() - sizeof(Header));
+  std::memcpy(content.data(), &header, sizeof(Header));
+
+  return content;
+}
+
+Content read(std::string_view fileContent, const FilePath& filePath) {
+  if (fileContent.size() < sizeof(Header))
+    throw std::invalid_argument("Error: The file '" + filePath + "' is too small to be a raztex file");
+
+  Content content {};
+  Header& header = content.header;
+  std::memcpy(&header, fileContent.data(), sizeof(Header));
+
+  if (header.magic != magic)
+    throw std::invalid_argument("Error: The file '" + filePath + "' is not a raztex file");
+
+  if (header.version != version)
+    throw std::invalid_argument("Error: The raztex file '" + filePath + "' has an unsupported version (" + std::to_string(header.version) + ")");
+
+  if (header.endiannessTag != endiannessTag)
+    throw std::invalid_argument("Error: The raztex file '" + filePath + "' has been written with a different endianness");
+
+  if (header.fileSize != fileContent.size())
+    throw std::invalid_argument("Error: The raztex file '" + filePath + "' is truncated");
+
+  if (RazmeshFormat::computeChecksum(fileContent.data() + sizeof(Header), fileContent.size() - sizeof(Header)) != header.checksum)
+    throw std::invalid_argument("Error: The raztex file '" + filePath + "' is corrupted; its checksum doesn't match its content");
+
+  // The mipmap chain must go down to 1x1; any missing level would make the texture incomplete, thus unable to be sampled
+  if (header.width == 0 || header.height == 0 || header.pixelFormat > PixelFormat::BC3
+   || header.mipmapCount == 0 || header.mipmapCount > 32 || (std::max(header.width, header.height) >> (header.mipmapCount - 1)) != 1)
+    throw std::invalid_argument("Error: The raztex file '" + filePath + "' has an invalid description");
+
+  if (!isRangeValid(sizeof(Header), header.mipmapCount, sizeof(MipmapEntry), header.fileSize))
+    throw std::invalid_argument("Error: The raztex file '" + filePath + "' has mipmaps' entries out of its bounds");
+
+  content.mipmaps.resize(header.mipmapCount);
+
+  for (uint32_t mipmapIndex = 0; mipmapIndex < header.mipmapCount; ++mipmapIndex) {
+    MipmapEntry mipmapEntry {};
+    std::memcpy(&mipmapEntry, fileContent.data() + sizeof(Header) + mipmapIndex * sizeof(MipmapEntry), sizeof(MipmapEntry));
+
+    Mipmap& mipmap = content.mipmaps[mipmapIndex];
+    mipmap.width   = std::max(header.width >> mipmapIndex, 1u);
+    mipmap.height  = std::max(header.height >> mipmapIndex, 1u);
+
+    if (mipmapEntry.dataSize != computeDataSize(mipmap.width, mipmap.height, header.pixelFormat)
+     || !isRangeValid(mipmapEntry.dataOffset, mipmapEntry.dataSize, sizeof(uint8_t), header.fileSize))
+      throw std::invalid_argument("Error: The raztex file '" + filePath + "' has a mipmap out of its bounds");
+
+    mipmap.data     = reinterpret_cast<const uint8_t*>(fileContent.data() + mipmapEntry.dataOffset);
+    mipmap.dataSize = mipmapEntry.dataSize;
+  }
+
+  return content;
+}
+
+} // namespace Raz::RaztexFormat
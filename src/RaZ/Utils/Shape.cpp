@@ -1,5 +1,8 @@
+#include "RaZ/Math/FastMath.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
+#include <array>
+
 namespace Raz {
 
 // Line functions
@@ -83,11 +86,16 @@ Vec3f Line::computeProjection(const Vec3f& point) const {
   return m_beginPos + lineVec * std::clamp(pointDist, 0.f, 1.f);
 }
 
+AABB Line::computeBoundingBox() const {
+  return AABB(Vec3f(std::min(m_beginPos.x(), m_endPos.x()), std::min(m_beginPos.y(), m_endPos.y()), std::min(m_beginPos.z(), m_endPos.z())),
+              Vec3f(std::max(m_beginPos.x(), m_endPos.x()), std::max(m_beginPos.y(), m_endPos.y()), std::max(m_beginPos.z(), m_endPos.z())));
+}
+
 // Plane functions
 
 bool Plane::intersects(const Plane& plane) const {
   const float planesAngle = m_normal.dot(plane.getNormal());
-  return !FloatUtils::areNearlyEqual(std::abs(planesAngle), 1.f);
+  return !FloatUtils::areNearlyEqual(std::abs(planesAngle), 1.f, FastMath::comparisonTolerance);
 }
 
 bool Plane::intersects(const Sphere& sphere) const {
@@ -118,6 +126,10 @@ bool Plane::intersects(const OBB&) const {
   throw std::runtime_error("Error: Not implemented yet.");
 }
 
+AABB Plane::computeBoundingBox() const {
+  return AABB(Vec3f(std::numeric_limits<float>::lowest()), Vec3f(std::numeric_limits<float>::max()));
+}
+
 // Sphere functions
 
 bool Sphere::contains(const Vec3f& point) const {
@@ -151,6 +163,10 @@ bool Sphere::intersects(const OBB&) const {
   throw std::runtime_error("Error: Not implemented yet.");
 }
 
+AABB Sphere::computeBoundingBox() const {
+  return AABB(m_centerPos - m_radius, m_centerPos + m_radius);
+}
+
 // Triangle functions
 
 bool Triangle::intersects(const Triangle&) const {
@@ -161,16 +177,127 @@ bool Triangle::intersects(const Quad&) const {
   throw std::runtime_error("Error: Not implemented yet.");
 }
 
-bool Triangle::intersects(const AABB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Triangle::intersects(const AABB& aabb) const {
+  // Separating axis test based on Tomas Akenine-Möller's "Fast 3D Triangle-Box Overlap Testing":
+  //  - https://fileadmin.cs.lth.se/cs/Personal/Tomas_Akenine-Moller/code/tribox_tam.pdf
+  // The triangle is translated so that the box is centered at the origin
+
+  const Vec3f boxCentroid    = aabb.computeCentroid();
+  const Vec3f boxHalfExtents = aabb.computeHalfExtents();
+
+  const std::array<Vec3f, 3> points = { m_firstPos - boxCentroid, m_secondPos - boxCentroid, m_thirdPos - boxCentroid };
+  const std::array<Vec3f, 3> edges  = { points[1] - points[0], points[2] - points[1], points[0] - points[2] };
+
+  // Checking the box's axes, which amounts to an intersection check between the box & the triangle's bounding box
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    const float minPoint = std::min(points[0][axisIndex], std::min(points[1][axisIndex], points[2][axisIndex]));
+    const float maxPoint = std::max(points[0][axisIndex], std::max(points[1][axisIndex], points[2][axisIndex]));
+
+    if (minPoint > boxHalfExtents[axisIndex] || maxPoint < -boxHalfExtents[axisIndex])
+      return false;
+  }
+
+  // Checking the 9 axes given by the cross products between the box's axes & the triangle's edges
+  for (const Vec3f& edge : edges) {
+    const std::array<Vec3f, 3> axes = { Vec3f(0.f, -edge.z(), edge.y()), Vec3f(edge.z(), 0.f, -edge.x()), Vec3f(-edge.y(), edge.x(), 0.f) };
+
+    for (const Vec3f& axis : axes) {
+      const float firstProj  = points[0].dot(axis);
+      const float secondProj = points[1].dot(axis);
+      const float thirdProj  = points[2].dot(axis);
+
+      const float boxRadius = boxHalfExtents.x() * std::abs(axis.x())
+                            + boxHalfExtents.y() * std::abs(axis.y())
+                            + boxHalfExtents.z() * std::abs(axis.z());
+
+      if (std::min(firstProj, std::min(secondProj, thirdProj)) > boxRadius || std::max(firstProj, std::max(secondProj, thirdProj)) < -boxRadius)
+        return false;
+    }
+  }
+
+  // Checking the triangle's normal, which amounts to a plane/box intersection check
+  const Vec3f normal = edges[0].cross(edges[1]);
+
+  const float boxRadius = boxHalfExtents.x() * std::abs(normal.x())
+                        + boxHalfExtents.y() * std::abs(normal.y())
+                        + boxHalfExtents.z() * std::abs(normal.z());
+
+  return (std::abs(normal.dot(points[0])) <= boxRadius);
 }
 
-bool Triangle::intersects(const OBB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Triangle::intersects(const OBB& obb) const {
+  // The triangle is transformed into the box's local space, in which the latter is an AABB centered at the origin
+  const Vec3f boxCentroid    = obb.computeCentroid();
+  const Vec3f boxHalfExtents = (obb.getRightTopFrontPos() - obb.getLeftBottomBackPos()) * 0.5f;
+
+  const Triangle localTriangle((m_firstPos - boxCentroid) * obb.getInverseRotation(),
+                               (m_secondPos - boxCentroid) * obb.getInverseRotation(),
+                               (m_thirdPos - boxCentroid) * obb.getInverseRotation());
+
+  return localTriangle.intersects(AABB(-boxHalfExtents, boxHalfExtents));
 }
 
-Vec3f Triangle::computeProjection(const Vec3f&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+Vec3f Triangle::computeProjection(const Vec3f& point) const {
+  // Closest point computation based on Christer Ericson's, from "Real-Time Collision Detection" (section 5.1.5)
+  // The point is successively checked against each Voronoi region of the triangle
+
+  const Vec3f firstEdge  = m_secondPos - m_firstPos;
+  const Vec3f secondEdge = m_thirdPos - m_firstPos;
+
+  const Vec3f firstDir = point - m_firstPos;
+  const float firstDot  = firstEdge.dot(firstDir);
+  const float secondDot = secondEdge.dot(firstDir);
+
+  if (firstDot <= 0.f && secondDot <= 0.f)
+    return m_firstPos;
+
+  const Vec3f secondDir = point - m_secondPos;
+  const float thirdDot  = firstEdge.dot(secondDir);
+  const float fourthDot = secondEdge.dot(secondDir);
+
+  if (thirdDot >= 0.f && fourthDot <= thirdDot)
+    return m_secondPos;
+
+  const float thirdRegion = firstDot * fourthDot - thirdDot * secondDot;
+
+  if (thirdRegion <= 0.f && firstDot >= 0.f && thirdDot <= 0.f)
+    return m_firstPos + firstEdge * (firstDot / (firstDot - thirdDot));
+
+  const Vec3f thirdDir = point - m_thirdPos;
+  const float fifthDot = firstEdge.dot(thirdDir);
+  const float sixthDot = secondEdge.dot(thirdDir);
+
+  if (sixthDot >= 0.f && fifthDot <= sixthDot)
+    return m_thirdPos;
+
+  const float secondRegion = fifthDot * secondDot - firstDot * sixthDot;
+
+  if (secondRegion <= 0.f && secondDot >= 0.f && sixthDot <= 0.f)
+    return m_firstPos + secondEdge * (secondDot / (secondDot - sixthDot));
+
+  const float firstRegion = thirdDot * sixthDot - fifthDot * fourthDot;
+
+  if (firstRegion <= 0.f && (fourthDot - thirdDot) >= 0.f && (fifthDot - sixthDot) >= 0.f)
+    return m_secondPos + (m_thirdPos - m_secondPos) * ((fourthDot - thirdDot) / ((fourthDot - thirdDot) + (fifthDot - sixthDot)));
+
+  // The point projects inside the triangle's face
+  const float invDenom     = 1.f / (firstRegion + secondRegion + thirdRegion);
+  const float secondWeight = secondRegion * invDenom;
+  const float thirdWeight  = thirdRegion * invDenom;
+
+  return m_firstPos + firstEdge * secondWeight + secondEdge * thirdWeight;
+}
+
+AABB Triangle::computeBoundingBox() const {
+  const float minX = std::min(m_firstPos.x(), std::min(m_secondPos.x(), m_thirdPos.x()));
+  const float minY = std::min(m_firstPos.y(), std::min(m_secondPos.y(), m_thirdPos.y()));
+  const float minZ = std::min(m_firstPos.z(), std::min(m_secondPos.z(), m_thirdPos.z()));
+
+  const float maxX = std::max(m_firstPos.x(), std::max(m_secondPos.x(), m_thirdPos.x()));
+  const float maxY = std::max(m_firstPos.y(), std::max(m_secondPos.y(), m_thirdPos.y()));
+  const float maxZ = std::max(m_firstPos.z(), std::max(m_secondPos.z(), m_thirdPos.z()));
+
+  return AABB(Vec3f(minX, minY, minZ), Vec3f(maxX, maxY, maxZ));
 }
 
 Vec3f Triangle::computeNormal() const {
@@ -207,6 +334,18 @@ Vec3f Quad::computeProjection(const Vec3f&) const {
   throw std::runtime_error("Error: Not implemented yet.");
 }
 
+AABB Quad::computeBoundingBox() const {
+  const float minX = std::min(std::min(m_leftTopPos.x(), m_rightTopPos.x()), std::min(m_rightBottomPos.x(), m_leftBottomPos.x()));
+  const float minY = std::min(std::min(m_leftTopPos.y(), m_rightTopPos.y()), std::min(m_rightBottomPos.y(), m_leftBottomPos.y()));
+  const float minZ = std::min(std::min(m_leftTopPos.z(), m_rightTopPos.z()), std::min(m_rightBottomPos.z(), m_leftBottomPos.z()));
+
+  const float maxX = std::max(std::max(m_leftTopPos.x(), m_rightTopPos.x()), std::max(m_rightBottomPos.x(), m_leftBottomPos.x()));
+  const float maxY = std::max(std::max(m_leftTopPos.y(), m_rightTopPos.y()), std::max(m_rightBottomPos.y(), m_leftBottomPos.y()));
+  const float maxZ = std::max(std::max(m_leftTopPos.z(), m_rightTopPos.z()), std::max(m_rightBottomPos.z(), m_leftBottomPos.z()));
+
+  return AABB(Vec3f(minX, minY, minZ), Vec3f(maxX, maxY, maxZ));
+}
+
 // AABB functions
 
 bool AABB::contains(const Vec3f& point) const {
@@ -280,4 +419,18 @@ Vec3f OBB::computeProjection(const Vec3f&) const {
   throw std::runtime_error("Error: Not implemented yet.");
 }
 
+AABB OBB::computeBoundingBox() const {
+  // The extent on each axis is given by the sum of the absolute projections of the rotated local axes
+  const Vec3f localHalfExtents = m_aabb.computeHalfExtents();
+  Vec3f halfExtents;
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    for (std::size_t localAxisIndex = 0; localAxisIndex < 3; ++localAxisIndex)
+      halfExtents[axisIndex] += localHalfExtents[localAxisIndex] * std::abs(m_rotation[localAxisIndex * 3 + axisIndex]);
+  }
+
+  const Vec3f centroid = m_aabb.computeCentroid();
+  return AABB(centroid - halfExtents, centroid + halfExtents);
+}
+
 } // namespace Raz
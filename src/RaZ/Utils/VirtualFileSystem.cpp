@@ -0,0 +1,124 @@
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/VirtualFileSystem.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+namespace Raz::VirtualFileSystem {
+
+namespace {
+
+struct MountedArchive {
+  std::string archivePath;
+  std::string mountPoint;
+  std::unique_ptr<AssetArchive> archive;
+};
+
+struct MountedArchives {
+  std::vector<MountedArchive> archives;
+  std::shared_mutex mutex;
+};
+
+MountedArchives& getMountedArchives() {
+  static MountedArchives mountedArchives;
+  return mountedArchives;
+}
+
+} // namespace
+
+void mount(const FilePath& archivePath, const FilePath& mountPoint) {
+  std::string normalizedMountPoint = normalizePath(mountPoint.toUtf8());
+
+  if (!normalizedMountPoint.empty() && normalizedMountPoint.back() != '/')
+    normalizedMountPoint.push_back('/');
+
+  auto archive = std::make_unique<AssetArchive>(archivePath);
+
+  MountedArchives& mountedArchives = getMountedArchives();
+  const std::unique_lock<std::shared_mutex> lock(mountedArchives.mutex);
+  mountedArchives.archives.push_back(MountedArchive{ archivePath.toUtf8(), std::move(normalizedMountPoint), std::move(archive) });
+}
+
+void unmount(const FilePath& archivePath) {
+  MountedArchives& mountedArchives = getMountedArchives();
+  const std::unique_lock<std::shared_mutex> lock(mountedArchives.mutex);
+
+  const std::string archivePathStr = archivePath.toUtf8();
+  mountedArchives.archives.erase(std::remove_if(mountedArchives.archives.begin(), mountedArchives.archives.end(), [&archivePathStr] (const MountedArchive& mountedArchive) {
+    return (mountedArchive.archivePath == archivePathStr);
+  }), mountedArchives.archives.end());
+}
+
+void unmountAll() {
+  MountedArchives& mountedArchives = getMountedArchives();
+  const std::unique_lock<std::shared_mutex> lock(mountedArchives.mutex);
+  mountedArchives.archives.clear();
+}
+
+bool hasMountedArchives() {
+  MountedArchives& mountedArchives = getMountedArchives();
+  const std::shared_lock<std::shared_mutex> lock(mountedArchives.mutex);
+  return !mountedArchives.archives.empty();
+}
+
+std::optional<ArchiveEntry> find(const FilePath& filePath) {
+  MountedArchives& mountedArchives = getMountedArchives();
+  const std::shared_lock<std::shared_mutex> lock(mountedArchives.mutex);
+
+  if (mountedArchives.archives.empty())
+    return std::nullopt;
+
+  const std::string path = normalizePath(filePath.toUtf8());
+
+  for (auto archiveIter = mountedArchives.archives.crbegin(); archiveIter != mountedArchives.archives.crend(); ++archiveIter) {
+    if (path.compare(0, archiveIter->mountPoint.size(), archiveIter->mountPoint) != 0)
+      continue;
+
+    std::optional<ArchiveEntry> entry = archiveIter->archive->find(std::string_view(path).substr(archiveIter->mountPoint.size()));
+
+    if (entry)
+      return entry;
+  }
+
+  return std::nullopt;
+}
+
+std::string normalizePath(std::string path) {
+  std::replace(path.begin(), path.end(), '\\', '/');
+
+  const bool isAbsolute = (!path.empty() && path.front() == '/');
+  std::vector<std::string_view> components;
+
+  for (std::size_t componentStart = 0; componentStart <= path.size();) {
+    const std::size_t componentEnd = std::min(path.find('/', componentStart), path.size());
+    const std::string_view component = std::string_view(path).substr(componentStart, componentEnd - componentStart);
+
+    if (component == "..") {
+      // A parent component can only be removed if its parent is known; otherwise, it is kept
+      if (!components.empty() && components.back() != "..")
+        components.pop_back();
+      else if (!isAbsolute)
+        components.push_back(component);
+    } else if (!component.empty() && component != ".") {
+      components.push_back(component);
+    }
+
+    componentStart = componentEnd + 1;
+  }
+
+  std::string normalizedPath = (isAbsolute ? "/" : "");
+
+  for (std::size_t componentIndex = 0; componentIndex < components.size(); ++componentIndex) {
+    if (componentIndex > 0)
+      normalizedPath.push_back('/');
+
+    normalizedPath += components[componentIndex];
+  }
+
+  return normalizedPath;
+}
+
+} // namespace Raz::VirtualFileSystem
@@ -0,0 +1,75 @@
+#include "Catch.hpp"
+
+#include "RaZ/Math/Affine.hpp"
+#include "RaZ/Math/Quaternion.hpp"
+#include "RaZ/Math/Transform.hpp"
+
+using namespace Raz::Literals;
+
+namespace {
+
+const Raz::Affine3f rigid(Raz::Mat3f(Raz::Quaternionf(45.0_deg, Raz::Vec3f(1.f, 2.f, -3.f).normalize()).computeMatrix()), Raz::Vec3f(1.f, -2.f, 3.f));
+const Raz::Affine3f affine(Raz::Mat3f(2.f,   0.5f,  0.f,
+                                      0.f,   -3.f,  1.f,
+                                      0.25f, 0.f,   1.5f), Raz::Vec3f(-4.f, 5.f, 0.5f));
+
+} // namespace
+
+TEST_CASE("Affine3 matrix conversion") {
+  CHECK(Raz::Affine3f().computeMatrix() == Raz::Mat4f::identity());
+  CHECK(Raz::Affine3f::identity() == Raz::Affine3f(Raz::Mat4f::identity()));
+
+  const Raz::Mat4f affineMat = affine.computeMatrix();
+  CHECK(affineMat == Raz::Mat4f(2.f,   0.5f, 0.f,  0.f,
+                                0.f,   -3.f, 1.f,  0.f,
+                                0.25f, 0.f,  1.5f, 0.f,
+                                -4.f,  5.f,  0.5f, 1.f));
+  CHECK(Raz::Affine3f(affineMat) == affine);
+  CHECK(static_cast<Raz::Mat4f>(rigid) == rigid.computeMatrix());
+}
+
+TEST_CASE("Affine3 transformation") {
+  const Raz::Vec3f point(1.f, -1.f, 2.f);
+  const Raz::Mat4f affineMat = affine.computeMatrix();
+
+  CHECK(affine.transformPoint(point) == Raz::Vec3f(Raz::Vec4f(point, 1.f) * affineMat));
+  CHECK(affine.transformDirection(point) == Raz::Vec3f(Raz::Vec4f(point, 0.f) * affineMat));
+  CHECK(rigid.transformPoint(point) == Raz::Vec3f(Raz::Vec4f(point, 1.f) * rigid.computeMatrix()));
+
+  // Composing transformations must be equivalent to multiplying their matrices, the first one being applied first
+  CHECK((rigid * affine).computeMatrix() == rigid.computeMatrix() * affineMat);
+  CHECK((affine * rigid).computeMatrix() == affineMat * rigid.computeMatrix());
+  CHECK((affine * rigid).transformPoint(point) == rigid.transformPoint(affine.transformPoint(point)));
+
+  Raz::Affine3f composed = affine;
+  composed *= rigid;
+  CHECK(composed == affine * rigid);
+}
+
+TEST_CASE("Affine3 inverse") {
+  CHECK(Raz::Affine3f::identity().inverse() == Raz::Affine3f::identity());
+  CHECK(Raz::Affine3f::identity().inverseRigid() == Raz::Affine3f::identity());
+
+  CHECK_THAT(rigid.inverseRigid().computeMatrix(), IsNearlyEqualToMatrix(rigid.computeMatrix().inverse(), 0.000001f));
+  CHECK_THAT(rigid.inverse().computeMatrix(), IsNearlyEqualToMatrix(rigid.computeMatrix().inverse(), 0.000001f));
+  CHECK_THAT((rigid * rigid.inverseRigid()).computeMatrix(), IsNearlyEqualToMatrix(Raz::Mat4f::identity()));
+
+  CHECK_THAT(affine.inverse().computeMatrix(), IsNearlyEqualToMatrix(affine.computeMatrix().inverse(), 0.000001f));
+  CHECK_THAT((affine * affine.inverse()).computeMatrix(), IsNearlyEqualToMatrix(Raz::Mat4f::identity(), 0.000001f));
+
+  const Raz::Vec3f point(3.f, 2.f, -1.f);
+  CHECK_THAT(affine.inverse().transformPoint(affine.transformPoint(point)), IsNearlyEqualToVector(point, 0.000001f));
+}
+
+TEST_CASE("Affine3 from Transform") {
+  const Raz::Transform transform(Raz::Vec3f(1.f, 2.f, 3.f), Raz::Quaternionf(30.0_deg, Raz::Axis::Y), Raz::Vec3f(2.f, 0.5f, 3.f));
+
+  const Raz::Mat4f scale(2.f, 0.f,  0.f, 0.f,
+                         0.f, 0.5f, 0.f, 0.f,
+                         0.f, 0.f,  3.f, 0.f,
+                         0.f, 0.f,  0.f, 1.f);
+  const Raz::Mat4f expectedMat = scale * transform.getRotation().computeMatrix() * transform.computeTranslationMatrix();
+
+  CHECK_THAT(transform.computeAffineTransform().computeMatrix(), IsNearlyEqualToMatrix(expectedMat));
+  CHECK_THAT(transform.computeTransformMatrix(), IsNearlyEqualToMatrix(expectedMat));
+}
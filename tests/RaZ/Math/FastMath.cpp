@@ -0,0 +1,225 @@
+#include "Catch.hpp"
+
+#include "RaZ/Math/FastMath.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace {
+
+using Raz::FastMath::Precision;
+
+float computeFloat(uint32_t bits) {
+  float value {};
+  std::memcpy(&value, &bits, sizeof(float));
+  return value;
+}
+
+double computeRelativeError(float value, double expectedValue) {
+  return std::abs(static_cast<double>(value) - expectedValue) / std::abs(expectedValue);
+}
+
+double computeAbsoluteError(float value, double expectedValue) {
+  return std::abs(static_cast<double>(value) - expectedValue);
+}
+
+// Checks that the array function gives the same results as the single-value one; the array's size is such that all lanes widths are used
+bool checkArrayResults(const std::vector<float>& values, void (*arrayFunc)(const float*, float*, std::size_t) noexcept, float (*scalarFunc)(float) noexcept) {
+  std::vector<float> results(values.size());
+  arrayFunc(values.data(), results.data(), values.size());
+
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    const float expectedValue = scalarFunc(values[i]);
+
+    if (std::memcmp(&results[i], &expectedValue, sizeof(float)) != 0)
+      return false;
+  }
+
+  return true;
+}
+
+template <Precision P>
+double computeRsqrtError() {
+  // The hardware estimates only depend on the mantissa & the exponent's parity: checking all values in [1; 4[ covers all cases
+  double maxError = 0.0;
+
+  for (uint32_t bits = 0x3F800000u; bits < 0x40800000u; ++bits) {
+    const float value = computeFloat(bits);
+    maxError = std::max(maxError, computeRelativeError(Raz::FastMath::rsqrt<P>(value), 1.0 / std::sqrt(static_cast<double>(value))));
+  }
+
+  return maxError;
+}
+
+template <Precision P>
+double computeSinCosError() {
+  double maxError = 0.0;
+
+  for (int i = -200000; i <= 200000; ++i) {
+    for (const float angle : { static_cast<float>(i) * 0.5f, static_cast<float>(i) * 0.0000157f }) {
+      maxError = std::max(maxError, computeAbsoluteError(Raz::FastMath::sin<P>(angle), std::sin(static_cast<double>(angle))));
+      maxError = std::max(maxError, computeAbsoluteError(Raz::FastMath::cos<P>(angle), std::cos(static_cast<double>(angle))));
+    }
+  }
+
+  return maxError;
+}
+
+template <Precision P>
+double computeAcosError() {
+  double maxError = 0.0;
+
+  for (int i = -200000; i <= 200000; ++i) {
+    const float value = static_cast<float>(i) / 200000.f;
+    maxError = std::max(maxError, computeAbsoluteError(Raz::FastMath::acos<P>(value), std::acos(static_cast<double>(value))));
+  }
+
+  return maxError;
+}
+
+template <Precision P>
+double computeAtan2Error() {
+  double maxError = 0.0;
+
+  for (int i = 0; i < 400000; ++i) {
+    const float angle  = static_cast<float>(i) * 0.0000157f;
+    const float radius = 0.001f + static_cast<float>(i % 997) * 3.f;
+    const float y      = radius * std::sin(angle);
+    const float x      = radius * std::cos(angle);
+
+    maxError = std::max(maxError, computeAbsoluteError(Raz::FastMath::atan2<P>(y, x), std::atan2(static_cast<double>(y), static_cast<double>(x))));
+  }
+
+  return maxError;
+}
+
+template <Precision P>
+double computeExpError() {
+  double maxError = 0.0;
+
+  for (int i = -400000; i <= 400000; ++i) {
+    const float value = static_cast<float>(i) * 0.000219f;
+    const double expectedValue = std::exp(static_cast<double>(value));
+
+    // Only normal results are checked
+    if (expectedValue < static_cast<double>(std::numeric_limits<float>::min()) || expectedValue > static_cast<double>(std::numeric_limits<float>::max()))
+      continue;
+
+    maxError = std::max(maxError, computeRelativeError(Raz::FastMath::exp<P>(value), expectedValue));
+  }
+
+  return maxError;
+}
+
+template <Precision P>
+double computeLogError() {
+  double maxError = 0.0;
+
+  const auto checkValue = [&maxError] (float value) {
+    const double expectedValue = std::log(static_cast<double>(value));
+    maxError = std::max(maxError, computeAbsoluteError(Raz::FastMath::log<P>(value), expectedValue) / std::max(1.0, std::abs(expectedValue)));
+  };
+
+  // Sampling all normal floats, & checking all values in [0.5; 2[, around which the results are the closest to 0
+  for (uint32_t bits = 0x00800000u; bits < 0x7F800000u; bits += 997)
+    checkValue(computeFloat(bits));
+
+  for (uint32_t bits = 0x3F000000u; bits < 0x40000000u; bits += 7)
+    checkValue(computeFloat(bits));
+
+  return maxError;
+}
+
+} // namespace
+
+TEST_CASE("FastMath rsqrt") {
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+  CHECK(computeRsqrtError<Precision::LOW>() < 4e-4);
+#else
+  CHECK(computeRsqrtError<Precision::LOW>() < 2e-3);
+#endif
+  CHECK(computeRsqrtError<Precision::HIGH>() < 1e-6);
+
+  CHECK(Raz::FastMath::rsqrt(0.f) == std::numeric_limits<float>::infinity());
+  CHECK(std::isnan(Raz::FastMath::rsqrt(-1.f)));
+
+  // The array function may not give the exact same results, but must have the same precision
+  std::vector<float> values(1027);
+  for (std::size_t i = 0; i < values.size(); ++i)
+    values[i] = 0.01f + static_cast<float>(i) * 0.37f;
+
+  std::vector<float> results(values.size());
+  Raz::FastMath::rsqrt(values.data(), results.data(), values.size());
+
+  double maxError = 0.0;
+  for (std::size_t i = 0; i < values.size(); ++i)
+    maxError = std::max(maxError, computeRelativeError(results[i], 1.0 / std::sqrt(static_cast<double>(values[i]))));
+  CHECK(maxError < 1e-6);
+}
+
+TEST_CASE("FastMath trigonometry") {
+  CHECK(computeSinCosError<Precision::LOW>() < 2e-4);
+  CHECK(computeSinCosError<Precision::HIGH>() < 3e-7);
+
+  CHECK(computeAcosError<Precision::LOW>() < 1e-4);
+  CHECK(computeAcosError<Precision::HIGH>() < 5e-7);
+
+  CHECK(computeAtan2Error<Precision::LOW>() < 1e-4);
+  CHECK(computeAtan2Error<Precision::HIGH>() < 5e-7);
+
+  CHECK(Raz::FastMath::atan2(0.f, 0.f) == 0.f);
+}
+
+TEST_CASE("FastMath exponential & logarithm") {
+  CHECK(computeExpError<Precision::LOW>() < 1e-4);
+  CHECK(computeExpError<Precision::HIGH>() < 3e-7);
+
+  CHECK(computeLogError<Precision::LOW>() < 1e-5);
+  CHECK(computeLogError<Precision::HIGH>() < 3e-7);
+
+  CHECK(Raz::FastMath::exp(100.f) == std::numeric_limits<float>::infinity());
+  CHECK(Raz::FastMath::exp(-200.f) == 0.f);
+  CHECK(std::isnan(Raz::FastMath::exp(std::numeric_limits<float>::quiet_NaN())));
+
+  CHECK(Raz::FastMath::log(0.f) == -std::numeric_limits<float>::infinity());
+  CHECK(Raz::FastMath::log(std::numeric_limits<float>::infinity()) == std::numeric_limits<float>::infinity());
+  CHECK(std::isnan(Raz::FastMath::log(-1.f)));
+  CHECK_THAT(Raz::FastMath::log(1e-40f), IsNearlyEqualTo(-92.1034037f, 0.00001f)); // Subnormal value
+}
+
+TEST_CASE("FastMath array functions") {
+  std::vector<float> values(1027);
+  for (std::size_t i = 0; i < values.size(); ++i)
+    values[i] = -50.f + static_cast<float>(i) * 0.0973f;
+
+  std::vector<float> unitValues(values.size());
+  for (std::size_t i = 0; i < values.size(); ++i)
+    unitValues[i] = values[i] / 50.f;
+
+  CHECK(checkArrayResults(values, Raz::FastMath::sin<Precision::LOW>, Raz::FastMath::sin<Precision::LOW>));
+  CHECK(checkArrayResults(values, Raz::FastMath::sin<Precision::HIGH>, Raz::FastMath::sin<Precision::HIGH>));
+  CHECK(checkArrayResults(values, Raz::FastMath::cos<Precision::LOW>, Raz::FastMath::cos<Precision::LOW>));
+  CHECK(checkArrayResults(values, Raz::FastMath::cos<Precision::HIGH>, Raz::FastMath::cos<Precision::HIGH>));
+  CHECK(checkArrayResults(unitValues, Raz::FastMath::acos<Precision::LOW>, Raz::FastMath::acos<Precision::LOW>));
+  CHECK(checkArrayResults(unitValues, Raz::FastMath::acos<Precision::HIGH>, Raz::FastMath::acos<Precision::HIGH>));
+  CHECK(checkArrayResults(values, Raz::FastMath::exp<Precision::LOW>, Raz::FastMath::exp<Precision::LOW>));
+  CHECK(checkArrayResults(values, Raz::FastMath::exp<Precision::HIGH>, Raz::FastMath::exp<Precision::HIGH>));
+  CHECK(checkArrayResults(values, Raz::FastMath::log<Precision::LOW>, Raz::FastMath::log<Precision::LOW>));
+  CHECK(checkArrayResults(values, Raz::FastMath::log<Precision::HIGH>, Raz::FastMath::log<Precision::HIGH>));
+
+  // The arc tangent takes two values; the Y ones are the current values, & the X ones the reversed values
+  std::vector<float> reversedValues(values.rbegin(), values.rend());
+  std::vector<float> results(values.size());
+
+  Raz::FastMath::atan2<Precision::HIGH>(values.data(), reversedValues.data(), results.data(), values.size());
+
+  std::size_t mismatchCount = 0;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (results[i] != Raz::FastMath::atan2<Precision::HIGH>(values[i], reversedValues[i]))
+      ++mismatchCount;
+  }
+  CHECK(mismatchCount == 0);
+}
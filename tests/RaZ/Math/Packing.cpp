@@ -0,0 +1,345 @@
+#include "Catch.hpp"
+
+#include "RaZ/Math/Packing.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace {
+
+uint32_t recoverBits(float value) {
+  uint32_t bits {};
+  std::memcpy(&bits, &value, sizeof(float));
+  return bits;
+}
+
+float recoverFloat(uint32_t bits) {
+  float value {};
+  std::memcpy(&value, &bits, sizeof(float));
+  return value;
+}
+
+bool isHalfNan(uint16_t halfBits) { return ((halfBits & 0x7C00u) == 0x7C00u && (halfBits & 0x3FFu) != 0); }
+
+} // namespace
+
+TEST_CASE("Packing half-precision conversion") {
+  CHECK(Raz::Packing::convertToHalf(0.f) == 0x0000);
+  CHECK(Raz::Packing::convertToHalf(-0.f) == 0x8000);
+  CHECK(Raz::Packing::convertToHalf(1.f) == 0x3C00);
+  CHECK(Raz::Packing::convertToHalf(-2.f) == 0xC000);
+  CHECK(Raz::Packing::convertToHalf(0.1f) == 0x2E66);
+  CHECK(Raz::Packing::convertToHalf(65504.f) == 0x7BFF); // Highest finite value
+  CHECK(Raz::Packing::convertToHalf(65519.f) == 0x7BFF);
+  CHECK(Raz::Packing::convertToHalf(65520.f) == 0x7C00); // Rounded to infinity
+  CHECK(Raz::Packing::convertToHalf(std::numeric_limits<float>::infinity()) == 0x7C00);
+  CHECK(Raz::Packing::convertToHalf(-std::numeric_limits<float>::infinity()) == 0xFC00);
+  CHECK(Raz::Packing::convertToHalf(std::ldexp(1.f, -14)) == 0x0400); // Lowest normal value
+  CHECK(Raz::Packing::convertToHalf(std::ldexp(1.f, -24)) == 0x0001); // Lowest subnormal value
+  CHECK(Raz::Packing::convertToHalf(std::ldexp(1.f, -25)) == 0x0000); // Tie, rounded to the even value
+  CHECK(Raz::Packing::convertToHalf(std::ldexp(1.5f, -25)) == 0x0001);
+  CHECK(isHalfNan(Raz::Packing::convertToHalf(std::numeric_limits<float>::quiet_NaN())));
+  CHECK(isHalfNan(Raz::Packing::convertToHalf(recoverFloat(0x7F800001u)))); // Signaling NaN with only its lowest payload bit set
+
+  CHECK(Raz::Packing::convertFromHalf(0x3C00) == 1.f);
+  CHECK(Raz::Packing::convertFromHalf(0xC000) == -2.f);
+  CHECK(Raz::Packing::convertFromHalf(0x7BFF) == 65504.f);
+  CHECK(Raz::Packing::convertFromHalf(0x0001) == std::ldexp(1.f, -24));
+  CHECK(Raz::Packing::convertFromHalf(0xFC00) == -std::numeric_limits<float>::infinity());
+  CHECK(std::isnan(Raz::Packing::convertFromHalf(0x7E00)));
+
+  CHECK(static_cast<float>(Raz::Half(3.140625f)) == 3.140625f);
+  CHECK(Raz::Half(3.14159265f).getBits() == 0x4248);
+  CHECK(Raz::Half::fromBits(0x4248).getBits() == 0x4248);
+
+  // All half-precision values must be converted to floats & back without any change; NaNs only get their quiet bit set
+  std::size_t mismatchCount = 0;
+
+  for (uint32_t halfBits = 0; halfBits <= 0xFFFF; ++halfBits) {
+    const auto expectedBits = static_cast<uint16_t>(isHalfNan(static_cast<uint16_t>(halfBits)) ? (halfBits | 0x200u) : halfBits);
+
+    if (Raz::Packing::convertToHalf(Raz::Packing::convertFromHalf(static_cast<uint16_t>(halfBits))) != expectedBits)
+      ++mismatchCount;
+  }
+
+  CHECK(mismatchCount == 0);
+
+  // Each value located exactly between two consecutive half-precision values must be rounded to the even one; the floats directly surrounding it
+  //  must be rounded to the closest one. The midpoint between the highest finite value & the next power of 2 gives infinity
+  mismatchCount = 0;
+
+  for (uint16_t halfBits = 0; halfBits < 0x7C00; ++halfBits) {
+    const auto nextBits = static_cast<uint16_t>(halfBits + 1);
+    const float value     = Raz::Packing::convertFromHalf(halfBits);
+    const float nextValue = (nextBits == 0x7C00 ? 65536.f : Raz::Packing::convertFromHalf(nextBits));
+    const float midpoint  = value + (nextValue - value) * 0.5f;
+
+    for (const uint16_t signBit : { uint16_t(0x0000), uint16_t(0x8000) }) {
+      const float sign = (signBit ? -1.f : 1.f);
+
+      if (Raz::Packing::convertToHalf(midpoint * sign) != ((halfBits & 1u) ? nextBits : halfBits) + signBit
+       || Raz::Packing::convertToHalf(std::nextafter(midpoint, value) * sign) != halfBits + signBit
+       || Raz::Packing::convertToHalf(std::nextafter(midpoint, nextValue) * sign) != nextBits + signBit)
+        ++mismatchCount;
+    }
+  }
+
+  CHECK(mismatchCount == 0);
+}
+
+TEST_CASE("Packing half-precision array conversion") {
+  // Checking all half-precision values, the midpoints between them, & floats spread across the whole range of bits, including NaNs
+  std::vector<float> values;
+
+  for (uint32_t halfBits = 0; halfBits <= 0xFFFF; ++halfBits) {
+    const float value = Raz::Packing::convertFromHalf(static_cast<uint16_t>(halfBits));
+    values.push_back(value);
+    values.push_back(recoverFloat(recoverBits(value) + 0x1000u)); // Midpoint with the next value
+  }
+
+  for (uint64_t bits = 0; bits <= 0xFFFFFFFFu; bits += 65521)
+    values.push_back(recoverFloat(static_cast<uint32_t>(bits)));
+
+  values.push_back(0.f); // Making the count not a multiple of 8
+
+  std::vector<uint16_t> halfBits(values.size());
+  Raz::Packing::convertToHalf(values.data(), halfBits.data(), values.size());
+
+  std::size_t mismatchCount = 0;
+
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (halfBits[i] != Raz::Packing::convertToHalf(values[i]))
+      ++mismatchCount;
+  }
+
+  CHECK(mismatchCount == 0);
+
+  std::vector<uint16_t> allHalfBits(0x10000 + 3);
+  for (std::size_t i = 0; i < allHalfBits.size(); ++i)
+    allHalfBits[i] = static_cast<uint16_t>(i);
+
+  std::vector<float> convertedValues(allHalfBits.size());
+  Raz::Packing::convertFromHalf(allHalfBits.data(), convertedValues.data(), allHalfBits.size());
+
+  mismatchCount = 0;
+
+  for (std::size_t i = 0; i < allHalfBits.size(); ++i) {
+    if (recoverBits(convertedValues[i]) != recoverBits(Raz::Packing::convertFromHalf(allHalfBits[i])))
+      ++mismatchCount;
+  }
+
+  CHECK(mismatchCount == 0);
+}
+
+TEST_CASE("Packing normalized integers") {
+  CHECK(Raz::Packing::packUnorm<uint8_t>(0.f) == 0);
+  CHECK(Raz::Packing::packUnorm<uint8_t>(1.f) == 255);
+  CHECK(Raz::Packing::packUnorm<uint8_t>(0.5f) == 128); // 127.5, rounded to the even value
+  CHECK(Raz::Packing::packUnorm<uint8_t>(-3.f) == 0);
+  CHECK(Raz::Packing::packUnorm<uint8_t>(3.f) == 255);
+  CHECK(Raz::Packing::packUnorm<uint8_t>(std::numeric_limits<float>::quiet_NaN()) == 0);
+  CHECK(Raz::Packing::packUnorm<uint16_t>(0.25f) == 16384);
+  CHECK(Raz::Packing::packSnorm<int8_t>(-1.f) == -127);
+  CHECK(Raz::Packing::packSnorm<int8_t>(-3.f) == -127);
+  CHECK(Raz::Packing::packSnorm<int8_t>(0.5f) == 64); // 63.5, rounded to the even value
+  CHECK(Raz::Packing::packSnorm<int16_t>(1.f) == 32767);
+  CHECK(Raz::Packing::unpackSnorm<int8_t>(-128) == -1.f);
+  CHECK(Raz::Packing::unpackSnorm<int16_t>(-32768) == -1.f);
+  CHECK(Raz::Packing::unpackUnorm<uint16_t>(65535) == 1.f);
+
+  // All integers must be unpacked & packed back without any change, apart from the lowest signed ones which give -1
+  std::size_t mismatchCount = 0;
+
+  for (int value = 0; value <= 255; ++value) {
+    if (Raz::Packing::packUnorm<uint8_t>(Raz::Packing::unpackUnorm(static_cast<uint8_t>(value))) != value)
+      ++mismatchCount;
+  }
+
+  for (int value = 0; value <= 65535; ++value) {
+    if (Raz::Packing::packUnorm<uint16_t>(Raz::Packing::unpackUnorm(static_cast<uint16_t>(value))) != value)
+      ++mismatchCount;
+  }
+
+  for (int value = -128; value <= 127; ++value) {
+    if (Raz::Packing::packSnorm<int8_t>(Raz::Packing::unpackSnorm(static_cast<int8_t>(value))) != std::max(value, -127))
+      ++mismatchCount;
+  }
+
+  for (int value = -32768; value <= 32767; ++value) {
+    if (Raz::Packing::packSnorm<int16_t>(Raz::Packing::unpackSnorm(static_cast<int16_t>(value))) != std::max(value, -32767))
+      ++mismatchCount;
+  }
+
+  CHECK(mismatchCount == 0);
+}
+
+TEST_CASE("Packing normalized integers arrays") {
+  // The values go beyond both bounds & include a NaN; their count is not a multiple of 8
+  std::vector<float> values(1027);
+  for (std::size_t i = 0; i < values.size(); ++i)
+    values[i] = -1.5f + static_cast<float>(i) * 0.00293f;
+  values[517] = std::numeric_limits<float>::quiet_NaN();
+
+  std::vector<uint8_t> unorm8(values.size());
+  std::vector<uint16_t> unorm16(values.size());
+  std::vector<int8_t> snorm8(values.size());
+  std::vector<int16_t> snorm16(values.size());
+  Raz::Packing::packUnorm(values.data(), unorm8.data(), values.size());
+  Raz::Packing::packUnorm(values.data(), unorm16.data(), values.size());
+  Raz::Packing::packSnorm(values.data(), snorm8.data(), values.size());
+  Raz::Packing::packSnorm(values.data(), snorm16.data(), values.size());
+
+  std::size_t mismatchCount = 0;
+
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (unorm8[i] != Raz::Packing::packUnorm<uint8_t>(values[i]) || unorm16[i] != Raz::Packing::packUnorm<uint16_t>(values[i])
+     || snorm8[i] != Raz::Packing::packSnorm<int8_t>(values[i]) || snorm16[i] != Raz::Packing::packSnorm<int16_t>(values[i]))
+      ++mismatchCount;
+  }
+
+  CHECK(mismatchCount == 0);
+
+  // Unpacking all integers
+  std::vector<uint16_t> allUnorm16(65536 + 3);
+  std::vector<int16_t> allSnorm16(allUnorm16.size());
+  std::vector<uint8_t> allUnorm8(256 + 3);
+  std::vector<int8_t> allSnorm8(allUnorm8.size());
+
+  for (std::size_t i = 0; i < allUnorm16.size(); ++i) {
+    allUnorm16[i] = static_cast<uint16_t>(i);
+    allSnorm16[i] = static_cast<int16_t>(static_cast<uint16_t>(i));
+  }
+
+  for (std::size_t i = 0; i < allUnorm8.size(); ++i) {
+    allUnorm8[i] = static_cast<uint8_t>(i);
+    allSnorm8[i] = static_cast<int8_t>(static_cast<uint8_t>(i));
+  }
+
+  std::vector<float> unpackedUnorm16(allUnorm16.size());
+  std::vector<float> unpackedSnorm16(allSnorm16.size());
+  std::vector<float> unpackedUnorm8(allUnorm8.size());
+  std::vector<float> unpackedSnorm8(allSnorm8.size());
+  Raz::Packing::unpackUnorm(allUnorm16.data(), unpackedUnorm16.data(), allUnorm16.size());
+  Raz::Packing::unpackSnorm(allSnorm16.data(), unpackedSnorm16.data(), allSnorm16.size());
+  Raz::Packing::unpackUnorm(allUnorm8.data(), unpackedUnorm8.data(), allUnorm8.size());
+  Raz::Packing::unpackSnorm(allSnorm8.data(), unpackedSnorm8.data(), allSnorm8.size());
+
+  mismatchCount = 0;
+
+  for (std::size_t i = 0; i < allUnorm16.size(); ++i) {
+    if (unpackedUnorm16[i] != Raz::Packing::unpackUnorm(allUnorm16[i]) || unpackedSnorm16[i] != Raz::Packing::unpackSnorm(allSnorm16[i]))
+      ++mismatchCount;
+  }
+
+  for (std::size_t i = 0; i < allUnorm8.size(); ++i) {
+    if (unpackedUnorm8[i] != Raz::Packing::unpackUnorm(allUnorm8[i]) || unpackedSnorm8[i] != Raz::Packing::unpackSnorm(allSnorm8[i]))
+      ++mismatchCount;
+  }
+
+  CHECK(mismatchCount == 0);
+}
+
+TEST_CASE("Packing octahedral normals") {
+  for (const Raz::Vec3f& axis : { Raz::Axis::X, Raz::Axis::Y, Raz::Axis::Z, -Raz::Axis::X, -Raz::Axis::Y, -Raz::Axis::Z }) {
+    CHECK(Raz::Packing::decodeOctahedral(Raz::Packing::encodeOctahedral(axis)) == axis);
+    CHECK(Raz::Packing::unpackOctahedral(Raz::Packing::packOctahedral(axis)) == axis);
+  }
+
+  // Checking directions spread uniformly over the sphere, using a Fibonacci lattice
+  constexpr int directionCount = 100000;
+
+  double maxDecodingError = 0.0;
+  double maxPackingAngle  = 0.0;
+
+  for (int directionIndex = 0; directionIndex < directionCount; ++directionIndex) {
+    const float height = 1.f - 2.f * (static_cast<float>(directionIndex) + 0.5f) / static_cast<float>(directionCount);
+    const float radius = std::sqrt(1.f - height * height);
+    const float angle  = static_cast<float>(directionIndex) * 2.39996323f;
+    const Raz::Vec3f normal = Raz::Vec3f(radius * std::cos(angle), radius * std::sin(angle), height).normalize();
+
+    const Raz::Vec3f decodedNormal = Raz::Packing::decodeOctahedral(Raz::Packing::encodeOctahedral(normal));
+    maxDecodingError = std::max(maxDecodingError, static_cast<double>((decodedNormal - normal).computeLength()));
+
+    // The angle is computed from the cross & dot products in double precision, the arc cosine of a float dot product being too imprecise
+    const Raz::Vec3f unpackedNormal = Raz::Packing::unpackOctahedral(Raz::Packing::packOctahedral(normal));
+    const Raz::Vec3f cross = unpackedNormal.cross(normal);
+    const double sin = std::sqrt(static_cast<double>(cross.x()) * static_cast<double>(cross.x())
+                               + static_cast<double>(cross.y()) * static_cast<double>(cross.y())
+                               + static_cast<double>(cross.z()) * static_cast<double>(cross.z()));
+    maxPackingAngle = std::max(maxPackingAngle, std::atan2(sin, static_cast<double>(unpackedNormal.dot(normal))));
+  }
+
+  CHECK(maxDecodingError < 1e-6);
+  CHECK(maxPackingAngle < 5e-5);
+}
+
+TEST_CASE("Packing RGB9E5 colors") {
+  CHECK(Raz::Packing::packRgb9e5(Raz::Vec3f(0.f)) == 0);
+  CHECK(Raz::Packing::unpackRgb9e5(Raz::Packing::packRgb9e5(Raz::Vec3f(1.f, 0.5f, 0.25f))) == Raz::Vec3f(1.f, 0.5f, 0.25f));
+  CHECK(Raz::Packing::unpackRgb9e5(Raz::Packing::packRgb9e5(Raz::Vec3f(-1.f, 1e6f, std::numeric_limits<float>::quiet_NaN())))
+        == Raz::Vec3f(0.f, 65408.f, 0.f));
+  CHECK(Raz::Packing::unpackRgb9e5(Raz::Packing::packRgb9e5(Raz::Vec3f(511.9f, 0.f, 0.f))) == Raz::Vec3f(512.f, 0.f, 0.f)); // Mantissa overflow
+
+  // All representable colors must be packed back to the same values; each exponent is checked with all red mantissas & a few green & blue ones
+  std::size_t mismatchCount = 0;
+
+  for (uint32_t exponent = 0; exponent < 32; ++exponent) {
+    for (uint32_t redMantissa = 0; redMantissa < 512; ++redMantissa) {
+      const uint32_t packedColor = redMantissa | (((redMantissa * 7) % 512) << 9) | ((511 - redMantissa) << 18) | (exponent << 27);
+      const Raz::Vec3f color     = Raz::Packing::unpackRgb9e5(packedColor);
+
+      if (Raz::Packing::unpackRgb9e5(Raz::Packing::packRgb9e5(color)) != color)
+        ++mismatchCount;
+    }
+  }
+
+  CHECK(mismatchCount == 0);
+
+  // The error of each component is at most half the highest component's quantization step, which is below 2^-9 times the highest component
+  float maxRelativeError = 0.f;
+
+  for (int colorIndex = 0; colorIndex < 10000; ++colorIndex) {
+    const auto index = static_cast<float>(colorIndex);
+    const Raz::Vec3f color(std::abs(std::sin(index)) * 1000.f, std::abs(std::cos(index * 1.3f)) * 10.f, std::abs(std::sin(index * 0.7f)) * 0.1f);
+    const Raz::Vec3f unpackedColor = Raz::Packing::unpackRgb9e5(Raz::Packing::packRgb9e5(color));
+    const float maxComponent       = std::max({ color.x(), color.y(), color.z() });
+
+    for (std::size_t i = 0; i < 3; ++i)
+      maxRelativeError = std::max(maxRelativeError, std::abs(unpackedColor[i] - color[i]) / maxComponent);
+  }
+
+  CHECK(maxRelativeError <= 1.f / 512.f);
+}
+
+TEST_CASE("Packing R11G11B10 colors") {
+  CHECK(Raz::Packing::packR11G11B10(Raz::Vec3f(0.f)) == 0);
+  CHECK(Raz::Packing::unpackR11G11B10(Raz::Packing::packR11G11B10(Raz::Vec3f(1.f, 0.5f, 65000.f))) == Raz::Vec3f(1.f, 0.5f, 64512.f));
+  CHECK(Raz::Packing::packR11G11B10(Raz::Vec3f(1.0078125f, 1.0234375f, 1.015625f)) == (0x3C0u | (0x3C2u << 11) | (0x1E0u << 22))); // Ties to even
+
+  const Raz::Vec3f clampedColor = Raz::Packing::unpackR11G11B10(Raz::Packing::packR11G11B10(Raz::Vec3f(-1.f, -0.f, 1e6f)));
+  CHECK(clampedColor.x() == 0.f);
+  CHECK(clampedColor.y() == 0.f);
+  CHECK(clampedColor.z() == std::numeric_limits<float>::infinity());
+
+  const Raz::Vec3f nanColor = Raz::Packing::unpackR11G11B10(Raz::Packing::packR11G11B10(Raz::Vec3f(std::numeric_limits<float>::quiet_NaN())));
+  CHECK(std::isnan(nanColor.x()));
+  CHECK(std::isnan(nanColor.y()));
+  CHECK(std::isnan(nanColor.z()));
+
+  // All 11 & 10-bit values must be unpacked & packed back without any change; NaNs only get their quiet bit set
+  std::size_t mismatchCount = 0;
+
+  for (uint32_t bits = 0; bits < 2048; ++bits) {
+    const uint32_t redBits   = ((bits >> 6) == 31 && (bits & 0x3Fu) ? (bits | 0x20u) : bits);
+    const uint32_t greenBits = redBits;
+    const uint32_t blueBits  = (((bits >> 1) >> 5) == 31 && ((bits >> 1) & 0x1Fu) ? ((bits >> 1) | 0x10u) : (bits >> 1));
+    const uint32_t packedColor = bits | (bits << 11) | ((bits >> 1) << 22);
+
+    if (Raz::Packing::packR11G11B10(Raz::Packing::unpackR11G11B10(packedColor)) != (redBits | (greenBits << 11) | (blueBits << 22)))
+      ++mismatchCount;
+  }
+
+  CHECK(mismatchCount == 0);
+}
@@ -1,6 +1,9 @@
 #include "Catch.hpp"
 
 #include "RaZ/Math/PerlinNoise.hpp"
+#include "RaZ/Utils/Image.hpp"
+
+#include <cmath>
 
 TEST_CASE("Perlin noise 1D") {
   CHECK(Raz::PerlinNoise::get(0.f) == 0.5f);
@@ -21,3 +24,158 @@ TEST_CASE("Perlin noise 2D") {
   CHECK(Raz::PerlinNoise::get(1.0123f, 2.0123f) == 0.50613433f);
   CHECK(Raz::PerlinNoise::get(1.0123f, 2.0123f) == 0.50613433f); // The same coordinates must always give the same value
 }
+
+TEST_CASE("Perlin noise 3D & 4D") {
+  // The noise is null on the lattice's points, hence 0.5 once scaled
+  CHECK(Raz::PerlinNoise::get(0.f, 0.f, 0.f) == 0.5f);
+  CHECK(Raz::PerlinNoise::get(3.f, -7.f, 12.f) == 0.5f);
+  CHECK(Raz::PerlinNoise::get(0.f, 0.f, 0.f, 0.f) == 0.5f);
+  CHECK(Raz::PerlinNoise::get(-5.f, 2.f, 8.f, -1.f) == 0.5f);
+
+  CHECK(Raz::PerlinNoise::get(1.0123f, 2.0123f, 3.0123f) == Raz::PerlinNoise::get(1.0123f, 2.0123f, 3.0123f));
+  CHECK(Raz::PerlinNoise::get(1.0123f, 2.0123f, 3.0123f, 4.0123f) == Raz::PerlinNoise::get(1.0123f, 2.0123f, 3.0123f, 4.0123f));
+
+  CHECK_FALSE(Raz::PerlinNoise::get(0.5f, 0.25f, 0.75f) == 0.5f);
+  CHECK_FALSE(Raz::PerlinNoise::get(0.5f, 0.25f, 0.75f, 0.125f) == 0.5f);
+}
+
+TEST_CASE("Perlin noise continuity") {
+  // Negative coordinates & coordinates beyond the permutation table's size must give continuous & repeating values
+  CHECK_THAT(Raz::PerlinNoise::get(-0.0001f), IsNearlyEqualTo(Raz::PerlinNoise::get(0.f), 0.001f));
+  CHECK_THAT(Raz::PerlinNoise::get(-0.0001f, -0.0001f), IsNearlyEqualTo(Raz::PerlinNoise::get(0.f, 0.f), 0.001f));
+  CHECK_THAT(Raz::PerlinNoise::get(-0.0001f, 0.f, -0.0001f), IsNearlyEqualTo(Raz::PerlinNoise::get(0.f, 0.f, 0.f), 0.001f));
+
+  CHECK_THAT(Raz::PerlinNoise::get(-255.75f), IsNearlyEqualTo(Raz::PerlinNoise::get(0.25f)));
+  CHECK_THAT(Raz::PerlinNoise::get(256.25f, 1.5f), IsNearlyEqualTo(Raz::PerlinNoise::get(0.25f, 1.5f)));
+  CHECK_THAT(Raz::PerlinNoise::get(1.5f, -254.5f, 0.25f), IsNearlyEqualTo(Raz::PerlinNoise::get(1.5f, 1.5f, 0.25f)));
+}
+
+TEST_CASE("Noise value range") {
+  // All noise functions must give values between 0 & 1, & must not be constant
+  float minValue = 1.f;
+  float maxValue = 0.f;
+
+  const auto checkValue = [&minValue, &maxValue] (float value) {
+    CHECK(value >= 0.f);
+    CHECK(value <= 1.f);
+
+    minValue = std::min(minValue, value);
+    maxValue = std::max(maxValue, value);
+  };
+
+  for (int i = -50; i < 50; ++i) {
+    const float x = static_cast<float>(i) * 0.37f;
+    const float y = static_cast<float>(i) * -0.61f + 3.1f;
+    const float z = static_cast<float>(i) * 0.13f - 7.3f;
+    const float w = static_cast<float>(i) * 0.29f + 0.7f;
+
+    checkValue(Raz::PerlinNoise::get(x, y, z));
+    checkValue(Raz::PerlinNoise::get(x, y, z, w));
+    checkValue(Raz::PerlinNoise::getSimplex(x, y));
+    checkValue(Raz::PerlinNoise::getSimplex(x, y, z));
+    checkValue(Raz::PerlinNoise::getSimplex(x, y, z, w));
+    checkValue(Raz::PerlinNoise::computeFbm(x, y));
+    checkValue(Raz::PerlinNoise::computeFbm(x, y, z, { Raz::PerlinNoise::NoiseType::SIMPLEX }));
+    checkValue(Raz::PerlinNoise::computeRidged(x, y));
+    checkValue(Raz::PerlinNoise::computeRidged(x, y, z, { Raz::PerlinNoise::NoiseType::SIMPLEX }));
+  }
+
+  CHECK(minValue < 0.25f);
+  CHECK(maxValue > 0.75f);
+}
+
+TEST_CASE("Fractal noise seed") {
+  Raz::PerlinNoise::FractalParams params;
+  params.octaveCount = 6;
+  params.seed        = 42;
+
+  const float value = Raz::PerlinNoise::computeFbm(1.25f, 3.5f, params);
+  CHECK(Raz::PerlinNoise::computeFbm(1.25f, 3.5f, params) == value); // The same seed must always give the same value
+
+  params.seed = 43;
+  CHECK_FALSE(Raz::PerlinNoise::computeFbm(1.25f, 3.5f, params) == value);
+  CHECK_FALSE(Raz::PerlinNoise::computeFbm(1.25f, 3.5f, 0.5f, params) == Raz::PerlinNoise::computeFbm(1.25f, 3.5f, 0.75f, params));
+}
+
+TEST_CASE("Noise grid fill") {
+  // The grid values must be strictly equal to the ones computed point by point, whichever instruction set is used
+  const auto checkGrid = [] (const Raz::PerlinNoise::GridRegion& region, std::size_t rowStride, Raz::PerlinNoise::FractalType fractalType,
+                             const Raz::PerlinNoise::FractalParams& params) {
+    std::vector<float> values((region.height - 1) * rowStride + region.width, -1.f);
+    Raz::PerlinNoise::fillGrid(values.data(), rowStride, region, fractalType, params);
+
+    std::size_t mismatchCount = 0;
+
+    for (std::size_t rowIndex = 0; rowIndex < region.height; ++rowIndex) {
+      const float y = region.origin.y() + static_cast<float>(rowIndex) * region.step.y();
+
+      for (std::size_t columnIndex = 0; columnIndex < region.width; ++columnIndex) {
+        const float x = region.origin.x() + static_cast<float>(columnIndex) * region.step.x();
+        const float expectedValue = (fractalType == Raz::PerlinNoise::FractalType::FBM ? Raz::PerlinNoise::computeFbm(x, y, params)
+                                                                                         : Raz::PerlinNoise::computeRidged(x, y, params));
+
+        if (values[rowIndex * rowStride + columnIndex] != expectedValue)
+          ++mismatchCount;
+      }
+
+      // Values between the rows must be left untouched
+      for (std::size_t paddingIndex = region.width; rowIndex + 1 < region.height && paddingIndex < rowStride; ++paddingIndex) {
+        if (values[rowIndex * rowStride + paddingIndex] != -1.f)
+          ++mismatchCount;
+      }
+    }
+
+    CHECK(mismatchCount == 0);
+  };
+
+  Raz::PerlinNoise::FractalParams params;
+  params.seed = 7;
+
+  // Width not being a multiple of any SIMD lane count & negative coordinates, to check the remaining points & the floor computation
+  Raz::PerlinNoise::GridRegion region { Raz::Vec2f(-3.3f, -1.7f), Raz::Vec2f(0.173f, 0.219f), 37, 5 };
+  checkGrid(region, 37, Raz::PerlinNoise::FractalType::FBM, params);
+  checkGrid(region, 40, Raz::PerlinNoise::FractalType::RIDGED, params);
+
+  params.noiseType   = Raz::PerlinNoise::NoiseType::SIMPLEX;
+  params.octaveCount = 3;
+  params.lacunarity  = 2.3f;
+  params.persistence = 0.6f;
+  checkGrid(region, 37, Raz::PerlinNoise::FractalType::FBM, params);
+  checkGrid(region, 45, Raz::PerlinNoise::FractalType::RIDGED, params);
+
+  // Large region, processed in parallel tiles
+  region = Raz::PerlinNoise::GridRegion{ Raz::Vec2f(10.5f, -20.25f), Raz::Vec2f(0.05f, 0.03f), 203, 131 };
+  checkGrid(region, 203, Raz::PerlinNoise::FractalType::FBM, params);
+
+  params.noiseType = Raz::PerlinNoise::NoiseType::PERLIN;
+  checkGrid(region, 210, Raz::PerlinNoise::FractalType::RIDGED, params);
+}
+
+TEST_CASE("Noise image fill") {
+  const Raz::Vec2f origin(-1.5f, 2.f);
+  const Raz::Vec2f step(0.1f, 0.2f);
+
+  std::vector<float> values(13 * 7);
+  Raz::PerlinNoise::fillGrid(values.data(), 13, { origin, step, 13, 7 }, Raz::PerlinNoise::FractalType::FBM);
+
+  Raz::Image floatImage(13, 7, Raz::ImageColorspace::DEPTH);
+  Raz::PerlinNoise::fillImage(floatImage, origin, step, Raz::PerlinNoise::FractalType::FBM);
+
+  Raz::Image byteImage(13, 7, Raz::ImageColorspace::RGB);
+  Raz::PerlinNoise::fillImage(byteImage, origin, step, Raz::PerlinNoise::FractalType::FBM);
+
+  const auto* floatData = static_cast<const float*>(floatImage.getDataPtr());
+  const auto* byteData  = static_cast<const uint8_t*>(byteImage.getDataPtr());
+
+  for (std::size_t valueIndex = 0; valueIndex < values.size(); ++valueIndex) {
+    CHECK(floatData[valueIndex] == values[valueIndex]);
+
+    const auto expectedByte = static_cast<uint8_t>(std::round(values[valueIndex] * 255.f));
+    CHECK(byteData[valueIndex * 3] == expectedByte);
+    CHECK(byteData[valueIndex * 3 + 1] == expectedByte);
+    CHECK(byteData[valueIndex * 3 + 2] == expectedByte);
+  }
+
+  Raz::Image emptyImage;
+  CHECK_THROWS(Raz::PerlinNoise::fillImage(emptyImage, origin, step, Raz::PerlinNoise::FractalType::FBM));
+}
@@ -0,0 +1,273 @@
+#include "Catch.hpp"
+
+#include "RaZ/Math/Random.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+TEST_CASE("Random PCG32") {
+  // Values given by the reference implementation's demo
+  Raz::Random::Pcg32 generator(42, 54);
+  CHECK(generator() == 0xA15C02B7);
+  CHECK(generator() == 0x7B47F409);
+  CHECK(generator() == 0xBA1D3330);
+  CHECK(generator() == 0x83D2F293);
+  CHECK(generator() == 0xBFA4784B);
+  CHECK(generator() == 0xCBED606E);
+
+  // Advancing by N gives the same value as generating N values
+  Raz::Random::Pcg32 advancedGenerator(42, 54);
+  advancedGenerator.advance(1000);
+  CHECK(advancedGenerator() == 0xEFEBEAB3);
+
+  Raz::Random::Pcg32 steppedGenerator(42, 54);
+  for (int i = 0; i < 1000; ++i)
+    steppedGenerator();
+  CHECK(steppedGenerator() == 0xEFEBEAB3);
+
+  // Different streams give different sequences
+  Raz::Random::Pcg32 otherStreamGenerator(42, 55);
+  CHECK(otherStreamGenerator() != 0xA15C02B7);
+
+  std::array<int, 6> counts {};
+
+  for (int i = 0; i < 60000; ++i) {
+    const uint32_t value = generator.generateBounded(6);
+    REQUIRE(value < 6);
+    ++counts[value];
+  }
+
+  for (const int count : counts)
+    CHECK_THAT(static_cast<float>(count), IsNearlyEqualTo(10000.f, 500.f));
+
+  for (int i = 0; i < 1000; ++i) {
+    const float value = generator.generateFloat();
+    CHECK((value >= 0.f && value < 1.f));
+  }
+}
+
+TEST_CASE("Random xoshiro256**") {
+  Raz::Random::Xoshiro256 generator(std::array<uint64_t, 4>{ 1, 2, 3, 4 });
+  CHECK(generator() == 11520);
+  CHECK(generator() == 0);
+  CHECK(generator() == 1509978240);
+  CHECK(generator() == 1215971899390074240);
+  CHECK(generator() == 1216172134540287360);
+  CHECK(generator() == 607988272756665600);
+
+  // The state is initialized with SplitMix64
+  CHECK(Raz::Random::Xoshiro256(0).getState()[0] == 0xE220A8397B1DCDAF);
+  CHECK(Raz::Random::Xoshiro256(0).getState()[3] == 0xF88BB8A8724C81EC);
+
+  // Jumping applies the reference polynomial, equivalent to generating 2^128 values
+  Raz::Random::Xoshiro256 jumpedGenerator(std::array<uint64_t, 4>{ 1, 2, 3, 4 });
+  jumpedGenerator.jump();
+  CHECK(jumpedGenerator.getState() == std::array<uint64_t, 4>{ 0x8C7A153956B5F3D1, 0x701F1A713401D85E, 0x6527F66A65469085, 0x8386B786C4408050 });
+
+  jumpedGenerator.longJump();
+  CHECK(jumpedGenerator.getState() != std::array<uint64_t, 4>{ 0x8C7A153956B5F3D1, 0x701F1A713401D85E, 0x6527F66A65469085, 0x8386B786C4408050 });
+
+  float valueSum = 0.f;
+
+  for (int i = 0; i < 10000; ++i) {
+    const float value = generator.generateFloat();
+    CHECK((value >= 0.f && value < 1.f));
+    valueSum += value;
+  }
+
+  CHECK_THAT(valueSum / 10000.f, IsNearlyEqualTo(0.5f, 0.01f));
+}
+
+TEST_CASE("Random bulk generator") {
+  // Each lane must give the same values as a scalar generator jumped as many times as the lane's index, whatever the SIMD instructions used
+  std::vector<Raz::Random::Xoshiro256> laneGenerators;
+  laneGenerators.reserve(Raz::Random::BulkGenerator::LaneCount);
+
+  Raz::Random::Xoshiro256 generator(123);
+
+  for (std::size_t laneIndex = 0; laneIndex < Raz::Random::BulkGenerator::LaneCount; ++laneIndex) {
+    laneGenerators.push_back(generator);
+    generator.jump();
+  }
+
+  Raz::Random::BulkGenerator bulkGenerator(123);
+
+  // The count not being a multiple of the block size, the rest of the last block is discarded
+  constexpr std::size_t blockCount = 37;
+  std::vector<float> values(Raz::Random::BulkGenerator::BlockSize * blockCount - 5);
+  bulkGenerator.generateFloats(values.data(), values.size());
+
+  std::vector<float> expectedValues;
+  expectedValues.reserve(Raz::Random::BulkGenerator::BlockSize * (blockCount + 1));
+
+  for (std::size_t blockIndex = 0; blockIndex < blockCount + 1; ++blockIndex) {
+    for (Raz::Random::Xoshiro256& laneGenerator : laneGenerators) {
+      const uint64_t value = laneGenerator();
+      expectedValues.push_back(static_cast<float>(static_cast<uint32_t>(value) >> 8) * 0x1p-24f);
+      expectedValues.push_back(static_cast<float>(value >> 40) * 0x1p-24f);
+    }
+  }
+
+  CHECK(std::equal(values.cbegin(), values.cend(), expectedValues.cbegin()));
+
+  bulkGenerator.generateFloats(values.data(), Raz::Random::BulkGenerator::BlockSize);
+  CHECK(std::equal(values.cbegin(), values.cbegin() + Raz::Random::BulkGenerator::BlockSize, expectedValues.cend() - Raz::Random::BulkGenerator::BlockSize));
+
+  // Long jumps are applied on all lanes
+  bulkGenerator.longJump();
+  bulkGenerator.generateFloats(values.data(), Raz::Random::BulkGenerator::BlockSize);
+
+  for (std::size_t laneIndex = 0; laneIndex < Raz::Random::BulkGenerator::LaneCount; ++laneIndex) {
+    laneGenerators[laneIndex].longJump();
+    CHECK(values[laneIndex * 2 + 1] == laneGenerators[laneIndex].generateFloat());
+  }
+}
+
+TEST_CASE("Random unit vectors") {
+  Raz::Random::BulkGenerator bulkGenerator(42);
+
+  std::vector<Raz::Vec3f> vectors(10001);
+  bulkGenerator.generateUnitVectors(vectors.data(), vectors.size());
+
+  Raz::Vec3f vecSum {};
+  std::array<int, 8> octantCounts {};
+  float maxLengthError = 0.f;
+
+  for (const Raz::Vec3f& vec : vectors) {
+    maxLengthError = std::max(maxLengthError, std::abs(vec.computeLength() - 1.f));
+    vecSum += vec;
+    ++octantCounts[(vec.x() < 0.f ? 1 : 0) + (vec.y() < 0.f ? 2 : 0) + (vec.z() < 0.f ? 4 : 0)];
+  }
+
+  CHECK(maxLengthError < 1e-6f);
+  CHECK((vecSum / static_cast<float>(vectors.size())).computeLength() < 0.03f);
+
+  for (const int octantCount : octantCounts)
+    CHECK_THAT(static_cast<float>(octantCount), IsNearlyEqualTo(1250.f, 100.f));
+
+  // The same seed gives the same vectors
+  Raz::Random::BulkGenerator sameBulkGenerator(42);
+  std::vector<Raz::Vec3f> sameVectors(vectors.size());
+  sameBulkGenerator.generateUnitVectors(sameVectors.data(), sameVectors.size());
+  CHECK(std::equal(vectors.cbegin(), vectors.cend(), sameVectors.cbegin(), [] (const Raz::Vec3f& vec1, const Raz::Vec3f& vec2) {
+    return (vec1.x() == vec2.x() && vec1.y() == vec2.y() && vec1.z() == vec2.z());
+  }));
+}
+
+TEST_CASE("Random Halton sequence") {
+  CHECK(Raz::Random::computeHalton(0, 2) == 0.f);
+  CHECK(Raz::Random::computeHalton(1, 2) == 0.5f);
+  CHECK(Raz::Random::computeHalton(2, 2) == 0.25f);
+  CHECK(Raz::Random::computeHalton(3, 2) == 0.75f);
+  CHECK(Raz::Random::computeHalton(4, 2) == 0.125f);
+
+  CHECK(Raz::Random::computeHalton(1, 3) == 1.f / 3.f);
+  CHECK(Raz::Random::computeHalton(2, 3) == 2.f / 3.f);
+  CHECK(Raz::Random::computeHalton(3, 3) == 1.f / 9.f);
+  CHECK(Raz::Random::computeHalton(4, 3) == 4.f / 9.f);
+
+  CHECK(Raz::Random::computeHalton(0xFFFFFFFF, 2) < 1.f);
+  CHECK(Raz::Random::computeHalton(0xFFFFFFFE, 0xFFFFFFFF) < 1.f);
+}
+
+TEST_CASE("Random Sobol sequence") {
+  for (uint32_t index = 0; index < 1024; ++index)
+    CHECK(Raz::Random::computeSobol(index, 0) == Raz::Random::computeHalton(index, 2));
+
+  // The first 2^m points of each dimension must fall in distinct intervals of size 2^-m, even when scrambled
+  constexpr uint32_t pointCount = 1024;
+
+  for (unsigned int dimIndex = 0; dimIndex < Raz::Random::SobolDimensionCount; ++dimIndex) {
+    for (const uint32_t scramble : { 0u, 0x9E3779B9u }) {
+      std::vector<bool> isIntervalFilled(pointCount);
+
+      for (uint32_t index = 0; index < pointCount; ++index) {
+        const float value = Raz::Random::computeSobol(index, dimIndex, scramble);
+        REQUIRE((value >= 0.f && value < 1.f));
+        isIntervalFilled[static_cast<std::size_t>(value * pointCount)] = true;
+      }
+
+      CHECK(std::all_of(isIntervalFilled.cbegin(), isIntervalFilled.cend(), [] (bool isFilled) { return isFilled; }));
+    }
+  }
+
+  // The first 2^m points of the first two dimensions must fall in distinct cells of any 2^a x 2^b grid, with a + b = m
+  constexpr uint32_t bitCount = 8;
+
+  for (uint32_t columnBitCount = 0; columnBitCount <= bitCount; ++columnBitCount) {
+    const uint32_t columnCount = 1u << columnBitCount;
+    const uint32_t rowCount    = 1u << (bitCount - columnBitCount);
+    std::vector<bool> isCellFilled(columnCount * rowCount);
+
+    for (uint32_t index = 0; index < (1u << bitCount); ++index) {
+      const auto column = static_cast<uint32_t>(Raz::Random::computeSobol(index, 0) * static_cast<float>(columnCount));
+      const auto row    = static_cast<uint32_t>(Raz::Random::computeSobol(index, 1) * static_cast<float>(rowCount));
+      isCellFilled[row * columnCount + column] = true;
+    }
+
+    CHECK(std::all_of(isCellFilled.cbegin(), isCellFilled.cend(), [] (bool isFilled) { return isFilled; }));
+  }
+}
+
+TEST_CASE("Random blue noise") {
+  constexpr unsigned int tileSize = 32;
+  constexpr std::size_t texelCount = tileSize * tileSize;
+
+  std::vector<float> values(texelCount);
+  Raz::Random::generateBlueNoise(values.data(), tileSize, 7);
+
+  // All texels have a distinct rank
+  std::vector<float> sortedValues = values;
+  std::sort(sortedValues.begin(), sortedValues.end());
+
+  for (std::size_t texelIndex = 0; texelIndex < texelCount; ++texelIndex)
+    CHECK(sortedValues[texelIndex] == static_cast<float>(texelIndex) / static_cast<float>(texelCount));
+
+  // Thresholding gives evenly spaced points: with a tenth of the texels (an average spacing of about 3 texels), no two points are adjacent
+  std::vector<std::size_t> points;
+
+  for (std::size_t texelIndex = 0; texelIndex < texelCount; ++texelIndex) {
+    if (values[texelIndex] < 0.1f)
+      points.push_back(texelIndex);
+  }
+
+  int minSqDist = std::numeric_limits<int>::max();
+
+  for (std::size_t pointIndex = 0; pointIndex < points.size(); ++pointIndex) {
+    for (std::size_t otherIndex = pointIndex + 1; otherIndex < points.size(); ++otherIndex) {
+      const int distX = std::abs(static_cast<int>(points[pointIndex] % tileSize) - static_cast<int>(points[otherIndex] % tileSize));
+      const int distY = std::abs(static_cast<int>(points[pointIndex] / tileSize) - static_cast<int>(points[otherIndex] / tileSize));
+      const int wrappedDistX = std::min(distX, static_cast<int>(tileSize) - distX);
+      const int wrappedDistY = std::min(distY, static_cast<int>(tileSize) - distY);
+      minSqDist = std::min(minSqDist, wrappedDistX * wrappedDistX + wrappedDistY * wrappedDistY);
+    }
+  }
+
+  CHECK(minSqDist >= 4);
+
+  // With a quarter of the texels, a white noise would give a point's right & bottom neighbors a 25% chance of also being points
+  std::size_t adjacentPointCount = 0;
+
+  for (unsigned int y = 0; y < tileSize; ++y) {
+    for (unsigned int x = 0; x < tileSize; ++x) {
+      if (values[y * tileSize + x] >= 0.25f)
+        continue;
+
+      adjacentPointCount += (values[y * tileSize + (x + 1) % tileSize] < 0.25f);
+      adjacentPointCount += (values[((y + 1) % tileSize) * tileSize + x] < 0.25f);
+    }
+  }
+
+  CHECK(static_cast<float>(adjacentPointCount) / static_cast<float>(texelCount / 2) < 0.15f);
+
+  // The same seed gives the same texture, & another one a different texture
+  std::vector<float> sameValues(texelCount);
+  Raz::Random::generateBlueNoise(sameValues.data(), tileSize, 7);
+  CHECK(values == sameValues);
+
+  std::vector<float> otherValues(texelCount);
+  Raz::Random::generateBlueNoise(otherValues.data(), tileSize, 8);
+  CHECK(values != otherValues);
+}
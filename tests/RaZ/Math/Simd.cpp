@@ -0,0 +1,126 @@
+#include "Catch.hpp"
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Quaternion.hpp"
+#include "RaZ/Math/Simd.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+#include <random>
+
+using namespace Raz::Literals;
+
+namespace {
+
+// Generating deterministic pseudo-random values, so that the SIMD results can be compared against the scalar ones
+std::mt19937 generator(42);
+
+float getRandomValue() {
+  return std::uniform_real_distribution<float>(-10.f, 10.f)(generator);
+}
+
+Raz::Vec4f getRandomVector() {
+  return Raz::Vec4f(getRandomValue(), getRandomValue(), getRandomValue(), getRandomValue());
+}
+
+Raz::Mat4f getRandomMatrix() {
+  return Raz::Mat4f(getRandomVector(), getRandomVector(), getRandomVector(), getRandomVector());
+}
+
+Raz::Quaternionf getRandomQuaternion() {
+  return Raz::Quaternionf(getRandomValue(), getRandomValue(), getRandomValue(), getRandomValue());
+}
+
+// The checks are made on the raw values, since the math types' equality operators allow for a tolerance
+template <typename T>
+bool areStrictlyEqual(const T& lhs, const T& rhs) {
+  for (std::size_t i = 0; i < sizeof(T) / sizeof(float); ++i) {
+    if (lhs.getDataPtr()[i] != rhs.getDataPtr()[i])
+      return false;
+  }
+
+  return true;
+}
+
+bool areStrictlyEqual(const Raz::Quaternionf& lhs, const Raz::Quaternionf& rhs) {
+  return (lhs.w() == rhs.w() && lhs.x() == rhs.x() && lhs.y() == rhs.y() && lhs.z() == rhs.z());
+}
+
+// Constant evaluations must still be possible, the SIMD kernels being skipped in that case
+constexpr Raz::Mat4f constexprMat(1.f, 2.f, 3.f, 4.f,
+                                  5.f, 6.f, 7.f, 8.f,
+                                  9.f, 10.f, 11.f, 12.f,
+                                  13.f, 14.f, 15.f, 16.f);
+constexpr Raz::Vec4f constexprVec(1.f, -1.f, 2.f, -2.f);
+
+static_assert((constexprMat * Raz::Mat4f::identity()).getElement(3, 2) == 12.f);
+static_assert((constexprMat * constexprVec)[0] == -3.f);
+static_assert((constexprVec * constexprMat)[3] == -12.f);
+static_assert((Raz::Quaternionf::identity() * Raz::Quaternionf(1.f, 2.f, 3.f, 4.f)).z() == 4.f);
+
+} // namespace
+
+TEST_CASE("Simd instruction set") {
+  CHECK(Raz::Simd::isSupported(Raz::Simd::InstructionSet::SCALAR));
+  CHECK(Raz::Simd::isSupported(Raz::Simd::detectInstructionSet()));
+  CHECK(Raz::Simd::getInstructionSet() == Raz::Simd::detectInstructionSet());
+
+  // x86 & ARM instructions cannot be both available
+  CHECK_FALSE((Raz::Simd::isSupported(Raz::Simd::InstructionSet::SSE4_1) && Raz::Simd::isSupported(Raz::Simd::InstructionSet::NEON)));
+
+  Raz::Simd::setInstructionSet(Raz::Simd::InstructionSet::SCALAR);
+  CHECK(Raz::Simd::getInstructionSet() == Raz::Simd::InstructionSet::SCALAR);
+
+  Raz::Simd::setInstructionSet(Raz::Simd::detectInstructionSet());
+  CHECK(Raz::Simd::getInstructionSet() == Raz::Simd::detectInstructionSet());
+}
+
+TEST_CASE("Simd kernels against scalar") {
+  constexpr std::array<Raz::Simd::InstructionSet, 3> instructionSets = { Raz::Simd::InstructionSet::SSE4_1,
+                                                                         Raz::Simd::InstructionSet::AVX2,
+                                                                         Raz::Simd::InstructionSet::NEON };
+
+  for (std::size_t iteration = 0; iteration < 100; ++iteration) {
+    const Raz::Mat4f lhsMat = getRandomMatrix();
+    const Raz::Mat4f rhsMat = getRandomMatrix();
+    const Raz::Vec4f vec    = getRandomVector();
+    const Raz::Quaternionf lhsQuat = getRandomQuaternion();
+    const Raz::Quaternionf rhsQuat = getRandomQuaternion();
+
+    Raz::Simd::setInstructionSet(Raz::Simd::InstructionSet::SCALAR);
+
+    const Raz::Mat4f scalarMatMat        = lhsMat * rhsMat;
+    const Raz::Vec4f scalarMatVec        = lhsMat * vec;
+    const Raz::Vec4f scalarVecMat        = vec * lhsMat;
+    const Raz::Quaternionf scalarQuatQuat = lhsQuat * rhsQuat;
+
+    for (const Raz::Simd::InstructionSet instructionSet : instructionSets) {
+      if (!Raz::Simd::isSupported(instructionSet))
+        continue;
+
+      Raz::Simd::setInstructionSet(instructionSet);
+
+      CHECK(areStrictlyEqual(lhsMat * rhsMat, scalarMatMat));
+      CHECK(areStrictlyEqual(lhsMat * vec, scalarMatVec));
+      CHECK(areStrictlyEqual(vec * lhsMat, scalarVecMat));
+      CHECK(areStrictlyEqual(lhsQuat * rhsQuat, scalarQuatQuat));
+    }
+  }
+
+  Raz::Simd::setInstructionSet(Raz::Simd::detectInstructionSet());
+
+  // Checking against known values, which must be given no matter the instruction set
+  const Raz::Mat4f mat(1.f, 2.f, 3.f, 4.f,
+                       5.f, 6.f, 7.f, 8.f,
+                       9.f, 10.f, 11.f, 12.f,
+                       13.f, 14.f, 15.f, 16.f);
+  CHECK(areStrictlyEqual(mat * mat, Raz::Mat4f(90.f, 100.f, 110.f, 120.f,
+                                               202.f, 228.f, 254.f, 280.f,
+                                               314.f, 356.f, 398.f, 440.f,
+                                               426.f, 484.f, 542.f, 600.f)));
+  CHECK(areStrictlyEqual(mat * Raz::Vec4f(1.f, -1.f, 2.f, -2.f), Raz::Vec4f(-3.f, -3.f, -3.f, -3.f)));
+  CHECK(areStrictlyEqual(Raz::Vec4f(1.f, -1.f, 2.f, -2.f) * mat, Raz::Vec4f(-12.f, -12.f, -12.f, -12.f)));
+
+  const Raz::Quaternionf quat(90.0_deg, Raz::Axis::Y);
+  CHECK((quat * quat) == Raz::Quaternionf(180.0_deg, Raz::Axis::Y));
+  CHECK(areStrictlyEqual(Raz::Quaternionf(1.f, 2.f, 3.f, 4.f) * Raz::Quaternionf(5.f, 6.f, 7.f, 8.f), Raz::Quaternionf(-60.f, 12.f, 30.f, 24.f)));
+}
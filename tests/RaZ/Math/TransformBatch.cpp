@@ -0,0 +1,271 @@
+#include "Catch.hpp"
+
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Math/TransformBatch.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <random>
+
+namespace {
+
+// Generating deterministic pseudo-random values, so that the batch results can be compared against the individual ones
+std::mt19937 generator(42);
+
+float getRandomValue(float min, float max) {
+  return std::uniform_real_distribution<float>(min, max)(generator);
+}
+
+Raz::Vec3f getRandomVector(float min, float max) {
+  return Raz::Vec3f(getRandomValue(min, max), getRandomValue(min, max), getRandomValue(min, max));
+}
+
+Raz::Transform getRandomTransform() {
+  const Raz::Quaternionf rotation(getRandomValue(-1.f, 1.f), getRandomValue(-1.f, 1.f), getRandomValue(-1.f, 1.f), getRandomValue(-1.f, 1.f));
+  return Raz::Transform(getRandomVector(-100.f, 100.f), rotation.normalize(), getRandomVector(0.1f, 5.f));
+}
+
+// Using a count which is not a multiple of the SIMD widths, so that the scalar fallback is used for the last objects
+std::vector<Raz::Transform> createTransforms(std::size_t count = 103) {
+  std::vector<Raz::Transform> transforms;
+  transforms.reserve(count);
+
+  for (std::size_t i = 0; i < count; ++i)
+    transforms.emplace_back(getRandomTransform());
+
+  return transforms;
+}
+
+bool areStrictlyEqual(const Raz::Quaternionf& lhs, const Raz::Quaternionf& rhs) {
+  return (lhs.w() == rhs.w() && lhs.x() == rhs.x() && lhs.y() == rhs.y() && lhs.z() == rhs.z());
+}
+
+Raz::TransformBatch createBatch(const std::vector<Raz::Transform>& transforms) {
+  Raz::TransformBatch batch;
+  batch.resize(transforms.size());
+
+  for (std::size_t i = 0; i < transforms.size(); ++i)
+    batch.setTransform(i, transforms[i]);
+
+  return batch;
+}
+
+} // namespace
+
+TEST_CASE("TransformBatch basic") {
+  Raz::TransformBatch batch;
+  CHECK(batch.getCount() == 0);
+
+  batch.resize(3);
+  CHECK(batch.getCount() == 3);
+
+  // New transforms are identity ones
+  std::vector<Raz::Mat4f> matrices;
+  batch.computeTransformMatrices(matrices);
+  REQUIRE(matrices.size() == 3);
+  CHECK(matrices[0] == Raz::Mat4f::identity());
+  CHECK(matrices[2] == Raz::Mat4f::identity());
+
+  batch.setTransform(1, Raz::Vec3f(1.f, 2.f, 3.f), Raz::Quaternionf::identity(), Raz::Vec3f(2.f));
+  batch.computeTransformMatrices(matrices);
+  CHECK(matrices[1] == Raz::Mat4f(2.f, 0.f, 0.f, 0.f,
+                                  0.f, 2.f, 0.f, 0.f,
+                                  0.f, 0.f, 2.f, 0.f,
+                                  1.f, 2.f, 3.f, 1.f));
+}
+
+TEST_CASE("TransformBatch matrices") {
+  const std::vector<Raz::Transform> transforms = createTransforms();
+  const Raz::TransformBatch batch = createBatch(transforms);
+
+  std::vector<Raz::Mat4f> matrices;
+  batch.computeTransformMatrices(matrices);
+  REQUIRE(matrices.size() == transforms.size());
+
+  // The batch computations must give the exact same results as the individual ones
+  for (std::size_t i = 0; i < transforms.size(); ++i)
+    CHECK(matrices[i].strictlyEquals(transforms[i].computeTransformMatrix()));
+}
+
+TEST_CASE("TransformBatch boxes") {
+  const std::vector<Raz::Transform> transforms = createTransforms();
+  const Raz::TransformBatch batch = createBatch(transforms);
+
+  Raz::BoxBatch localBoxes;
+  localBoxes.resize(transforms.size());
+
+  for (std::size_t i = 0; i < transforms.size(); ++i) {
+    const Raz::Vec3f center = getRandomVector(-3.f, 3.f);
+    const Raz::Vec3f halfExtents = getRandomVector(0.1f, 2.f);
+    localBoxes.setBox(i, Raz::AABB(center - halfExtents, center + halfExtents));
+  }
+
+  Raz::BoxBatch worldBoxes;
+  batch.transformBoxes(localBoxes, worldBoxes);
+  REQUIRE(worldBoxes.getCount() == transforms.size());
+
+  for (std::size_t i = 0; i < transforms.size(); ++i) {
+    const Raz::Affine3f affine = transforms[i].computeAffineTransform();
+    const Raz::AABB localBox   = localBoxes.recoverBox(i);
+
+    // The tightest enclosing box is given by the transformed corners
+    Raz::Vec3f expectedMin(std::numeric_limits<float>::max());
+    Raz::Vec3f expectedMax(std::numeric_limits<float>::lowest());
+
+    for (std::size_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex) {
+      const Raz::Vec3f corner((cornerIndex & 1u) ? localBox.getRightTopFrontPos().x() : localBox.getLeftBottomBackPos().x(),
+                              (cornerIndex & 2u) ? localBox.getRightTopFrontPos().y() : localBox.getLeftBottomBackPos().y(),
+                              (cornerIndex & 4u) ? localBox.getRightTopFrontPos().z() : localBox.getLeftBottomBackPos().z());
+      const Raz::Vec3f transformedCorner = affine.transformPoint(corner);
+
+      for (std::size_t axis = 0; axis < 3; ++axis) {
+        expectedMin[axis] = std::min(expectedMin[axis], transformedCorner[axis]);
+        expectedMax[axis] = std::max(expectedMax[axis], transformedCorner[axis]);
+      }
+    }
+
+    const Raz::AABB worldBox = worldBoxes.recoverBox(i);
+    CHECK_THAT(worldBox.getLeftBottomBackPos(), IsNearlyEqualToVector(expectedMin, 0.0001f));
+    CHECK_THAT(worldBox.getRightTopFrontPos(), IsNearlyEqualToVector(expectedMax, 0.0001f));
+  }
+}
+
+TEST_CASE("TransformBatch spheres") {
+  const std::vector<Raz::Transform> transforms = createTransforms();
+  const Raz::TransformBatch batch = createBatch(transforms);
+
+  Raz::SphereBatch localSpheres;
+  localSpheres.resize(transforms.size());
+
+  for (std::size_t i = 0; i < transforms.size(); ++i)
+    localSpheres.setSphere(i, Raz::Sphere(getRandomVector(-3.f, 3.f), getRandomValue(0.1f, 2.f)));
+
+  Raz::SphereBatch worldSpheres;
+  batch.transformSpheres(localSpheres, worldSpheres);
+  REQUIRE(worldSpheres.getCount() == transforms.size());
+
+  for (std::size_t i = 0; i < transforms.size(); ++i) {
+    const Raz::Sphere localSphere = localSpheres.recoverSphere(i);
+    const Raz::Sphere worldSphere = worldSpheres.recoverSphere(i);
+    const Raz::Vec3f& scale       = transforms[i].getScale();
+
+    CHECK(worldSphere.getCenter().strictlyEquals(transforms[i].computeAffineTransform().transformPoint(localSphere.getCenter())));
+    CHECK_THAT(worldSphere.getRadius(), IsNearlyEqualTo(localSphere.getRadius() * std::max({ scale.x(), scale.y(), scale.z() }), 0.0001f));
+  }
+}
+
+TEST_CASE("TransformBatch parallel") {
+  // Large batches are split across threads, which must not change the results
+  const std::vector<Raz::Transform> transforms = createTransforms(20011);
+  const Raz::TransformBatch batch = createBatch(transforms);
+
+  std::vector<Raz::Mat4f> matrices;
+  batch.computeTransformMatrices(matrices);
+
+  for (std::size_t i = 0; i < transforms.size(); i += 97)
+    CHECK(matrices[i].strictlyEquals(transforms[i].computeTransformMatrix()));
+
+  CHECK(matrices.back().strictlyEquals(transforms.back().computeTransformMatrix()));
+}
+
+TEST_CASE("QuaternionBatch basic operations") {
+  constexpr std::size_t quatCount = 103;
+
+  Raz::QuaternionBatch lhsQuats;
+  Raz::QuaternionBatch rhsQuats;
+  lhsQuats.resize(quatCount);
+  rhsQuats.resize(quatCount);
+
+  CHECK(lhsQuats.recoverQuaternion(0) == Raz::Quaternionf::identity());
+
+  for (std::size_t i = 0; i < quatCount; ++i) {
+    lhsQuats.setQuaternion(i, Raz::Quaternionf(getRandomValue(-2.f, 2.f), getRandomValue(-2.f, 2.f), getRandomValue(-2.f, 2.f), getRandomValue(-2.f, 2.f)));
+    rhsQuats.setQuaternion(i, Raz::Quaternionf(getRandomValue(-2.f, 2.f), getRandomValue(-2.f, 2.f), getRandomValue(-2.f, 2.f), getRandomValue(-2.f, 2.f)));
+  }
+
+  // A null quaternion must be left untouched by the normalization
+  lhsQuats.setQuaternion(5, Raz::Quaternionf(0.f, 0.f, 0.f, 0.f));
+
+  Raz::QuaternionBatch normalized;
+  lhsQuats.normalize(normalized);
+
+  Raz::QuaternionBatch multiplied;
+  lhsQuats.multiply(rhsQuats, multiplied);
+
+  std::vector<Raz::Mat4f> matrices;
+  rhsQuats.computeRotationMatrices(matrices);
+  REQUIRE(matrices.size() == quatCount);
+
+  for (std::size_t i = 0; i < quatCount; ++i) {
+    const Raz::Quaternionf lhsQuat = lhsQuats.recoverQuaternion(i);
+    const Raz::Quaternionf rhsQuat = rhsQuats.recoverQuaternion(i);
+
+    CHECK(areStrictlyEqual(normalized.recoverQuaternion(i), lhsQuat.normalize()));
+    CHECK(areStrictlyEqual(multiplied.recoverQuaternion(i), lhsQuat * rhsQuat));
+    CHECK(matrices[i].strictlyEquals(rhsQuat.computeMatrix()));
+  }
+
+  // Operations can be performed in place
+  lhsQuats.normalize(lhsQuats);
+  CHECK(areStrictlyEqual(lhsQuats.recoverQuaternion(quatCount - 1), normalized.recoverQuaternion(quatCount - 1)));
+}
+
+TEST_CASE("QuaternionBatch interpolations") {
+  constexpr std::size_t quatCount = 1003;
+
+  Raz::QuaternionBatch currQuats;
+  Raz::QuaternionBatch otherQuats;
+  currQuats.resize(quatCount);
+  otherQuats.resize(quatCount);
+
+  std::vector<float> coeffs(quatCount);
+
+  for (std::size_t i = 0; i < quatCount; ++i) {
+    currQuats.setQuaternion(i, getRandomTransform().getRotation());
+    otherQuats.setQuaternion(i, getRandomTransform().getRotation());
+    coeffs[i] = getRandomValue(0.f, 1.f);
+  }
+
+  // Covering the extreme coefficients & nearly identical quaternions, both the same & opposite
+  coeffs[0] = 0.f;
+  coeffs[1] = 1.f;
+  otherQuats.setQuaternion(2, currQuats.recoverQuaternion(2));
+  const Raz::Quaternionf oppositeQuat = currQuats.recoverQuaternion(3);
+  otherQuats.setQuaternion(3, Raz::Quaternionf(-oppositeQuat.w(), -oppositeQuat.x(), -oppositeQuat.y(), -oppositeQuat.z()));
+
+  Raz::QuaternionBatch nlerped;
+  currQuats.nlerp(otherQuats, coeffs, nlerped);
+
+  Raz::QuaternionBatch slerped;
+  currQuats.slerp(otherQuats, coeffs, slerped);
+
+  Raz::QuaternionBatch fastSlerped;
+  currQuats.slerp(otherQuats, coeffs, fastSlerped, Raz::SlerpMode::FAST);
+
+  Raz::QuaternionBatch uniformSlerped;
+  currQuats.slerp(otherQuats, 0.3f, uniformSlerped);
+
+  Raz::QuaternionBatch uniformNlerped;
+  currQuats.nlerp(otherQuats, 0.3f, uniformNlerped);
+
+  float maxFastSlerpError = 0.f;
+
+  for (std::size_t i = 0; i < quatCount; ++i) {
+    const Raz::Quaternionf currQuat  = currQuats.recoverQuaternion(i);
+    const Raz::Quaternionf otherQuat = otherQuats.recoverQuaternion(i);
+
+    CHECK(areStrictlyEqual(nlerped.recoverQuaternion(i), currQuat.nlerp(otherQuat, coeffs[i])));
+    CHECK(areStrictlyEqual(uniformNlerped.recoverQuaternion(i), currQuat.nlerp(otherQuat, 0.3f)));
+
+    const Raz::Quaternionf exactSlerp = currQuat.slerp(otherQuat, coeffs[i]);
+    CHECK(areStrictlyEqual(slerped.recoverQuaternion(i), exactSlerp));
+    CHECK(areStrictlyEqual(uniformSlerped.recoverQuaternion(i), currQuat.slerp(otherQuat, 0.3f)));
+
+    const Raz::Quaternionf fastSlerp = fastSlerped.recoverQuaternion(i);
+    maxFastSlerpError = std::max({ maxFastSlerpError,
+                                   std::abs(fastSlerp.w() - exactSlerp.w()), std::abs(fastSlerp.x() - exactSlerp.x()),
+                                   std::abs(fastSlerp.y() - exactSlerp.y()), std::abs(fastSlerp.z() - exactSlerp.z()) });
+  }
+
+  // The fast slerp's error is bounded
+  CHECK(maxFastSlerpError < 0.00004f);
+}
@@ -12,6 +12,8 @@ TEST_CASE("Collider basic") {
   CHECK(collider.getShapeType() == Raz::ShapeType::SPHERE);
   CHECK(collider.getShape().computeCentroid() == center);
   CHECK(collider.getShape<Raz::Sphere>().getRadius() == 3.f);
+  CHECK(collider.computeBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(-2.f, -1.f, 0.f));
+  CHECK(collider.computeBoundingBox().getRightTopFrontPos() == Raz::Vec3f(4.f, 5.f, 6.f));
 
   collider.setShape(Raz::Line(Raz::Vec3f(0.f), Raz::Vec3f(1.f)));
   CHECK(collider.getShapeType() == Raz::ShapeType::LINE);
@@ -20,4 +22,59 @@ TEST_CASE("Collider basic") {
   collider.setShape(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
   CHECK(collider.getShapeType() == Raz::ShapeType::AABB);
   CHECK(collider.getShape<Raz::AABB>().computeCentroid() == Raz::Vec3f(0.f));
+  CHECK(collider.computeBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(-1.f));
+  CHECK(collider.computeBoundingBox().getRightTopFrontPos() == Raz::Vec3f(1.f));
+}
+
+TEST_CASE("Collider shape storage") {
+  Raz::Collider collider(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+  CHECK(std::holds_alternative<Raz::Sphere>(collider.getColliderShape()));
+  CHECK(collider.getShape().getType() == Raz::ShapeType::SPHERE);
+
+  // The fetched shape must be the one stored in the collider
+  CHECK(&collider.getShape<Raz::Sphere>() == &std::get<Raz::Sphere>(collider.getColliderShape()));
+  CHECK(&collider.getShape() == &std::get<Raz::Sphere>(collider.getColliderShape()));
+
+  collider.setShape(Raz::OBB(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f))));
+  CHECK(collider.getShapeType() == Raz::ShapeType::OBB);
+  CHECK(std::holds_alternative<Raz::OBB>(collider.getColliderShape()));
+  CHECK(collider.getShape().computeCentroid() == Raz::Vec3f(0.f));
+
+  Raz::Collider movedCollider(std::move(collider));
+  CHECK(movedCollider.getShapeType() == Raz::ShapeType::OBB);
+}
+
+TEST_CASE("Collider intersections") {
+  const Raz::Collider sphere1(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+  const Raz::Collider sphere2(Raz::Sphere(Raz::Vec3f(1.5f, 0.f, 0.f), 1.f));
+  const Raz::Collider sphere3(Raz::Sphere(Raz::Vec3f(5.f), 1.f));
+  const Raz::Collider plane(Raz::Plane(0.5f));
+  const Raz::Collider aabb(Raz::AABB(Raz::Vec3f(4.f), Raz::Vec3f(5.f)));
+  const Raz::Collider line(Raz::Line(Raz::Vec3f(-2.f, 0.f, 0.f), Raz::Vec3f(2.f, 0.f, 0.f)));
+
+  CHECK(sphere1.intersects(sphere2));
+  CHECK(sphere2.intersects(sphere1));
+  CHECK_FALSE(sphere1.intersects(sphere3));
+
+  CHECK(sphere1.intersects(plane));
+  CHECK(plane.intersects(sphere2));
+  CHECK_FALSE(plane.intersects(sphere3.getShape<Raz::Sphere>()));
+  CHECK(plane.intersects(aabb) == aabb.getShape().intersects(plane.getShape<Raz::Plane>()));
+
+  CHECK(sphere3.intersects(aabb));
+  CHECK_FALSE(sphere1.intersects(aabb));
+  CHECK(aabb.intersects(aabb));
+
+  CHECK(line.intersects(sphere1));
+  CHECK(line.intersects(sphere2));
+  CHECK_FALSE(line.intersects(aabb));
+
+  // The results must be the same as with the virtual shape API
+  CHECK(sphere1.intersects(sphere2) == sphere1.intersects(sphere2.getShape()));
+  CHECK(line.intersects(aabb) == line.intersects(aabb.getShape()));
+
+  Raz::RayHit hit;
+  CHECK(sphere1.intersects(Raz::Ray(Raz::Vec3f(0.f, 0.f, -5.f), Raz::Axis::Z), &hit));
+  CHECK(hit.position == Raz::Vec3f(0.f, 0.f, -1.f));
+  CHECK(hit.distance == 4.f);
 }
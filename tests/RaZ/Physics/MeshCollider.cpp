@@ -0,0 +1,350 @@
+#include "Catch.hpp"
+
+#include "RaZ/Math/FastMath.hpp"
+#include "RaZ/Physics/MeshCollider.hpp"
+#include "RaZ/Physics/ShapeCast.hpp"
+#include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+namespace {
+
+// Creates a flat grid of quads on the X/Z plane, centered on the origin
+// Each quad is made of two triangles & has a size of 1
+std::vector<Raz::Vec3f> createGrid(unsigned int quadCount) {
+  std::vector<Raz::Vec3f> positions;
+  positions.reserve(quadCount * quadCount * 6);
+
+  const float halfSize = static_cast<float>(quadCount) * 0.5f;
+
+  for (unsigned int z = 0; z < quadCount; ++z) {
+    for (unsigned int x = 0; x < quadCount; ++x) {
+      const float minX = static_cast<float>(x) - halfSize;
+      const float minZ = static_cast<float>(z) - halfSize;
+
+      positions.emplace_back(minX, 0.f, minZ);
+      positions.emplace_back(minX, 0.f, minZ + 1.f);
+      positions.emplace_back(minX + 1.f, 0.f, minZ + 1.f);
+
+      positions.emplace_back(minX, 0.f, minZ);
+      positions.emplace_back(minX + 1.f, 0.f, minZ + 1.f);
+      positions.emplace_back(minX + 1.f, 0.f, minZ);
+    }
+  }
+
+  return positions;
+}
+
+} // namespace
+
+TEST_CASE("MeshCollider hierarchy") {
+  const Raz::MeshCollider meshCollider(createGrid(64));
+  CHECK(meshCollider.getTriangleCount() == 64 * 64 * 2);
+
+  const Raz::BoundingVolumeHierarchy& hierarchy = meshCollider.getHierarchy();
+  REQUIRE_FALSE(hierarchy.isEmpty());
+  CHECK(hierarchy.getPrimitiveCount() == meshCollider.getTriangleCount());
+  CHECK(hierarchy.getNodes().size() < hierarchy.getPrimitiveCount() * 2);
+
+  const Raz::AABB boundingBox = meshCollider.computeBoundingBox();
+  CHECK(boundingBox.getLeftBottomBackPos() == Raz::Vec3f(-32.f, 0.f, -32.f));
+  CHECK(boundingBox.getRightTopFrontPos() == Raz::Vec3f(32.f, 0.f, 32.f));
+
+  // Every node must be contained in its parent, & every triangle must be referenced by exactly one leaf
+  std::vector<unsigned int> triangleReferenceCounts(meshCollider.getTriangleCount());
+
+  for (const Raz::BvhNode& node : hierarchy.getNodes()) {
+    if (node.isLeaf()) {
+      for (uint32_t triangleIndex = node.index; triangleIndex < node.index + node.primitiveCount; ++triangleIndex) {
+        ++triangleReferenceCounts[hierarchy.getPrimitiveIndices()[triangleIndex]];
+
+        const Raz::Vec3f centroid = meshCollider.recoverTriangle(hierarchy.getPrimitiveIndices()[triangleIndex]).computeCentroid();
+        CHECK(Raz::AABB(node.minPos, node.maxPos).contains(centroid));
+      }
+
+      continue;
+    }
+
+    for (uint32_t childIndex = node.index; childIndex < node.index + 2; ++childIndex) {
+      const Raz::BvhNode& child = hierarchy.getNodes()[childIndex];
+      const Raz::AABB nodeBox(node.minPos, node.maxPos);
+
+      CHECK(nodeBox.contains(child.minPos));
+      CHECK(nodeBox.contains(child.maxPos));
+    }
+  }
+
+  CHECK(std::all_of(triangleReferenceCounts.cbegin(), triangleReferenceCounts.cend(), [] (unsigned int count) { return count == 1; }));
+}
+
+TEST_CASE("MeshCollider from vertices") {
+  // Two triangles forming a vertical quad facing +Z, plus a third one laid flat below
+  std::vector<Raz::Vertex> vertices(7);
+  vertices[0].position = Raz::Vec3f(-1.f, -1.f, 0.f);
+  vertices[1].position = Raz::Vec3f(1.f, -1.f, 0.f);
+  vertices[2].position = Raz::Vec3f(1.f, 1.f, 0.f);
+  vertices[3].position = Raz::Vec3f(-1.f, 1.f, 0.f);
+  vertices[4].position = Raz::Vec3f(-5.f, -3.f, -5.f);
+  vertices[5].position = Raz::Vec3f(0.f, -3.f, 5.f);
+  vertices[6].position = Raz::Vec3f(5.f, -3.f, -5.f);
+
+  const Raz::MeshCollider meshCollider(vertices, { 0, 1, 2, 0, 2, 3, 4, 5, 6 });
+  CHECK(meshCollider.getTriangleCount() == 3);
+
+  Raz::RayHit hit;
+
+  CHECK(meshCollider.intersects(Raz::Ray(Raz::Vec3f(0.5f, 0.5f, 5.f), -Raz::Axis::Z), &hit));
+  CHECK(hit.position == Raz::Vec3f(0.5f, 0.5f, 0.f));
+  CHECK(hit.normal == Raz::Axis::Z);
+  CHECK(hit.distance == 5.f);
+
+  // The normal is always facing the ray
+  CHECK(meshCollider.intersects(Raz::Ray(Raz::Vec3f(-0.5f, 0.5f, -5.f), Raz::Axis::Z), &hit));
+  CHECK(hit.normal == -Raz::Axis::Z);
+
+  // The vertical quad is in front of the flat triangle
+  CHECK(meshCollider.intersects(Raz::Ray(Raz::Vec3f(0.f, 0.f, 3.f), Raz::Vec3f(0.f, -1.f, -1.f).normalize()), &hit));
+  CHECK(hit.position.z() == Approx(0.f).margin(0.00001f));
+  CHECK(meshCollider.intersects(Raz::Ray(Raz::Vec3f(0.f, 0.f, 3.f), Raz::Vec3f(0.f, -1.f, -0.1f).normalize()), &hit));
+  CHECK(hit.position.y() == Approx(-3.f));
+
+  CHECK_FALSE(meshCollider.intersects(Raz::Ray(Raz::Vec3f(0.f, 0.f, 5.f), Raz::Axis::Z)));
+  CHECK_FALSE(meshCollider.intersects(Raz::Ray(Raz::Vec3f(0.f, 0.f, 5.f), -Raz::Axis::Z), nullptr, 4.f)); // Too far away
+}
+
+TEST_CASE("MeshCollider ray queries") {
+  const std::vector<Raz::Vec3f> gridPositions = createGrid(32);
+  const Raz::MeshCollider meshCollider(gridPositions);
+
+  Raz::RayHit hit;
+
+  CHECK(meshCollider.intersects(Raz::Ray(Raz::Vec3f(3.25f, 10.f, -7.5f), -Raz::Axis::Y), &hit));
+  CHECK(hit.position == Raz::Vec3f(3.25f, 0.f, -7.5f));
+  CHECK(hit.normal == Raz::Axis::Y);
+  CHECK(hit.distance == 10.f);
+
+  CHECK(meshCollider.intersects(Raz::Ray(Raz::Vec3f(-20.f, 1.f, 0.f), Raz::Vec3f(1.f, -0.1f, 0.f).normalize()), &hit));
+  CHECK(hit.position.x() == Approx(-10.f));
+
+  CHECK_FALSE(meshCollider.intersects(Raz::Ray(Raz::Vec3f(3.25f, 10.f, -7.5f), Raz::Axis::Y)));
+  CHECK_FALSE(meshCollider.intersects(Raz::Ray(Raz::Vec3f(20.f, 10.f, 0.f), -Raz::Axis::Y))); // Outside of the grid
+  CHECK_FALSE(meshCollider.intersects(Raz::Ray(Raz::Vec3f(0.f, 1.f, 0.f), Raz::Axis::X))); // Parallel to the grid
+
+  // The results must be the same as when checking every triangle independently
+  for (float coord = -20.f; coord <= 20.f; coord += 1.37f) {
+    const Raz::Ray ray(Raz::Vec3f(coord, 5.f, -coord * 0.5f), Raz::Vec3f(0.3f, -1.f, 0.2f).normalize());
+
+    Raz::RayHit bruteForceHit;
+
+    for (std::size_t posIndex = 0; posIndex < gridPositions.size(); posIndex += 3) {
+      Raz::RayHit triangleHit;
+
+      if (ray.intersects(Raz::Triangle(gridPositions[posIndex], gridPositions[posIndex + 1], gridPositions[posIndex + 2]), &triangleHit)
+          && triangleHit.distance < bruteForceHit.distance) {
+        bruteForceHit = triangleHit;
+      }
+    }
+
+    const bool isHit = meshCollider.intersects(ray, &hit);
+    CHECK(isHit == (bruteForceHit.distance != std::numeric_limits<float>::max()));
+
+    if (isHit)
+      CHECK(hit.distance == Approx(bruteForceHit.distance));
+  }
+}
+
+TEST_CASE("MeshCollider sphere cast") {
+  const std::vector<Raz::Vec3f> gridPositions = createGrid(16);
+  const Raz::MeshCollider meshCollider(gridPositions);
+
+  Raz::RayHit hit;
+
+  CHECK(meshCollider.sphereCast(Raz::Ray(Raz::Vec3f(0.25f, 5.f, 0.25f), -Raz::Axis::Y), 1.f, &hit));
+#if defined(RAZ_USE_FAST_MATH)
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(0.25f, 0.f, 0.25f), Raz::FastMath::comparisonTolerance));
+  CHECK(hit.normal == Raz::Axis::Y);
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(4.f, Raz::FastMath::comparisonTolerance));
+#else
+  CHECK(hit.position == Raz::Vec3f(0.25f, 0.f, 0.25f));
+  CHECK(hit.normal == Raz::Axis::Y);
+  CHECK(hit.distance == 4.f);
+#endif
+
+  // Passing right beside the grid, which a ray would miss
+  CHECK_FALSE(meshCollider.intersects(Raz::Ray(Raz::Vec3f(8.5f, 5.f, 0.f), -Raz::Axis::Y)));
+  CHECK(meshCollider.sphereCast(Raz::Ray(Raz::Vec3f(8.5f, 5.f, 0.f), -Raz::Axis::Y), 1.f, &hit));
+  CHECK(hit.position.x() == 8.f);
+
+  CHECK_FALSE(meshCollider.sphereCast(Raz::Ray(Raz::Vec3f(0.f, 5.f, 0.f), -Raz::Axis::Y), 1.f, nullptr, 3.f)); // Too far away
+  CHECK_FALSE(meshCollider.sphereCast(Raz::Ray(Raz::Vec3f(0.f, 2.f, 0.f), Raz::Axis::X), 1.f)); // Parallel to the grid
+
+  // The results must be the same as when checking every triangle independently
+  for (float coord = -12.f; coord <= 12.f; coord += 0.91f) {
+    const Raz::Ray ray(Raz::Vec3f(coord, 3.f, -coord * 0.5f), Raz::Vec3f(0.3f, -1.f, 0.2f).normalize());
+
+    Raz::RayHit bruteForceHit;
+
+    for (std::size_t posIndex = 0; posIndex < gridPositions.size(); posIndex += 3) {
+      Raz::RayHit triangleHit;
+
+      if (Raz::ShapeCast::sphereCast(ray, 0.75f, Raz::Triangle(gridPositions[posIndex], gridPositions[posIndex + 1], gridPositions[posIndex + 2]), &triangleHit)
+          && triangleHit.distance < bruteForceHit.distance) {
+        bruteForceHit = triangleHit;
+      }
+    }
+
+    const bool isHit = meshCollider.sphereCast(ray, 0.75f, &hit);
+    CHECK(isHit == (bruteForceHit.distance != std::numeric_limits<float>::max()));
+
+    if (isHit)
+      CHECK(hit.distance == Approx(bruteForceHit.distance));
+  }
+}
+
+TEST_CASE("MeshCollider box cast") {
+  const std::vector<Raz::Vec3f> gridPositions = createGrid(16);
+  const Raz::MeshCollider meshCollider(gridPositions);
+
+  Raz::RayHit hit;
+
+  CHECK(meshCollider.boxCast(Raz::Ray(Raz::Vec3f(0.25f, 5.f, 0.25f), -Raz::Axis::Y), Raz::Vec3f(1.f, 0.5f, 1.f), &hit));
+  CHECK(hit.normal == Raz::Axis::Y);
+  CHECK(hit.distance == 4.5f);
+
+  // Passing right beside the grid, which a ray would miss
+  CHECK(meshCollider.boxCast(Raz::Ray(Raz::Vec3f(8.5f, 5.f, 0.f), -Raz::Axis::Y), Raz::Vec3f(1.f), &hit));
+  CHECK_FALSE(meshCollider.boxCast(Raz::Ray(Raz::Vec3f(9.5f, 5.f, 0.f), -Raz::Axis::Y), Raz::Vec3f(1.f)));
+
+  // The results must be the same as when checking every triangle independently
+  for (float coord = -12.f; coord <= 12.f; coord += 0.91f) {
+    const Raz::Ray ray(Raz::Vec3f(coord, 3.f, -coord * 0.5f), Raz::Vec3f(0.3f, -1.f, 0.2f).normalize());
+    const Raz::Vec3f halfExtents(0.5f, 0.25f, 0.75f);
+
+    Raz::RayHit bruteForceHit;
+
+    for (std::size_t posIndex = 0; posIndex < gridPositions.size(); posIndex += 3) {
+      Raz::RayHit triangleHit;
+
+      if (Raz::ShapeCast::boxCast(ray, halfExtents, Raz::Triangle(gridPositions[posIndex], gridPositions[posIndex + 1], gridPositions[posIndex + 2]), &triangleHit)
+          && triangleHit.distance < bruteForceHit.distance) {
+        bruteForceHit = triangleHit;
+      }
+    }
+
+    const bool isHit = meshCollider.boxCast(ray, halfExtents, &hit);
+    CHECK(isHit == (bruteForceHit.distance != std::numeric_limits<float>::max()));
+
+    if (isHit)
+      CHECK(hit.distance == Approx(bruteForceHit.distance));
+  }
+}
+
+TEST_CASE("MeshCollider shape queries") {
+  const Raz::MeshCollider meshCollider(createGrid(32));
+
+  CHECK(meshCollider.intersects(Raz::Sphere(Raz::Vec3f(0.f, 0.5f, 0.f), 1.f)));
+  CHECK(meshCollider.intersects(Raz::Sphere(Raz::Vec3f(16.5f, 0.f, 16.5f), 1.f))); // Touching the grid's corner
+  CHECK_FALSE(meshCollider.intersects(Raz::Sphere(Raz::Vec3f(0.f, 1.5f, 0.f), 1.f)));
+  CHECK_FALSE(meshCollider.intersects(Raz::Sphere(Raz::Vec3f(17.f, 0.f, 17.f), 1.f)));
+
+  CHECK(meshCollider.intersects(Raz::AABB(Raz::Vec3f(-0.5f), Raz::Vec3f(0.5f))));
+  CHECK(meshCollider.intersects(Raz::AABB(Raz::Vec3f(10.f, -5.f, 10.f), Raz::Vec3f(50.f, 0.f, 50.f))));
+  CHECK_FALSE(meshCollider.intersects(Raz::AABB(Raz::Vec3f(-0.5f, 0.1f, -0.5f), Raz::Vec3f(0.5f))));
+
+  // A box located slightly above the grid does not intersect it, unless rotated so that its corners reach it
+  const Raz::AABB box(Raz::Vec3f(-0.5f, 0.1f, -0.5f), Raz::Vec3f(0.5f, 1.1f, 0.5f));
+  CHECK_FALSE(meshCollider.intersects(Raz::OBB(box)));
+  CHECK(meshCollider.intersects(Raz::OBB(box, Raz::Mat3f(1.f, 0.f,          0.f,
+                                                         0.f, 0.70710678f, -0.70710678f,
+                                                         0.f, 0.70710678f,  0.70710678f))));
+}
+
+TEST_CASE("MeshCollider cache") {
+  const Raz::FilePath cachePath = "téstMeshCollider.bvh";
+  const std::vector<Raz::Vec3f> gridPositions = createGrid(16);
+
+  Raz::MeshCollider meshCollider(gridPositions);
+  meshCollider.saveCache(cachePath);
+
+  // A collider created from the same triangles can load the cache
+  Raz::MeshCollider sameMeshCollider(gridPositions);
+  CHECK(sameMeshCollider.loadCache(cachePath));
+  CHECK(sameMeshCollider.getHierarchy().getNodes().size() == meshCollider.getHierarchy().getNodes().size());
+
+  Raz::RayHit hit;
+  CHECK(sameMeshCollider.intersects(Raz::Ray(Raz::Vec3f(1.5f, 2.f, 1.5f), -Raz::Axis::Y), &hit));
+  CHECK(hit.distance == 2.f);
+
+  // A collider created from different triangles can't
+  Raz::MeshCollider otherMeshCollider(createGrid(8));
+  CHECK_FALSE(otherMeshCollider.loadCache(cachePath));
+  CHECK(otherMeshCollider.getTriangleCount() == 8 * 8 * 2);
+
+  std::remove(cachePath.toUtf8().c_str());
+}
+
+TEST_CASE("BoundingVolumeHierarchy cache validation") {
+  const Raz::MeshCollider meshCollider(createGrid(4));
+  const Raz::BoundingVolumeHierarchy& hierarchy = meshCollider.getHierarchy();
+
+  std::stringstream cacheStream;
+  hierarchy.save(cacheStream);
+  const std::string cache = cacheStream.str();
+
+  // The header holds the magic, the version, the node count & the primitive count, followed by the nodes & the primitive indices
+  constexpr std::size_t headerSize = 16;
+  const std::size_t nodeCount      = hierarchy.getNodes().size();
+  const std::size_t primIndicesPos = headerSize + nodeCount * sizeof(Raz::BvhNode);
+
+  const auto loadModifiedCache = [&cache] (std::size_t position, uint32_t value) {
+    std::string modifiedCache = cache;
+    std::memcpy(modifiedCache.data() + position, &value, sizeof(value));
+
+    std::istringstream modifiedStream(modifiedCache);
+    return Raz::BoundingVolumeHierarchy().load(modifiedStream);
+  };
+
+  {
+    std::istringstream stream(cache);
+    Raz::BoundingVolumeHierarchy loadedHierarchy;
+    REQUIRE(loadedHierarchy.load(stream));
+    CHECK(loadedHierarchy.getNodes().size() == nodeCount);
+    CHECK(loadedHierarchy.getPrimitiveIndices() == hierarchy.getPrimitiveIndices());
+  }
+
+  REQUIRE_FALSE(hierarchy.getNodes().front().isLeaf());
+
+  const auto findLeafIndex = [&hierarchy] () {
+    for (std::size_t nodeIndex = 0; nodeIndex < hierarchy.getNodes().size(); ++nodeIndex) {
+      if (hierarchy.getNodes()[nodeIndex].isLeaf())
+        return nodeIndex;
+    }
+
+    return std::size_t(0);
+  };
+  const std::size_t leafPos = headerSize + findLeafIndex() * sizeof(Raz::BvhNode);
+
+  constexpr std::size_t nodeIndexOffset = offsetof(Raz::BvhNode, index);
+  constexpr std::size_t primCountOffset = offsetof(Raz::BvhNode, primitiveCount);
+
+  CHECK_FALSE(loadModifiedCache(headerSize + nodeIndexOffset, static_cast<uint32_t>(nodeCount))); // Children out of bounds
+  CHECK_FALSE(loadModifiedCache(headerSize + nodeIndexOffset, 0)); // Root being its own child
+  CHECK_FALSE(loadModifiedCache(leafPos + primCountOffset, 1000)); // Leaf primitives out of bounds
+  CHECK_FALSE(loadModifiedCache(leafPos + nodeIndexOffset, std::numeric_limits<uint32_t>::max())); // Leaf primitives out of bounds, overflowing
+  CHECK_FALSE(loadModifiedCache(primIndicesPos, static_cast<uint32_t>(hierarchy.getPrimitiveCount()))); // Primitive index out of bounds
+  CHECK_FALSE(loadModifiedCache(12, 0)); // No primitive with nodes
+  CHECK_FALSE(loadModifiedCache(12, std::numeric_limits<uint32_t>::max())); // More primitives than the stream holds, which must not be allocated
+
+  // Without any primitive, no node can be allocated
+  std::string emptyCache = cache.substr(0, headerSize);
+  const uint32_t hugeNodeCount = std::numeric_limits<uint32_t>::max();
+  const uint32_t zeroPrimCount = 0;
+  std::memcpy(emptyCache.data() + 8, &hugeNodeCount, sizeof(hugeNodeCount));
+  std::memcpy(emptyCache.data() + 12, &zeroPrimCount, sizeof(zeroPrimCount));
+
+  std::istringstream emptyStream(emptyCache);
+  CHECK_FALSE(Raz::BoundingVolumeHierarchy().load(emptyStream));
+}
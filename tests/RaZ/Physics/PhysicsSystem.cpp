@@ -0,0 +1,295 @@
+#include "Catch.hpp"
+
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/MeshCollider.hpp"
+#include "RaZ/Physics/PhysicsSystem.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+namespace {
+
+constexpr uint32_t groundLayer   = 1u << 0u;
+constexpr uint32_t obstacleLayer = 1u << 1u;
+
+//           sphere         box
+//             .-.       _______
+//  ray ->    (   )     |       |
+//             '-'      |_______|
+//  ________________________________________ ground (y = 0)
+
+struct TestScene {
+  TestScene() : physics{ world.addSystem<Raz::PhysicsSystem>() } {
+    ground = &world.addEntityWithComponent<Raz::Transform>();
+    ground->addComponent<Raz::Collider>(Raz::Plane(0.f, Raz::Axis::Y)).setLayerMask(groundLayer);
+
+    sphere = &world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 1.f, 0.f));
+    sphere->addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 1.f)).setLayerMask(obstacleLayer);
+
+    // The box's shape is defined around the origin, its entity being moved
+    box = &world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(5.f, 1.f, 0.f));
+    box->addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f))).setLayerMask(obstacleLayer);
+
+    world.refresh();
+  }
+
+  Raz::World world {};
+  Raz::PhysicsSystem& physics;
+  Raz::Entity* ground {};
+  Raz::Entity* sphere {};
+  Raz::Entity* box {};
+};
+
+} // namespace
+
+TEST_CASE("PhysicsSystem raycast") {
+  TestScene scene;
+
+  Raz::RayHit hit;
+  Raz::Entity* hitEntity = nullptr;
+
+  CHECK(scene.physics.raycast(Raz::Ray(Raz::Vec3f(-5.f, 1.f, 0.f), Raz::Axis::X), &hit, {}, &hitEntity));
+  CHECK(hitEntity == scene.sphere);
+  CHECK(hit.position == Raz::Vec3f(-1.f, 1.f, 0.f));
+  CHECK(hit.normal == -Raz::Axis::X);
+  CHECK(hit.distance == 4.f);
+
+  // The box is hit in world space, its entity being translated
+  CHECK(scene.physics.raycast(Raz::Ray(Raz::Vec3f(5.f, 10.f, 0.f), -Raz::Axis::Y), &hit, {}, &hitEntity));
+  CHECK(hitEntity == scene.box);
+  CHECK(hit.position == Raz::Vec3f(5.f, 2.f, 0.f));
+  CHECK(hit.distance == 8.f);
+
+  // The ground, being an infinite plane, is hit anywhere
+  CHECK(scene.physics.raycast(Raz::Ray(Raz::Vec3f(-100.f, 10.f, 30.f), -Raz::Axis::Y), &hit, {}, &hitEntity));
+  CHECK(hitEntity == scene.ground);
+  CHECK(hit.position == Raz::Vec3f(-100.f, 0.f, 30.f));
+
+  CHECK_FALSE(scene.physics.raycast(Raz::Ray(Raz::Vec3f(-5.f, 1.f, 0.f), -Raz::Axis::X), &hit, {}, &hitEntity));
+  CHECK(hitEntity == nullptr);
+
+  // Only the colliders within the maximum distance & in the requested layers are considered
+  Raz::RaycastParams params;
+  params.maxDistance = 3.f;
+  CHECK_FALSE(scene.physics.raycast(Raz::Ray(Raz::Vec3f(-5.f, 1.f, 0.f), Raz::Axis::X), nullptr, params));
+
+  params.maxDistance = std::numeric_limits<float>::max();
+  params.layerMask   = groundLayer;
+  CHECK_FALSE(scene.physics.raycast(Raz::Ray(Raz::Vec3f(-5.f, 1.f, 0.f), Raz::Axis::X), nullptr, params));
+  CHECK(scene.physics.raycast(Raz::Ray(Raz::Vec3f(0.f, 10.f, 0.f), -Raz::Axis::Y), &hit, params, &hitEntity));
+  CHECK(hitEntity == scene.ground); // The sphere, although in front, is ignored
+
+  // Searching for any hit stops at the first one found, whichever it is
+  params.layerMask = obstacleLayer;
+  params.mode      = Raz::RaycastMode::ANY;
+  CHECK(scene.physics.raycast(Raz::Ray(Raz::Vec3f(-5.f, 1.f, 0.f), Raz::Axis::X), nullptr, params, &hitEntity));
+  CHECK((hitEntity == scene.sphere || hitEntity == scene.box));
+
+  // Disabled entities are ignored
+  scene.sphere->disable();
+  CHECK(scene.physics.raycast(Raz::Ray(Raz::Vec3f(-5.f, 1.f, 0.f), Raz::Axis::X), &hit, {}, &hitEntity));
+  CHECK(hitEntity == scene.box);
+  CHECK(hit.distance == 9.f);
+}
+
+TEST_CASE("PhysicsSystem broadphase update") {
+  TestScene scene;
+
+  CHECK(scene.physics.raycast(Raz::Ray(Raz::Vec3f(5.f, 10.f, 0.f), -Raz::Axis::Y), nullptr, { 100.f, Raz::RaycastMode::CLOSEST, obstacleLayer }));
+
+  // Moving a collider requires updating the broadphase for the queries to take it into account
+  scene.box->getComponent<Raz::Transform>().setPosition(Raz::Vec3f(-5.f, 1.f, 10.f));
+  scene.physics.updateBroadphase();
+
+  Raz::RayHit hit;
+  Raz::Entity* hitEntity = nullptr;
+
+  CHECK_FALSE(scene.physics.raycast(Raz::Ray(Raz::Vec3f(5.f, 10.f, 0.f), -Raz::Axis::Y), nullptr, { 100.f, Raz::RaycastMode::CLOSEST, obstacleLayer }));
+  CHECK(scene.physics.raycast(Raz::Ray(Raz::Vec3f(-5.f, 10.f, 10.f), -Raz::Axis::Y), &hit, {}, &hitEntity));
+  CHECK(hitEntity == scene.box);
+  CHECK(hit.position == Raz::Vec3f(-5.f, 2.f, 10.f));
+
+  // Newly added colliders are automatically taken into account
+  Raz::Entity& meshEntity = scene.world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 5.f, -10.f));
+  meshEntity.addComponent<Raz::MeshCollider>(std::vector<Raz::Vec3f>({ Raz::Vec3f(-1.f, 0.f, -1.f), Raz::Vec3f(0.f, 0.f, 1.f), Raz::Vec3f(1.f, 0.f, -1.f) }));
+  scene.world.refresh();
+
+  CHECK(scene.physics.raycast(Raz::Ray(Raz::Vec3f(0.f, 10.f, -10.f), -Raz::Axis::Y), &hit, {}, &hitEntity));
+  CHECK(hitEntity == &meshEntity);
+  CHECK(hit.position == Raz::Vec3f(0.f, 5.f, -10.f));
+}
+
+TEST_CASE("PhysicsSystem raycast batch") {
+  TestScene scene;
+
+  // Enough rays are cast to be processed in parallel; every other one is aimed at the sphere, the others at nothing
+  std::vector<Raz::Ray> rays;
+
+  for (std::size_t rayIndex = 0; rayIndex < 1000; ++rayIndex) {
+    const float offset = static_cast<float>(rayIndex % 100) * 0.01f - 0.5f;
+    rays.emplace_back(Raz::Vec3f(-5.f, 1.f + offset, offset), (rayIndex % 2 == 0 ? Raz::Axis::X : -Raz::Axis::X));
+  }
+
+  std::vector<Raz::RayHit> hits;
+  std::vector<Raz::Entity*> hitEntities;
+
+  CHECK(scene.physics.raycastBatch(rays, hits, {}, &hitEntities) == 500);
+  REQUIRE(hits.size() == rays.size());
+  REQUIRE(hitEntities.size() == rays.size());
+
+  for (std::size_t rayIndex = 0; rayIndex < rays.size(); ++rayIndex) {
+    if (rayIndex % 2 == 0) {
+      Raz::RayHit expectedHit;
+      scene.physics.raycast(rays[rayIndex], &expectedHit);
+
+      CHECK(hitEntities[rayIndex] == scene.sphere);
+      CHECK(hits[rayIndex].distance == expectedHit.distance);
+    } else {
+      CHECK(hitEntities[rayIndex] == nullptr);
+      CHECK(hits[rayIndex].distance == std::numeric_limits<float>::max());
+    }
+  }
+
+  // The same buffers can be reused for another batch, the previous results being overwritten
+  rays.erase(rays.begin() + 10, rays.end());
+  CHECK(scene.physics.raycastBatch(rays, hits, { std::numeric_limits<float>::max(), Raz::RaycastMode::ANY, groundLayer }, &hitEntities) == 0);
+  CHECK(hits.size() == 10);
+  CHECK(std::all_of(hitEntities.cbegin(), hitEntities.cend(), [] (const Raz::Entity* entity) { return entity == nullptr; }));
+}
+
+TEST_CASE("PhysicsSystem sphere cast") {
+  TestScene scene;
+
+  Raz::RayHit hit;
+  Raz::Entity* hitEntity = nullptr;
+
+  // A sphere cast above the sphere collider would miss it with a ray, but touches it with a large enough radius
+  CHECK_FALSE(scene.physics.raycast(Raz::Ray(Raz::Vec3f(-5.f, 2.5f, 0.f), Raz::Axis::X)));
+  CHECK(scene.physics.sphereCast(Raz::Ray(Raz::Vec3f(-5.f, 2.5f, 0.f), Raz::Axis::X), 1.f, &hit, {}, &hitEntity));
+  CHECK(hitEntity == scene.sphere);
+  CHECK_THAT((hit.position - Raz::Vec3f(0.f, 1.f, 0.f)).computeLength(), IsNearlyEqualTo(1.f));
+
+  // Falling down on the box
+  CHECK(scene.physics.sphereCast(Raz::Ray(Raz::Vec3f(5.5f, 10.f, 0.f), -Raz::Axis::Y), 0.5f, &hit, {}, &hitEntity));
+  CHECK(hitEntity == scene.box);
+  CHECK(hit.position == Raz::Vec3f(5.5f, 2.f, 0.f));
+  CHECK(hit.normal == Raz::Axis::Y);
+  CHECK(hit.distance == 7.5f);
+
+  // Falling down next to the box, onto the ground
+  CHECK(scene.physics.sphereCast(Raz::Ray(Raz::Vec3f(7.f, 10.f, 0.f), -Raz::Axis::Y), 0.5f, &hit, {}, &hitEntity));
+  CHECK(hitEntity == scene.ground);
+  CHECK(hit.distance == 9.5f);
+}
+
+TEST_CASE("PhysicsSystem box cast") {
+  TestScene scene;
+
+  Raz::RayHit hit;
+  Raz::Entity* hitEntity = nullptr;
+
+  // A box moving above the sphere collider touches it with its bottom side
+  CHECK(scene.physics.boxCast(Raz::Ray(Raz::Vec3f(-5.f, 2.5f, 0.f), Raz::Axis::X), Raz::Vec3f(0.75f), &hit, {}, &hitEntity));
+  CHECK(hitEntity == scene.sphere);
+
+  // Falling down on the box's edge, which the cast box's center passes beside
+  CHECK(scene.physics.boxCast(Raz::Ray(Raz::Vec3f(6.5f, 10.f, 0.f), -Raz::Axis::Y), Raz::Vec3f(0.75f), &hit, {}, &hitEntity));
+  CHECK(hitEntity == scene.box);
+  CHECK(hit.normal == Raz::Axis::Y);
+  CHECK(hit.distance == 7.25f);
+}
+
+TEST_CASE("PhysicsSystem continuous collision") {
+  Raz::World world;
+
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+  physics.setGravity(Raz::Vec3f(0.f));
+  physics.setFriction(1.f);
+
+  // A thin wall, standing at X = 0
+  Raz::Entity& wall = world.addEntityWithComponent<Raz::Transform>();
+  wall.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-0.05f, -1.f, -1.f), Raz::Vec3f(0.05f, 1.f, 1.f)));
+
+  // A small projectile, moving far beyond the wall in a single step
+  Raz::Entity& projectile = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(-5.f, 0.f, 0.f));
+  projectile.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 0.1f));
+  auto& projectileBody = projectile.addComponent<Raz::RigidBody>(1.f, 0.f);
+  projectileBody.setVelocity(Raz::Vec3f(100.f, 0.f, 0.f));
+
+  world.refresh();
+
+  physics.step(0.1f);
+  CHECK(projectileBody.isFastMoving());
+  CHECK_THAT(projectile.getComponent<Raz::Transform>().getPosition(), IsNearlyEqualToVector(Raz::Vec3f(-0.152f, 0.f, 0.f), 0.0001f));
+  CHECK(projectileBody.getVelocity() == Raz::Vec3f(0.f));
+
+  // A bouncing projectile keeps on moving for the rest of the step after the impact
+  projectile.getComponent<Raz::Transform>().setPosition(Raz::Vec3f(-5.f, 0.f, 0.f));
+  projectileBody.setBounciness(1.f);
+  projectileBody.setVelocity(Raz::Vec3f(100.f, 0.f, 0.f));
+
+  physics.step(0.1f);
+  CHECK_THAT(projectile.getComponent<Raz::Transform>().getPosition(), IsNearlyEqualToVector(Raz::Vec3f(-0.152f - 5.15f, 0.f, 0.f), 0.001f));
+  CHECK(projectileBody.getVelocity() == Raz::Vec3f(-100.f, 0.f, 0.f));
+
+  // A thick body is stopped by its side, although its center passes beside the wall
+  Raz::Entity& crate = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(-5.f, 1.5f, 0.f));
+  crate.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+  auto& crateBody = crate.addComponent<Raz::RigidBody>(1.f, 0.f);
+  crateBody.setVelocity(Raz::Vec3f(1.f, 0.f, 0.f));
+  projectile.disable();
+
+  world.refresh();
+
+  physics.step(0.1f);
+  CHECK_FALSE(crateBody.isFastMoving()); // Moving by 0.1, below half its smallest extent
+  CHECK(crate.getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(-4.9f, 1.5f, 0.f));
+
+  crateBody.setVelocity(Raz::Vec3f(100.f, 0.f, 0.f));
+  physics.step(0.1f);
+  CHECK(crateBody.isFastMoving());
+  CHECK_THAT(crate.getComponent<Raz::Transform>().getPosition(), IsNearlyEqualToVector(Raz::Vec3f(-1.052f, 1.5f, 0.f), 0.0001f));
+
+  // With a higher threshold, the body is no longer considered fast-moving
+  physics.setContinuousCollisionThreshold(100.f);
+  crateBody.setVelocity(Raz::Vec3f(0.f, 0.f, 10.f));
+  physics.step(0.1f);
+  CHECK_FALSE(crateBody.isFastMoving());
+}
+
+TEST_CASE("PhysicsSystem continuous collision multiple impacts") {
+  Raz::World world;
+
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+  physics.setGravity(Raz::Vec3f(0.f));
+  physics.setFriction(1.f);
+
+  //    wall            wall
+  //     | |    o ->    | |
+  //     | |            | |
+  //   X = -1   0     X = 1
+
+  Raz::Entity& leftWall = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(-1.f, 0.f, 0.f));
+  leftWall.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-0.05f, -1.f, -1.f), Raz::Vec3f(0.05f, 1.f, 1.f)));
+
+  Raz::Entity& rightWall = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(1.f, 0.f, 0.f));
+  rightWall.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-0.05f, -1.f, -1.f), Raz::Vec3f(0.05f, 1.f, 1.f)));
+
+  // The projectile travels 3 units in a single step, bouncing off the right wall, then off the left one
+  Raz::Entity& projectile = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f));
+  projectile.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 0.1f));
+  auto& projectileBody = projectile.addComponent<Raz::RigidBody>(1.f, 1.f);
+  projectileBody.setVelocity(Raz::Vec3f(30.f, 0.f, 0.f));
+
+  world.refresh();
+
+  physics.step(0.1f);
+  CHECK(projectileBody.isFastMoving());
+  CHECK(projectileBody.getVelocity() == Raz::Vec3f(30.f, 0.f, 0.f));
+
+  // Each impact only leaves the time remaining after it to be travelled: 0.85 to the right wall, 1.698 to the left one, then 0.452 back
+  const Raz::Vec3f& position = projectile.getComponent<Raz::Transform>().getPosition();
+  CHECK(position.x() > -0.85f);
+  CHECK(position.x() < 0.85f);
+  CHECK_THAT(position, IsNearlyEqualToVector(Raz::Vec3f(-0.396f, 0.f, 0.f), 0.001f));
+}
@@ -0,0 +1,283 @@
+#include "Catch.hpp"
+
+#include "RaZ/Math/FastMath.hpp"
+#include "RaZ/Physics/ShapeCast.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+TEST_CASE("Sphere cast against line") {
+  const Raz::Line line(Raz::Vec3f(-1.f, 0.f, 0.f), Raz::Vec3f(1.f, 0.f, 0.f));
+
+  Raz::RayHit hit;
+
+  // Touching the line's middle
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(0.5f, 5.f, 0.f), -Raz::Axis::Y), 1.f, line, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.5f, 0.f, 0.f));
+  CHECK(hit.normal   == Raz::Axis::Y);
+  CHECK(hit.distance == 4.f);
+
+  // Touching one of its extremities
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(5.f, 0.f, 0.f), -Raz::Axis::X), 0.5f, line, &hit));
+  CHECK(hit.position == Raz::Vec3f(1.f, 0.f, 0.f));
+  CHECK(hit.normal   == Raz::Axis::X);
+  CHECK(hit.distance == 3.5f);
+
+  CHECK_FALSE(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(0.f, 5.f, 0.f), -Raz::Axis::Y), 1.f, line, nullptr, 3.f)); // Too far away
+  CHECK_FALSE(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(2.5f, 5.f, 0.f), -Raz::Axis::Y), 1.f, line)); // Passing beside the extremity
+}
+
+TEST_CASE("Sphere cast against plane") {
+  const Raz::Plane plane(1.f, Raz::Axis::Y);
+
+  Raz::RayHit hit;
+
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(3.f, 5.f, 0.f), -Raz::Axis::Y), 1.f, plane, &hit));
+  CHECK(hit.position == Raz::Vec3f(3.f, 1.f, 0.f));
+  CHECK(hit.normal   == Raz::Axis::Y);
+  CHECK(hit.distance == 3.f);
+
+  // Already touching the plane
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(0.f, 1.5f, 0.f), Raz::Axis::X), 1.f, plane, &hit));
+  CHECK(hit.distance == 0.f);
+
+  CHECK_FALSE(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(0.f, 5.f, 0.f), Raz::Axis::X), 1.f, plane)); // Parallel to the plane
+  CHECK_FALSE(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(0.f, -5.f, 0.f), Raz::Axis::Y), 1.f, plane)); // Behind the plane
+}
+
+TEST_CASE("Sphere cast against sphere") {
+  const Raz::Sphere sphere(Raz::Vec3f(0.f), 1.f);
+
+  Raz::RayHit hit;
+
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(-5.f, 0.f, 0.f), Raz::Axis::X), 0.5f, sphere, &hit));
+  CHECK(hit.position == Raz::Vec3f(-1.f, 0.f, 0.f));
+  CHECK(hit.normal   == -Raz::Axis::X);
+  CHECK(hit.distance == 3.5f);
+
+  // Grazing the sphere, which a ray following the same path would miss
+  CHECK_FALSE(Raz::Ray(Raz::Vec3f(-5.f, 1.25f, 0.f), Raz::Axis::X).intersects(sphere));
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(-5.f, 1.25f, 0.f), Raz::Axis::X), 0.5f, sphere, &hit));
+  CHECK_THAT(hit.position.computeLength(), IsNearlyEqualTo(1.f));
+
+  CHECK_FALSE(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(-5.f, 1.75f, 0.f), Raz::Axis::X), 0.5f, sphere));
+  CHECK_FALSE(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(-5.f, 0.f, 0.f), -Raz::Axis::X), 0.5f, sphere));
+}
+
+TEST_CASE("Sphere cast against triangle") {
+  const Raz::Triangle triangle(Raz::Vec3f(-1.f, 0.f, 1.f), Raz::Vec3f(1.f, 0.f, 1.f), Raz::Vec3f(0.f, 0.f, -1.f));
+
+  Raz::RayHit hit;
+
+  // Touching the face, from both sides
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(0.f, 3.f, 0.f), -Raz::Axis::Y), 0.5f, triangle, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.f));
+  CHECK(hit.normal   == Raz::Axis::Y);
+  CHECK(hit.distance == 2.5f);
+
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(0.f, -3.f, 0.f), Raz::Axis::Y), 0.5f, triangle, &hit));
+  CHECK(hit.normal   == -Raz::Axis::Y);
+  CHECK(hit.distance == 2.5f);
+
+  // Touching the front edge while moving down; a ray would have missed the triangle
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(0.f, 3.f, 1.25f), -Raz::Axis::Y), 0.5f, triangle, &hit));
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(0.f, 0.f, 1.f)));
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(3.f - std::sqrt(0.5f * 0.5f - 0.25f * 0.25f)));
+
+  // Touching the back point while moving sideways
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(0.f, 0.f, -5.f), Raz::Axis::Z), 0.5f, triangle, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.f, 0.f, -1.f));
+  CHECK(hit.normal   == -Raz::Axis::Z);
+  CHECK(hit.distance == 3.5f);
+
+  CHECK_FALSE(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(0.f, 3.f, 1.75f), -Raz::Axis::Y), 0.5f, triangle));
+  CHECK_FALSE(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(0.f, 3.f, 0.f), -Raz::Axis::Y), 0.5f, triangle, nullptr, 2.f)); // Too far away
+}
+
+TEST_CASE("Sphere cast against quad") {
+  const Raz::Quad quad(Raz::Vec3f(-1.f, 1.f, 0.f), Raz::Vec3f(1.f, 1.f, 0.f), Raz::Vec3f(1.f, -1.f, 0.f), Raz::Vec3f(-1.f, -1.f, 0.f));
+
+  Raz::RayHit hit;
+
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(-0.5f, -0.5f, 3.f), -Raz::Axis::Z), 1.f, quad, &hit));
+#if defined(RAZ_USE_FAST_MATH)
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(-0.5f, -0.5f, 0.f), Raz::FastMath::comparisonTolerance));
+  CHECK(hit.normal == Raz::Axis::Z);
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(2.f, Raz::FastMath::comparisonTolerance));
+#else
+  CHECK(hit.position == Raz::Vec3f(-0.5f, -0.5f, 0.f));
+  CHECK(hit.normal   == Raz::Axis::Z);
+  CHECK(hit.distance == 2.f);
+#endif
+
+  CHECK_FALSE(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(2.5f, 0.f, 3.f), -Raz::Axis::Z), 1.f, quad));
+}
+
+TEST_CASE("Sphere cast against AABB") {
+  const Raz::AABB aabb(Raz::Vec3f(-1.f), Raz::Vec3f(1.f));
+
+  Raz::RayHit hit;
+
+  // Touching a face
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(0.5f, 5.f, 0.f), -Raz::Axis::Y), 1.f, aabb, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.5f, 1.f, 0.f));
+  CHECK(hit.normal   == Raz::Axis::Y);
+  CHECK(hit.distance == 3.f);
+
+  // Touching an edge: the sphere's center reaches the box enlarged by the radius, but the contact only happens later since the edges are rounded
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(1.5f, 5.f, 0.f), -Raz::Axis::Y), 1.f, aabb, &hit));
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(1.f, 1.f, 0.f)));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(Raz::Vec3f(0.5f, std::sqrt(0.75f), 0.f)));
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(4.f - std::sqrt(0.75f)));
+
+  // Touching a corner
+  const Raz::Vec3f cornerDir = Raz::Vec3f(1.f).normalize();
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(cornerDir * 10.f, -cornerDir), 0.5f, aabb, &hit));
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(1.f)));
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(10.f - std::sqrt(3.f) - 0.5f, 0.0001f));
+
+  // Already overlapping the box
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(1.5f, 0.f, 0.f), Raz::Axis::X), 1.f, aabb, &hit));
+  CHECK(hit.distance == 0.f);
+
+  // Passing right beside the box's corner, inside the enlarged box but outside of the rounded one
+  CHECK_FALSE(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(1.9f, 5.f, 1.9f), -Raz::Axis::Y), 1.f, aabb));
+  CHECK_FALSE(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(2.5f, 5.f, 0.f), -Raz::Axis::Y), 1.f, aabb));
+}
+
+TEST_CASE("Sphere cast against OBB") {
+  // A box rotated by 45 degrees around the Y axis
+  const Raz::OBB obb(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)), Raz::Mat3f(0.70710678f, 0.f, -0.70710678f,
+                                                                             0.f,        1.f,  0.f,
+                                                                             0.70710678f, 0.f,  0.70710678f));
+
+  Raz::RayHit hit;
+
+  // Touching the vertical edge now facing +Z
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(0.f, 0.f, 5.f), -Raz::Axis::Z), 0.5f, obb, &hit));
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(0.f, 0.f, std::sqrt(2.f))));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(Raz::Axis::Z));
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(5.f - std::sqrt(2.f) - 0.5f, 0.000001f));
+
+  // The rotated box's edge reaches further than the unrotated box's face
+  CHECK_FALSE(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(1.8f, 0.f, 5.f), -Raz::Axis::Z), 0.5f, Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f))));
+  CHECK(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(1.8f, 0.f, 5.f), -Raz::Axis::Z), 0.5f, obb));
+  CHECK_FALSE(Raz::ShapeCast::sphereCast(Raz::Ray(Raz::Vec3f(2.2f, 0.f, 5.f), -Raz::Axis::Z), 0.5f, obb));
+}
+
+TEST_CASE("Box cast against line") {
+  const Raz::Line line(Raz::Vec3f(-1.f, 0.f, 0.f), Raz::Vec3f(1.f, 0.f, 0.f));
+
+  Raz::RayHit hit;
+
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(0.5f, 5.f, 0.f), -Raz::Axis::Y), Raz::Vec3f(0.5f), line, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.5f, 0.f, 0.f));
+  CHECK(hit.normal   == Raz::Axis::Y);
+  CHECK(hit.distance == 4.5f);
+
+  // The box's side reaches the line's extremity, which a ray following the same path would miss
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(1.25f, 5.f, 0.f), -Raz::Axis::Y), Raz::Vec3f(0.5f), line));
+  CHECK_FALSE(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(2.f, 5.f, 0.f), -Raz::Axis::Y), Raz::Vec3f(0.5f), line));
+}
+
+TEST_CASE("Box cast against plane") {
+  const Raz::Plane plane(1.f, Raz::Axis::Y);
+
+  Raz::RayHit hit;
+
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(3.f, 5.f, 0.f), -Raz::Axis::Y), Raz::Vec3f(1.f, 0.5f, 1.f), plane, &hit));
+  CHECK(hit.position == Raz::Vec3f(3.f, 1.f, 0.f));
+  CHECK(hit.normal   == Raz::Axis::Y);
+  CHECK(hit.distance == 3.5f);
+
+  CHECK_FALSE(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(0.f, 5.f, 0.f), Raz::Axis::X), Raz::Vec3f(1.f), plane)); // Parallel to the plane
+  CHECK_FALSE(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(0.f, -5.f, 0.f), Raz::Axis::Y), Raz::Vec3f(1.f), plane)); // Behind the plane
+}
+
+TEST_CASE("Box cast against sphere") {
+  const Raz::Sphere sphere(Raz::Vec3f(0.f), 1.f);
+
+  Raz::RayHit hit;
+
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(-5.f, 0.f, 0.f), Raz::Axis::X), Raz::Vec3f(0.5f), sphere, &hit));
+  CHECK(hit.position == Raz::Vec3f(-1.f, 0.f, 0.f));
+  CHECK(hit.normal   == -Raz::Axis::X);
+  CHECK(hit.distance == 3.5f);
+
+  // The box's bottom edge grazes the sphere
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(-5.f, 1.4f, 0.f), Raz::Axis::X), Raz::Vec3f(0.5f), sphere, &hit));
+  CHECK_THAT(hit.position.computeLength(), IsNearlyEqualTo(1.f));
+  CHECK_FALSE(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(-5.f, 1.6f, 0.f), Raz::Axis::X), Raz::Vec3f(0.5f), sphere));
+
+  // Already overlapping the sphere
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(1.25f, 0.f, 0.f), Raz::Axis::X), Raz::Vec3f(0.5f), sphere, &hit));
+  CHECK(hit.distance == 0.f);
+}
+
+TEST_CASE("Box cast against triangle") {
+  const Raz::Triangle triangle(Raz::Vec3f(-1.f, 0.f, 1.f), Raz::Vec3f(1.f, 0.f, 1.f), Raz::Vec3f(0.f, 0.f, -1.f));
+
+  Raz::RayHit hit;
+
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(0.f, 3.f, 0.f), -Raz::Axis::Y), Raz::Vec3f(0.5f), triangle, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.f));
+  CHECK(hit.normal   == Raz::Axis::Y);
+  CHECK(hit.distance == 2.5f);
+
+  // The box's side reaches the front edge, which a ray would have missed
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(0.f, 3.f, 1.25f), -Raz::Axis::Y), Raz::Vec3f(0.5f), triangle, &hit));
+  CHECK(hit.distance == 2.5f);
+
+  CHECK_FALSE(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(0.f, 3.f, 1.6f), -Raz::Axis::Y), Raz::Vec3f(0.5f), triangle));
+  CHECK_FALSE(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(0.f, 3.f, 0.f), -Raz::Axis::Y), Raz::Vec3f(0.5f), triangle, nullptr, 2.f)); // Too far away
+}
+
+TEST_CASE("Box cast against quad") {
+  const Raz::Quad quad(Raz::Vec3f(-1.f, 1.f, 0.f), Raz::Vec3f(1.f, 1.f, 0.f), Raz::Vec3f(1.f, -1.f, 0.f), Raz::Vec3f(-1.f, -1.f, 0.f));
+
+  Raz::RayHit hit;
+
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(1.4f, 0.f, 3.f), -Raz::Axis::Z), Raz::Vec3f(0.5f), quad, &hit));
+  CHECK(hit.normal   == Raz::Axis::Z);
+  CHECK(hit.distance == 2.5f);
+
+  CHECK_FALSE(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(1.6f, 0.f, 3.f), -Raz::Axis::Z), Raz::Vec3f(0.5f), quad));
+}
+
+TEST_CASE("Box cast against AABB") {
+  const Raz::AABB aabb(Raz::Vec3f(-1.f), Raz::Vec3f(1.f));
+
+  Raz::RayHit hit;
+
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(-5.f, 1.25f, 0.f), Raz::Axis::X), Raz::Vec3f(0.5f), aabb, &hit));
+  CHECK(hit.position == Raz::Vec3f(-1.f, 1.25f, 0.f));
+  CHECK(hit.normal   == -Raz::Axis::X);
+  CHECK(hit.distance == 3.5f);
+
+  // Unlike with a sphere, the box's corners are not rounded
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(1.9f, 5.f, 1.9f), -Raz::Axis::Y), Raz::Vec3f(1.f), aabb));
+  CHECK_FALSE(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(2.5f, 5.f, 0.f), -Raz::Axis::Y), Raz::Vec3f(1.f), aabb));
+  CHECK_FALSE(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(-5.f, 0.f, 0.f), -Raz::Axis::X), Raz::Vec3f(1.f), aabb));
+
+  // Already overlapping the box
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(1.5f, 0.f, 0.f), Raz::Axis::X), Raz::Vec3f(1.f), aabb, &hit));
+  CHECK(hit.distance == 0.f);
+}
+
+TEST_CASE("Box cast against OBB") {
+  // A box rotated by 45 degrees around the Y axis
+  const Raz::OBB obb(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)), Raz::Mat3f(0.70710678f, 0.f, -0.70710678f,
+                                                                             0.f,        1.f,  0.f,
+                                                                             0.70710678f, 0.f,  0.70710678f));
+
+  Raz::RayHit hit;
+
+  // Touching the vertical edge now facing +Z with the cast box's face
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(0.f, 0.f, 5.f), -Raz::Axis::Z), Raz::Vec3f(0.5f), obb, &hit));
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(0.f, 0.f, std::sqrt(2.f)), 0.000001f));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(Raz::Axis::Z));
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(5.f - std::sqrt(2.f) - 0.5f, 0.000001f));
+
+  // The rotated box's edge reaches further than the unrotated box's face
+  CHECK_FALSE(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(1.8f, 0.f, 5.f), -Raz::Axis::Z), Raz::Vec3f(0.5f), Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f))));
+  CHECK(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(1.8f, 0.f, 5.f), -Raz::Axis::Z), Raz::Vec3f(0.5f), obb));
+  CHECK_FALSE(Raz::ShapeCast::boxCast(Raz::Ray(Raz::Vec3f(2.2f, 0.f, 5.f), -Raz::Axis::Z), Raz::Vec3f(0.5f), obb));
+}
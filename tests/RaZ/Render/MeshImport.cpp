@@ -1,8 +1,13 @@
 #include "Catch.hpp"
 
 #include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/Renderer.hpp"
 #include "RaZ/Utils/FilePath.hpp"
 
+#include <fstream>
+#include <limits>
+#include <thread>
+
 TEST_CASE("Mesh imported OBJ quad faces") {
   const Raz::Mesh mesh(RAZ_TESTS_ROOT + "../assets/meshes/ballQuads.obj"s);
 
@@ -415,6 +420,326 @@ TEST_CASE("Mesh imported OBJ (Cook-Torrance)") {
   }
 }
 
+TEST_CASE("Mesh imported OBJ statements") {
+  {
+    std::ofstream file("tèst_stätëmënts.obj", std::ios_base::out | std::ios_base::binary);
+
+    file << "# Comment\n"
+            "v 0 0 0\n"
+            "v 1.5 0 0\n"
+            "v 1.5 1 0\r\n"
+            "v 0 1 0\n"
+            "v +2 -0.25 1e-1 # Trailing comment\n"
+            "vt 0 0\n"
+            "vt 1 0\n"
+            "vt 1 1 0\n"
+            "vt 0 1\n"
+            "vn 0 0 1\n"
+            "g First\n"          // No face has been declared yet, the first submesh is kept
+            "usemtl Unknown\n"   // No material library has been imported, this is ignored
+            "s off\n"
+            "f 1/1/1 2/2/1 3/3/1 4/4/1\r\n"
+            "o Second\n"
+            "f -5/-4/-1 -4/-3/-1 -3/-2/-1\n"
+            "f\t1/1/1  2/2/1 5/1/1 3/3/1 4/4/1 \n"
+            "o Third"; // No line break at the end of the file
+  }
+
+  const Raz::Mesh mesh("tèst_stätëmënts.obj");
+
+  REQUIRE(mesh.getSubmeshes().size() == 3);
+  CHECK(mesh.getMaterials().empty());
+
+  // Quads are split into triangles (2, 0, 3) & (1, 0, 2)
+  const Raz::Submesh& firstSubmesh = mesh.getSubmeshes()[0];
+  REQUIRE(firstSubmesh.getVertexCount() == 4);
+  CHECK(firstSubmesh.getTriangleIndices() == std::vector<unsigned int>({ 0, 1, 2, 3, 1, 0 }));
+  CHECK(firstSubmesh.getVertices()[0].position == Raz::Vec3f(1.5f, 1.f, 0.f));
+  CHECK(firstSubmesh.getVertices()[0].texcoords == Raz::Vec2f(1.f, 1.f));
+  CHECK(firstSubmesh.getVertices()[0].normal == Raz::Axis::Z);
+  CHECK(firstSubmesh.getVertices()[1].position == Raz::Vec3f(0.f));
+  CHECK(firstSubmesh.getVertices()[2].position == Raz::Vec3f(0.f, 1.f, 0.f));
+  CHECK(firstSubmesh.getVertices()[3].position == Raz::Vec3f(1.5f, 0.f, 0.f));
+
+  // Negative indices are relative to the end of the attributes' lists; polygons are split as a triangle fan
+  const Raz::Submesh& secondSubmesh = mesh.getSubmeshes()[1];
+  REQUIRE(secondSubmesh.getVertexCount() == 5);
+  CHECK(secondSubmesh.getTriangleIndices() == std::vector<unsigned int>({ 0, 1, 2,
+                                                                          2, 1, 3,
+                                                                          4, 1, 2,
+                                                                          0, 1, 4 }));
+  CHECK(secondSubmesh.getVertices()[0].position == Raz::Vec3f(1.5f, 0.f, 0.f));
+  CHECK(secondSubmesh.getVertices()[1].position == Raz::Vec3f(0.f));
+  CHECK(secondSubmesh.getVertices()[2].position == Raz::Vec3f(1.5f, 1.f, 0.f));
+  CHECK(secondSubmesh.getVertices()[3].position == Raz::Vec3f(0.f, 1.f, 0.f));
+  CHECK(secondSubmesh.getVertices()[4].position == Raz::Vec3f(2.f, -0.25f, 0.1f));
+  CHECK(secondSubmesh.getVertices()[4].texcoords == Raz::Vec2f(0.f, 0.f));
+
+  CHECK(mesh.getSubmeshes()[2].getVertexCount() == 0);
+}
+
+TEST_CASE("Mesh imported OBJ invalid indices") {
+  {
+    std::ofstream file("tèst_ïnvälïd.obj", std::ios_base::out | std::ios_base::binary);
+
+    file << "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 0 1 0\n"
+            "vt 0 0\n"
+            "vn 0 0 1\n"
+            "f 1/1/1 2/1/1 3/1/1\n"
+            "f 4294967297 2 3\n"          // Overflowing the index's range, which would wrap around to 1
+            "f 1 2 -4\n"                  // Out of bounds
+            "f 3/1/1 2/99999999999/1 1/1/2\n"; // Invalid texcoords & normal indices are ignored
+  }
+
+  const Raz::Mesh mesh("tèst_ïnvälïd.obj");
+
+  // Faces with an invalid position index are skipped
+  REQUIRE(mesh.getSubmeshes().size() == 1);
+  CHECK(mesh.recoverTriangleCount() == 2);
+
+  const Raz::Submesh& submesh = mesh.getSubmeshes().front();
+  REQUIRE(submesh.getTriangleIndexCount() == 6);
+  CHECK(submesh.getVertices()[submesh.getTriangleIndices()[3]].position == Raz::Vec3f(1.f, 0.f, 0.f));
+  CHECK(submesh.getVertices()[submesh.getTriangleIndices()[5]].normal == Raz::Vec3f(0.f));
+}
+
+TEST_CASE("Mesh imported OBJ shared textures") {
+  {
+    std::ofstream file("tèst_shäréd.mtl", std::ios_base::out | std::ios_base::binary);
+
+    file << "newmtl first\n"
+            "Ks 0.5 0.5 0.5\n"
+            "map_Kd " << RAZ_TESTS_ROOT << "assets/textures/ŔĜBŖĀ.png\n"
+            "map_Ka " << RAZ_TESTS_ROOT << "assets/textures/ŔĜBŖĀ.png\n"
+            "newmtl second\n"
+            "Ks 0.5 0.5 0.5\n"
+            "map_Kd " << RAZ_TESTS_ROOT << "assets/textures/ŔĜBŖĀ.png\n"
+            "map_Ka " << RAZ_TESTS_ROOT << "assets/textures/BƁḂɃ.png\n";
+  }
+
+  {
+    std::ofstream file("tèst_shäréd.obj", std::ios_base::out | std::ios_base::binary);
+
+    file << "mtllib tèst_shäréd.mtl\n"
+            "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 0 1 0\n"
+            "usemtl first\n"
+            "f 1 2 3\n"
+            "usemtl second\n"
+            "f 3 2 1\n";
+  }
+
+  const Raz::Mesh mesh("tèst_shäréd.obj");
+
+  REQUIRE(mesh.getMaterials().size() == 2);
+  REQUIRE(mesh.getMaterials()[0]->getType() == Raz::MaterialType::BLINN_PHONG);
+  REQUIRE(mesh.getMaterials()[1]->getType() == Raz::MaterialType::BLINN_PHONG);
+
+  const auto& firstMaterial  = static_cast<const Raz::MaterialBlinnPhong&>(*mesh.getMaterials()[0]);
+  const auto& secondMaterial = static_cast<const Raz::MaterialBlinnPhong&>(*mesh.getMaterials()[1]);
+
+  // A texture referenced by several materials for the same map is loaded only once
+  CHECK(firstMaterial.getDiffuseMap() == secondMaterial.getDiffuseMap());
+  CHECK(firstMaterial.getDiffuseMap()->getBindingIndex() == 0);
+
+  // Maps of different kinds having different binding indices, their textures are not shared
+  CHECK(firstMaterial.getAmbientMap() != firstMaterial.getDiffuseMap());
+  CHECK(firstMaterial.getAmbientMap()->getBindingIndex() == 1);
+  CHECK(firstMaterial.getAmbientMap()->getImage() == firstMaterial.getDiffuseMap()->getImage());
+  CHECK(secondMaterial.getAmbientMap() != firstMaterial.getAmbientMap());
+
+  // Images being decoded all at once after parsing the library, each texture must have been filled with its own
+  CHECK(firstMaterial.getDiffuseMap()->getImage() == Raz::Image(RAZ_TESTS_ROOT + "assets/textures/ŔĜBŖĀ.png"s, true));
+  CHECK(secondMaterial.getAmbientMap()->getImage() == Raz::Image(RAZ_TESTS_ROOT + "assets/textures/BƁḂɃ.png"s, true));
+
+  // The binding index of a map depending on the kind of its material, a texture is not shared between maps of different slots
+  {
+    std::ofstream file("tèst_shäréd.mtl", std::ios_base::out | std::ios_base::binary);
+
+    file << "newmtl first\n"
+            "Pm 0.5\n"
+            "map_Ka " << RAZ_TESTS_ROOT << "assets/textures/ŔĜBŖĀ.png\n"
+            "newmtl second\n"
+            "Ks 0.5 0.5 0.5\n"
+            "map_Ka " << RAZ_TESTS_ROOT << "assets/textures/ŔĜBŖĀ.png\n";
+  }
+
+  const Raz::Mesh mixedMesh("tèst_shäréd.obj");
+
+  REQUIRE(mixedMesh.getMaterials().size() == 2);
+  REQUIRE(mixedMesh.getMaterials()[0]->getType() == Raz::MaterialType::COOK_TORRANCE);
+  REQUIRE(mixedMesh.getMaterials()[1]->getType() == Raz::MaterialType::BLINN_PHONG);
+
+  const auto& cookTorranceMaterial = static_cast<const Raz::MaterialCookTorrance&>(*mixedMesh.getMaterials()[0]);
+  const auto& blinnPhongMaterial   = static_cast<const Raz::MaterialBlinnPhong&>(*mixedMesh.getMaterials()[1]);
+
+  CHECK(cookTorranceMaterial.getAmbientOcclusionMap() != blinnPhongMaterial.getAmbientMap());
+  CHECK(cookTorranceMaterial.getAmbientOcclusionMap()->getBindingIndex() == 4);
+  CHECK(blinnPhongMaterial.getAmbientMap()->getBindingIndex() == 1);
+  CHECK(cookTorranceMaterial.getAmbientOcclusionMap()->getImage() == blinnPhongMaterial.getAmbientMap()->getImage());
+
+  // A texture which cannot be read still makes the import fail
+  {
+    std::ofstream file("tèst_shäréd.mtl", std::ios_base::out | std::ios_base::binary);
+
+    file << "newmtl first\n"
+            "Ks 0.5 0.5 0.5\n"
+            "map_Kd " << RAZ_TESTS_ROOT << "assets/textures/ŔĜBŖĀ.png\n"
+            "map_Ka nonexistent.png\n";
+  }
+
+  CHECK_THROWS(Raz::Mesh("tèst_shäréd.obj"));
+  CHECK_THROWS(Raz::Mesh::importDeferred("tèst_shäréd.obj")); // Even if the materials are not created yet
+}
+
+TEST_CASE("Mesh deferred import") {
+  // The submeshes are imported without any material, these being only created afterward
+  Raz::Mesh mesh = Raz::Mesh::importDeferred(RAZ_TESTS_ROOT + "assets/meshes/çûbè_BP.obj"s);
+
+  CHECK(mesh.getSubmeshes().size() == 1);
+  CHECK(mesh.recoverVertexCount() == 24);
+  CHECK(mesh.recoverTriangleCount() == 12);
+  CHECK(mesh.getMaterials().empty());
+
+  mesh.createImportedMaterials();
+
+  REQUIRE(mesh.getMaterials().size() == 1);
+  REQUIRE(mesh.getMaterials().front()->getType() == Raz::MaterialType::BLINN_PHONG);
+
+  const auto& material = static_cast<const Raz::MaterialBlinnPhong&>(*mesh.getMaterials().front());
+  CHECK(material.getAmbient() == Raz::Vec3f(0.67f));
+  CHECK(material.getDiffuseMap()->getBindingIndex() == 0);
+  CHECK(material.getDiffuseMap()->getImage().getWidth() == 2);
+
+  // The materials are created only once
+  mesh.createImportedMaterials();
+  CHECK(mesh.getMaterials().size() == 1);
+}
+
+TEST_CASE("Mesh deferred import without graphics context") {
+  Raz::Renderer::recoverErrors(); // Flushing errors
+
+  Raz::Mesh(RAZ_TESTS_ROOT + "assets/meshes/çûbè_BP.obj"s).save("tèst_dëférréd.razmesh");
+
+  for (const char* filePath : { RAZ_TESTS_ROOT "assets/meshes/çûbè_BP.obj", "tèst_dëférréd.razmesh" }) {
+    // The thread importing the mesh has no current graphics context. Since GL calls would be silently ignored there, the mesh is also imported
+    //  on the current thread, where any created buffer would be visible
+    Raz::Mesh workerMesh;
+    std::thread([&workerMesh, filePath] () { workerMesh = Raz::Mesh::importDeferred(filePath); }).join();
+    Raz::Mesh mesh = Raz::Mesh::importDeferred(filePath);
+
+    for (Raz::Mesh* importedMesh : { &workerMesh, &mesh }) {
+      REQUIRE(importedMesh->getSubmeshes().size() == 1);
+
+      const Raz::Submesh& submesh = importedMesh->getSubmeshes().front();
+      CHECK(submesh.getVertexArray().getIndex() == std::numeric_limits<unsigned int>::max());
+      CHECK(submesh.getVertexBuffer().getIndex() == std::numeric_limits<unsigned int>::max());
+      CHECK(submesh.getIndexBuffer().getIndex() == std::numeric_limits<unsigned int>::max());
+
+      // The buffers are only created when uploading the mesh, on the thread owning the context
+      importedMesh->createImportedMaterials();
+      importedMesh->load();
+
+      CHECK(submesh.getVertexArray().getIndex() != std::numeric_limits<unsigned int>::max());
+      CHECK(submesh.getVertexBuffer().getIndex() != std::numeric_limits<unsigned int>::max());
+      CHECK(submesh.getIndexBuffer().getIndex() != std::numeric_limits<unsigned int>::max());
+    }
+
+    CHECK_FALSE(Raz::Renderer::hasErrors());
+  }
+}
+
+TEST_CASE("Mesh imported large OBJ") {
+  // Generating a file large enough to be parsed in several parts, each object being a grid of quads
+
+  constexpr unsigned int objectCount = 8;
+  constexpr unsigned int gridWidth   = 200;
+  constexpr unsigned int gridHeight  = 100;
+  constexpr unsigned int objectVertexCount = (gridWidth + 1) * (gridHeight + 1);
+
+  {
+    std::ofstream file("tèst_lärgë.obj", std::ios_base::out | std::ios_base::binary);
+
+    for (unsigned int objectIndex = 0; objectIndex < objectCount; ++objectIndex) {
+      file << "o Object" << objectIndex << '\n';
+
+      for (unsigned int heightIndex = 0; heightIndex <= gridHeight; ++heightIndex) {
+        for (unsigned int widthIndex = 0; widthIndex <= gridWidth; ++widthIndex) {
+          file << "v " << widthIndex << ' ' << heightIndex << ' ' << objectIndex << ".5\n"
+               << "vt " << widthIndex << ".25 " << heightIndex << '\n'
+               << "vn 0 0 -1\n";
+        }
+      }
+
+      const unsigned int firstIndex = objectIndex * objectVertexCount + 1;
+
+      for (unsigned int heightIndex = 0; heightIndex < gridHeight; ++heightIndex) {
+        for (unsigned int widthIndex = 0; widthIndex < gridWidth; ++widthIndex) {
+          const unsigned int bottomLeftIndex = firstIndex + heightIndex * (gridWidth + 1) + widthIndex;
+          const unsigned int topLeftIndex    = bottomLeftIndex + gridWidth + 1;
+
+          file << "f " << bottomLeftIndex << '/' << bottomLeftIndex << '/' << bottomLeftIndex
+               << ' ' << bottomLeftIndex + 1 << '/' << bottomLeftIndex + 1 << '/' << bottomLeftIndex + 1
+               << ' ' << topLeftIndex + 1 << '/' << topLeftIndex + 1 << '/' << topLeftIndex + 1
+               << ' ' << topLeftIndex << '/' << topLeftIndex << '/' << topLeftIndex << '\n';
+        }
+      }
+    }
+  }
+
+  const Raz::Mesh mesh("tèst_lärgë.obj");
+
+  REQUIRE(mesh.getSubmeshes().size() == objectCount);
+  CHECK(mesh.recoverVertexCount() == objectCount * objectVertexCount);
+  CHECK(mesh.recoverTriangleCount() == objectCount * gridWidth * gridHeight * 2);
+
+  for (unsigned int objectIndex = 0; objectIndex < objectCount; ++objectIndex) {
+    const Raz::Submesh& submesh = mesh.getSubmeshes()[objectIndex];
+    const auto depth = static_cast<float>(objectIndex) + 0.5f;
+
+    REQUIRE(submesh.getVertexCount() == objectVertexCount);
+
+    // The first & last vertices are the top-right ones of the first & last quads
+    CHECK(submesh.getVertices().front().position == Raz::Vec3f(1.f, 1.f, depth));
+    CHECK(submesh.getVertices().front().texcoords == Raz::Vec2f(1.25f, 1.f));
+    CHECK(submesh.getVertices().front().normal == -Raz::Axis::Z);
+    CHECK(submesh.getVertices().back().position == Raz::Vec3f(static_cast<float>(gridWidth), static_cast<float>(gridHeight), depth));
+  }
+}
+
+TEST_CASE("Mesh imported OFF") {
+  {
+    std::ofstream file("tèst_öff.off", std::ios_base::out | std::ios_base::binary);
+
+    file << "OFF\n"
+            "6 2 0\n"
+            "0 0 0\n"
+            "1 0 0\n"
+            "1 1 0\n"
+            "0 1 0\n"
+            "1 0 0\n" // Duplicate of the 2nd vertex
+            "2 0 0\n"
+            "4 0 1 2 3\n"
+            "3 4 5 2\n";
+  }
+
+  const Raz::Mesh mesh("tèst_öff.off");
+
+  REQUIRE(mesh.getSubmeshes().size() == 1);
+
+  // Duplicate positions are merged into the first one; faces are split as a triangle fan
+  const Raz::Submesh& submesh = mesh.getSubmeshes().front();
+  REQUIRE(submesh.getVertexCount() == 5);
+  CHECK(submesh.getTriangleIndices() == std::vector<unsigned int>({ 0, 1, 2,
+                                                                    0, 2, 3,
+                                                                    1, 4, 2 }));
+  CHECK(submesh.getVertices()[1].position == Raz::Vec3f(1.f, 0.f, 0.f));
+  CHECK(submesh.getVertices()[4].position == Raz::Vec3f(2.f, 0.f, 0.f));
+}
+
 #if defined(FBX_ENABLED)
 TEST_CASE("Mesh imported FBX") {
   const Raz::Mesh mesh(RAZ_TESTS_ROOT + "../assets/meshes/shaderBall.fbx"s);
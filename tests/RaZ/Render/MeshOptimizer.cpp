@@ -0,0 +1,248 @@
+#include "Catch.hpp"
+
+#include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+namespace {
+
+using Triangle = std::array<std::array<float, 3>, 3>;
+
+// Creates a grid of quads, whose triangles are shuffled as in a poorly ordered scanned mesh
+void createShuffledGrid(std::vector<Raz::Vertex>& vertices, std::vector<unsigned int>& indices, unsigned int quadCountPerSide) {
+  const unsigned int vertexCountPerSide = quadCountPerSide + 1;
+
+  vertices.clear();
+  indices.clear();
+
+  for (unsigned int z = 0; z < vertexCountPerSide; ++z) {
+    for (unsigned int x = 0; x < vertexCountPerSide; ++x) {
+      Raz::Vertex vertex {};
+      vertex.position = Raz::Vec3f(static_cast<float>(x), 0.f, static_cast<float>(z));
+      vertex.normal   = Raz::Axis::Y;
+      vertices.emplace_back(vertex);
+    }
+  }
+
+  std::vector<std::array<unsigned int, 3>> triangles;
+
+  for (unsigned int z = 0; z < quadCountPerSide; ++z) {
+    for (unsigned int x = 0; x < quadCountPerSide; ++x) {
+      const unsigned int firstIndex = z * vertexCountPerSide + x;
+
+      triangles.push_back({ firstIndex, firstIndex + vertexCountPerSide, firstIndex + 1 });
+      triangles.push_back({ firstIndex + 1, firstIndex + vertexCountPerSide, firstIndex + vertexCountPerSide + 1 });
+    }
+  }
+
+  std::shuffle(triangles.begin(), triangles.end(), std::mt19937(42));
+
+  for (const std::array<unsigned int, 3>& triangle : triangles)
+    indices.insert(indices.end(), triangle.cbegin(), triangle.cend());
+}
+
+// Recovers the triangles' positions, each rotated to start with its lowest vertex so that the winding order is kept, in a sorted list
+std::vector<Triangle> recoverTriangles(const std::vector<Raz::Vertex>& vertices, const std::vector<unsigned int>& indices) {
+  std::vector<Triangle> triangles;
+
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    Triangle triangle {};
+
+    for (std::size_t j = 0; j < 3; ++j) {
+      const Raz::Vec3f& position = vertices[indices[i + j]].position;
+      triangle[j] = { position.x(), position.y(), position.z() };
+    }
+
+    std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+    triangles.emplace_back(triangle);
+  }
+
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+} // namespace
+
+TEST_CASE("MeshOptimizer vertex cache analysis") {
+  Raz::MeshOptimizer::VertexCacheStatistics stats = Raz::MeshOptimizer::analyzeVertexCache({}, 0);
+  CHECK(stats.transformedVertexCount == 0);
+  CHECK(stats.acmr == 0.f);
+  CHECK(stats.atvr == 0.f);
+
+  stats = Raz::MeshOptimizer::analyzeVertexCache({ 0, 1, 2 }, 3);
+  CHECK(stats.transformedVertexCount == 3);
+  CHECK(stats.triangleCount == 1);
+  CHECK(stats.acmr == 3.f);
+  CHECK(stats.atvr == 1.f);
+
+  // Triangles sharing an edge
+  stats = Raz::MeshOptimizer::analyzeVertexCache({ 0, 1, 2, 2, 1, 3 }, 4);
+  CHECK(stats.transformedVertexCount == 4);
+  CHECK(stats.acmr == 2.f);
+  CHECK(stats.atvr == 1.f);
+
+  // The first triangle is evicted from a cache which is too small to hold both
+  const std::vector<unsigned int> indices = { 0, 1, 2, 3, 4, 5, 0, 1, 2 };
+
+  stats = Raz::MeshOptimizer::analyzeVertexCache(indices, 6, 3);
+  CHECK(stats.transformedVertexCount == 9);
+  CHECK(stats.acmr == 3.f);
+  CHECK(stats.atvr == 1.5f);
+
+  stats = Raz::MeshOptimizer::analyzeVertexCache(indices, 6);
+  CHECK(stats.transformedVertexCount == 6);
+  CHECK(stats.acmr == 2.f);
+  CHECK(stats.atvr == 1.f);
+}
+
+TEST_CASE("MeshOptimizer vertex cache optimization") {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createShuffledGrid(vertices, indices, 32);
+
+  const std::vector<Triangle> originalTriangles = recoverTriangles(vertices, indices);
+  const Raz::MeshOptimizer::VertexCacheStatistics originalStats = Raz::MeshOptimizer::analyzeVertexCache(indices, vertices.size());
+  CHECK(originalStats.acmr > 2.5f);
+
+  Raz::MeshOptimizer::optimizeVertexCache(indices, vertices.size());
+
+  // The triangles are the same, with the same winding order
+  CHECK(recoverTriangles(vertices, indices) == originalTriangles);
+
+  const Raz::MeshOptimizer::VertexCacheStatistics optimizedStats = Raz::MeshOptimizer::analyzeVertexCache(indices, vertices.size());
+  CHECK(optimizedStats.acmr < 0.8f);
+  CHECK(optimizedStats.atvr < 1.4f);
+
+  // Optimizing for a tiny cache still gives a better result than the original order
+  createShuffledGrid(vertices, indices, 32);
+  CHECK(Raz::MeshOptimizer::analyzeVertexCache(indices, vertices.size(), 3).acmr > 2.9f);
+
+  Raz::MeshOptimizer::optimizeVertexCache(indices, vertices.size(), 3);
+  CHECK(recoverTriangles(vertices, indices) == originalTriangles);
+  CHECK(Raz::MeshOptimizer::analyzeVertexCache(indices, vertices.size(), 3).acmr < 2.1f);
+
+  // Vertices may not be referenced
+  indices = { 4, 5, 6 };
+  Raz::MeshOptimizer::optimizeVertexCache(indices, 8);
+  CHECK(indices == std::vector<unsigned int>({ 4, 5, 6 }));
+
+  indices.clear();
+  Raz::MeshOptimizer::optimizeVertexCache(indices, 0);
+  CHECK(indices.empty());
+}
+
+TEST_CASE("MeshOptimizer overdraw optimization") {
+  // Two quads facing +Z, the first one being behind the second
+  std::vector<Raz::Vertex> vertices(8);
+
+  for (std::size_t quadIndex = 0; quadIndex < 2; ++quadIndex) {
+    const float depth = (quadIndex == 0 ? -1.f : 1.f);
+
+    vertices[quadIndex * 4].position     = Raz::Vec3f(-1.f, -1.f, depth);
+    vertices[quadIndex * 4 + 1].position = Raz::Vec3f(1.f, -1.f, depth);
+    vertices[quadIndex * 4 + 2].position = Raz::Vec3f(1.f, 1.f, depth);
+    vertices[quadIndex * 4 + 3].position = Raz::Vec3f(-1.f, 1.f, depth);
+  }
+
+  std::vector<unsigned int> indices = { 0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7 };
+  Raz::MeshOptimizer::optimizeOverdraw(indices, vertices);
+
+  // The front quad, facing outwards the mesh, is drawn first
+  CHECK(indices == std::vector<unsigned int>({ 4, 5, 6, 4, 6, 7, 0, 1, 2, 0, 2, 3 }));
+
+  // Sorting the clusters of a mesh optimized for the vertex cache keeps its efficiency within the threshold
+  createShuffledGrid(vertices, indices, 32);
+  const std::vector<Triangle> originalTriangles = recoverTriangles(vertices, indices);
+
+  Raz::MeshOptimizer::optimizeVertexCache(indices, vertices.size());
+  const float cacheOptimizedAcmr = Raz::MeshOptimizer::analyzeVertexCache(indices, vertices.size()).acmr;
+
+  Raz::MeshOptimizer::optimizeOverdraw(indices, vertices);
+  CHECK(recoverTriangles(vertices, indices) == originalTriangles);
+  CHECK(Raz::MeshOptimizer::analyzeVertexCache(indices, vertices.size()).acmr <= cacheOptimizedAcmr * Raz::MeshOptimizer::defaultOverdrawThreshold);
+}
+
+TEST_CASE("MeshOptimizer vertex fetch optimization") {
+  std::vector<Raz::Vertex> vertices(5);
+
+  for (std::size_t vertIndex = 0; vertIndex < vertices.size(); ++vertIndex)
+    vertices[vertIndex].position = Raz::Vec3f(static_cast<float>(vertIndex));
+
+  std::vector<unsigned int> indices = { 3, 1, 4, 1, 3, 0 };
+
+  // Vertices are ordered by their first reference, the unreferenced ones being moved at the end
+  const Raz::MeshUtils::VertexRemap remap = Raz::MeshOptimizer::optimizeVertexFetch(vertices, indices);
+  CHECK(remap.uniqueVertexCount == 5);
+  CHECK(remap.indices == std::vector<unsigned int>({ 3, 1, 4, 0, 2 }));
+  CHECK(indices == std::vector<unsigned int>({ 0, 1, 2, 1, 0, 3 }));
+
+  REQUIRE(vertices.size() == 5);
+  CHECK(vertices[0].position == Raz::Vec3f(3.f));
+  CHECK(vertices[1].position == Raz::Vec3f(1.f));
+  CHECK(vertices[2].position == Raz::Vec3f(4.f));
+  CHECK(vertices[3].position == Raz::Vec3f(0.f));
+  CHECK(vertices[4].position == Raz::Vec3f(2.f));
+
+  // Vertices already in order are left untouched
+  const Raz::MeshUtils::VertexRemap identityRemap = Raz::MeshOptimizer::optimizeVertexFetch(vertices, indices);
+  CHECK(identityRemap.indices == std::vector<unsigned int>({ 0, 1, 2, 3, 4 }));
+  CHECK(indices == std::vector<unsigned int>({ 0, 1, 2, 1, 0, 3 }));
+}
+
+TEST_CASE("Mesh optimization") {
+  Raz::Mesh mesh;
+  mesh.addSubmesh();
+
+  Raz::Submesh& submesh = mesh.getSubmeshes()[0];
+  createShuffledGrid(submesh.getVertices(), submesh.getTriangleIndices(), 32);
+  submesh.getLineIndices() = { 0, 1, 1, 34 };
+
+  const std::vector<Triangle> originalTriangles = recoverTriangles(submesh.getVertices(), submesh.getTriangleIndices());
+
+  // The second submesh's triangles are already optimally ordered
+  Raz::Submesh& otherSubmesh = mesh.getSubmeshes()[1];
+  otherSubmesh.getVertices().resize(3);
+  otherSubmesh.getTriangleIndices() = { 0, 1, 2 };
+
+  const Raz::MeshOptimizer::OptimizationStatistics stats = mesh.optimize();
+
+  CHECK(stats.before.triangleCount == 32 * 32 * 2 + 1);
+  CHECK(stats.after.triangleCount == stats.before.triangleCount);
+  CHECK(stats.before.vertexCount == 33 * 33 + 3);
+  CHECK(stats.after.acmr < stats.before.acmr);
+  CHECK(stats.after.atvr < stats.before.atvr);
+
+  CHECK(recoverTriangles(submesh.getVertices(), submesh.getTriangleIndices()) == originalTriangles);
+  CHECK(otherSubmesh.getTriangleIndices() == std::vector<unsigned int>({ 0, 1, 2 }));
+
+  // The vertices are referenced in order
+  unsigned int nextIndex = 0;
+  bool areVerticesOrdered = true;
+
+  for (const unsigned int index : submesh.getTriangleIndices()) {
+    areVerticesOrdered = areVerticesOrdered && (index <= nextIndex);
+    nextIndex = std::max(nextIndex, index + 1);
+  }
+
+  CHECK(areVerticesOrdered);
+
+  // Line indices have been remapped along with the vertices
+  REQUIRE(submesh.getLineIndices().size() == 4);
+  CHECK(submesh.getVertices()[submesh.getLineIndices()[0]].position == Raz::Vec3f(0.f, 0.f, 0.f));
+  CHECK(submesh.getVertices()[submesh.getLineIndices()[1]].position == Raz::Vec3f(1.f, 0.f, 0.f));
+  CHECK(submesh.getVertices()[submesh.getLineIndices()[3]].position == Raz::Vec3f(1.f, 0.f, 1.f));
+
+  // An already optimized mesh is not degraded any further
+  const Raz::MeshOptimizer::OptimizationStatistics newStats = mesh.optimize();
+  CHECK(newStats.after.acmr <= newStats.before.acmr);
+  CHECK(newStats.before.acmr == stats.after.acmr);
+
+  // Meshes can be optimized when imported
+  const Raz::Mesh importedMesh(RAZ_TESTS_ROOT + "assets/meshes/çûbè_BP.obj"s, true);
+  CHECK(importedMesh.recoverTriangleCount() == 12);
+  CHECK(importedMesh.getMaterials().size() == 1);
+}
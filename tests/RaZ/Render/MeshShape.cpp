@@ -1,5 +1,6 @@
 #include "Catch.hpp"
 
+#include "RaZ/Math/FastMath.hpp"
 #include "RaZ/Render/Mesh.hpp"
 
 TEST_CASE("UV sphere mesh from Sphere") {
@@ -70,10 +71,10 @@ TEST_CASE("Icosphere mesh from Sphere") {
     const Raz::Vec3f expectedMaxPos = Raz::Vec3f(2.1266272f) + sphere.getCenter();
     const Raz::Vec3f expectedMinPos = Raz::Vec3f(-2.1266272f) + sphere.getCenter();
 
-    CHECK_THAT(boundingBox.getRightTopFrontPos(), IsNearlyEqualToVector(expectedMaxPos));
-    CHECK_THAT(boundingBox.getLeftBottomBackPos(), IsNearlyEqualToVector(expectedMinPos));
+    CHECK_THAT(boundingBox.getRightTopFrontPos(), IsNearlyEqualToVector(expectedMaxPos, Raz::FastMath::comparisonTolerance));
+    CHECK_THAT(boundingBox.getLeftBottomBackPos(), IsNearlyEqualToVector(expectedMinPos, Raz::FastMath::comparisonTolerance));
 
-    CHECK_THAT(boundingBox.computeHalfExtents(), IsNearlyEqualToVector(Raz::Vec3f(2.1266272f)));
+    CHECK_THAT(boundingBox.computeHalfExtents(), IsNearlyEqualToVector(Raz::Vec3f(2.1266272f), Raz::FastMath::comparisonTolerance));
   }
 
   // TODO: uncomment the following test when subdivisions are effective
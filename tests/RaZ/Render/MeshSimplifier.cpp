@@ -0,0 +1,244 @@
+#include "Catch.hpp"
+
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Render/Camera.hpp"
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/MeshSimplifier.hpp"
+#include "RaZ/Render/Renderer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Creates a flat grid of quads on the XZ plane, whose vertices from the given column are duplicated with different texcoords, forming a UV seam
+void createSeamedGrid(std::vector<Raz::Vertex>& vertices, std::vector<unsigned int>& indices, unsigned int quadCountPerSide, unsigned int seamColumn) {
+  const unsigned int vertexCountPerSide = quadCountPerSide + 1;
+
+  vertices.clear();
+  indices.clear();
+
+  // Left part, up to the seam's column included
+  for (unsigned int z = 0; z < vertexCountPerSide; ++z) {
+    for (unsigned int x = 0; x <= seamColumn; ++x) {
+      Raz::Vertex vertex {};
+      vertex.position  = Raz::Vec3f(static_cast<float>(x), 0.f, static_cast<float>(z));
+      vertex.texcoords = Raz::Vec2f(static_cast<float>(x) / static_cast<float>(seamColumn) * 0.4f, static_cast<float>(z) / static_cast<float>(quadCountPerSide));
+      vertex.normal    = Raz::Axis::Y;
+      vertices.emplace_back(vertex);
+    }
+  }
+
+  const auto leftVertexCount = static_cast<unsigned int>(vertices.size());
+
+  // Right part, from the seam's column included
+  for (unsigned int z = 0; z < vertexCountPerSide; ++z) {
+    for (unsigned int x = seamColumn; x < vertexCountPerSide; ++x) {
+      Raz::Vertex vertex {};
+      vertex.position  = Raz::Vec3f(static_cast<float>(x), 0.f, static_cast<float>(z));
+      vertex.texcoords = Raz::Vec2f(0.6f + static_cast<float>(x - seamColumn) / static_cast<float>(quadCountPerSide - seamColumn) * 0.4f,
+                                    static_cast<float>(z) / static_cast<float>(quadCountPerSide));
+      vertex.normal    = Raz::Axis::Y;
+      vertices.emplace_back(vertex);
+    }
+  }
+
+  const auto recoverIndex = [=] (unsigned int x, unsigned int z, bool isLeft) {
+    return (isLeft ? z * (seamColumn + 1) + x : leftVertexCount + z * (vertexCountPerSide - seamColumn) + (x - seamColumn));
+  };
+
+  for (unsigned int z = 0; z < quadCountPerSide; ++z) {
+    for (unsigned int x = 0; x < quadCountPerSide; ++x) {
+      const bool isLeft = (x < seamColumn);
+
+      indices.insert(indices.end(), { recoverIndex(x, z, isLeft), recoverIndex(x, z + 1, isLeft), recoverIndex(x + 1, z, isLeft) });
+      indices.insert(indices.end(), { recoverIndex(x + 1, z, isLeft), recoverIndex(x, z + 1, isLeft), recoverIndex(x + 1, z + 1, isLeft) });
+    }
+  }
+}
+
+Raz::Triangle recoverTriangle(const std::vector<Raz::Vertex>& vertices, const std::vector<unsigned int>& indices, std::size_t firstIndex) {
+  return Raz::Triangle(vertices[indices[firstIndex]].position, vertices[indices[firstIndex + 1]].position, vertices[indices[firstIndex + 2]].position);
+}
+
+// Computes the largest distance from the original vertices to the simplified surface
+float computeDeviation(const std::vector<Raz::Vertex>& vertices, const std::vector<unsigned int>& indices) {
+  float maxSquaredDist = 0.f;
+
+  for (const Raz::Vertex& vertex : vertices) {
+    float minSquaredDist = std::numeric_limits<float>::max();
+
+    for (std::size_t firstIndex = 0; firstIndex < indices.size(); firstIndex += 3) {
+      const Raz::Vec3f projection = recoverTriangle(vertices, indices, firstIndex).computeProjection(vertex.position);
+      minSquaredDist = std::min(minSquaredDist, (projection - vertex.position).computeSquaredLength());
+    }
+
+    maxSquaredDist = std::max(maxSquaredDist, minSquaredDist);
+  }
+
+  return std::sqrt(maxSquaredDist);
+}
+
+void checkLods(const Raz::Submesh& submesh, std::size_t expectedLodCount, float maxDeviationFactor) {
+  const std::vector<Raz::SubmeshLod>& lods = submesh.getLods();
+  REQUIRE(lods.size() == expectedLodCount);
+
+  const std::size_t triangleCount = submesh.getTriangleIndexCount() / 3;
+  const float diagonal = (submesh.getBoundingBox().getRightTopFrontPos() - submesh.getBoundingBox().getLeftBottomBackPos()).computeLength();
+
+  constexpr std::array<float, 3> triangleRatios = { 0.5f, 0.25f, 0.125f };
+
+  for (std::size_t lodIndex = 0; lodIndex < lods.size(); ++lodIndex) {
+    const std::vector<unsigned int>& lodIndices = lods[lodIndex].triangleIndices;
+    REQUIRE(lodIndices.size() % 3 == 0);
+
+    // Each level is less detailed than the previous one, & reaches the triangle count it targets unless the maximum error stopped the generation
+    CHECK(lodIndices.size() < submesh.getLodTriangleIndices(lodIndex).size());
+
+    if (lodIndex + 1 < lods.size())
+      CHECK(lodIndices.size() / 3 <= static_cast<std::size_t>(std::ceil(static_cast<float>(triangleCount) * triangleRatios[lodIndex])));
+
+    // The error stays within the maximum one & accumulates with the levels
+    CHECK(lods[lodIndex].error <= Raz::MeshSimplifier::defaultMaxError * diagonal);
+    CHECK(lods[lodIndex].error >= submesh.getLodError(lodIndex));
+
+    for (std::size_t firstIndex = 0; firstIndex < lodIndices.size(); firstIndex += 3) {
+      for (std::size_t i = 0; i < 3; ++i)
+        REQUIRE(lodIndices[firstIndex + i] < submesh.getVertexCount());
+
+      CHECK_FALSE(recoverTriangle(submesh.getVertices(), lodIndices, firstIndex).computeNormal().computeSquaredLength() == 0.f);
+    }
+
+    // The original surface stays close to the simplified one
+    CHECK(computeDeviation(submesh.getVertices(), lodIndices) <= lods[lodIndex].error * maxDeviationFactor);
+  }
+
+  // The least detailed level is a fraction of the original triangles
+  CHECK(lods.back().triangleIndices.size() / 3 <= triangleCount / 4);
+}
+
+} // namespace
+
+TEST_CASE("MeshSimplifier simplification") {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createSeamedGrid(vertices, indices, 20, 8);
+
+  const Raz::MeshSimplifier::SimplificationResult result = Raz::MeshSimplifier::simplify(vertices, indices, 0);
+  REQUIRE(result.indices.size() % 3 == 0);
+
+  // The grid being flat, it is simplified without any error
+  CHECK(result.error == 0.f);
+  CHECK(result.indices.size() < indices.size() / 4);
+
+  float area = 0.f;
+
+  for (std::size_t firstIndex = 0; firstIndex < result.indices.size(); firstIndex += 3) {
+    const Raz::Vec3f& firstPos = vertices[result.indices[firstIndex]].position;
+    const Raz::Vec3f normal    = (vertices[result.indices[firstIndex + 1]].position - firstPos).cross(vertices[result.indices[firstIndex + 2]].position - firstPos);
+
+    // No triangle has been flipped
+    CHECK(normal.dot(Raz::Axis::Y) > 0.f);
+    area += normal.computeLength() * 0.5f;
+
+    // Triangles stay on either side of the seam, never mixing vertices with different texcoords
+    const bool isLeft = (vertices[result.indices[firstIndex]].texcoords.x() <= 0.4f);
+    CHECK((vertices[result.indices[firstIndex + 1]].texcoords.x() <= 0.4f) == isLeft);
+    CHECK((vertices[result.indices[firstIndex + 2]].texcoords.x() <= 0.4f) == isLeft);
+  }
+
+  // The borders being locked, the grid still covers the same area
+  CHECK_THAT(area, IsNearlyEqualTo(400.f, 0.001f));
+
+  // Every corner of the grid is kept
+  for (const Raz::Vec3f& corner : { Raz::Vec3f(0.f), Raz::Vec3f(20.f, 0.f, 0.f), Raz::Vec3f(0.f, 0.f, 20.f), Raz::Vec3f(20.f, 0.f, 20.f) }) {
+    CHECK(std::any_of(result.indices.cbegin(), result.indices.cend(), [&vertices, &corner] (unsigned int index) {
+      return vertices[index].position.strictlyEquals(corner);
+    }));
+  }
+
+  // Without any allowed error, only coplanar triangles can be merged
+  const std::size_t triangleCount = indices.size() / 3;
+  indices.insert(indices.end(), { 0, 1, static_cast<unsigned int>(vertices.size()) });
+  vertices.emplace_back(Raz::Vertex{ Raz::Vec3f(0.5f, 5.f, -1.f), Raz::Vec2f(0.f), Raz::Axis::Z, Raz::Axis::X });
+
+  const Raz::MeshSimplifier::SimplificationResult exactResult = Raz::MeshSimplifier::simplify(vertices, indices, 0, { 0.f });
+  CHECK(exactResult.error == 0.f);
+  CHECK(exactResult.indices.size() / 3 < triangleCount);
+}
+
+TEST_CASE("MeshSimplifier LODs generation") {
+  {
+    Raz::Mesh mesh(RAZ_TESTS_ROOT + "../assets/meshes/ball.obj"s);
+    mesh.generateLods();
+    checkLods(mesh.getSubmeshes().front(), 3, 4.f);
+  }
+
+  {
+    Raz::Mesh mesh(RAZ_TESTS_ROOT + "../assets/meshes/bigguy.obj"s);
+    mesh.generateLods();
+    checkLods(mesh.getSubmeshes().front(), 3, 4.f);
+  }
+
+  {
+    // All the triangles of a cube are needed to keep its shape
+    Raz::Mesh mesh(RAZ_TESTS_ROOT + "../assets/meshes/cube.obj"s);
+    mesh.generateLods();
+    CHECK(mesh.getSubmeshes().front().getLods().empty());
+  }
+
+  {
+    // Submeshes not rendered as triangles have no level of detail
+    Raz::Mesh mesh(Raz::Sphere(Raz::Vec3f(0.f), 1.f), 10, Raz::SphereMeshType::UV, Raz::RenderMode::POINT);
+    mesh.generateLods();
+    CHECK(mesh.getSubmeshes().front().getLods().empty());
+  }
+}
+
+TEST_CASE("Mesh LODs selection") {
+  Raz::Renderer::recoverErrors(); // Flushing errors
+
+  Raz::Mesh mesh(RAZ_TESTS_ROOT + "../assets/meshes/bigguy.obj"s);
+  mesh.generateLods();
+
+  const Raz::Submesh& submesh = mesh.getSubmeshes().front();
+  REQUIRE(submesh.getLods().size() == 3);
+  CHECK(submesh.getLodIndex() == 0);
+  CHECK(submesh.getLodTriangleIndices(0) == submesh.getTriangleIndices());
+  CHECK(submesh.getLodError(0) == 0.f);
+
+  // Every level is sent to the graphics card along with the base triangles
+  mesh.load();
+  CHECK_FALSE(Raz::Renderer::hasErrors());
+
+  constexpr unsigned int viewportHeight = 600;
+  const Raz::Camera camera(800, viewportHeight);
+  const Raz::Mat4f& projectionMat = camera.getProjectionMatrix();
+  const float pixelsPerUnit = projectionMat.getElement(1, 1) * static_cast<float>(viewportHeight) * 0.5f;
+
+  const Raz::AABB& boundingBox = submesh.getBoundingBox();
+  const Raz::Vec3f center      = (boundingBox.getLeftBottomBackPos() + boundingBox.getRightTopFrontPos()) * 0.5f;
+  const float radius           = (boundingBox.getRightTopFrontPos() - boundingBox.getLeftBottomBackPos()).computeLength() * 0.5f;
+
+  // Places the submesh's center in front of the camera, its bounding sphere being at the given distance
+  const auto selectLods = [&] (float distance) {
+    mesh.selectLods(Raz::Transform(-center - Raz::Axis::Z * (distance + radius)).computeTranslationMatrix(), projectionMat, viewportHeight);
+    return submesh.getLodIndex();
+  };
+
+  // The camera being inside the bounding sphere, the full detail is used
+  CHECK(selectLods(-1.f) == 0);
+  // The farther the submesh, the less detailed its level
+  CHECK(selectLods(1000000.f) == 3);
+
+  // The first level being projected to 0.9 pixels, it is kept when coming from a farther distance, but not selected from a closer one
+  const float hysteresisDistance = submesh.getLodError(1) * pixelsPerUnit / 0.9f;
+  CHECK(selectLods(hysteresisDistance) >= 1);
+  CHECK(selectLods(0.f) == 0);
+  CHECK(selectLods(hysteresisDistance) == 0);
+
+  // Beyond the hysteresis, the level is selected
+  CHECK(selectLods(hysteresisDistance * 1.25f) >= 1);
+}
@@ -0,0 +1,107 @@
+#include "Catch.hpp"
+
+#include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Render/MeshUtils.hpp"
+
+namespace {
+
+Raz::Vertex createVertex(const Raz::Vec3f& position, const Raz::Vec2f& texcoords = Raz::Vec2f(0.f), const Raz::Vec3f& normal = Raz::Axis::Y) {
+  Raz::Vertex vertex {};
+  vertex.position  = position;
+  vertex.texcoords = texcoords;
+  vertex.normal    = normal;
+  return vertex;
+}
+
+} // namespace
+
+TEST_CASE("MeshUtils vertex deduplication") {
+  std::vector<Raz::Vertex> vertices = {
+    createVertex(Raz::Vec3f(0.f, 0.f, 0.f)),
+    createVertex(Raz::Vec3f(1.f, 0.f, 0.f)),
+    createVertex(Raz::Vec3f(-0.f, 0.f, 0.f)),                   // Equal to the 1st vertex, both zeros being equal
+    createVertex(Raz::Vec3f(1.f, 0.f, 0.f), Raz::Vec2f(1.f)),   // Differs from the 2nd vertex by its texcoords
+    createVertex(Raz::Vec3f(1.f, 0.f, 0.f)),                    // Equal to the 2nd vertex
+    createVertex(Raz::Vec3f(1.f, 0.f, 1e-6f))                   // Not strictly equal to the 2nd vertex
+  };
+
+  const Raz::MeshUtils::VertexRemap remap = Raz::MeshUtils::computeVertexRemap(vertices);
+  CHECK(remap.uniqueVertexCount == 4);
+  CHECK(remap.indices == std::vector<unsigned int>({ 0, 1, 0, 2, 1, 3 }));
+
+  const std::vector<Raz::Vertex> uniqueVertices = Raz::MeshUtils::remapVertices(vertices, remap);
+  REQUIRE(uniqueVertices.size() == 4);
+  CHECK(uniqueVertices[0].position.strictlyEquals(vertices[0].position));
+  CHECK(uniqueVertices[1].position.strictlyEquals(vertices[1].position));
+  CHECK(uniqueVertices[2].texcoords.strictlyEquals(vertices[3].texcoords));
+  CHECK(uniqueVertices[3].position.strictlyEquals(vertices[5].position));
+
+  std::vector<unsigned int> indices = { 0, 1, 3, 2, 4, 5 };
+  const Raz::MeshUtils::VertexRemap dedupRemap = Raz::MeshUtils::deduplicateVertices(vertices, indices);
+
+  CHECK(dedupRemap.indices == remap.indices);
+  CHECK(vertices.size() == 4);
+  CHECK(indices == std::vector<unsigned int>({ 0, 1, 2, 0, 1, 3 }));
+
+  // Deduplicating vertices without any duplicate leaves them untouched
+  const Raz::MeshUtils::VertexRemap identityRemap = Raz::MeshUtils::deduplicateVertices(vertices, indices);
+  CHECK(identityRemap.uniqueVertexCount == 4);
+  CHECK(identityRemap.indices == std::vector<unsigned int>({ 0, 1, 2, 3 }));
+  CHECK(indices == std::vector<unsigned int>({ 0, 1, 2, 0, 1, 3 }));
+}
+
+TEST_CASE("MeshUtils vertex welding") {
+  const std::vector<Raz::Vertex> vertices = {
+    createVertex(Raz::Vec3f(0.f, 0.f, 0.f)),
+    createVertex(Raz::Vec3f(0.0005f, 0.f, -0.0005f)),                          // Close to the 1st vertex
+    createVertex(Raz::Vec3f(0.01f, 0.f, 0.f)),                                 // Too far from the 1st vertex
+    createVertex(Raz::Vec3f(0.f, 0.0009f, 0.f), Raz::Vec2f(0.5f)),             // Close to the 1st vertex, but with different texcoords
+    createVertex(Raz::Vec3f(0.f, -0.0009f, 0.f), Raz::Vec2f(0.f), Raz::Axis::X), // Close to the 1st vertex, but with a different normal
+    createVertex(Raz::Vec3f(0.0099f, 0.f, 0.f), Raz::Vec2f(0.0001f)),          // Close to the 3rd vertex, in a neighbouring cell
+    createVertex(Raz::Vec3f(0.f, 0.f, 0.f), Raz::Vec2f(0.f), Raz::Vec3f(0.f, 0.9999f, 0.0001f))
+  };
+
+  Raz::MeshUtils::WeldingTolerances tolerances;
+  tolerances.position  = 0.001f;
+  tolerances.texcoords = 0.001f;
+
+  Raz::MeshUtils::VertexRemap remap = Raz::MeshUtils::computeVertexRemap(vertices, tolerances);
+  CHECK(remap.uniqueVertexCount == 5);
+  CHECK(remap.indices == std::vector<unsigned int>({ 0, 0, 1, 2, 3, 1, 4 }));
+
+  // With a normal tolerance, the last vertex is merged as well
+  tolerances.normal = 0.01f;
+
+  remap = Raz::MeshUtils::computeVertexRemap(vertices, tolerances);
+  CHECK(remap.uniqueVertexCount == 4);
+  CHECK(remap.indices == std::vector<unsigned int>({ 0, 0, 1, 2, 3, 1, 0 }));
+
+  // Merged vertices keep the attributes of the first one
+  const std::vector<Raz::Vertex> uniqueVertices = Raz::MeshUtils::remapVertices(vertices, remap);
+  REQUIRE(uniqueVertices.size() == 4);
+  CHECK(uniqueVertices[0].position.strictlyEquals(vertices[0].position));
+  CHECK(uniqueVertices[1].position.strictlyEquals(vertices[2].position));
+
+  // With only a normal tolerance, positions must be strictly equal
+  tolerances.position  = 0.f;
+  tolerances.texcoords = 0.f;
+
+  remap = Raz::MeshUtils::computeVertexRemap(vertices, tolerances);
+  CHECK(remap.uniqueVertexCount == 6);
+  CHECK(remap.indices == std::vector<unsigned int>({ 0, 1, 2, 3, 4, 5, 0 }));
+}
+
+TEST_CASE("MeshUtils degenerate triangles removal") {
+  std::vector<unsigned int> indices = { 0, 1, 2,
+                                        0, 0, 1,
+                                        1, 2, 3,
+                                        3, 2, 3,
+                                        2, 4, 4,
+                                        4, 3, 2 };
+
+  CHECK(Raz::MeshUtils::removeDegenerateTriangles(indices) == 3);
+  CHECK(indices == std::vector<unsigned int>({ 0, 1, 2, 1, 2, 3, 4, 3, 2 }));
+
+  CHECK(Raz::MeshUtils::removeDegenerateTriangles(indices) == 0);
+  CHECK(indices.size() == 9);
+}
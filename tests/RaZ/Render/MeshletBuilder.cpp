@@ -0,0 +1,208 @@
+#include "Catch.hpp"
+
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Render/Camera.hpp"
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/MeshletBuilder.hpp"
+#include "RaZ/Render/Renderer.hpp"
+#include "RaZ/Utils/Frustum.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace {
+
+using TriangleIndices = std::array<unsigned int, 3>;
+
+std::vector<TriangleIndices> recoverSortedTriangles(const std::vector<unsigned int>& indices) {
+  std::vector<TriangleIndices> triangles(indices.size() / 3);
+
+  for (std::size_t triangleIndex = 0; triangleIndex < triangles.size(); ++triangleIndex)
+    triangles[triangleIndex] = { indices[triangleIndex * 3], indices[triangleIndex * 3 + 1], indices[triangleIndex * 3 + 2] };
+
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+// Computes the direction a triangle is facing, which is that of its vertices' normals
+Raz::Vec3f computeNormal(const std::vector<Raz::Vertex>& vertices, const std::vector<unsigned int>& indices, std::size_t firstIndex) {
+  const Raz::Vec3f& firstPos = vertices[indices[firstIndex]].position;
+  return (vertices[indices[firstIndex + 2]].position - firstPos).cross(vertices[indices[firstIndex + 1]].position - firstPos);
+}
+
+void checkMeshlets(const std::vector<Raz::Vertex>& vertices, const std::vector<unsigned int>& originalIndices,
+                   const std::vector<unsigned int>& indices, const std::vector<Raz::Meshlet>& meshlets,
+                   std::size_t maxVertexCount, std::size_t maxTriangleCount) {
+  // The triangles are only reordered
+  REQUIRE(indices.size() == originalIndices.size());
+  CHECK(recoverSortedTriangles(indices) == recoverSortedTriangles(originalIndices));
+
+  std::size_t nextIndex = 0;
+
+  for (const Raz::Meshlet& meshlet : meshlets) {
+    // The meshlets' triangles are contiguous & cover all of them
+    CHECK(meshlet.firstIndex == nextIndex);
+    nextIndex += meshlet.triangleCount * 3;
+    REQUIRE(nextIndex <= indices.size());
+
+    CHECK(meshlet.triangleCount >= 1);
+    CHECK(meshlet.triangleCount <= maxTriangleCount);
+
+    std::vector<unsigned int> meshletVertices(indices.cbegin() + static_cast<std::ptrdiff_t>(meshlet.firstIndex),
+                                              indices.cbegin() + static_cast<std::ptrdiff_t>(nextIndex));
+    std::sort(meshletVertices.begin(), meshletVertices.end());
+    meshletVertices.erase(std::unique(meshletVertices.begin(), meshletVertices.end()), meshletVertices.end());
+
+    CHECK(meshlet.vertexCount == meshletVertices.size());
+    CHECK(meshlet.vertexCount <= maxVertexCount);
+
+    // The bounding sphere encloses all of the meshlet's vertices
+    const float radius = meshlet.boundingSphere.getRadius();
+
+    for (const unsigned int vertIndex : meshletVertices)
+      CHECK((vertices[vertIndex].position - meshlet.boundingSphere.getCenter()).computeLength() <= radius * 1.0001f + 0.00001f);
+
+    if (meshlet.coneCutoff > 1.f)
+      continue;
+
+    // The cone encloses all the triangles' normals, & its apex is behind all their planes
+    const float minDot = std::sqrt(1.f - meshlet.coneCutoff * meshlet.coneCutoff);
+
+    for (std::size_t firstIndex = meshlet.firstIndex; firstIndex < nextIndex; firstIndex += 3) {
+      const Raz::Vec3f normal = computeNormal(vertices, indices, firstIndex);
+
+      if (normal.computeSquaredLength() <= 0.f)
+        continue;
+
+      CHECK(normal.normalize().dot(meshlet.coneAxis) >= minDot - 0.0001f);
+      CHECK((vertices[indices[firstIndex]].position - meshlet.coneApex).dot(normal.normalize()) >= -0.0001f * (radius + 1.f));
+    }
+  }
+
+  CHECK(nextIndex == indices.size());
+}
+
+} // namespace
+
+TEST_CASE("MeshletBuilder meshlets building") {
+  for (const char* meshName : { "bigguy.obj", "cerberus.obj" }) {
+    const Raz::Mesh mesh(RAZ_TESTS_ROOT + "../assets/meshes/"s + meshName);
+
+    for (const Raz::Submesh& submesh : mesh.getSubmeshes()) {
+      const std::vector<unsigned int>& originalIndices = submesh.getTriangleIndices();
+
+      std::vector<unsigned int> indices = originalIndices;
+      const std::vector<Raz::Meshlet> meshlets = Raz::MeshletBuilder::buildMeshlets(submesh.getVertices(), indices);
+      checkMeshlets(submesh.getVertices(), originalIndices, indices, meshlets,
+                    Raz::MeshletBuilder::defaultMaxVertexCount, Raz::MeshletBuilder::defaultMaxTriangleCount);
+
+      // Meshlets are grown from adjacent triangles, most of them being filled
+      CHECK(meshlets.size() * 40 <= indices.size() / 3);
+
+      std::vector<unsigned int> smallIndices = originalIndices;
+      const std::vector<Raz::Meshlet> smallMeshlets = Raz::MeshletBuilder::buildMeshlets(submesh.getVertices(), smallIndices, 16, 8);
+      checkMeshlets(submesh.getVertices(), originalIndices, smallIndices, smallMeshlets, 16, 8);
+      CHECK(smallMeshlets.size() > meshlets.size());
+    }
+  }
+
+  CHECK(Raz::MeshletBuilder::compactIndices({ 0, 1, 2, 3, 4, 5, 6, 7, 8 }, { { 0, 3 }, { 6, 3 } }) == std::vector<unsigned int>({ 0, 1, 2, 6, 7, 8 }));
+}
+
+TEST_CASE("MeshletBuilder meshlets culling") {
+  Raz::Mesh mesh(Raz::Sphere(Raz::Vec3f(0.f), 1.f), 100, Raz::SphereMeshType::UV);
+  mesh.buildMeshlets();
+
+  const Raz::Submesh& submesh = mesh.getSubmeshes().front();
+  const std::vector<Raz::Meshlet>& meshlets = submesh.getMeshlets();
+  REQUIRE_FALSE(meshlets.empty());
+  CHECK_FALSE(submesh.isMeshletCulled());
+
+  const std::vector<Raz::Vertex>& vertices = submesh.getVertices();
+  const std::vector<unsigned int>& indices = submesh.getTriangleIndices();
+
+  const Raz::Camera camera(800, 600);
+
+  // The camera looking towards +Z from the origin, the sphere is placed in front of it
+  const Raz::Mat4f modelMat = Raz::Transform(Raz::Vec3f(0.f, 0.f, 5.f)).computeTransformMatrix();
+  const Raz::Frustum frustum(modelMat * camera.getViewMatrix() * camera.getProjectionMatrix());
+  const Raz::Vec3f viewPos(0.f, 0.f, -5.f);
+
+  const std::vector<Raz::DrawRange> ranges = Raz::MeshletBuilder::cullMeshlets(meshlets, frustum, &viewPos);
+  REQUIRE_FALSE(ranges.empty());
+
+  std::size_t visibleIndexCount = 0;
+
+  for (std::size_t rangeIndex = 0; rangeIndex < ranges.size(); ++rangeIndex) {
+    // Ranges are ordered & merged when contiguous
+    if (rangeIndex > 0)
+      CHECK(ranges[rangeIndex].firstIndex > ranges[rangeIndex - 1].firstIndex + ranges[rangeIndex - 1].indexCount);
+
+    visibleIndexCount += ranges[rangeIndex].indexCount;
+  }
+
+  CHECK(Raz::MeshletBuilder::compactIndices(indices, ranges).size() == visibleIndexCount);
+
+  // Most of the triangles facing away from the camera are culled
+  CHECK(visibleIndexCount < indices.size() * 2 / 3);
+
+  // Culled meshlets only have backfacing triangles
+  for (const Raz::Meshlet& meshlet : meshlets) {
+    if (Raz::MeshletBuilder::isVisible(meshlet, frustum, &viewPos))
+      continue;
+
+    for (std::size_t firstIndex = meshlet.firstIndex; firstIndex < meshlet.firstIndex + meshlet.triangleCount * 3; firstIndex += 3)
+      CHECK((vertices[indices[firstIndex]].position - viewPos).dot(computeNormal(vertices, indices, firstIndex)) >= -0.000001f);
+  }
+
+  // Seen from the sphere's center, all the triangles are backfacing
+  const Raz::Vec3f centerPos(0.f);
+  CHECK(Raz::MeshletBuilder::cullMeshlets(meshlets, frustum, &centerPos).empty());
+
+  // Without any viewer, only the frustum is used to cull the meshlets, the sphere being entirely visible
+  const std::vector<Raz::DrawRange> frustumRanges = Raz::MeshletBuilder::cullMeshlets(meshlets, frustum);
+  REQUIRE(frustumRanges.size() == 1);
+  CHECK(frustumRanges.front().indexCount == indices.size());
+
+  // Outside of the frustum, all meshlets are culled
+  const Raz::Mat4f sideModelMat = Raz::Transform(Raz::Vec3f(100.f, 0.f, 5.f)).computeTransformMatrix();
+  const Raz::Frustum sideFrustum(sideModelMat * camera.getViewMatrix() * camera.getProjectionMatrix());
+  CHECK(Raz::MeshletBuilder::cullMeshlets(meshlets, sideFrustum).empty());
+}
+
+TEST_CASE("Submesh meshlets") {
+  Raz::Renderer::recoverErrors(); // Flushing errors
+
+  Raz::Mesh mesh(RAZ_TESTS_ROOT + "../assets/meshes/bigguy.obj"s);
+  CHECK_FALSE(mesh.hasMeshlets());
+
+  mesh.generateLods();
+  mesh.buildMeshlets();
+  REQUIRE(mesh.hasMeshlets());
+
+  Raz::Submesh& submesh = mesh.getSubmeshes().front();
+  CHECK_FALSE(submesh.isMeshletCulled());
+  CHECK(submesh.getVisibleRanges().empty());
+
+  mesh.load();
+  CHECK_FALSE(Raz::Renderer::hasErrors());
+
+  const Raz::Camera camera(800, 600);
+  const Raz::Frustum frustum(camera.getViewMatrix() * camera.getProjectionMatrix());
+  const Raz::Vec3f viewPos(0.f, 0.f, -5.f);
+  mesh.cullMeshlets(frustum, &viewPos);
+
+  CHECK(submesh.isMeshletCulled());
+  CHECK(submesh.getVisibleRanges().size() == Raz::MeshletBuilder::cullMeshlets(submesh.getMeshlets(), frustum, &viewPos).size());
+
+  // Meshlets are only culled in full detail
+  submesh.setLodIndex(1);
+  CHECK_FALSE(submesh.isMeshletCulled());
+  submesh.setLodIndex(0);
+  CHECK(submesh.isMeshletCulled());
+
+  // Reordering the triangles discards the meshlets
+  mesh.optimize();
+  CHECK_FALSE(mesh.hasMeshlets());
+  CHECK_FALSE(submesh.isMeshletCulled());
+}
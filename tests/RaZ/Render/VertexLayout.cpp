@@ -0,0 +1,172 @@
+#include "Catch.hpp"
+
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/Renderer.hpp"
+#include "RaZ/Render/ShaderProgram.hpp"
+#include "RaZ/Render/VertexLayout.hpp"
+
+namespace {
+
+std::vector<Raz::Vertex> createVertices() {
+  std::vector<Raz::Vertex> vertices(4);
+
+  vertices[0].position  = Raz::Vec3f(-1.f, 2.f, 3.f);
+  vertices[0].texcoords = Raz::Vec2f(0.f, 1.f);
+  vertices[0].normal    = Raz::Axis::Y;
+  vertices[0].tangent   = Raz::Axis::X;
+
+  vertices[1].position  = Raz::Vec3f(4.f, -5.f, 6.f);
+  vertices[1].texcoords = Raz::Vec2f(0.25f, 0.3333f);
+  vertices[1].normal    = Raz::Vec3f(1.f, -2.f, -3.f).normalize();
+  vertices[1].tangent   = Raz::Vec3f(-3.f, 0.f, 1.f).normalize();
+
+  vertices[2].position  = Raz::Vec3f(0.123f, 0.f, -7.f);
+  vertices[2].texcoords = Raz::Vec2f(0.999f, 0.5f);
+  vertices[2].normal    = -Raz::Axis::Z;
+  vertices[2].tangent   = Raz::Vec3f(0.f); // Meshes without tangents have null ones
+
+  vertices[3].position  = Raz::Vec3f(1.f, 1.f, 1.f);
+  vertices[3].texcoords = Raz::Vec2f(1.5f, -0.5f); // Out of the [0; 1] range
+  vertices[3].normal    = Raz::Vec3f(-1.f, 1.f, -1.f).normalize();
+  vertices[3].tangent   = Raz::Vec3f(1.f, 1.f, 0.f).normalize();
+
+  return vertices;
+}
+
+} // namespace
+
+TEST_CASE("VertexLayout strides") {
+  constexpr Raz::VertexLayout defaultLayout;
+  CHECK(defaultLayout.isDefault());
+  CHECK(defaultLayout.computeStride() == sizeof(Raz::Vertex));
+
+  constexpr Raz::VertexLayout compactLayout = Raz::VertexLayout::createCompact();
+  CHECK_FALSE(compactLayout.isDefault());
+  CHECK(compactLayout.computeStride() == 20);
+  CHECK(compactLayout.computeStride() * 2 < defaultLayout.computeStride());
+
+  constexpr Raz::VertexLayout floatPositionsLayout = Raz::VertexLayout::createCompact(false);
+  CHECK(floatPositionsLayout.positionFormat == Raz::PositionFormat::FLOAT);
+  CHECK(floatPositionsLayout.computeStride() == 24);
+  CHECK(floatPositionsLayout != compactLayout);
+
+  // All attributes are aligned on 4 bytes
+  for (const Raz::VertexLayout& layout : { compactLayout, floatPositionsLayout, Raz::VertexLayout{ Raz::PositionFormat::UNORM16,
+                                                                                                   Raz::TexcoordsFormat::UNORM16,
+                                                                                                   Raz::NormalFormat::FLOAT } }) {
+    CHECK(layout.computePositionSize() % 4 == 0);
+    CHECK(layout.computeTexcoordsSize() % 4 == 0);
+    CHECK(layout.computeNormalSize() % 4 == 0);
+  }
+}
+
+TEST_CASE("VertexPacker vertices packing") {
+  const std::vector<Raz::Vertex> vertices = createVertices();
+  const Raz::AABB boundingBox(Raz::Vec3f(-1.f, -5.f, -7.f), Raz::Vec3f(4.f, 2.f, 6.f));
+
+  {
+    // The default layout is the memory representation of the vertices
+    const std::vector<uint8_t> packedVertices = Raz::VertexPacker::packVertices(vertices, Raz::VertexLayout(), boundingBox);
+    REQUIRE(packedVertices.size() == vertices.size() * sizeof(Raz::Vertex));
+    CHECK(std::memcmp(packedVertices.data(), vertices.data(), packedVertices.size()) == 0);
+    CHECK(Raz::VertexPacker::unpackVertices(packedVertices, Raz::VertexLayout(), boundingBox) == vertices);
+  }
+
+  {
+    constexpr Raz::VertexLayout layout = Raz::VertexLayout::createCompact();
+
+    const std::vector<uint8_t> packedVertices = Raz::VertexPacker::packVertices(vertices, layout, boundingBox);
+    REQUIRE(packedVertices.size() == vertices.size() * 20);
+
+    const std::vector<Raz::Vertex> unpackedVertices = Raz::VertexPacker::unpackVertices(packedVertices, layout, boundingBox);
+    REQUIRE(unpackedVertices.size() == vertices.size());
+
+    for (std::size_t vertIndex = 0; vertIndex < vertices.size(); ++vertIndex) {
+      const Raz::Vertex& vertex         = vertices[vertIndex];
+      const Raz::Vertex& unpackedVertex = unpackedVertices[vertIndex];
+
+      // Positions are quantized on the box's extent, which is at most 13 on each axis here
+      CHECK_THAT(unpackedVertex.position, IsNearlyEqualToVector(vertex.position, 13.f / 65535.f));
+      CHECK_THAT(unpackedVertex.texcoords, IsNearlyEqualToVector(vertex.texcoords, 0.001f));
+
+      CHECK(unpackedVertex.normal.dot(vertex.normal) > 0.99999f);
+
+      if (vertex.tangent.computeSquaredLength() > 0.f)
+        CHECK(unpackedVertex.tangent.dot(vertex.tangent) > 0.9999f);
+      else
+        CHECK(unpackedVertex.tangent == Raz::Axis::Z);
+    }
+
+    // Half-precision floats represent texcoords outside of [0; 1]
+    CHECK(unpackedVertices[3].texcoords == Raz::Vec2f(1.5f, -0.5f));
+  }
+
+  {
+    constexpr Raz::VertexLayout layout { Raz::PositionFormat::FLOAT, Raz::TexcoordsFormat::UNORM16, Raz::NormalFormat::FLOAT };
+
+    const std::vector<uint8_t> packedVertices = Raz::VertexPacker::packVertices(vertices, layout, boundingBox);
+    REQUIRE(packedVertices.size() == vertices.size() * 40);
+
+    const std::vector<Raz::Vertex> unpackedVertices = Raz::VertexPacker::unpackVertices(packedVertices, layout, boundingBox);
+
+    for (std::size_t vertIndex = 0; vertIndex < 3; ++vertIndex) {
+      CHECK(unpackedVertices[vertIndex].position == vertices[vertIndex].position);
+      CHECK_THAT(unpackedVertices[vertIndex].texcoords, IsNearlyEqualToVector(vertices[vertIndex].texcoords, 1.f / 65535.f));
+      CHECK(unpackedVertices[vertIndex].normal == vertices[vertIndex].normal);
+    }
+
+    // Normalized integers cannot represent texcoords outside of [0; 1], which are clamped
+    CHECK(unpackedVertices[3].texcoords == Raz::Vec2f(1.f, 0.f));
+  }
+}
+
+TEST_CASE("VertexPacker indices packing") {
+  CHECK(Raz::VertexPacker::packShortIndices({}).empty());
+  CHECK(Raz::VertexPacker::packShortIndices({ 0, 1, 2, 65534, 300, 2 }) == std::vector<uint16_t>({ 0, 1, 2, 65534, 300, 2 }));
+}
+
+TEST_CASE("Submesh vertex layout") {
+  Raz::Renderer::recoverErrors(); // Flushing errors
+
+  Raz::Mesh mesh;
+
+  Raz::Submesh& submesh = mesh.getSubmeshes().front();
+  submesh.getVertices() = createVertices();
+  submesh.getTriangleIndices() = { 0, 1, 2, 1, 3, 2 };
+  CHECK(submesh.hasShortIndices());
+
+  mesh.setVertexLayout(Raz::VertexLayout::createCompact());
+  CHECK(submesh.getVertexLayout() == Raz::VertexLayout::createCompact());
+
+  // Quantizing the positions computes the bounding box they are relative to
+  CHECK(submesh.getBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(-1.f, -5.f, -7.f));
+  CHECK(submesh.getBoundingBox().getRightTopFrontPos() == Raz::Vec3f(4.f, 2.f, 6.f));
+
+  mesh.load();
+  CHECK_FALSE(Raz::Renderer::hasErrors());
+
+  // The default vertex shader holds the uniforms describing the compact layouts
+  const Raz::ShaderProgram program(Raz::VertexShader(RAZ_TESTS_ROOT + "../shaders/common.vert"s),
+                                   Raz::FragmentShader(RAZ_TESTS_ROOT + "../shaders/lambert.frag"s));
+  REQUIRE(program.isLinked());
+  CHECK(program.recoverUniformLocation("uniVertexFormat.quantizedPositions") != -1);
+  CHECK(program.recoverUniformLocation("uniVertexFormat.positionOffset") != -1);
+  CHECK(program.recoverUniformLocation("uniVertexFormat.positionScale") != -1);
+  CHECK(program.recoverUniformLocation("uniVertexFormat.octahedralNormals") != -1);
+
+  submesh.sendVertexFormat(program);
+  CHECK_FALSE(Raz::Renderer::hasErrors());
+
+  // Vertices which cannot all be referenced by 16-bit indices require 32-bit ones; the last 16-bit index being reserved for primitive
+  //  restart, up to 65535 vertices can use short indices
+  submesh.getVertices().resize(65535);
+  CHECK(submesh.hasShortIndices());
+
+  submesh.getVertices().resize(65536);
+  CHECK_FALSE(submesh.hasShortIndices());
+
+  submesh.setVertexLayout(Raz::VertexLayout());
+  submesh.load();
+  submesh.sendVertexFormat(program);
+  CHECK_FALSE(Raz::Renderer::hasErrors());
+}
@@ -0,0 +1,228 @@
+#include "Catch.hpp"
+
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/Texture.hpp"
+#include "RaZ/Utils/AssetArchive.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/Image.hpp"
+#include "RaZ/Utils/RaztexFormat.hpp"
+#include "RaZ/Utils/VirtualFileSystem.hpp"
+
+#include <fstream>
+
+using namespace std::literals;
+
+namespace {
+
+std::string readFile(const Raz::FilePath& filePath) {
+  std::ifstream file(filePath, std::ios_base::in | std::ios_base::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const Raz::FilePath& filePath, const std::string& content) {
+  std::ofstream file(filePath, std::ios_base::out | std::ios_base::binary);
+  file.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+} // namespace
+
+TEST_CASE("AssetArchive save & find") {
+  const std::string meshData    = "mesh data";
+  const std::string textureData = std::string(100, 't');
+
+  Raz::AssetArchive::save("tèst_ärchïvé.razpack", {
+    { "textures/täxture.png", Raz::AssetArchiveFormat::EntryType::TEXTURE, textureData },
+    { "meshes/mesh.obj", Raz::AssetArchiveFormat::EntryType::MESH, meshData },
+    { "empty", Raz::AssetArchiveFormat::EntryType::RAW, {} }
+  });
+
+  const Raz::AssetArchive archive("tèst_ärchïvé.razpack");
+  REQUIRE(archive.getEntryCount() == 3);
+  CHECK(archive.checkIntegrity());
+
+  // Entries are sorted by path
+  CHECK(archive.getEntry(0).path == "empty");
+  CHECK(archive.getEntry(1).path == "meshes/mesh.obj");
+  CHECK(archive.getEntry(2).path == "textures/täxture.png");
+
+  const std::optional<Raz::ArchiveEntry> meshEntry = archive.find("meshes/mesh.obj");
+  REQUIRE(meshEntry.has_value());
+  CHECK(meshEntry->type == Raz::AssetArchiveFormat::EntryType::MESH);
+  CHECK(meshEntry->data == meshData);
+
+  const std::optional<Raz::ArchiveEntry> textureEntry = archive.find("textures/täxture.png");
+  REQUIRE(textureEntry.has_value());
+  CHECK(textureEntry->type == Raz::AssetArchiveFormat::EntryType::TEXTURE);
+  CHECK(textureEntry->data == textureData);
+  // Data are aligned in the file
+  CHECK(reinterpret_cast<std::uintptr_t>(textureEntry->data.data()) % Raz::AssetArchiveFormat::alignment == 0);
+
+  const std::optional<Raz::ArchiveEntry> emptyEntry = archive.find("empty");
+  REQUIRE(emptyEntry.has_value());
+  CHECK(emptyEntry->data.empty());
+
+  CHECK_FALSE(archive.find("meshes").has_value());
+  CHECK_FALSE(archive.find("meshes/mesh.ob").has_value());
+  CHECK_FALSE(archive.find("unknown").has_value());
+
+  // An asset cannot be packed several times
+  CHECK_THROWS(Raz::AssetArchive::save("tèst_düplïcäté.razpack", {
+    { "asset", Raz::AssetArchiveFormat::EntryType::RAW, meshData },
+    { "asset", Raz::AssetArchiveFormat::EntryType::RAW, textureData }
+  }));
+
+  // An archive may be empty
+  Raz::AssetArchive::save("tèst_émpty.razpack", {});
+  const Raz::AssetArchive emptyArchive("tèst_émpty.razpack");
+  CHECK(emptyArchive.getEntryCount() == 0);
+  CHECK_FALSE(emptyArchive.find("empty").has_value());
+}
+
+TEST_CASE("AssetArchive invalid files") {
+  const std::string assetData = std::string(64, 'a');
+  Raz::AssetArchive::save("tèst_ïnvälïd.razpack", { { "asset", Raz::AssetArchiveFormat::EntryType::RAW, assetData } });
+
+  const std::string content = readFile("tèst_ïnvälïd.razpack");
+  REQUIRE(content.size() > sizeof(Raz::AssetArchiveFormat::Header));
+
+  // Altered asset data: the index is valid, but the integrity check fails
+  std::string corruptedContent = content;
+  corruptedContent[corruptedContent.size() - 1] ^= 1;
+  writeFile("tèst_ïnvälïd.razpack", corruptedContent);
+
+  {
+    const Raz::AssetArchive archive("tèst_ïnvälïd.razpack");
+    CHECK_FALSE(archive.checkIntegrity());
+  }
+
+  // Altered index
+  corruptedContent = content;
+  corruptedContent[sizeof(Raz::AssetArchiveFormat::Header)] ^= 1;
+  writeFile("tèst_ïnvälïd.razpack", corruptedContent);
+  CHECK_THROWS(Raz::AssetArchive("tèst_ïnvälïd.razpack"));
+
+  // Truncated file
+  writeFile("tèst_ïnvälïd.razpack", content.substr(0, content.size() - 1));
+  CHECK_THROWS(Raz::AssetArchive("tèst_ïnvälïd.razpack"));
+
+  // Invalid magic
+  corruptedContent = content;
+  corruptedContent[0] = 'X';
+  writeFile("tèst_ïnvälïd.razpack", corruptedContent);
+  CHECK_THROWS(Raz::AssetArchive("tèst_ïnvälïd.razpack"));
+
+  // Too small to be an archive
+  writeFile("tèst_ïnvälïd.razpack", content.substr(0, 10));
+  CHECK_THROWS(Raz::AssetArchive("tèst_ïnvälïd.razpack"));
+}
+
+TEST_CASE("VirtualFileSystem path normalization") {
+  CHECK(Raz::VirtualFileSystem::normalizePath("").empty());
+  CHECK(Raz::VirtualFileSystem::normalizePath(".").empty());
+  CHECK(Raz::VirtualFileSystem::normalizePath("assets/meshes/ball.obj") == "assets/meshes/ball.obj");
+  CHECK(Raz::VirtualFileSystem::normalizePath("assets\\meshes\\ball.obj") == "assets/meshes/ball.obj");
+  CHECK(Raz::VirtualFileSystem::normalizePath("./assets//meshes/./ball.obj") == "assets/meshes/ball.obj");
+  CHECK(Raz::VirtualFileSystem::normalizePath("assets/textures/../meshes/ball.obj") == "assets/meshes/ball.obj");
+  CHECK(Raz::VirtualFileSystem::normalizePath("assets/meshes/") == "assets/meshes");
+  CHECK(Raz::VirtualFileSystem::normalizePath("../assets/../../meshes") == "../../meshes");
+  CHECK(Raz::VirtualFileSystem::normalizePath("/assets/../../meshes") == "/meshes");
+}
+
+TEST_CASE("VirtualFileSystem mount") {
+  Raz::AssetArchive::save("tèst_vfs_1.razpack", {
+    { "a.txt", Raz::AssetArchiveFormat::EntryType::RAW, "first a"sv },
+    { "sub/b.txt", Raz::AssetArchiveFormat::EntryType::RAW, "first b"sv }
+  });
+  Raz::AssetArchive::save("tèst_vfs_2.razpack", { { "a.txt", Raz::AssetArchiveFormat::EntryType::RAW, "second a"sv } });
+
+  Raz::VirtualFileSystem::unmountAll();
+  CHECK_FALSE(Raz::VirtualFileSystem::hasMountedArchives());
+  CHECK_FALSE(Raz::VirtualFileSystem::find("a.txt").has_value());
+
+  CHECK_THROWS(Raz::VirtualFileSystem::mount("nonexistent.razpack"));
+  CHECK_FALSE(Raz::VirtualFileSystem::hasMountedArchives());
+
+  Raz::VirtualFileSystem::mount("tèst_vfs_1.razpack", "assets/");
+  CHECK(Raz::VirtualFileSystem::hasMountedArchives());
+
+  std::optional<Raz::ArchiveEntry> entry = Raz::VirtualFileSystem::find("assets/sub/b.txt");
+  REQUIRE(entry.has_value());
+  CHECK(entry->data == "first b");
+
+  // Paths are normalized before being searched for
+  entry = Raz::VirtualFileSystem::find("./assets\\sub/../a.txt");
+  REQUIRE(entry.has_value());
+  CHECK(entry->data == "first a");
+
+  // Paths outside of the mount point are not found
+  CHECK_FALSE(Raz::VirtualFileSystem::find("a.txt").has_value());
+  CHECK_FALSE(Raz::VirtualFileSystem::find("assetsa.txt").has_value());
+  CHECK_FALSE(Raz::VirtualFileSystem::find("other/a.txt").has_value());
+
+  // The latest mounted archive takes precedence
+  Raz::VirtualFileSystem::mount("tèst_vfs_2.razpack", "assets");
+
+  entry = Raz::VirtualFileSystem::find("assets/a.txt");
+  REQUIRE(entry.has_value());
+  CHECK(entry->data == "second a");
+
+  entry = Raz::VirtualFileSystem::find("assets/sub/b.txt");
+  REQUIRE(entry.has_value());
+  CHECK(entry->data == "first b");
+
+  Raz::VirtualFileSystem::unmount("tèst_vfs_2.razpack");
+
+  entry = Raz::VirtualFileSystem::find("assets/a.txt");
+  REQUIRE(entry.has_value());
+  CHECK(entry->data == "first a");
+
+  Raz::VirtualFileSystem::unmountAll();
+  CHECK_FALSE(Raz::VirtualFileSystem::hasMountedArchives());
+  CHECK_FALSE(Raz::VirtualFileSystem::find("assets/a.txt").has_value());
+}
+
+TEST_CASE("VirtualFileSystem asset loading") {
+  // Mesh with a material, whose library is archived next to it
+  Raz::Mesh mesh(Raz::Sphere(Raz::Vec3f(0.f), 1.f), 5, Raz::SphereMeshType::UV);
+  static_cast<Raz::MaterialCookTorrance&>(*mesh.getMaterials().front()).setMetallicFactor(0.75f);
+  mesh.save("tèst_vfs_mesh.obj.razmesh");
+
+  const std::string meshContent = readFile("tèst_vfs_mesh.obj.razmesh");
+  const std::string mtlContent  = readFile("tèst_vfs_mesh.obj.mtl");
+  REQUIRE_FALSE(mtlContent.empty());
+
+  Raz::Image image(3, 2, Raz::ImageColorspace::RGB);
+  for (std::size_t i = 0; i < 3 * 2 * 3; ++i)
+    static_cast<uint8_t*>(image.getDataPtr())[i] = static_cast<uint8_t>(i * 10);
+
+  const std::vector<char> textureContent = Raz::RaztexFormat::cook(image, false, false);
+
+  Raz::AssetArchive::save("tèst_vfs_assets.razpack", {
+    { "meshes/sphere.obj", Raz::AssetArchiveFormat::EntryType::MESH, meshContent },
+    { "meshes/tèst_vfs_mesh.obj.mtl", Raz::AssetArchiveFormat::EntryType::MATERIAL, mtlContent },
+    { "textures/image.png", Raz::AssetArchiveFormat::EntryType::TEXTURE, std::string_view(textureContent.data(), textureContent.size()) }
+  });
+
+  Raz::VirtualFileSystem::mount("tèst_vfs_assets.razpack", "virtual");
+
+  {
+    const Raz::Mesh importedMesh("virtual/meshes/sphere.obj");
+    REQUIRE(importedMesh.getSubmeshes().size() == 1);
+    CHECK(importedMesh.getSubmeshes().front().getVertexCount() == mesh.getSubmeshes().front().getVertexCount());
+
+    REQUIRE(importedMesh.getMaterials().size() == 1);
+    REQUIRE(importedMesh.getMaterials().front()->getType() == Raz::MaterialType::COOK_TORRANCE);
+    CHECK(static_cast<const Raz::MaterialCookTorrance&>(*importedMesh.getMaterials().front()).getMetallicFactor() == 0.75f);
+  }
+
+  {
+    const Raz::Texture texture("virtual/textures/image.png", 0);
+    CHECK(texture.getImage() == image);
+  }
+
+  // An archived asset must be of the expected type
+  CHECK_THROWS(Raz::Mesh("virtual/textures/image.png"));
+  CHECK_THROWS(Raz::Texture("virtual/meshes/sphere.obj", 0));
+
+  Raz::VirtualFileSystem::unmountAll();
+}
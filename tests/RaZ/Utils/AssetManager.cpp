@@ -0,0 +1,177 @@
+#include "Catch.hpp"
+
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/Texture.hpp"
+#include "RaZ/Utils/AssetManager.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/Image.hpp"
+
+using namespace std::literals;
+
+TEST_CASE("AssetManager deduplication") {
+  Raz::AssetManager manager(2);
+
+  const Raz::AssetHandle<Raz::Texture> texture = manager.loadTexture(RAZ_TESTS_ROOT + "assets/textures/ŔĜBŖĀ.png"s, 0, true);
+  REQUIRE(texture.isValid());
+  CHECK(texture.getReferenceCount() == 1);
+
+  // Textures are only uploaded when updating the manager
+  CHECK(texture.getState() == Raz::AssetState::LOADING);
+  CHECK(manager.getStatistics().progress == 0.f);
+
+  // Requesting the same file, even through a different path, returns the same asset
+  const Raz::AssetHandle<Raz::Texture> sameTexture = manager.loadTexture(RAZ_TESTS_ROOT + "assets/meshes/../textures/./ŔĜBŖĀ.png"s, 0, true);
+  CHECK(texture.getReferenceCount() == 2);
+  CHECK(sameTexture.getReferenceCount() == 2);
+
+  // Requesting it with different settings loads it separately
+  const Raz::AssetHandle<Raz::Texture> otherTexture = manager.loadTexture(RAZ_TESTS_ROOT + "assets/textures/ŔĜBŖĀ.png"s, 1, true);
+  CHECK(otherTexture.getReferenceCount() == 1);
+
+  CHECK(manager.getAssetCount() == 2);
+  CHECK(manager.getStatistics().requestCount == 3);
+  CHECK(manager.getStatistics().deduplicatedCount == 1);
+  CHECK(manager.getStatistics().loadingCount == 2);
+
+  manager.waitAll();
+
+  REQUIRE(texture.isLoaded());
+  REQUIRE(otherTexture.isLoaded());
+  CHECK(texture.get() == sameTexture.get());
+  CHECK(texture.get() != otherTexture.get());
+  CHECK(texture->getBindingIndex() == 0);
+  CHECK(otherTexture->getBindingIndex() == 1);
+  CHECK(texture->getImage().getWidth() == 2);
+  CHECK(texture->getImage() == otherTexture->getImage());
+
+  const Raz::AssetStatistics& stats = manager.getStatistics();
+  CHECK(stats.loadingCount == 0);
+  CHECK(stats.loadedCount == 2);
+  CHECK(stats.failedCount == 0);
+  CHECK(stats.progress == 1.f);
+  CHECK(stats.averageLatency > 0.f);
+  CHECK(stats.maxLatency >= stats.averageLatency);
+  CHECK(stats.averageUploadTime > 0.f);
+
+  // An asset already loaded is available immediately
+  const Raz::AssetHandle<Raz::Texture> loadedTexture = manager.loadTexture(RAZ_TESTS_ROOT + "assets/textures/ŔĜBŖĀ.png"s, 0, true);
+  CHECK(loadedTexture.isLoaded());
+  CHECK(loadedTexture.get() == texture.get());
+}
+
+TEST_CASE("AssetManager asset types") {
+  Raz::AssetManager manager(1);
+
+  const Raz::AssetHandle<Raz::Image> image = manager.loadImage(RAZ_TESTS_ROOT + "assets/images/dëfàùltTêst.png"s);
+  const Raz::AssetHandle<Raz::Mesh> mesh   = manager.loadMesh(RAZ_TESTS_ROOT + "assets/meshes/çûbè_BP.obj"s);
+
+  manager.wait(image);
+  REQUIRE(image.isLoaded());
+  CHECK(image->getWidth() == 2);
+  CHECK(image->getHeight() == 2);
+  CHECK(*image == Raz::Image(RAZ_TESTS_ROOT + "assets/images/dëfàùltTêst.png"s));
+
+  manager.wait(mesh);
+  REQUIRE(mesh.isLoaded());
+  CHECK(mesh->getSubmeshes().size() == 1);
+  CHECK(mesh->recoverTriangleCount() == 12);
+  CHECK(mesh->getMaterials().size() == 1);
+
+  CHECK(manager.getStatistics().loadedCount == 2);
+}
+
+TEST_CASE("AssetManager upload budget") {
+  Raz::AssetManager manager(1);
+  manager.setUploadTimeBudget(0.f);
+
+  std::vector<Raz::AssetHandle<Raz::Texture>> textures;
+  textures.push_back(manager.loadTexture(RAZ_TESTS_ROOT + "assets/textures/₀₀₀₀.png"s, 0));
+  textures.push_back(manager.loadTexture(RAZ_TESTS_ROOT + "assets/textures/₁₀₀₁.png"s, 0));
+  textures.push_back(manager.loadTexture(RAZ_TESTS_ROOT + "assets/textures/₁₁₁₁.png"s, 0));
+
+  // Without any time left, a single asset is uploaded per update
+  std::size_t finishedCount = 0;
+
+  while (manager.getStatistics().loadingCount > 0) {
+    const std::size_t updateCount = manager.update();
+
+    if (updateCount == 0)
+      continue; // No texture has been decoded yet
+
+    CHECK(updateCount == 1);
+
+    finishedCount += updateCount;
+    CHECK(manager.getStatistics().progress == static_cast<float>(finishedCount) / 3.f);
+  }
+
+  CHECK(finishedCount == 3);
+
+  for (const Raz::AssetHandle<Raz::Texture>& texture : textures)
+    CHECK(texture.isLoaded());
+
+  // Nothing left to upload
+  CHECK(manager.update() == 0);
+}
+
+TEST_CASE("AssetManager failures & eviction") {
+  Raz::AssetManager manager(1);
+
+  Raz::AssetHandle<Raz::Texture> invalidTexture = manager.loadTexture("nonexistent.png", 0);
+  manager.wait(invalidTexture);
+
+  CHECK(invalidTexture.hasFailed());
+  CHECK_FALSE(invalidTexture.getError().empty());
+  CHECK(manager.getStatistics().failedCount == 1);
+
+  Raz::AssetHandle<Raz::Texture> texture = manager.loadTexture(RAZ_TESTS_ROOT + "assets/textures/BƁḂɃ.png"s, 0);
+  Raz::AssetHandle<Raz::Texture> textureCopy = texture;
+  manager.waitAll();
+  REQUIRE(texture.isLoaded());
+
+  // Referenced assets are not evicted
+  CHECK(manager.evictUnused() == 0);
+  CHECK(manager.getAssetCount() == 2);
+
+  invalidTexture.reset();
+  CHECK_FALSE(invalidTexture.isValid());
+  CHECK(manager.evictUnused() == 1);
+  CHECK(manager.getStatistics().failedCount == 0);
+
+  texture.reset();
+  CHECK(textureCopy.getReferenceCount() == 1);
+  CHECK(manager.evictUnused() == 0);
+
+  // Assets shared outside of the manager are not evicted either, even if no handle references them
+  const Raz::TexturePtr sharedTexture = textureCopy.get();
+  textureCopy = Raz::AssetHandle<Raz::Texture>();
+  CHECK(manager.evictUnused() == 0);
+  CHECK(manager.getAssetCount() == 1);
+
+  // The asset still being held, requesting it again returns it directly
+  const Raz::AssetHandle<Raz::Texture> requestedTexture = manager.loadTexture(RAZ_TESTS_ROOT + "assets/textures/BƁḂɃ.png"s, 0);
+  CHECK(requestedTexture.isLoaded());
+  CHECK(requestedTexture.get() == sharedTexture);
+  CHECK(manager.getStatistics().deduplicatedCount == 1);
+}
+
+TEST_CASE("AssetManager eviction & reloading") {
+  Raz::AssetManager manager(1);
+
+  {
+    const Raz::AssetHandle<Raz::Image> image = manager.loadImage(RAZ_TESTS_ROOT + "assets/images/dëfàùltTêst.png"s);
+    manager.waitAll();
+    CHECK(manager.getStatistics().loadedCount == 1);
+  }
+
+  CHECK(manager.evictUnused() == 1);
+  CHECK(manager.getAssetCount() == 0);
+  CHECK(manager.getStatistics().loadedCount == 0);
+  CHECK(manager.getStatistics().evictedCount == 1);
+
+  const Raz::AssetHandle<Raz::Image> image = manager.loadImage(RAZ_TESTS_ROOT + "assets/images/dëfàùltTêst.png"s);
+  CHECK(image.getState() == Raz::AssetState::LOADING);
+  CHECK(manager.getStatistics().deduplicatedCount == 0);
+
+  manager.waitAll();
+  CHECK(image.isLoaded());
+}
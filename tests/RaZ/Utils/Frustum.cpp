@@ -0,0 +1,188 @@
+#include "Catch.hpp"
+
+#include "RaZ/Math/Quaternion.hpp"
+#include "RaZ/Math/TransformBatch.hpp"
+#include "RaZ/Utils/Frustum.hpp"
+
+namespace {
+
+// Orthographic projection as computed by the Camera, looking toward -Z
+//
+//            Y
+//            ^   [ 10; 10; -1 ]     [ 10; 10; -100 ]
+//            |  .-------------------.
+//            |  |                   |
+//            o--|-------------------|---> -Z
+//               |                   |
+//               .-------------------.
+//     [ -10; -10; -1 ]     [ -10; -10; -100 ]
+
+Raz::Mat4f computeOrthographicMatrix(float right, float left, float top, float bottom, float near, float far) {
+  const float xDist = right - left;
+  const float yDist = top - bottom;
+  const float zDist = far - near;
+
+  return Raz::Mat4f( 2.f / xDist,             0.f,                     0.f,                  0.f,
+                     0.f,                     2.f / yDist,             0.f,                  0.f,
+                     0.f,                     0.f,                    -2.f / zDist,          0.f,
+                    -(right + left) / xDist, -(top + bottom) / yDist, -(far + near) / zDist, 1.f);
+}
+
+// Perspective projection as computed by the Camera, with a field of view of 90° & looking toward +Z
+// The clip space being assumed to go from -w to w, the near plane is located at far * near / (2 * far - near), thus ~0.5025 here
+Raz::Mat4f computePerspectiveMatrix(float near, float far) {
+  const float planeDist = far - near;
+  const float planeMult = far * near;
+
+  return Raz::Mat4f(1.f, 0.f, 0.f,                     0.f,
+                    0.f, 1.f, 0.f,                     0.f,
+                    0.f, 0.f, far / planeDist,         1.f,
+                    0.f, 0.f, -planeMult / planeDist,  0.f);
+}
+
+const Raz::Frustum orthoFrustum(computeOrthographicMatrix(10.f, -10.f, 10.f, -10.f, 1.f, 100.f));
+const Raz::Frustum perspFrustum(computePerspectiveMatrix(1.f, 100.f));
+
+} // namespace
+
+TEST_CASE("Frustum planes extraction") {
+  const std::array<Raz::Plane, 6>& orthoPlanes = orthoFrustum.getPlanes();
+
+  CHECK_THAT(orthoPlanes[0].getNormal(), IsNearlyEqualToVector(Raz::Axis::X)); // Left
+  CHECK_THAT(orthoPlanes[0].getDistance(), IsNearlyEqualTo(-10.f));
+  CHECK_THAT(orthoPlanes[1].getNormal(), IsNearlyEqualToVector(-Raz::Axis::X)); // Right
+  CHECK_THAT(orthoPlanes[1].getDistance(), IsNearlyEqualTo(-10.f));
+  CHECK_THAT(orthoPlanes[2].getNormal(), IsNearlyEqualToVector(Raz::Axis::Y)); // Bottom
+  CHECK_THAT(orthoPlanes[2].getDistance(), IsNearlyEqualTo(-10.f));
+  CHECK_THAT(orthoPlanes[3].getNormal(), IsNearlyEqualToVector(-Raz::Axis::Y)); // Top
+  CHECK_THAT(orthoPlanes[3].getDistance(), IsNearlyEqualTo(-10.f));
+  CHECK_THAT(orthoPlanes[4].getNormal(), IsNearlyEqualToVector(-Raz::Axis::Z)); // Near
+  CHECK_THAT(orthoPlanes[4].getDistance(), IsNearlyEqualTo(1.f, 0.00001f));
+  CHECK_THAT(orthoPlanes[5].getNormal(), IsNearlyEqualToVector(Raz::Axis::Z)); // Far
+  CHECK_THAT(orthoPlanes[5].getDistance(), IsNearlyEqualTo(-100.f));
+
+  const std::array<Raz::Plane, 6>& perspPlanes = perspFrustum.getPlanes();
+
+  CHECK_THAT(perspPlanes[0].getNormal(), IsNearlyEqualToVector(Raz::Vec3f(1.f, 0.f, 1.f).normalize()));
+  CHECK_THAT(perspPlanes[0].getDistance(), IsNearlyEqualTo(0.f));
+  CHECK_THAT(perspPlanes[3].getNormal(), IsNearlyEqualToVector(Raz::Vec3f(0.f, -1.f, 1.f).normalize()));
+  CHECK_THAT(perspPlanes[3].getDistance(), IsNearlyEqualTo(0.f));
+  CHECK_THAT(perspPlanes[4].getNormal(), IsNearlyEqualToVector(Raz::Axis::Z));
+  CHECK_THAT(perspPlanes[4].getDistance(), IsNearlyEqualTo(100.f / 199.f));
+  CHECK_THAT(perspPlanes[5].getNormal(), IsNearlyEqualToVector(-Raz::Axis::Z));
+  CHECK_THAT(perspPlanes[5].getDistance(), IsNearlyEqualTo(-100.f, 0.001f));
+}
+
+TEST_CASE("Frustum point containment") {
+  CHECK(orthoFrustum.contains(Raz::Vec3f(0.f, 0.f, -50.f)));
+  CHECK(orthoFrustum.contains(Raz::Vec3f(-9.f, 9.f, -99.f)));
+  CHECK_FALSE(orthoFrustum.contains(Raz::Vec3f(0.f, 0.f, 0.f)));
+  CHECK_FALSE(orthoFrustum.contains(Raz::Vec3f(0.f, 0.f, -101.f)));
+  CHECK_FALSE(orthoFrustum.contains(Raz::Vec3f(11.f, 0.f, -50.f)));
+
+  CHECK(perspFrustum.contains(Raz::Vec3f(0.f, 0.f, 0.6f)));
+  CHECK(perspFrustum.contains(Raz::Vec3f(9.f, -9.f, 10.f)));
+  CHECK_FALSE(perspFrustum.contains(Raz::Vec3f(0.f, 0.f, 0.4f)));
+  CHECK_FALSE(perspFrustum.contains(Raz::Vec3f(0.f, 0.f, 101.f)));
+  CHECK_FALSE(perspFrustum.contains(Raz::Vec3f(11.f, 0.f, 10.f)));
+  CHECK_FALSE(perspFrustum.contains(Raz::Vec3f(0.f, 0.f, -10.f)));
+}
+
+TEST_CASE("Frustum-sphere visibility") {
+  CHECK(orthoFrustum.computeVisibility(Raz::Sphere(Raz::Vec3f(0.f, 0.f, -50.f), 5.f)) == Raz::Visibility::INSIDE);
+  CHECK(orthoFrustum.computeVisibility(Raz::Sphere(Raz::Vec3f(9.f, 0.f, -50.f), 5.f)) == Raz::Visibility::INTERSECTING);
+  CHECK(orthoFrustum.computeVisibility(Raz::Sphere(Raz::Vec3f(0.f, 0.f, 1.f), 0.5f)) == Raz::Visibility::OUTSIDE);
+  CHECK(orthoFrustum.computeVisibility(Raz::Sphere(Raz::Vec3f(0.f, 0.f, 0.f), 2.f)) == Raz::Visibility::INTERSECTING);
+  CHECK(orthoFrustum.computeVisibility(Raz::Sphere(Raz::Vec3f(0.f, 0.f, -50.f), 100.f)) == Raz::Visibility::INTERSECTING);
+
+  CHECK(perspFrustum.computeVisibility(Raz::Sphere(Raz::Vec3f(0.f, 0.f, 50.f), 10.f)) == Raz::Visibility::INSIDE);
+  CHECK(perspFrustum.computeVisibility(Raz::Sphere(Raz::Vec3f(0.f, 0.f, -5.f), 4.f)) == Raz::Visibility::OUTSIDE);
+  CHECK(perspFrustum.computeVisibility(Raz::Sphere(Raz::Vec3f(12.f, 0.f, 10.f), 2.f)) == Raz::Visibility::INTERSECTING);
+
+  // The sphere is outside of the frustum, but is not entirely behind any of the planes: the test is conservative & considers it intersecting
+  const Raz::Sphere cornerSphere(Raz::Vec3f(11.5f, 11.5f, -50.f), 2.f);
+  CHECK(orthoFrustum.computeVisibility(cornerSphere) == Raz::Visibility::INTERSECTING);
+
+  CHECK(orthoFrustum.intersects(Raz::Sphere(Raz::Vec3f(9.f, 0.f, -50.f), 5.f)));
+  CHECK_FALSE(orthoFrustum.intersects(Raz::Sphere(Raz::Vec3f(20.f, 0.f, -50.f), 5.f)));
+}
+
+TEST_CASE("Frustum-AABB visibility") {
+  CHECK(orthoFrustum.computeVisibility(Raz::AABB(Raz::Vec3f(-5.f, -5.f, -60.f), Raz::Vec3f(5.f, 5.f, -40.f))) == Raz::Visibility::INSIDE);
+  CHECK(orthoFrustum.computeVisibility(Raz::AABB(Raz::Vec3f(5.f, -5.f, -60.f), Raz::Vec3f(15.f, 5.f, -40.f))) == Raz::Visibility::INTERSECTING);
+  CHECK(orthoFrustum.computeVisibility(Raz::AABB(Raz::Vec3f(-5.f, -5.f, -110.f), Raz::Vec3f(5.f, 5.f, -101.f))) == Raz::Visibility::OUTSIDE);
+  CHECK(orthoFrustum.computeVisibility(Raz::AABB(Raz::Vec3f(-20.f), Raz::Vec3f(20.f))) == Raz::Visibility::INTERSECTING);
+
+  CHECK(perspFrustum.computeVisibility(Raz::AABB(Raz::Vec3f(-1.f, -1.f, 10.f), Raz::Vec3f(1.f, 1.f, 20.f))) == Raz::Visibility::INSIDE);
+  CHECK(perspFrustum.computeVisibility(Raz::AABB(Raz::Vec3f(11.f, -1.f, 5.f), Raz::Vec3f(12.f, 1.f, 10.f))) == Raz::Visibility::OUTSIDE);
+
+  CHECK(perspFrustum.intersects(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f))));
+  CHECK_FALSE(perspFrustum.intersects(Raz::AABB(Raz::Vec3f(-1.f, -1.f, -3.f), Raz::Vec3f(1.f, 1.f, -2.f))));
+}
+
+TEST_CASE("Frustum-OBB visibility") {
+  // A long box laying along the X axis crosses the right plane; rotated around Y, it lays along the Z axis & gets entirely outside
+  const Raz::AABB longBox(Raz::Vec3f(7.f, -0.1f, -50.1f), Raz::Vec3f(17.f, 0.1f, -49.9f));
+  const Raz::OBB rotatedLongBox(longBox, Raz::Mat3f(Raz::Quaternionf(Raz::Degreesf(90.f), Raz::Axis::Y).computeMatrix()));
+
+  CHECK(orthoFrustum.computeVisibility(Raz::OBB(longBox)) == Raz::Visibility::INTERSECTING);
+  CHECK(orthoFrustum.computeVisibility(rotatedLongBox) == Raz::Visibility::OUTSIDE);
+  CHECK_FALSE(orthoFrustum.intersects(rotatedLongBox));
+
+  // A cube rotated by 45° becomes wider: fully inside unrotated, it then crosses the left plane
+  const Raz::AABB cube(Raz::Vec3f(-9.8f, -1.f, -51.f), Raz::Vec3f(-7.8f, 1.f, -49.f));
+  CHECK(orthoFrustum.computeVisibility(Raz::OBB(cube)) == Raz::Visibility::INSIDE);
+  CHECK(orthoFrustum.computeVisibility(Raz::OBB(cube, Raz::Mat3f(Raz::Quaternionf(Raz::Degreesf(45.f), Raz::Axis::Z).computeMatrix())))
+        == Raz::Visibility::INTERSECTING);
+
+  // Without rotation, an OBB gives the same results as the equivalent AABB
+  CHECK(perspFrustum.computeVisibility(Raz::OBB(cube)) == perspFrustum.computeVisibility(cube));
+}
+
+TEST_CASE("Frustum batch visibility") {
+  // The objects are spread so that all visibilities are represented; their count is not a multiple of any lanes width
+  constexpr std::size_t objectCount = 1027;
+
+  Raz::SphereBatch spheres;
+  spheres.resize(objectCount);
+
+  Raz::BoxBatch boxes;
+  boxes.resize(objectCount);
+
+  for (std::size_t objectIndex = 0; objectIndex < objectCount; ++objectIndex) {
+    const auto index = static_cast<float>(objectIndex);
+    const Raz::Vec3f center(std::sin(index * 0.37f) * 15.f, std::cos(index * 0.73f) * 15.f, index * 0.11f - 60.f);
+    const float size = 0.5f + static_cast<float>(objectIndex % 7);
+
+    spheres.setSphere(objectIndex, Raz::Sphere(center, size));
+    boxes.setBox(objectIndex, Raz::AABB(center - Raz::Vec3f(size, size * 0.5f, size * 2.f), center + Raz::Vec3f(size, size * 0.5f, size * 2.f)));
+  }
+
+  for (const Raz::Frustum* frustum : { &orthoFrustum, &perspFrustum }) {
+    std::vector<Raz::Visibility> sphereVisibilities;
+    frustum->computeVisibility(spheres, sphereVisibilities);
+    REQUIRE(sphereVisibilities.size() == objectCount);
+
+    std::vector<Raz::Visibility> boxVisibilities;
+    frustum->computeVisibility(boxes, boxVisibilities);
+    REQUIRE(boxVisibilities.size() == objectCount);
+
+    std::array<std::size_t, 3> visibilityCounts {};
+    std::size_t mismatchCount = 0;
+
+    for (std::size_t objectIndex = 0; objectIndex < objectCount; ++objectIndex) {
+      if (sphereVisibilities[objectIndex] != frustum->computeVisibility(spheres.recoverSphere(objectIndex)))
+        ++mismatchCount;
+
+      if (boxVisibilities[objectIndex] != frustum->computeVisibility(boxes.recoverBox(objectIndex)))
+        ++mismatchCount;
+
+      ++visibilityCounts[static_cast<std::size_t>(sphereVisibilities[objectIndex])];
+    }
+
+    CHECK(mismatchCount == 0);
+    CHECK(visibilityCounts[static_cast<std::size_t>(Raz::Visibility::OUTSIDE)] > 0);
+    CHECK(visibilityCounts[static_cast<std::size_t>(Raz::Visibility::INTERSECTING)] > 0);
+    CHECK(visibilityCounts[static_cast<std::size_t>(Raz::Visibility::INSIDE)] > 0);
+  }
+}
@@ -0,0 +1,70 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/IndexMap.hpp"
+
+#include <array>
+#include <string>
+
+TEST_CASE("IndexMap basic") {
+  Raz::IndexMap<std::string> indexMap;
+
+  CHECK(indexMap.isEmpty());
+  CHECK(indexMap.find("first") == Raz::IndexMap<std::string>::invalidIndex);
+
+  CHECK(indexMap.emplace("first") == std::make_pair(0u, true));
+  CHECK(indexMap.emplace("second") == std::make_pair(1u, true));
+  CHECK(indexMap.emplace("first") == std::make_pair(0u, false));
+  CHECK(indexMap.emplace("third") == std::make_pair(2u, true));
+  CHECK(indexMap.emplace("second") == std::make_pair(1u, false));
+
+  CHECK(indexMap.getKeyCount() == 3);
+  CHECK(indexMap.getKeys() == std::vector<std::string>({ "first", "second", "third" }));
+
+  CHECK(indexMap.find("first") == 0);
+  CHECK(indexMap.find("third") == 2);
+  CHECK(indexMap.find("fourth") == Raz::IndexMap<std::string>::invalidIndex);
+
+  const std::vector<std::string> keys = indexMap.extractKeys();
+  CHECK(keys.size() == 3);
+  CHECK(indexMap.isEmpty());
+  CHECK(indexMap.find("first") == Raz::IndexMap<std::string>::invalidIndex);
+
+  CHECK(indexMap.emplace("fourth") == std::make_pair(0u, true));
+  indexMap.clear();
+  CHECK(indexMap.isEmpty());
+  CHECK(indexMap.find("fourth") == Raz::IndexMap<std::string>::invalidIndex);
+}
+
+TEST_CASE("IndexMap growth") {
+  struct KeyHasher {
+    std::size_t operator()(const std::array<int, 3>& key) const noexcept {
+      return (static_cast<std::size_t>(key[0]) * 73856093) ^ (static_cast<std::size_t>(key[1]) * 19349663) ^ (static_cast<std::size_t>(key[2]) * 83492791);
+    }
+  };
+
+  // A constant hash makes all keys collide, testing the probing
+  struct CollidingHasher {
+    std::size_t operator()(const std::array<int, 3>&) const noexcept { return 42; }
+  };
+
+  Raz::IndexMap<std::array<int, 3>, KeyHasher> indexMap;
+  Raz::IndexMap<std::array<int, 3>, CollidingHasher> collidingMap;
+
+  // The maps are not reserved, forcing them to be rehashed several times
+  for (int i = 0; i < 1000; ++i) {
+    const std::array<int, 3> key = { i % 10, i % 100, i };
+
+    CHECK(indexMap.emplace(key) == std::make_pair(static_cast<unsigned int>(i), true));
+    CHECK(collidingMap.emplace(key) == std::make_pair(static_cast<unsigned int>(i), true));
+  }
+
+  for (int i = 0; i < 1000; ++i) {
+    const std::array<int, 3> key = { i % 10, i % 100, i };
+
+    CHECK(indexMap.emplace(key) == std::make_pair(static_cast<unsigned int>(i), false));
+    CHECK(collidingMap.find(key) == static_cast<unsigned int>(i));
+  }
+
+  CHECK(indexMap.getKeyCount() == 1000);
+  CHECK(collidingMap.getKeyCount() == 1000);
+}
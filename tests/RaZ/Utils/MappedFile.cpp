@@ -0,0 +1,49 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/MappedFile.hpp"
+
+#include <fstream>
+
+TEST_CASE("MappedFile content") {
+  const Raz::FilePath filePath(RAZ_TESTS_ROOT + "assets/misc/ͳεs†_fílè_测试.τxt"s);
+  const Raz::MappedFile mappedFile(filePath);
+
+  std::ifstream file(filePath.getPathStr(), std::ios_base::in | std::ios_base::binary);
+  const std::string fileContent((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  REQUIRE_FALSE(mappedFile.isEmpty());
+  CHECK(mappedFile.getSize() == fileContent.size());
+  CHECK(mappedFile.getContent() == fileContent);
+  CHECK(mappedFile.getContent().substr(0, 21) == "НΣļlõ ωθяŁĐ!");
+}
+
+TEST_CASE("MappedFile empty file") {
+  {
+    std::ofstream file("émptÿ_fílè.txt");
+  }
+
+  const Raz::MappedFile mappedFile("émptÿ_fílè.txt");
+  CHECK(mappedFile.isEmpty());
+  CHECK(mappedFile.getData() == nullptr);
+  CHECK(mappedFile.getContent().empty());
+}
+
+TEST_CASE("MappedFile move") {
+  Raz::MappedFile mappedFile(RAZ_TESTS_ROOT + "assets/misc/ͳεs†_fílè_测试.τxt"s);
+  const std::size_t fileSize = mappedFile.getSize();
+  const char* fileData       = mappedFile.getData();
+
+  Raz::MappedFile movedFile(std::move(mappedFile));
+  CHECK(movedFile.getSize() == fileSize);
+  CHECK(movedFile.getData() == fileData);
+  CHECK(mappedFile.isEmpty());
+
+  mappedFile = std::move(movedFile);
+  CHECK(mappedFile.getData() == fileData);
+  CHECK(movedFile.getData() == nullptr);
+}
+
+TEST_CASE("MappedFile nonexistent file") {
+  CHECK_THROWS(Raz::MappedFile("nònëxïstënt_fílè.txt"));
+}
@@ -1,5 +1,6 @@
 #include "Catch.hpp"
 
+#include "RaZ/Math/FastMath.hpp"
 #include "RaZ/Utils/Ray.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
@@ -59,7 +60,11 @@ TEST_CASE("Ray-point intersection") {
   CHECK(ray2.intersects(topRightPoint, &hit));
 
   CHECK(hit.position == topRightPoint);
+#if defined(RAZ_USE_FAST_MATH)
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(-ray2.getDirection(), Raz::FastMath::comparisonTolerance));
+#else
   CHECK(hit.normal   == -ray2.getDirection());
+#endif
   CHECK(hit.distance == Raz::Vec3f(3.f, 3.f, 0.f).computeLength()); // 4.2426405f
 
   //     topPoint  topRightPoint
@@ -139,8 +144,8 @@ TEST_CASE("Ray-sphere intersection") {
   CHECK_THAT(hit.distance, IsNearlyEqualTo(10.f));
 
   CHECK(ray2.intersects(sphere2, &hit));
-  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(5.0000005f, 5.0000005f, 0.f)));
-  CHECK_THAT(hit.normal, IsNearlyEqualToVector(-Raz::Axis::Y));
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(5.0000005f, 5.0000005f, 0.f), Raz::FastMath::comparisonTolerance));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(-Raz::Axis::Y, Raz::FastMath::comparisonTolerance));
   CHECK_THAT(hit.distance, IsNearlyEqualTo(8.4852819f));
 
   CHECK_FALSE(ray3.intersects(sphere2));
@@ -152,7 +157,7 @@ TEST_CASE("Ray-sphere intersection") {
   CHECK(ray3.intersects(sphere3, &hit));
   CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(-9.2928934f, -9.2928934f, 0.f)));
   CHECK_THAT(hit.normal, IsNearlyEqualToVector(Raz::Vec3f(0.70710683f, 0.70710683f, 0.f)));
-  CHECK_THAT(hit.distance, IsNearlyEqualTo(14.5563498f));
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(14.5563498f, Raz::FastMath::comparisonTolerance));
 }
 
 TEST_CASE("Ray-triangle intersection") {
@@ -199,7 +204,7 @@ TEST_CASE("Ray-triangle intersection") {
 
   CHECK(ray3.intersects(triangle3, &hit));
   // The second point is almost aligned with the ray; see https://www.geogebra.org/m/g4pumzwu
-  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(-1.5000002f, -1.5000002f, 0.f)));
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(-1.5000002f, -1.5000002f, 0.f), Raz::FastMath::comparisonTolerance));
   CHECK_THAT(hit.normal, IsNearlyEqualToVector(Raz::Vec3f(-0.077791f, 0.9334918f, -0.3500594f)));
   CHECK_THAT(hit.distance, IsNearlyEqualTo(3.5355341f));
 }
@@ -275,6 +280,55 @@ TEST_CASE("Ray-AABB intersection") {
   //CHECK(hit.distance == 0.f);
 }
 
+TEST_CASE("Ray-quad intersection") {
+  // Vertical quad facing +Z, made of two triangles sharing the diagonal going from its left top to its right bottom point
+  const Raz::Quad quad(Raz::Vec3f(-1.f, 1.f, 0.f), Raz::Vec3f(1.f, 1.f, 0.f), Raz::Vec3f(1.f, -1.f, 0.f), Raz::Vec3f(-1.f, -1.f, 0.f));
+
+  Raz::RayHit hit;
+
+  // Hitting the first triangle
+  CHECK(Raz::Ray(Raz::Vec3f(0.5f, 0.5f, 2.f), -Raz::Axis::Z).intersects(quad, &hit));
+  CHECK(hit.position == Raz::Vec3f(0.5f, 0.5f, 0.f));
+  CHECK(hit.normal   == Raz::Axis::Z);
+  CHECK(hit.distance == 2.f);
+
+  // Hitting the second triangle, from behind
+  CHECK(Raz::Ray(Raz::Vec3f(-0.5f, -0.5f, -3.f), Raz::Axis::Z).intersects(quad, &hit));
+  CHECK(hit.position == Raz::Vec3f(-0.5f, -0.5f, 0.f));
+  CHECK(hit.normal   == -Raz::Axis::Z);
+  CHECK(hit.distance == 3.f);
+
+  CHECK(quad.intersects(Raz::Ray(Raz::Vec3f(0.f, 0.f, 1.f), -Raz::Axis::Z), nullptr));
+
+  CHECK_FALSE(Raz::Ray(Raz::Vec3f(1.5f, 0.f, 2.f), -Raz::Axis::Z).intersects(quad)); // Outside of the quad
+  CHECK_FALSE(Raz::Ray(Raz::Vec3f(0.f, 0.f, 2.f), Raz::Axis::Z).intersects(quad)); // Pointing away from the quad
+}
+
+TEST_CASE("Ray-OBB intersection") {
+  // A unit box rotated by 45 degrees around the Y axis
+  const Raz::OBB obb(Raz::AABB(Raz::Vec3f(-0.5f), Raz::Vec3f(0.5f)), Raz::Mat3f(0.70710678f, 0.f, -0.70710678f,
+                                                                               0.f,        1.f,  0.f,
+                                                                               0.70710678f, 0.f,  0.70710678f));
+
+  Raz::RayHit hit;
+
+  // Hitting an edge of the rotated box, located further than the unrotated box's face
+  CHECK(Raz::Ray(Raz::Vec3f(0.f, 0.f, 5.f), -Raz::Axis::Z).intersects(obb, &hit));
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(0.f, 0.f, 0.70710678f), 0.000001f));
+  CHECK_THAT(hit.distance, IsNearlyEqualTo(4.2928932f));
+
+  // Hitting a face, whose normal is rotated as well
+  CHECK(Raz::Ray(Raz::Vec3f(5.f, 0.f, 5.f), Raz::Vec3f(-1.f, 0.f, -1.f).normalize()).intersects(obb, &hit));
+  CHECK_THAT(hit.position, IsNearlyEqualToVector(Raz::Vec3f(0.35355339f, 0.f, 0.35355339f), Raz::FastMath::comparisonTolerance));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(Raz::Vec3f(1.f, 0.f, 1.f).normalize(), Raz::FastMath::comparisonTolerance));
+
+  CHECK(obb.intersects(Raz::Ray(Raz::Vec3f(0.f, 5.f, 0.f), -Raz::Axis::Y), nullptr));
+
+  // A ray passing close to the box's edge would hit its unrotated version, but not the rotated one
+  CHECK(Raz::Ray(Raz::Vec3f(0.45f, 0.f, 5.f), -Raz::Axis::Z).intersects(Raz::AABB(Raz::Vec3f(-0.5f), Raz::Vec3f(0.5f))));
+  CHECK_FALSE(Raz::Ray(Raz::Vec3f(0.75f, 0.f, 5.f), -Raz::Axis::Z).intersects(obb));
+}
+
 TEST_CASE("Point projection") {
   const Raz::Vec3f topPoint(0.f, 2.f, 0.f);
   const Raz::Vec3f topRightPoint(2.f, 2.f, 0.f);
@@ -294,8 +348,13 @@ TEST_CASE("Point projection") {
   //          ^
   //         /
   //        x < [ 0; 0 ]
+#if defined(RAZ_USE_FAST_MATH)
+  CHECK_THAT(ray2.computeProjection(topPoint), IsNearlyEqualToVector(Raz::Vec3f(1.f, 1.f, 0.f), Raz::FastMath::comparisonTolerance));
+  CHECK_THAT(ray2.computeProjection(topRightPoint), IsNearlyEqualToVector(topRightPoint, Raz::FastMath::comparisonTolerance));
+#else
   CHECK(ray2.computeProjection(topPoint) == Raz::Vec3f(1.f, 1.f, 0.f));
   CHECK(ray2.computeProjection(topRightPoint) == topRightPoint);
+#endif
 
   //     topPoint  topRightPoint
   //     [ 0; 2 ]    [ 2; 2 ]
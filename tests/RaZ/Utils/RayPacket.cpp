@@ -0,0 +1,180 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/RayPacket.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+// Generating deterministic pseudo-random values, so that the packet results can be compared against the scalar ones
+std::mt19937 generator(42);
+
+float getRandomValue(float min, float max) {
+  return std::uniform_real_distribution<float>(min, max)(generator);
+}
+
+Raz::Vec3f getRandomVector(float min, float max) {
+  return Raz::Vec3f(getRandomValue(min, max), getRandomValue(min, max), getRandomValue(min, max));
+}
+
+Raz::Ray getRandomRay() {
+  return Raz::Ray(getRandomVector(-5.f, 5.f), getRandomVector(-1.f, 1.f).normalize());
+}
+
+Raz::AABB getRandomBox() {
+  const Raz::Vec3f center      = getRandomVector(-3.f, 3.f);
+  const Raz::Vec3f halfExtents = getRandomVector(0.1f, 2.f);
+  return Raz::AABB(center - halfExtents, center + halfExtents);
+}
+
+Raz::Triangle getRandomTriangle() {
+  return Raz::Triangle(getRandomVector(-3.f, 3.f), getRandomVector(-3.f, 3.f), getRandomVector(-3.f, 3.f));
+}
+
+template <std::size_t Size>
+void checkRayPacket() {
+  for (std::size_t iteration = 0; iteration < 100; ++iteration) {
+    Raz::RayPacket<Size> packet;
+    std::array<float, Size> boxDistances {};
+    std::array<float, Size> triangleDistances {};
+
+    for (std::size_t rayIndex = 0; rayIndex < Size; ++rayIndex) {
+      packet.setRay(rayIndex, getRandomRay());
+      boxDistances[rayIndex]      = std::numeric_limits<float>::max();
+      triangleDistances[rayIndex] = std::numeric_limits<float>::max();
+    }
+
+    const Raz::AABB aabb         = getRandomBox();
+    const Raz::Triangle triangle = getRandomTriangle();
+
+    const uint32_t boxHits      = packet.intersects(aabb, boxDistances);
+    const uint32_t triangleHits = packet.intersects(triangle, triangleDistances);
+
+    for (std::size_t rayIndex = 0; rayIndex < Size; ++rayIndex) {
+      const Raz::Ray ray = packet.recoverRay(rayIndex);
+      Raz::RayHit hit;
+
+      const bool boxHit = ray.intersects(aabb, &hit);
+      CHECK(((boxHits >> rayIndex) & 1u) == boxHit);
+      CHECK(boxDistances[rayIndex] == (boxHit ? std::max(hit.distance, 0.f) : std::numeric_limits<float>::max()));
+
+      const bool triangleHit = ray.intersects(triangle, &hit);
+      CHECK(((triangleHits >> rayIndex) & 1u) == triangleHit);
+
+      if (triangleHit)
+        CHECK_THAT(triangleDistances[rayIndex], IsNearlyEqualTo(hit.distance, 0.0001f));
+    }
+  }
+}
+
+template <std::size_t Size>
+void checkShapePackets() {
+  for (std::size_t iteration = 0; iteration < 100; ++iteration) {
+    const Raz::Ray ray = getRandomRay();
+
+    Raz::AABBPacket<Size> aabbs;
+    Raz::TrianglePacket<Size> triangles;
+    std::vector<Raz::AABB> scalarBoxes;
+    std::vector<Raz::Triangle> scalarTriangles;
+
+    for (std::size_t shapeIndex = 0; shapeIndex < Size; ++shapeIndex) {
+      scalarBoxes.emplace_back(getRandomBox());
+      scalarTriangles.emplace_back(getRandomTriangle());
+
+      aabbs.setBox(shapeIndex, scalarBoxes[shapeIndex]);
+      triangles.setTriangle(shapeIndex, scalarTriangles[shapeIndex]);
+    }
+
+    std::array<float, Size> boxDistances {};
+    std::array<float, Size> triangleDistances {};
+
+    const uint32_t boxHits      = ray.intersects(aabbs, boxDistances);
+    const uint32_t triangleHits = ray.intersects(triangles, triangleDistances);
+
+    for (std::size_t shapeIndex = 0; shapeIndex < Size; ++shapeIndex) {
+      Raz::RayHit hit;
+
+      const bool boxHit = ray.intersects(scalarBoxes[shapeIndex], &hit);
+      CHECK(((boxHits >> shapeIndex) & 1u) == boxHit);
+      CHECK(boxDistances[shapeIndex] == (boxHit ? std::max(hit.distance, 0.f) : std::numeric_limits<float>::infinity()));
+
+      const bool triangleHit = ray.intersects(scalarTriangles[shapeIndex], &hit);
+      CHECK(((triangleHits >> shapeIndex) & 1u) == triangleHit);
+
+      if (triangleHit)
+        CHECK_THAT(triangleDistances[shapeIndex], IsNearlyEqualTo(hit.distance, 0.0001f));
+      else
+        CHECK(triangleDistances[shapeIndex] == std::numeric_limits<float>::infinity());
+    }
+  }
+}
+
+} // namespace
+
+TEST_CASE("RayPacket basic") {
+  Raz::RayPacket4 packet;
+  CHECK(packet.laneMask == 0);
+
+  packet.setRay(0, Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::X));
+  packet.setRay(2, Raz::Ray(Raz::Vec3f(1.f, 2.f, 3.f), -Raz::Axis::Z));
+  CHECK(packet.laneMask == 0b0101);
+
+  const Raz::Ray recoveredRay = packet.recoverRay(2);
+  CHECK(recoveredRay.getOrigin() == Raz::Vec3f(1.f, 2.f, 3.f));
+  CHECK(recoveredRay.getDirection() == -Raz::Axis::Z);
+
+  // Only active lanes can be hit; the distances of those which aren't are left untouched
+  const Raz::AABB aabb(Raz::Vec3f(-1.f), Raz::Vec3f(1.f, 5.f, 1.f));
+  std::array<float, 4> hitDistances = { 100.f, 100.f, 100.f, 100.f };
+
+  CHECK(packet.intersects(aabb, hitDistances) == 0b0101);
+  CHECK(hitDistances == std::array<float, 4>({ 0.f, 100.f, 2.f, 100.f }));
+
+  // The given distances act as maximum distances
+  hitDistances = { 100.f, 100.f, 1.f, 100.f };
+  CHECK(packet.intersects(aabb, hitDistances) == 0b0001);
+  CHECK(hitDistances == std::array<float, 4>({ 0.f, 100.f, 1.f, 100.f }));
+
+  const Raz::Triangle triangle(Raz::Vec3f(0.f, 0.f, 0.f), Raz::Vec3f(2.f, 4.f, 0.f), Raz::Vec3f(2.f, 0.f, 0.f));
+  hitDistances = { 100.f, 100.f, 100.f, 100.f };
+
+  CHECK(packet.intersects(triangle, hitDistances) == 0b0100);
+  CHECK(hitDistances[2] == 3.f);
+}
+
+TEST_CASE("RayPacket against scalar") {
+  checkRayPacket<4>();
+  checkRayPacket<8>();
+}
+
+TEST_CASE("Ray-shape packets intersection") {
+  const Raz::Ray ray(Raz::Vec3f(0.f, 0.f, -5.f), Raz::Axis::Z);
+
+  Raz::AABBPacket8 aabbs;
+  aabbs.setBox(0, Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+  aabbs.setBox(1, Raz::AABB(Raz::Vec3f(2.f), Raz::Vec3f(3.f)));
+  aabbs.setBox(5, Raz::AABB(Raz::Vec3f(-1.f, -1.f, 9.f), Raz::Vec3f(1.f, 1.f, 10.f)));
+
+  std::array<float, 8> hitDistances {};
+  CHECK(ray.intersects(aabbs, hitDistances) == 0b00100001);
+  CHECK(hitDistances[0] == 4.f);
+  CHECK(hitDistances[1] == std::numeric_limits<float>::infinity());
+  CHECK(hitDistances[5] == 14.f);
+
+  CHECK(ray.intersects(aabbs, hitDistances, 10.f) == 0b00000001); // The farthest box is out of reach
+
+  Raz::TrianglePacket4 triangles;
+  triangles.setTriangle(0, Raz::Triangle(Raz::Vec3f(-1.f, -1.f, 0.f), Raz::Vec3f(0.f, 1.f, 0.f), Raz::Vec3f(1.f, -1.f, 0.f)));
+  triangles.setTriangle(1, Raz::Triangle(Raz::Vec3f(-1.f, -1.f, -10.f), Raz::Vec3f(0.f, 1.f, -10.f), Raz::Vec3f(1.f, -1.f, -10.f))); // Behind
+  triangles.setTriangle(3, Raz::Triangle(Raz::Vec3f(1.f, 1.f, 2.f), Raz::Vec3f(2.f, 3.f, 2.f), Raz::Vec3f(3.f, 1.f, 2.f))); // Beside
+
+  std::array<float, 4> triangleDistances {};
+  CHECK(ray.intersects(triangles, triangleDistances) == 0b0001);
+  CHECK(triangleDistances[0] == 5.f);
+  CHECK(triangleDistances[1] == std::numeric_limits<float>::infinity());
+
+  checkShapePackets<4>();
+  checkShapePackets<8>();
+}
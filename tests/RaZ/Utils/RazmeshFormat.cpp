@@ -0,0 +1,166 @@
+#include "Catch.hpp"
+
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/RazmeshFormat.hpp"
+
+#include <fstream>
+#include <string_view>
+
+namespace {
+
+void checkSubmeshesEquality(const Raz::Submesh& submesh, const Raz::Submesh& importedSubmesh) {
+  REQUIRE(importedSubmesh.getVertexCount() == submesh.getVertexCount());
+  REQUIRE(importedSubmesh.getTriangleIndexCount() == submesh.getTriangleIndexCount());
+
+  for (std::size_t vertIndex = 0; vertIndex < submesh.getVertexCount(); ++vertIndex) {
+    const Raz::Vertex& vertex         = submesh.getVertices()[vertIndex];
+    const Raz::Vertex& importedVertex = importedSubmesh.getVertices()[vertIndex];
+
+    CHECK(importedVertex.position.strictlyEquals(vertex.position));
+    CHECK(importedVertex.texcoords.strictlyEquals(vertex.texcoords));
+    CHECK(importedVertex.normal.strictlyEquals(vertex.normal));
+    CHECK(importedVertex.tangent.strictlyEquals(vertex.tangent));
+  }
+
+  CHECK(importedSubmesh.getTriangleIndices() == submesh.getTriangleIndices());
+  CHECK(importedSubmesh.getRenderMode() == submesh.getRenderMode());
+
+  REQUIRE(importedSubmesh.getLods().size() == submesh.getLods().size());
+
+  for (std::size_t lodIndex = 0; lodIndex < submesh.getLods().size(); ++lodIndex) {
+    CHECK(importedSubmesh.getLods()[lodIndex].triangleIndices == submesh.getLods()[lodIndex].triangleIndices);
+    CHECK(importedSubmesh.getLods()[lodIndex].error == submesh.getLods()[lodIndex].error);
+  }
+}
+
+} // namespace
+
+TEST_CASE("RazmeshFormat checksum") {
+  // Reference values computed with xxHash64
+  CHECK(Raz::RazmeshFormat::computeChecksum("", 0) == 0xEF46DB3751D8E999ull);
+  CHECK(Raz::RazmeshFormat::computeChecksum("a", 1) == 0xD24EC4F1A98C6E5Bull);
+  CHECK(Raz::RazmeshFormat::computeChecksum("abc", 3) == 0x44BC2CF5AD770999ull);
+
+  constexpr std::string_view text = "The quick brown fox jumps over the lazy dog";
+  CHECK(Raz::RazmeshFormat::computeChecksum(text.data(), text.size()) == 0x0B242D361FDA71BCull);
+
+  CHECK(Raz::RazmeshFormat::computeChecksum(text.data(), text.size(), 1) != Raz::RazmeshFormat::computeChecksum(text.data(), text.size()));
+}
+
+TEST_CASE("RazmeshFormat save & import") {
+  // Mesh with several submeshes & no material
+  {
+    const Raz::Mesh mesh(RAZ_TESTS_ROOT + "../assets/meshes/ballQuads.obj"s);
+
+    Raz::Mesh multiMesh(Raz::Sphere(Raz::Vec3f(1.f, 2.f, 3.f), 2.5f), 10, Raz::SphereMeshType::UV);
+    multiMesh.getMaterials().clear();
+    Raz::Submesh& pointSubmesh = multiMesh.addSubmesh();
+    pointSubmesh.getVertices() = mesh.getSubmeshes().front().getVertices();
+    pointSubmesh.setRenderMode(Raz::RenderMode::POINT);
+    multiMesh.addSubmesh(); // Empty submesh
+
+    multiMesh.save("tèst_mültï.razmesh");
+
+    const Raz::Mesh importedMesh("tèst_mültï.razmesh");
+
+    REQUIRE(importedMesh.getSubmeshes().size() == 3);
+    CHECK(importedMesh.getMaterials().empty());
+
+    for (std::size_t submeshIndex = 0; submeshIndex < 3; ++submeshIndex)
+      checkSubmeshesEquality(multiMesh.getSubmeshes()[submeshIndex], importedMesh.getSubmeshes()[submeshIndex]);
+
+    // Bounding boxes are saved, not needing to be recomputed
+    const Raz::AABB& importedBox = importedMesh.getSubmeshes().front().getBoundingBox();
+    const Raz::AABB& expectedBox = multiMesh.getSubmeshes().front().computeBoundingBox();
+    CHECK(importedBox.getLeftBottomBackPos().strictlyEquals(expectedBox.getLeftBottomBackPos()));
+    CHECK(importedBox.getRightTopFrontPos().strictlyEquals(expectedBox.getRightTopFrontPos()));
+
+    const Raz::AABB& expectedMeshBox = multiMesh.computeBoundingBox();
+    CHECK(importedMesh.getBoundingBox().getLeftBottomBackPos().strictlyEquals(expectedMeshBox.getLeftBottomBackPos()));
+    CHECK(importedMesh.getBoundingBox().getRightTopFrontPos().strictlyEquals(expectedMeshBox.getRightTopFrontPos()));
+  }
+
+  // Mesh with a material, saved in an MTL file next to it
+  {
+    Raz::Mesh mesh(Raz::Sphere(Raz::Vec3f(0.f), 1.f), 5, Raz::SphereMeshType::UV);
+    static_cast<Raz::MaterialCookTorrance&>(*mesh.getMaterials().front()).setMetallicFactor(0.25f);
+
+    mesh.save("tèst_mätérïäl.razmesh");
+    CHECK(std::ifstream(Raz::FilePath("tèst_mätérïäl.mtl")).good());
+
+    const Raz::Mesh importedMesh("tèst_mätérïäl.razmesh");
+
+    REQUIRE(importedMesh.getSubmeshes().size() == 1);
+    checkSubmeshesEquality(mesh.getSubmeshes().front(), importedMesh.getSubmeshes().front());
+
+    REQUIRE(importedMesh.getMaterials().size() == 1);
+    REQUIRE(importedMesh.getMaterials().front()->getType() == Raz::MaterialType::COOK_TORRANCE);
+    CHECK(static_cast<const Raz::MaterialCookTorrance&>(*importedMesh.getMaterials().front()).getMetallicFactor() == 0.25f);
+    CHECK(importedMesh.getSubmeshes().front().getMaterialIndex() == 0);
+  }
+
+  // Mesh with levels of detail, saved after the submeshes' indices
+  {
+    Raz::Mesh mesh(RAZ_TESTS_ROOT + "../assets/meshes/ball.obj"s);
+    mesh.getMaterials().clear();
+
+    std::vector<Raz::Vertex> vertices = mesh.getSubmeshes().front().getVertices();
+    mesh.addSubmesh().getVertices() = std::move(vertices); // Submesh without any level of detail
+    mesh.generateLods();
+    REQUIRE_FALSE(mesh.getSubmeshes().front().getLods().empty());
+    REQUIRE(mesh.getSubmeshes().back().getLods().empty());
+
+    mesh.save("tèst_lôds.razmesh");
+
+    const Raz::Mesh importedMesh("tèst_lôds.razmesh");
+
+    REQUIRE(importedMesh.getSubmeshes().size() == mesh.getSubmeshes().size());
+
+    for (std::size_t submeshIndex = 0; submeshIndex < mesh.getSubmeshes().size(); ++submeshIndex)
+      checkSubmeshesEquality(mesh.getSubmeshes()[submeshIndex], importedMesh.getSubmeshes()[submeshIndex]);
+  }
+}
+
+TEST_CASE("RazmeshFormat invalid files") {
+  Raz::Mesh mesh(Raz::Sphere(Raz::Vec3f(0.f), 1.f), 5, Raz::SphereMeshType::UV);
+  mesh.getMaterials().clear();
+  mesh.save("tèst_ïnvälïd.razmesh");
+
+  std::string content;
+
+  {
+    std::ifstream file("tèst_ïnvälïd.razmesh", std::ios_base::in | std::ios_base::binary);
+    content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+
+  REQUIRE(content.size() > sizeof(Raz::RazmeshFormat::Header));
+
+  const auto writeFile = [] (const std::string& fileContent) {
+    std::ofstream file("tèst_ïnvälïd.razmesh", std::ios_base::out | std::ios_base::binary);
+    file.write(fileContent.data(), static_cast<std::streamsize>(fileContent.size()));
+  };
+
+  // Altered vertex data
+  std::string corruptedContent = content;
+  corruptedContent[content.size() / 2] ^= 1;
+  writeFile(corruptedContent);
+  CHECK_THROWS(Raz::Mesh("tèst_ïnvälïd.razmesh"));
+
+  // Truncated file
+  writeFile(content.substr(0, content.size() - 16));
+  CHECK_THROWS(Raz::Mesh("tèst_ïnvälïd.razmesh"));
+
+  // Invalid magic number
+  corruptedContent    = content;
+  corruptedContent[0] = 'X';
+  writeFile(corruptedContent);
+  CHECK_THROWS(Raz::Mesh("tèst_ïnvälïd.razmesh"));
+
+  // Incomplete header
+  writeFile(content.substr(0, 32));
+  CHECK_THROWS(Raz::Mesh("tèst_ïnvälïd.razmesh"));
+
+  writeFile(content);
+  CHECK_NOTHROW(Raz::Mesh("tèst_ïnvälïd.razmesh"));
+}
@@ -0,0 +1,237 @@
+#include "Catch.hpp"
+
+#include "RaZ/Render/Texture.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/Image.hpp"
+#include "RaZ/Utils/RaztexFormat.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace {
+
+Raz::Image createGradientImage(unsigned int width, unsigned int height, Raz::ImageColorspace colorspace) {
+  Raz::Image image(width, height, colorspace);
+  auto* data = static_cast<uint8_t*>(image.getDataPtr());
+
+  for (unsigned int y = 0; y < height; ++y) {
+    for (unsigned int x = 0; x < width; ++x) {
+      for (uint8_t channelIndex = 0; channelIndex < image.getChannelCount(); ++channelIndex) {
+        const unsigned int value = (channelIndex % 2 == 0 ? x * 255 / std::max(width - 1, 1u) : y * 255 / std::max(height - 1, 1u));
+        data[(y * width + x) * image.getChannelCount() + channelIndex] = static_cast<uint8_t>(value);
+      }
+    }
+  }
+
+  return image;
+}
+
+// Creates an image whose colors all lie on a line, which can be compressed with little loss
+Raz::Image createDiagonalGradientImage(unsigned int width, unsigned int height, Raz::ImageColorspace colorspace) {
+  Raz::Image image(width, height, colorspace);
+  auto* data = static_cast<uint8_t*>(image.getDataPtr());
+
+  for (unsigned int y = 0; y < height; ++y) {
+    for (unsigned int x = 0; x < width; ++x) {
+      const unsigned int value = (x + y) * 255 / (width + height - 2);
+      uint8_t* pixel = data + (y * width + x) * image.getChannelCount();
+
+      pixel[0] = static_cast<uint8_t>(value);
+      pixel[1] = static_cast<uint8_t>(255 - value);
+      pixel[2] = static_cast<uint8_t>(value / 2);
+
+      if (image.getChannelCount() == 4)
+        pixel[3] = static_cast<uint8_t>(255 - value / 2);
+    }
+  }
+
+  return image;
+}
+
+int computeMaxError(const uint8_t* pixels, uint8_t channelCount, uint8_t comparedChannelCount, const std::vector<uint8_t>& decompressedPixels, std::size_t pixelCount) {
+  int maxError = 0;
+
+  for (std::size_t pixelIndex = 0; pixelIndex < pixelCount; ++pixelIndex) {
+    for (uint8_t channelIndex = 0; channelIndex < comparedChannelCount; ++channelIndex) {
+      const int error = std::abs(static_cast<int>(pixels[pixelIndex * channelCount + channelIndex]) - decompressedPixels[pixelIndex * 4 + channelIndex]);
+      maxError = std::max(maxError, error);
+    }
+  }
+
+  return maxError;
+}
+
+void writeFile(const Raz::FilePath& filePath, const char* content, std::size_t contentSize) {
+  std::ofstream file(filePath, std::ios_base::out | std::ios_base::binary);
+  file.write(content, static_cast<std::streamsize>(contentSize));
+}
+
+} // namespace
+
+TEST_CASE("RaztexFormat data size") {
+  CHECK(Raz::RaztexFormat::computeDataSize(5, 3, Raz::RaztexFormat::PixelFormat::GRAY) == 15);
+  CHECK(Raz::RaztexFormat::computeDataSize(5, 3, Raz::RaztexFormat::PixelFormat::GRAY_ALPHA) == 30);
+  CHECK(Raz::RaztexFormat::computeDataSize(5, 3, Raz::RaztexFormat::PixelFormat::RGB) == 45);
+  CHECK(Raz::RaztexFormat::computeDataSize(5, 3, Raz::RaztexFormat::PixelFormat::RGBA) == 60);
+
+  // Blocks always cover 4x4 pixels, even if the image is smaller
+  CHECK(Raz::RaztexFormat::computeDataSize(1, 1, Raz::RaztexFormat::PixelFormat::BC1) == 8);
+  CHECK(Raz::RaztexFormat::computeDataSize(5, 3, Raz::RaztexFormat::PixelFormat::BC1) == 16);
+  CHECK(Raz::RaztexFormat::computeDataSize(8, 8, Raz::RaztexFormat::PixelFormat::BC3) == 64);
+}
+
+TEST_CASE("RaztexFormat block compression") {
+  // Uniform blocks only lose the endpoints' quantization
+  {
+    Raz::Image image(4, 4, Raz::ImageColorspace::RGBA);
+    auto* data = static_cast<uint8_t*>(image.getDataPtr());
+
+    for (std::size_t pixelIndex = 0; pixelIndex < 16; ++pixelIndex) {
+      data[pixelIndex * 4]     = 200;
+      data[pixelIndex * 4 + 1] = 100;
+      data[pixelIndex * 4 + 2] = 50;
+      data[pixelIndex * 4 + 3] = 150;
+    }
+
+    const std::vector<uint8_t> bc1Blocks = Raz::RaztexFormat::compressBlocks(data, 4, 4, 4, Raz::RaztexFormat::PixelFormat::BC1);
+    REQUIRE(bc1Blocks.size() == 8);
+    const std::vector<uint8_t> bc1Pixels = Raz::RaztexFormat::decompressBlocks(bc1Blocks.data(), 4, 4, Raz::RaztexFormat::PixelFormat::BC1);
+    REQUIRE(bc1Pixels.size() == 16 * 4);
+    CHECK(computeMaxError(data, 4, 3, bc1Pixels, 16) <= 4);
+    CHECK(bc1Pixels[3] == 255); // BC1 has no alpha
+
+    const std::vector<uint8_t> bc3Blocks = Raz::RaztexFormat::compressBlocks(data, 4, 4, 4, Raz::RaztexFormat::PixelFormat::BC3);
+    REQUIRE(bc3Blocks.size() == 16);
+    const std::vector<uint8_t> bc3Pixels = Raz::RaztexFormat::decompressBlocks(bc3Blocks.data(), 4, 4, Raz::RaztexFormat::PixelFormat::BC3);
+    CHECK(computeMaxError(data, 4, 4, bc3Pixels, 16) <= 4);
+    CHECK(bc3Pixels[3] == 150); // Alpha endpoints are not quantized
+  }
+
+  // Smooth gradients, with a size which is not a multiple of the blocks' one
+  {
+    const Raz::Image image = createDiagonalGradientImage(13, 6, Raz::ImageColorspace::RGB);
+    const auto* data = static_cast<const uint8_t*>(image.getDataPtr());
+
+    const std::vector<uint8_t> blocks = Raz::RaztexFormat::compressBlocks(data, 13, 6, 3, Raz::RaztexFormat::PixelFormat::BC1);
+    REQUIRE(blocks.size() == Raz::RaztexFormat::computeDataSize(13, 6, Raz::RaztexFormat::PixelFormat::BC1));
+
+    const std::vector<uint8_t> pixels = Raz::RaztexFormat::decompressBlocks(blocks.data(), 13, 6, Raz::RaztexFormat::PixelFormat::BC1);
+    REQUIRE(pixels.size() == 13 * 6 * 4);
+    CHECK(computeMaxError(data, 3, 3, pixels, 13 * 6) <= 20);
+  }
+
+  {
+    const Raz::Image image = createDiagonalGradientImage(16, 16, Raz::ImageColorspace::RGBA);
+    const auto* data = static_cast<const uint8_t*>(image.getDataPtr());
+
+    const std::vector<uint8_t> blocks = Raz::RaztexFormat::compressBlocks(data, 16, 16, 4, Raz::RaztexFormat::PixelFormat::BC3);
+    const std::vector<uint8_t> pixels = Raz::RaztexFormat::decompressBlocks(blocks.data(), 16, 16, Raz::RaztexFormat::PixelFormat::BC3);
+    CHECK(computeMaxError(data, 4, 4, pixels, 16 * 16) <= 20);
+  }
+}
+
+TEST_CASE("RaztexFormat cook & read") {
+  const Raz::Image image = createGradientImage(5, 3, Raz::ImageColorspace::RGB);
+
+  std::vector<char> content = Raz::RaztexFormat::cook(image, false, true);
+  REQUIRE(content.size() % Raz::RaztexFormat::alignment == 0);
+
+  {
+    const Raz::RaztexFormat::Content readContent = Raz::RaztexFormat::read(std::string_view(content.data(), content.size()), "tèst.raztex");
+    CHECK(readContent.header.width == 5);
+    CHECK(readContent.header.height == 3);
+    CHECK(readContent.header.pixelFormat == Raz::RaztexFormat::PixelFormat::RGB);
+    CHECK((readContent.header.flags & Raz::RaztexFormat::HeaderFlag::FLIPPED_VERTICALLY) != 0);
+
+    // Mipmaps go down to 1x1: 5x3, 2x1 & 1x1
+    REQUIRE(readContent.mipmaps.size() == 3);
+    CHECK(readContent.mipmaps[0].width == 5);
+    CHECK(readContent.mipmaps[0].height == 3);
+    CHECK(readContent.mipmaps[1].width == 2);
+    CHECK(readContent.mipmaps[1].height == 1);
+    CHECK(readContent.mipmaps[2].width == 1);
+    CHECK(readContent.mipmaps[2].height == 1);
+
+    // The first mipmap is the image itself
+    REQUIRE(readContent.mipmaps[0].dataSize == 5 * 3 * 3);
+    CHECK(std::equal(readContent.mipmaps[0].data, readContent.mipmaps[0].data + 5 * 3 * 3, static_cast<const uint8_t*>(image.getDataPtr())));
+  }
+
+  {
+    const std::vector<char> compressedContent = Raz::RaztexFormat::cook(image, true, false);
+    const Raz::RaztexFormat::Content readContent = Raz::RaztexFormat::read(std::string_view(compressedContent.data(), compressedContent.size()), "tèst.raztex");
+    CHECK(readContent.header.pixelFormat == Raz::RaztexFormat::PixelFormat::BC1);
+    CHECK(readContent.header.flags == 0);
+    REQUIRE(readContent.mipmaps.size() == 3);
+    CHECK(readContent.mipmaps[0].dataSize == 16);
+    CHECK(readContent.mipmaps[2].dataSize == 8);
+  }
+
+  // Grayscale images are never compressed
+  {
+    const std::vector<char> grayContent = Raz::RaztexFormat::cook(createGradientImage(4, 4, Raz::ImageColorspace::GRAY), true, false);
+    const Raz::RaztexFormat::Content readContent = Raz::RaztexFormat::read(std::string_view(grayContent.data(), grayContent.size()), "tèst.raztex");
+    CHECK(readContent.header.pixelFormat == Raz::RaztexFormat::PixelFormat::GRAY);
+  }
+
+  CHECK_THROWS(Raz::RaztexFormat::cook(Raz::Image(), false, false));
+
+  // Invalid contents
+  CHECK_THROWS(Raz::RaztexFormat::read(std::string_view(content.data(), 10), "tèst.raztex"));
+  CHECK_THROWS(Raz::RaztexFormat::read(std::string_view(content.data(), content.size() - 1), "tèst.raztex"));
+
+  content.back() ^= 1;
+  CHECK_THROWS(Raz::RaztexFormat::read(std::string_view(content.data(), content.size()), "tèst.raztex"));
+  content.back() ^= 1;
+
+  // A partial mipmap chain would make the texture incomplete
+  uint32_t mipmapCount = 2;
+  std::memcpy(content.data() + offsetof(Raz::RaztexFormat::Header, mipmapCount), &mipmapCount, sizeof(mipmapCount));
+  CHECK_THROWS(Raz::RaztexFormat::read(std::string_view(content.data(), content.size()), "tèst.raztex"));
+  mipmapCount = 3;
+  std::memcpy(content.data() + offsetof(Raz::RaztexFormat::Header, mipmapCount), &mipmapCount, sizeof(mipmapCount));
+  CHECK_NOTHROW(Raz::RaztexFormat::read(std::string_view(content.data(), content.size()), "tèst.raztex"));
+
+  content[0] = 'X';
+  CHECK_THROWS(Raz::RaztexFormat::read(std::string_view(content.data(), content.size()), "tèst.raztex"));
+}
+
+TEST_CASE("RaztexFormat texture loading") {
+  const Raz::Image image = createGradientImage(6, 4, Raz::ImageColorspace::RGBA);
+
+  Raz::Image flippedImage(6, 4, Raz::ImageColorspace::RGBA);
+  for (unsigned int y = 0; y < 4; ++y) {
+    std::copy_n(static_cast<const uint8_t*>(image.getDataPtr()) + y * 6 * 4, 6 * 4,
+                static_cast<uint8_t*>(flippedImage.getDataPtr()) + (3 - y) * 6 * 4);
+  }
+
+  const std::vector<char> content = Raz::RaztexFormat::cook(image, false, true);
+  writeFile("tèst_téxturé.raztex", content.data(), content.size());
+
+  {
+    // The texture is stored flipped, thus read as is if asking for a flip...
+    const Raz::Texture texture("tèst_téxturé.raztex", 0, true);
+    CHECK(texture.getImage().getWidth() == 6);
+    CHECK(texture.getImage().getHeight() == 4);
+    CHECK(texture.getImage() == image);
+  }
+
+  {
+    // ... & flipped back otherwise
+    const Raz::Texture texture("tèst_téxturé.raztex", 0, false);
+    CHECK(texture.getImage() == flippedImage);
+  }
+
+  // Compressed textures do not keep their image in memory
+  const std::vector<char> compressedContent = Raz::RaztexFormat::cook(image, true, true);
+  writeFile("tèst_cömpréssëd.raztex", compressedContent.data(), compressedContent.size());
+
+  CHECK_NOTHROW(Raz::Texture("tèst_cömpréssëd.raztex", 0, true));
+  CHECK_NOTHROW(Raz::Texture("tèst_cömpréssëd.raztex", 0, false));
+
+  const Raz::Texture compressedTexture("tèst_cömpréssëd.raztex", 0, true);
+  CHECK(compressedTexture.getImage().isEmpty());
+  CHECK(compressedTexture.getImage().getColorspace() == Raz::ImageColorspace::RGBA);
+}
@@ -1,5 +1,6 @@
 #include "Catch.hpp"
 
+#include "RaZ/Math/Quaternion.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
 namespace {
@@ -307,6 +308,60 @@ TEST_CASE("Triangle clockwiseness") {
   CHECK(testTriangle2.isCounterClockwise(Raz::Axis::Z));
 }
 
+TEST_CASE("Triangle-AABB intersection") {
+  CHECK(triangle1.intersects(aabb1)); // Crosses the box's top half
+  CHECK_FALSE(triangle1.intersects(aabb2));
+  CHECK_FALSE(triangle1.intersects(aabb3));
+
+  CHECK(triangle2.intersects(aabb1)); // Lays on the box's right face
+  CHECK(aabb1.intersects(triangle2));
+  CHECK_FALSE(triangle2.intersects(aabb3));
+
+  CHECK_FALSE(triangle3.intersects(aabb1)); // Is entirely below the box
+
+  // The triangle's bounding box intersects the AABB, but not the triangle itself
+  const Raz::Triangle diagonalTriangle(Raz::Vec3f(-2.f, 0.5f, 0.f), Raz::Vec3f(0.5f, -2.f, 0.f), Raz::Vec3f(0.5f, -2.f, 1.f));
+  CHECK_FALSE(diagonalTriangle.intersects(aabb1));
+  CHECK(diagonalTriangle.intersects(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(0.f))));
+}
+
+TEST_CASE("Triangle-OBB intersection") {
+  const Raz::Triangle testTriangle(Raz::Vec3f(0.6f, 0.f, -0.1f), Raz::Vec3f(1.f, 0.f, -0.1f), Raz::Vec3f(0.6f, 0.f, 0.1f));
+  CHECK_FALSE(testTriangle.intersects(aabb1));
+
+  // Rotating the box around X does not change its extent on this axis
+  const Raz::OBB rotatedBoxX(aabb1, Raz::Mat3f(Raz::Quaternionf(Raz::Degreesf(45.f), Raz::Axis::X).computeMatrix()));
+  CHECK_FALSE(testTriangle.intersects(rotatedBoxX));
+
+  // Rotating it by 45 degrees around Y or Z makes its edges reach ~0.7 units on X
+  const Raz::OBB rotatedBoxY(aabb1, Raz::Mat3f(Raz::Quaternionf(Raz::Degreesf(45.f), Raz::Axis::Y).computeMatrix()));
+  CHECK(testTriangle.intersects(rotatedBoxY));
+
+  const Raz::OBB rotatedBoxZ(aabb1, Raz::Mat3f(Raz::Quaternionf(Raz::Degreesf(45.f), Raz::Axis::Z).computeMatrix()));
+  CHECK(testTriangle.intersects(rotatedBoxZ));
+  CHECK(rotatedBoxZ.intersects(testTriangle));
+
+  CHECK(triangle1.intersects(Raz::OBB(aabb1)));
+  CHECK_FALSE(triangle1.intersects(Raz::OBB(aabb2, Raz::Mat3f(Raz::Quaternionf(Raz::Degreesf(30.f), Raz::Axis::X).computeMatrix()))));
+}
+
+TEST_CASE("Triangle point projection") {
+  CHECK(triangle1.computeProjection(Raz::Vec3f(0.f, 5.f, 0.f)) == Raz::Vec3f(0.f, 0.5f, 0.f)); // Projects onto the face
+  CHECK(triangle1.computeProjection(Raz::Vec3f(-5.f, 0.5f, 5.f)) == triangle1.getFirstPos()); // Projects onto the first vertex
+  CHECK(triangle1.computeProjection(Raz::Vec3f(0.f, -1.f, 5.f)) == Raz::Vec3f(0.f, 0.5f, 3.f)); // Projects onto the first edge
+  CHECK(triangle1.computeProjection(Raz::Vec3f(0.f, 0.5f, -10.f)) == triangle1.getThirdPos());
+
+  CHECK(triangle2.computeProjection(Raz::Vec3f(10.f, 0.f, 0.f)) == Raz::Vec3f(0.5f, 0.f, 0.f));
+  CHECK(triangle2.computeProjection(Raz::Vec3f(0.5f, -5.f, 0.f)) == Raz::Vec3f(0.5f, -0.5f, 0.f));
+
+  CHECK(triangle1.contains(Raz::Vec3f(0.f, 0.5f, 0.f)));
+  CHECK_FALSE(triangle1.contains(Raz::Vec3f(0.f, 0.6f, 0.f)));
+
+  CHECK(sphere1.intersects(triangle1));
+  CHECK(sphere1.intersects(triangle2));
+  CHECK_FALSE(sphere1.intersects(triangle3));
+}
+
 TEST_CASE("AABB basic") {
   CHECK(aabb1.computeCentroid() == Raz::Vec3f(0.f));
   CHECK(aabb2.computeCentroid() == Raz::Vec3f(3.5f, 4.f, 0.f));
@@ -350,3 +405,31 @@ TEST_CASE("AABB point containment") {
   CHECK_FALSE(aabb2.contains(point5));
   CHECK_FALSE(aabb3.contains(point5));
 }
+
+TEST_CASE("Shape bounding boxes") {
+  CHECK(line4.computeBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(-10.f, -10.f, 0.f));
+  CHECK(line4.computeBoundingBox().getRightTopFrontPos() == Raz::Vec3f(6.f, 6.f, 0.f));
+
+  // A plane being infinite, so is its bounding box
+  CHECK(plane2.computeBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(std::numeric_limits<float>::lowest()));
+  CHECK(plane2.computeBoundingBox().getRightTopFrontPos() == Raz::Vec3f(std::numeric_limits<float>::max()));
+
+  CHECK(sphere2.computeBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(0.f, 5.f, -5.f));
+  CHECK(sphere2.computeBoundingBox().getRightTopFrontPos() == Raz::Vec3f(10.f, 15.f, 5.f));
+
+  CHECK(triangle3.computeBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(-1.5f, -1.75f, -1.f));
+  CHECK(triangle3.computeBoundingBox().getRightTopFrontPos() == Raz::Vec3f(0.f, -1.f, 1.f));
+
+  const Raz::Quad quad(Raz::Vec3f(-1.f, 1.f, 0.5f), Raz::Vec3f(2.f, 1.f, 0.5f), Raz::Vec3f(2.f, -1.f, -0.5f), Raz::Vec3f(-1.f, -1.f, -0.5f));
+  CHECK(quad.computeBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(-1.f, -1.f, -0.5f));
+  CHECK(quad.computeBoundingBox().getRightTopFrontPos() == Raz::Vec3f(2.f, 1.f, 0.5f));
+
+  CHECK(aabb2.computeBoundingBox().getLeftBottomBackPos() == aabb2.getLeftBottomBackPos());
+  CHECK(aabb2.computeBoundingBox().getRightTopFrontPos() == aabb2.getRightTopFrontPos());
+
+  // An OBB's bounding box contains all of its rotated corners
+  const Raz::OBB obb(aabb3, Raz::Mat3f(Raz::Quaternionf(Raz::Degreesf(45.f), Raz::Axis::Z).computeMatrix()));
+  const Raz::AABB obbBox = obb.computeBoundingBox();
+  CHECK_THAT(obbBox.computeCentroid(), IsNearlyEqualToVector(aabb3.computeCentroid()));
+  CHECK_THAT(obbBox.computeHalfExtents(), IsNearlyEqualToVector(Raz::Vec3f(3.18198052f, 3.18198052f, 5.f), 0.000001f));
+}
@@ -2,6 +2,7 @@
 
 #include "RaZ/Utils/Threading.hpp"
 
+#include <algorithm>
 #include <numeric>
 #include <random>
 
@@ -70,6 +71,25 @@ TEST_CASE("Index parallelization - indivisible size") {
   CHECK(sumBeforeIncrement + values.size() == sumAfterIncrement);
 }
 
+TEST_CASE("Index parallelization - small size") {
+  // With fewer elements per thread than threads, all of them must still be processed exactly once
+  std::vector<int> values(10);
+
+  Raz::Threading::parallelize(values, [&values] (Raz::Threading::IndexRange range) noexcept {
+    for (std::size_t i = range.beginIndex; i < range.endIndex; ++i)
+      ++values[i];
+  }, 8);
+
+  CHECK(std::all_of(values.cbegin(), values.cend(), [] (int value) { return value == 1; }));
+
+  // An empty collection must not launch anything
+  const std::vector<int> emptyValues;
+  bool isCalled = false;
+
+  Raz::Threading::parallelize(emptyValues, [&isCalled] (Raz::Threading::IndexRange) noexcept { isCalled = true; }, 4);
+  CHECK_FALSE(isCalled);
+}
+
 TEST_CASE("Iterator parallelization - divisible size") {
   std::vector<int> values(2048); // Choosing a size that can be easily divided
   fillRandom(values);
@@ -0,0 +1,371 @@
+#include "AssetCooker.hpp"
+
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Utils/AssetArchive.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/Image.hpp"
+#include "RaZ/Utils/MappedFile.hpp"
+#include "RaZ/Utils/RaztexFormat.hpp"
+#include "RaZ/Utils/RazmeshFormat.hpp"
+#include "RaZ/Utils/StrUtils.hpp"
+#include "RaZ/Utils/Threading.hpp"
+#include "RaZ/Utils/Window.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <unordered_set>
+
+namespace fs = std::filesystem;
+
+namespace Raz::AssetCooker {
+
+namespace {
+
+constexpr const char* manifestFileName = "manifest";
+constexpr const char* textureFileName  = "texture.raztex";
+
+enum class AssetKind {
+  MESH,
+  TEXTURE
+};
+
+/// File produced by cooking an asset, kept in the asset's cache folder.
+struct CookedFile {
+  AssetArchiveFormat::EntryType type {};
+  std::string archivePath {};
+  std::string fileName {};
+};
+
+struct Asset {
+  AssetKind kind {};
+  fs::path sourcePath {};
+  std::string archivePath {};
+  fs::path cacheFolder {};
+  std::vector<CookedFile> cookedFiles {};
+  std::string error {};
+  bool isUpToDate = false;
+};
+
+/// Image to be converted into a raztex, either a texture asset or one saved along with a cooked mesh's materials.
+struct TextureJob {
+  std::size_t assetIndex {};
+  fs::path sourcePath {};
+  fs::path cookedPath {};
+  bool removeSource = false;
+  std::string error {};
+};
+
+inline FilePath toFilePath(const fs::path& path) {
+  return FilePath(path.u8string());
+}
+
+template <typename Func>
+void forEach(std::size_t count, Func&& action) {
+#if defined(RAZ_THREADS_AVAILABLE)
+  std::vector<std::size_t> indices(count);
+  for (std::size_t i = 0; i < count; ++i)
+    indices[i] = i;
+
+  Threading::parallelize(indices, [&action] (Threading::IterRange<std::vector<std::size_t>> range) {
+    for (const std::size_t index : range)
+      action(index);
+  });
+#else
+  for (std::size_t index = 0; index < count; ++index)
+    action(index);
+#endif
+}
+
+uint64_t hashFile(const fs::path& filePath, uint64_t seed) {
+  const MappedFile file(toFilePath(filePath));
+  return RazmeshFormat::computeChecksum(file.getData(), file.getSize(), seed);
+}
+
+std::string toHexadecimal(uint64_t value) {
+  constexpr std::string_view digits = "0123456789abcdef";
+
+  std::string hexValue(16, '0');
+  for (std::size_t digitIndex = 0; digitIndex < 16; ++digitIndex)
+    hexValue[15 - digitIndex] = digits[(value >> (digitIndex * 4)) & 15u];
+
+  return hexValue;
+}
+
+/// Recovers the material libraries referenced by an OBJ file & the textures they reference, which all affect the cooked mesh.
+std::vector<fs::path> recoverMeshDependencies(const fs::path& meshPath) {
+  std::vector<fs::path> dependencies;
+
+  if (StrUtils::toLowercaseCopy(meshPath.extension().u8string()) != ".obj")
+    return dependencies;
+
+  const MappedFile meshFile(toFilePath(meshPath));
+  const std::string_view content = meshFile.getContent();
+
+  for (std::size_t mtllibPos = content.find("mtllib"); mtllibPos != std::string_view::npos; mtllibPos = content.find("mtllib", mtllibPos + 6)) {
+    if (mtllibPos > 0 && content[mtllibPos - 1] != '\n')
+      continue;
+
+    const std::size_t lineEnd = std::min(content.find('\n', mtllibPos), content.size());
+    std::string mtlFileName(content.substr(mtllibPos + 6, lineEnd - mtllibPos - 6));
+    StrUtils::trim(mtlFileName);
+
+    const fs::path mtlPath = meshPath.parent_path() / fs::u8path(mtlFileName);
+    dependencies.push_back(mtlPath);
+
+    std::ifstream mtlFile(mtlPath, std::ios_base::in | std::ios_base::binary);
+    std::string line;
+
+    while (std::getline(mtlFile, line)) {
+      std::istringstream lineStream(line);
+      std::string tag;
+      std::string texturePath;
+      lineStream >> tag;
+
+      if (!StrUtils::startsWith(tag, "map_") && tag != "bump" && tag != "norm")
+        continue;
+
+      // The texture's path is the last value of the line, possibly preceded by options
+      while (lineStream >> texturePath) {}
+      dependencies.push_back(mtlPath.parent_path() / fs::u8path(texturePath));
+    }
+  }
+
+  return dependencies;
+}
+
+/// Converts a mesh into the razmesh format, saving its materials next to it.
+/// \return Images saved along with the materials, which remain to be converted.
+std::vector<TextureJob> cookMesh(Asset& asset, std::size_t assetIndex) {
+  const std::string fileName         = asset.sourcePath.filename().u8string();
+  const std::size_t lastSeparatorPos = asset.archivePath.find_last_of('/');
+  const std::string archiveFolder    = (lastSeparatorPos == std::string::npos ? std::string() : asset.archivePath.substr(0, lastSeparatorPos + 1));
+
+  // The mesh is saved under its full file name, so that meshes named the same with different extensions do not share their materials
+  Mesh mesh(toFilePath(asset.sourcePath), true);
+  mesh.generateLods();
+  mesh.save(toFilePath(asset.cacheFolder / fs::u8path(fileName + ".razmesh")));
+
+  asset.cookedFiles.push_back(CookedFile{ AssetArchiveFormat::EntryType::MESH, asset.archivePath, fileName + ".razmesh" });
+
+  if (fs::exists(asset.cacheFolder / fs::u8path(fileName + ".mtl")))
+    asset.cookedFiles.push_back(CookedFile{ AssetArchiveFormat::EntryType::MATERIAL, archiveFolder + fileName + ".mtl", fileName + ".mtl" });
+
+  std::vector<TextureJob> textureJobs;
+
+  for (const fs::directory_entry& entry : fs::directory_iterator(asset.cacheFolder)) {
+    if (entry.path().extension() != ".png")
+      continue;
+
+    const std::string generatedTextureName = entry.path().filename().u8string();
+
+    asset.cookedFiles.push_back(CookedFile{ AssetArchiveFormat::EntryType::TEXTURE, archiveFolder + generatedTextureName, generatedTextureName + ".raztex" });
+    textureJobs.push_back(TextureJob{ assetIndex, entry.path(), asset.cacheFolder / fs::u8path(generatedTextureName + ".raztex"), true, {} });
+  }
+
+  return textureJobs;
+}
+
+void cookTexture(TextureJob& job, const Settings& settings) {
+  const Image image(toFilePath(job.sourcePath), settings.flipTextures);
+  const std::vector<char> content = RaztexFormat::cook(image, settings.compressTextures, settings.flipTextures);
+
+  std::ofstream file(job.cookedPath, std::ios_base::out | std::ios_base::binary);
+  file.write(content.data(), static_cast<std::streamsize>(content.size()));
+
+  if (!file)
+    throw std::runtime_error("Error: Failed to write the cooked texture '" + job.cookedPath.u8string() + "'");
+
+  if (job.removeSource)
+    fs::remove(job.sourcePath);
+}
+
+void writeManifest(const Asset& asset) {
+  std::ofstream manifest(asset.cacheFolder / manifestFileName, std::ios_base::out | std::ios_base::binary);
+
+  for (const CookedFile& cookedFile : asset.cookedFiles)
+    manifest << static_cast<uint32_t>(cookedFile.type) << '\t' << cookedFile.archivePath << '\t' << cookedFile.fileName << '\n';
+}
+
+std::vector<CookedFile> readManifest(const fs::path& cacheFolder) {
+  std::ifstream manifest(cacheFolder / manifestFileName, std::ios_base::in | std::ios_base::binary);
+  std::vector<CookedFile> cookedFiles;
+  std::string line;
+
+  while (std::getline(manifest, line)) {
+    const std::size_t firstTabPos  = line.find('\t');
+    const std::size_t secondTabPos = line.find('\t', firstTabPos + 1);
+
+    if (firstTabPos == std::string::npos || secondTabPos == std::string::npos)
+      continue;
+
+    cookedFiles.push_back(CookedFile{ static_cast<AssetArchiveFormat::EntryType>(std::stoul(line.substr(0, firstTabPos))),
+                                      line.substr(firstTabPos + 1, secondTabPos - firstTabPos - 1),
+                                      line.substr(secondTabPos + 1) });
+  }
+
+  return cookedFiles;
+}
+
+} // namespace
+
+Statistics cook(const Settings& settings) {
+  if (!fs::is_directory(settings.assetFolder))
+    throw std::invalid_argument("Error: The asset folder '" + settings.assetFolder.u8string() + "' does not exist");
+
+  fs::create_directories(settings.cacheFolder);
+
+  // Gathering the assets to be cooked
+
+  std::vector<Asset> assets;
+
+  for (const fs::directory_entry& entry : fs::recursive_directory_iterator(settings.assetFolder)) {
+    if (!entry.is_regular_file())
+      continue;
+
+    const std::string extension = StrUtils::toLowercaseCopy(entry.path().extension().u8string());
+    Asset asset {};
+
+    if (extension == ".obj" || extension == ".off")
+      asset.kind = AssetKind::MESH;
+    else if (extension == ".png" || extension == ".tga")
+      asset.kind = AssetKind::TEXTURE;
+    else
+      continue;
+
+    asset.sourcePath  = entry.path();
+    asset.archivePath = fs::relative(entry.path(), settings.assetFolder).generic_u8string();
+    assets.push_back(std::move(asset));
+  }
+
+  // Computing the assets' keys in parallel, from their content & the ones of their dependencies
+
+  const std::string settingsDescription = "cooker" + std::to_string(version)
+                                        + ";razmesh" + std::to_string(RazmeshFormat::version)
+                                        + ";raztex" + std::to_string(RaztexFormat::version)
+                                        + ";compress" + std::to_string(settings.compressTextures)
+                                        + ";flip" + std::to_string(settings.flipTextures);
+  const uint64_t seed = RazmeshFormat::computeChecksum(settingsDescription.data(), settingsDescription.size());
+
+  forEach(assets.size(), [&assets, &settings, seed] (std::size_t assetIndex) {
+    Asset& asset = assets[assetIndex];
+
+    try {
+      uint64_t key = hashFile(asset.sourcePath, seed);
+
+      if (asset.kind == AssetKind::MESH) {
+        for (const fs::path& dependencyPath : recoverMeshDependencies(asset.sourcePath)) {
+          const std::array<uint64_t, 2> keys = { key, (fs::exists(dependencyPath) ? hashFile(dependencyPath, seed) : 0) };
+          key = RazmeshFormat::computeChecksum(keys.data(), sizeof(keys), seed);
+        }
+      }
+
+      asset.cacheFolder = settings.cacheFolder / toHexadecimal(key);
+      asset.isUpToDate  = (!settings.ignoreCache && fs::exists(asset.cacheFolder / manifestFileName));
+    } catch (const std::exception& exception) {
+      asset.error = exception.what();
+    }
+  });
+
+  // Converting the meshes, which must be done on a thread having an OpenGL context
+
+  std::vector<TextureJob> textureJobs;
+  std::optional<Window> window;
+
+  for (std::size_t assetIndex = 0; assetIndex < assets.size(); ++assetIndex) {
+    Asset& asset = assets[assetIndex];
+
+    if (asset.isUpToDate || !asset.error.empty())
+      continue;
+
+    fs::remove_all(asset.cacheFolder);
+    fs::create_directories(asset.cacheFolder);
+
+    if (asset.kind == AssetKind::TEXTURE) {
+      asset.cookedFiles.push_back(CookedFile{ AssetArchiveFormat::EntryType::TEXTURE, asset.archivePath, textureFileName });
+      textureJobs.push_back(TextureJob{ assetIndex, asset.sourcePath, asset.cacheFolder / textureFileName, false, {} });
+      continue;
+    }
+
+    if (!window)
+      window.emplace(1, 1, "", WindowSetting::INVISIBLE);
+
+    try {
+      std::vector<TextureJob> meshTextureJobs = cookMesh(asset, assetIndex);
+      textureJobs.insert(textureJobs.end(), std::make_move_iterator(meshTextureJobs.begin()), std::make_move_iterator(meshTextureJobs.end()));
+    } catch (const std::exception& exception) {
+      asset.error = exception.what();
+    }
+  }
+
+  // Converting all the textures in parallel
+
+  forEach(textureJobs.size(), [&textureJobs, &settings] (std::size_t jobIndex) {
+    try {
+      cookTexture(textureJobs[jobIndex], settings);
+    } catch (const std::exception& exception) {
+      textureJobs[jobIndex].error = exception.what();
+    }
+  });
+
+  for (const TextureJob& job : textureJobs) {
+    if (!job.error.empty() && assets[job.assetIndex].error.empty())
+      assets[job.assetIndex].error = job.error;
+  }
+
+  // Marking the assets as cooked, or discarding them if anything failed
+
+  Statistics stats {};
+
+  for (Asset& asset : assets) {
+    if (!asset.error.empty()) {
+      std::cerr << "Failed to cook '" << asset.archivePath << "': " << asset.error << '\n';
+
+      if (!asset.cacheFolder.empty())
+        fs::remove_all(asset.cacheFolder);
+
+      ++stats.failedAssetCount;
+      continue;
+    }
+
+    if (asset.isUpToDate) {
+      asset.cookedFiles = readManifest(asset.cacheFolder);
+      ++stats.upToDateAssetCount;
+    } else {
+      writeManifest(asset);
+      ++stats.cookedAssetCount;
+    }
+  }
+
+  // Packing the cooked files, which are mapped rather than read to avoid copying them all in memory
+
+  std::vector<MappedFile> cookedFiles;
+  std::vector<ArchivedAsset> archivedAssets;
+  std::unordered_set<std::string> usedCacheFolders;
+
+  for (const Asset& asset : assets) {
+    if (!asset.error.empty())
+      continue;
+
+    usedCacheFolders.emplace(asset.cacheFolder.filename().u8string());
+
+    for (const CookedFile& cookedFile : asset.cookedFiles) {
+      const MappedFile& file = cookedFiles.emplace_back(toFilePath(asset.cacheFolder / fs::u8path(cookedFile.fileName)));
+      archivedAssets.push_back(ArchivedAsset{ cookedFile.archivePath, cookedFile.type, file.getContent() });
+    }
+  }
+
+  stats.entryCount = archivedAssets.size();
+  AssetArchive::save(toFilePath(settings.archivePath), std::move(archivedAssets));
+
+  // Removing the cached assets which are not used anymore, so that the cache does not grow indefinitely
+  for (const fs::directory_entry& entry : fs::directory_iterator(settings.cacheFolder)) {
+    if (entry.is_directory() && usedCacheFolders.find(entry.path().filename().u8string()) == usedCacheFolders.cend())
+      fs::remove_all(entry.path());
+  }
+
+  return stats;
+}
+
+} // namespace Raz::AssetCooker
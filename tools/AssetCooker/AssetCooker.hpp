@@ -0,0 +1,45 @@
+#pragma once
+
+#ifndef RAZ_ASSETCOOKER_HPP
+#define RAZ_ASSETCOOKER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace Raz::AssetCooker {
+
+/// Version of the conversions; changing it invalidates all the previously cooked assets.
+constexpr uint32_t version = 3;
+
+struct Settings {
+  std::filesystem::path assetFolder {};  ///< Folder whose assets are cooked, the archived paths being relative to it.
+  std::filesystem::path archivePath {};  ///< Archive to pack the cooked assets into.
+  std::filesystem::path cacheFolder {};  ///< Folder in which the cooked assets are kept, to avoid converting them again if unchanged.
+  bool compressTextures = false;         ///< Block-compress the RGB & RGBA textures.
+  bool flipTextures     = true;          ///< Flip vertically the textures, as done when importing a mesh's materials.
+  bool ignoreCache      = false;         ///< Cook again all the assets, even if unchanged.
+};
+
+struct Statistics {
+  std::size_t cookedAssetCount {};       ///< Number of assets converted.
+  std::size_t upToDateAssetCount {};     ///< Number of assets already converted & unchanged since.
+  std::size_t failedAssetCount {};       ///< Number of assets whose conversion failed, which are not packed.
+  std::size_t entryCount {};             ///< Number of entries in the archive.
+};
+
+/// Cooks the meshes (OBJ & OFF) & textures (PNG & TGA) of a folder, packing them into an archive.
+///
+/// Each asset is identified by a key, computed from its content & the ones of its dependencies (a mesh's material libraries & their textures),
+///   along with the cooker's version & settings; assets whose key is found in the cache are not converted again.
+/// - Meshes are optimized for rendering, given levels of detail & converted into the razmesh format, their materials being saved in a material
+///   library archived next to them;
+/// - Textures are converted into the raztex format, with all their mipmaps & possibly block-compressed.
+/// \note Importing meshes requires an OpenGL context, which is created on the calling thread if any mesh has to be converted. Textures are converted in parallel.
+/// \param settings Settings to cook the assets with.
+/// \return Statistics of the cooking.
+Statistics cook(const Settings& settings);
+
+} // namespace Raz::AssetCooker
+
+#endif // RAZ_ASSETCOOKER_HPP
@@ -0,0 +1,74 @@
+#include "AssetCooker.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr const char* usage =
+  "Usage:\n"
+  "  RaZ_AssetCooker <asset folder> <archive file> [--cache <folder>] [--compress] [--no-flip] [--force]\n"
+  "      Converts the meshes (OBJ, OFF) & textures (PNG, TGA) of the asset folder, packing them into the archive.\n"
+  "      Converted assets are kept in the cache folder (the archive's path followed by '.cache' by default), & only converted again if changed.\n"
+  "    --compress  Block-compresses the RGB & RGBA textures (BC1 & BC3).\n"
+  "    --no-flip   Keeps the textures as read, instead of flipping them vertically as done when importing a mesh's materials.\n"
+  "    --force     Converts all the assets, ignoring the cache.\n";
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  try {
+    Raz::AssetCooker::Settings settings;
+    std::vector<std::string> positionalArgs;
+
+    for (int argIndex = 1; argIndex < argc; ++argIndex) {
+      const std::string arg = argv[argIndex];
+
+      if (arg == "--help" || arg == "-h") {
+        std::cout << usage;
+        return 0;
+      }
+
+      if (arg == "--compress") {
+        settings.compressTextures = true;
+      } else if (arg == "--no-flip") {
+        settings.flipTextures = false;
+      } else if (arg == "--force") {
+        settings.ignoreCache = true;
+      } else if (arg == "--cache") {
+        if (argIndex + 1 >= argc)
+          throw std::invalid_argument("Error: Missing value for the argument '" + arg + "'");
+
+        settings.cacheFolder = std::filesystem::u8path(argv[++argIndex]);
+      } else if (arg.size() > 1 && arg[0] == '-') {
+        throw std::invalid_argument("Error: Unknown argument '" + arg + "'");
+      } else {
+        positionalArgs.push_back(arg);
+      }
+    }
+
+    if (positionalArgs.size() != 2)
+      throw std::invalid_argument("Error: An asset folder & an archive file must be given");
+
+    settings.assetFolder = std::filesystem::u8path(positionalArgs[0]);
+    settings.archivePath = std::filesystem::u8path(positionalArgs[1]);
+
+    if (settings.cacheFolder.empty())
+      settings.cacheFolder = std::filesystem::u8path(positionalArgs[1] + ".cache");
+
+    const auto startTime = std::chrono::steady_clock::now();
+    const Raz::AssetCooker::Statistics stats = Raz::AssetCooker::cook(settings);
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTime;
+
+    std::cout << stats.cookedAssetCount << " asset(s) cooked, " << stats.upToDateAssetCount << " up to date, " << stats.failedAssetCount << " failed; "
+              << stats.entryCount << " entries packed into '" << positionalArgs[1] << "' in " << duration.count() << " s" << std::endl;
+
+    return (stats.failedAssetCount > 0 ? 1 : 0);
+  } catch (const std::exception& exception) {
+    std::cerr << exception.what() << "\n\n" << usage;
+    return 2;
+  }
+}